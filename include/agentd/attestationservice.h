@@ -27,13 +27,15 @@ extern "C" {
  * \param logsock       The logging service socket.  The attestation service
  *                      logs on this socket.
  * \param controlsock   The socket used to control the attestation service.
+ * \param wakeupsock    The datagram socket on which protocol services signal
+ *                      that a transaction has been submitted.
  *
  * \returns a status code on service exit indicating a normal or abnormal exit.
  *          - AGENTD_STATUS_SUCCESS on normal exit.
  *          - a non-zero error code on failure.
  */
 int attestationservice_entry_point(
-    int datasock, int logsock, int controlsock);
+    int datasock, int logsock, int controlsock, int wakeupsock);
 
 /**
  * \brief Spawn an attestation service process using the provided config
@@ -50,6 +52,8 @@ int attestationservice_entry_point(
  *                          data service.
  * \param controlsock       Pointer to the socket used to control the
  *                          attestation service.
+ * \param wakeupsock        Pointer to the datagram socket on which protocol
+ *                          services signal transaction submits.
  * \param attestationpid    Pointer to the attestation service pid, to be
  *                          updated on the successful completion of this
  *                          function.
@@ -80,7 +84,8 @@ int attestationservice_entry_point(
  */
 int start_attestationservice_proc(
     const bootstrap_config_t* bconf, const agent_config_t* conf, int* logsock,
-    int* datasock, int* controlsock, pid_t* attestationpid, bool runsecure);
+    int* datasock, int* controlsock, int* wakeupsock, pid_t* attestationpid,
+    bool runsecure);
 
 /* make this header C++ friendly. */
 #ifdef __cplusplus
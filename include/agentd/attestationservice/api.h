@@ -0,0 +1,92 @@
+/**
+ * \file agentd/attestationservice/api.h
+ *
+ * \brief Internal API for the attestation service.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef AGENTD_ATTESTATIONSERVICE_API_HEADER_GUARD
+#define AGENTD_ATTESTATIONSERVICE_API_HEADER_GUARD
+
+#include <agentd/config.h>
+#include <agentd/ipc.h>
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif  //__cplusplus
+
+/**
+ * \brief Attestation service API methods.
+ */
+enum attestationservice_api_method_enum
+{
+    /**
+     * \brief Lower bound of API methods.  Must be the first value in this
+     * enumeration.
+     */
+    ATTESTATIONSERVICE_API_METHOD_LOWER_BOUND,
+
+    /**
+     * \brief Configure the attestation service.
+     */
+    ATTESTATIONSERVICE_API_METHOD_CONFIGURE =
+        ATTESTATIONSERVICE_API_METHOD_LOWER_BOUND,
+
+    /**
+     * \brief The number of methods in this API.
+     *
+     * Must be immediately after the last enumerated method ID.
+     */
+    ATTESTATIONSERVICE_API_METHOD_UPPER_BOUND
+};
+
+/**
+ * \brief Configure the attestation service.
+ *
+ * \param sock          The socket on which this request is made.
+ * \param conf          The config data for this agentd instance.
+ *
+ * This must be the first API call on the attestation control socket.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_ATTESTATIONSERVICE_BAD_PARAMETER if the attestation
+ *        settings in the config have not been set.
+ *      - AGENTD_ERROR_ATTESTATIONSERVICE_IPC_WRITE_DATA_FAILURE if an error
+ *        occurred when writing to the socket.
+ */
+int attestationservice_api_sendreq_configure(
+    int sock, const agent_config_t* conf);
+
+/**
+ * \brief Receive a response from the attestation service configure call.
+ *
+ * \param sock          The socket on which this request is made.
+ * \param offset        The child context offset for this response.
+ * \param status        This value is updated with the status code returned from
+ *                      the request.
+ *
+ * On a successful return from this function, the status is updated with the
+ * status code from the API request.  This status should be checked.  A zero
+ * status indicates success, and a non-zero status indicates failure.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_ATTESTATIONSERVICE_IPC_READ_DATA_FAILURE if reading data
+ *        from the socket failed.
+ *      - AGENTD_ERROR_ATTESTATIONSERVICE_RESPONSE_PACKET_INVALID_SIZE if the
+ *        data packet size is unexpected.
+ *      - AGENTD_ERROR_ATTESTATIONSERVICE_RECVRESP_UNEXPECTED_METHOD_CODE if
+ *        the method code was unexpected.
+ */
+int attestationservice_api_recvresp_configure(
+    int sock, uint32_t* offset, uint32_t* status);
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif  //__cplusplus
+
+#endif /*AGENTD_ATTESTATIONSERVICE_API_HEADER_GUARD*/
@@ -79,6 +79,30 @@ typedef struct config_canonization
     int64_t block_max_transactions;
 } config_canonization_t;
 
+/**
+ * \brief Attestation data.
+ */
+typedef struct config_attestation
+{
+    disposable_t hdr;
+    bool max_milliseconds_set;
+    int64_t max_milliseconds;
+} config_attestation_t;
+
+/**
+ * \brief Datastore tuning data.
+ */
+typedef struct config_datastore
+{
+    disposable_t hdr;
+    bool readers_set;
+    int64_t readers;
+    bool flags_set;
+    int64_t flags;
+    bool max_readers_set;
+    int64_t max_readers;
+} config_datastore_t;
+
 /**
  * \brief Disposable list node.
  */
@@ -208,11 +232,28 @@ typedef struct config_private_key
 #define CONFIG_STREAM_TYPE_PRIVATE_KEY 0x0B
 #define CONFIG_STREAM_TYPE_PUBLIC_KEY 0x0C
 #define CONFIG_STREAM_TYPE_ENDORSER_KEY 0x0D
+#define CONFIG_STREAM_TYPE_DATASTORE_READERS 0x0E
+#define CONFIG_STREAM_TYPE_DATASTORE_FLAGS 0x0F
+#define CONFIG_STREAM_TYPE_DATASTORE_MAX_READERS 0x10
+#define CONFIG_STREAM_TYPE_PROTOCOL_INSTANCES 0x11
+#define CONFIG_STREAM_TYPE_ATTESTATION_MAX_MILLISECONDS 0x12
 #define CONFIG_STREAM_TYPE_EOM 0x80
 #define CONFIG_STREAM_TYPE_ERROR 0xFF
 
 #define BLOCK_MILLISECONDS_MAXIMUM 43200000
 #define BLOCK_TRANSACTIONS_MAXIMUM 100000
+#define ATTESTATION_MILLISECONDS_MINIMUM 10
+#define ATTESTATION_MILLISECONDS_MAXIMUM 3600000
+#define DATASTORE_READERS_MAXIMUM 64
+#define DATASTORE_MAX_READERS_MAXIMUM 32768
+#define PROTOCOL_INSTANCES_MAXIMUM 16
+
+#define DATASTORE_FLAG_NOMETASYNC 0x0001
+#define DATASTORE_FLAG_WRITEMAP 0x0002
+#define DATASTORE_FLAG_NORDAHEAD 0x0004
+#define DATASTORE_FLAG_MAPASYNC 0x0008
+#define DATASTORE_FLAGS_ALL 0x000F
+
 /**
  * \brief Root of the agent configuration AST.
  */
@@ -228,9 +269,19 @@ typedef struct agent_config
     int64_t block_max_milliseconds;
     bool block_max_transactions_set;
     int64_t block_max_transactions;
+    bool attestation_max_milliseconds_set;
+    int64_t attestation_max_milliseconds;
     const char* secret;
     const char* rootblock;
     const char* datastore;
+    bool datastore_readers_set;
+    int64_t datastore_readers;
+    bool datastore_flags_set;
+    int64_t datastore_flags;
+    bool datastore_max_readers_set;
+    int64_t datastore_max_readers;
+    bool protocol_instances_set;
+    int64_t protocol_instances;
     config_listen_address_t* listen_head;
     const char* chroot;
     config_user_group_t* usergroup;
@@ -253,6 +304,8 @@ typedef union config_val
     config_user_group_t* usergroup;
     config_listen_address_t* listenaddr;
     config_canonization_t* canonization;
+    config_attestation_t* attestation;
+    config_datastore_t* datastore_block;
     config_materialized_view_t* view;
     config_materialized_artifact_type_t* view_artifact;
     config_materialized_transaction_type_t* view_transaction;
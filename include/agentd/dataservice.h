@@ -310,6 +310,36 @@ enum dataservice_api_method_enum
      */
     DATASERVICE_API_METHOD_APP_BLOCK_ID_BY_HEIGHT_READ,
 
+    /**
+     * \brief Read a run of consecutive transactions from the process queue,
+     * starting at a given transaction ID.
+     */
+    DATASERVICE_API_METHOD_APP_PQ_TRANSACTION_LIST_READ,
+
+    /**
+     * \brief Read a run of consecutive blocks, starting at a given block
+     * height.
+     */
+    DATASERVICE_API_METHOD_APP_BLOCK_RANGE_READ,
+
+    /**
+     * \brief Read a page of an artifact's transaction history, starting at a
+     * given block height and index.
+     */
+    DATASERVICE_API_METHOD_APP_ARTIFACT_TRANSACTION_LIST_READ,
+
+    /**
+     * \brief Promote or drop a batch of transactions in the process queue
+     * under a single database transaction.
+     */
+    DATASERVICE_API_METHOD_APP_PQ_TRANSACTION_BATCH_UPDATE,
+
+    /**
+     * \brief Check whether an id is in use as a block, transaction, or
+     * artifact id.
+     */
+    DATASERVICE_API_METHOD_APP_ID_EXISTS_READ,
+
     /**
      * \brief The number of methods in this API.
      *
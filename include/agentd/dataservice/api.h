@@ -25,6 +25,9 @@ extern "C" {
  * \param sock              The socket on which this request is made.
  * \param alloc_opts        The allocator to use for this operation.
  * \param max_database_size The maximum size of the database.
+ * \param datastore_flags   The DATASTORE_FLAG_* tuning flags for the database.
+ * \param max_readers       The size of the database reader table, or 0 for
+ *                          the default.
  * \param datadir           The data directory to open.
  *
  * \returns a status code indicating success or failure.
@@ -36,7 +39,7 @@ extern "C" {
  */
 int dataservice_api_sendreq_root_context_init_block(
     int sock, allocator_options_t* alloc_opts, uint64_t max_database_size,
-    const char* datadir);
+    uint32_t datastore_flags, uint32_t max_readers, const char* datadir);
 
 /**
  * \brief Receive a response from the root context init api method call.
@@ -401,6 +404,9 @@ int dataservice_api_recvresp_global_settings_set_block(
  * \param sock              The socket on which this request is made.
  * \param alloc_opts        The allocator to use for this operation.
  * \param max_database_size The maximum size of the database.
+ * \param datastore_flags   The DATASTORE_FLAG_* tuning flags for the database.
+ * \param max_readers       The size of the database reader table, or 0 for
+ *                          the default.
  * \param datadir           The data directory to open.
  *
  * \returns a status code indicating success or failure.
@@ -414,7 +420,8 @@ int dataservice_api_recvresp_global_settings_set_block(
  */
 int dataservice_api_sendreq_root_context_init(
     RCPR_SYM(psock)* sock, allocator_options_t* alloc_opts,
-    uint64_t max_database_size, const char* datadir);
+    uint64_t max_database_size, uint32_t datastore_flags,
+    uint32_t max_readers, const char* datadir);
 
 /**
  * \brief Receive a response from the root context init api method call.
@@ -465,6 +472,9 @@ int dataservice_api_recvresp_root_context_init(
  * \param sock              The socket on which this request is made.
  * \param alloc_opts        The allocator to use for this operation.
  * \param max_database_size The maximum size of the database.
+ * \param datastore_flags   The DATASTORE_FLAG_* tuning flags for the database.
+ * \param max_readers       The size of the database reader table, or 0 for
+ *                          the default.
  * \param datadir           The data directory to open.
  *
  * \returns a status code indicating success or failure.
@@ -478,7 +488,8 @@ int dataservice_api_recvresp_root_context_init(
  */
 int dataservice_api_sendreq_root_context_init_old(
     ipc_socket_context_t* sock, allocator_options_t* alloc_opts,
-    uint64_t max_database_size, const char* datadir);
+    uint64_t max_database_size, uint32_t datastore_flags,
+    uint32_t max_readers, const char* datadir);
 
 /**
  * \brief Receive a response from the root context init api method call.
@@ -1681,6 +1692,36 @@ int dataservice_api_recvresp_transaction_get_old(
     ipc_socket_context_t* sock, uint32_t* offset, uint32_t* status,
     data_transaction_node_t* node, void** data, size_t* data_size);
 
+/**
+ * \brief Get a run of consecutive transactions from the transaction queue,
+ * starting at the given ID.
+ *
+ * The data service walks the queue in a single database transaction and
+ * returns up to max_count transactions in one response, which is decoded with
+ * \ref dataservice_decode_response_transaction_list_get().  Fewer
+ * transactions are returned if the end of the queue is reached or if the data
+ * service limits the size of the response.
+ *
+ * \param sock          The socket on which this request is made.
+ * \param alloc_opts    The allocator options to use for this operation.
+ * \param child         The child index used for the query.
+ * \param txn_id        The transaction UUID of the first transaction to
+ *                      retrieve.
+ * \param max_count     The maximum number of transactions to retrieve.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_GENERAL_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory condition.
+ *      - AGENTD_ERROR_IPC_WOULD_BLOCK if this write operation would block this
+ *        thread.
+ *      - AGENTD_ERROR_DATASERVICE_IPC_WRITE_DATA_FAILURE if an error occurred
+ *        when writing to the socket.
+ */
+int dataservice_api_sendreq_transaction_list_get_old(
+    ipc_socket_context_t* sock, allocator_options_t* alloc_opts, uint32_t child,
+    const uint8_t* txn_id, uint32_t max_count);
+
 /**
  * \brief Drop a transaction from the transaction queue by ID.
  *
@@ -1889,6 +1930,116 @@ int dataservice_api_recvresp_transaction_promote(
     RCPR_SYM(psock)* sock, RCPR_SYM(allocator)* alloc, uint32_t* offset,
     uint32_t* status);
 
+/**
+ * \brief Promote or drop a batch of transactions in the transaction queue.
+ *
+ * \param sock          The socket on which this request is made.
+ * \param alloc_opts    The allocator options to use for this operation.
+ * \param child         The child index used for the query.
+ * \param entries       The transaction ids and actions for this batch.
+ * \param count         The number of entries in this batch.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_GENERAL_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory condition.
+ *      - AGENTD_ERROR_IPC_WOULD_BLOCK if this write operation would block this
+ *        thread.
+ *      - AGENTD_ERROR_DATASERVICE_IPC_WRITE_DATA_FAILURE if an error occurred
+ *        when writing to the socket.
+ */
+int dataservice_api_sendreq_transaction_batch_update(
+    RCPR_SYM(psock)* sock, allocator_options_t* alloc_opts, uint32_t child,
+    const data_transaction_batch_update_entry_t* entries, size_t count);
+
+/**
+ * \brief Receive a response from the transaction batch update action.
+ *
+ * \param sock          The socket on which this request is made.
+ * \param alloc         The allocator to use for this operation.
+ * \param offset        The child context offset for this response.
+ * \param status        This value is updated with the status code returned from
+ *                      the request.
+ * \param statuses      The array, of count elements, which is updated with the
+ *                      status of each entry in the batch.
+ * \param count         The number of entries in the batch.
+ *
+ * On a successful return from this function, the status is updated with the
+ * status code from the API request.  This status should be checked.  A zero
+ * status indicates that the batch was committed, in which case the statuses
+ * array holds the outcome of each entry, such as
+ * AGENTD_ERROR_DATASERVICE_NOT_FOUND for a transaction that was no longer in
+ * the queue.  A non-zero status indicates that nothing in the batch was
+ * applied, and the statuses array is left unchanged.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_IPC_WOULD_BLOCK if the operation was halted because it
+ *        would block this thread.
+ *      - AGENTD_ERROR_DATASERVICE_IPC_READ_DATA_FAILURE if reading data from
+ *        the socket failed.
+ *      - AGENTD_ERROR_DATASERVICE_RECVRESP_UNEXPECTED_METHOD_CODE if the
+ *        method code was unexpected.
+ *      - AGENTD_ERROR_DATASERVICE_RESPONSE_PACKET_INVALID_SIZE if the number
+ *        of entry statuses does not match the batch.
+ *      - AGENTD_ERROR_GENERAL_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ */
+int dataservice_api_recvresp_transaction_batch_update(
+    RCPR_SYM(psock)* sock, RCPR_SYM(allocator)* alloc, uint32_t* offset,
+    uint32_t* status, uint32_t* statuses, size_t count);
+
+/**
+ * \brief Check whether an id is in use as a block, transaction, or artifact
+ * id.
+ *
+ * \param sock          The socket on which this request is made.
+ * \param alloc_opts    The allocator options to use for this operation.
+ * \param child         The child index used for the query.
+ * \param id            The UUID to check.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_GENERAL_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory condition.
+ *      - AGENTD_ERROR_IPC_WOULD_BLOCK if this write operation would block this
+ *        thread.
+ *      - AGENTD_ERROR_DATASERVICE_IPC_WRITE_DATA_FAILURE if an error occurred
+ *        when writing to the socket.
+ */
+int dataservice_api_sendreq_id_exists(
+    RCPR_SYM(psock)* sock, allocator_options_t* alloc_opts, uint32_t child,
+    const uint8_t* id);
+
+/**
+ * \brief Receive a response from the id exists action.
+ *
+ * \param sock          The socket on which this request is made.
+ * \param alloc         The allocator to use for this operation.
+ * \param offset        The child context offset for this response.
+ * \param status        This value is updated with the status code returned from
+ *                      the request.
+ *
+ * On a successful return from this function, the status is updated with the
+ * status code from the API request.  This status should be checked.  A zero
+ * status indicates that the id is in use, and
+ * AGENTD_ERROR_DATASERVICE_NOT_FOUND indicates that it is not.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_IPC_WOULD_BLOCK if the operation was halted because it
+ *        would block this thread.
+ *      - AGENTD_ERROR_DATASERVICE_IPC_READ_DATA_FAILURE if reading data from
+ *        the socket failed.
+ *      - AGENTD_ERROR_DATASERVICE_RECVRESP_UNEXPECTED_METHOD_CODE if the
+ *        method code was unexpected.
+ *      - AGENTD_ERROR_GENERAL_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ */
+int dataservice_api_recvresp_id_exists(
+    RCPR_SYM(psock)* sock, RCPR_SYM(allocator)* alloc, uint32_t* offset,
+    uint32_t* status);
+
 /**
  * \brief Promote a transaction from the transaction queue by ID.
  *
@@ -111,6 +111,86 @@ typedef struct dataservice_response_transaction_get
     size_t data_size;
 } dataservice_response_transaction_get_t;
 
+/**
+ * \brief Transaction List Get Response.
+ *
+ * The data member holds the encoded entries, which are read one at a time with
+ * \ref dataservice_decode_response_transaction_list_get_entry().
+ */
+typedef struct dataservice_response_transaction_list_get
+{
+    dataservice_response_header_t hdr;
+    size_t count;
+    const void* data;
+    size_t data_size;
+} dataservice_response_transaction_list_get_t;
+
+/**
+ * \brief Block Range Get Response.
+ *
+ * The data member holds the encoded entries, which are read one at a time with
+ * \ref dataservice_decode_response_block_range_get_entry().
+ */
+typedef struct dataservice_response_block_range_get
+{
+    dataservice_response_header_t hdr;
+    size_t count;
+    const void* data;
+    size_t data_size;
+} dataservice_response_block_range_get_t;
+
+/**
+ * \brief The encoded size of an artifact transaction list entry: the
+ * transaction id, block height, and index.
+ */
+#define DATASERVICE_ARTIFACT_TRANSACTION_ENTRY_SIZE (16 + 8 + 4)
+
+/**
+ * \brief Artifact Transaction List Get Response.
+ *
+ * The data member holds the encoded entries, which are read one at a time with
+ * \ref dataservice_decode_response_artifact_transaction_list_get_entry().  If
+ * more is set, the artifact's history continues after the last entry.
+ */
+typedef struct dataservice_response_artifact_transaction_list_get
+{
+    dataservice_response_header_t hdr;
+    bool more;
+    size_t count;
+    const void* data;
+    size_t data_size;
+} dataservice_response_artifact_transaction_list_get_t;
+
+/**
+ * \brief The encoded size of a transaction batch update request entry: the
+ * transaction id and action.
+ */
+#define DATASERVICE_TRANSACTION_BATCH_UPDATE_ENTRY_SIZE (16 + 4)
+
+/**
+ * \brief Transaction Batch Update Response.
+ *
+ * The data member holds one status per request entry, in network order.
+ */
+typedef struct dataservice_response_transaction_batch_update
+{
+    dataservice_response_header_t hdr;
+    size_t count;
+    const void* data;
+    size_t data_size;
+} dataservice_response_transaction_batch_update_t;
+
+/**
+ * \brief ID Exists Response.
+ *
+ * The status is AGENTD_STATUS_SUCCESS if the id is in use, and
+ * AGENTD_ERROR_DATASERVICE_NOT_FOUND if it is not.
+ */
+typedef struct dataservice_response_id_exists
+{
+    dataservice_response_header_t hdr;
+} dataservice_response_id_exists_t;
+
 /**
  * \brief Canonized Transaction Get Response.
  */
@@ -155,6 +235,15 @@ typedef struct dataservice_response_block_id_by_height_get
     uint8_t block_id[16];
 } dataservice_response_block_id_by_height_get_t;
 
+/**
+ * \brief Block ID Next / Prev / With Transaction Get Response.
+ */
+typedef struct dataservice_response_block_id_link_get
+{
+    dataservice_response_header_t hdr;
+    uint8_t block_id[16];
+} dataservice_response_block_id_link_get_t;
+
 /**
  * \brief Latest Block ID Get Response.
  */
@@ -361,6 +450,136 @@ int dataservice_decode_response_transaction_get(
     const void* resp, size_t size,
     dataservice_response_transaction_get_t* dresp);
 
+/**
+ * \brief Decode a response from the get transaction list query.
+ *
+ * On success, the entries in this response are validated, counted, and can be
+ * read using \ref dataservice_decode_response_transaction_list_get_entry().
+ *
+ * \param resp          The response payload to parse.
+ * \param size          The size of this response payload.
+ * \param dresp         The decoded response structure into which this response
+ *                      is decoded.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_DATASERVICE_RESPONSE_PACKET_INVALID_SIZE if the response
+ *        packet payload size is incorrect.
+ *      - AGENTD_ERROR_DATASERVICE_RESPONSE_INVALID_PARAMETER if one of the
+ *        parameters to the function is invalid.
+ */
+int dataservice_decode_response_transaction_list_get(
+    const void* resp, size_t size,
+    dataservice_response_transaction_list_get_t* dresp);
+
+/**
+ * \brief Decode the next entry from a get transaction list response.
+ *
+ * On success, the entries pointer and size are advanced past this entry, the
+ * node is updated with the entry's node data, and the cert pointer and size are
+ * updated to point to the entry's certificate inside of the response.
+ *
+ * \param entries       Pointer to the remaining entries to decode.
+ * \param entries_size  Pointer to the size of the remaining entries.
+ * \param node          The node to update with this entry.
+ * \param cert          Pointer to be updated with this entry's certificate.
+ * \param cert_size     Pointer to be updated with the certificate size.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_DATASERVICE_RESPONSE_PACKET_INVALID_SIZE if the
+ *        remaining entries are truncated or malformed.
+ */
+int dataservice_decode_response_transaction_list_get_entry(
+    const void** entries, size_t* entries_size, data_transaction_node_t* node,
+    const void** cert, size_t* cert_size);
+
+/**
+ * \brief Decode a response from the get block range query.
+ *
+ * On success, the entries in this response are validated, counted, and can be
+ * read using \ref dataservice_decode_response_block_range_get_entry().
+ *
+ * \param resp          The response payload to parse.
+ * \param size          The size of this response payload.
+ * \param dresp         The decoded response structure into which this response
+ *                      is decoded.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_DATASERVICE_RESPONSE_PACKET_INVALID_SIZE if the response
+ *        packet payload size is incorrect.
+ *      - AGENTD_ERROR_DATASERVICE_RESPONSE_INVALID_PARAMETER if one of the
+ *        parameters to the function is invalid.
+ */
+int dataservice_decode_response_block_range_get(
+    const void* resp, size_t size,
+    dataservice_response_block_range_get_t* dresp);
+
+/**
+ * \brief Decode the next entry from a get block range response.
+ *
+ * On success, the entries pointer and size are advanced past this entry, the
+ * node is updated with the entry's node data, and the cert pointer and size are
+ * updated to point to the entry's certificate inside of the response.
+ *
+ * \param entries       Pointer to the remaining entries to decode.
+ * \param entries_size  Pointer to the size of the remaining entries.
+ * \param node          The node to update with this entry.
+ * \param cert          Pointer to be updated with this entry's certificate.
+ * \param cert_size     Pointer to be updated with the certificate size.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_DATASERVICE_RESPONSE_PACKET_INVALID_SIZE if the
+ *        remaining entries are truncated or malformed.
+ */
+int dataservice_decode_response_block_range_get_entry(
+    const void** entries, size_t* entries_size, data_block_node_t* node,
+    const void** cert, size_t* cert_size);
+
+/**
+ * \brief Decode a response from the get artifact transaction list query.
+ *
+ * On success, the entries in this response are validated, counted, and can be
+ * read using
+ * \ref dataservice_decode_response_artifact_transaction_list_get_entry().
+ *
+ * \param resp          The response payload to parse.
+ * \param size          The size of this response payload.
+ * \param dresp         The decoded response structure into which this response
+ *                      is decoded.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_DATASERVICE_RESPONSE_PACKET_INVALID_SIZE if the response
+ *        packet payload size is incorrect.
+ *      - AGENTD_ERROR_DATASERVICE_RESPONSE_INVALID_PARAMETER if one of the
+ *        parameters to the function is invalid.
+ */
+int dataservice_decode_response_artifact_transaction_list_get(
+    const void* resp, size_t size,
+    dataservice_response_artifact_transaction_list_get_t* dresp);
+
+/**
+ * \brief Decode the next entry from a get artifact transaction list response.
+ *
+ * On success, the entries pointer and size are advanced past this entry, and
+ * the entry is updated with the transaction id, height, and index.
+ *
+ * \param entries       Pointer to the remaining entries to decode.
+ * \param entries_size  Pointer to the size of the remaining entries.
+ * \param entry         The entry to update.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_DATASERVICE_RESPONSE_PACKET_INVALID_SIZE if the
+ *        remaining entries are truncated.
+ */
+int dataservice_decode_response_artifact_transaction_list_get_entry(
+    const void** entries, size_t* entries_size,
+    data_artifact_transaction_entry_t* entry);
+
 /**
  * \brief Decode a response from the get canonized transaction query.
  *
@@ -418,6 +637,43 @@ int dataservice_decode_response_transaction_promote(
     const void* resp, size_t size,
     dataservice_response_transaction_promote_t* dresp);
 
+/**
+ * \brief Decode a response from the transaction batch update action.
+ *
+ * \param resp          The response payload to parse.
+ * \param size          The size of this response payload.
+ * \param dresp         The decoded response structure into which this response
+ *                      is decoded.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_DATASERVICE_RESPONSE_PACKET_INVALID_SIZE if the response
+ *        packet payload size is incorrect.
+ *      - AGENTD_ERROR_DATASERVICE_RESPONSE_INVALID_PARAMETER if one of the
+ *        parameters to the function is invalid.
+ */
+int dataservice_decode_response_transaction_batch_update(
+    const void* resp, size_t size,
+    dataservice_response_transaction_batch_update_t* dresp);
+
+/**
+ * \brief Decode a response from the id exists action.
+ *
+ * \param resp          The response payload to parse.
+ * \param size          The size of this response payload.
+ * \param dresp         The decoded response structure into which this response
+ *                      is decoded.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_DATASERVICE_RESPONSE_PACKET_INVALID_SIZE if the response
+ *        packet payload size is incorrect.
+ *      - AGENTD_ERROR_DATASERVICE_RESPONSE_INVALID_PARAMETER if one of the
+ *        parameters to the function is invalid.
+ */
+int dataservice_decode_response_id_exists(
+    const void* resp, size_t size, dataservice_response_id_exists_t* dresp);
+
 /**
  * \brief Decode a response from the block make operation.
  *
@@ -456,6 +712,26 @@ int dataservice_decode_response_block_id_by_height_get(
     const void* resp, size_t size,
     dataservice_response_block_id_by_height_get_t* dresp);
 
+/**
+ * \brief Decode a response from the block id next, block id prev, or block id
+ * with transaction query.
+ *
+ * \param resp          The response payload to parse.
+ * \param size          The size of this response payload.
+ * \param dresp         The decoded response structure into which this response
+ *                      is decoded.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_DATASERVICE_RESPONSE_PACKET_INVALID_SIZE if the response
+ *        packet payload size is incorrect.
+ *      - AGENTD_ERROR_DATASERVICE_RESPONSE_INVALID_PARAMETER if one of the
+ *        parameters to the function is invalid.
+ */
+int dataservice_decode_response_block_id_link_get(
+    const void* resp, size_t size,
+    dataservice_response_block_id_link_get_t* dresp);
+
 /**
  * \brief Decode a response from the get latest block id query.
  *
@@ -566,6 +842,57 @@ status dataservice_encode_request_block_id_by_height_get(
     vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts, uint32_t child,
     uint64_t height);
 
+/**
+ * \brief Encode a request to query the next block id.
+ *
+ * \param buffer        Pointer to an uninitialized \ref vccrypt_buffer_t to
+ *                      receive the encoded request.
+ * \param alloc_opts    The allocator options to use.
+ * \param child         The child context for this request.
+ * \param block_id      The block UUID for this request.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status dataservice_encode_request_block_id_next_get(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts, uint32_t child,
+    const RCPR_SYM(rcpr_uuid)* block_id);
+
+/**
+ * \brief Encode a request to query the previous block id.
+ *
+ * \param buffer        Pointer to an uninitialized \ref vccrypt_buffer_t to
+ *                      receive the encoded request.
+ * \param alloc_opts    The allocator options to use.
+ * \param child         The child context for this request.
+ * \param block_id      The block UUID for this request.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status dataservice_encode_request_block_id_prev_get(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts, uint32_t child,
+    const RCPR_SYM(rcpr_uuid)* block_id);
+
+/**
+ * \brief Encode a request to query the id of the block holding a transaction.
+ *
+ * \param buffer        Pointer to an uninitialized \ref vccrypt_buffer_t to
+ *                      receive the encoded request.
+ * \param alloc_opts    The allocator options to use.
+ * \param child         The child context for this request.
+ * \param txn_id        The transaction UUID for this request.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status dataservice_encode_request_block_id_with_transaction_get(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts, uint32_t child,
+    const RCPR_SYM(rcpr_uuid)* txn_id);
+
 /**
  * \brief Encode a request to make a block.
  *
@@ -696,6 +1023,9 @@ status dataservice_encode_request_latest_block_id_get(
  *                              request.
  * \param alloc_opts            The allocator options to use.
  * \param max_database_size     The maximum database size.
+ * \param datastore_flags       The DATASTORE_FLAG_* database tuning flags.
+ * \param max_readers           The size of the database reader table, or 0 for
+ *                              the default.
  * \param datadir               The data directory to open.
  *
  * \returns a status code indicating success or failure.
@@ -704,7 +1034,8 @@ status dataservice_encode_request_latest_block_id_get(
  */
 status dataservice_encode_request_root_context_init(
     vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
-    uint64_t max_database_size, const char* datadir);
+    uint64_t max_database_size, uint32_t datastore_flags,
+    uint32_t max_readers, const char* datadir);
 
 /**
  * \brief Encode a request to reduce the root capabilities of the dataservice.
@@ -757,6 +1088,73 @@ status dataservice_encode_request_transaction_get(
     vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts, uint32_t child,
     const RCPR_SYM(rcpr_uuid)* txn_id);
 
+/**
+ * \brief Encode a request to get a run of consecutive transactions from the
+ * process queue, starting at the given id.
+ *
+ * \param buffer        Pointer to an uninitialized \ref vccrypt_buffer_t to
+ *                      receive the encoded request.
+ * \param alloc_opts    The allocator options to use.
+ * \param child         The child context for this request.
+ * \param txn_id        The UUID of the first transaction to return.
+ * \param max_count     The maximum number of transactions to return.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status dataservice_encode_request_transaction_list_get(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts, uint32_t child,
+    const RCPR_SYM(rcpr_uuid)* txn_id, uint32_t max_count);
+
+/**
+ * \brief Encode a request to get a run of consecutive blocks, starting at the
+ * given block height.
+ *
+ * The data service returns at most max_count blocks.  It stops adding blocks
+ * once the certificates returned reach max_bytes, so the last block returned
+ * may run past this limit.  A value of zero for max_bytes uses the data
+ * service limit.
+ *
+ * \param buffer        Pointer to an uninitialized \ref vccrypt_buffer_t to
+ *                      receive the encoded request.
+ * \param alloc_opts    The allocator options to use.
+ * \param child         The child context for this request.
+ * \param start_height  The height of the first block to return.
+ * \param max_count     The maximum number of blocks to return.
+ * \param max_bytes     The certificate byte budget for this response.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status dataservice_encode_request_block_range_get(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts, uint32_t child,
+    uint64_t start_height, uint32_t max_count, uint32_t max_bytes);
+
+/**
+ * \brief Encode a request to get a page of an artifact's transaction history,
+ * starting at the given block height and index.
+ *
+ * \param buffer        Pointer to an uninitialized \ref vccrypt_buffer_t to
+ *                      receive the encoded request.
+ * \param alloc_opts    The allocator options to use.
+ * \param child         The child context for this request.
+ * \param artifact_id   The artifact id for this request.
+ * \param start_height  The block height at which the page starts.
+ * \param start_index   The index within the start height at which the page
+ *                      starts.
+ * \param max_count     The maximum number of transactions to return.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status dataservice_encode_request_artifact_transaction_list_get(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts, uint32_t child,
+    const RCPR_SYM(rcpr_uuid)* artifact_id, uint64_t start_height,
+    uint32_t start_index, uint32_t max_count);
+
 /**
  * \brief Encode a request to get the first transaction in the process queue.
  *
@@ -789,6 +1187,43 @@ status dataservice_encode_request_transaction_promote(
     vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts, uint32_t child,
     const RCPR_SYM(rcpr_uuid)* txn_id);
 
+/**
+ * \brief Encode a request to promote or drop a batch of transactions in the
+ * process queue.
+ *
+ * \param buffer        Pointer to an uninitialized \ref vccrypt_buffer_t to
+ *                      receive the encoded request.
+ * \param alloc_opts    The allocator options to use.
+ * \param child         The child context for this request.
+ * \param entries       The entries for this request.
+ * \param count         The number of entries for this request.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status dataservice_encode_request_transaction_batch_update(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts, uint32_t child,
+    const data_transaction_batch_update_entry_t* entries, size_t count);
+
+/**
+ * \brief Encode a request to check whether an id is in use as a block,
+ * transaction, or artifact id.
+ *
+ * \param buffer        Pointer to an uninitialized \ref vccrypt_buffer_t to
+ *                      receive the encoded request.
+ * \param alloc_opts    The allocator options to use.
+ * \param child         The child context for this request.
+ * \param id            The UUID to check.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status dataservice_encode_request_id_exists(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts, uint32_t child,
+    const RCPR_SYM(rcpr_uuid)* id);
+
 /**
  * \brief Encode a request to submit a transaction.
  *
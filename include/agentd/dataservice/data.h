@@ -116,6 +116,61 @@ typedef struct data_artifact_record
 
 } data_artifact_record_t;
 
+/**
+ * \brief An artifact transaction entry describes one transaction in the
+ * history of an artifact.
+ */
+typedef struct data_artifact_transaction_entry
+{
+    /**
+     * \brief The transaction ID.
+     */
+    uint8_t txn_id[16];
+
+    /**
+     * \brief The height of the block holding this transaction, in network
+     * order.
+     */
+    uint64_t net_height;
+
+    /**
+     * \brief The position of this transaction among the artifact's
+     * transactions in the same block, in network order.
+     */
+    uint32_t net_index;
+
+} data_artifact_transaction_entry_t;
+
+/**
+ * \brief Actions that can be applied to a process queue transaction as part
+ * of a batch update.
+ */
+typedef enum data_transaction_batch_action
+{
+    /*** \brief Promote the transaction to the attested state. */
+    DATASERVICE_TRANSACTION_BATCH_ACTION_PROMOTE = 0x00000000,
+    /*** \brief Drop the transaction from the process queue. */
+    DATASERVICE_TRANSACTION_BATCH_ACTION_DROP = 0x00000001,
+} data_transaction_batch_action_t;
+
+/**
+ * \brief A transaction batch update entry describes one action to apply to a
+ * transaction in the process queue.
+ */
+typedef struct data_transaction_batch_update_entry
+{
+    /**
+     * \brief The transaction ID.
+     */
+    uint8_t txn_id[16];
+
+    /**
+     * \brief The action to apply to this transaction, in host order.
+     */
+    uint32_t action;
+
+} data_transaction_batch_update_entry_t;
+
 /**
  * \brief A block node is a linked list node backed by the database, which is
  * used to describe a block in the blockchain.
@@ -65,18 +65,27 @@ typedef struct dataservice_child_context
  *
  * \param ctx               The private data service context to initialize.
  * \param max_database_size The max database size for this data service.
+ * \param datastore_flags   The DATASTORE_FLAG_* tuning flags for the database.
+ * \param max_readers       The size of the database reader table, or 0 for
+ *                          the default.
  * \param datadir           The data directory for this private data service.
  *
  * \returns a status code indicating success or failure.
  *      - AGENTD_STATUS_SUCCESS on success.
  *      - AGENTD_ERROR_DATASERVICE_NOT_AUTHORIZED if the root context is not
  *        authorized to perform this action.
+ *      - AGENTD_ERROR_DATASERVICE_VCCRYPT_SUITE_OPTIONS_INIT_FAILURE if this
+ *        function failed to initialize crypto suite options.
+ *      - AGENTD_ERROR_DATASERVICE_VCCERT_PARSER_OPTIONS_INIT_FAILURE if this
+ *        function failed to initialize parser options.
  *      - AGENTD_ERROR_DATASERVICE_MDB_ENV_CREATE_FAILURE if this function
  *        failed to create a database environment.
  *      - AGENTD_ERROR_DATASERVICE_MDB_ENV_SET_MAPSIZE_FAILURE if this function
  *        failed to set the database map size.
  *      - AGENTD_ERROR_DATASERVICE_MDB_ENV_SET_MAXDBS_FAILURE if this function
  *        failed to set the maximum number of databases.
+ *      - AGENTD_ERROR_DATASERVICE_MDB_ENV_SET_MAXREADERS_FAILURE if this
+ *        function failed to set the maximum number of readers.
  *      - AGENTD_ERROR_DATASERVICE_MDB_ENV_OPEN_FAILURE if this function failed
  *        to open the database environment.
  *      - AGENTD_ERROR_DATASERVICE_MDB_TXN_BEGIN_FAILURE if this function failed
@@ -88,7 +97,7 @@ typedef struct dataservice_child_context
  */
 int dataservice_root_context_init(
     dataservice_root_context_t* ctx, uint64_t max_database_size,
-    const char* datadir);
+    uint32_t datastore_flags, uint32_t max_readers, const char* datadir);
 
 /**
  * \brief Reduce the root capabilities of a private data service instance.
@@ -151,6 +160,11 @@ int dataservice_child_context_close(
  * this transaction is committed or aborted either before the parent transaction
  * is committed or aborted or before the data service is destroyed.
  *
+ * A child transaction can't be begun when the database is opened with
+ * DATASTORE_FLAG_WRITEMAP.  Data service calls given a parent transaction then
+ * run directly in the parent, so the parent must be aborted if such a call
+ * fails.
+ *
  * \param child         The child context under which this transaction should be
  *                      begun.
  * \param txn           The transaction to begin.
@@ -258,6 +272,8 @@ int dataservice_global_settings_set(
  *            not authorized to perform this operation.
  *          - AGENTD_ERROR_DATASERVICE_MDB_TXN_BEGIN_FAILURE if this function
  *            could not begin a database transaction to insert this transaction.
+ *          - AGENTD_ERROR_DATASERVICE_DUPLICATE_TRANSACTION_ID if this
+ *            transaction id is already in use by a canonized transaction.
  *          - AGENTD_ERROR_DATASERVICE_INVALID_STORED_TRANSACTION_NODE if this
  *            function encountered an invalid transaction node in the
  *            transaction queue.
@@ -401,6 +417,36 @@ int dataservice_transaction_promote(
     dataservice_child_context_t* child,
     dataservice_transaction_context_t* dtxn_ctx, const uint8_t* txn_id);
 
+/**
+ * \brief Promote or drop a batch of transactions in the queue.
+ *
+ * Every entry is applied under a single write transaction, which is committed
+ * once for the whole batch.  Each entry runs in its own nested transaction, so
+ * an entry that fails leaves the rest of the batch intact; the outcome of each
+ * entry is written to the matching element of the statuses array.
+ *
+ * \param ctx           The child context for this operation.
+ * \param entries       The array of entries to apply.
+ * \param count         The number of entries in the array.
+ * \param statuses      The array, of count elements, which receives the status
+ *                      of each entry.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_DATASERVICE_NOT_AUTHORIZED if this child context is not
+ *        authorized to apply one of the actions in this batch.
+ *      - AGENTD_ERROR_DATASERVICE_REQUEST_PACKET_BAD if an entry holds an
+ *        unknown action.
+ *      - AGENTD_ERROR_DATASERVICE_MDB_TXN_BEGIN_FAILURE if this function could
+ *        not create a transaction.
+ *      - AGENTD_ERROR_DATASERVICE_MDB_TXN_COMMIT_FAILURE if this function could
+ *        not commit the batch.
+ */
+int dataservice_transaction_batch_update(
+    dataservice_child_context_t* child,
+    const data_transaction_batch_update_entry_t* entries, size_t count,
+    uint32_t* statuses);
+
 /**
  * \brief Make a block in the data service.
  *
@@ -424,10 +470,6 @@ int dataservice_transaction_promote(
  *        encountered during this operation.
  *      - AGENTD_ERROR_DATASERVICE_NOT_AUTHORIZED if this child context is not
  *        authorized to call this function.
- *      - AGENTD_ERROR_DATASERVICE_VCCRYPT_SUITE_OPTIONS_INIT_FAILURE if this
- *        function failed to initialize crypto suite options.
- *      - AGENTD_ERROR_DATASERVICE_VCCERT_PARSER_OPTIONS_INIT_FAILURE if this
- *        function failed to initialize parser options.
  *      - AGENTD_ERROR_DATASERVICE_VCCERT_PARSER_INIT_FAILURE if this
  *        function failed to initialize a parser.
  *      - AGENTD_ERROR_DATASERVICE_MDB_TXN_BEGIN_FAILURE if this function failed
@@ -509,6 +551,95 @@ int dataservice_block_get(
     data_block_node_t* node,
     uint8_t** block_bytes, size_t* block_size);
 
+/**
+ * \brief Get the next block ID for a given block ID.
+ *
+ * Only the fixed-size block node is read; the block certificate is neither
+ * validated nor copied.
+ *
+ * \param child         The child context for this operation.
+ * \param dtxn_ctx      The dataservice transaction context for this operation,
+ *                      or NULL.
+ * \param block_id      The block ID to query.
+ * \param next_id       Pointer to the block UUID (16 bytes) to set.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_DATASERVICE_NOT_FOUND if the block was not found or if
+ *        it is the latest block.
+ *      - AGENTD_ERROR_DATASERVICE_NOT_AUTHORIZED if this child context is not
+ *        authorized to call this function.
+ *      - AGENTD_ERROR_DATASERVICE_MDB_TXN_BEGIN_FAILURE if this function failed
+ *        to begin a transaction.
+ *      - AGENTD_ERROR_DATASERVICE_MDB_GET_FAILURE if this function failed to
+ *        read data from the database.
+ *      - AGENTD_ERROR_DATASERVICE_INVALID_STORED_BLOCK_NODE if the block node
+ *        read from the database could not be deserialized.
+ */
+int dataservice_block_id_next_get(
+    dataservice_child_context_t* child,
+    dataservice_transaction_context_t* dtxn_ctx, const uint8_t* block_id,
+    uint8_t* next_id);
+
+/**
+ * \brief Get the previous block ID for a given block ID.
+ *
+ * Only the fixed-size block node is read; the block certificate is neither
+ * validated nor copied.
+ *
+ * \param child         The child context for this operation.
+ * \param dtxn_ctx      The dataservice transaction context for this operation,
+ *                      or NULL.
+ * \param block_id      The block ID to query.
+ * \param prev_id       Pointer to the block UUID (16 bytes) to set.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_DATASERVICE_NOT_FOUND if the block was not found or if
+ *        it is the first block.
+ *      - AGENTD_ERROR_DATASERVICE_NOT_AUTHORIZED if this child context is not
+ *        authorized to call this function.
+ *      - AGENTD_ERROR_DATASERVICE_MDB_TXN_BEGIN_FAILURE if this function failed
+ *        to begin a transaction.
+ *      - AGENTD_ERROR_DATASERVICE_MDB_GET_FAILURE if this function failed to
+ *        read data from the database.
+ *      - AGENTD_ERROR_DATASERVICE_INVALID_STORED_BLOCK_NODE if the block node
+ *        read from the database could not be deserialized.
+ */
+int dataservice_block_id_prev_get(
+    dataservice_child_context_t* child,
+    dataservice_transaction_context_t* dtxn_ctx, const uint8_t* block_id,
+    uint8_t* prev_id);
+
+/**
+ * \brief Get the block ID of a canonized transaction.
+ *
+ * Only the fixed-size transaction node is read; the transaction certificate is
+ * neither validated nor copied.
+ *
+ * \param child         The child context for this operation.
+ * \param dtxn_ctx      The dataservice transaction context for this operation,
+ *                      or NULL.
+ * \param txn_id        The transaction ID to query.
+ * \param block_id      Pointer to the block UUID (16 bytes) to set.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_DATASERVICE_NOT_FOUND if the transaction was not found.
+ *      - AGENTD_ERROR_DATASERVICE_NOT_AUTHORIZED if this child context is not
+ *        authorized to call this function.
+ *      - AGENTD_ERROR_DATASERVICE_MDB_TXN_BEGIN_FAILURE if this function failed
+ *        to begin a transaction.
+ *      - AGENTD_ERROR_DATASERVICE_MDB_GET_FAILURE if this function failed to
+ *        read data from the database.
+ *      - AGENTD_ERROR_DATASERVICE_INVALID_STORED_TRANSACTION_NODE if the
+ *        transaction node read from the database could not be deserialized.
+ */
+int dataservice_block_id_with_transaction_get(
+    dataservice_child_context_t* child,
+    dataservice_transaction_context_t* dtxn_ctx, const uint8_t* txn_id,
+    uint8_t* block_id);
+
 /**
  * \brief Get the block ID associated with the given block height.
  *
@@ -628,6 +759,69 @@ int dataservice_artifact_get(
     dataservice_transaction_context_t* dtxn_ctx, const uint8_t* artifact_id,
     data_artifact_record_t* record);
 
+/**
+ * \brief Check whether an id is in use as a block, transaction, or artifact id.
+ *
+ * Most new ids are rejected by the id filter without reading the database.
+ *
+ * \param child         The child context for this operation.
+ * \param dtxn_ctx      The dataservice transaction context for this operation,
+ *                      or NULL.
+ * \param id            The 16 byte id to check.
+ *
+ * \returns A status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS if the id is in use.
+ *      - AGENTD_ERROR_DATASERVICE_NOT_FOUND if the id is not in use.
+ *      - AGENTD_ERROR_DATASERVICE_NOT_AUTHORIZED if this child context is not
+ *        authorized for this operation.
+ *      - AGENTD_ERROR_DATASERVICE_MDB_TXN_BEGIN_FAILURE if this operation
+ *        failed to begin a transaction.
+ *      - AGENTD_ERROR_DATASERVICE_MDB_GET_FAILURE if there was a failure
+ *        reading from the database.
+ */
+int dataservice_id_exists(
+    dataservice_child_context_t* child,
+    dataservice_transaction_context_t* dtxn_ctx, const uint8_t* id);
+
+/**
+ * \brief Get a page of an artifact's transaction history from the data
+ * service.
+ *
+ * Transactions are returned in the order in which they were canonized,
+ * starting with the first transaction at or after the given block height and
+ * index.
+ *
+ * \param child         The child context for this operation.
+ * \param dtxn_ctx      The dataservice transaction context for this operation,
+ *                      or NULL.
+ * \param artifact_id   The artifact ID for this operation.
+ * \param start_height  The block height at which this page starts.
+ * \param start_index   The index within the start height at which this page
+ *                      starts.
+ * \param entries       The array of entries to populate.
+ * \param count         On input, the number of entries in the array.  On
+ *                      output, the number of entries populated.
+ * \param more          Set to true if the history continues past this page.
+ *
+ * \returns A status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_DATASERVICE_NOT_FOUND if no transactions were found for
+ *        this artifact at or after the start position.
+ *      - AGENTD_ERROR_DATASERVICE_NOT_AUTHORIZED if this child context is not
+ *        authorized for this operation.
+ *      - AGENTD_ERROR_DATASERVICE_MDB_TXN_BEGIN_FAILURE if this operation
+ *        failed to begin a transaction.
+ *      - AGENTD_ERROR_DATASERVICE_MDB_GET_FAILURE if there was a failure
+ *        getting this value.
+ *      - AGENTD_ERROR_DATASERVICE_INVALID_INDEX_ENTRY if an invalid index entry
+ *        was encountered.
+ */
+int dataservice_artifact_transaction_list_get(
+    dataservice_child_context_t* child,
+    dataservice_transaction_context_t* dtxn_ctx, const uint8_t* artifact_id,
+    uint64_t start_height, uint32_t start_index,
+    data_artifact_transaction_entry_t* entries, size_t* count, bool* more);
+
 /**
  * \brief Query the canonized transaction database for a given transaction by
  *        UUID.
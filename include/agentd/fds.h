@@ -71,16 +71,20 @@ extern "C" {
 #define AGENTD_FD_LISTENSERVICE_LOG ((int)0)
 
 /**
- * \brief File descriptor for the listen service accept socket.
+ * \brief File descriptor for the first of one or more listen service accept
+ * sockets, one for each protocol service instance.
  * Used by the listen service private command.
  */
 #define AGENTD_FD_LISTENSERVICE_ACCEPT ((int)1)
 
 /**
- * \brief File descriptor for the first listen socket for the listen service.
+ * \brief File descriptor for the first listen socket for the listen service,
+ * given the number of accept sockets.  A single closed descriptor separates the
+ * accept sockets from the listen sockets so that each range can be counted.
  * Used by the listen service private command.
  */
-#define AGENTD_FD_LISTENSERVICE_SOCK_START ((int)2)
+#define AGENTD_FD_LISTENSERVICE_SOCK_START(acceptcount) \
+    (AGENTD_FD_LISTENSERVICE_ACCEPT + (int)(acceptcount) + 1)
 
 /******************************************************************************/
 /* Supervisor Service                                                         */
@@ -149,6 +153,18 @@ extern "C" {
  */
 #define AGENTD_FD_UNAUTHORIZED_PROTOSVC_NOTIFY ((int)5)
 
+/**
+ * \brief File descriptor for the attestation service wakeup socket. Used by the
+ * protocol service private command.
+ */
+#define AGENTD_FD_UNAUTHORIZED_PROTOSVC_ATTESTATION_WAKEUP ((int)6)
+
+/**
+ * \brief The first of zero or more read-only data service sockets. Used by the
+ * protocol service private command.
+ */
+#define AGENTD_FD_UNAUTHORIZED_PROTOSVC_DATA_READER_START ((int)7)
+
 /******************************************************************************/
 /* Random Service                                                             */
 /******************************************************************************/
@@ -228,6 +244,13 @@ extern "C" {
  */
 #define AGENTD_FD_ATTESTATION_SVC_CONTROL ((int)2)
 
+/**
+ * \brief File descriptor for the attestation service wakeup socket. Protocol
+ * services write a datagram to this socket after each transaction submit.
+ * Used by the attestation service private command.
+ */
+#define AGENTD_FD_ATTESTATION_SVC_WAKEUP ((int)3)
+
 /******************************************************************************/
 /* Notification Service                                                       */
 /******************************************************************************/
@@ -245,8 +268,8 @@ extern "C" {
 #define AGENTD_FD_NOTIFICATION_SVC_CLIENT1 ((int)1)
 
 /**
- * \brief File descriptor for the second notification service client socket.
- * Used by the protocol service.
+ * \brief File descriptor for the first of one or more notification service
+ * client sockets used by the protocol service instances.
  */
 #define AGENTD_FD_NOTIFICATION_SVC_CLIENT2 ((int)2)
 
@@ -9,6 +9,7 @@
 #ifndef AGENTD_IPC_HEADER_GUARD
 #define AGENTD_IPC_HEADER_GUARD
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 #include <sys/socket.h>
@@ -90,6 +91,16 @@ typedef void (*ipc_socket_event_cb_t)(
 typedef void (*ipc_timer_event_cb_t)(
     ipc_timer_context_t* timer, void* user_context);
 
+/**
+ * \brief Callback method to release data written to a socket by reference.
+ *
+ * \param data          The referenced data.
+ * \param size          The size of the referenced data.
+ * \param user_context  The user context associated with this reference.
+ */
+typedef void (*ipc_reference_release_cb_t)(
+    const void* data, size_t size, void* user_context);
+
 /**
  * \brief Socket context used for asynchronous (non-blocking) I/O.  Contains an
  * opaque reference to the underlying async I/O implementation.
@@ -740,6 +751,103 @@ int ipc_receivesocket_noblock(ipc_socket_context_t* ctx, int* recvsock);
 int ipc_write_data_noblock(
     ipc_socket_context_t* sock, const void* val, uint32_t size);
 
+/**
+ * \brief Write a raw data packet to a non-blocking socket, appending the tail
+ * of this packet to the write buffer by reference instead of by copy.
+ *
+ * The packet written is identical to one written by \ref
+ * ipc_write_data_noblock() with the concatenation of hdr and ref as its value.
+ * The hdr bytes are copied into the write buffer.  The ref bytes are not
+ * copied; they must remain valid until the release callback is called.
+ *
+ * The release callback is always called exactly once: either by the write
+ * buffer when the referenced bytes have been written or the socket has been
+ * disposed, or by this function before it returns if it fails.
+ *
+ * \param sock          The socket to which the value is written.
+ * \param hdr           The leading data to copy into the packet.
+ * \param hdr_size      The size of the leading data.
+ * \param ref           The trailing data to reference in the packet.
+ * \param ref_size      The size of the trailing data.
+ * \param release       The callback to release the trailing data.
+ * \param user_context  The user context passed to the release callback.
+ *
+ * \returns A status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_IPC_WRITE_BUFFER_TYPE_ADD_FAILURE if adding the type
+ *        data to the write buffer failed.
+ *      - AGENTD_ERROR_IPC_WRITE_BUFFER_SIZE_ADD_FAILURE if adding the size
+ *        data to the write buffer failed.
+ *      - AGENTD_ERROR_IPC_WRITE_BUFFER_PAYLOAD_ADD_FAILURE if adding the
+ *        payload data to the write buffer failed.
+ *      - AGENTD_ERROR_IPC_WRITE_NONBLOCK_FAILURE if a non-blocking write
+ *        failed.
+ */
+int ipc_write_data_by_reference_noblock(
+    ipc_socket_context_t* sock, const void* hdr, uint32_t hdr_size,
+    const void* ref, uint32_t ref_size, ipc_reference_release_cb_t release,
+    void* user_context);
+
+/**
+ * \brief Queue a raw data packet on a non-blocking socket.
+ *
+ * The packet queued is identical to one written by \ref
+ * ipc_write_data_noblock(), but no write is attempted.  The caller is
+ * responsible for flushing the write buffer, typically from its write
+ * callback.  This allows several packets to be flushed in a single vectored
+ * write.
+ *
+ * \param sock          The socket on which the value is queued.
+ * \param val           The raw data to queue.
+ * \param size          The size of the raw data to queue.
+ *
+ * \returns A status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_IPC_WRITE_BUFFER_TYPE_ADD_FAILURE if adding the type
+ *        data to the write buffer failed.
+ *      - AGENTD_ERROR_IPC_WRITE_BUFFER_SIZE_ADD_FAILURE if adding the size
+ *        data to the write buffer failed.
+ *      - AGENTD_ERROR_IPC_WRITE_BUFFER_PAYLOAD_ADD_FAILURE if adding the
+ *        payload data to the write buffer failed.
+ */
+int ipc_queue_data_noblock(
+    ipc_socket_context_t* sock, const void* val, uint32_t size);
+
+/**
+ * \brief Queue a raw data packet on a non-blocking socket, appending the tail
+ * of this packet to the write buffer by reference instead of by copy.
+ *
+ * The packet queued is identical to one written by \ref
+ * ipc_write_data_by_reference_noblock(), but no write is attempted.  The
+ * caller is responsible for flushing the write buffer, typically from its
+ * write callback.
+ *
+ * The release callback is always called exactly once: either by the write
+ * buffer when the referenced bytes have been written or the socket has been
+ * disposed, or by this function before it returns if it fails.
+ *
+ * \param sock          The socket on which the value is queued.
+ * \param hdr           The leading data to copy into the packet.
+ * \param hdr_size      The size of the leading data.
+ * \param ref           The trailing data to reference in the packet.
+ * \param ref_size      The size of the trailing data.
+ * \param release       The callback to release the trailing data.
+ * \param user_context  The user context passed to the release callback.
+ *
+ * \returns A status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_IPC_WRITE_BUFFER_TYPE_ADD_FAILURE if adding the type
+ *        data to the write buffer failed.
+ *      - AGENTD_ERROR_IPC_WRITE_BUFFER_SIZE_ADD_FAILURE if adding the size
+ *        data to the write buffer failed.
+ *      - AGENTD_ERROR_IPC_WRITE_BUFFER_PAYLOAD_ADD_FAILURE if adding the
+ *        payload data to the write buffer failed.
+ */
+int ipc_queue_data_by_reference_noblock(
+    ipc_socket_context_t* sock, const void* hdr, uint32_t hdr_size,
+    const void* ref, uint32_t ref_size, ipc_reference_release_cb_t release,
+    void* user_context);
+
 /**
  * \brief Write an authenticated data packet to a non-blocking socket.
  *
@@ -897,6 +1005,61 @@ int ipc_write_int8_noblock(ipc_socket_context_t* sock, int8_t val);
 int ipc_read_data_noblock(
     ipc_socket_context_t* sock, void** val, uint32_t* size);
 
+/**
+ * \brief Read a raw data packet from a non-blocking socket as a view into the
+ * socket's read buffer.
+ *
+ * On success, val points to the packet payload inside of the socket's read
+ * buffer.  No copy is made, and the caller does not own this memory.  The view
+ * remains valid until ipc_read_data_view_release() is called, or until the
+ * next read from this socket, which releases any outstanding view.
+ *
+ * \param sock          The socket from which the value is read.
+ * \param val           Pointer to the pointer to receive the payload view.
+ * \param size          Pointer to the variable to receive the size of this
+ *                      packet.
+ *
+ * \returns A status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_IPC_WOULD_BLOCK if the the operation was halted because
+ *        it would block this thread.
+ *      - AGENTD_ERROR_IPC_READ_UNEXPECTED_DATA_TYPE if an unexpected data type
+ *        was encountered when attempting to read this value.
+ *      - AGENTD_ERROR_IPC_READ_UNEXPECTED_DATA_SIZE if an unexpected data size
+ *        was encountered when attempting to read this value.
+ *      - AGENTD_ERROR_IPC_READ_BUFFER_DRAIN_FAILURE if draining a previous
+ *        view from the read buffer failed.
+ */
+int ipc_read_data_view_noblock(
+    ipc_socket_context_t* sock, void** val, uint32_t* size);
+
+/**
+ * \brief Release the packet view returned by ipc_read_data_view_noblock().
+ *
+ * The packet is drained from the socket's read buffer.  If secure zeroing is
+ * enabled for this socket, the packet is cleared before it is drained.  It is
+ * safe to call this method when no view is outstanding.
+ *
+ * \param sock          The socket owning the view.
+ *
+ * \returns A status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_IPC_READ_BUFFER_DRAIN_FAILURE if draining the read buffer
+ *        failed.
+ */
+int ipc_read_data_view_release(ipc_socket_context_t* sock);
+
+/**
+ * \brief Enable or disable secure zeroing of released packet views.
+ *
+ * Secure zeroing is disabled by default.  Sockets carrying key material should
+ * enable it.
+ *
+ * \param sock          The non-blocking socket to configure.
+ * \param secure_zero   true if released views should be cleared.
+ */
+void ipc_socket_set_secure_zero(ipc_socket_context_t* sock, bool secure_zero);
+
 /**
  * \brief Read an authenticated data packet from a non-blocking socket.
  *
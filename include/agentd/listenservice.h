@@ -49,7 +49,10 @@ enum listenservice_api_method_enum
  *
  * \param logsock       The logging service socket.  The listen service logs
  *                      on this socket.
- * \param acceptsock    The socket to which newly accepted sockets are sent.
+ * \param acceptstart   The first socket to which newly accepted sockets are
+ *                      sent.  The listen service iterates from this socket
+ *                      until it encounters a closed descriptor and sends each
+ *                      accepted socket to the next of these sockets in turn.
  * \param listenstart   The first socket to which this service will listen.  The
  *                      listen service will iterate from this socket until it
  *                      encounters a closed descriptor and use each as a listen
@@ -66,7 +69,7 @@ enum listenservice_api_method_enum
  *          - AGENTD_ERROR_LISTENSERVICE_IPC_EVENT_LOOP_RUN_FAILURE if running
  *            the listen service event loop failed.
  */
-int listenservice_event_loop(int logsock, int acceptsock, int listenstart);
+int listenservice_event_loop(int logsock, int acceptstart, int listenstart);
 
 /**
  * \brief Spawn an unauthorized listen service process using the provided
@@ -80,7 +83,9 @@ int listenservice_event_loop(int logsock, int acceptsock, int listenstart);
  *
  * \param bconf         The bootstrap configuration for this service.
  * \param conf          The configuration for this service.
- * \param acceptsock    Pointer to the socket used to pass accepted sockets.
+ * \param acceptsocks   Array of sockets used to pass accepted sockets, one for
+ *                      each protocol service instance.
+ * \param acceptcount   The number of sockets in acceptsocks.
  * \param logsock       Pointer to the socket used to communicate with the
  *                      logger.
  * \param listenpid     Pointer to the listen service pid, to be updated on
@@ -110,7 +115,8 @@ int listenservice_event_loop(int logsock, int acceptsock, int listenstart);
  */
 int listenservice_proc(
     const bootstrap_config_t* bconf, const agent_config_t* conf,
-    int* acceptsock, int* logsock, pid_t* listenpid, bool runsecure);
+    int* acceptsocks, size_t acceptcount, int* logsock, pid_t* listenpid,
+    bool runsecure);
 
 /* make this header C++ friendly. */
 #ifdef __cplusplus
@@ -27,14 +27,17 @@ extern "C" {
  *
  * \param logsock       The socket to the logging service service.
  * \param consensussock Socket connection to the consensus service.
- * \param protocolsock  Socket connection to the protocol service.
+ * \param protocolstart The first socket connection to a protocol service
+ *                      instance.  The notification service iterates from this
+ *                      socket until it encounters a closed descriptor and
+ *                      serves each of these sockets.
  *
  * \returns a status code on service exit indicating a normal or abnormal exit.
  *          - AGENTD_STATUS_SUCCESS on normal exit.
  *          - a non-zero error code on failure.
  */
 status notificationservice_run(
-    int logsock, int consensussock, int protocolsock);
+    int logsock, int consensussock, int protocolstart);
 
 /**
  * \brief Spawn a notification service process using the provided config
@@ -51,7 +54,9 @@ status notificationservice_run(
  * \param randomsock    Socket used to communicate with the random service.
  * \param logsock       Socket used to communicate with the logger.
  * \param consensussock Socket connection to the consensus service.
- * \param protocolsock  Socket connection to the protocol service.
+ * \param protocolsocks Array of socket connections to the protocol service
+ *                      instances.
+ * \param protocolcount The number of sockets in protocolsocks.
  * \param pid           Pointer to the notification service pid, to be updated
  *                      on the successful completion of this function.
  * \param runsecure     Set to false if we are not being run in secure mode.
@@ -62,7 +67,8 @@ status notificationservice_run(
  */
 int notificationservice_proc(
     const bootstrap_config_t* bconf, const agent_config_t* conf, int logsock,
-    int consensussock, int protocolsock, pid_t* pid, bool runsecure);
+    int consensussock, const int* protocolsocks, size_t protocolcount,
+    pid_t* pid, bool runsecure);
 
 /* make this header C++ friendly. */
 #ifdef __cplusplus
@@ -58,6 +58,13 @@ enum protocolservice_api_method_enum
  * \param logsock       The logging service socket.  The protocol service logs
  *                      on this socket.
  * \param notifysock    The notification service socket.
+ * \param wakeupsock    The attestation service wakeup socket.  The protocol
+ *                      service signals this socket after a transaction is
+ *                      submitted.
+ * \param datareaderstart   The first read-only data service socket. The
+ *                      protocol service iterates from this socket until it
+ *                      encounters a closed descriptor and routes read requests
+ *                      across each of these sockets.
  *
  * \returns a status code on service exit indicating a normal or abnormal exit.
  *          - AGENTD_STATUS_SUCCESS on normal exit.
@@ -72,7 +79,7 @@ enum protocolservice_api_method_enum
  */
 int protocolservice_run(
     int randomsock, int protosock, int controlsock, int datasock, int logsock,
-    int notifysock);
+    int notifysock, int wakeupsock, int datareaderstart);
 
 /**
  * \brief Spawn an unauthorized protocol service process using the provided
@@ -93,6 +100,10 @@ int protocolservice_run(
  * \param datasock      Socket used to communicate with the data service.
  * \param notifysock    Socket used to communicate with the notification
  *                      service.
+ * \param wakeupsock    Socket used to wake the attestation service.
+ * \param datareadersocks   Array of sockets used to communicate with the
+ *                      read-only data service pool.
+ * \param datareadercount   The number of sockets in datareadersocks.
  * \param protopid      Pointer to the protocol service pid, to be updated on
  *                      the successful completion of this function.
  * \param runsecure     Set to false if we are not being run in secure mode.
@@ -123,6 +134,7 @@ int protocolservice_run(
 int protocolservice_proc(
     const bootstrap_config_t* bconf, const agent_config_t* conf, int randomsock,
     int logsock, int acceptsock, int controlsock, int datasock, int notifysock,
+    int wakeupsock, const int* datareadersocks, size_t datareadercount,
     pid_t* protopid, bool runsecure);
 
 /* make this header C++ friendly. */
@@ -11,6 +11,7 @@
 
 #include <agentd/dataservice/data.h>
 #include <agentd/protocolservice.h>
+#include <stdbool.h>
 #include <vccrypt/suite.h>
 
 /* make this header C++ friendly. */
@@ -31,6 +32,7 @@ typedef enum unauthorized_protocol_request_id
     UNAUTH_PROTOCOL_REQ_ID_BLOCK_ID_GET_NEXT = 0x00000005,
     UNAUTH_PROTOCOL_REQ_ID_BLOCK_ID_GET_PREV = 0x00000006,
     UNAUTH_PROTOCOL_REQ_ID_BLOCK_ID_BY_HEIGHT_GET = 0x00000007,
+    UNAUTH_PROTOCOL_REQ_ID_BLOCK_RANGE_GET = 0x00000008,
 
     UNAUTH_PROTOCOL_REQ_ID_TRANSACTION_BY_ID_GET = 0x00000010,
     UNAUTH_PROTOCOL_REQ_ID_TRANSACTION_ID_GET_NEXT = 0x00000011,
@@ -39,6 +41,7 @@ typedef enum unauthorized_protocol_request_id
 
     UNAUTH_PROTOCOL_REQ_ID_ARTIFACT_FIRST_TXN_BY_ID_GET = 0x00000020,
     UNAUTH_PROTOCOL_REQ_ID_ARTIFACT_LAST_TXN_BY_ID_GET = 0x00000021,
+    UNAUTH_PROTOCOL_REQ_ID_ARTIFACT_TXN_LIST_GET = 0x00000022,
 
     UNAUTH_PROTOCOL_REQ_ID_ASSERT_LATEST_BLOCK_ID = 0x00000030,
     UNAUTH_PROTOCOL_REQ_ID_ASSERT_LATEST_BLOCK_ID_CANCEL = 0x00000031,
@@ -535,6 +538,171 @@ int protocolservice_api_recvresp_block_get(
     data_block_node_t* block_node, uint8_t** block_cert,
     size_t* block_cert_size);
 
+/**
+ * \brief Send a block range get request.
+ *
+ * \param sock                      The socket to which this request is written.
+ * \param suite                     The crypto suite to use for this handshake.
+ * \param client_iv                 Pointer to the client IV, updated by this
+ *                                  call.
+ * \param shared_secret             The shared secret key for this request.
+ * \param start_height              The height of the first block to return.
+ * \param max_count                 The maximum number of blocks to return.
+ * \param max_bytes                 The certificate byte budget for this
+ *                                  stream, or zero for no limit.
+ *
+ * This function sends a block range get request as an authorized packet to the
+ * server.  The server responds with one packet per block, which can be read
+ * with \ref protocolservice_api_recvresp_block_range_get().
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_IPC_WRITE_BLOCK_FAILURE if a blocking write on the socket
+ *        failed.
+ *      - AGENTD_ERROR_GENERAL_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+int protocolservice_api_sendreq_block_range_get(
+    int sock, vccrypt_suite_options_t* suite, uint64_t* client_iv,
+    const vccrypt_buffer_t* shared_secret, uint64_t start_height,
+    uint32_t max_count, uint32_t max_bytes);
+
+/**
+ * \brief Receive a single block from a block range get stream.
+ *
+ * \param sock                      The socket from which this response is read.
+ * \param suite                     The crypto suite to use to verify this
+ *                                  response.
+ * \param server_iv                 Pointer to the server IV, updated by this
+ *                                  call.
+ * \param shared_secret             The shared secret key for this response.
+ * \param offset                    The offset for this response.
+ * \param status                    The status for this response.
+ * \param more                      Set to true if more blocks follow in this
+ *                                  stream.
+ * \param block_node                The block node data for this block.
+ * \param block_cert                Pointer to be populated with a block
+ *                                  certificate on success.  This certificate is
+ *                                  dynamically allocated and must be freed by
+ *                                  the caller.
+ * \param block_cert_size           The size of the block certificate returned.
+ *
+ * This function should be called repeatedly after a successful call to
+ * \ref protocolservice_api_sendreq_block_range_get() until either more is set
+ * to false or the status is updated with an error.  An error ends the stream.
+ *
+ * If the stream reaches a gap in the chain after a block was sent with more
+ * set, it ends with a packet that carries no block.  In this case, the status
+ * is successful, more is set to false, block_cert is set to NULL, and
+ * block_cert_size is set to zero.
+ *
+ * If the status code is updated with an error from the service, then this error
+ * will be reflected in the status variable, and a AGENTD_STATUS_SUCCESS will be
+ * returned by this function.  Thus, both the return value of this function and
+ * the upstream status code must be checked for correct operation.
+ *
+ * Possible upstream status codes:
+ *      - AGENTD_ERROR_DATASERVICE_NOT_FOUND if the first block could not be
+ *        found.
+ *      - AGENTD_ERROR_PROTOCOLSERVICE_BLOCK_RANGE_ALREADY_ACTIVE if another
+ *        block range stream is already active on this connection.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_IPC_READ_BLOCK_FAILURE if a blocking read on the socket
+ *        failed.
+ *      - AGENTD_ERROR_IPC_READ_UNEXPECTED_DATA_TYPE if the data type read from
+ *        the socket was unexpected.
+ *      - AGENTD_ERROR_GENERAL_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ */
+int protocolservice_api_recvresp_block_range_get(
+    int sock, vccrypt_suite_options_t* suite, uint64_t* server_iv,
+    const vccrypt_buffer_t* shared_secret, uint32_t* offset, uint32_t* status,
+    bool* more, data_block_node_t* block_node, uint8_t** block_cert,
+    size_t* block_cert_size);
+
+/**
+ * \brief Send an artifact transaction list get request.
+ *
+ * \param sock                      The socket to which this request is written.
+ * \param suite                     The crypto suite to use for this handshake.
+ * \param client_iv                 Pointer to the client IV, updated by this
+ *                                  call.
+ * \param shared_secret             The shared secret key for this request.
+ * \param artifact_id               The artifact UUID to query.
+ * \param start_height              The block height at which the page starts.
+ * \param start_index               The index within the start height at which
+ *                                  the page starts.
+ * \param max_count                 The maximum number of transactions to
+ *                                  return.
+ *
+ * This function sends an artifact transaction list get request as an
+ * authorized packet to the server.  To read the next page, send another request
+ * starting just after the height and index of the last entry returned.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_IPC_WRITE_BLOCK_FAILURE if a blocking write on the socket
+ *        failed.
+ *      - AGENTD_ERROR_GENERAL_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+int protocolservice_api_sendreq_artifact_transaction_list_get(
+    int sock, vccrypt_suite_options_t* suite, uint64_t* client_iv,
+    const vccrypt_buffer_t* shared_secret, const uint8_t* artifact_id,
+    uint64_t start_height, uint32_t start_index, uint32_t max_count);
+
+/**
+ * \brief Receive an artifact transaction list get response.
+ *
+ * \param sock                      The socket from which this response is read.
+ * \param suite                     The crypto suite to use to verify this
+ *                                  response.
+ * \param server_iv                 Pointer to the server IV, updated by this
+ *                                  call.
+ * \param shared_secret             The shared secret key for this response.
+ * \param offset                    The offset for this response.
+ * \param status                    The status for this response.
+ * \param more                      Set to true if the artifact's history
+ *                                  continues past this page.
+ * \param entries                   Pointer to be populated with the entries in
+ *                                  this page on success.  This array is
+ *                                  dynamically allocated and must be freed by
+ *                                  the caller.
+ * \param count                     The number of entries returned.
+ *
+ * On a successful return from this function, the status is updated with the
+ * status code from the API request.  This status should be checked.  A zero
+ * status indicates the request to the remote peer was successful, and a
+ * non-zero status indicates that the request to the remote peer failed.  The
+ * entries are only populated on success.
+ *
+ * If the status code is updated with an error from the service, then this error
+ * will be reflected in the status variable, and a AGENTD_STATUS_SUCCESS will be
+ * returned by this function.  Thus, both the return value of this function and
+ * the upstream status code must be checked for correct operation.
+ *
+ * Possible upstream status codes:
+ *      - AGENTD_ERROR_DATASERVICE_NOT_FOUND if no transactions were found for
+ *        this artifact at or after the start position.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_IPC_READ_BLOCK_FAILURE if a blocking read on the socket
+ *        failed.
+ *      - AGENTD_ERROR_IPC_READ_UNEXPECTED_DATA_TYPE if the data type read from
+ *        the socket was unexpected.
+ *      - AGENTD_ERROR_GENERAL_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ */
+int protocolservice_api_recvresp_artifact_transaction_list_get(
+    int sock, vccrypt_suite_options_t* suite, uint64_t* server_iv,
+    const vccrypt_buffer_t* shared_secret, uint32_t* offset, uint32_t* status,
+    bool* more, data_artifact_transaction_entry_t** entries, size_t* count);
+
 /**
  * \brief Send a block get next id request.
  *
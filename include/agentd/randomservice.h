@@ -35,6 +35,11 @@ enum randomservice_api_method_enum
      */
     RANDOMSERVICE_API_METHOD_GET_RANDOM_BYTES,
 
+    /**
+     * \brief Get a large block of random bytes in a single response.
+     */
+    RANDOMSERVICE_API_METHOD_GET_RANDOM_BYTES_BULK,
+
     /**
      * \brief The number of methods in this API.
      *
@@ -43,6 +48,12 @@ enum randomservice_api_method_enum
     RANDOMSERVICE_API_METHOD_UPPER_BOUND
 };
 
+/**
+ * \brief The maximum number of bytes that a bulk random bytes request can
+ * return in a single response.
+ */
+#define RANDOMSERVICE_GET_RANDOM_BYTES_BULK_MAXIMUM_SIZE (256U * 1024U)
+
 /**
  * \brief Event loop for the random service.  This is the entry point for the
  * random service.  It handles the details of reacting to events
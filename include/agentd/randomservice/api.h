@@ -57,6 +57,52 @@ int random_service_api_recvresp_random_bytes_get(
     RCPR_SYM(psock)* sock, RCPR_SYM(allocator)* alloc, uint32_t* offset,
     uint32_t* status, void** bytes, size_t* bytes_size);
 
+/**
+ * \brief Request a large block of random bytes from the random service.
+ *
+ * Up to \ref RANDOMSERVICE_GET_RANDOM_BYTES_BULK_MAXIMUM_SIZE bytes are
+ * returned in a single response.
+ *
+ * \param sock          The socket on which this request is made.
+ * \param offset        The offset for the request; will be returned in the
+ *                      response.
+ * \param count         The number of bytes requested.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_RANDOMSERVICE_IPC_WRITE_DATA_FAILURE if an error occurred
+ *        when writing to the socket.
+ */
+int random_service_api_sendreq_random_bytes_get_bulk(
+    RCPR_SYM(psock)* sock, uint32_t offset, uint32_t count);
+
+/**
+ * \brief Receive the response from the bulk random bytes call from the random
+ * service.
+ *
+ * The random bytes are returned in the allocation holding the response packet,
+ * so a large response is not allocated twice.  The caller reclaims the
+ * returned buffer with the same allocator.
+ *
+ * \param sock          The socket on which this request is made.
+ * \param alloc         The allocator to use for this operation.
+ * \param offset        The offset of the response.
+ * \param status        The status of the response.
+ * \param bytes         Pointer to receive an allocated buffer of random bytes
+ *                      on success.
+ * \param bytes_size    The number of bytes received in this buffer on success.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_GENERAL_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory condition.
+ *      - AGENTD_ERROR_RANDOMSERVICE_IPC_READ_DATA_FAILURE if an error occurred
+ *        when reading from the socket.
+ */
+int random_service_api_recvresp_random_bytes_get_bulk(
+    RCPR_SYM(psock)* sock, RCPR_SYM(allocator)* alloc, uint32_t* offset,
+    uint32_t* status, void** bytes, size_t* bytes_size);
+
 /**
  * \brief Request some random bytes from the random service. (Deprecated)
  *
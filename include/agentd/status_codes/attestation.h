@@ -70,6 +70,54 @@ extern "C" {
 #define AGENTD_ERROR_ATTESTATIONSERVICE_PRIVSEP_EXEC_SURVIVAL_WEIRDNESS \
     AGENTD_STATUS_ERROR_MACRO(AGENTD_SERVICE_ATTESTATION, 0x0009U)
 
+/**
+ * \brief A transaction or artifact id is already in use.
+ */
+#define AGENTD_ERROR_ATTESTATIONSERVICE_DUPLICATE_ID \
+    AGENTD_STATUS_ERROR_MACRO(AGENTD_SERVICE_ATTESTATION, 0x000AU)
+
+/**
+ * \brief A bad parameter was passed to an attestation service API method.
+ */
+#define AGENTD_ERROR_ATTESTATIONSERVICE_BAD_PARAMETER \
+    AGENTD_STATUS_ERROR_MACRO(AGENTD_SERVICE_ATTESTATION, 0x000BU)
+
+/**
+ * \brief Writing data to the attestation service control socket failed.
+ */
+#define AGENTD_ERROR_ATTESTATIONSERVICE_IPC_WRITE_DATA_FAILURE \
+    AGENTD_STATUS_ERROR_MACRO(AGENTD_SERVICE_ATTESTATION, 0x000CU)
+
+/**
+ * \brief Reading data from the attestation service control socket failed.
+ */
+#define AGENTD_ERROR_ATTESTATIONSERVICE_IPC_READ_DATA_FAILURE \
+    AGENTD_STATUS_ERROR_MACRO(AGENTD_SERVICE_ATTESTATION, 0x000DU)
+
+/**
+ * \brief The attestation service request packet has an invalid size.
+ */
+#define AGENTD_ERROR_ATTESTATIONSERVICE_REQUEST_PACKET_INVALID_SIZE \
+    AGENTD_STATUS_ERROR_MACRO(AGENTD_SERVICE_ATTESTATION, 0x000EU)
+
+/**
+ * \brief The attestation service request packet has an unexpected method.
+ */
+#define AGENTD_ERROR_ATTESTATIONSERVICE_REQUEST_PACKET_BAD_METHOD \
+    AGENTD_STATUS_ERROR_MACRO(AGENTD_SERVICE_ATTESTATION, 0x000FU)
+
+/**
+ * \brief The attestation service response packet has an invalid size.
+ */
+#define AGENTD_ERROR_ATTESTATIONSERVICE_RESPONSE_PACKET_INVALID_SIZE \
+    AGENTD_STATUS_ERROR_MACRO(AGENTD_SERVICE_ATTESTATION, 0x0010U)
+
+/**
+ * \brief The attestation service response has an unexpected method code.
+ */
+#define AGENTD_ERROR_ATTESTATIONSERVICE_RECVRESP_UNEXPECTED_METHOD_CODE \
+    AGENTD_STATUS_ERROR_MACRO(AGENTD_SERVICE_ATTESTATION, 0x0011U)
+
 /* make this header C++ friendly. */
 #ifdef __cplusplus
 }
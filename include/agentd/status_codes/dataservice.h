@@ -412,6 +412,19 @@ extern "C" {
 #define AGENTD_ERROR_DATASERVICE_INVALID_PARAMETER \
     AGENTD_STATUS_ERROR_MACRO(AGENTD_SERVICE_DATASERVICE, 0x0045U)
 
+/**
+ * \brief Setting the maximum readers for the environment failed.
+ */
+#define AGENTD_ERROR_DATASERVICE_MDB_ENV_SET_MAXREADERS_FAILURE \
+    AGENTD_STATUS_ERROR_MACRO(AGENTD_SERVICE_DATASERVICE, 0x0046U)
+
+/**
+ * \brief A submitted transaction id is already in use by a canonized
+ * transaction.
+ */
+#define AGENTD_ERROR_DATASERVICE_DUPLICATE_TRANSACTION_ID \
+    AGENTD_STATUS_ERROR_MACRO(AGENTD_SERVICE_DATASERVICE, 0x0047U)
+
 /* make this header C++ friendly. */
 #ifdef __cplusplus
 }
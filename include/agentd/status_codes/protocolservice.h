@@ -202,6 +202,18 @@ extern "C" {
 #define AGENTD_ERROR_PROTOCOLSERVICE_EXTENDED_API_UNKNOWN_ENTITY \
     AGENTD_STATUS_ERROR_MACRO(AGENTD_SERVICE_PROTOCOL, 0x001FU)
 
+/**
+ * \brief A dataservice response did not match any pending request.
+ */
+#define AGENTD_ERROR_PROTOCOLSERVICE_DATASERVICE_UNEXPECTED_RESPONSE \
+    AGENTD_STATUS_ERROR_MACRO(AGENTD_SERVICE_PROTOCOL, 0x0020U)
+
+/**
+ * \brief A block range stream is already active on this connection.
+ */
+#define AGENTD_ERROR_PROTOCOLSERVICE_BLOCK_RANGE_ALREADY_ACTIVE \
+    AGENTD_STATUS_ERROR_MACRO(AGENTD_SERVICE_PROTOCOL, 0x0021U)
+
 /* make this header C++ friendly. */
 #ifdef __cplusplus
 }
@@ -46,8 +46,9 @@ int supervisor_create_random_service(
  * \param conf                  Agentd configuration to be used to build the
  *                              listener service.  This configuration must be
  *                              valid for the lifetime of the service.
- * \param accept_socket         Pointer to the descriptor to receive the accept
- *                              socket.
+ * \param accept_sockets        Array of descriptors to receive the accept
+ *                              sockets, one for each protocol service instance.
+ * \param accept_count          The number of entries in accept_sockets.
  * \param log_socket            Pointer to the descriptor holding the log socket
  *                              for this instance.
  *
@@ -57,7 +58,8 @@ int supervisor_create_random_service(
  */
 int supervisor_create_listener_service(
     process_t** svc, const bootstrap_config_t* bconf,
-    const agent_config_t* conf, int* accept_socket, int* log_socket);
+    const agent_config_t* conf, int* accept_sockets, size_t accept_count,
+    int* log_socket);
 
 /**
  * \brief Create a data service instance for the authenticated protocol as a
@@ -82,6 +84,29 @@ int supervisor_create_data_service_for_auth_protocol_service(
     process_t** svc, const bootstrap_config_t* bconf,
     const agent_config_t* conf, int* data_socket, int* log_socket);
 
+/**
+ * \brief Create a read-only data service instance for the protocol service
+ * reader pool as a process that can be started.
+ *
+ * \param svc                   Pointer to the pointer to receive the process
+ *                              descriptor for the data service.
+ * \param bconf                 Agentd bootstrap config for this service.
+ * \param conf                  Agentd configuration to be used to build the
+ *                              data service.  This configuration must be
+ *                              valid for the lifetime of the service.
+ * \param data_socket           Pointer to the descriptor to receive the data
+ *                              socket.
+ * \param log_socket            Pointer to the descriptor holding the log socket
+ *                              for this instance.
+ *
+ * \returns a status indicating success or failure.
+ *          - AGENTD_STATUS_SUCCESS on success.
+ *          - a non-zero error code on failure.
+ */
+int supervisor_create_data_service_for_protocol_service_reader(
+    process_t** svc, const bootstrap_config_t* bconf,
+    const agent_config_t* conf, int* data_socket, int* log_socket);
+
 /**
  * \brief Create a data service instance for the canonization service as a
  * process that can be started.
@@ -146,6 +171,13 @@ int supervisor_create_data_service_for_attestationservice(
  * \param data_socket           The data socket descriptor.
  * \param log_socket            The log socket descriptor.
  * \param notify_socket         The notificationservice socket descriptor.
+ * \param wakeup_socket         The write side of the attestation service
+ *                              wakeup socket. This socket is shared by every
+ *                              protocol service instance and is not owned by
+ *                              this process.
+ * \param data_reader_sockets   Array of read-only data service socket
+ *                              descriptors.
+ * \param data_reader_count     The number of read-only data service sockets.
  *
  * \returns a status indicating success or failure.
  *          - AGENTD_STATUS_SUCCESS on success.
@@ -156,7 +188,8 @@ int supervisor_create_protocol_service(
     const agent_config_t* conf, config_private_key_t* private_key,
     config_public_entity_node_t* public_entities, int* random_socket,
     int* accept_socket, int* control_socket, int* data_socket, int* log_socket,
-    int* notify_socket);
+    int* notify_socket, int wakeup_socket, int* data_reader_sockets,
+    size_t data_reader_count);
 
 /**
  * \brief Create the auth service as a process that can be started.
@@ -217,6 +250,8 @@ int supervisor_create_canonizationservice(
  * \param data_socket           The data socket descriptor.
  * \param log_socket            The log socket descriptor.
  * \param control_socket        The control socket descriptor.
+ * \param wakeup_socket         The read side of the transaction submit wakeup
+ *                              socket.
  *
  * \returns a status indicating success or failure.
  *          - AGENTD_STATUS_SUCCESS on success.
@@ -225,7 +260,8 @@ int supervisor_create_canonizationservice(
 int supervisor_create_attestationservice(
     process_t** svc, const bootstrap_config_t* bconf,
     const agent_config_t* conf, config_private_key_t* private_key,
-    int* data_socket, int* log_socket, int* control_socket);
+    int* data_socket, int* log_socket, int* control_socket,
+    int* wakeup_socket);
 
 /**
  * \brief Create the notification service as a process that can be started.
@@ -239,8 +275,9 @@ int supervisor_create_attestationservice(
  * \param log_socket            The log socket descriptor.
  * \param consensus_socket      The socket pointer to receive the socket for the
  *                              consensus service.
- * \param protocol_socket       The socket pointer to receive the socket for the
- *                              protocol service.
+ * \param protocol_sockets      Array of socket descriptors to receive the
+ *                              sockets for each protocol service instance.
+ * \param protocol_count        The number of entries in protocol_sockets.
  *
  * \returns a status indicating success or failure.
  *          - AGENTD_STATUS_SUCCESS on success.
@@ -249,7 +286,7 @@ int supervisor_create_attestationservice(
 int supervisor_create_notification_service(
     process_t** svc, const bootstrap_config_t* bconf,
     const agent_config_t* conf, int* log_socket, int* consensus_socket,
-    int* protocol_socket);
+    int* protocol_sockets, size_t protocol_count);
 
 /**
  * \brief Install the signal handler for the supervisor.
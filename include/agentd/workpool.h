@@ -0,0 +1,92 @@
+/**
+ * \file agentd/workpool.h
+ *
+ * \brief Long-lived worker threads for splitting a loop across cores.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#pragma once
+
+#include <rcpr/allocator.h>
+#include <rcpr/resource.h>
+#include <rcpr/status.h>
+#include <stddef.h>
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif  //__cplusplus
+
+/**
+ * \brief A pool of worker threads that run slices of a loop.
+ */
+typedef struct workpool workpool;
+
+/**
+ * \brief Run the loop body over the items in [begin, end).
+ *
+ * Slices run concurrently, so the function must only touch state owned by
+ * the items in its slice.
+ *
+ * \param context       The caller's context, as passed to \ref workpool_run.
+ * \param begin         The index of the first item in this slice.
+ * \param end           One past the index of the last item in this slice.
+ */
+typedef void (*workpool_slice_fn)(void* context, size_t begin, size_t end);
+
+/**
+ * \brief Create a worker pool.
+ *
+ * The worker threads are started here and live until the pool is released.
+ * The caller of \ref workpool_run counts as one of the threads, so a pool
+ * created with \p threads set to 4 starts three workers. If a worker fails to
+ * start, the pool runs with the workers that did.
+ *
+ * \param pool          Pointer to the pool pointer, populated with the pool
+ *                      on success.
+ * \param alloc         The allocator to use for this operation.
+ * \param threads       The number of threads that run slices, including the
+ *                      caller of \ref workpool_run.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status workpool_create(
+    workpool** pool, RCPR_SYM(allocator)* alloc, size_t threads);
+
+/**
+ * \brief Split a loop over \p count items into slices and run them on the
+ * pool, returning when every slice has run.
+ *
+ * The first slice runs on the calling thread. Loops with fewer than
+ * \p parallel_min items, or a NULL pool, run inline as a single slice. Calls
+ * from several threads are serialized; a slice function must not call
+ * \ref workpool_run on the same pool.
+ *
+ * \param pool          The pool to use, or NULL to run inline.
+ * \param fn            The loop body.
+ * \param context       The context passed to \p fn.
+ * \param count         The number of items in the loop.
+ * \param parallel_min  Loops with fewer items than this run inline.
+ */
+void workpool_run(
+    workpool* pool, workpool_slice_fn fn, void* context, size_t count,
+    size_t parallel_min);
+
+/**
+ * \brief Given a worker pool, return the resource handle for this pool.
+ *
+ * Releasing this resource stops and joins the worker threads.
+ *
+ * \param pool          The pool for this operation.
+ *
+ * \returns the resource handle for this pool.
+ */
+RCPR_SYM(resource)* workpool_resource_handle(workpool* pool);
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif  //__cplusplus
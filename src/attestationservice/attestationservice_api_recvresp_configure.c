@@ -0,0 +1,100 @@
+/**
+ * \file attestationservice/attestationservice_api_recvresp_configure.c
+ *
+ * \brief Receive a response from the attestation service configure call.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <arpa/inet.h>
+#include <agentd/attestationservice/api.h>
+#include <agentd/status_codes.h>
+#include <cbmc/model_assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * \brief Receive a response from the attestation service configure call.
+ *
+ * \param sock          The socket on which this request is made.
+ * \param offset        The child context offset for this response.
+ * \param status        This value is updated with the status code returned from
+ *                      the request.
+ *
+ * On a successful return from this function, the status is updated with the
+ * status code from the API request.  This status should be checked.  A zero
+ * status indicates success, and a non-zero status indicates failure.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_ATTESTATIONSERVICE_IPC_READ_DATA_FAILURE if reading data
+ *        from the socket failed.
+ *      - AGENTD_ERROR_ATTESTATIONSERVICE_RESPONSE_PACKET_INVALID_SIZE if the
+ *        data packet size is unexpected.
+ *      - AGENTD_ERROR_ATTESTATIONSERVICE_RECVRESP_UNEXPECTED_METHOD_CODE if
+ *        the method code was unexpected.
+ */
+int attestationservice_api_recvresp_configure(
+    int sock, uint32_t* offset, uint32_t* status)
+{
+    int retval;
+    void* val = NULL;
+    uint32_t size = 0U;
+
+    /* parameter sanity check. */
+    MODEL_ASSERT(NULL != offset);
+    MODEL_ASSERT(NULL != status);
+
+    /* | configure method response packet.                            | */
+    /* | --------------------------------------------- | ------------ | */
+    /* | DATA                                          | SIZE         | */
+    /* | --------------------------------------------- | ------------ | */
+    /* | ATTESTATIONSERVICE_API_METHOD_CONFIGURE       | 4 bytes      | */
+    /* | offset                                        | 4 bytes      | */
+    /* | status                                        | 4 bytes      | */
+    /* | --------------------------------------------- | ------------ | */
+
+    /* read a data packet from the socket. */
+    retval = ipc_read_data_block(sock, &val, &size);
+    if (AGENTD_STATUS_SUCCESS != retval)
+    {
+        retval = AGENTD_ERROR_ATTESTATIONSERVICE_IPC_READ_DATA_FAILURE;
+        goto done;
+    }
+
+    /* work with this as a uint32_t pointer. */
+    const uint32_t* uval = (const uint32_t*)val;
+
+    /* verify the response size. */
+    if (3 * sizeof(uint32_t) != size)
+    {
+        retval = AGENTD_ERROR_ATTESTATIONSERVICE_RESPONSE_PACKET_INVALID_SIZE;
+        goto cleanup_val;
+    }
+
+    /* verify the API method. */
+    if (ATTESTATIONSERVICE_API_METHOD_CONFIGURE != ntohl(uval[0]))
+    {
+        retval =
+            AGENTD_ERROR_ATTESTATIONSERVICE_RECVRESP_UNEXPECTED_METHOD_CODE;
+        goto cleanup_val;
+    }
+
+    /* get the offset. */
+    *offset = ntohl(uval[1]);
+
+    /* get the status code. */
+    *status = ntohl(uval[2]);
+
+    /* success. */
+    retval = AGENTD_STATUS_SUCCESS;
+
+    /* fall-through. */
+
+cleanup_val:
+    memset(val, 0, size);
+    free(val);
+
+done:
+    return retval;
+}
@@ -0,0 +1,75 @@
+/**
+ * \file attestationservice/attestationservice_api_sendreq_configure.c
+ *
+ * \brief Configure the attestation service.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <arpa/inet.h>
+#include <agentd/attestationservice/api.h>
+#include <agentd/inet.h>
+#include <agentd/status_codes.h>
+#include <cbmc/model_assert.h>
+#include <string.h>
+
+/**
+ * \brief Configure the attestation service.
+ *
+ * \param sock          The socket on which this request is made.
+ * \param conf          The config data for this agentd instance.
+ *
+ * This must be the first API call on the attestation control socket.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_ATTESTATIONSERVICE_BAD_PARAMETER if the attestation
+ *        settings in the config have not been set.
+ *      - AGENTD_ERROR_ATTESTATIONSERVICE_IPC_WRITE_DATA_FAILURE if an error
+ *        occurred when writing to the socket.
+ */
+int attestationservice_api_sendreq_configure(
+    int sock, const agent_config_t* conf)
+{
+    int retval;
+
+    /* | Attestation service configure request packet.                | */
+    /* | --------------------------------------------- | ------------ | */
+    /* | DATA                                          | SIZE         | */
+    /* | --------------------------------------------- | ------------ | */
+    /* | ATTESTATIONSERVICE_API_METHOD_CONFIGURE       |  4 bytes     | */
+    /* | max idle milliseconds (uint64_t)              |  8 bytes     | */
+    /* | --------------------------------------------- | ------------ | */
+    /* | total                                         | 12 bytes     | */
+    /* | --------------------------------------------- | ------------ | */
+
+    /* parameter sanity check. */
+    MODEL_ASSERT(NULL != conf);
+    MODEL_ASSERT(conf->attestation_max_milliseconds_set);
+
+    /* runtime parameter sanity check. */
+    if (NULL == conf || !conf->attestation_max_milliseconds_set)
+    {
+        return AGENTD_ERROR_ATTESTATIONSERVICE_BAD_PARAMETER;
+    }
+
+    uint8_t reqbuf[sizeof(uint32_t) + sizeof(uint64_t)];
+
+    /* copy the request ID to the buffer. */
+    uint32_t req = htonl(ATTESTATIONSERVICE_API_METHOD_CONFIGURE);
+    memcpy(reqbuf, &req, sizeof(req));
+
+    /* copy the max idle milliseconds parameter to the buffer. */
+    uint64_t max_milliseconds = htonll(conf->attestation_max_milliseconds);
+    memcpy(
+        reqbuf + sizeof(req), &max_milliseconds, sizeof(max_milliseconds));
+
+    /* write the request packet to the control socket. */
+    retval = ipc_write_data_block(sock, reqbuf, sizeof(reqbuf));
+    if (AGENTD_STATUS_SUCCESS != retval)
+    {
+        retval = AGENTD_ERROR_ATTESTATIONSERVICE_IPC_WRITE_DATA_FAILURE;
+    }
+
+    return retval;
+}
@@ -0,0 +1,153 @@
+/**
+ * \file attestationservice/attestationservice_configure.c
+ *
+ * \brief Read the attestation service configuration from the supervisor.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <arpa/inet.h>
+#include <agentd/attestationservice/api.h>
+#include <agentd/control.h>
+#include <agentd/inet.h>
+#include <agentd/status_codes.h>
+#include <cbmc/model_assert.h>
+#include <string.h>
+
+#include "attestationservice_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+RCPR_IMPORT_psock;
+RCPR_IMPORT_resource;
+
+/* forward decls. */
+static status attestationservice_configure_write_status(
+    psock* sock, uint32_t method, uint32_t status_code);
+
+/**
+ * \brief Read the configure request from the supervisor and apply it to the
+ * given instance.
+ *
+ * The control socket is a blocking socket, since the supervisor sends the
+ * configuration as soon as the attestation service is started. On success, the
+ * instance owns the control socket.
+ *
+ * \param inst          The attestation service instance to configure.
+ * \param control_fd    The control socket descriptor.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_ATTESTATIONSERVICE_REQUEST_PACKET_INVALID_SIZE if the
+ *        configure request has the wrong size.
+ *      - AGENTD_ERROR_ATTESTATIONSERVICE_REQUEST_PACKET_BAD_METHOD if the first
+ *        request is not a configure request.
+ *      - AGENTD_ERROR_ATTESTATIONSERVICE_BAD_PARAMETER if the configured
+ *        values are out of range.
+ *      - a non-zero error code on failure.
+ */
+status attestationservice_configure(
+    attestationservice_instance* inst, int control_fd)
+{
+    status retval, write_retval, release_retval;
+    uint8_t* req = NULL;
+    size_t size = 0;
+    uint32_t method;
+    uint64_t net_max_milliseconds;
+    int64_t max_milliseconds;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != inst);
+    MODEL_ASSERT(NULL == inst->control_sock);
+    MODEL_ASSERT(control_fd >= 0);
+
+    /* the instance owns the control socket from here on. */
+    TRY_OR_FAIL(
+        psock_create_from_descriptor(
+            &inst->control_sock, inst->alloc, control_fd),
+        done);
+
+    /* read the configure request. */
+    TRY_OR_FAIL(
+        psock_read_boxed_data(
+            inst->control_sock, inst->alloc, (void**)&req, &size),
+        done);
+
+    /* the request is a method code followed by the max idle delay. */
+    if (sizeof(method) + sizeof(net_max_milliseconds) != size)
+    {
+        retval = AGENTD_ERROR_ATTESTATIONSERVICE_REQUEST_PACKET_INVALID_SIZE;
+        goto write_status;
+    }
+
+    /* the first request must be a configure request. */
+    memcpy(&method, req, sizeof(method));
+    if (ATTESTATIONSERVICE_API_METHOD_CONFIGURE != ntohl(method))
+    {
+        retval = AGENTD_ERROR_ATTESTATIONSERVICE_REQUEST_PACKET_BAD_METHOD;
+        goto write_status;
+    }
+
+    /* decode the max idle delay. */
+    memcpy(
+        &net_max_milliseconds, req + sizeof(method),
+        sizeof(net_max_milliseconds));
+    max_milliseconds = ntohll(net_max_milliseconds);
+
+    /* the max idle delay must be within the configured range. */
+    if (max_milliseconds < ATTESTATION_MILLISECONDS_MINIMUM
+     || max_milliseconds > ATTESTATION_MILLISECONDS_MAXIMUM)
+    {
+        retval = AGENTD_ERROR_ATTESTATIONSERVICE_BAD_PARAMETER;
+        goto write_status;
+    }
+
+    /* save the configuration data. */
+    inst->sleep_max_micros = (uint64_t)max_milliseconds * 1000;
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    goto write_status;
+
+write_status:
+    write_retval =
+        attestationservice_configure_write_status(
+            inst->control_sock, ATTESTATIONSERVICE_API_METHOD_CONFIGURE,
+            retval);
+    if (STATUS_SUCCESS == retval)
+    {
+        retval = write_retval;
+    }
+
+    memset(req, 0, size);
+    CLEANUP_OR_FALLTHROUGH(rcpr_allocator_reclaim(inst->alloc, req));
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Write a status response to the control socket.
+ *
+ * \param sock          The control socket.
+ * \param method        The method code of the request.
+ * \param status_code   The status of the request.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status attestationservice_configure_write_status(
+    psock* sock, uint32_t method, uint32_t status_code)
+{
+    /* | configure method response packet.                            | */
+    /* | --------------------------------------------- | ------------ | */
+    /* | DATA                                          | SIZE         | */
+    /* | --------------------------------------------- | ------------ | */
+    /* | method                                        | 4 bytes      | */
+    /* | offset                                        | 4 bytes      | */
+    /* | status                                        | 4 bytes      | */
+    /* | --------------------------------------------- | ------------ | */
+    uint32_t resp[3] = { htonl(method), htonl(0U), htonl(status_code) };
+
+    return psock_write_boxed_data(sock, resp, sizeof(resp));
+}
@@ -64,9 +64,6 @@ status attestationservice_create_instance(
     attestationservice_instance* tmp;
     fiber* main_fiber = NULL;
 
-    /* these parameters are unused. */
-    (void)control_fd;
-
     /* allocate memory for the instance. */
     TRY_OR_FAIL(
         rcpr_allocator_allocate(
@@ -146,7 +143,16 @@ status attestationservice_create_instance(
             &artifact_tree_key, NULL),
         cleanup_tmp);
 
-    /* TODO - add config setup and I/O. */
+#if ATTESTATION == 1
+    /* start the stateless check workers, reused by every round. */
+    TRY_OR_FAIL(
+        workpool_create(
+            &tmp->verify_pool, alloc, ATTESTATIONSERVICE_VERIFY_THREADS),
+        cleanup_tmp);
+#endif
+
+    /* read the configuration from the supervisor. */
+    TRY_OR_FAIL(attestationservice_configure(tmp, control_fd), cleanup_tmp);
 
     /* success. */
     *inst = tmp;
@@ -196,9 +202,11 @@ static status attestationservice_instance_resource_release(resource* r)
     status sleep_sock_retval = STATUS_SUCCESS;
     status data_sock_retval = STATUS_SUCCESS;
     status log_sock_retval = STATUS_SUCCESS;
+    status control_sock_retval = STATUS_SUCCESS;
     status release_retval = STATUS_SUCCESS;
     status transaction_rbtree_retval = STATUS_SUCCESS;
     status artifact_rbtree_retval = STATUS_SUCCESS;
+    status verify_pool_retval = STATUS_SUCCESS;
 
     attestationservice_instance* inst = (attestationservice_instance*)r;
 
@@ -226,6 +234,13 @@ static status attestationservice_instance_resource_release(resource* r)
             resource_release(psock_resource_handle(inst->log_sock));
     }
 
+    /* release control sock. */
+    if (NULL != inst->control_sock)
+    {
+        control_sock_retval =
+            resource_release(psock_resource_handle(inst->control_sock));
+    }
+
     /* release transaction rbtree. */
     if (NULL != inst->transaction_tree)
     {
@@ -240,6 +255,13 @@ static status attestationservice_instance_resource_release(resource* r)
             resource_release(rbtree_resource_handle(inst->artifact_tree));
     }
 
+    /* stop the stateless check workers. */
+    if (NULL != inst->verify_pool)
+    {
+        verify_pool_retval =
+            resource_release(workpool_resource_handle(inst->verify_pool));
+    }
+
     /* reclaim the instance structure. */
     release_retval = rcpr_allocator_reclaim(alloc, inst);
 
@@ -256,6 +278,10 @@ static status attestationservice_instance_resource_release(resource* r)
     {
         return log_sock_retval;
     }
+    else if (STATUS_SUCCESS != control_sock_retval)
+    {
+        return control_sock_retval;
+    }
     else if (STATUS_SUCCESS != transaction_rbtree_retval)
     {
         return transaction_rbtree_retval;
@@ -264,6 +290,10 @@ static status attestationservice_instance_resource_release(resource* r)
     {
         return artifact_rbtree_retval;
     }
+    else if (STATUS_SUCCESS != verify_pool_retval)
+    {
+        return verify_pool_retval;
+    }
     else
     {
         return release_retval;
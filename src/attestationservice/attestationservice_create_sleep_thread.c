@@ -15,8 +15,10 @@
 #include <arpa/inet.h>
 #include <cbmc/model_assert.h>
 #include <errno.h>
+#include <poll.h>
 #include <signal.h>
 #include <rcpr/socket_utilities.h>
+#include <sys/socket.h>
 #include <vpr/parameters.h>
 
 #include "attestationservice_internal.h"
@@ -34,20 +36,25 @@ struct sleep_thread_instance
 
     rcpr_allocator* alloc;
     psock* sock;
+    int wakeup_fd;
 };
 
 //forward decls
 static status sleep_thread_entry(void* context);
 static status sleep_thread_instance_release(resource* r);
+static uint64_t sleep_thread_wait(int wakeup_fd, uint64_t sleep_micros);
 
 /**
  * \brief Create a sleep thread for the attestation service.
  *
  * The sleep thread sleeps for a specified amount of time when signaled over its
- * descriptor, and then responds when it's time to wake up.
+ * descriptor, and then responds when it's time to wake up. A datagram on the
+ * wakeup descriptor ends the sleep early.
  *
  * \param th            The thread instance to create.
  * \param alloc         The allocator to use for this operation.
+ * \param wakeup_fd     The descriptor on which protocol services signal that
+ *                      a transaction has been submitted.
  * \param sleep_fd      Pointer to receive the sleep descriptor to be used by
  *                      the main fiber to communicate with this thread.
  *
@@ -56,7 +63,7 @@ static status sleep_thread_instance_release(resource* r);
  *      - a non-zero error code on failure.
  */
 status attestationservice_create_sleep_thread(
-    thread** th, rcpr_allocator* alloc, int* sleep_fd)
+    thread** th, rcpr_allocator* alloc, int wakeup_fd, int* sleep_fd)
 {
     status retval, release_retval;
     sleep_thread_instance* inst;
@@ -79,6 +86,7 @@ status attestationservice_create_sleep_thread(
     /* set values. */
     inst->alloc = alloc;
     inst->sock = NULL;
+    inst->wakeup_fd = wakeup_fd;
 
     /* create the psock instance for communicating with the main fiber. */
     TRY_OR_FAIL(
@@ -164,7 +172,7 @@ static status sleep_thread_entry(void* context)
 {
     status retval, release_retval;
     sleep_thread_instance* inst = (sleep_thread_instance*)context;
-    uint64_t sleep_micros;
+    uint64_t sleep_micros, wake_reason;
 
     /* forever loop. */
     for (;;)
@@ -174,12 +182,12 @@ static status sleep_thread_entry(void* context)
             psock_read_boxed_uint64(inst->sock, &sleep_micros),
             cleanup_inst);
 
-        /* sleep that amount of time. */
-        usleep(sleep_micros);
+        /* sleep that amount of time, or until a transaction is submitted. */
+        wake_reason = sleep_thread_wait(inst->wakeup_fd, sleep_micros);
 
-        /* notify our peer that the sleep time has elapsed. */
+        /* notify our peer that it is time to wake up. */
         TRY_OR_FAIL(
-            psock_write_boxed_uint64(inst->sock, sleep_micros),
+            psock_write_boxed_uint64(inst->sock, wake_reason),
             cleanup_inst);
     }
 
@@ -188,3 +196,36 @@ cleanup_inst:
 
     return retval;
 }
+
+/**
+ * \brief Wait for the sleep time to elapse or for a wakeup datagram.
+ *
+ * \param wakeup_fd         The wakeup descriptor.
+ * \param sleep_micros      The maximum sleep time in microseconds.
+ *
+ * \returns the reason that the wait ended.
+ *      - ATTESTATIONSERVICE_WAKE_REASON_SUBMIT if a wakeup was received.
+ *      - ATTESTATIONSERVICE_WAKE_REASON_TIMEOUT otherwise.
+ */
+static uint64_t sleep_thread_wait(int wakeup_fd, uint64_t sleep_micros)
+{
+    struct pollfd pfd;
+    uint8_t buf[64];
+
+    pfd.fd = wakeup_fd;
+    pfd.events = POLLIN;
+    pfd.revents = 0;
+
+    /* poll has millisecond resolution; round up so we never spin. */
+    int timeout = (int)((sleep_micros + 999) / 1000);
+    if (poll(&pfd, 1, timeout) <= 0 || !(pfd.revents & POLLIN))
+    {
+        return ATTESTATIONSERVICE_WAKE_REASON_TIMEOUT;
+    }
+
+    /* drain every pending wakeup, so that a burst of submits is one round. */
+    while (recv(wakeup_fd, buf, sizeof(buf), MSG_DONTWAIT) > 0)
+        ;
+
+    return ATTESTATIONSERVICE_WAKE_REASON_SUBMIT;
+}
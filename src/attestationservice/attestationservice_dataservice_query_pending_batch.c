@@ -0,0 +1,127 @@
+/**
+ * \file
+ * attestationservice/attestationservice_dataservice_query_pending_batch.c
+ *
+ * \brief Prefetch a batch of submitted transactions past the cursor.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/control.h>
+#include <agentd/dataservice/api.h>
+#include <agentd/status_codes.h>
+#include <arpa/inet.h>
+#include <string.h>
+
+#include "attestationservice_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+RCPR_IMPORT_uuid;
+
+/* key denoting the end of the transaction chain. */
+static const uint8_t end_of_transaction_key[16] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF };
+
+/**
+ * \brief Prefetch a batch of submitted transactions that follow the
+ * attestation cursor.
+ *
+ * The batch ends at the end of the process queue, at the first transaction
+ * that is not in the submitted state, or when \p max_count transactions have
+ * been read.
+ *
+ * \param inst              The attestation service instance.
+ * \param child_context     The child context to use for this operation.
+ * \param batch             The batch array to fill.
+ * \param max_count         The capacity of the batch array.
+ * \param count             Pointer to receive the number of transactions read.
+ * \param more              Pointer to a flag set to true if the batch filled
+ *                          up before the end of the queue.
+ *
+ * \note On success, the caller owns the transaction data in each of the first
+ * \p count batch entries.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status attestationservice_dataservice_query_pending_batch(
+    attestationservice_instance* inst, uint32_t child_context,
+    attestationservice_pending_transaction* batch, size_t max_count,
+    size_t* count, bool* more)
+{
+    status retval, release_retval;
+    attestationservice_pending_transaction* entry;
+
+    *count = 0;
+    *more = false;
+
+    /* read the first transaction past the cursor. */
+    entry = &batch[0];
+    retval =
+        attestationservice_dataservice_query_resume_transaction(
+            inst, child_context, &entry->node, &entry->data,
+            &entry->data_size);
+    if (AGENTD_ERROR_DATASERVICE_NOT_FOUND == retval)
+    {
+        /* the queue holds nothing new. */
+        return STATUS_SUCCESS;
+    }
+    else if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    for (;;)
+    {
+        /* only submitted transactions are attested. */
+        if (DATASERVICE_TRANSACTION_NODE_STATE_SUBMITTED
+                != ntohl(entry->node.net_txn_state))
+        {
+            TRY_OR_FAIL(
+                rcpr_allocator_reclaim(inst->alloc, entry->data),
+                cleanup_batch);
+            break;
+        }
+
+        /* this entry is part of the batch. */
+        ++*count;
+
+        /* stop at the end of the queue. */
+        if (!memcmp(entry->node.next, end_of_transaction_key, 16))
+        {
+            break;
+        }
+
+        /* stop when the batch is full. */
+        if (*count == max_count)
+        {
+            *more = true;
+            break;
+        }
+
+        /* read the next transaction into the next slot. */
+        entry = &batch[*count];
+        TRY_OR_FAIL(
+            attestationservice_dataservice_query_pending_transaction(
+                inst->data_sock, &inst->vpr_alloc, inst->alloc, child_context,
+                (rcpr_uuid*)batch[*count - 1].node.next, &entry->node,
+                &entry->data, &entry->data_size),
+            cleanup_batch);
+    }
+
+    return STATUS_SUCCESS;
+
+cleanup_batch:
+    for (size_t i = 0; i < *count; ++i)
+    {
+        CLEANUP_OR_FALLTHROUGH(
+            rcpr_allocator_reclaim(inst->alloc, batch[i].data));
+    }
+
+    *count = 0;
+    *more = false;
+
+    return retval;
+}
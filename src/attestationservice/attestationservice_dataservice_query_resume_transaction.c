@@ -0,0 +1,145 @@
+/**
+ * \file
+ * attestationservice/attestationservice_dataservice_query_resume_transaction.c
+ *
+ * \brief Query the first pending transaction past the attestation cursor.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/control.h>
+#include <agentd/dataservice/api.h>
+#include <agentd/status_codes.h>
+#include <arpa/inet.h>
+#include <string.h>
+
+#include "attestationservice_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+RCPR_IMPORT_rbtree;
+RCPR_IMPORT_uuid;
+
+/* key denoting the end of the transaction chain. */
+static const uint8_t end_of_transaction_key[16] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF };
+
+/**
+ * \brief Query the first pending transaction that follows the attestation
+ * cursor.
+ *
+ * If the cursor is still in the process queue, only the transactions queued
+ * after it are read. Otherwise, the cursor and the transaction / artifact
+ * caches are reset, and the queue is scanned from the head. Transactions that
+ * are already attested are added to the caches and advance the cursor.
+ *
+ * \param inst              The attestation service instance.
+ * \param child_context     The child context to use for this operation.
+ * \param txn_node          The transaction node to return.
+ * \param txn_data          The transaction data to return.
+ * \param txn_data_size     The size of the returned transaction data.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_DATASERVICE_NOT_FOUND if there are no transactions past
+ *        the cursor.
+ *      - a non-zero error code on failure.
+ */
+status attestationservice_dataservice_query_resume_transaction(
+    attestationservice_instance* inst, uint32_t child_context,
+    data_transaction_node_t* txn_node, void** txn_data, size_t* txn_data_size)
+{
+    status retval, release_retval;
+
+    /* resume from the cursor if the dataservice still has it queued. */
+    if (inst->cursor_set)
+    {
+        retval =
+            attestationservice_dataservice_query_pending_transaction(
+                inst->data_sock, &inst->vpr_alloc, inst->alloc, child_context,
+                &inst->cursor, txn_node, txn_data, txn_data_size);
+        if (STATUS_SUCCESS == retval)
+        {
+            /* we only need the links from the cursor transaction. */
+            TRY_OR_FAIL(rcpr_allocator_reclaim(inst->alloc, *txn_data), done);
+
+            if (DATASERVICE_TRANSACTION_NODE_STATE_ATTESTED
+                    == ntohl(txn_node->net_txn_state))
+            {
+                /* there is nothing new past the cursor. */
+                if (!memcmp(txn_node->next, end_of_transaction_key, 16))
+                {
+                    retval = AGENTD_ERROR_DATASERVICE_NOT_FOUND;
+                    goto done;
+                }
+
+                /* read the first transaction queued after the cursor. */
+                retval =
+                    attestationservice_dataservice_query_pending_transaction(
+                        inst->data_sock, &inst->vpr_alloc, inst->alloc,
+                        child_context, (rcpr_uuid*)txn_node->next, txn_node,
+                        txn_data, txn_data_size);
+                goto done;
+            }
+        }
+        else if (AGENTD_ERROR_DATASERVICE_NOT_FOUND != retval)
+        {
+            goto done;
+        }
+
+        /* the cursor has been canonized or dropped. */
+        inst->cursor_set = false;
+    }
+
+    /* the caches only reflect the queue up to the cursor, so start over. */
+    TRY_OR_FAIL(rbtree_clear(inst->transaction_tree), done);
+    TRY_OR_FAIL(rbtree_clear(inst->artifact_tree), done);
+
+    /* scan from the head of the queue. */
+    retval =
+        attestationservice_dataservice_query_pending_transaction(
+            inst->data_sock, &inst->vpr_alloc, inst->alloc, child_context,
+            NULL, txn_node, txn_data, txn_data_size);
+
+    /* skip past transactions that were attested in earlier rounds. */
+    while (STATUS_SUCCESS == retval
+        && DATASERVICE_TRANSACTION_NODE_STATE_ATTESTED
+                == ntohl(txn_node->net_txn_state))
+    {
+        /* later transactions in this artifact build on this one. */
+        retval =
+            attestationservice_transaction_tree_insert(
+                inst, child_context, txn_node);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_txn_data;
+        }
+
+        /* advance the cursor. */
+        memcpy(&inst->cursor, txn_node->key, sizeof(inst->cursor));
+        inst->cursor_set = true;
+
+        TRY_OR_FAIL(rcpr_allocator_reclaim(inst->alloc, *txn_data), done);
+
+        /* stop at the end of the queue. */
+        if (!memcmp(txn_node->next, end_of_transaction_key, 16))
+        {
+            retval = AGENTD_ERROR_DATASERVICE_NOT_FOUND;
+            goto done;
+        }
+
+        retval =
+            attestationservice_dataservice_query_pending_transaction(
+                inst->data_sock, &inst->vpr_alloc, inst->alloc,
+                child_context, (rcpr_uuid*)txn_node->next, txn_node,
+                txn_data, txn_data_size);
+    }
+
+    goto done;
+
+cleanup_txn_data:
+    CLEANUP_OR_FALLTHROUGH(rcpr_allocator_reclaim(inst->alloc, *txn_data));
+
+done:
+    return retval;
+}
@@ -0,0 +1,103 @@
+/**
+ * \file
+ * attestationservice/attestationservice_dataservice_transaction_batch_update.c
+ *
+ * \brief Promote or drop a batch of transactions in the transaction process
+ * queue.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/control.h>
+#include <agentd/dataservice/api.h>
+#include <agentd/status_codes.h>
+#include <string.h>
+
+#include "attestationservice_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+RCPR_IMPORT_psock;
+
+/**
+ * \brief Promote or drop each transaction in a batch, based on its verify
+ * status, under a single dataservice request.
+ *
+ * \param inst              The attestation service instance.
+ * \param child_context     The child context to use for this operation.
+ * \param batch             The batch of verified transactions.
+ * \param count             The number of transactions in the batch.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status attestationservice_dataservice_transaction_batch_update(
+    attestationservice_instance* inst, uint32_t child_context,
+    const attestationservice_pending_transaction* batch, size_t count)
+{
+    status retval, release_retval;
+    data_transaction_batch_update_entry_t* entries;
+    uint32_t* statuses;
+    uint32_t status, offset;
+
+    /* allocate the request entries. */
+    TRY_OR_FAIL(
+        rcpr_allocator_allocate(
+            inst->alloc, (void**)&entries, count * sizeof(*entries)),
+        done);
+
+    /* allocate the entry statuses. */
+    TRY_OR_FAIL(
+        rcpr_allocator_allocate(
+            inst->alloc, (void**)&statuses, count * sizeof(*statuses)),
+        cleanup_entries);
+
+    /* promote transactions that passed attestation, and drop the rest. */
+    for (size_t i = 0; i < count; ++i)
+    {
+        memcpy(entries[i].txn_id, batch[i].node.key, sizeof(entries[i].txn_id));
+        entries[i].action =
+            (STATUS_SUCCESS == batch[i].verify_status)
+                ? DATASERVICE_TRANSACTION_BATCH_ACTION_PROMOTE
+                : DATASERVICE_TRANSACTION_BATCH_ACTION_DROP;
+    }
+
+    /* send the batch update request to the dataservice. */
+    TRY_OR_FAIL(
+        dataservice_api_sendreq_transaction_batch_update(
+            inst->data_sock, &inst->vpr_alloc, child_context, entries,
+            count),
+        cleanup_statuses);
+
+    /* receive the response from the batch update request. */
+    TRY_OR_FAIL(
+        dataservice_api_recvresp_transaction_batch_update(
+            inst->data_sock, inst->alloc, &offset, &status, statuses, count),
+        cleanup_statuses);
+
+    /* if the operation failed, exit. */
+    TRY_OR_FAIL(status, cleanup_statuses);
+
+    /* every promotion must succeed; drop failures are ignored, since it's
+     * possible that the canonization service is clobbering us. */
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (DATASERVICE_TRANSACTION_BATCH_ACTION_PROMOTE == entries[i].action)
+        {
+            TRY_OR_FAIL(statuses[i], cleanup_statuses);
+        }
+    }
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    goto cleanup_statuses;
+
+cleanup_statuses:
+    CLEANUP_OR_FALLTHROUGH(rcpr_allocator_reclaim(inst->alloc, statuses));
+
+cleanup_entries:
+    CLEANUP_OR_FALLTHROUGH(rcpr_allocator_reclaim(inst->alloc, entries));
+
+done:
+    return retval;
+}
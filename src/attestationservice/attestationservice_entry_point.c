@@ -34,13 +34,15 @@ RCPR_IMPORT_thread;
  * \param logsock       The logging service socket.  The attestation service
  *                      logs on this socket.
  * \param controlsock   The socket used to control the attestation service.
+ * \param wakeupsock    The datagram socket on which protocol services signal
+ *                      that a transaction has been submitted.
  *
  * \returns a status code on service exit indicating a normal or abnormal exit.
  *          - AGENTD_STATUS_SUCCESS on normal exit.
  *          - a non-zero error code on failure.
  */
 int attestationservice_entry_point(
-    int datasock, int logsock, int controlsock)
+    int datasock, int logsock, int controlsock, int wakeupsock)
 {
     status retval, release_retval;
     rcpr_allocator* alloc;
@@ -68,11 +70,12 @@ int attestationservice_entry_point(
         cleanup_sched);
 
     /* create a sleeper thread for waking the main fiber, returning a socket
-     * descriptor for receiving wake-up events.
+     * descriptor for receiving wake-up events. Submit signals on the wakeup
+     * socket cut the sleep short.
      */
     TRY_OR_FAIL(
         attestationservice_create_sleep_thread(
-            &sleep_thread, alloc, &sleep_fd),
+            &sleep_thread, alloc, wakeupsock, &sleep_fd),
         cleanup_sched);
 
     /* create a reaper fiber for sending quiesce / terminate events from the
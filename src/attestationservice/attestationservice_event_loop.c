@@ -26,15 +26,27 @@ RCPR_IMPORT_rbtree;
 RCPR_IMPORT_resource;
 RCPR_IMPORT_uuid;
 
+#if ATTESTATION == 1
+/**
+ * \brief A batch checked by the stateless check workers.
+ */
+typedef struct attestationservice_verify_work
+{
+    attestationservice_instance* inst;
+    attestationservice_pending_transaction* txns;
+} attestationservice_verify_work;
+#endif
+
 /* forward decls. */
 #if ATTESTATION == 1
 static status attestationservice_do_attestation(
-    attestationservice_instance* inst, uint32_t child_context);
-
-/* key denoting the end of the transaction chain. */
-const uint8_t END_OF_TRANSACTION_KEY[16] = {
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF };
+    attestationservice_instance* inst, uint32_t child_context,
+    bool* attested);
+static void attestationservice_verify_batch_fields(
+    attestationservice_instance* inst,
+    attestationservice_pending_transaction* batch, size_t count);
+static void attestationservice_verify_slice(
+    void* context, size_t begin, size_t end);
 #endif
 
 /**
@@ -42,6 +54,11 @@ const uint8_t END_OF_TRANSACTION_KEY[16] = {
  * until activation time, then queries the process queue for transactions that
  * have not yet been attested, and performs attestation on these.
  *
+ * While rounds find transactions to attest, the loop sleeps for the minimum
+ * delay. Each idle round doubles the delay, up to the configured maximum
+ * delay. A transaction submit wakes the loop early and resets the delay, so
+ * that a submit after an idle period does not wait for the full delay.
+ *
  * \param inst          The attestation service instance to use for this loop.
  *
  * \returns a status code indicating success or failure.
@@ -52,6 +69,7 @@ status attestationservice_event_loop(attestationservice_instance* inst)
 {
     status retval, release_retval;
     uint32_t child_context;
+    uint64_t sleep_micros = ATTESTATIONSERVICE_SLEEP_MIN_MICROS;
 
     /* set up child node for data service. */
     TRY_OR_FAIL(
@@ -61,24 +79,36 @@ status attestationservice_event_loop(attestationservice_instance* inst)
 
     for (;;)
     {
-        /* TODO - replace with config value. */
-        uint64_t sleep_micros = 5000 * 1000;
+        bool attested = false;
+        bool woken = false;
 
         /* sleep. */
         TRY_OR_FAIL(
-            attestationservice_sleep(inst->sleep_sock, sleep_micros),
+            attestationservice_sleep(inst->sleep_sock, sleep_micros, &woken),
             cleanup_inst);
 
         #if ATTESTATION == 1
         /* start a round of attestation if there are pending transactions. */
         TRY_OR_FAIL(
-            attestationservice_do_attestation(inst, child_context),
+            attestationservice_do_attestation(
+                inst, child_context, &attested),
             cleanup_inst);
-
-        /* reset the rbtree instances for transactions and artifacts. */
-        TRY_OR_FAIL(rbtree_clear(inst->transaction_tree), cleanup_inst);
-        TRY_OR_FAIL(rbtree_clear(inst->artifact_tree), cleanup_inst);
         #endif
+
+        /* poll again quickly while there is work, or after a submit whose
+         * commit may not have been visible yet; back off when idle. */
+        if (attested || woken)
+        {
+            sleep_micros = ATTESTATIONSERVICE_SLEEP_MIN_MICROS;
+        }
+        else if (sleep_micros < inst->sleep_max_micros / 2)
+        {
+            sleep_micros *= 2;
+        }
+        else if (sleep_micros < inst->sleep_max_micros)
+        {
+            sleep_micros = inst->sleep_max_micros;
+        }
     }
 
 cleanup_inst:
@@ -91,131 +121,210 @@ cleanup_inst:
 /**
  * \brief Perform the attestation process.
  *
+ * Attestation runs in stages over batches of prefetched transactions. First,
+ * a batch of submitted transactions is read from the process queue. Next, the
+ * stateless field checks are run on every transaction in the batch, split
+ * across worker threads for large batches. Then, the order-dependent sequence
+ * and uniqueness checks are run in queue order against the in-memory artifact
+ * tree. Finally, the whole batch is promoted or dropped with a single
+ * dataservice request.
+ *
  * \param inst              The attestation service instance to use.
  * \param child_context     The child context for the dataservice.
+ * \param attested          Set to true if any submitted transactions were
+ *                          processed in this round.
  *
  * \returns a status code indicating success or failure.
  *      - AGENTD_STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
 static status attestationservice_do_attestation(
-    attestationservice_instance* inst, uint32_t child_context)
+    attestationservice_instance* inst, uint32_t child_context,
+    bool* attested)
 {
     status retval, release_retval;
-    data_transaction_node_t txn_node;
-    void* txn_data;
-    size_t txn_data_size;
-    uint32_t status;
-    uint32_t drop_status, drop_offset;
-
-    /* Query the pending transaction table for new entries. */
-    retval = status =
-        attestationservice_dataservice_query_pending_transaction(
-            inst->data_sock, &inst->vpr_alloc, inst->alloc, child_context, NULL,
-            &txn_node, &txn_data, &txn_data_size);
-    if (AGENTD_ERROR_DATASERVICE_NOT_FOUND == retval)
-    {
-        /* if no results were found, go back to sleep. */
-        goto exit_nonfatal;
-    }
-    else if (AGENTD_STATUS_SUCCESS != retval)
-    {
-        /* if we got any other error, exit the process. */
-        goto exit_fatal;
-    }
+    attestationservice_pending_transaction* batch;
+    attestationservice_pending_transaction* txn;
+    size_t count = 0;
+    bool more;
 
-    /* if an entry is found, but it has been attested, go back to sleep. */
-    uint32_t txn_state = ntohl(txn_node.net_txn_state);
-    if (DATASERVICE_TRANSACTION_NODE_STATE_ATTESTED == txn_state)
-    {
-        /* TODO - this assumes a malloc allocator. Fix in recvresp. */
-        CLEANUP_OR_FALLTHROUGH(
-            rcpr_allocator_reclaim(inst->alloc, txn_data));
-        goto exit_nonfatal;
-    }
+    /* allocate the batch. */
+    TRY_OR_FAIL(
+        rcpr_allocator_allocate(
+            inst->alloc, (void**)&batch,
+            ATTESTATIONSERVICE_BATCH_SIZE * sizeof(*batch)),
+        done);
 
-    /* Otherwise, start the attestation loop. */
-    while (AGENTD_STATUS_SUCCESS == status
-        && DATASERVICE_TRANSACTION_NODE_STATE_SUBMITTED == txn_state)
+    do
     {
-        /* TODO: Has this entry been signed by an authorized entity? */
-
-        /* If this is a create transaction, is the artifact ID unique and
-         * all fields valid for a create?
-         */
+        /* prefetch a batch of submitted transactions. */
         TRY_OR_FAIL(
-            attestationservice_verify_txn_has_valid_fields(
-                inst, &txn_node, txn_data, txn_data_size),
-            drop_txn);
+            attestationservice_dataservice_query_pending_batch(
+                inst, child_context, batch, ATTESTATIONSERVICE_BATCH_SIZE,
+                &count, &more),
+            cleanup_batch);
 
-        /* If this is any other transaction, does the previous transaction
-         * match the latest transaction from that artifact (either from the
-         * pending transactions or queried from the database?) and does the
-         * previous transaction state match the last transaction's state?
-         */
-        TRY_OR_FAIL(
-            attestationservice_verify_txn_is_in_correct_sequence(
-                inst, child_context, &txn_node, txn_data, txn_data_size),
-            drop_txn);
-
-        /* Is the transaction unique? */
-        /* NOTE: unique means that its transaction id (and artifact id if a
-         * create) does not exist as an artifact, entity, block, or transaction
-         * id anywhere else.
-         */
-        TRY_OR_FAIL(
-            attestationservice_verify_txn_is_unique(
-                inst, child_context, &txn_node, txn_data, txn_data_size),
-            drop_txn);
+        /* this round found work to do. */
+        if (count > 0)
+        {
+            *attested = true;
+        }
 
-        /* if the transaction passes all attestation tests, promote it. */
-        TRY_OR_FAIL(
-            attestationservice_dataservice_transaction_promote(
-                inst, child_context, &txn_node),
-            exit_fatal);
+        /* run the stateless checks over the whole batch. */
+        attestationservice_verify_batch_fields(inst, batch, count);
 
-        /* move on to the next transaction. */
-        goto txn_cleanup;
+        /* run the order-dependent checks in queue order. */
+        for (size_t i = 0; i < count; ++i)
+        {
+            txn = &batch[i];
 
-    drop_txn:
-        /* drop a failed transaction. */
-        TRY_OR_FAIL(
-            dataservice_api_sendreq_transaction_drop(
-                inst->data_sock, child_context, txn_node.key),
-            exit_fatal);
-        TRY_OR_FAIL(
-            dataservice_api_recvresp_transaction_drop(
-                inst->data_sock, inst->alloc, &drop_offset, &drop_status),
-            exit_fatal);
-        /* ignore the drop status; it's possible that the canonization
-         * service is clobbering us. */
+            /* If this is any other transaction, does the previous transaction
+             * match the latest transaction from that artifact (either from
+             * the pending transactions or queried from the database?) and
+             * does the previous transaction state match the last
+             * transaction's state?
+             */
+            if (STATUS_SUCCESS == txn->verify_status)
+            {
+                txn->verify_status =
+                    attestationservice_verify_txn_is_in_correct_sequence(
+                        inst, child_context, &txn->node, txn->data,
+                        txn->data_size);
+            }
 
-    txn_cleanup:
-        /* TODO - this assumes a malloc allocator. Fix in recvresp. */
-        CLEANUP_OR_FALLTHROUGH(
-            rcpr_allocator_reclaim(inst->alloc, txn_data));
+            /* Is the transaction unique? */
+            /* NOTE: unique means that its transaction id (and artifact id if
+             * a create) does not exist as an artifact, entity, block, or
+             * transaction id anywhere else.
+             */
+            if (STATUS_SUCCESS == txn->verify_status)
+            {
+                txn->verify_status =
+                    attestationservice_verify_txn_is_unique(
+                        inst, child_context, &txn->node, txn->data,
+                        txn->data_size);
+            }
 
-        /* get the next transaction by sequence. */
-        if (memcmp(txn_node.next, END_OF_TRANSACTION_KEY, 16))
+            /* a transaction that passes all attestation tests is added to
+             * the tree now, so that later transactions in this batch are
+             * sequenced against it. */
+            if (STATUS_SUCCESS == txn->verify_status)
+            {
+                TRY_OR_FAIL(
+                    attestationservice_transaction_tree_insert(
+                        inst, child_context, &txn->node),
+                    cleanup_batch_data);
+            }
+        }
+
+        /* promote the transactions that passed and drop the rest under a
+         * single dataservice commit. */
+        if (count > 0)
         {
-            /* query the next pending transaction. */
             TRY_OR_FAIL(
-                attestationservice_dataservice_query_pending_transaction(
-                    inst->data_sock, &inst->vpr_alloc, inst->alloc,
-                    child_context, (rcpr_uuid*)txn_node.next,
-                    &txn_node, &txn_data, &txn_data_size),
-                exit_fatal);
+                attestationservice_dataservice_transaction_batch_update(
+                    inst, child_context, batch, count),
+                cleanup_batch_data);
+        }
+
+        /* the next round resumes after the last promoted transaction. */
+        for (size_t i = count; i > 0; --i)
+        {
+            if (STATUS_SUCCESS == batch[i - 1].verify_status)
+            {
+                memcpy(
+                    &inst->cursor, batch[i - 1].node.key,
+                    sizeof(inst->cursor));
+                inst->cursor_set = true;
+                break;
+            }
         }
-        else
+
+        /* TODO - this assumes a malloc allocator. Fix in recvresp. */
+        for (size_t i = 0; i < count; ++i)
         {
-            status = AGENTD_ERROR_DATASERVICE_NOT_FOUND;
+            TRY_OR_FAIL(
+                rcpr_allocator_reclaim(inst->alloc, batch[i].data),
+                cleanup_batch);
         }
+        count = 0;
+
+    } while (more);
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    goto cleanup_batch;
+
+cleanup_batch_data:
+    for (size_t i = 0; i < count; ++i)
+    {
+        CLEANUP_OR_FALLTHROUGH(
+            rcpr_allocator_reclaim(inst->alloc, batch[i].data));
     }
 
-exit_fatal:
+cleanup_batch:
+    CLEANUP_OR_FALLTHROUGH(rcpr_allocator_reclaim(inst->alloc, batch));
+
+done:
     return retval;
+}
 
-exit_nonfatal:
-    return STATUS_SUCCESS;
+/**
+ * \brief Run the stateless checks over a batch, using the instance worker
+ * pool for large batches.
+ *
+ * These checks don't depend on queue order or on the artifact tree, so the
+ * batch is split into contiguous slices that are checked concurrently. Each
+ * transaction's verify_status is set to the result of its check.
+ *
+ * \param inst              The attestation service instance.
+ * \param batch             The batch of pending transactions.
+ * \param count             The number of transactions in the batch.
+ */
+static void attestationservice_verify_batch_fields(
+    attestationservice_instance* inst,
+    attestationservice_pending_transaction* batch, size_t count)
+{
+    attestationservice_verify_work work;
+
+    MODEL_ASSERT(NULL != inst);
+    MODEL_ASSERT(0 == count || NULL != batch);
+
+    /* small batches are checked inline by the pool. */
+    work.inst = inst;
+    work.txns = batch;
+    workpool_run(
+        inst->verify_pool, &attestationservice_verify_slice, &work, count,
+        ATTESTATIONSERVICE_VERIFY_PARALLEL_MIN);
+}
+
+/**
+ * \brief Run the stateless checks over a slice of a batch.
+ *
+ * \param context           The attestationservice_verify_work for this batch.
+ * \param begin             The first transaction in the slice.
+ * \param end               One past the last transaction in the slice.
+ */
+static void attestationservice_verify_slice(
+    void* context, size_t begin, size_t end)
+{
+    attestationservice_verify_work* work =
+        (attestationservice_verify_work*)context;
+
+    MODEL_ASSERT(NULL != work);
+
+    for (size_t i = begin; i < end; ++i)
+    {
+        attestationservice_pending_transaction* txn = &work->txns[i];
+
+        /* TODO: Has this entry been signed by an authorized entity? */
+
+        /* If this is a create transaction, is the artifact ID unique and all
+         * fields valid for a create?
+         */
+        txn->verify_status =
+            attestationservice_verify_txn_has_valid_fields(
+                work->inst, &txn->node, txn->data, txn->data_size);
+    }
 }
 #endif
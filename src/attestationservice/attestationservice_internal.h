@@ -10,6 +10,7 @@
 #define AGENTD_ATTESTATIONSERVICE_INTERNAL_HEADER_GUARD
 
 #include <agentd/dataservice/async_api.h>
+#include <agentd/workpool.h>
 #include <rcpr/fiber.h>
 #include <rcpr/psock.h>
 #include <rcpr/rbtree.h>
@@ -24,6 +25,37 @@ extern "C" {
 #define SIGNAL_STATE_QUIESCE            0x00000000
 #define SIGNAL_STATE_TERMINATE          0x00000001
 
+/**
+ * \brief The delay between attestation rounds while transactions are arriving.
+ */
+#define ATTESTATIONSERVICE_SLEEP_MIN_MICROS     (10 * 1000)
+
+/**
+ * \brief The sleep thread reply when the sleep time elapsed.
+ */
+#define ATTESTATIONSERVICE_WAKE_REASON_TIMEOUT  0
+
+/**
+ * \brief The sleep thread reply when a transaction submit ended the sleep.
+ */
+#define ATTESTATIONSERVICE_WAKE_REASON_SUBMIT   1
+
+/**
+ * \brief The number of pending transactions prefetched per attestation batch.
+ */
+#define ATTESTATIONSERVICE_BATCH_SIZE           256
+
+/**
+ * \brief The number of threads, including the attestation thread, that run
+ * the stateless field checks.
+ */
+#define ATTESTATIONSERVICE_VERIFY_THREADS       4
+
+/**
+ * \brief Batches with fewer transactions than this are checked inline.
+ */
+#define ATTESTATIONSERVICE_VERIFY_PARALLEL_MIN  64
+
 /**
  * \brief The attestation service instance structure.
  */
@@ -38,8 +70,13 @@ struct attestationservice_instance
     RCPR_SYM(psock)* sleep_sock;
     RCPR_SYM(psock)* data_sock;
     RCPR_SYM(psock)* log_sock;
+    RCPR_SYM(psock)* control_sock;
+    uint64_t sleep_max_micros;
     RCPR_SYM(rbtree)* transaction_tree;
     RCPR_SYM(rbtree)* artifact_tree;
+    workpool* verify_pool;
+    bool cursor_set;
+    RCPR_SYM(rcpr_uuid) cursor;
 };
 
 /**
@@ -53,6 +90,19 @@ struct transaction_record_value
     data_transaction_node_t data;
 };
 
+/**
+ * \brief A pending transaction prefetched for attestation.
+ */
+typedef struct attestationservice_pending_transaction
+attestationservice_pending_transaction;
+struct attestationservice_pending_transaction
+{
+    data_transaction_node_t node;
+    void* data;
+    size_t data_size;
+    status verify_status;
+};
+
 /**
  * \brief The artifact record resource value.
  */
@@ -87,10 +137,13 @@ status attestationservice_create_signal_thread(
  * \brief Create a sleep thread for the attestation service.
  *
  * The sleep thread sleeps for a specified amount of time when signaled over its
- * descriptor, and then responds when it's time to wake up.
+ * descriptor, and then responds when it's time to wake up. A datagram on the
+ * wakeup descriptor ends the sleep early.
  *
  * \param th            The thread instance to create.
  * \param alloc         The allocator to use for this operation.
+ * \param wakeup_fd     The descriptor on which protocol services signal that
+ *                      a transaction has been submitted.
  * \param sleep_fd      Pointer to receive the sleep descriptor to be used by
  *                      the main fiber to communicate with this thread.
  *
@@ -99,7 +152,8 @@ status attestationservice_create_signal_thread(
  *      - a non-zero error code on failure.
  */
 status attestationservice_create_sleep_thread(
-    RCPR_SYM(thread)** th, RCPR_SYM(allocator)* alloc, int* sleep_fd);
+    RCPR_SYM(thread)** th, RCPR_SYM(allocator)* alloc, int wakeup_fd,
+    int* sleep_fd);
 
 /**
  * \brief Create a fiber to listen to quiesce / terminate events, and broadcast
@@ -144,6 +198,30 @@ status attestationservice_create_instance(
     RCPR_SYM(fiber_scheduler)* sched, int sleep_fd, int data_fd, int log_fd,
     int control_fd);
 
+/**
+ * \brief Read the configure request from the supervisor and apply it to the
+ * given instance.
+ *
+ * The control socket is a blocking socket, since the supervisor sends the
+ * configuration as soon as the attestation service is started. On success, the
+ * instance owns the control socket.
+ *
+ * \param inst          The attestation service instance to configure.
+ * \param control_fd    The control socket descriptor.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_ATTESTATIONSERVICE_REQUEST_PACKET_INVALID_SIZE if the
+ *        configure request has the wrong size.
+ *      - AGENTD_ERROR_ATTESTATIONSERVICE_REQUEST_PACKET_BAD_METHOD if the first
+ *        request is not a configure request.
+ *      - AGENTD_ERROR_ATTESTATIONSERVICE_BAD_PARAMETER if the configured
+ *        values are out of range.
+ *      - a non-zero error code on failure.
+ */
+status attestationservice_configure(
+    attestationservice_instance* inst, int control_fd);
+
 /**
  * \brief The event loop for the attestation service. This event loop sleeps
  * until activation time, then queries the process queue for transactions that
@@ -162,17 +240,21 @@ status attestationservice_event_loop(attestationservice_instance* inst);
  *
  * \param sleep_sock    Socket for sleep thread communication.
  * \param sleep_time    Sleep time in microseconds.
+ * \param woken         Set to true if a submit wakeup ended the sleep early.
  *
  * \returns a status code on success or failure.
  *      - STATUS_SUCCESS on success.
  *      - a non-zero failure code on failure.
  */
 status attestationservice_sleep(
-    RCPR_SYM(psock)* sleep_sock, uint64_t sleep_time);
+    RCPR_SYM(psock)* sleep_sock, uint64_t sleep_time, bool* woken);
 
 /**
  * \brief Verify that the given transaction has valid fields.
  *
+ * This check runs on worker threads, so it must only read the instance and
+ * must not use its allocator or sockets.
+ *
  * \param inst              The attestation service instance.
  * \param txn_node          The transaction node.
  * \param txn_data          The transaction data.
@@ -215,6 +297,8 @@ status attestationservice_verify_txn_is_in_correct_sequence(
  *
  * \returns a status code indicating success or failure.
  *      - STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_ATTESTATIONSERVICE_DUPLICATE_ID if the transaction id,
+ *        or the artifact id of a create transaction, is already in use.
  *      - a non-zero error code on failure.
  */
 status attestationservice_verify_txn_is_unique(
@@ -259,6 +343,59 @@ status attestationservice_dataservice_query_pending_transaction(
     RCPR_SYM(rcpr_uuid)* txn_id, data_transaction_node_t* txn_node,
     void** txn_data, size_t* txn_data_size);
 
+/**
+ * \brief Query the first pending transaction that follows the attestation
+ * cursor.
+ *
+ * If the cursor is still in the process queue, only the transactions queued
+ * after it are read. Otherwise, the cursor and the transaction / artifact
+ * caches are reset, and the queue is scanned from the head. Transactions that
+ * are already attested are added to the caches and advance the cursor.
+ *
+ * \param inst              The attestation service instance.
+ * \param child_context     The child context to use for this operation.
+ * \param txn_node          The transaction node to return.
+ * \param txn_data          The transaction data to return.
+ * \param txn_data_size     The size of the returned transaction data.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_DATASERVICE_NOT_FOUND if there are no transactions past
+ *        the cursor.
+ *      - a non-zero error code on failure.
+ */
+status attestationservice_dataservice_query_resume_transaction(
+    attestationservice_instance* inst, uint32_t child_context,
+    data_transaction_node_t* txn_node, void** txn_data, size_t* txn_data_size);
+
+/**
+ * \brief Prefetch a batch of submitted transactions that follow the
+ * attestation cursor.
+ *
+ * The batch ends at the end of the process queue, at the first transaction
+ * that is not in the submitted state, or when \p max_count transactions have
+ * been read.
+ *
+ * \param inst              The attestation service instance.
+ * \param child_context     The child context to use for this operation.
+ * \param batch             The batch array to fill.
+ * \param max_count         The capacity of the batch array.
+ * \param count             Pointer to receive the number of transactions read.
+ * \param more              Pointer to a flag set to true if the batch filled
+ *                          up before the end of the queue.
+ *
+ * \note On success, the caller owns the transaction data in each of the first
+ * \p count batch entries.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status attestationservice_dataservice_query_pending_batch(
+    attestationservice_instance* inst, uint32_t child_context,
+    attestationservice_pending_transaction* batch, size_t max_count,
+    size_t* count, bool* more);
+
 /**
  * \brief Query the data service for an artifact record by artifact id.
  *
@@ -294,19 +431,21 @@ status attestationservice_update_or_insert_artifact(
     artifact_record_value* artifact);
 
 /**
- * \brief Promote a transaction to attested.
+ * \brief Promote or drop each transaction in a batch, based on its verify
+ * status, under a single dataservice request.
  *
  * \param inst              The attestation service instance.
  * \param child_context     The child context to use for this operation.
- * \param txn_node          The transaction node to promote.
+ * \param batch             The batch of verified transactions.
+ * \param count             The number of transactions in the batch.
  *
  * \returns a status code indicating success or failure.
  *      - STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
-status attestationservice_dataservice_transaction_promote(
+status attestationservice_dataservice_transaction_batch_update(
     attestationservice_instance* inst, uint32_t child_context,
-    const data_transaction_node_t* txn_node);
+    const attestationservice_pending_transaction* batch, size_t count);
 
 /**
  * \brief Add a transaction to the red-black tree.
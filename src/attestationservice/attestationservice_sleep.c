@@ -18,20 +18,26 @@ RCPR_IMPORT_psock;
  *
  * \param sleep_sock    Socket for sleep thread communication.
  * \param sleep_time    Sleep time in microseconds.
+ * \param woken         Set to true if a submit wakeup ended the sleep early.
  *
  * \returns a status code on success or failure.
  *      - STATUS_SUCCESS on success.
  *      - a non-zero failure code on failure.
  */
-status attestationservice_sleep(psock* sleep_sock, uint64_t sleep_time)
+status attestationservice_sleep(
+    psock* sleep_sock, uint64_t sleep_time, bool* woken)
 {
     status retval;
+    uint64_t wake_reason;
 
     /* send a sleep request to the sleep thread. */
     TRY_OR_FAIL(psock_write_boxed_uint64(sleep_sock, sleep_time), done);
 
     /* receive a wake-up response from the sleep thread. */
-    TRY_OR_FAIL(psock_read_boxed_uint64(sleep_sock, &sleep_time), done);
+    TRY_OR_FAIL(psock_read_boxed_uint64(sleep_sock, &wake_reason), done);
+
+    /* the sleep thread reports whether a submit ended the sleep early. */
+    *woken = (ATTESTATIONSERVICE_WAKE_REASON_SUBMIT == wake_reason);
 
 done:
     return retval;
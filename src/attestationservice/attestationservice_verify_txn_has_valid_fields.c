@@ -24,6 +24,9 @@
 /**
  * \brief Verify that the given transaction has valid fields.
  *
+ * This check runs on worker threads, so it must only read the instance and
+ * must not use its allocator or sockets.
+ *
  * \param inst              The attestation service instance.
  * \param txn_node          The transaction node.
  * \param txn_data          The transaction data.
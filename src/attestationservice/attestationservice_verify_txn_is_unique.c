@@ -4,7 +4,7 @@
  * \brief Verify that the given transaction id is unique, and the artifact id is
  * unique.
  *
- * \copyright 2021 Velo Payments, Inc.  All rights reserved.
+ * \copyright 2021-2022 Velo Payments, Inc.  All rights reserved.
  */
 
 #include <agentd/control.h>
@@ -17,10 +17,16 @@
 #include <cbmc/model_assert.h>
 #include <errno.h>
 #include <signal.h>
+#include <string.h>
 #include <vpr/parameters.h>
 
 #include "attestationservice_internal.h"
 
+/* forward decls. */
+static status attestationservice_verify_id_is_unique(
+    attestationservice_instance* inst, uint32_t child_context,
+    const uint8_t* id);
+
 /**
  * \brief Verify that the given transaction id / artifact id is unique.
  *
@@ -32,6 +38,8 @@
  *
  * \returns a status code indicating success or failure.
  *      - STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_ATTESTATIONSERVICE_DUPLICATE_ID if the transaction id,
+ *        or the artifact id of a create transaction, is already in use.
  *      - a non-zero error code on failure.
  */
 status attestationservice_verify_txn_is_unique(
@@ -39,12 +47,81 @@ status attestationservice_verify_txn_is_unique(
     const data_transaction_node_t* txn_node,
     const void* txn_data, size_t txn_data_size)
 {
-    /* TODO - fill out. */
-    (void)inst;
-    (void)child_context;
-    (void)txn_node;
+    status retval;
+    const uint8_t zero_uuid[16] = { 0 };
+
     (void)txn_data;
     (void)txn_data_size;
 
-    return -1;
+    /* the transaction id must not be in use. */
+    TRY_OR_FAIL(
+        attestationservice_verify_id_is_unique(
+            inst, child_context, txn_node->key),
+        done);
+
+    /* a create transaction must also introduce a new artifact id. */
+    if (!memcmp(txn_node->prev, zero_uuid, 16))
+    {
+        TRY_OR_FAIL(
+            attestationservice_verify_id_is_unique(
+                inst, child_context, txn_node->artifact_id),
+            done);
+    }
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    goto done;
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Verify that the given id is not in use as a block, transaction, or
+ * artifact id.
+ *
+ * \param inst              The attestation service instance.
+ * \param child_context     The data service child context.
+ * \param id                The id to check.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS if this id is not in use.
+ *      - AGENTD_ERROR_ATTESTATIONSERVICE_DUPLICATE_ID if this id is in use.
+ *      - a non-zero error code on failure.
+ */
+static status attestationservice_verify_id_is_unique(
+    attestationservice_instance* inst, uint32_t child_context,
+    const uint8_t* id)
+{
+    status retval;
+    uint32_t status, offset;
+
+    /* send an id exists request to the data service. */
+    TRY_OR_FAIL(
+        dataservice_api_sendreq_id_exists(
+            inst->data_sock, &inst->vpr_alloc, child_context, id),
+        done);
+
+    /* get the response for this request. */
+    TRY_OR_FAIL(
+        dataservice_api_recvresp_id_exists(
+            inst->data_sock, inst->alloc, &offset, &status),
+        done);
+
+    /* an id that was not found is unique. */
+    if (AGENTD_ERROR_DATASERVICE_NOT_FOUND == status)
+    {
+        retval = STATUS_SUCCESS;
+        goto done;
+    }
+
+    /* verify that this request succeeded. */
+    TRY_OR_FAIL(status, done);
+
+    /* the id is already in use. */
+    retval = AGENTD_ERROR_ATTESTATIONSERVICE_DUPLICATE_ID;
+    goto done;
+
+done:
+    return retval;
 }
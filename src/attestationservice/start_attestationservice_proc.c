@@ -35,6 +35,8 @@
  *                          data service.
  * \param controlsock       Pointer to the socket used to control the
  *                          attestation service.
+ * \param wakeupsock        Pointer to the datagram socket on which protocol
+ *                          services signal transaction submits.
  * \param attestationpid    Pointer to the attestation service pid, to be
  *                          updated on the successful completion of this
  *                          function.
@@ -65,7 +67,8 @@
  */
 int start_attestationservice_proc(
     const bootstrap_config_t* bconf, const agent_config_t* conf, int* logsock,
-    int* datasock, int* controlsock, pid_t* attestationpid, bool runsecure)
+    int* datasock, int* controlsock, int* wakeupsock, pid_t* attestationpid,
+    bool runsecure)
 {
     int retval = 1;
     uid_t uid;
@@ -136,7 +139,7 @@ int start_attestationservice_proc(
         /* move the fds out of the way. */
         if (AGENTD_STATUS_SUCCESS !=
             privsep_protect_descriptors(
-                logsock, datasock, controlsock, NULL))
+                logsock, datasock, controlsock, wakeupsock, NULL))
         {
             retval = AGENTD_ERROR_CONFIG_PRIVSEP_SETFDS_FAILURE;
             goto done;
@@ -157,6 +160,7 @@ int start_attestationservice_proc(
                 *logsock, /* ==> */ AGENTD_FD_ATTESTATION_SVC_LOG,
                 *datasock, /* ==> */ AGENTD_FD_ATTESTATION_SVC_DATA,
                 *controlsock, /* ==> */ AGENTD_FD_ATTESTATION_SVC_CONTROL,
+                *wakeupsock, /* ==> */ AGENTD_FD_ATTESTATION_SVC_WAKEUP,
                 -1);
         if (0 != retval)
         {
@@ -167,7 +171,7 @@ int start_attestationservice_proc(
 
         /* close any socket above the given value. */
         retval =
-            privsep_close_other_fds(AGENTD_FD_ATTESTATION_SVC_CONTROL);
+            privsep_close_other_fds(AGENTD_FD_ATTESTATION_SVC_WAKEUP);
         if (0 != retval)
         {
             perror("privsep_close_other_fds");
@@ -79,6 +79,9 @@ int auth_service_instance_init(auth_service_instance_t* inst, int auth)
         goto dispose_privkey;
     }
 
+    /* requests on this socket may carry key material; clear them. */
+    ipc_socket_set_secure_zero(&inst->auth, true);
+
     /* initialize the IPC event loop instance. */
     inst->loop = (ipc_event_loop_context_t*)allocate(
         &inst->alloc_opts, sizeof(ipc_event_loop_context_t));
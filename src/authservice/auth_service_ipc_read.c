@@ -46,7 +46,7 @@ void auth_service_ipc_read(
     /* loop until the read buffer is empty. */
     do {
         /* attempt to read a request. */
-        retval = ipc_read_data_noblock(ctx, &req, &size);
+        retval = ipc_read_data_view_noblock(ctx, &req, &size);
         switch (retval)
         {
             /* on success, decode and dispatch. */
@@ -57,9 +57,11 @@ void auth_service_ipc_read(
                     auth_service_exit_event_loop(instance);
                 }
 
-                /* clear and free the request data. */
-                memset(req, 0, size);
-                free(req);
+                /* return the request view to the read buffer. */
+                if (AGENTD_STATUS_SUCCESS != ipc_read_data_view_release(ctx))
+                {
+                    auth_service_exit_event_loop(instance);
+                }
                 break;
 
             /* Wait for more data on the socket. */
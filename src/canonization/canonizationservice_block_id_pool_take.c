@@ -0,0 +1,47 @@
+/**
+ * \file canonization/canonizationservice_block_id_pool_take.c
+ *
+ * \brief Take the next block id from the block id pool.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/canonizationservice.h>
+#include <agentd/status_codes.h>
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "canonizationservice_internal.h"
+
+/**
+ * \brief Take the next block id from the block id pool and request a child
+ * context for the block.
+ *
+ * \param instance      The canonization service instance.  Its block id pool
+ *                      must hold at least one block id.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - a non-zero return code on failure.
+ */
+int canonizationservice_block_id_pool_take(
+    canonizationservice_instance_t* instance)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != instance);
+    MODEL_ASSERT(
+        instance->block_id_pool_avail >= sizeof(instance->block_id));
+
+    /* take the block id from the top of the pool. */
+    instance->block_id_pool_avail -= sizeof(instance->block_id);
+    uint8_t* next = instance->block_id_pool + instance->block_id_pool_avail;
+    memcpy(instance->block_id, next, sizeof(instance->block_id));
+
+    /* a block id must never be handed out twice. */
+    memset(next, 0, sizeof(instance->block_id));
+
+    /* create the child context. */
+    return
+        canonizationservice_dataservice_sendreq_child_context_create(instance);
+}
@@ -9,7 +9,6 @@
 #include <agentd/ipc.h>
 #include <agentd/status_codes.h>
 #include <cbmc/model_assert.h>
-#include <string.h>
 #include <vpr/parameters.h>
 
 #include "canonizationservice_internal.h"
@@ -40,7 +39,7 @@ void canonizationservice_control_read(
         return;
 
     /* attempt to read a request. */
-    retval = ipc_read_data_noblock(ctx, &req, &size);
+    retval = ipc_read_data_view_noblock(ctx, &req, &size);
     switch (retval)
     {
         /* on success, decode and dispatch. */
@@ -53,9 +52,11 @@ void canonizationservice_control_read(
                 canonizationservice_exit_event_loop(instance);
             }
 
-            /* clear and free the request data. */
-            memset(req, 0, size);
-            free(req);
+            /* return the request view to the read buffer. */
+            if (AGENTD_STATUS_SUCCESS != ipc_read_data_view_release(ctx))
+            {
+                canonizationservice_exit_event_loop(instance);
+            }
             break;
 
         /* wait for more data on the socket. */
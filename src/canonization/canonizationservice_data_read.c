@@ -12,6 +12,7 @@
 #include <agentd/status_codes.h>
 #include <arpa/inet.h>
 #include <cbmc/model_assert.h>
+#include <string.h>
 #include <vpr/parameters.h>
 
 #include "canonizationservice_internal.h"
@@ -43,7 +44,7 @@ void canonizationservice_data_read(
         return;
 
     /* attempt to read a response packet. */
-    int retval = ipc_read_data_noblock(ctx, (void**)&resp, &resp_size);
+    int retval = ipc_read_data_view_noblock(ctx, (void**)&resp, &resp_size);
     if (AGENTD_ERROR_IPC_WOULD_BLOCK == retval)
     {
         return;
@@ -63,7 +64,9 @@ void canonizationservice_data_read(
     }
 
     /* decode the method. */
-    uint32_t method = ntohl(resp[0]);
+    uint32_t net_method;
+    memcpy(&net_method, resp, sizeof(net_method));
+    uint32_t method = ntohl(net_method);
 
     /* dispatch the method. */
     switch (method)
@@ -86,9 +89,9 @@ void canonizationservice_data_read(
                 instance, resp, resp_size);
             break;
 
-        /* handle transaction pq read. */
-        case DATASERVICE_API_METHOD_APP_PQ_TRANSACTION_READ:
-            canonizationservice_dataservice_response_transaction_read(
+        /* handle transaction pq list read. */
+        case DATASERVICE_API_METHOD_APP_PQ_TRANSACTION_LIST_READ:
+            canonizationservice_dataservice_response_transaction_list_read(
                 instance, resp, resp_size);
             break;
 
@@ -118,6 +121,9 @@ void canonizationservice_data_read(
     }
 
 cleanup_resp:
-    memset(resp, 0, resp_size);
-    free(resp);
+    /* return the response view to the read buffer. */
+    if (AGENTD_STATUS_SUCCESS != ipc_read_data_view_release(ctx))
+    {
+        canonizationservice_exit_event_loop(instance);
+    }
 }
@@ -99,23 +99,17 @@ void canonizationservice_dataservice_response_transaction_first_read(
         goto done;
     }
 
-    /* send the request to read the first transaction from the transaction
-     * process queue. */
+    /* send the request to read the rest of the block's transactions from the
+     * transaction process queue. */
     retval =
-        dataservice_api_sendreq_transaction_get_old(
-            instance->data, &instance->alloc_opts, instance->data_child_context,
-            txn->node.next);
+        canonizationservice_dataservice_sendreq_transaction_list_get(
+            instance, txn->node.next);
     if (AGENTD_STATUS_SUCCESS != retval)
     {
         canonizationservice_exit_event_loop(instance);
         goto done;
     }
 
-    /* set the write callback for the dataservice socket. */
-    ipc_set_writecb_noblock(
-        instance->data, &canonizationservice_data_write,
-        instance->loop_context);
-
     /* success. */
     goto done;
 
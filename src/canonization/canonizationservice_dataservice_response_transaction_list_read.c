@@ -0,0 +1,138 @@
+/**
+ * \file
+ * canonization/canonizationservice_dataservice_response_transaction_list_read.c
+ *
+ * \brief Handle the response from the data service transaction list read call.
+ *
+ * \copyright 2020-2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/canonizationservice.h>
+#include <agentd/canonizationservice/api.h>
+#include <agentd/dataservice/api.h>
+#include <agentd/dataservice/async_api.h>
+#include <agentd/status_codes.h>
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "canonizationservice_internal.h"
+
+/**
+ * \brief Handle the response from the data service transaction list read.
+ *
+ * \param instance      The canonization service instance.
+ * \param resp          The response from the data service.
+ * \param resp_size     The size of the response from the data service.
+ */
+void canonizationservice_dataservice_response_transaction_list_read(
+    canonizationservice_instance_t* instance, const uint32_t* resp,
+    const size_t resp_size)
+{
+    int retval;
+    dataservice_response_transaction_list_get_t dresp;
+    canonizationservice_transaction_t* txn = NULL;
+
+    /* decode the response. */
+    retval =
+        dataservice_decode_response_transaction_list_get(
+            resp, resp_size, &dresp);
+    if (AGENTD_STATUS_SUCCESS != retval || (AGENTD_STATUS_SUCCESS != dresp.hdr.status && AGENTD_ERROR_DATASERVICE_NOT_FOUND != dresp.hdr.status))
+    {
+        canonizationservice_exit_event_loop(instance);
+        goto done;
+    }
+    else if (AGENTD_STATUS_SUCCESS == retval && AGENTD_ERROR_DATASERVICE_NOT_FOUND == dresp.hdr.status)
+    {
+        canonizationservice_block_make(instance);
+        goto done;
+    }
+
+    /* add each entry in this run of transactions to the block. */
+    const void* entries = dresp.data;
+    size_t entries_size = dresp.data_size;
+    while (entries_size > 0U)
+    {
+        data_transaction_node_t node;
+        const void* cert;
+        size_t cert_size;
+
+        /* decode the next entry. */
+        retval =
+            dataservice_decode_response_transaction_list_get_entry(
+                &entries, &entries_size, &node, &cert, &cert_size);
+        if (AGENTD_STATUS_SUCCESS != retval)
+        {
+            canonizationservice_exit_event_loop(instance);
+            goto done;
+        }
+
+        /* if this transaction has not yet been attested, then we are done. */
+        if (DATASERVICE_TRANSACTION_NODE_STATE_ATTESTED !=
+            ntohl(node.net_txn_state))
+        {
+            canonizationservice_block_make(instance);
+            goto done;
+        }
+
+        /* create a transaction instance to hold this txn. */
+        txn =
+            (canonizationservice_transaction_t*)malloc(
+                sizeof(canonizationservice_transaction_t) + cert_size);
+        if (NULL == txn)
+        {
+            canonizationservice_exit_event_loop(instance);
+            goto done;
+        }
+
+        /* set the disposer. */
+        txn->hdr.dispose = &canonizationservice_transaction_dispose;
+
+        /* copy the node data. */
+        memcpy(&txn->node, &node, sizeof(txn->node));
+
+        /* copy the certificate. */
+        txn->cert_size = cert_size;
+        memcpy(&txn->cert, cert, txn->cert_size);
+
+        /* insert this transaction into the transaction list. */
+        retval = linked_list_insert_end(instance->transaction_list, txn);
+        if (AGENTD_STATUS_SUCCESS != retval)
+        {
+            dispose((disposable_t*)txn);
+            free(txn);
+
+            canonizationservice_exit_event_loop(instance);
+            goto done;
+        }
+
+        /* if we've reached our max count, we're done. */
+        if (instance->transaction_list->elements == instance->block_max_transactions)
+        {
+            canonizationservice_block_make(instance);
+            goto done;
+        }
+
+        /* if the next node is the end node, we're done. */
+        if (dataservice_api_node_ref_is_end(txn->node.next))
+        {
+            canonizationservice_block_make(instance);
+            goto done;
+        }
+    }
+
+    /* the data service returned fewer transactions than requested, so read
+     * the next run from the transaction process queue. */
+    retval =
+        canonizationservice_dataservice_sendreq_transaction_list_get(
+            instance, txn->node.next);
+    if (AGENTD_STATUS_SUCCESS != retval)
+    {
+        canonizationservice_exit_event_loop(instance);
+        goto done;
+    }
+
+    /* success. */
+    goto done;
+
+done:;
+}
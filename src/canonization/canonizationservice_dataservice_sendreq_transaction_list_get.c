@@ -0,0 +1,67 @@
+/**
+ * \file canonization/canonizationservice_dataservice_sendreq_transaction_list_get.c
+ *
+ * \brief Send the transaction process queue list get request to the data
+ * service from the canonization service.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/dataservice/api.h>
+#include <agentd/status_codes.h>
+#include <cbmc/model_assert.h>
+
+#include "canonizationservice_internal.h"
+
+/**
+ * \brief Send a transaction process queue list get request to the data
+ * service, for as many transactions as the current block can still hold.
+ *
+ * \param instance      The canonization service instance.
+ * \param txn_id        The id of the first transaction to read.
+ */
+int canonizationservice_dataservice_sendreq_transaction_list_get(
+    canonizationservice_instance_t* instance, const uint8_t* txn_id)
+{
+    int retval;
+
+    /* parameter sanity check. */
+    MODEL_ASSERT(NULL != instance);
+    MODEL_ASSERT(NULL != txn_id);
+    MODEL_ASSERT(
+        instance->transaction_list->elements
+            < instance->block_max_transactions);
+
+    /* evolve the state of the canonization service; we now want to read the
+     * rest of the block's transactions from the process queue. */
+    instance->state = CANONIZATIONSERVICE_STATE_WAITRESP_PQ_TXN_LIST_GET;
+
+    /* request only as many transactions as the block can still hold; the
+     * data service may return fewer. */
+    uint32_t max_count =
+        (uint32_t)(
+            instance->block_max_transactions
+                - instance->transaction_list->elements);
+
+    /* send the request to read the next run of transactions from the
+     * transaction process queue. */
+    retval =
+        dataservice_api_sendreq_transaction_list_get_old(
+            instance->data, &instance->alloc_opts,
+            instance->data_child_context, txn_id, max_count);
+    if (AGENTD_STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* set the write callback for the dataservice socket. */
+    ipc_set_writecb_noblock(
+        instance->data, &canonizationservice_data_write,
+        instance->loop_context);
+
+    /* success. */
+    retval = AGENTD_STATUS_SUCCESS;
+
+done:
+    return retval;
+}
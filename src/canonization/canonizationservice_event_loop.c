@@ -79,6 +79,9 @@ int canonizationservice_event_loop(
         goto cleanup_instance;
     }
 
+    /* control requests may carry the private key; clear them. */
+    ipc_socket_set_secure_zero(&control, true);
+
     /* set the data socket to non-blocking. */
     if (AGENTD_STATUS_SUCCESS !=
         ipc_make_noblock(datasock, &data, instance))
@@ -101,6 +104,9 @@ int canonizationservice_event_loop(
     /* save the random socket context for use by instance methods. */
     instance->random = &random;
 
+    /* block ids are drawn from these responses; clear them. */
+    ipc_socket_set_secure_zero(&random, true);
+
     /* set the notify socket to non-blocking. */
     if (AGENTD_STATUS_SUCCESS !=
         ipc_make_noblock(notifysock, &notify, instance))
@@ -22,6 +22,11 @@
 extern "C" {
 #endif  //__cplusplus
 
+/**
+ * \brief The number of block ids fetched from the random service at a time.
+ */
+#define CANONIZATIONSERVICE_BLOCK_ID_POOL_COUNT 256
+
 /* forward declaration for canonizationservice_transaction_t */
 struct canonizationservice_transaction;
 typedef struct canonizationservice_transaction
@@ -58,6 +63,8 @@ typedef struct canonizationservice_instance
     vccert_builder_options_t builder_opts;
     linked_list_options_t transaction_list_opts;
     uint8_t block_id[16];
+    uint8_t block_id_pool[CANONIZATIONSERVICE_BLOCK_ID_POOL_COUNT * 16];
+    size_t block_id_pool_avail;
     uint8_t previous_block_id[16];
     uint8_t previous_block_signature[64];
     uint64_t block_height;
@@ -80,7 +87,7 @@ enum canonizationservice_state
     CANONIZATIONSERVICE_STATE_WAITRESP_LATEST_BLOCK_ID_GET,
     CANONIZATIONSERVICE_STATE_WAITRESP_BLOCK_GET,
     CANONIZATIONSERVICE_STATE_WAITRESP_PQ_TXN_FIRST_GET,
-    CANONIZATIONSERVICE_STATE_WAITRESP_PQ_TXN_GET,
+    CANONIZATIONSERVICE_STATE_WAITRESP_PQ_TXN_LIST_GET,
     CANONIZATIONSERVICE_STATE_WAITRESP_BLOCK_MAKE,
     CANONIZATIONSERVICE_STATE_WAITRESP_NOTIFY_BLOCK_UPDATE,
     CANONIZATIONSERVICE_STATE_WAITRESP_CHILD_CONTEXT_CLOSE
@@ -268,6 +275,10 @@ int canonizationservice_decode_and_dispatch_write_status(
 /**
  * \brief Write a request to the random service to generate a block id.
  *
+ * Block ids are fetched from the random service in bulk.  If a pooled block id
+ * is available, it is used immediately and the child context request is sent
+ * without a round trip to the random service.
+ *
  * \param instance      The canonization service instance.
  *
  * \returns a status code indicating success or failure.
@@ -277,6 +288,20 @@ int canonizationservice_decode_and_dispatch_write_status(
 int canonizationservice_write_block_id_request(
     canonizationservice_instance_t* instance);
 
+/**
+ * \brief Take the next block id from the block id pool and request a child
+ * context for the block.
+ *
+ * \param instance      The canonization service instance.  Its block id pool
+ *                      must hold at least one block id.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - a non-zero return code on failure.
+ */
+int canonizationservice_block_id_pool_take(
+    canonizationservice_instance_t* instance);
+
 /**
  * \brief Handle read events on the control socket.
  *
@@ -394,13 +419,13 @@ void canonizationservice_dataservice_response_transaction_first_read(
     const size_t resp_size);
 
 /**
- * \brief Handle the response from the data service transaction read.
+ * \brief Handle the response from the data service transaction list read.
  *
  * \param instance      The canonization service instance.
  * \param resp          The response from the data service.
  * \param resp_size     The size of the response from the data service.
  */
-void canonizationservice_dataservice_response_transaction_read(
+void canonizationservice_dataservice_response_transaction_list_read(
     canonizationservice_instance_t* instance, const uint32_t* resp,
     const size_t resp_size);
 
@@ -454,6 +479,16 @@ int canonizationservice_dataservice_sendreq_child_context_create(
 int canonizationservice_dataservice_sendreq_transaction_get_first(
     canonizationservice_instance_t* instance);
 
+/**
+ * \brief Send a transaction process queue list get request to the data
+ * service, for as many transactions as the current block can still hold.
+ *
+ * \param instance      The canonization service instance.
+ * \param txn_id        The id of the first transaction to read.
+ */
+int canonizationservice_dataservice_sendreq_transaction_list_get(
+    canonizationservice_instance_t* instance, const uint8_t* txn_id);
+
 /**
  * \brief Send a request to get the latest block id from the data service.
  *
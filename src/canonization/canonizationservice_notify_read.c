@@ -48,7 +48,7 @@ void canonizationservice_notify_read(
         return;
 
     /* attempt to read a response packet. */
-    int retval = ipc_read_data_noblock(ctx, (void**)&resp, &resp_size);
+    int retval = ipc_read_data_view_noblock(ctx, (void**)&resp, &resp_size);
     if (AGENTD_ERROR_IPC_WOULD_BLOCK == retval)
     {
         goto done;
@@ -94,8 +94,11 @@ void canonizationservice_notify_read(
     /* success. */
 
 cleanup_resp:
-    memset(resp, 0, resp_size);
-    free(resp);
+    /* return the response view to the read buffer. */
+    if (AGENTD_STATUS_SUCCESS != ipc_read_data_view_release(ctx))
+    {
+        canonizationservice_exit_event_loop(instance);
+    }
 
 done:;
 }
@@ -12,6 +12,7 @@
 #include <agentd/status_codes.h>
 #include <arpa/inet.h>
 #include <cbmc/model_assert.h>
+#include <string.h>
 #include <vpr/parameters.h>
 
 #include "canonizationservice_internal.h"
@@ -26,7 +27,7 @@
 void canonizationservice_random_read(
     ipc_socket_context_t* ctx, int UNUSED(event_flags), void* user_context)
 {
-    uint32_t* resp = NULL;
+    uint8_t* resp = NULL;
     uint32_t resp_size = 0U;
 
     /* get the instance from the user context. */
@@ -43,7 +44,7 @@ void canonizationservice_random_read(
         return;
 
     /* attempt to read a response packet. */
-    int retval = ipc_read_data_noblock(ctx, (void**)&resp, &resp_size);
+    int retval = ipc_read_data_view_noblock(ctx, (void**)&resp, &resp_size);
     if (AGENTD_ERROR_IPC_WOULD_BLOCK == retval)
     {
         goto done;
@@ -69,26 +70,32 @@ void canonizationservice_random_read(
         goto cleanup_resp;
     }
 
-    uint32_t method_id = ntohl(resp[0]);
-    //uint32_t offset = ntohl(resp[1]);
-    uint32_t status = ntohl(resp[2]);
-    void* data = (void*)(resp + 3);
+    /* the view may be unaligned, so copy out the header. */
+    uint32_t net_hdr[3];
+    memcpy(net_hdr, resp, sizeof(net_hdr));
+
+    uint32_t method_id = ntohl(net_hdr[0]);
+    //uint32_t offset = ntohl(net_hdr[1]);
+    uint32_t status = ntohl(net_hdr[2]);
+    void* data = (void*)(resp + sizeof(net_hdr));
     size_t data_size = resp_size - 3 * sizeof(uint32_t);
 
     /* sanity check of response from random read. */
     if (
-        method_id != RANDOMSERVICE_API_METHOD_GET_RANDOM_BYTES || status != AGENTD_STATUS_SUCCESS || data_size != 16)
+        method_id != RANDOMSERVICE_API_METHOD_GET_RANDOM_BYTES_BULK
+     || status != AGENTD_STATUS_SUCCESS
+     || data_size != sizeof(instance->block_id_pool))
     {
         canonizationservice_exit_event_loop(instance);
         goto cleanup_resp;
     }
 
-    /* save the new block UUID. */
-    memcpy(instance->block_id, data, 16);
+    /* refill the block id pool. */
+    memcpy(instance->block_id_pool, data, data_size);
+    instance->block_id_pool_avail = data_size;
 
-    /* create the child context. */
-    retval =
-        canonizationservice_dataservice_sendreq_child_context_create(instance);
+    /* take the new block UUID and create the child context. */
+    retval = canonizationservice_block_id_pool_take(instance);
     if (AGENTD_STATUS_SUCCESS != retval)
     {
         canonizationservice_exit_event_loop(instance);
@@ -98,8 +105,11 @@ void canonizationservice_random_read(
     /* success. */
 
 cleanup_resp:
-    memset(resp, 0, resp_size);
-    free(resp);
+    /* return the response view to the read buffer. */
+    if (AGENTD_STATUS_SUCCESS != ipc_read_data_view_release(ctx))
+    {
+        canonizationservice_exit_event_loop(instance);
+    }
 
 done:;
 }
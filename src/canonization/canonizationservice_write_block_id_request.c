@@ -18,6 +18,10 @@
 /**
  * \brief Write a request to the random service to generate a block id.
  *
+ * Block ids are fetched from the random service in bulk.  If a pooled block id
+ * is available, it is used immediately and the child context request is sent
+ * without a round trip to the random service.
+ *
  * \param instance      The canonization service instance.
  *
  * \returns a status code indicating success or failure.
@@ -27,11 +31,20 @@
 int canonizationservice_write_block_id_request(
     canonizationservice_instance_t* instance)
 {
-    /* TODO - replace with random API method. */
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != instance);
+
+    /* use a pooled block id if one is available. */
+    if (instance->block_id_pool_avail >= sizeof(instance->block_id))
+    {
+        return canonizationservice_block_id_pool_take(instance);
+    }
+
+    /* otherwise, refill the whole pool with one bulk request. */
     uint32_t payload[3] = {
-        htonl(RANDOMSERVICE_API_METHOD_GET_RANDOM_BYTES),
+        htonl(RANDOMSERVICE_API_METHOD_GET_RANDOM_BYTES_BULK),
         htonl(0),
-        htonl(16)
+        htonl(sizeof(instance->block_id_pool))
     };
 
     /* attempt to write the request payload to the random socket. */
@@ -26,7 +26,8 @@ void private_command_attestationservice(bootstrap_config_t* UNUSED(bconf))
         attestationservice_entry_point(
             AGENTD_FD_ATTESTATION_SVC_DATA,
             AGENTD_FD_ATTESTATION_SVC_LOG,
-            AGENTD_FD_ATTESTATION_SVC_CONTROL);
+            AGENTD_FD_ATTESTATION_SVC_CONTROL,
+            AGENTD_FD_ATTESTATION_SVC_WAKEUP);
 
     /* exit with the return code from the event loop. */
     exit(retval);
@@ -7,6 +7,7 @@
  */
 
 #include <agentd/command.h>
+#include <agentd/inet.h>
 #include <agentd/listenservice.h>
 #include <agentd/fds.h>
 #include <cbmc/model_assert.h>
@@ -18,12 +19,15 @@
  */
 void private_command_listenservice(bootstrap_config_t* UNUSED(bconf))
 {
+    /* the listen sockets start after the accept sockets. */
+    int acceptcount = inet_count_sockets(AGENTD_FD_LISTENSERVICE_ACCEPT);
+
     /* run the event loop for the listen service. */
     int retval =
         listenservice_event_loop(
             AGENTD_FD_LISTENSERVICE_LOG,
             AGENTD_FD_LISTENSERVICE_ACCEPT,
-            AGENTD_FD_LISTENSERVICE_SOCK_START);
+            AGENTD_FD_LISTENSERVICE_SOCK_START(acceptcount));
 
     /* exit with the return code from the event loop. */
     exit(retval);
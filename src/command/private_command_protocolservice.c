@@ -30,7 +30,9 @@ void private_command_protocolservice(bootstrap_config_t* UNUSED(bconf))
             AGENTD_FD_UNAUTHORIZED_PROTOSVC_CONTROL,
             AGENTD_FD_UNAUTHORIZED_PROTOSVC_DATA,
             AGENTD_FD_UNAUTHORIZED_PROTOSVC_LOG,
-            AGENTD_FD_UNAUTHORIZED_PROTOSVC_NOTIFY);
+            AGENTD_FD_UNAUTHORIZED_PROTOSVC_NOTIFY,
+            AGENTD_FD_UNAUTHORIZED_PROTOSVC_ATTESTATION_WAKEUP,
+            AGENTD_FD_UNAUTHORIZED_PROTOSVC_DATA_READER_START);
 
     /* exit with the return code from the event loop. */
     exit(retval);
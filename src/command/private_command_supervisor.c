@@ -103,38 +103,39 @@ static int supervisor_run(const bootstrap_config_t* bconf)
     int retval = AGENTD_STATUS_SUCCESS;
     allocator_options_t alloc_opts;
     agent_config_t conf;
-    process_t* random_service;
+    process_t* random_service[PROTOCOL_INSTANCES_MAXIMUM];
     process_t* random_for_canonizationservice;
     process_t* listener_service;
-    process_t* data_for_auth_protocol_service;
+    process_t* data_for_auth_protocol_service[PROTOCOL_INSTANCES_MAXIMUM];
+    process_t* data_for_protocol_readers[DATASTORE_READERS_MAXIMUM];
     process_t* data_for_canonizationservice;
     process_t* data_for_attestationservice;
     process_t* notification_service;
-    process_t* protocol_service;
+    process_t* protocol_service[PROTOCOL_INSTANCES_MAXIMUM];
     process_t* canonizationservice;
     process_t* attestationservice;
     config_public_entity_node_t* endorser_entity;
     config_public_entity_node_t* public_entities;
     config_private_key_t private_key;
 
-    int random_svc_log_sock = -1;
-    int random_svc_log_dummy_sock = -1;
+    int random_svc_log_sock[PROTOCOL_INSTANCES_MAXIMUM];
+    int random_svc_log_dummy_sock[PROTOCOL_INSTANCES_MAXIMUM];
     int random_svc_for_canonization_log_sock = -1;
     int random_svc_for_canonization_log_dummy_sock = -1;
     int listen_svc_log_sock = -1;
     int listen_svc_log_dummy_sock = -1;
-    int unauth_protocol_svc_log_sock = -1;
-    int unauth_protocol_svc_log_dummy_sock = -1;
-    int data_for_auth_protocol_svc_log_sock = -1;
-    int data_for_auth_protocol_svc_log_dummy_sock = -1;
+    int unauth_protocol_svc_log_sock[PROTOCOL_INSTANCES_MAXIMUM];
+    int unauth_protocol_svc_log_dummy_sock[PROTOCOL_INSTANCES_MAXIMUM];
+    int data_for_auth_protocol_svc_log_sock[PROTOCOL_INSTANCES_MAXIMUM];
+    int data_for_auth_protocol_svc_log_dummy_sock[PROTOCOL_INSTANCES_MAXIMUM];
     int data_for_canonization_svc_log_sock = -1;
     int data_for_canonization_svc_log_dummy_sock = -1;
     int data_for_attestation_svc_log_sock = -1;
     int data_for_attestation_svc_log_dummy_sock = -1;
-    int unauth_protocol_svc_random_sock = -1;
-    int unauth_protocol_svc_accept_sock = -1;
-    int unauth_protocol_svc_control_sock = -1;
-    int auth_protocol_svc_data_sock = -1;
+    int unauth_protocol_svc_random_sock[PROTOCOL_INSTANCES_MAXIMUM];
+    int unauth_protocol_svc_accept_sock[PROTOCOL_INSTANCES_MAXIMUM];
+    int unauth_protocol_svc_control_sock[PROTOCOL_INSTANCES_MAXIMUM];
+    int auth_protocol_svc_data_sock[PROTOCOL_INSTANCES_MAXIMUM];
     int canonization_svc_data_sock = -1;
     int canonization_svc_random_sock = -1;
     int canonization_svc_log_sock = -1;
@@ -144,10 +145,22 @@ static int supervisor_run(const bootstrap_config_t* bconf)
     int attestation_svc_log_sock = -1;
     int attestation_svc_log_dummy_sock = -1;
     int attestation_svc_control_sock = -1;
+    int attestation_svc_wakeup_sock = -1;
+    int protocol_svc_attestation_wakeup_sock = -1;
     int notification_svc_log_sock = -1;
     int notification_svc_log_dummy_sock = -1;
     int notification_svc_canonization_sock = -1;
-    int notification_svc_protocol_sock = -1;
+    int notification_svc_protocol_sock[PROTOCOL_INSTANCES_MAXIMUM];
+    int data_for_protocol_reader_log_sock[DATASTORE_READERS_MAXIMUM];
+    int data_for_protocol_reader_log_dummy_sock[DATASTORE_READERS_MAXIMUM];
+    int protocol_svc_data_reader_sock[DATASTORE_READERS_MAXIMUM];
+    size_t data_reader_count = 0;
+    size_t data_readers_created = 0;
+    size_t protocol_instance_count = 1;
+    size_t random_services_created = 0;
+    size_t data_for_auth_protocol_created = 0;
+    size_t protocol_services_created = 0;
+    size_t reader_offset = 0;
 
 #if AUTHSERVICE
     process_t* auth_service;
@@ -157,12 +170,52 @@ static int supervisor_run(const bootstrap_config_t* bconf)
     int auth_svc_log_dummy_sock = -1;
 #endif /*AUTHSERVICE*/
 
+    /* the reader pool sockets are not yet valid. */
+    for (size_t i = 0; i < DATASTORE_READERS_MAXIMUM; ++i)
+    {
+        data_for_protocol_reader_log_sock[i] = -1;
+        data_for_protocol_reader_log_dummy_sock[i] = -1;
+        protocol_svc_data_reader_sock[i] = -1;
+    }
+
+    /* the protocol service instance sockets are not yet valid. */
+    for (size_t i = 0; i < PROTOCOL_INSTANCES_MAXIMUM; ++i)
+    {
+        random_svc_log_sock[i] = -1;
+        random_svc_log_dummy_sock[i] = -1;
+        unauth_protocol_svc_log_sock[i] = -1;
+        unauth_protocol_svc_log_dummy_sock[i] = -1;
+        data_for_auth_protocol_svc_log_sock[i] = -1;
+        data_for_auth_protocol_svc_log_dummy_sock[i] = -1;
+        unauth_protocol_svc_random_sock[i] = -1;
+        unauth_protocol_svc_accept_sock[i] = -1;
+        unauth_protocol_svc_control_sock[i] = -1;
+        auth_protocol_svc_data_sock[i] = -1;
+        notification_svc_protocol_sock[i] = -1;
+    }
+
     /* create a malloc allocator. */
     malloc_allocator_options_init(&alloc_opts);
 
     /* read config. */
     TRY_OR_FAIL(config_read_proc(bconf, &conf), done);
 
+    /* get the size of the read-only data service pool. */
+    if (conf.datastore_readers_set
+     && conf.datastore_readers > 0
+     && conf.datastore_readers <= DATASTORE_READERS_MAXIMUM)
+    {
+        data_reader_count = (size_t)conf.datastore_readers;
+    }
+
+    /* get the number of protocol service instances. */
+    if (conf.protocol_instances_set
+     && conf.protocol_instances > 0
+     && conf.protocol_instances <= PROTOCOL_INSTANCES_MAXIMUM)
+    {
+        protocol_instance_count = (size_t)conf.protocol_instances;
+    }
+
     /* Spawn a process to read the public entities. */
     TRY_OR_FAIL(
         config_read_public_entities_proc(
@@ -175,11 +228,26 @@ static int supervisor_run(const bootstrap_config_t* bconf)
         cleanup_public_entities);
 
     /* TODO - replace with log service. */
-    TRY_OR_FAIL(
-        ipc_socketpair(
-            AF_UNIX, SOCK_STREAM, 0,
-            &random_svc_log_sock, &random_svc_log_dummy_sock),
-        cleanup_private_key);
+    for (size_t i = 0; i < protocol_instance_count; ++i)
+    {
+        TRY_OR_FAIL(
+            ipc_socketpair(
+                AF_UNIX, SOCK_STREAM, 0,
+                &random_svc_log_sock[i], &random_svc_log_dummy_sock[i]),
+            cleanup_private_key);
+        TRY_OR_FAIL(
+            ipc_socketpair(
+                AF_UNIX, SOCK_STREAM, 0,
+                &unauth_protocol_svc_log_sock[i],
+                &unauth_protocol_svc_log_dummy_sock[i]),
+            cleanup_private_key);
+        TRY_OR_FAIL(
+            ipc_socketpair(
+                AF_UNIX, SOCK_STREAM, 0,
+                &data_for_auth_protocol_svc_log_sock[i],
+                &data_for_auth_protocol_svc_log_dummy_sock[i]),
+            cleanup_private_key);
+    }
     TRY_OR_FAIL(
         ipc_socketpair(
             AF_UNIX, SOCK_STREAM, 0,
@@ -191,18 +259,6 @@ static int supervisor_run(const bootstrap_config_t* bconf)
             AF_UNIX, SOCK_STREAM, 0,
             &listen_svc_log_sock, &listen_svc_log_dummy_sock),
         cleanup_private_key);
-    TRY_OR_FAIL(
-        ipc_socketpair(
-            AF_UNIX, SOCK_STREAM, 0,
-            &unauth_protocol_svc_log_sock,
-            &unauth_protocol_svc_log_dummy_sock),
-        cleanup_private_key);
-    TRY_OR_FAIL(
-        ipc_socketpair(
-            AF_UNIX, SOCK_STREAM, 0,
-            &data_for_auth_protocol_svc_log_sock,
-            &data_for_auth_protocol_svc_log_dummy_sock),
-        cleanup_private_key);
     TRY_OR_FAIL(
         ipc_socketpair(
             AF_UNIX, SOCK_STREAM, 0,
@@ -233,6 +289,24 @@ static int supervisor_run(const bootstrap_config_t* bconf)
             &notification_svc_log_sock,
             &notification_svc_log_dummy_sock),
         cleanup_private_key);
+
+    /* every protocol service instance shares the write side of this socket
+     * to wake the attestation service when a transaction is submitted. */
+    TRY_OR_FAIL(
+        ipc_socketpair(
+            AF_UNIX, SOCK_DGRAM, 0,
+            &attestation_svc_wakeup_sock,
+            &protocol_svc_attestation_wakeup_sock),
+        cleanup_private_key);
+    for (size_t i = 0; i < data_reader_count; ++i)
+    {
+        TRY_OR_FAIL(
+            ipc_socketpair(
+                AF_UNIX, SOCK_STREAM, 0,
+                &data_for_protocol_reader_log_sock[i],
+                &data_for_protocol_reader_log_dummy_sock[i]),
+            cleanup_private_key);
+    }
 #if AUTHSERVICE
     TRY_OR_FAIL(
         ipc_socketpair(
@@ -242,12 +316,17 @@ static int supervisor_run(const bootstrap_config_t* bconf)
         cleanup_private_key);
 #endif /*AUTHSERVICE*/
 
-    /* create random service. */
-    TRY_OR_FAIL(
-        supervisor_create_random_service(
-            &random_service, bconf, &conf, &random_svc_log_sock,
-            &unauth_protocol_svc_random_sock),
-        cleanup_private_key);
+    /* create a random service for each protocol service instance. */
+    for (size_t i = 0; i < protocol_instance_count; ++i)
+    {
+        TRY_OR_FAIL(
+            supervisor_create_random_service(
+                &random_service[i], bconf, &conf, &random_svc_log_sock[i],
+                &unauth_protocol_svc_random_sock[i]),
+            cleanup_random_service);
+
+        ++random_services_created;
+    }
 
     /* create random service for canonization service. */
     TRY_OR_FAIL(
@@ -260,33 +339,68 @@ static int supervisor_run(const bootstrap_config_t* bconf)
     /* create listener service. */
     TRY_OR_FAIL(
         supervisor_create_listener_service(
-            &listener_service, bconf, &conf, &unauth_protocol_svc_accept_sock,
-            &listen_svc_log_sock),
+            &listener_service, bconf, &conf, unauth_protocol_svc_accept_sock,
+            protocol_instance_count, &listen_svc_log_sock),
         cleanup_random_for_canonizationservice);
 
-    /* create data service for protocol service. */
-    TRY_OR_FAIL(
-        supervisor_create_data_service_for_auth_protocol_service(
-            &data_for_auth_protocol_service, bconf, &conf,
-            &auth_protocol_svc_data_sock, &data_for_auth_protocol_svc_log_sock),
-        cleanup_listener_service);
+    /* create a data service for each protocol service instance. */
+    for (size_t i = 0; i < protocol_instance_count; ++i)
+    {
+        TRY_OR_FAIL(
+            supervisor_create_data_service_for_auth_protocol_service(
+                &data_for_auth_protocol_service[i], bconf, &conf,
+                &auth_protocol_svc_data_sock[i],
+                &data_for_auth_protocol_svc_log_sock[i]),
+            cleanup_data_for_auth_protocol_service);
+
+        ++data_for_auth_protocol_created;
+    }
+
+    /* create the read-only data service pool for the protocol service. */
+    for (size_t i = 0; i < data_reader_count; ++i)
+    {
+        TRY_OR_FAIL(
+            supervisor_create_data_service_for_protocol_service_reader(
+                &data_for_protocol_readers[i], bconf, &conf,
+                &protocol_svc_data_reader_sock[i],
+                &data_for_protocol_reader_log_sock[i]),
+            cleanup_data_for_protocol_readers);
+
+        ++data_readers_created;
+    }
 
     /* create the notification service. */
     TRY_OR_FAIL(
         supervisor_create_notification_service(
             &notification_service, bconf, &conf, &notification_svc_log_sock,
             &notification_svc_canonization_sock,
-            &notification_svc_protocol_sock),
-        cleanup_data_for_auth_protocol_service);
+            notification_svc_protocol_sock, protocol_instance_count),
+        cleanup_data_for_protocol_readers);
 
-    /* create protocol service. */
-    TRY_OR_FAIL(
-        supervisor_create_protocol_service(
-            &protocol_service, bconf, &conf, &private_key, public_entities,
-            &unauth_protocol_svc_random_sock, &unauth_protocol_svc_accept_sock,
-            &unauth_protocol_svc_control_sock, &auth_protocol_svc_data_sock,
-            &unauth_protocol_svc_log_sock, &notification_svc_protocol_sock),
-        cleanup_notification_service);
+    /* create each protocol service instance, dividing the readers evenly. */
+    for (size_t i = 0; i < protocol_instance_count; ++i)
+    {
+        size_t instance_readers =
+            data_reader_count / protocol_instance_count
+          + (i < data_reader_count % protocol_instance_count ? 1 : 0);
+
+        TRY_OR_FAIL(
+            supervisor_create_protocol_service(
+                &protocol_service[i], bconf, &conf, &private_key,
+                public_entities, &unauth_protocol_svc_random_sock[i],
+                &unauth_protocol_svc_accept_sock[i],
+                &unauth_protocol_svc_control_sock[i],
+                &auth_protocol_svc_data_sock[i],
+                &unauth_protocol_svc_log_sock[i],
+                &notification_svc_protocol_sock[i],
+                protocol_svc_attestation_wakeup_sock,
+                &protocol_svc_data_reader_sock[reader_offset],
+                instance_readers),
+            cleanup_protocol_service);
+
+        ++protocol_services_created;
+        reader_offset += instance_readers;
+    }
 
 #if AUTHSERVICE
     /* create auth service */
@@ -332,22 +446,36 @@ static int supervisor_run(const bootstrap_config_t* bconf)
         supervisor_create_attestationservice(
             &attestationservice, bconf, &conf, &private_key,
             &attestation_svc_data_sock, &attestation_svc_log_sock,
-            &attestation_svc_control_sock),
+            &attestation_svc_control_sock, &attestation_svc_wakeup_sock),
         cleanup_data_service_for_attestationservice);
 
     /* if we've made it this far, attempt to start each service. */
-    START_PROCESS(random_service, cleanup_attestationservice);
+    for (size_t i = 0; i < protocol_instance_count; ++i)
+    {
+        START_PROCESS(random_service[i], cleanup_attestationservice);
+    }
     START_PROCESS(random_for_canonizationservice, cleanup_attestationservice);
     START_PROCESS(data_for_canonizationservice, cleanup_attestationservice);
     START_PROCESS(data_for_attestationservice, quiesce_data_processes);
-    START_PROCESS(data_for_auth_protocol_service, quiesce_data_processes);
+    for (size_t i = 0; i < protocol_instance_count; ++i)
+    {
+        START_PROCESS(
+            data_for_auth_protocol_service[i], quiesce_data_processes);
+    }
+    for (size_t i = 0; i < data_reader_count; ++i)
+    {
+        START_PROCESS(data_for_protocol_readers[i], quiesce_data_processes);
+    }
     START_PROCESS(listener_service, quiesce_data_processes);
     START_PROCESS(notification_service, quiesce_data_processes);
 
 #if AUTHSERVICE
     START_PROCESS(auth_service, quiesce_data_processes);
 #endif /*AUTHSERVICE*/
-    START_PROCESS(protocol_service, quiesce_data_processes);
+    for (size_t i = 0; i < protocol_instance_count; ++i)
+    {
+        START_PROCESS(protocol_service[i], quiesce_data_processes);
+    }
     START_PROCESS(canonizationservice, quiesce_data_processes);
     START_PROCESS(attestationservice, quiesce_data_processes);
 
@@ -362,7 +490,10 @@ static int supervisor_run(const bootstrap_config_t* bconf)
     process_stop(auth_service);
 #endif /*AUTHSERVICE*/
     process_stop(listener_service);
-    process_stop(protocol_service);
+    for (size_t i = 0; i < protocol_instance_count; ++i)
+    {
+        process_stop(protocol_service[i]);
+    }
     process_stop(canonizationservice);
     process_stop(attestationservice);
     process_stop(notification_service);
@@ -371,21 +502,34 @@ static int supervisor_run(const bootstrap_config_t* bconf)
     sleep(2);
 
     process_stop_ex(random_for_canonizationservice, 0);
-    process_stop_ex(random_service, 0);
+    for (size_t i = 0; i < protocol_instance_count; ++i)
+    {
+        process_stop_ex(random_service[i], 0);
+    }
 
     /* kill these processes. */
 #if AUTHSERVICE
     process_kill(auth_service);
 #endif /*AUTHSERVICE*/
     process_kill(listener_service);
-    process_kill(protocol_service);
+    for (size_t i = 0; i < protocol_instance_count; ++i)
+    {
+        process_kill(protocol_service[i]);
+    }
     process_kill(canonizationservice);
     process_kill(attestationservice);
     process_kill(notification_service);
 
 quiesce_data_processes:
     process_stop_ex(data_for_canonizationservice, 0);
-    process_stop_ex(data_for_auth_protocol_service, 0);
+    for (size_t i = 0; i < protocol_instance_count; ++i)
+    {
+        process_stop_ex(data_for_auth_protocol_service[i], 0);
+    }
+    for (size_t i = 0; i < data_reader_count; ++i)
+    {
+        process_stop_ex(data_for_protocol_readers[i], 0);
+    }
     process_stop_ex(data_for_attestationservice, 0);
 
 cleanup_attestationservice:
@@ -406,13 +550,25 @@ cleanup_auth_service:
 #endif /*AUTHSERVICE*/
 
 cleanup_protocol_service:
-    CLEANUP_PROCESS(protocol_service);
+    for (size_t i = 0; i < protocol_services_created; ++i)
+    {
+        CLEANUP_PROCESS(protocol_service[i]);
+    }
 
 cleanup_notification_service:
     CLEANUP_PROCESS(notification_service);
 
+cleanup_data_for_protocol_readers:
+    for (size_t i = 0; i < data_readers_created; ++i)
+    {
+        CLEANUP_PROCESS(data_for_protocol_readers[i]);
+    }
+
 cleanup_data_for_auth_protocol_service:
-    CLEANUP_PROCESS(data_for_auth_protocol_service);
+    for (size_t i = 0; i < data_for_auth_protocol_created; ++i)
+    {
+        CLEANUP_PROCESS(data_for_auth_protocol_service[i]);
+    }
 
 cleanup_listener_service:
     CLEANUP_PROCESS(listener_service);
@@ -421,7 +577,10 @@ cleanup_random_for_canonizationservice:
     CLEANUP_PROCESS(random_for_canonizationservice);
 
 cleanup_random_service:
-    CLEANUP_PROCESS(random_service);
+    for (size_t i = 0; i < random_services_created; ++i)
+    {
+        CLEANUP_PROCESS(random_service[i]);
+    }
 
 cleanup_private_key:
     dispose((disposable_t*)&private_key);
@@ -441,23 +600,14 @@ cleanup_config:
     dispose((disposable_t*)&conf);
 
 done:
-    CLOSE_IF_VALID(random_svc_log_sock);
-    CLOSE_IF_VALID(random_svc_log_dummy_sock);
     CLOSE_IF_VALID(random_svc_for_canonization_log_sock);
     CLOSE_IF_VALID(random_svc_for_canonization_log_dummy_sock);
     CLOSE_IF_VALID(listen_svc_log_sock);
     CLOSE_IF_VALID(listen_svc_log_dummy_sock);
-    CLOSE_IF_VALID(unauth_protocol_svc_log_sock);
-    CLOSE_IF_VALID(unauth_protocol_svc_log_dummy_sock);
-    CLOSE_IF_VALID(data_for_auth_protocol_svc_log_sock);
-    CLOSE_IF_VALID(data_for_auth_protocol_svc_log_dummy_sock);
     CLOSE_IF_VALID(data_for_canonization_svc_log_sock);
     CLOSE_IF_VALID(data_for_canonization_svc_log_dummy_sock);
     CLOSE_IF_VALID(data_for_attestation_svc_log_sock);
     CLOSE_IF_VALID(data_for_attestation_svc_log_dummy_sock);
-    CLOSE_IF_VALID(unauth_protocol_svc_random_sock);
-    CLOSE_IF_VALID(unauth_protocol_svc_accept_sock);
-    CLOSE_IF_VALID(auth_protocol_svc_data_sock);
     CLOSE_IF_VALID(canonization_svc_data_sock);
     CLOSE_IF_VALID(canonization_svc_random_sock);
     CLOSE_IF_VALID(canonization_svc_log_sock);
@@ -467,8 +617,28 @@ done:
     CLOSE_IF_VALID(notification_svc_log_sock);
     CLOSE_IF_VALID(notification_svc_log_dummy_sock);
     CLOSE_IF_VALID(notification_svc_canonization_sock);
-    CLOSE_IF_VALID(notification_svc_protocol_sock);
     CLOSE_IF_VALID(attestation_svc_control_sock);
+    CLOSE_IF_VALID(attestation_svc_wakeup_sock);
+    CLOSE_IF_VALID(protocol_svc_attestation_wakeup_sock);
+    for (size_t i = 0; i < DATASTORE_READERS_MAXIMUM; ++i)
+    {
+        CLOSE_IF_VALID(data_for_protocol_reader_log_sock[i]);
+        CLOSE_IF_VALID(data_for_protocol_reader_log_dummy_sock[i]);
+        CLOSE_IF_VALID(protocol_svc_data_reader_sock[i]);
+    }
+    for (size_t i = 0; i < PROTOCOL_INSTANCES_MAXIMUM; ++i)
+    {
+        CLOSE_IF_VALID(random_svc_log_sock[i]);
+        CLOSE_IF_VALID(random_svc_log_dummy_sock[i]);
+        CLOSE_IF_VALID(unauth_protocol_svc_log_sock[i]);
+        CLOSE_IF_VALID(unauth_protocol_svc_log_dummy_sock[i]);
+        CLOSE_IF_VALID(data_for_auth_protocol_svc_log_sock[i]);
+        CLOSE_IF_VALID(data_for_auth_protocol_svc_log_dummy_sock[i]);
+        CLOSE_IF_VALID(unauth_protocol_svc_random_sock[i]);
+        CLOSE_IF_VALID(unauth_protocol_svc_accept_sock[i]);
+        CLOSE_IF_VALID(auth_protocol_svc_data_sock[i]);
+        CLOSE_IF_VALID(notification_svc_protocol_sock[i]);
+    }
 
 #if AUTHSERVICE
     CLOSE_IF_VALID(auth_svc_log_sock);
@@ -48,6 +48,8 @@ static agent_config_t* add_datastore(
     config_context_t*, agent_config_t*, const char*);
 static agent_config_t* add_listen(
     agent_config_t*, config_listen_address_t*);
+static agent_config_t* add_protocol_instances(
+    config_context_t*, agent_config_t*, int64_t);
 static agent_config_t* add_chroot(
     config_context_t*, agent_config_t*, const char*);
 static agent_config_t* add_usergroup(
@@ -66,6 +68,24 @@ static config_canonization_t* add_max_milliseconds(
 static config_canonization_t* add_max_transactions(
     config_context_t*, config_canonization_t*, int64_t);
 void canonization_dispose(void* disp);
+static agent_config_t* fold_attestation(
+    config_context_t*, agent_config_t*, config_attestation_t*);
+static config_attestation_t* new_attestation(
+    config_context_t*);
+static config_attestation_t* add_attestation_max_milliseconds(
+    config_context_t*, config_attestation_t*, int64_t);
+void attestation_dispose(void* disp);
+static agent_config_t* fold_datastore(
+    config_context_t*, agent_config_t*, config_datastore_t*);
+static config_datastore_t* new_datastore(
+    config_context_t*);
+static config_datastore_t* add_datastore_readers(
+    config_context_t*, config_datastore_t*, int64_t);
+static config_datastore_t* add_datastore_flag(
+    config_context_t*, config_datastore_t*, int64_t);
+static config_datastore_t* add_datastore_max_readers(
+    config_context_t*, config_datastore_t*, int64_t);
+void datastore_dispose(void* disp);
 static agent_config_t* fold_view(
     config_context_t*, agent_config_t*, config_materialized_view_t*);
 static config_materialized_view_t* view_new(
@@ -131,6 +151,7 @@ void public_key_dispose(void* disp);
 
 /* Tokens. */
 %token <string> APPEND
+%token <string> ATTESTATION
 %token <string> AUTHORIZED
 %token <string> ARTIFACT
 %token <string> CANONIZATION
@@ -144,6 +165,7 @@ void public_key_dispose(void* disp);
 %token <string> ENTITIES
 %token <string> FIELD
 %token <string> IDENTIFIER
+%token <string> INSTANCES
 %token <addr> IP
 %token <string> INVALID
 %token <string> INVALID_IP
@@ -152,12 +174,17 @@ void public_key_dispose(void* disp);
 %token <string> LISTEN
 %token <string> LOGDIR
 %token <string> LOGLEVEL
+%token <string> MAPASYNC
 %token <string> MATERIALIZED
 %token <string> MAX
+%token <string> NOMETASYNC
+%token <string> NORDAHEAD
 %token <number> NUMBER
 %token <string> PATH
 %token <string> PRIVATE
+%token <string> PROTOCOL
 %token <string> RBRACE
+%token <string> READERS
 %token <string> ROOTBLOCK
 %token <string> MILLISECONDS
 %token <string> SECRET
@@ -170,14 +197,19 @@ void public_key_dispose(void* disp);
 %token <id> UUID
 %token <id> UUID_INVALID
 %token <string> VIEW
+%token <string> WRITEMAP
 
 /* Types for branch nodes.. */
 %type <config> conf
 %type <string> chroot
 %type <canonization> canonization
 %type <canonization> canonization_block
+%type <attestation> attestation
+%type <attestation> attestation_block
 %type <number> datasize
 %type <string> datastore
+%type <datastore_block> datastore_tuning
+%type <datastore_block> datastore_tuning_block
 %type <listenaddr> listen
 %type <string> logdir
 %type <number> loglevel
@@ -185,6 +217,7 @@ void public_key_dispose(void* disp);
 %type <endorser_key> endorser_key
 %type <public_key> public_key
 %type <public_key> public_key_block
+%type <number> protocol_instances
 %type <string> rootblock
 %type <string> secret
 %type <usergroup> usergroup
@@ -224,9 +257,15 @@ conf : {
     | conf datastore {
             /* fold in datastore. */
             MAYBE_ASSIGN($$, add_datastore(context, $1, $2)); }
+    | conf datastore_tuning {
+            /* fold in datastore tuning data. */
+            MAYBE_ASSIGN($$, fold_datastore(context, $1, $2)); }
     | conf listen {
             /* fold in listen address. */
             MAYBE_ASSIGN($$, add_listen($1, $2)); }
+    | conf protocol_instances {
+            /* fold in the protocol service instance count. */
+            MAYBE_ASSIGN($$, add_protocol_instances(context, $1, $2)); }
     | conf chroot {
             /* fold in chroot. */
             MAYBE_ASSIGN($$, add_chroot(context, $1, $2)); }
@@ -236,6 +275,9 @@ conf : {
     | conf canonization {
             /* fold in canonization data. */
             MAYBE_ASSIGN($$, fold_canonization(context, $1, $2)); }
+    | conf attestation {
+            /* fold in attestation data. */
+            MAYBE_ASSIGN($$, fold_attestation(context, $1, $2)); }
     | conf view {
             /* fold in a materialized view. */
             MAYBE_ASSIGN($$, fold_view(context, $1, $2)); }
@@ -298,6 +340,46 @@ datastore
             /* ownership is forwarded. */
             $$ = $2; }
 
+/* Provide the number of protocol service instances. */
+protocol_instances
+    : PROTOCOL INSTANCES NUMBER {
+            $$ = $3; }
+
+/* Provide a datastore tuning block. */
+datastore_tuning
+    : DATASTORE LBRACE datastore_tuning_block RBRACE {
+            /* ownership is forwarded. */
+            $$ = $3; }
+    ;
+
+datastore_tuning_block
+    : {
+            /* create a new datastore tuning block. */
+            MAYBE_ASSIGN($$, new_datastore(context)); }
+    | datastore_tuning_block NOMETASYNC {
+            /* skip the meta page sync on commit. */
+            MAYBE_ASSIGN($$,
+                add_datastore_flag(context, $$, DATASTORE_FLAG_NOMETASYNC)); }
+    | datastore_tuning_block WRITEMAP {
+            /* write through a writable memory map. */
+            MAYBE_ASSIGN($$,
+                add_datastore_flag(context, $$, DATASTORE_FLAG_WRITEMAP)); }
+    | datastore_tuning_block NORDAHEAD {
+            /* turn off read-ahead on the memory map. */
+            MAYBE_ASSIGN($$,
+                add_datastore_flag(context, $$, DATASTORE_FLAG_NORDAHEAD)); }
+    | datastore_tuning_block MAPASYNC {
+            /* flush the writable memory map asynchronously. */
+            MAYBE_ASSIGN($$,
+                add_datastore_flag(context, $$, DATASTORE_FLAG_MAPASYNC)); }
+    | datastore_tuning_block READERS NUMBER {
+            /* set the number of read-only dataservice workers. */
+            MAYBE_ASSIGN($$, add_datastore_readers(context, $$, $3)); }
+    | datastore_tuning_block MAX READERS NUMBER {
+            /* override the size of the reader table. */
+            MAYBE_ASSIGN($$, add_datastore_max_readers(context, $$, $4)); }
+    ;
+
 /* Provide a chroot dir that is either a simple identifier or a path. */
 chroot
     : CHROOT PATH {
@@ -340,6 +422,23 @@ canonization_block
             MAYBE_ASSIGN($$, add_max_transactions(context, $$, $4)); }
     ;
 
+/* Provide an attestation block. */
+attestation
+    : ATTESTATION LBRACE attestation_block RBRACE {
+            /* ownership is forwarded. */
+            $$ = $3; }
+    ;
+
+attestation_block
+    : {
+            /* create a new attestation block. */
+            MAYBE_ASSIGN($$, new_attestation(context)); }
+    | attestation_block MAX MILLISECONDS NUMBER {
+            /* override the max idle milliseconds. */
+            MAYBE_ASSIGN($$,
+                add_attestation_max_milliseconds(context, $$, $4)); }
+    ;
+
 /* handle materialized view. */
 view
     : MATERIALIZED VIEW IDENTIFIER LBRACE view_block RBRACE {
@@ -608,6 +707,28 @@ static agent_config_t* add_listen(
     return cfg;
 }
 
+/**
+ * \brief Add the protocol service instance count to the config structure.
+ */
+static agent_config_t* add_protocol_instances(
+    config_context_t* context, agent_config_t* cfg, int64_t instances)
+{
+    if (cfg->protocol_instances_set)
+    {
+        CONFIG_ERROR("Duplicate protocol instances settings.");
+    }
+
+    if (instances <= 0 || instances > PROTOCOL_INSTANCES_MAXIMUM)
+    {
+        CONFIG_ERROR("Bad protocol instances value.");
+    }
+
+    cfg->protocol_instances_set = true;
+    cfg->protocol_instances = instances;
+
+    return cfg;
+}
+
 /**
  * \brief Add a chroot directory to the config structure.
  */
@@ -867,6 +988,241 @@ void canonization_dispose(void* disp)
     (void)cfg;
 }
 
+/**
+ * \brief Create a new attestation structure.
+ */
+static config_attestation_t* new_attestation(config_context_t* context)
+{
+    config_attestation_t* ret =
+        (config_attestation_t*)malloc(sizeof(config_attestation_t));
+    if (NULL == ret)
+    {
+        CONFIG_ERROR("Out of memory in new_attestation().");
+    }
+
+    memset(ret, 0, sizeof(config_attestation_t));
+    ret->hdr.dispose = &attestation_dispose;
+
+    return ret;
+}
+
+/**
+ * \brief Add the maximum idle milliseconds to the attestation config.
+ */
+static config_attestation_t* add_attestation_max_milliseconds(
+    config_context_t* context, config_attestation_t* attestation,
+    int64_t milliseconds)
+{
+    if (attestation->max_milliseconds_set)
+    {
+        CONFIG_ERROR("Duplicate max milliseconds setting.");
+    }
+
+    if (milliseconds < ATTESTATION_MILLISECONDS_MINIMUM
+     || milliseconds > ATTESTATION_MILLISECONDS_MAXIMUM)
+    {
+        CONFIG_ERROR("Invalid milliseconds range.");
+    }
+
+    attestation->max_milliseconds_set = true;
+    attestation->max_milliseconds = milliseconds;
+
+    return attestation;
+}
+
+/**
+ * \brief Fold attestation data into the config structure.
+ */
+static agent_config_t* fold_attestation(
+    config_context_t* context, agent_config_t* cfg,
+    config_attestation_t* attestation)
+{
+    /* only allow the max milliseconds to be set once. */
+    if (cfg->attestation_max_milliseconds_set
+     && attestation->max_milliseconds_set)
+    {
+        CONFIG_ERROR("Duplicate attestation max milliseconds settings.");
+    }
+
+    /* assign max milliseconds if set. */
+    if (attestation->max_milliseconds_set)
+    {
+        cfg->attestation_max_milliseconds_set = true;
+        cfg->attestation_max_milliseconds = attestation->max_milliseconds;
+    }
+
+    /* dispose of the attestation structure. */
+    dispose((disposable_t*)attestation);
+    /* free the attestation structure. */
+    free(attestation);
+
+    return cfg;
+}
+
+/**
+ * \brief dispose of an attestation structure.
+ */
+void attestation_dispose(void* disp)
+{
+    config_attestation_t* cfg = (config_attestation_t*)disp;
+
+    /* nothing to do here, as it just contains ints and bools. */
+    (void)cfg;
+}
+
+/**
+ * \brief Create a new datastore tuning structure.
+ */
+static config_datastore_t* new_datastore(config_context_t* context)
+{
+    config_datastore_t* ret =
+        (config_datastore_t*)malloc(sizeof(config_datastore_t));
+    if (NULL == ret)
+    {
+        CONFIG_ERROR("Out of memory in new_datastore().");
+    }
+
+    memset(ret, 0, sizeof(config_datastore_t));
+    ret->hdr.dispose = &datastore_dispose;
+
+    return ret;
+}
+
+/**
+ * \brief Add the read-only dataservice worker count to the datastore config.
+ */
+static config_datastore_t* add_datastore_readers(
+    config_context_t* context, config_datastore_t* datastore,
+    int64_t readers)
+{
+    if (datastore->readers_set)
+    {
+        CONFIG_ERROR("Duplicate readers setting.");
+    }
+
+    if (readers < 0 || readers > DATASTORE_READERS_MAXIMUM)
+    {
+        CONFIG_ERROR("Bad datastore readers value.");
+    }
+
+    datastore->readers_set = true;
+    datastore->readers = readers;
+
+    return datastore;
+}
+
+/**
+ * \brief Add a tuning flag to the datastore config.
+ */
+static config_datastore_t* add_datastore_flag(
+    config_context_t* context, config_datastore_t* datastore, int64_t flag)
+{
+    if (datastore->flags & flag)
+    {
+        CONFIG_ERROR("Duplicate datastore flag setting.");
+    }
+
+    datastore->flags_set = true;
+    datastore->flags |= flag;
+
+    return datastore;
+}
+
+/**
+ * \brief Add the maximum readers to the datastore config.
+ */
+static config_datastore_t* add_datastore_max_readers(
+    config_context_t* context, config_datastore_t* datastore,
+    int64_t readers)
+{
+    if (datastore->max_readers_set)
+    {
+        CONFIG_ERROR("Duplicate max readers setting.");
+    }
+
+    if (readers <= 0 || readers > DATASTORE_MAX_READERS_MAXIMUM)
+    {
+        CONFIG_ERROR("Invalid max readers range.");
+    }
+
+    datastore->max_readers_set = true;
+    datastore->max_readers = readers;
+
+    return datastore;
+}
+
+/**
+ * \brief Fold datastore tuning data into the config structure.
+ */
+static agent_config_t* fold_datastore(
+    config_context_t* context, agent_config_t* cfg,
+    config_datastore_t* datastore)
+{
+    /* only allow the readers to be set once. */
+    if (cfg->datastore_readers_set && datastore->readers_set)
+    {
+        CONFIG_ERROR("Duplicate datastore readers settings.");
+    }
+
+    /* assign readers if set. */
+    if (datastore->readers_set)
+    {
+        cfg->datastore_readers_set = true;
+        cfg->datastore_readers = datastore->readers;
+    }
+
+    /* only allow each flag to be set once. */
+    if (cfg->datastore_flags & datastore->flags)
+    {
+        CONFIG_ERROR("Duplicate datastore flag settings.");
+    }
+
+    /* merge in the flags if set. */
+    if (datastore->flags_set)
+    {
+        cfg->datastore_flags_set = true;
+        cfg->datastore_flags |= datastore->flags;
+    }
+
+    /* an asynchronous map flush only applies to a writable map. */
+    if ((cfg->datastore_flags & DATASTORE_FLAG_MAPASYNC)
+     && !(cfg->datastore_flags & DATASTORE_FLAG_WRITEMAP))
+    {
+        CONFIG_ERROR("Datastore mapasync requires writemap.");
+    }
+
+    /* only allow the max readers to be set once. */
+    if (cfg->datastore_max_readers_set && datastore->max_readers_set)
+    {
+        CONFIG_ERROR("Duplicate datastore max readers settings.");
+    }
+
+    /* assign max readers if set. */
+    if (datastore->max_readers_set)
+    {
+        cfg->datastore_max_readers_set = true;
+        cfg->datastore_max_readers = datastore->max_readers;
+    }
+
+    /* dispose of the datastore structure. */
+    dispose((disposable_t*)datastore);
+    /* free the datastore structure. */
+    free(datastore);
+
+    return cfg;
+}
+
+/**
+ * \brief dispose of a datastore tuning structure.
+ */
+void datastore_dispose(void* disp)
+{
+    config_datastore_t* cfg = (config_datastore_t*)disp;
+
+    /* nothing to do here, as it just contains ints and bools. */
+    (void)cfg;
+}
+
 /**
  * \brief Fold materialized view data into the config.
  */
@@ -23,6 +23,12 @@ static int config_read_block_max_transactions(int s, agent_config_t* conf);
 static int config_read_secret(int s, agent_config_t* conf);
 static int config_read_rootblock(int s, agent_config_t* conf);
 static int config_read_datastore(int s, agent_config_t* conf);
+static int config_read_datastore_readers(int s, agent_config_t* conf);
+static int config_read_datastore_flags(int s, agent_config_t* conf);
+static int config_read_datastore_max_readers(int s, agent_config_t* conf);
+static int config_read_protocol_instances(int s, agent_config_t* conf);
+static int config_read_attestation_max_milliseconds(
+    int s, agent_config_t* conf);
 static int config_read_chroot(int s, agent_config_t* conf);
 static int config_read_usergroup(int s, agent_config_t* conf);
 static int config_read_listen_addr(int s, agent_config_t* conf);
@@ -121,6 +127,38 @@ int config_read_block(int s, agent_config_t* conf)
                     return retval;
                 break;
 
+            /* datastore readers */
+            case CONFIG_STREAM_TYPE_DATASTORE_READERS:
+                /* attempt to read the datastore reader count. */
+                retval = config_read_datastore_readers(s, conf);
+                if (AGENTD_STATUS_SUCCESS != retval)
+                    return retval;
+                break;
+
+            /* datastore flags */
+            case CONFIG_STREAM_TYPE_DATASTORE_FLAGS:
+                /* attempt to read the datastore tuning flags. */
+                retval = config_read_datastore_flags(s, conf);
+                if (AGENTD_STATUS_SUCCESS != retval)
+                    return retval;
+                break;
+
+            /* datastore max readers */
+            case CONFIG_STREAM_TYPE_DATASTORE_MAX_READERS:
+                /* attempt to read the datastore reader table size. */
+                retval = config_read_datastore_max_readers(s, conf);
+                if (AGENTD_STATUS_SUCCESS != retval)
+                    return retval;
+                break;
+
+            /* protocol instances */
+            case CONFIG_STREAM_TYPE_PROTOCOL_INSTANCES:
+                /* attempt to read the protocol service instance count. */
+                retval = config_read_protocol_instances(s, conf);
+                if (AGENTD_STATUS_SUCCESS != retval)
+                    return retval;
+                break;
+
             /* listen address */
             case CONFIG_STREAM_TYPE_LISTEN_ADDR:
                 /* attempt to read a listen address. */
@@ -161,6 +199,14 @@ int config_read_block(int s, agent_config_t* conf)
                     return retval;
                 break;
 
+            /* attestation max milliseconds */
+            case CONFIG_STREAM_TYPE_ATTESTATION_MAX_MILLISECONDS:
+                /* attempt to read the attestation idle delay limit. */
+                retval = config_read_attestation_max_milliseconds(s, conf);
+                if (AGENTD_STATUS_SUCCESS != retval)
+                    return retval;
+                break;
+
             /* private key */
             case CONFIG_STREAM_TYPE_PRIVATE_KEY:
                 /* attempt to read the private key from the stream. */
@@ -412,6 +458,187 @@ static int config_read_datastore(int s, agent_config_t* conf)
     return AGENTD_STATUS_SUCCESS;
 }
 
+/**
+ * \brief Read the datastore reader count from the config stream.
+ *
+ * \param s             The socket from which this value is read.
+ * \param conf          The config structure instance to write this value.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_CONFIG_IPC_READ_DATA_FAILURE if there was a failure
+ *        reading from the config socket.
+ *      - AGENTD_ERROR_CONFIG_INVALID_STREAM the stream data was corrupted or
+ *        invalid.
+ */
+static int config_read_datastore_readers(int s, agent_config_t* conf)
+{
+    /* it's an error to set the datastore readers more than once. */
+    if (conf->datastore_readers_set)
+        return AGENTD_ERROR_CONFIG_INVALID_STREAM;
+
+    /* attempt to read the value. */
+    if (AGENTD_STATUS_SUCCESS !=
+        ipc_read_int64_block(s, &conf->datastore_readers))
+        return AGENTD_ERROR_CONFIG_IPC_READ_DATA_FAILURE;
+
+    /* datastore readers must be between 0 and DATASTORE_READERS_MAXIMUM. */
+    if (conf->datastore_readers < 0
+     || conf->datastore_readers > DATASTORE_READERS_MAXIMUM)
+        return AGENTD_ERROR_CONFIG_INVALID_STREAM;
+
+    /* datastore_readers has been set. */
+    conf->datastore_readers_set = true;
+
+    /* success. */
+    return AGENTD_STATUS_SUCCESS;
+}
+
+/**
+ * \brief Read the datastore tuning flags from the config stream.
+ *
+ * \param s             The socket from which this value is read.
+ * \param conf          The config structure instance to write this value.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_CONFIG_IPC_READ_DATA_FAILURE if there was a failure
+ *        reading from the config socket.
+ *      - AGENTD_ERROR_CONFIG_INVALID_STREAM the stream data was corrupted or
+ *        invalid.
+ */
+static int config_read_datastore_flags(int s, agent_config_t* conf)
+{
+    /* it's an error to set the datastore flags more than once. */
+    if (conf->datastore_flags_set)
+        return AGENTD_ERROR_CONFIG_INVALID_STREAM;
+
+    /* attempt to read the value. */
+    if (AGENTD_STATUS_SUCCESS !=
+        ipc_read_int64_block(s, &conf->datastore_flags))
+        return AGENTD_ERROR_CONFIG_IPC_READ_DATA_FAILURE;
+
+    /* only known flags may be set. */
+    if (conf->datastore_flags & ~((int64_t)DATASTORE_FLAGS_ALL))
+        return AGENTD_ERROR_CONFIG_INVALID_STREAM;
+
+    /* datastore_flags has been set. */
+    conf->datastore_flags_set = true;
+
+    /* success. */
+    return AGENTD_STATUS_SUCCESS;
+}
+
+/**
+ * \brief Read the datastore reader table size from the config stream.
+ *
+ * \param s             The socket from which this value is read.
+ * \param conf          The config structure instance to write this value.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_CONFIG_IPC_READ_DATA_FAILURE if there was a failure
+ *        reading from the config socket.
+ *      - AGENTD_ERROR_CONFIG_INVALID_STREAM the stream data was corrupted or
+ *        invalid.
+ */
+static int config_read_datastore_max_readers(int s, agent_config_t* conf)
+{
+    /* it's an error to set the datastore max readers more than once. */
+    if (conf->datastore_max_readers_set)
+        return AGENTD_ERROR_CONFIG_INVALID_STREAM;
+
+    /* attempt to read the value. */
+    if (AGENTD_STATUS_SUCCESS !=
+        ipc_read_int64_block(s, &conf->datastore_max_readers))
+        return AGENTD_ERROR_CONFIG_IPC_READ_DATA_FAILURE;
+
+    /* max readers must be between 0 and DATASTORE_MAX_READERS_MAXIMUM, where
+     * 0 keeps the LMDB default. */
+    if (conf->datastore_max_readers < 0
+     || conf->datastore_max_readers > DATASTORE_MAX_READERS_MAXIMUM)
+        return AGENTD_ERROR_CONFIG_INVALID_STREAM;
+
+    /* datastore_max_readers has been set. */
+    conf->datastore_max_readers_set = true;
+
+    /* success. */
+    return AGENTD_STATUS_SUCCESS;
+}
+
+/**
+ * \brief Read the protocol service instance count from the config stream.
+ *
+ * \param s             The socket from which this value is read.
+ * \param conf          The config structure instance to write this value.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_CONFIG_IPC_READ_DATA_FAILURE if there was a failure
+ *        reading from the config socket.
+ *      - AGENTD_ERROR_CONFIG_INVALID_STREAM the stream data was corrupted or
+ *        invalid.
+ */
+static int config_read_protocol_instances(int s, agent_config_t* conf)
+{
+    /* it's an error to set the protocol instances more than once. */
+    if (conf->protocol_instances_set)
+        return AGENTD_ERROR_CONFIG_INVALID_STREAM;
+
+    /* attempt to read the value. */
+    if (AGENTD_STATUS_SUCCESS !=
+        ipc_read_int64_block(s, &conf->protocol_instances))
+        return AGENTD_ERROR_CONFIG_IPC_READ_DATA_FAILURE;
+
+    /* protocol instances must be between 1 and PROTOCOL_INSTANCES_MAXIMUM. */
+    if (conf->protocol_instances <= 0
+     || conf->protocol_instances > PROTOCOL_INSTANCES_MAXIMUM)
+        return AGENTD_ERROR_CONFIG_INVALID_STREAM;
+
+    /* protocol_instances has been set. */
+    conf->protocol_instances_set = true;
+
+    /* success. */
+    return AGENTD_STATUS_SUCCESS;
+}
+
+/**
+ * \brief Read the attestation max milliseconds from the config stream.
+ *
+ * \param s             The socket from which this value is read.
+ * \param conf          The config structure instance to write this value.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_CONFIG_IPC_READ_DATA_FAILURE if there was a failure
+ *        reading from the config socket.
+ *      - AGENTD_ERROR_CONFIG_INVALID_STREAM the stream data was corrupted or
+ *        invalid.
+ */
+static int config_read_attestation_max_milliseconds(
+    int s, agent_config_t* conf)
+{
+    /* it's an error to set the attestation max milliseconds more than once. */
+    if (conf->attestation_max_milliseconds_set)
+        return AGENTD_ERROR_CONFIG_INVALID_STREAM;
+
+    /* attempt to read the value. */
+    if (AGENTD_STATUS_SUCCESS !=
+        ipc_read_int64_block(s, &conf->attestation_max_milliseconds))
+        return AGENTD_ERROR_CONFIG_IPC_READ_DATA_FAILURE;
+
+    /* the value must be within the attestation milliseconds range. */
+    if (conf->attestation_max_milliseconds < ATTESTATION_MILLISECONDS_MINIMUM
+     || conf->attestation_max_milliseconds > ATTESTATION_MILLISECONDS_MAXIMUM)
+        return AGENTD_ERROR_CONFIG_INVALID_STREAM;
+
+    /* attestation_max_milliseconds has been set. */
+    conf->attestation_max_milliseconds_set = true;
+
+    /* success. */
+    return AGENTD_STATUS_SUCCESS;
+}
+
 /**
  * \brief Read the chroot from the config stream.
  *
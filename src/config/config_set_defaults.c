@@ -63,6 +63,50 @@ int config_set_defaults(agent_config_t* conf, const bootstrap_config_t* bconf)
         conf->block_max_transactions_set = true;
     }
 
+    /* if attestation_max_milliseconds is not set, set it to 5 seconds. */
+    if (!conf->attestation_max_milliseconds_set
+     || conf->attestation_max_milliseconds < ATTESTATION_MILLISECONDS_MINIMUM
+     || conf->attestation_max_milliseconds > ATTESTATION_MILLISECONDS_MAXIMUM)
+    {
+        conf->attestation_max_milliseconds = 5000;
+        conf->attestation_max_milliseconds_set = true;
+    }
+
+    /* if datastore_readers is not set, disable the read-only worker pool. */
+    if (!conf->datastore_readers_set
+     || conf->datastore_readers < 0
+     || conf->datastore_readers > DATASTORE_READERS_MAXIMUM)
+    {
+        conf->datastore_readers = 0;
+        conf->datastore_readers_set = true;
+    }
+
+    /* if datastore_flags is not set, use fully durable commits. */
+    if (!conf->datastore_flags_set
+     || (conf->datastore_flags & ~((int64_t)DATASTORE_FLAGS_ALL)))
+    {
+        conf->datastore_flags = 0;
+        conf->datastore_flags_set = true;
+    }
+
+    /* if datastore_max_readers is not set, use the LMDB default (0). */
+    if (!conf->datastore_max_readers_set
+     || conf->datastore_max_readers < 0
+     || conf->datastore_max_readers > DATASTORE_MAX_READERS_MAXIMUM)
+    {
+        conf->datastore_max_readers = 0;
+        conf->datastore_max_readers_set = true;
+    }
+
+    /* if protocol_instances is not set, run a single protocol service. */
+    if (!conf->protocol_instances_set
+     || conf->protocol_instances <= 0
+     || conf->protocol_instances > PROTOCOL_INSTANCES_MAXIMUM)
+    {
+        conf->protocol_instances = 1;
+        conf->protocol_instances_set = true;
+    }
+
     /* if secret is not set, set it to "root/secret.cert" */
     if (NULL == conf->secret)
     {
@@ -21,6 +21,12 @@ static int config_write_block_max_transactions(int s, agent_config_t* conf);
 static int config_write_secret(int s, agent_config_t* conf);
 static int config_write_rootblock(int s, agent_config_t* conf);
 static int config_write_datastore(int s, agent_config_t* conf);
+static int config_write_datastore_readers(int s, agent_config_t* conf);
+static int config_write_datastore_flags(int s, agent_config_t* conf);
+static int config_write_datastore_max_readers(int s, agent_config_t* conf);
+static int config_write_protocol_instances(int s, agent_config_t* conf);
+static int config_write_attestation_max_milliseconds(
+    int s, agent_config_t* conf);
 static int config_write_listen_addr(int s, agent_config_t* conf);
 static int config_write_chroot(int s, agent_config_t* conf);
 static int config_write_usergroup(int s, agent_config_t* conf);
@@ -71,6 +77,11 @@ int config_write_block(int s, agent_config_t* conf)
     if (AGENTD_STATUS_SUCCESS != retval)
         return retval;
 
+    /* attestation max milliseconds */
+    retval = config_write_attestation_max_milliseconds(s, conf);
+    if (AGENTD_STATUS_SUCCESS != retval)
+        return retval;
+
     /* secret */
     retval = config_write_secret(s, conf);
     if (AGENTD_STATUS_SUCCESS != retval)
@@ -86,6 +97,26 @@ int config_write_block(int s, agent_config_t* conf)
     if (AGENTD_STATUS_SUCCESS != retval)
         return retval;
 
+    /* datastore readers */
+    retval = config_write_datastore_readers(s, conf);
+    if (AGENTD_STATUS_SUCCESS != retval)
+        return retval;
+
+    /* datastore flags */
+    retval = config_write_datastore_flags(s, conf);
+    if (AGENTD_STATUS_SUCCESS != retval)
+        return retval;
+
+    /* datastore max readers */
+    retval = config_write_datastore_max_readers(s, conf);
+    if (AGENTD_STATUS_SUCCESS != retval)
+        return retval;
+
+    /* protocol instances */
+    retval = config_write_protocol_instances(s, conf);
+    if (AGENTD_STATUS_SUCCESS != retval)
+        return retval;
+
     /* listen addresses */
     retval = config_write_listen_addr(s, conf);
     if (AGENTD_STATUS_SUCCESS != retval)
@@ -337,6 +368,163 @@ static int config_write_datastore(int s, agent_config_t* conf)
     return AGENTD_STATUS_SUCCESS;
 }
 
+/**
+ * \brief Write the datastore reader count to the config output stream.
+ *
+ * \param s             The config output stream.
+ * \param conf          The config structure from which this value is obtained.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_CONFIG_IPC_WRITE_DATA_FAILURE if writing data to the
+ *        socket failed.
+ */
+static int config_write_datastore_readers(int s, agent_config_t* conf)
+{
+    /* write the datastore readers if set. */
+    if (conf->datastore_readers_set)
+    {
+        /* write the datastore readers type to the stream. */
+        uint8_t type = CONFIG_STREAM_TYPE_DATASTORE_READERS;
+        if (AGENTD_STATUS_SUCCESS != ipc_write_uint8_block(s, type))
+            return AGENTD_ERROR_CONFIG_IPC_WRITE_DATA_FAILURE;
+
+        /* write the datastore readers to the stream. */
+        if (AGENTD_STATUS_SUCCESS !=
+            ipc_write_int64_block(s, conf->datastore_readers))
+            return AGENTD_ERROR_CONFIG_IPC_WRITE_DATA_FAILURE;
+    }
+
+    /* success. */
+    return AGENTD_STATUS_SUCCESS;
+}
+
+/**
+ * \brief Write the datastore tuning flags to the config output stream.
+ *
+ * \param s             The config output stream.
+ * \param conf          The config structure from which this value is obtained.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_CONFIG_IPC_WRITE_DATA_FAILURE if writing data to the
+ *        socket failed.
+ */
+static int config_write_datastore_flags(int s, agent_config_t* conf)
+{
+    /* write the datastore flags if set. */
+    if (conf->datastore_flags_set)
+    {
+        /* write the datastore flags type to the stream. */
+        uint8_t type = CONFIG_STREAM_TYPE_DATASTORE_FLAGS;
+        if (AGENTD_STATUS_SUCCESS != ipc_write_uint8_block(s, type))
+            return AGENTD_ERROR_CONFIG_IPC_WRITE_DATA_FAILURE;
+
+        /* write the datastore flags to the stream. */
+        if (AGENTD_STATUS_SUCCESS !=
+            ipc_write_int64_block(s, conf->datastore_flags))
+            return AGENTD_ERROR_CONFIG_IPC_WRITE_DATA_FAILURE;
+    }
+
+    /* success. */
+    return AGENTD_STATUS_SUCCESS;
+}
+
+/**
+ * \brief Write the datastore reader table size to the config output stream.
+ *
+ * \param s             The config output stream.
+ * \param conf          The config structure from which this value is obtained.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_CONFIG_IPC_WRITE_DATA_FAILURE if writing data to the
+ *        socket failed.
+ */
+static int config_write_datastore_max_readers(int s, agent_config_t* conf)
+{
+    /* write the datastore max readers if set. */
+    if (conf->datastore_max_readers_set)
+    {
+        /* write the datastore max readers type to the stream. */
+        uint8_t type = CONFIG_STREAM_TYPE_DATASTORE_MAX_READERS;
+        if (AGENTD_STATUS_SUCCESS != ipc_write_uint8_block(s, type))
+            return AGENTD_ERROR_CONFIG_IPC_WRITE_DATA_FAILURE;
+
+        /* write the datastore max readers to the stream. */
+        if (AGENTD_STATUS_SUCCESS !=
+            ipc_write_int64_block(s, conf->datastore_max_readers))
+            return AGENTD_ERROR_CONFIG_IPC_WRITE_DATA_FAILURE;
+    }
+
+    /* success. */
+    return AGENTD_STATUS_SUCCESS;
+}
+
+/**
+ * \brief Write the protocol service instance count to the config output
+ * stream.
+ *
+ * \param s             The config output stream.
+ * \param conf          The config structure from which this value is obtained.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_CONFIG_IPC_WRITE_DATA_FAILURE if writing data to the
+ *        socket failed.
+ */
+static int config_write_protocol_instances(int s, agent_config_t* conf)
+{
+    /* write the protocol instances if set. */
+    if (conf->protocol_instances_set)
+    {
+        /* write the protocol instances type to the stream. */
+        uint8_t type = CONFIG_STREAM_TYPE_PROTOCOL_INSTANCES;
+        if (AGENTD_STATUS_SUCCESS != ipc_write_uint8_block(s, type))
+            return AGENTD_ERROR_CONFIG_IPC_WRITE_DATA_FAILURE;
+
+        /* write the protocol instances to the stream. */
+        if (AGENTD_STATUS_SUCCESS !=
+            ipc_write_int64_block(s, conf->protocol_instances))
+            return AGENTD_ERROR_CONFIG_IPC_WRITE_DATA_FAILURE;
+    }
+
+    /* success. */
+    return AGENTD_STATUS_SUCCESS;
+}
+
+/**
+ * \brief Write the attestation max milliseconds to the config output stream.
+ *
+ * \param s             The config output stream.
+ * \param conf          The config structure from which this value is obtained.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_CONFIG_IPC_WRITE_DATA_FAILURE if writing data to the
+ *        socket failed.
+ */
+static int config_write_attestation_max_milliseconds(
+    int s, agent_config_t* conf)
+{
+    /* write the attestation max milliseconds if set. */
+    if (conf->attestation_max_milliseconds_set)
+    {
+        /* write the attestation max milliseconds type to the stream. */
+        uint8_t type = CONFIG_STREAM_TYPE_ATTESTATION_MAX_MILLISECONDS;
+        if (AGENTD_STATUS_SUCCESS != ipc_write_uint8_block(s, type))
+            return AGENTD_ERROR_CONFIG_IPC_WRITE_DATA_FAILURE;
+
+        /* write the attestation max milliseconds to the stream. */
+        if (AGENTD_STATUS_SUCCESS !=
+            ipc_write_int64_block(s, conf->attestation_max_milliseconds))
+            return AGENTD_ERROR_CONFIG_IPC_WRITE_DATA_FAILURE;
+    }
+
+    /* success. */
+    return AGENTD_STATUS_SUCCESS;
+}
+
 /**
  * \brief Write the listen addresses to the config output stream.
  *
@@ -0,0 +1,133 @@
+/**
+ * \file dataservice/dataservice_api_recvresp_transaction_batch_update.c
+ *
+ * \brief Read the response from the transaction batch update call.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <arpa/inet.h>
+#include <agentd/inet.h>
+#include <agentd/dataservice/api.h>
+#include <agentd/dataservice/async_api.h>
+#include <agentd/dataservice/private/dataservice.h>
+#include <agentd/status_codes.h>
+#include <cbmc/model_assert.h>
+#include <rcpr/psock.h>
+#include <unistd.h>
+#include <vpr/parameters.h>
+
+RCPR_IMPORT_allocator_as(rcpr);
+RCPR_IMPORT_psock;
+
+/**
+ * \brief Receive a response from the transaction batch update action.
+ *
+ * \param sock          The socket on which this request is made.
+ * \param alloc         The allocator to use for this operation.
+ * \param offset        The child context offset for this response.
+ * \param status        This value is updated with the status code returned from
+ *                      the request.
+ * \param statuses      The array, of count elements, which is updated with the
+ *                      status of each entry in the batch.
+ * \param count         The number of entries in the batch.
+ *
+ * On a successful return from this function, the status is updated with the
+ * status code from the API request.  This status should be checked.  A zero
+ * status indicates that the batch was committed, in which case the statuses
+ * array holds the outcome of each entry, such as
+ * AGENTD_ERROR_DATASERVICE_NOT_FOUND for a transaction that was no longer in
+ * the queue.  A non-zero status indicates that nothing in the batch was
+ * applied, and the statuses array is left unchanged.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_IPC_WOULD_BLOCK if the operation was halted because it
+ *        would block this thread.
+ *      - AGENTD_ERROR_DATASERVICE_IPC_READ_DATA_FAILURE if reading data from
+ *        the socket failed.
+ *      - AGENTD_ERROR_DATASERVICE_RECVRESP_UNEXPECTED_METHOD_CODE if the
+ *        method code was unexpected.
+ *      - AGENTD_ERROR_DATASERVICE_RESPONSE_PACKET_INVALID_SIZE if the number
+ *        of entry statuses does not match the batch.
+ *      - AGENTD_ERROR_GENERAL_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ */
+int dataservice_api_recvresp_transaction_batch_update(
+    psock* sock, rcpr_allocator* alloc, uint32_t* offset, uint32_t* status,
+    uint32_t* statuses, size_t count)
+{
+    int retval = 0, release_retval = 0;
+
+    /* parameter sanity check. */
+    MODEL_ASSERT(NULL != sock);
+    MODEL_ASSERT(NULL != offset);
+    MODEL_ASSERT(NULL != status);
+    MODEL_ASSERT(NULL != statuses);
+
+    /* read a data packet from the socket. */
+    uint32_t* val = NULL;
+    size_t size = 0U;
+    retval = psock_read_boxed_data(sock, alloc, (void**)&val, &size);
+    if (STATUS_SUCCESS != retval)
+    {
+        retval = AGENTD_ERROR_DATASERVICE_IPC_READ_DATA_FAILURE;
+        goto done;
+    }
+
+    /* decode the response. */
+    dataservice_response_transaction_batch_update_t dresp;
+    retval =
+        dataservice_decode_response_transaction_batch_update(
+            val, size, &dresp);
+    if (AGENTD_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_val;
+    }
+
+    /* get the offset. */
+    *offset = dresp.hdr.offset;
+
+    /* get the status code. */
+    *status = dresp.hdr.status;
+    if (AGENTD_STATUS_SUCCESS != *status)
+    {
+        retval = AGENTD_STATUS_SUCCESS;
+        goto cleanup_dresp;
+    }
+
+    /* there must be exactly one status per entry in the batch. */
+    if (dresp.count != count)
+    {
+        retval = AGENTD_ERROR_DATASERVICE_RESPONSE_PACKET_INVALID_SIZE;
+        goto cleanup_dresp;
+    }
+
+    /* copy out the entry statuses. */
+    const uint8_t* in = (const uint8_t*)dresp.data;
+    for (size_t i = 0; i < count; ++i)
+    {
+        uint32_t net_status;
+        memcpy(&net_status, in, sizeof(net_status));
+        statuses[i] = ntohl(net_status);
+        in += sizeof(net_status);
+    }
+
+    /* success. */
+    retval = AGENTD_STATUS_SUCCESS;
+    goto cleanup_dresp;
+
+cleanup_dresp:
+    dispose((disposable_t*)&dresp);
+
+cleanup_val:
+    memset(val, 0, size);
+    release_retval = rcpr_allocator_reclaim(alloc, val);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+done:
+    return retval;
+}
@@ -22,6 +22,9 @@
  * \param sock              The socket on which this request is made.
  * \param alloc_opts        The allocator to use for this operation.
  * \param max_database_size The maximum size of the database.
+ * \param datastore_flags   The DATASTORE_FLAG_* tuning flags for the database.
+ * \param max_readers       The size of the database reader table, or 0 for
+ *                          the default.
  * \param datadir           The data directory to open.
  *
  * \returns a status code indicating success or failure.
@@ -35,7 +38,8 @@
  */
 int dataservice_api_sendreq_root_context_init_old(
     ipc_socket_context_t* sock, allocator_options_t* alloc_opts,
-    uint64_t max_database_size, const char* datadir)
+    uint64_t max_database_size, uint32_t datastore_flags,
+    uint32_t max_readers, const char* datadir)
 {
     status retval;
     vccrypt_buffer_t reqbuf;
@@ -47,7 +51,8 @@ int dataservice_api_sendreq_root_context_init_old(
     /* encode this request. */
     retval =
         dataservice_encode_request_root_context_init(
-            &reqbuf, alloc_opts, max_database_size, datadir);
+            &reqbuf, alloc_opts, max_database_size, datastore_flags,
+            max_readers, datadir);
     if (STATUS_SUCCESS != retval)
     {
         return retval;
@@ -0,0 +1,126 @@
+/**
+ * \file dataservice/dataservice_artifact_transaction_index_put.c
+ *
+ * \brief Append a transaction to the artifact transaction index.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/inet.h>
+#include <agentd/status_codes.h>
+#include <cbmc/model_assert.h>
+#include <string.h>
+
+#include "dataservice_internal.h"
+
+/**
+ * \brief Append a transaction to an artifact's history in the artifact
+ * transaction index.
+ *
+ * Transactions must be appended in the order in which they are canonized.
+ * The transaction is indexed after any transaction already indexed for this
+ * artifact at the same block height.
+ *
+ * \param artifact_txn_db   The artifact transaction index database.
+ * \param txn               The transaction under which updates are done.
+ * \param artifact_id       The artifact id for this transaction.
+ * \param height            The height of the block holding this transaction.
+ * \param transaction_id    The transaction id to index.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_DATASERVICE_MDB_GET_FAILURE if this function failed to
+ *        read from the database.
+ *      - AGENTD_ERROR_DATASERVICE_MDB_PUT_FAILURE if this function failed to
+ *        update the database.
+ */
+int dataservice_artifact_transaction_index_put(
+    MDB_dbi artifact_txn_db, MDB_txn* txn, const uint8_t* artifact_id,
+    uint64_t height, const uint8_t* transaction_id)
+{
+    int retval;
+    MDB_cursor* cursor = NULL;
+    uint8_t key[DATASERVICE_ARTIFACT_TXN_KEY_SIZE];
+    uint32_t index = 0U;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != txn);
+    MODEL_ASSERT(NULL != artifact_id);
+    MODEL_ASSERT(NULL != transaction_id);
+
+    /* open a cursor on the index. */
+    if (0 != mdb_cursor_open(txn, artifact_txn_db, &cursor))
+    {
+        retval = AGENTD_ERROR_DATASERVICE_MDB_GET_FAILURE;
+        goto done;
+    }
+
+    /* seek to the first key past this artifact and height. */
+    uint64_t net_next_height = htonll(height + 1);
+    memcpy(key, artifact_id, 16);
+    memcpy(key + 16, &net_next_height, sizeof(net_next_height));
+    memset(key + 24, 0, sizeof(uint32_t));
+    MDB_val lkey = { sizeof(key), key };
+    MDB_val lval = { 0, NULL };
+    retval = mdb_cursor_get(cursor, &lkey, &lval, MDB_SET_RANGE);
+    if (0 == retval)
+    {
+        /* step back to the last key before it. */
+        retval = mdb_cursor_get(cursor, &lkey, &lval, MDB_PREV);
+    }
+    else if (MDB_NOTFOUND == retval)
+    {
+        /* every key sorts before it, so take the last key. */
+        retval = mdb_cursor_get(cursor, &lkey, &lval, MDB_LAST);
+    }
+
+    /* continue the numbering if that key is for this artifact and height. */
+    uint64_t net_height = htonll(height);
+    if (0 == retval)
+    {
+        if (DATASERVICE_ARTIFACT_TXN_KEY_SIZE == lkey.mv_size
+         && 0 == memcmp(lkey.mv_data, artifact_id, 16)
+         && 0 == memcmp(
+                    (const uint8_t*)lkey.mv_data + 16, &net_height,
+                    sizeof(net_height)))
+        {
+            uint32_t net_index;
+            memcpy(
+                &net_index, (const uint8_t*)lkey.mv_data + 24,
+                sizeof(net_index));
+            index = ntohl(net_index) + 1;
+        }
+    }
+    else if (MDB_NOTFOUND != retval)
+    {
+        retval = AGENTD_ERROR_DATASERVICE_MDB_GET_FAILURE;
+        goto cleanup_cursor;
+    }
+
+    /* build the key for this transaction. */
+    uint32_t net_index = htonl(index);
+    memcpy(key + 16, &net_height, sizeof(net_height));
+    memcpy(key + 24, &net_index, sizeof(net_index));
+
+    /* insert this transaction. */
+    lkey.mv_size = sizeof(key);
+    lkey.mv_data = key;
+    lval.mv_size = 16;
+    lval.mv_data = (uint8_t*)transaction_id;
+    if (0 != mdb_put(txn, artifact_txn_db, &lkey, &lval, MDB_NOOVERWRITE))
+    {
+        retval = AGENTD_ERROR_DATASERVICE_MDB_PUT_FAILURE;
+        goto cleanup_cursor;
+    }
+
+    /* success. */
+    retval = AGENTD_STATUS_SUCCESS;
+
+    /* fall-through. */
+
+cleanup_cursor:
+    mdb_cursor_close(cursor);
+
+done:
+    return retval;
+}
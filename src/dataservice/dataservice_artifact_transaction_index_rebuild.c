@@ -0,0 +1,195 @@
+/**
+ * \file dataservice/dataservice_artifact_transaction_index_rebuild.c
+ *
+ * \brief Build the artifact transaction index for an older database.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/dataservice/api.h>
+#include <agentd/inet.h>
+#include <agentd/status_codes.h>
+#include <cbmc/model_assert.h>
+#include <string.h>
+
+#include "dataservice_internal.h"
+
+/* forward decls. */
+static int dataservice_artifact_transaction_index_rebuild_artifact(
+    dataservice_database_details_t* details, MDB_txn* txn,
+    const data_artifact_record_t* record);
+
+/**
+ * \brief Build the artifact transaction index from the artifact and
+ * transaction databases.
+ *
+ * This is done once, when a database created before the index existed is
+ * opened.  Each artifact's history is walked from its first transaction.
+ *
+ * \param details           The database details.
+ * \param txn               The write transaction under which the index is
+ *                          built.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_DATASERVICE_MDB_GET_FAILURE if this function failed to
+ *        read from the database.
+ *      - AGENTD_ERROR_DATASERVICE_MDB_PUT_FAILURE if this function failed to
+ *        update the database.
+ *      - AGENTD_ERROR_DATASERVICE_INVALID_STORED_TRANSACTION_NODE if a stored
+ *        transaction node was invalid.
+ *      - AGENTD_ERROR_DATASERVICE_INVALID_STORED_BLOCK_NODE if a stored block
+ *        node was invalid.
+ */
+int dataservice_artifact_transaction_index_rebuild(
+    dataservice_database_details_t* details, MDB_txn* txn)
+{
+    int retval;
+    MDB_stat index_stat, artifact_stat;
+    MDB_cursor* cursor = NULL;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != details);
+    MODEL_ASSERT(NULL != txn);
+
+    /* only build the index if it is empty and there is something to index. */
+    if (0 != mdb_stat(txn, details->artifact_txn_db, &index_stat)
+     || 0 != mdb_stat(txn, details->artifact_db, &artifact_stat))
+    {
+        retval = AGENTD_ERROR_DATASERVICE_MDB_GET_FAILURE;
+        goto done;
+    }
+    else if (0U != index_stat.ms_entries || 0U == artifact_stat.ms_entries)
+    {
+        retval = AGENTD_STATUS_SUCCESS;
+        goto done;
+    }
+
+    /* open a cursor on the artifact database. */
+    if (0 != mdb_cursor_open(txn, details->artifact_db, &cursor))
+    {
+        retval = AGENTD_ERROR_DATASERVICE_MDB_GET_FAILURE;
+        goto done;
+    }
+
+    /* index the history of each artifact. */
+    MDB_val lkey, lval;
+    for (retval = mdb_cursor_get(cursor, &lkey, &lval, MDB_FIRST);
+         0 == retval;
+         retval = mdb_cursor_get(cursor, &lkey, &lval, MDB_NEXT))
+    {
+        data_artifact_record_t record;
+
+        /* skip records that are not artifact records. */
+        if (sizeof(record) != lval.mv_size)
+        {
+            continue;
+        }
+
+        memcpy(&record, lval.mv_data, sizeof(record));
+        retval =
+            dataservice_artifact_transaction_index_rebuild_artifact(
+                details, txn, &record);
+        if (AGENTD_STATUS_SUCCESS != retval)
+        {
+            goto cleanup_cursor;
+        }
+    }
+
+    /* the walk ends when we run out of artifacts. */
+    if (MDB_NOTFOUND != retval)
+    {
+        retval = AGENTD_ERROR_DATASERVICE_MDB_GET_FAILURE;
+        goto cleanup_cursor;
+    }
+
+    /* success. */
+    retval = AGENTD_STATUS_SUCCESS;
+
+    /* fall-through. */
+
+cleanup_cursor:
+    mdb_cursor_close(cursor);
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Index the history of a single artifact, walking its transactions from
+ * the first to the latest.
+ *
+ * \param details           The database details.
+ * \param txn               The write transaction under which the index is
+ *                          built.
+ * \param record            The artifact record to index.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static int dataservice_artifact_transaction_index_rebuild_artifact(
+    dataservice_database_details_t* details, MDB_txn* txn,
+    const data_artifact_record_t* record)
+{
+    int retval;
+    uint8_t txn_id[16];
+    data_transaction_node_t txn_node;
+    data_block_node_t block_node;
+
+    /* start with the first transaction for this artifact. */
+    memcpy(txn_id, record->txn_first, sizeof(txn_id));
+
+    for (;;)
+    {
+        /* read the transaction node. */
+        MDB_val lkey = { sizeof(txn_id), txn_id };
+        MDB_val lval = { 0, NULL };
+        retval = mdb_get(txn, details->txn_db, &lkey, &lval);
+        if (0 != retval)
+        {
+            return AGENTD_ERROR_DATASERVICE_MDB_GET_FAILURE;
+        }
+        else if (lval.mv_size < sizeof(txn_node))
+        {
+            return AGENTD_ERROR_DATASERVICE_INVALID_STORED_TRANSACTION_NODE;
+        }
+
+        memcpy(&txn_node, lval.mv_data, sizeof(txn_node));
+
+        /* read the block node to get the height of this transaction. */
+        lkey.mv_size = sizeof(txn_node.block_id);
+        lkey.mv_data = txn_node.block_id;
+        retval = mdb_get(txn, details->block_db, &lkey, &lval);
+        if (0 != retval)
+        {
+            return AGENTD_ERROR_DATASERVICE_MDB_GET_FAILURE;
+        }
+        else if (lval.mv_size < sizeof(block_node))
+        {
+            return AGENTD_ERROR_DATASERVICE_INVALID_STORED_BLOCK_NODE;
+        }
+
+        memcpy(&block_node, lval.mv_data, sizeof(block_node));
+
+        /* append this transaction to the artifact's history. */
+        retval =
+            dataservice_artifact_transaction_index_put(
+                details->artifact_txn_db, txn, record->key,
+                ntohll(block_node.net_block_height), txn_id);
+        if (AGENTD_STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        /* stop at the latest transaction for this artifact. */
+        if (0 == memcmp(txn_id, record->txn_latest, sizeof(txn_id))
+         || dataservice_api_node_ref_is_end(txn_node.next))
+        {
+            return AGENTD_STATUS_SUCCESS;
+        }
+
+        /* move to the next transaction for this artifact. */
+        memcpy(txn_id, txn_node.next, sizeof(txn_id));
+    }
+}
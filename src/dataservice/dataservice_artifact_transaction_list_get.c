@@ -0,0 +1,193 @@
+/**
+ * \file dataservice/dataservice_artifact_transaction_list_get.c
+ *
+ * \brief Get a page of an artifact's transaction history.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/dataservice/private/dataservice.h>
+#include <agentd/status_codes.h>
+#include <agentd/inet.h>
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "dataservice_internal.h"
+
+/**
+ * \brief Get a page of an artifact's transaction history from the data
+ * service.
+ *
+ * Transactions are returned in the order in which they were canonized,
+ * starting with the first transaction at or after the given block height and
+ * index.
+ *
+ * \param child         The child context for this operation.
+ * \param dtxn_ctx      The dataservice transaction context for this operation,
+ *                      or NULL.
+ * \param artifact_id   The artifact ID for this operation.
+ * \param start_height  The block height at which this page starts.
+ * \param start_index   The index within the start height at which this page
+ *                      starts.
+ * \param entries       The array of entries to populate.
+ * \param count         On input, the number of entries in the array.  On
+ *                      output, the number of entries populated.
+ * \param more          Set to true if the history continues past this page.
+ *
+ * \returns A status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_DATASERVICE_NOT_FOUND if no transactions were found for
+ *        this artifact at or after the start position.
+ *      - AGENTD_ERROR_DATASERVICE_NOT_AUTHORIZED if this child context is not
+ *        authorized for this operation.
+ *      - AGENTD_ERROR_DATASERVICE_MDB_TXN_BEGIN_FAILURE if this operation
+ *        failed to begin a transaction.
+ *      - AGENTD_ERROR_DATASERVICE_MDB_GET_FAILURE if there was a failure
+ *        getting this value.
+ *      - AGENTD_ERROR_DATASERVICE_INVALID_INDEX_ENTRY if an invalid index entry
+ *        was encountered.
+ */
+int dataservice_artifact_transaction_list_get(
+    dataservice_child_context_t* child,
+    dataservice_transaction_context_t* dtxn_ctx, const uint8_t* artifact_id,
+    uint64_t start_height, uint32_t start_index,
+    data_artifact_transaction_entry_t* entries, size_t* count, bool* more)
+{
+    int retval = 0;
+    MDB_txn* txn = NULL;
+    MDB_cursor* cursor = NULL;
+    size_t max_count;
+    uint8_t key[DATASERVICE_ARTIFACT_TXN_KEY_SIZE];
+
+    /* parameter sanity check. */
+    MODEL_ASSERT(NULL != child);
+    MODEL_ASSERT(NULL != child->root);
+    MODEL_ASSERT(NULL != child->root->details);
+    MODEL_ASSERT(NULL != artifact_id);
+    MODEL_ASSERT(NULL != entries);
+    MODEL_ASSERT(NULL != count);
+    MODEL_ASSERT(NULL != more);
+
+    /* nothing has been read yet. */
+    max_count = *count;
+    *count = 0U;
+    *more = false;
+
+    /* verify that we are allowed to read the artifact database. */
+    if (!BITCAP_ISSET(child->childcaps,
+            DATASERVICE_API_CAP_APP_ARTIFACT_READ))
+    {
+        retval = AGENTD_ERROR_DATASERVICE_NOT_AUTHORIZED;
+        goto done;
+    }
+
+    /* get the details for this database connection. */
+    dataservice_database_details_t* details =
+        (dataservice_database_details_t*)child->root->details;
+
+    /* set the parent transaction. */
+    MDB_txn* parent = (NULL != dtxn_ctx) ? dtxn_ctx->txn : NULL;
+
+    /* if the parent transaction is NULL, begin a transaction, or else use the
+     * parent transaction. */
+    if (NULL == parent)
+    {
+        if (0 != mdb_txn_begin(details->env, NULL, MDB_RDONLY, &txn))
+        {
+            retval = AGENTD_ERROR_DATASERVICE_MDB_TXN_BEGIN_FAILURE;
+            goto done;
+        }
+    }
+
+    /* set the transaction to be used for now on. */
+    MDB_txn* query_txn = (NULL != txn) ? txn : parent;
+
+    /* open a cursor on the artifact transaction index. */
+    if (0 != mdb_cursor_open(query_txn, details->artifact_txn_db, &cursor))
+    {
+        retval = AGENTD_ERROR_DATASERVICE_MDB_GET_FAILURE;
+        goto maybe_transaction_abort;
+    }
+
+    /* build the start key. */
+    uint64_t net_start_height = htonll(start_height);
+    uint32_t net_start_index = htonl(start_index);
+    memcpy(key, artifact_id, 16);
+    memcpy(key + 16, &net_start_height, sizeof(net_start_height));
+    memcpy(key + 24, &net_start_index, sizeof(net_start_index));
+
+    /* seek to the first entry at or after the start key. */
+    MDB_val lkey = { sizeof(key), key };
+    MDB_val lval = { 0, NULL };
+    retval = mdb_cursor_get(cursor, &lkey, &lval, MDB_SET_RANGE);
+
+    /* read entries until we leave this artifact or fill the page. */
+    while (0 == retval)
+    {
+        /* stop once we have moved past this artifact. */
+        if (DATASERVICE_ARTIFACT_TXN_KEY_SIZE != lkey.mv_size
+         || 0 != memcmp(lkey.mv_data, artifact_id, 16))
+        {
+            break;
+        }
+
+        /* if the page is full, there are more entries. */
+        if (*count == max_count)
+        {
+            *more = true;
+            break;
+        }
+
+        /* verify the value size. */
+        if (16 != lval.mv_size)
+        {
+            retval = AGENTD_ERROR_DATASERVICE_INVALID_INDEX_ENTRY;
+            goto cleanup_cursor;
+        }
+
+        /* populate the entry. */
+        const uint8_t* bkey = (const uint8_t*)lkey.mv_data;
+        memcpy(entries[*count].txn_id, lval.mv_data, 16);
+        memcpy(
+            &entries[*count].net_height, bkey + 16,
+            sizeof(entries[*count].net_height));
+        memcpy(
+            &entries[*count].net_index, bkey + 24,
+            sizeof(entries[*count].net_index));
+        ++(*count);
+
+        retval = mdb_cursor_get(cursor, &lkey, &lval, MDB_NEXT);
+    }
+
+    /* a read error other than running off the end of the index fails. */
+    if (0 != retval && MDB_NOTFOUND != retval)
+    {
+        retval = AGENTD_ERROR_DATASERVICE_MDB_GET_FAILURE;
+        goto cleanup_cursor;
+    }
+
+    /* an empty page means that nothing was found. */
+    if (0U == *count)
+    {
+        retval = AGENTD_ERROR_DATASERVICE_NOT_FOUND;
+        goto cleanup_cursor;
+    }
+
+    /* success. */
+    retval = AGENTD_STATUS_SUCCESS;
+
+    /* fall-through. */
+
+cleanup_cursor:
+    mdb_cursor_close(cursor);
+
+maybe_transaction_abort:
+    if (NULL != txn)
+    {
+        mdb_txn_abort(txn);
+    }
+
+done:
+    return retval;
+}
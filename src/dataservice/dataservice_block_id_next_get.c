@@ -0,0 +1,87 @@
+/**
+ * \file dataservice/dataservice_block_id_next_get.c
+ *
+ * \brief Get the next block ID for a given block ID.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/dataservice/private/dataservice.h>
+#include <agentd/status_codes.h>
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vccrypt/compare.h>
+
+#include "dataservice_internal.h"
+
+/* the next link of the latest block. */ */
+static const uint8_t ff_uuid[16] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+};
+
+/**
+ * \brief Get the next block ID for a given block ID.
+ *
+ * Only the fixed-size block node is read; the block certificate is neither
+ * validated nor copied.
+ *
+ * \param child         The child context for this operation.
+ * \param dtxn_ctx      The dataservice transaction context for this operation,
+ *                      or NULL.
+ * \param block_id      The block ID to query.
+ * \param next_id       Pointer to the block UUID (16 bytes) to set.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_DATASERVICE_NOT_FOUND if the block was not found or if
+ *        it is the latest block.
+ *      - AGENTD_ERROR_DATASERVICE_NOT_AUTHORIZED if this child context is not
+ *        authorized to call this function.
+ *      - AGENTD_ERROR_DATASERVICE_MDB_TXN_BEGIN_FAILURE if this function failed
+ *        to begin a transaction.
+ *      - AGENTD_ERROR_DATASERVICE_MDB_GET_FAILURE if this function failed to
+ *        read data from the database.
+ *      - AGENTD_ERROR_DATASERVICE_INVALID_STORED_BLOCK_NODE if the block node
+ *        read from the database could not be deserialized.
+ */
+int dataservice_block_id_next_get(
+    dataservice_child_context_t* child,
+    dataservice_transaction_context_t* dtxn_ctx, const uint8_t* block_id,
+    uint8_t* next_id)
+{
+    int retval;
+    data_block_node_t node;
+
+    /* parameter sanity check. */
+    MODEL_ASSERT(NULL != child);
+    MODEL_ASSERT(NULL != child->root);
+    MODEL_ASSERT(NULL != block_id);
+    MODEL_ASSERT(NULL != next_id);
+
+    /* verify that we are allowed to read the next block id. */
+    if (!BITCAP_ISSET(child->childcaps,
+            DATASERVICE_API_CAP_APP_BLOCK_ID_NEXT_READ))
+    {
+        return AGENTD_ERROR_DATASERVICE_NOT_AUTHORIZED;
+    }
+
+    /* read the block node. */
+    retval = dataservice_block_node_read(child, dtxn_ctx, block_id, &node);
+    if (AGENTD_STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* the latest block has no next block. */
+    if (!crypto_memcmp(node.next, ff_uuid, 16))
+    {
+        return AGENTD_ERROR_DATASERVICE_NOT_FOUND;
+    }
+
+    /* copy the next block id. */
+    memcpy(next_id, node.next, 16);
+
+    /* success. */
+    return AGENTD_STATUS_SUCCESS;
+}
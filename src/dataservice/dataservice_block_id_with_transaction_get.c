@@ -0,0 +1,130 @@
+/**
+ * \file dataservice/dataservice_block_id_with_transaction_get.c
+ *
+ * \brief Get the block ID of a canonized transaction.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/dataservice/private/dataservice.h>
+#include <agentd/status_codes.h>
+#include <cbmc/model_assert.h>
+#include <string.h>
+
+#include "dataservice_internal.h"
+
+/**
+ * \brief Get the block ID of a canonized transaction.
+ *
+ * Only the fixed-size transaction node is read; the transaction certificate is
+ * neither validated nor copied.
+ *
+ * \param child         The child context for this operation.
+ * \param dtxn_ctx      The dataservice transaction context for this operation,
+ *                      or NULL.
+ * \param txn_id        The transaction ID to query.
+ * \param block_id      Pointer to the block UUID (16 bytes) to set.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_DATASERVICE_NOT_FOUND if the transaction was not found.
+ *      - AGENTD_ERROR_DATASERVICE_NOT_AUTHORIZED if this child context is not
+ *        authorized to call this function.
+ *      - AGENTD_ERROR_DATASERVICE_MDB_TXN_BEGIN_FAILURE if this function failed
+ *        to begin a transaction.
+ *      - AGENTD_ERROR_DATASERVICE_MDB_GET_FAILURE if this function failed to
+ *        read data from the database.
+ *      - AGENTD_ERROR_DATASERVICE_INVALID_STORED_TRANSACTION_NODE if the
+ *        transaction node read from the database could not be deserialized.
+ */
+int dataservice_block_id_with_transaction_get(
+    dataservice_child_context_t* child,
+    dataservice_transaction_context_t* dtxn_ctx, const uint8_t* txn_id,
+    uint8_t* block_id)
+{
+    int retval = 0;
+    MDB_txn* txn = NULL;
+
+    /* parameter sanity check. */
+    MODEL_ASSERT(NULL != child);
+    MODEL_ASSERT(NULL != child->root);
+    MODEL_ASSERT(NULL != txn_id);
+    MODEL_ASSERT(NULL != block_id);
+
+    /* verify that we are allowed to read the block id of a transaction. */
+    if (!BITCAP_ISSET(child->childcaps,
+            DATASERVICE_API_CAP_APP_BLOCK_ID_WITH_TRANSACTION_READ))
+    {
+        retval = AGENTD_ERROR_DATASERVICE_NOT_AUTHORIZED;
+        goto done;
+    }
+
+    /* get the details for this database connection. */
+    dataservice_database_details_t* details =
+        (dataservice_database_details_t*)child->root->details;
+
+    /* set the parent transaction. */
+    MDB_txn* parent = (NULL != dtxn_ctx) ? dtxn_ctx->txn : NULL;
+
+    /* if the parent transaction is NULL, begin a transaction, or else use the
+     * parent transaction. */
+    if (NULL == parent)
+    {
+        if (0 != mdb_txn_begin(details->env, NULL, MDB_RDONLY, &txn))
+        {
+            retval = AGENTD_ERROR_DATASERVICE_MDB_TXN_BEGIN_FAILURE;
+            goto done;
+        }
+    }
+
+    /* set the transaction to be used from now on. */
+    MDB_txn* query_txn = (NULL != txn) ? txn : parent;
+
+    /* query the entry. */
+    MDB_val lkey;
+    lkey.mv_size = 16;
+    lkey.mv_data = (uint8_t*)txn_id;
+    MDB_val lval;
+    memset(&lval, 0, sizeof(lval));
+
+    /* attempt to read this node from the database. */
+    retval = mdb_get(query_txn, details->txn_db, &lkey, &lval);
+    if (MDB_NOTFOUND == retval)
+    {
+        /* the value was not found. */
+        retval = AGENTD_ERROR_DATASERVICE_NOT_FOUND;
+        goto maybe_transaction_abort;
+    }
+    else if (0 != retval)
+    {
+        /* some error has occurred. */
+        retval = AGENTD_ERROR_DATASERVICE_MDB_GET_FAILURE;
+        goto maybe_transaction_abort;
+    }
+
+    /* verify that this value is large enough to be a node value. */
+    if (lval.mv_size <= sizeof(data_transaction_node_t))
+    {
+        retval = AGENTD_ERROR_DATASERVICE_INVALID_STORED_TRANSACTION_NODE;
+        goto maybe_transaction_abort;
+    }
+
+    /* copy only the block id; the certificate is left in the map. */
+    memcpy(
+        block_id, ((const data_transaction_node_t*)lval.mv_data)->block_id,
+        16);
+
+    /* success. */
+    retval = AGENTD_STATUS_SUCCESS;
+
+    /* fall-through. */
+
+maybe_transaction_abort:
+    if (NULL != txn)
+    {
+        mdb_txn_abort(txn);
+    }
+
+done:
+    return retval;
+}
@@ -16,7 +16,6 @@
 #include <vccrypt/suite.h>
 #include <vccrypt/compare.h>
 #include <vpr/allocator.h>
-#include <vpr/allocator/malloc_allocator.h>
 #include <vpr/parameters.h>
 
 #include "dataservice_internal.h"
@@ -32,6 +31,31 @@ static uint8_t ff_uuid[16] = {
     0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
 };
 
+/**
+ * \brief A wrapped transaction found in a block, parsed ahead of the write.
+ *
+ * The pointers reference fields inside of the block data.
+ */
+typedef struct dataservice_block_make_child
+{
+    const uint8_t* txn_cert;
+    size_t txn_cert_size;
+    const uint8_t* txn_id;
+    const uint8_t* prev_txn_id;
+    const uint8_t* artifact_id;
+    uint32_t state;
+    int status;
+} dataservice_block_make_child_t;
+
+/**
+ * \brief The wrapped transactions of a block, parsed by the worker pool.
+ */
+typedef struct dataservice_block_make_parse_work
+{
+    vccert_parser_options_t* parser_options;
+    dataservice_block_make_child_t* children;
+} dataservice_block_make_parse_work_t;
+
 /* constraint forward decls */
 static int constraint_matching_block_height(
     vccert_parser_context_t* parser, const data_block_node_t* end_node,
@@ -47,8 +71,6 @@ static int query_end_node(
     MDB_txn* txn, MDB_dbi block_db, const data_block_node_t** end_node);
 
 /* forward decls */
-static int dataservice_create_child_trasaction(
-    MDB_env* env, dataservice_transaction_context_t* dtxn_ctx, MDB_txn** txn);
 static int dataservice_block_make_create_queue(
     MDB_dbi block_db, MDB_txn* txn, const uint8_t* block_id, uint64_t height);
 static int dataservice_block_make_update_prev(
@@ -60,15 +82,22 @@ static int dataservice_block_make_update_end(
 static int dataservice_block_make_update_artifact(
     MDB_dbi artifact_db, MDB_txn* txn, const uint8_t* artifact_id,
     const uint8_t* transaction_id, uint64_t height, uint32_t state);
-static int dataservice_make_block_get_first_transaction_id(
+static int dataservice_block_make_collect_children(
+    vccert_parser_context_t* parser,
+    dataservice_block_make_child_t** children, size_t* count);
+static int dataservice_block_make_parse_children(
+    workpool* pool, vccert_parser_options_t* parser_options,
+    dataservice_block_make_child_t* children, size_t count);
+static void dataservice_block_make_parse_slice(
+    void* context, size_t begin, size_t end);
+static void dataservice_block_make_parse_child(
     vccert_parser_options_t* parser_options,
-    const uint8_t* txn_cert, size_t txn_cert_size,
-    uint8_t* first_child_txn_id);
+    dataservice_block_make_child_t* txn_child);
 static int dataservice_block_make_process_child(
-    dataservice_child_context_t* child,
-    vccert_parser_options_t* parser_options, MDB_dbi txn_db,
-    MDB_dbi artifact_db, MDB_txn* txn, uint64_t height,
-    const uint8_t* block_id, const uint8_t* txn_cert, size_t txn_cert_size);
+    dataservice_child_context_t* child, MDB_dbi txn_db,
+    MDB_dbi artifact_db, MDB_dbi artifact_txn_db, MDB_txn* txn,
+    uint64_t height, const uint8_t* block_id,
+    const dataservice_block_make_child_t* txn_child);
 static int dataservice_block_make_update_prev_txn(
     MDB_dbi txn_db, MDB_txn* txn, const uint8_t* txn_id,
     const uint8_t* next_txn_id);
@@ -86,6 +115,10 @@ static int dataservice_make_block_insert_block(
  * ID, and update its artifact.  This update is done under a single transaction,
  * so all changes either succeed or fail atomically.
  *
+ * The wrapped transactions are parsed before the write transaction is opened,
+ * on the block parse workers for large blocks, so that the database writer lock
+ * is only held for the ordered database updates.
+ *
  * \param ctx           The child context for this operation.
  * \param dtxn_ctx      The dataservice transaction context for this operation.
  * \param block_id      The block ID for this block.
@@ -100,10 +133,6 @@ static int dataservice_make_block_insert_block(
  *        encountered during this operation.
  *      - AGENTD_ERROR_DATASERVICE_NOT_AUTHORIZED if this child context is not
  *        authorized to call this function.
- *      - AGENTD_ERROR_DATASERVICE_VCCRYPT_SUITE_OPTIONS_INIT_FAILURE if this
- *        function failed to initialize crypto suite options.
- *      - AGENTD_ERROR_DATASERVICE_VCCERT_PARSER_OPTIONS_INIT_FAILURE if this
- *        function failed to initialize parser options.
  *      - AGENTD_ERROR_DATASERVICE_VCCERT_PARSER_INIT_FAILURE if this
  *        function failed to initialize a parser.
  *      - AGENTD_ERROR_DATASERVICE_MDB_TXN_BEGIN_FAILURE if this function failed
@@ -148,15 +177,16 @@ int dataservice_block_make(
     const uint8_t* block_id,
     const uint8_t* block_data, size_t block_size)
 {
-    allocator_options_t alloc_opts;
-    vccert_parser_options_t parser_options;
     vccert_parser_context_t parser;
-    vccrypt_suite_options_t crypto_suite;
     int retval = 0;
+    int children_retval = 0;
+    dataservice_block_make_child_t* children = NULL;
+    size_t child_count = 0U;
     MDB_txn* txn = NULL;
     uint64_t expected_block_height;
     const uint8_t* block_prev_uuid;
     const data_block_node_t* end_node = NULL;
+    bool id_filter_synced = false;
 
     /* parameter sanity check. */
     MODEL_ASSERT(NULL != child);
@@ -177,38 +207,36 @@ int dataservice_block_make(
     dataservice_database_details_t* details =
         (dataservice_database_details_t*)child->root->details;
 
-    /* create allocator options for this operation. */
-    /* TODO - use a pool allocator. */
-    malloc_allocator_options_init(&alloc_opts);
+    /* set the parent transaction. */
+    MDB_txn* parent = (NULL != dtxn_ctx) ? dtxn_ctx->txn : NULL;
 
-    /* create crypto suite options for this operation. */
-    /* TODO - this should occur at startup. */
-    if (VCCRYPT_STATUS_SUCCESS != vccrypt_suite_options_init(&crypto_suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1))
-    {
-        retval = AGENTD_ERROR_DATASERVICE_VCCRYPT_SUITE_OPTIONS_INIT_FAILURE;
-        goto dispose_alloc_opts;
-    }
+    /* the parser options are built once when the database is opened. */
+    vccert_parser_options_t* parser_options = &details->parser_options;
 
-    /* create parser options for parsing this block. */
-    if (VCCERT_STATUS_SUCCESS != vccert_parser_options_simple_init(&parser_options, &alloc_opts, &crypto_suite))
+    /* create parser for parsing this block. */
+    if (VCCERT_STATUS_SUCCESS != vccert_parser_init(parser_options, &parser, block_data, block_size))
     {
-        retval = AGENTD_ERROR_DATASERVICE_VCCERT_PARSER_OPTIONS_INIT_FAILURE;
-        goto dispose_crypto_suite;
+        retval = AGENTD_ERROR_DATASERVICE_VCCERT_PARSER_INIT_FAILURE;
+        goto done;
     }
 
-    /* create parser for parsing this block. */
-    if (VCCERT_STATUS_SUCCESS != vccert_parser_init(&parser_options, &parser, block_data, block_size))
+    /* parse the wrapped transactions before taking the writer lock.  Any
+     * failure is reported after the block constraints are checked. */
+    children_retval =
+        dataservice_block_make_collect_children(
+            &parser, &children, &child_count);
+    if (AGENTD_STATUS_SUCCESS == children_retval)
     {
-        retval = AGENTD_ERROR_DATASERVICE_VCCERT_PARSER_INIT_FAILURE;
-        goto dispose_parser_options;
+        children_retval =
+            dataservice_block_make_parse_children(
+                details->parse_pool, parser_options, children, child_count);
     }
 
     /* create the child transaction. */
-    retval = dataservice_create_child_trasaction(details->env, dtxn_ctx, &txn);
+    retval = dataservice_nested_txn_begin(details, parent, 0, &txn);
     if (AGENTD_STATUS_SUCCESS != retval)
     {
-        txn = NULL;
-        goto dispose_parser;
+        goto free_children;
     }
 
     /* query the end node. */
@@ -241,26 +269,21 @@ int dataservice_block_make(
         goto maybe_transaction_abort;
     }
 
-    /* get the first wrapped transaction. */
-    const uint8_t* wrapped_transaction_raw = NULL;
-    size_t wrapped_transaction_raw_size;
-    if (VCCERT_STATUS_SUCCESS != vccert_parser_find_short(&parser, VCCERT_FIELD_TYPE_WRAPPED_TRANSACTION_TUPLE, &wrapped_transaction_raw, &wrapped_transaction_raw_size))
+    /* every wrapped transaction must have parsed. */
+    if (AGENTD_STATUS_SUCCESS != children_retval)
     {
-        /* there must be at least one transaction. */
-        retval = AGENTD_ERROR_DATASERVICE_NO_CHILD_TRANSACTIONS;
+        retval = children_retval;
         goto maybe_transaction_abort;
     }
 
-    /* get the first child transaction id. */
-    uint8_t first_child_txn_id[16];
-    retval = dataservice_make_block_get_first_transaction_id(
-        &parser_options, wrapped_transaction_raw,
-        wrapped_transaction_raw_size, first_child_txn_id);
-    if (AGENTD_STATUS_SUCCESS != retval)
-    {
-        /* we need the first transaction id. */
-        goto maybe_transaction_abort;
-    }
+    /* catch the id filter up to the previous block, so that this block can
+     * be added to it.  A filter that can't be synced is left behind, and
+     * catches up on a later lookup. */
+    id_filter_synced =
+        (AGENTD_STATUS_SUCCESS == dataservice_id_filter_sync(details, txn));
+
+    /* the first child transaction id links the block to its transactions. */
+    const uint8_t* first_child_txn_id = children[0].txn_id;
 
     /* insert block into the database. */
     retval = dataservice_make_block_insert_block(
@@ -304,52 +327,58 @@ int dataservice_block_make(
         }
     }
 
-    /* iterate through each wrapped transaction. */
-    while (NULL != wrapped_transaction_raw)
+    /* apply each parsed transaction in block order. */
+    for (size_t i = 0; i < child_count; ++i)
     {
-        /* process this transaction. */
         retval = dataservice_block_make_process_child(
-            child, &parser_options, details->txn_db,
-            details->artifact_db, txn, expected_block_height,
-            block_id, wrapped_transaction_raw,
-            wrapped_transaction_raw_size);
+            child, details->txn_db, details->artifact_db,
+            details->artifact_txn_db, txn, expected_block_height, block_id,
+            &children[i]);
         if (AGENTD_STATUS_SUCCESS != retval)
         {
             goto maybe_transaction_abort;
         }
+    }
 
-        /* get the next transaction from the block. */
-        if (VCCERT_STATUS_SUCCESS != vccert_parser_find_next(&parser, &wrapped_transaction_raw, &wrapped_transaction_raw_size))
+    /* add the new ids to the id filter.  If this transaction is later rolled
+     * back, the filter is ahead of the database, and is rebuilt on the next
+     * sync. */
+    if (id_filter_synced)
+    {
+        dataservice_id_filter_add(&details->id_filter, block_id);
+        for (size_t i = 0; i < child_count; ++i)
         {
-            wrapped_transaction_raw = NULL;
+            dataservice_id_filter_add(
+                &details->id_filter, children[i].txn_id);
+            dataservice_id_filter_add(
+                &details->id_filter, children[i].artifact_id);
         }
+
+        details->id_filter.height = expected_block_height;
+    }
+
+    /* commit transaction, unless it is the parent. */
+    if (txn != parent)
+    {
+        mdb_txn_commit(txn);
     }
 
-    /* commit transaction. */
-    mdb_txn_commit(txn);
     txn = NULL;
 
     /* success. */
     retval = AGENTD_STATUS_SUCCESS;
 
 maybe_transaction_abort:
-    if (NULL != txn)
+    if (NULL != txn && txn != parent)
     {
         mdb_txn_abort(txn);
     }
 
-dispose_parser_options:
-    dispose((disposable_t*)&parser_options);
+free_children:
+    free(children);
 
-dispose_parser:
     dispose((disposable_t*)&parser);
 
-dispose_crypto_suite:
-    dispose((disposable_t*)&crypto_suite);
-
-dispose_alloc_opts:
-    dispose((disposable_t*)&alloc_opts);
-
 done:
     return retval;
 }
@@ -578,88 +607,138 @@ static int dataservice_block_make_update_end(
 }
 
 /**
- * \brief Get the first transaction id from the first child transaction.
+ * \brief Collect the wrapped transactions in a block.
  *
- * \param parser_options    The options for parsing certificates.
- * \param txn_cert          The certificate for this transaction.
- * \param txn_cert_size     The size of the transaction certificate.
- * \param first_child_txn_id The first child transaction id to update.
+ * \param parser            The parser for the block certificate.
+ * \param children          Pointer to receive the array of wrapped
+ *                          transactions, which the caller must free.
+ * \param count             Pointer to receive the number of wrapped
+ *                          transactions.
  *
  * \returns a status code indicating success or failure.
  *      - AGENTD_STATUS_SUCCESS on success.
- *      - AGENTD_ERROR_DATASERVICE_VCCERT_PARSER_INIT_FAILURE if this
- *        function failed to initialize a parser.
- *      - AGENTD_ERROR_DATASERVICE_MISSING_CHILD_TRANSACTION_UUID if a child
- *        transaction is missing its transaction UUID.
+ *      - AGENTD_ERROR_DATASERVICE_NO_CHILD_TRANSACTIONS if there is not at
+ *        least one child transaction in this block.
+ *      - AGENTD_ERROR_GENERAL_OUT_OF_MEMORY if an out of memory condition was
+ *        encountered during this operation.
  */
-static int dataservice_make_block_get_first_transaction_id(
-    vccert_parser_options_t* parser_options,
-    const uint8_t* txn_cert, size_t txn_cert_size,
-    uint8_t* first_child_txn_id)
+static int dataservice_block_make_collect_children(
+    vccert_parser_context_t* parser,
+    dataservice_block_make_child_t** children, size_t* count)
 {
-    int retval = 0;
-    vccert_parser_context_t parser;
-    MODEL_ASSERT(NULL != parser_options);
-    MODEL_ASSERT(NULL != txn_cert);
-    MODEL_ASSERT(txn_cert_size > 0);
-    MODEL_ASSERT(NULL != first_child_txn_id);
+    const uint8_t* raw = NULL;
+    size_t raw_size = 0U;
+    size_t total = 0U;
 
-    /* create a parser for parsing this transaction. */
-    if (VCCERT_STATUS_SUCCESS != vccert_parser_init(parser_options, &parser, txn_cert, txn_cert_size))
+    MODEL_ASSERT(NULL != parser);
+    MODEL_ASSERT(NULL != children);
+    MODEL_ASSERT(NULL != count);
+
+    /* count the wrapped transactions. */
+    int status = vccert_parser_find_short(parser, VCCERT_FIELD_TYPE_WRAPPED_TRANSACTION_TUPLE, &raw, &raw_size);
+    while (VCCERT_STATUS_SUCCESS == status)
     {
-        retval = AGENTD_ERROR_DATASERVICE_VCCERT_PARSER_INIT_FAILURE;
-        goto done;
+        ++total;
+        status = vccert_parser_find_next(parser, &raw, &raw_size);
     }
 
-    /* get the transaction id. */
-    const uint8_t* transaction_id = NULL;
-    size_t transaction_id_size = 0U;
-    if (VCCERT_STATUS_SUCCESS != vccert_parser_find_short(&parser, VCCERT_FIELD_TYPE_CERTIFICATE_ID, &transaction_id, &transaction_id_size) || 16 != transaction_id_size)
+    /* there must be at least one transaction. */
+    if (0U == total)
     {
-        retval = AGENTD_ERROR_DATASERVICE_MISSING_CHILD_TRANSACTION_UUID;
-        goto dispose_parser;
+        return AGENTD_ERROR_DATASERVICE_NO_CHILD_TRANSACTIONS;
     }
 
-    /* copy the transaction id. */
-    memcpy(first_child_txn_id, transaction_id, 16);
+    /* allocate the transaction array. */
+    *children = (dataservice_block_make_child_t*)
+        malloc(total * sizeof(dataservice_block_make_child_t));
+    if (NULL == *children)
+    {
+        return AGENTD_ERROR_GENERAL_OUT_OF_MEMORY;
+    }
 
-    /* success. */
-    retval = AGENTD_STATUS_SUCCESS;
+    /* record each wrapped transaction in block order. */
+    memset(*children, 0, total * sizeof(dataservice_block_make_child_t));
+    status = vccert_parser_find_short(parser, VCCERT_FIELD_TYPE_WRAPPED_TRANSACTION_TUPLE, &raw, &raw_size);
+    for (size_t i = 0; i < total && VCCERT_STATUS_SUCCESS == status; ++i)
+    {
+        (*children)[i].txn_cert = raw;
+        (*children)[i].txn_cert_size = raw_size;
+        status = vccert_parser_find_next(parser, &raw, &raw_size);
+    }
 
-dispose_parser:
-    dispose((disposable_t*)&parser);
+    *count = total;
 
-done:
-    return retval;
+    return AGENTD_STATUS_SUCCESS;
 }
 
 /**
- * \brief Process a child transaction, updating the database.
+ * \brief Parse wrapped transactions, using the worker pool for large blocks.
  *
- * \param child             The child context for the data service.
+ * \param pool              The block parse worker pool.
  * \param parser_options    The options for parsing certificates.
- * \param txn_db            The transaction database to update.
- * \param artifact_db       The artifact database to update.
- * \param txn               The transaction under which updates are done.
- * \param height            The height of the block to which this transaction
- *                          belongs.
- * \param block_id          The block identifier to which this transaction
- *                          belongs.
- * \param txn_cert          The certificate for this transaction.
- * \param txn_cert_size     The size of the transaction certificate.
+ * \param children          The wrapped transactions to parse.
+ * \param count             The number of wrapped transactions.
  *
- * \returns a status code indicating success or failure.
+ * \returns the status of the first wrapped transaction, in block order, that
+ * failed to parse, or AGENTD_STATUS_SUCCESS if all were parsed.
+ */
+static int dataservice_block_make_parse_children(
+    workpool* pool, vccert_parser_options_t* parser_options,
+    dataservice_block_make_child_t* children, size_t count)
+{
+    dataservice_block_make_parse_work_t work;
+
+    MODEL_ASSERT(NULL != parser_options);
+    MODEL_ASSERT(NULL != children);
+
+    /* small blocks are parsed inline by the pool. */
+    work.parser_options = parser_options;
+    work.children = children;
+    workpool_run(
+        pool, &dataservice_block_make_parse_slice, &work, count,
+        DATASERVICE_BLOCK_MAKE_PARALLEL_MIN);
+
+    /* report the first failure in block order. */
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (AGENTD_STATUS_SUCCESS != children[i].status)
+        {
+            return children[i].status;
+        }
+    }
+
+    return AGENTD_STATUS_SUCCESS;
+}
+
+/**
+ * \brief Parse a slice of wrapped transactions.
+ *
+ * \param context           The dataservice_block_make_parse_work_t for this
+ *                          block.
+ * \param begin             The first wrapped transaction in the slice.
+ * \param end               One past the last wrapped transaction.
+ */
+static void dataservice_block_make_parse_slice(
+    void* context, size_t begin, size_t end)
+{
+    dataservice_block_make_parse_work_t* work =
+        (dataservice_block_make_parse_work_t*)context;
+
+    MODEL_ASSERT(NULL != work);
+
+    for (size_t i = begin; i < end; ++i)
+    {
+        dataservice_block_make_parse_child(
+            work->parser_options, &work->children[i]);
+    }
+}
+
+/**
+ * \brief Parse a wrapped transaction, extracting the fields needed to apply
+ * it to the database.
+ *
+ * On return, the status field of the transaction is set to one of:
  *      - AGENTD_STATUS_SUCCESS on success.
- *      - AGENTD_ERROR_DATASERVICE_NOT_FOUND if the transaction uuid could not
- *        be found.
- *      - AGENTD_ERROR_GENERAL_OUT_OF_MEMORY if an out of memory condition was
- *        encountered during this operation.
- *      - AGENTD_ERROR_DATASERVICE_MDB_GET_FAILURE if this function failed to
- *        read from the database.
- *      - AGENTD_ERROR_DATASERVICE_MDB_PUT_FAILURE if this function failed to
- *        update the database.
- *      - AGENTD_ERROR_DATASERVICE_MDB_DEL_FAILURE if this function failed to
- *        delete from the database.
  *      - AGENTD_ERROR_DATASERVICE_VCCERT_PARSER_INIT_FAILURE if this
  *        function failed to initialize a parser.
  *      - AGENTD_ERROR_DATASERVICE_MISSING_CHILD_TRANSACTION_UUID if a child
@@ -670,54 +749,50 @@ done:
  *        transaction is missing its artifact UUID.
  *      - AGENTD_ERROR_DATASERVICE_MISSING_CHILD_STATE if a child transaction is
  *        missing its state field.
- *      - AGENTD_ERROR_DATASERVICE_INVALID_ARTIFACT_NODE_SIZE if an invalid
- *        artifact node was encountered.
+ *
+ * \param parser_options    The options for parsing certificates.
+ * \param txn_child         The wrapped transaction to parse.
  */
-static int dataservice_block_make_process_child(
-    dataservice_child_context_t* child,
-    vccert_parser_options_t* parser_options, MDB_dbi txn_db,
-    MDB_dbi artifact_db, MDB_txn* txn, uint64_t height,
-    const uint8_t* block_id, const uint8_t* txn_cert, size_t txn_cert_size)
+static void dataservice_block_make_parse_child(
+    vccert_parser_options_t* parser_options,
+    dataservice_block_make_child_t* txn_child)
 {
-    int retval = 0;
     vccert_parser_context_t parser;
     MODEL_ASSERT(NULL != parser_options);
-    MODEL_ASSERT(NULL != txn);
-    MODEL_ASSERT(NULL != txn_cert);
-    MODEL_ASSERT(txn_cert_size > 0);
+    MODEL_ASSERT(NULL != txn_child);
+    MODEL_ASSERT(NULL != txn_child->txn_cert);
 
     /* create a parser for parsing this transaction. */
-    if (VCCERT_STATUS_SUCCESS != vccert_parser_init(parser_options, &parser, txn_cert, txn_cert_size))
+    if (VCCERT_STATUS_SUCCESS != vccert_parser_init(parser_options, &parser, txn_child->txn_cert, txn_child->txn_cert_size))
     {
-        retval = AGENTD_ERROR_DATASERVICE_VCCERT_PARSER_INIT_FAILURE;
-        goto done;
+        txn_child->status = AGENTD_ERROR_DATASERVICE_VCCERT_PARSER_INIT_FAILURE;
+        return;
     }
 
     /* get the transaction id. */
-    const uint8_t* transaction_id = NULL;
     size_t transaction_id_size = 0U;
-    if (VCCERT_STATUS_SUCCESS != vccert_parser_find_short(&parser, VCCERT_FIELD_TYPE_CERTIFICATE_ID, &transaction_id, &transaction_id_size) || 16 != transaction_id_size)
+    if (VCCERT_STATUS_SUCCESS != vccert_parser_find_short(&parser, VCCERT_FIELD_TYPE_CERTIFICATE_ID, &txn_child->txn_id, &transaction_id_size) || 16 != transaction_id_size)
     {
-        retval = AGENTD_ERROR_DATASERVICE_MISSING_CHILD_TRANSACTION_UUID;
+        txn_child->status =
+            AGENTD_ERROR_DATASERVICE_MISSING_CHILD_TRANSACTION_UUID;
         goto dispose_parser;
     }
 
     /* get the previous transaction id. */
-    const uint8_t* prev_transaction_id = NULL;
     size_t prev_transaction_id_size = 0U;
-    if (VCCERT_STATUS_SUCCESS != vccert_parser_find_short(&parser, VCCERT_FIELD_TYPE_PREVIOUS_CERTIFICATE_ID, &prev_transaction_id, &prev_transaction_id_size) || 16 != prev_transaction_id_size)
+    if (VCCERT_STATUS_SUCCESS != vccert_parser_find_short(&parser, VCCERT_FIELD_TYPE_PREVIOUS_CERTIFICATE_ID, &txn_child->prev_txn_id, &prev_transaction_id_size) || 16 != prev_transaction_id_size)
     {
-        retval =
+        txn_child->status =
             AGENTD_ERROR_DATASERVICE_MISSING_CHILD_PREVIOUS_TRANSACTION_UUID;
         goto dispose_parser;
     }
 
     /* get the artifact id. */
-    const uint8_t* artifact_id = NULL;
     size_t artifact_id_size = 0U;
-    if (VCCERT_STATUS_SUCCESS != vccert_parser_find_short(&parser, VCCERT_FIELD_TYPE_ARTIFACT_ID, &artifact_id, &artifact_id_size) || 16 != artifact_id_size)
+    if (VCCERT_STATUS_SUCCESS != vccert_parser_find_short(&parser, VCCERT_FIELD_TYPE_ARTIFACT_ID, &txn_child->artifact_id, &artifact_id_size) || 16 != artifact_id_size)
     {
-        retval = AGENTD_ERROR_DATASERVICE_MISSING_CHILD_ARTIFACT_UUID;
+        txn_child->status =
+            AGENTD_ERROR_DATASERVICE_MISSING_CHILD_ARTIFACT_UUID;
         goto dispose_parser;
     }
 
@@ -726,14 +801,69 @@ static int dataservice_block_make_process_child(
     size_t state_raw_size = 0;
     if (VCCERT_STATUS_SUCCESS != vccert_parser_find_short(&parser, VCCERT_FIELD_TYPE_NEW_ARTIFACT_STATE, &state_raw, &state_raw_size) || sizeof(uint32_t) != state_raw_size)
     {
-        retval = AGENTD_ERROR_DATASERVICE_MISSING_CHILD_STATE;
+        txn_child->status = AGENTD_ERROR_DATASERVICE_MISSING_CHILD_STATE;
         goto dispose_parser;
     }
 
     /* decode the state field. */
     uint32_t net_state;
     memcpy(&net_state, state_raw, sizeof(uint32_t));
-    uint32_t state = ntohl(net_state);
+    txn_child->state = ntohl(net_state);
+
+    /* success. */
+    txn_child->status = AGENTD_STATUS_SUCCESS;
+
+dispose_parser:
+    dispose((disposable_t*)&parser);
+}
+
+/**
+ * \brief Process a parsed child transaction, updating the database.
+ *
+ * \param child             The child context for the data service.
+ * \param txn_db            The transaction database to update.
+ * \param artifact_db       The artifact database to update.
+ * \param artifact_txn_db   The artifact transaction index to update.
+ * \param txn               The transaction under which updates are done.
+ * \param height            The height of the block to which this transaction
+ *                          belongs.
+ * \param block_id          The block identifier to which this transaction
+ *                          belongs.
+ * \param txn_child         The parsed wrapped transaction.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_DATASERVICE_NOT_FOUND if the transaction uuid could not
+ *        be found.
+ *      - AGENTD_ERROR_GENERAL_OUT_OF_MEMORY if an out of memory condition was
+ *        encountered during this operation.
+ *      - AGENTD_ERROR_DATASERVICE_MDB_GET_FAILURE if this function failed to
+ *        read from the database.
+ *      - AGENTD_ERROR_DATASERVICE_MDB_PUT_FAILURE if this function failed to
+ *        update the database.
+ *      - AGENTD_ERROR_DATASERVICE_MDB_DEL_FAILURE if this function failed to
+ *        delete from the database.
+ *      - AGENTD_ERROR_DATASERVICE_INVALID_ARTIFACT_NODE_SIZE if an invalid
+ *        artifact node was encountered.
+ */
+static int dataservice_block_make_process_child(
+    dataservice_child_context_t* child, MDB_dbi txn_db,
+    MDB_dbi artifact_db, MDB_dbi artifact_txn_db, MDB_txn* txn,
+    uint64_t height, const uint8_t* block_id,
+    const dataservice_block_make_child_t* txn_child)
+{
+    int retval = 0;
+    MODEL_ASSERT(NULL != txn);
+    MODEL_ASSERT(NULL != txn_child);
+    MODEL_ASSERT(AGENTD_STATUS_SUCCESS == txn_child->status);
+
+    /* the fields were extracted when the block was parsed. */
+    const uint8_t* transaction_id = txn_child->txn_id;
+    const uint8_t* prev_transaction_id = txn_child->prev_txn_id;
+    const uint8_t* artifact_id = txn_child->artifact_id;
+    const uint8_t* txn_cert = txn_child->txn_cert;
+    size_t txn_cert_size = txn_child->txn_cert_size;
+    uint32_t state = txn_child->state;
 
     /* allocate memory for the transaction node. */
     size_t txn_rec_size = sizeof(data_transaction_node_t) + txn_cert_size;
@@ -741,7 +871,7 @@ static int dataservice_block_make_process_child(
     if (NULL == txn_rec_data)
     {
         retval = AGENTD_ERROR_GENERAL_OUT_OF_MEMORY;
-        goto dispose_parser;
+        goto done;
     }
 
     /* set up transaction node data. */
@@ -804,6 +934,14 @@ static int dataservice_block_make_process_child(
         goto free_data;
     }
 
+    /* append this transaction to the artifact's history. */
+    retval = dataservice_artifact_transaction_index_put(
+        artifact_txn_db, txn, artifact_id, height, transaction_id);
+    if (AGENTD_STATUS_SUCCESS != retval)
+    {
+        goto free_data;
+    }
+
     /* success. */
     retval = AGENTD_STATUS_SUCCESS;
 
@@ -811,9 +949,6 @@ free_data:
     memset(txn_rec_data, 0, txn_rec_size);
     free(txn_rec_data);
 
-dispose_parser:
-    dispose((disposable_t*)&parser);
-
 done:
     return retval;
 }
@@ -1246,34 +1381,3 @@ cleanup_blocknode:
 done:
     return retval;
 }
-
-/**
- * \brief Create a child transaction for this block operation.
- *
- * \param env               The database environment for this transaction.
- * \param dtxn_ctx          The optional dataservice transaction context from
- *                          which this transaction may be derived.
- * \param txn               Pointer to the database transaction pointer to be
- *                          updated on success.
- *
- * \returns a status code indicating success or failure.
- *      - AGENTD_STATUS_SUCCESS on success.
- *      - AGENTD_ERROR_DATASERVICE_MDB_TXN_BEGIN_FAILURE if this function
- *        failed to begin a transaction.
- */
-static int dataservice_create_child_trasaction(
-    MDB_env* env, dataservice_transaction_context_t* dtxn_ctx, MDB_txn** txn)
-{
-    /* set the parent transaction. */
-    MDB_txn* parent = (NULL != dtxn_ctx) ? dtxn_ctx->txn : NULL;
-
-    /* create the transaction under which this operation occurs. */
-    if (0 != mdb_txn_begin(env, parent, 0, txn))
-    {
-        *txn = NULL;
-        return AGENTD_ERROR_DATASERVICE_MDB_TXN_BEGIN_FAILURE;
-    }
-
-    /* success */
-    return AGENTD_STATUS_SUCCESS;
-}
@@ -0,0 +1,135 @@
+/**
+ * \file dataservice/dataservice_block_node_read.c
+ *
+ * \brief Read only the block node for a block ID.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/dataservice/private/dataservice.h>
+#include <agentd/status_codes.h>
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vccert/certificate_types.h>
+#include <vccrypt/compare.h>
+
+#include "dataservice_internal.h"
+
+/* zero uuid. */
+static const uint8_t zero_uuid[16] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+/**
+ * \brief Read only the block node for a given block ID.
+ *
+ * The caller is responsible for checking the capabilities of the child
+ * context before calling this function.
+ *
+ * \param child         The child context for this operation.
+ * \param dtxn_ctx      The dataservice transaction context for this operation,
+ *                      or NULL.
+ * \param block_id      The block ID to query.
+ * \param node          The block node to populate.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_DATASERVICE_NOT_FOUND if the block was not found.
+ *      - AGENTD_ERROR_DATASERVICE_MDB_TXN_BEGIN_FAILURE if this function failed
+ *        to begin a transaction.
+ *      - AGENTD_ERROR_DATASERVICE_MDB_GET_FAILURE if this function failed to
+ *        read data from the database.
+ *      - AGENTD_ERROR_DATASERVICE_INVALID_STORED_BLOCK_NODE if the block node
+ *        read from the database could not be deserialized.
+ */
+int dataservice_block_node_read(
+    dataservice_child_context_t* child,
+    dataservice_transaction_context_t* dtxn_ctx, const uint8_t* block_id,
+    data_block_node_t* node)
+{
+    int retval = 0;
+    MDB_txn* txn = NULL;
+
+    /* parameter sanity check. */
+    MODEL_ASSERT(NULL != child);
+    MODEL_ASSERT(NULL != child->root);
+    MODEL_ASSERT(NULL != block_id);
+    MODEL_ASSERT(NULL != node);
+
+    /* get the details for this database connection. */
+    dataservice_database_details_t* details =
+        (dataservice_database_details_t*)child->root->details;
+
+    /* set the parent transaction. */
+    MDB_txn* parent = (NULL != dtxn_ctx) ? dtxn_ctx->txn : NULL;
+
+    /* if the parent transaction is NULL, begin a transaction, or else use the
+     * parent transaction. */
+    if (NULL == parent)
+    {
+        if (0 != mdb_txn_begin(details->env, NULL, MDB_RDONLY, &txn))
+        {
+            retval = AGENTD_ERROR_DATASERVICE_MDB_TXN_BEGIN_FAILURE;
+            goto done;
+        }
+    }
+
+    /* set the transaction to be used from now on. */
+    MDB_txn* query_txn = (NULL != txn) ? txn : parent;
+
+    /* query the entry. */
+    MDB_val lkey;
+    lkey.mv_size = 16;
+    lkey.mv_data = (uint8_t*)block_id;
+    MDB_val lval;
+    memset(&lval, 0, sizeof(lval));
+
+    /* attempt to read this node from the database. */
+    retval = mdb_get(query_txn, details->block_db, &lkey, &lval);
+    if (MDB_NOTFOUND == retval &&
+        0 == crypto_memcmp(block_id, vccert_certificate_type_uuid_root_block, 16))
+    {
+        /* the root block is stored as a bare node under the zero uuid. */
+        lkey.mv_data = (void*)zero_uuid;
+        retval = mdb_get(query_txn, details->block_db, &lkey, &lval);
+    }
+
+    /* check the query result value. */
+    if (MDB_NOTFOUND == retval)
+    {
+        /* the value was not found. */
+        retval = AGENTD_ERROR_DATASERVICE_NOT_FOUND;
+        goto maybe_transaction_abort;
+    }
+    else if (0 != retval)
+    {
+        /* some error has occurred. */
+        retval = AGENTD_ERROR_DATASERVICE_MDB_GET_FAILURE;
+        goto maybe_transaction_abort;
+    }
+
+    /* verify that this value is large enough to be a node value. */
+    if (lval.mv_size < sizeof(data_block_node_t))
+    {
+        retval = AGENTD_ERROR_DATASERVICE_INVALID_STORED_BLOCK_NODE;
+        goto maybe_transaction_abort;
+    }
+
+    /* copy only the node; the certificate is left in the map. */
+    memcpy(node, lval.mv_data, sizeof(data_block_node_t));
+
+    /* success. */
+    retval = AGENTD_STATUS_SUCCESS;
+
+    /* fall-through. */
+
+maybe_transaction_abort:
+    if (NULL != txn)
+    {
+        mdb_txn_abort(txn);
+    }
+
+done:
+    return retval;
+}
@@ -23,6 +23,11 @@
  * this transaction is committed or aborted either before the parent transaction
  * is committed or aborted or before the data service is destroyed.
  *
+ * A child transaction can't be begun when the database is opened with
+ * DATASTORE_FLAG_WRITEMAP.  Data service calls given a parent transaction then
+ * run directly in the parent, so the parent must be aborted if such a call
+ * fails.
+ *
  * \param child         The child context under which this transaction should be
  *                      begun.
  * \param txn           The transaction to begin.
@@ -79,8 +84,8 @@ int dataservice_data_txn_begin(
     }
     else
     {
+        retval = AGENTD_STATUS_SUCCESS;
     }
-    retval = AGENTD_STATUS_SUCCESS;
 
     /* erase the structure if we fail. */
     if (AGENTD_STATUS_SUCCESS != retval)
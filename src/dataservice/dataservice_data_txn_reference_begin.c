@@ -0,0 +1,94 @@
+/**
+ * \file dataservice/dataservice_data_txn_reference_begin.c
+ *
+ * \brief Begin a read for a value to be written by reference.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/dataservice/private/dataservice.h>
+#include <agentd/status_codes.h>
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <unistd.h>
+#include <vpr/parameters.h>
+
+#include "dataservice_internal.h"
+
+/**
+ * \brief Begin a read for a value to be written by reference.
+ *
+ * If fewer responses reference the database map than the lesser of \ref
+ * DATASERVICE_MAX_REFERENCED_RESPONSES and half of the reader table, a read
+ * transaction is begun and counted against the instance.  If the limit is
+ * reached or the transaction cannot begin, no transaction is held, and the
+ * caller must read the value as a copy and store it in the reference.
+ *
+ * \param ref           Pointer to receive the heap allocated reference, which
+ *                      must be released with \ref
+ *                      dataservice_data_txn_reference_release().
+ * \param inst          The instance on which the read occurs.
+ * \param ctx           The child context for this read.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_GENERAL_OUT_OF_MEMORY if an out-of-memory condition was
+ *        encountered in this operation.
+ */
+int dataservice_data_txn_reference_begin(
+    dataservice_data_txn_reference_t** ref, dataservice_instance_t* inst,
+    dataservice_child_context_t* ctx)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != ref);
+    MODEL_ASSERT(NULL != inst);
+    MODEL_ASSERT(NULL != ctx);
+
+    /* allocate the reference. */
+    *ref = (dataservice_data_txn_reference_t*)
+        malloc(sizeof(dataservice_data_txn_reference_t));
+    if (NULL == *ref)
+    {
+        return AGENTD_ERROR_GENERAL_OUT_OF_MEMORY;
+    }
+
+    memset(*ref, 0, sizeof(dataservice_data_txn_reference_t));
+    (*ref)->inst = inst;
+
+    /* get the details for this database connection. */
+    dataservice_database_details_t* details =
+        (dataservice_database_details_t*)ctx->root->details;
+
+    /* leave at least half of the reader table for other readers, including
+     * the copy path below and other processes sharing this database. */
+    unsigned int max_readers = 0U;
+    if (0 != mdb_env_get_maxreaders(details->env, &max_readers))
+    {
+        return AGENTD_STATUS_SUCCESS;
+    }
+
+    size_t limit = max_readers / 2U;
+    if (limit > DATASERVICE_MAX_REFERENCED_RESPONSES)
+    {
+        limit = DATASERVICE_MAX_REFERENCED_RESPONSES;
+    }
+
+    /* past the limit, the value is copied so no reader slot is held. */
+    if (inst->referenced_responses >= limit)
+    {
+        return AGENTD_STATUS_SUCCESS;
+    }
+
+    /* if the reader table is full, the value is copied instead. */
+    if (AGENTD_STATUS_SUCCESS
+            != dataservice_data_txn_begin(ctx, &(*ref)->dtxn, NULL, true))
+    {
+        return AGENTD_STATUS_SUCCESS;
+    }
+
+    /* this reference now holds a read transaction. */
+    (*ref)->txn_open = true;
+    ++inst->referenced_responses;
+
+    return AGENTD_STATUS_SUCCESS;
+}
@@ -0,0 +1,57 @@
+/**
+ * \file dataservice/dataservice_data_txn_reference_release.c
+ *
+ * \brief Release a value once it is no longer referenced.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/dataservice/private/dataservice.h>
+#include <agentd/inet.h>
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <unistd.h>
+#include <vpr/parameters.h>
+
+#include "dataservice_internal.h"
+
+/**
+ * \brief Release a value that was written by reference.
+ *
+ * This callback aborts the held read transaction, or frees the copied value,
+ * and then frees the reference passed as the user context once the write
+ * buffer no longer references its value.
+ *
+ * \param data          The referenced data (unused).
+ * \param size          The size of the referenced data (unused).
+ * \param user_context  The dataservice_data_txn_reference_t to release.
+ */
+void dataservice_data_txn_reference_release(
+    const void* data, size_t size, void* user_context)
+{
+    (void)data;
+    (void)size;
+    dataservice_data_txn_reference_t* ref =
+        (dataservice_data_txn_reference_t*)user_context;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != ref);
+    MODEL_ASSERT(NULL != ref->inst);
+
+    if (ref->txn_open)
+    {
+        /* abort the read transaction, releasing the referenced pages. */
+        dataservice_data_txn_abort(&ref->dtxn);
+        --ref->inst->referenced_responses;
+    }
+    else if (NULL != ref->copy)
+    {
+        /* clean up the copied value. */
+        memset(ref->copy, 0, ref->copy_size);
+        free(ref->copy);
+    }
+
+    /* clean up the reference. */
+    memset(ref, 0, sizeof(dataservice_data_txn_reference_t));
+    free(ref);
+}
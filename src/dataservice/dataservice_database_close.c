@@ -12,6 +12,9 @@
 
 #include "dataservice_internal.h"
 
+RCPR_IMPORT_allocator_as(rcpr);
+RCPR_IMPORT_resource;
+
 /**
  * \brief Close the database.
  *
@@ -37,10 +40,23 @@ void dataservice_database_close(
     mdb_dbi_close(details->env, details->pq_db);
     mdb_dbi_close(details->env, details->artifact_db);
     mdb_dbi_close(details->env, details->height_db);
+    mdb_dbi_close(details->env, details->artifact_txn_db);
 
     /* close database environment. */
     mdb_env_close(details->env);
 
+    /* release the id filter. */
+    dataservice_id_filter_release(&details->id_filter);
+
+    /* stop the block parse workers. */
+    resource_release(workpool_resource_handle(details->parse_pool));
+    resource_release(rcpr_allocator_resource_handle(details->rcpr_alloc));
+
+    /* dispose the cached parser options, crypto suite, and allocator. */
+    dispose((disposable_t*)&details->parser_options);
+    dispose((disposable_t*)&details->crypto_suite);
+    dispose((disposable_t*)&details->alloc_opts);
+
     /* release details. */
     memset(details, 0, sizeof(dataservice_database_details_t));
     free(details);
@@ -8,27 +8,45 @@
 
 #include <agentd/status_codes.h>
 #include <cbmc/model_assert.h>
+#include <string.h>
 #include <unistd.h>
 #include <vpr/parameters.h>
 
 #include "dataservice_internal.h"
 
+RCPR_IMPORT_allocator_as(rcpr);
+RCPR_IMPORT_resource;
+
+/* forward decls */
+static unsigned int dataservice_database_env_flags(uint32_t datastore_flags);
+
 /**
  * \brief Open the database using the given data directory.
  *
  * \param ctx               The initialized root context that stores this
  *                          database.
  * \param max_database_size The maximum size for this database.
+ * \param datastore_flags   The DATASTORE_FLAG_* tuning flags for the database.
+ * \param max_readers       The size of the database reader table, or 0 for
+ *                          the default.
  * \param datadir           The directory where the database is stored.
  *
  * \returns a status code indicating success or failure.
  *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_GENERAL_OUT_OF_MEMORY if this function could not
+ *        allocate the database details or the block parse workers.
+ *      - AGENTD_ERROR_DATASERVICE_VCCRYPT_SUITE_OPTIONS_INIT_FAILURE if this
+ *        function failed to initialize crypto suite options.
+ *      - AGENTD_ERROR_DATASERVICE_VCCERT_PARSER_OPTIONS_INIT_FAILURE if this
+ *        function failed to initialize parser options.
  *      - AGENTD_ERROR_DATASERVICE_MDB_ENV_CREATE_FAILURE if this function
  *        failed to create a database environment.
  *      - AGENTD_ERROR_DATASERVICE_MDB_ENV_SET_MAPSIZE_FAILURE if this function
  *        failed to set the database map size.
  *      - AGENTD_ERROR_DATASERVICE_MDB_ENV_SET_MAXDBS_FAILURE if this function
  *        failed to set the maximum number of databases.
+ *      - AGENTD_ERROR_DATASERVICE_MDB_ENV_SET_MAXREADERS_FAILURE if this
+ *        function failed to set the maximum number of readers.
  *      - AGENTD_ERROR_DATASERVICE_MDB_ENV_OPEN_FAILURE if this function failed
  *        to open the database environment.
  *      - AGENTD_ERROR_DATASERVICE_MDB_TXN_BEGIN_FAILURE if this function failed
@@ -40,7 +58,7 @@
  */
 int dataservice_database_open(
     dataservice_root_context_t* ctx, uint64_t max_database_size,
-    const char* datadir)
+    uint32_t datastore_flags, uint32_t max_readers, const char* datadir)
 {
     int retval = 0;
     MDB_txn* txn;
@@ -59,11 +77,54 @@ int dataservice_database_open(
         goto done;
     }
 
+    /* clear the details structure. */
+    memset(details, 0, sizeof(dataservice_database_details_t));
+
+    /* create the allocator shared by certificate parsing. */
+    malloc_allocator_options_init(&details->alloc_opts);
+
+    /* create the crypto suite once, instead of on every block write. */
+    if (VCCRYPT_STATUS_SUCCESS !=
+            vccrypt_suite_options_init(
+                &details->crypto_suite, &details->alloc_opts,
+                VCCRYPT_SUITE_VELO_V1))
+    {
+        retval = AGENTD_ERROR_DATASERVICE_VCCRYPT_SUITE_OPTIONS_INIT_FAILURE;
+        goto dispose_alloc_opts;
+    }
+
+    /* create the certificate parser options used by block writes. */
+    if (VCCERT_STATUS_SUCCESS !=
+            vccert_parser_options_simple_init(
+                &details->parser_options, &details->alloc_opts,
+                &details->crypto_suite))
+    {
+        retval = AGENTD_ERROR_DATASERVICE_VCCERT_PARSER_OPTIONS_INIT_FAILURE;
+        goto dispose_crypto_suite;
+    }
+
+    /* create the allocator for the block parse workers. */
+    if (STATUS_SUCCESS != rcpr_malloc_allocator_create(&details->rcpr_alloc))
+    {
+        retval = AGENTD_ERROR_GENERAL_OUT_OF_MEMORY;
+        goto dispose_parser_options;
+    }
+
+    /* start the block parse workers once, instead of on every block write. */
+    if (STATUS_SUCCESS !=
+            workpool_create(
+                &details->parse_pool, details->rcpr_alloc,
+                DATASERVICE_BLOCK_MAKE_PARSE_THREADS))
+    {
+        retval = AGENTD_ERROR_GENERAL_OUT_OF_MEMORY;
+        goto release_rcpr_alloc;
+    }
+
     /* create the environment. */
     if (0 != mdb_env_create(&details->env))
     {
         retval = AGENTD_ERROR_DATASERVICE_MDB_ENV_CREATE_FAILURE;
-        goto free_details;
+        goto release_parse_pool;
     }
 
     /* set the database size to an arbitrarily large value. (16 terabytes). */
@@ -73,15 +134,29 @@ int dataservice_database_open(
         goto close_environment;
     }
 
-    /* We need 6 database handles. */
-    if (0 != mdb_env_set_maxdbs(details->env, 6))
+    /* We need 7 database handles. */
+    if (0 != mdb_env_set_maxdbs(details->env, 7))
     {
         retval = AGENTD_ERROR_DATASERVICE_MDB_ENV_SET_MAXDBS_FAILURE;
         goto close_environment;
     }
 
-    /* open the environment. */
-    if (0 != mdb_env_open(details->env, datadir, 0, 0600))
+    /* override the size of the reader table if requested. */
+    if (max_readers > 0
+     && 0 != mdb_env_set_maxreaders(details->env, max_readers))
+    {
+        retval = AGENTD_ERROR_DATASERVICE_MDB_ENV_SET_MAXREADERS_FAILURE;
+        goto close_environment;
+    }
+
+    /* open the environment. Read transactions are not tied to thread local
+     * storage, so that a block or transaction read can hold its read
+     * transaction open while its value is referenced by the write buffer. */
+    if (0 !=
+            mdb_env_open(
+                details->env, datadir,
+                MDB_NOTLS | dataservice_database_env_flags(datastore_flags),
+                0600))
     {
         retval = AGENTD_ERROR_DATASERVICE_MDB_ENV_OPEN_FAILURE;
         goto close_environment;
@@ -136,11 +211,34 @@ int dataservice_database_open(
         goto rollback_txn;
     }
 
+    /* open the artifact transaction index database. */
+    if (0 !=
+            mdb_dbi_open(
+                txn, "artifact_txn.db", MDB_CREATE, &details->artifact_txn_db))
+    {
+        retval = AGENTD_ERROR_DATASERVICE_MDB_DBI_OPEN_FAILURE;
+        goto rollback_txn;
+    }
+
+    /* build the artifact transaction index for an older database. */
+    retval = dataservice_artifact_transaction_index_rebuild(details, txn);
+    if (AGENTD_STATUS_SUCCESS != retval)
+    {
+        goto rollback_txn;
+    }
+
+    /* build the filter of known block, transaction, and artifact ids. */
+    retval = dataservice_id_filter_rebuild(details, txn);
+    if (AGENTD_STATUS_SUCCESS != retval)
+    {
+        goto rollback_txn;
+    }
+
     /* commit the open. */
     if (0 != mdb_txn_commit(txn))
     {
         retval = AGENTD_ERROR_DATASERVICE_MDB_TXN_COMMIT_FAILURE;
-        goto close_environment;
+        goto release_id_filter;
     }
 
     /* success. */
@@ -150,12 +248,61 @@ int dataservice_database_open(
 rollback_txn:
     mdb_txn_abort(txn);
 
+release_id_filter:
+    dataservice_id_filter_release(&details->id_filter);
+
 close_environment:
     mdb_env_close(details->env);
 
-free_details:
+release_parse_pool:
+    resource_release(workpool_resource_handle(details->parse_pool));
+
+release_rcpr_alloc:
+    resource_release(rcpr_allocator_resource_handle(details->rcpr_alloc));
+
+dispose_parser_options:
+    dispose((disposable_t*)&details->parser_options);
+
+dispose_crypto_suite:
+    dispose((disposable_t*)&details->crypto_suite);
+
+dispose_alloc_opts:
+    dispose((disposable_t*)&details->alloc_opts);
     free(details);
 
 done:
     return retval;
 }
+
+/**
+ * \brief Translate datastore tuning flags into LMDB environment flags.
+ *
+ * See the datastore section of the README for the durability trade-off of each
+ * flag.
+ *
+ * \param datastore_flags   The DATASTORE_FLAG_* tuning flags for the database.
+ *
+ * \returns the matching LMDB environment flags.
+ */
+static unsigned int dataservice_database_env_flags(uint32_t datastore_flags)
+{
+    unsigned int flags = 0U;
+
+    /* don't fsync the meta page after each commit. */
+    if (datastore_flags & DATASTORE_FLAG_NOMETASYNC)
+        flags |= MDB_NOMETASYNC;
+
+    /* write through a writable memory map. */
+    if (datastore_flags & DATASTORE_FLAG_WRITEMAP)
+        flags |= MDB_WRITEMAP;
+
+    /* turn off read-ahead on the memory map. */
+    if (datastore_flags & DATASTORE_FLAG_NORDAHEAD)
+        flags |= MDB_NORDAHEAD;
+
+    /* flush the writable memory map asynchronously. */
+    if (datastore_flags & DATASTORE_FLAG_MAPASYNC)
+        flags |= MDB_MAPASYNC;
+
+    return flags;
+}
@@ -115,6 +115,22 @@ int dataservice_decode_and_dispatch(
             return dataservice_decode_and_dispatch_transaction_get(
                 inst, sock, breq, payload_size);
 
+        /* handle transaction list get. */
+        case DATASERVICE_API_METHOD_APP_PQ_TRANSACTION_LIST_READ:
+            return dataservice_decode_and_dispatch_transaction_list_get(
+                inst, sock, breq, payload_size);
+
+        /* handle block range get. */
+        case DATASERVICE_API_METHOD_APP_BLOCK_RANGE_READ:
+            return dataservice_decode_and_dispatch_block_range_get(
+                inst, sock, breq, payload_size);
+
+        /* handle artifact transaction list get. */
+        case DATASERVICE_API_METHOD_APP_ARTIFACT_TRANSACTION_LIST_READ:
+            return
+                dataservice_decode_and_dispatch_artifact_transaction_list_get(
+                    inst, sock, breq, payload_size);
+
         /* handle transaction drop. */
         case DATASERVICE_API_METHOD_APP_PQ_TRANSACTION_DROP:
             return dataservice_decode_and_dispatch_transaction_drop(
@@ -125,6 +141,16 @@ int dataservice_decode_and_dispatch(
             return dataservice_decode_and_dispatch_transaction_promote(
                 inst, sock, breq, payload_size);
 
+        /* handle transaction batch update. */
+        case DATASERVICE_API_METHOD_APP_PQ_TRANSACTION_BATCH_UPDATE:
+            return dataservice_decode_and_dispatch_transaction_batch_update(
+                inst, sock, breq, payload_size);
+
+        /* handle id exists. */
+        case DATASERVICE_API_METHOD_APP_ID_EXISTS_READ:
+            return dataservice_decode_and_dispatch_id_exists(
+                inst, sock, breq, payload_size);
+
         /* handle artifact read. */
         case DATASERVICE_API_METHOD_APP_ARTIFACT_READ:
             return dataservice_decode_and_dispatch_artifact_read(
@@ -150,6 +176,13 @@ int dataservice_decode_and_dispatch(
             return dataservice_decode_and_dispatch_block_id_latest_read(
                 inst, sock, breq, payload_size);
 
+        /* handle block id next, prev, and with transaction reads. */
+        case DATASERVICE_API_METHOD_APP_BLOCK_ID_NEXT_READ:
+        case DATASERVICE_API_METHOD_APP_BLOCK_ID_PREV_READ:
+        case DATASERVICE_API_METHOD_APP_BLOCK_ID_WITH_TRANSACTION_READ:
+            return dataservice_decode_and_dispatch_block_id_link_read(
+                inst, sock, method, breq, payload_size);
+
         /* handle canonized transaction read. */
         case DATASERVICE_API_METHOD_APP_TRANSACTION_READ:
             return dataservice_decode_and_dispatch_canonized_transaction_get(
@@ -0,0 +1,180 @@
+/**
+ * \file dataservice/dataservice_decode_and_dispatch_artifact_transaction_list_get.c
+ *
+ * \brief Decode artifact transaction list get request and dispatch the call.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/dataservice/api.h>
+#include <agentd/dataservice/async_api.h>
+#include <agentd/dataservice/private/dataservice.h>
+#include <agentd/inet.h>
+#include <agentd/ipc.h>
+#include <agentd/status_codes.h>
+#include <cbmc/model_assert.h>
+#include <unistd.h>
+#include <vpr/parameters.h>
+
+#include "dataservice_internal.h"
+#include "dataservice_protocol_internal.h"
+
+/**
+ * \brief Decode and dispatch an artifact transaction list get request.
+ *
+ * Returns 0 on success or non-fatal error.  If a non-zero error message is
+ * returned, then a fatal error has occurred that should not be recovered from.
+ * Any additional information on the socket is suspect.
+ *
+ * \param inst          The instance on which the dispatch occurs.
+ * \param sock          The socket on which the request was received and the
+ *                      response is to be written.
+ * \param req           The request to be decoded and dispatched.
+ * \param size          The size of the request.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_GENERAL_OUT_OF_MEMORY if an out-of-memory condition was
+ *        encountered in this operation.
+ *      - AGENTD_ERROR_DATASERVICE_IPC_WRITE_DATA_FAILURE if data could not be
+ *        written to the client socket.
+ */
+int dataservice_decode_and_dispatch_artifact_transaction_list_get(
+    dataservice_instance_t* inst, ipc_socket_context_t* sock, void* req,
+    size_t size)
+{
+    int retval = 0;
+    bool dispose_dreq = false;
+    data_artifact_transaction_entry_t* entries = NULL;
+    uint8_t* payload = NULL;
+    size_t payload_size = 0U;
+
+    /* parameter sanity check. */
+    MODEL_ASSERT(NULL != inst);
+    MODEL_ASSERT(NULL != sock);
+    MODEL_ASSERT(NULL != req);
+
+    /* artifact transaction list get request structure. */
+    dataservice_request_artifact_transaction_list_get_t dreq;
+
+    /* parse the request payload. */
+    retval =
+        dataservice_decode_request_artifact_transaction_list_get(
+            req, size, &dreq);
+    if (AGENTD_STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* be sure to clean up dreq. */
+    dispose_dreq = true;
+
+    /* look up the child context. */
+    dataservice_child_context_t* ctx = NULL;
+    retval = dataservice_child_context_lookup(&ctx, inst, dreq.hdr.child_index);
+    if (AGENTD_STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* clamp the count to what a single response may hold. */
+    size_t count = dreq.max_count;
+    if (0U == count)
+    {
+        count = 1U;
+    }
+    else if (count > DATASERVICE_MAX_ARTIFACT_TRANSACTION_LIST_COUNT)
+    {
+        count = DATASERVICE_MAX_ARTIFACT_TRANSACTION_LIST_COUNT;
+    }
+
+    /* allocate the entries. */
+    entries =
+        (data_artifact_transaction_entry_t*)malloc(count * sizeof(*entries));
+    if (NULL == entries)
+    {
+        retval = AGENTD_ERROR_GENERAL_OUT_OF_MEMORY;
+        goto done;
+    }
+
+    /* read this page of the artifact's history. */
+    bool more = false;
+    retval =
+        dataservice_artifact_transaction_list_get(
+            ctx, NULL, dreq.artifact_id, dreq.start_height, dreq.start_index,
+            entries, &count, &more);
+    if (AGENTD_STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* | Artifact Transaction List Get response payload.                      */
+    /* | ---------------------------------------------------- | ----------- | */
+    /* | DATA                                                 | SIZE        | */
+    /* | ---------------------------------------------------- | ----------- | */
+    /* | more                                                 |  4 bytes    | */
+    /* | entries:                                             |             | */
+    /* |    txn_id                                            | 16 bytes    | */
+    /* |    height                                            |  8 bytes    | */
+    /* |    index                                             |  4 bytes    | */
+    /* | ---------------------------------------------------- | ----------- | */
+    payload_size =
+        sizeof(uint32_t) + count * DATASERVICE_ARTIFACT_TRANSACTION_ENTRY_SIZE;
+
+    /* allocate the response payload. */
+    payload = (uint8_t*)malloc(payload_size);
+    if (NULL == payload)
+    {
+        retval = AGENTD_ERROR_GENERAL_OUT_OF_MEMORY;
+        goto done;
+    }
+
+    /* encode the more flag. */
+    uint8_t* out = payload;
+    uint32_t net_more = htonl(more ? 1U : 0U);
+    memcpy(out, &net_more, sizeof(net_more));
+    out += sizeof(net_more);
+
+    /* encode the entries; the height and index are already in network
+     * order. */
+    for (size_t i = 0U; i < count; ++i)
+    {
+        memcpy(out, entries[i].txn_id, sizeof(entries[i].txn_id));
+        out += sizeof(entries[i].txn_id);
+        memcpy(out, &entries[i].net_height, sizeof(entries[i].net_height));
+        out += sizeof(entries[i].net_height);
+        memcpy(out, &entries[i].net_index, sizeof(entries[i].net_index));
+        out += sizeof(entries[i].net_index);
+    }
+
+    /* success. Fall through. */
+
+done:
+    /* write the status to the caller, with the entries on success. */
+    retval =
+        dataservice_decode_and_dispatch_write_status(
+            sock, DATASERVICE_API_METHOD_APP_ARTIFACT_TRANSACTION_LIST_READ,
+            dreq.hdr.child_index, (uint32_t)retval,
+            (AGENTD_STATUS_SUCCESS == retval) ? payload : NULL, payload_size);
+
+    /* clean up payload bytes. */
+    if (NULL != payload)
+    {
+        memset(payload, 0, payload_size);
+        free(payload);
+    }
+
+    /* clean up entries. */
+    if (NULL != entries)
+    {
+        free(entries);
+    }
+
+    /* clean up dreq. */
+    if (dispose_dreq)
+    {
+        dispose((disposable_t*)&dreq);
+    }
+
+    return retval;
+}
@@ -0,0 +1,326 @@
+/**
+ * \file dataservice/dataservice_decode_and_dispatch_block_range_get.c
+ *
+ * \brief Decode block range get request and dispatch the call.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/dataservice/api.h>
+#include <agentd/dataservice/private/dataservice.h>
+#include <agentd/inet.h>
+#include <agentd/ipc.h>
+#include <agentd/status_codes.h>
+#include <cbmc/model_assert.h>
+#include <unistd.h>
+#include <vpr/parameters.h>
+
+#include "dataservice_internal.h"
+#include "dataservice_protocol_internal.h"
+
+/* forward decls. */
+static int dataservice_block_range_walk(
+    dataservice_child_context_t* child, dataservice_transaction_context_t* dtxn,
+    uint64_t start_height, uint32_t max_count, uint32_t max_bytes,
+    uint8_t* out, size_t* out_size);
+
+/**
+ * \brief Decode and dispatch a block range get request.
+ *
+ * Returns 0 on success or non-fatal error.  If a non-zero error message is
+ * returned, then a fatal error has occurred that should not be recovered from.
+ * Any additional information on the socket is suspect.
+ *
+ * \param inst          The instance on which the dispatch occurs.
+ * \param sock          The socket on which the request was received and the
+ *                      response is to be written.
+ * \param req           The request to be decoded and dispatched.
+ * \param size          The size of the request.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_GENERAL_OUT_OF_MEMORY if an out-of-memory condition was
+ *        encountered in this operation.
+ *      - AGENTD_ERROR_DATASERVICE_IPC_WRITE_DATA_FAILURE if data could not be
+ *        written to the client socket.
+ */
+int dataservice_decode_and_dispatch_block_range_get(
+    dataservice_instance_t* inst, ipc_socket_context_t* sock, void* req,
+    size_t size)
+{
+    int retval = 0;
+    bool dispose_dreq = false;
+    bool abort_dtxn = false;
+    uint8_t* payload = NULL;
+    size_t payload_size = 0U;
+    dataservice_transaction_context_t dtxn;
+
+    /* parameter sanity check. */
+    MODEL_ASSERT(NULL != inst);
+    MODEL_ASSERT(NULL != sock);
+    MODEL_ASSERT(NULL != req);
+
+    /* block range get request structure. */
+    dataservice_request_block_range_get_t dreq;
+
+    /* parse the request payload. */
+    retval = dataservice_decode_request_block_range_get(req, size, &dreq);
+    if (AGENTD_STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* be sure to clean up dreq. */
+    dispose_dreq = true;
+
+    /* look up the child context. */
+    dataservice_child_context_t* ctx = NULL;
+    retval = dataservice_child_context_lookup(&ctx, inst, dreq.hdr.child_index);
+    if (AGENTD_STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* the walk reads the height index directly, so check that capability. */
+    if (!BITCAP_ISSET(ctx->childcaps,
+            DATASERVICE_API_CAP_APP_BLOCK_ID_BY_HEIGHT_READ))
+    {
+        retval = AGENTD_ERROR_DATASERVICE_NOT_AUTHORIZED;
+        goto done;
+    }
+
+    /* clamp the count to what a single response may hold. */
+    uint32_t max_count = dreq.max_count;
+    if (0U == max_count)
+    {
+        max_count = 1U;
+    }
+    else if (max_count > DATASERVICE_MAX_BLOCK_RANGE_COUNT)
+    {
+        max_count = DATASERVICE_MAX_BLOCK_RANGE_COUNT;
+    }
+
+    /* clamp the byte budget in the same way. */
+    uint32_t max_bytes = dreq.max_bytes;
+    if (0U == max_bytes || max_bytes > DATASERVICE_MAX_BLOCK_RANGE_BYTES)
+    {
+        max_bytes = DATASERVICE_MAX_BLOCK_RANGE_BYTES;
+    }
+
+    /* walk the chain in a single read transaction. */
+    retval = dataservice_data_txn_begin(ctx, &dtxn, NULL, true);
+    if (AGENTD_STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* be sure to abort the read transaction. */
+    abort_dtxn = true;
+
+    /* size the response. */
+    retval =
+        dataservice_block_range_walk(
+            ctx, &dtxn, dreq.start_height, max_count, max_bytes, NULL,
+            &payload_size);
+    if (AGENTD_STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* allocate the response payload. */
+    payload = (uint8_t*)malloc(payload_size);
+    if (NULL == payload)
+    {
+        retval = AGENTD_ERROR_GENERAL_OUT_OF_MEMORY;
+        goto done;
+    }
+
+    /* encode the entries; the chain is unchanged within this transaction. */
+    retval =
+        dataservice_block_range_walk(
+            ctx, &dtxn, dreq.start_height, max_count, max_bytes, payload,
+            &payload_size);
+    if (AGENTD_STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* success. Fall through. */
+
+done:
+    /* write the status to the caller, with the entries on success. */
+    retval =
+        dataservice_decode_and_dispatch_write_status(
+            sock, DATASERVICE_API_METHOD_APP_BLOCK_RANGE_READ,
+            dreq.hdr.child_index, (uint32_t)retval,
+            (AGENTD_STATUS_SUCCESS == retval) ? payload : NULL, payload_size);
+
+    /* clean up payload bytes. */
+    if (NULL != payload)
+    {
+        memset(payload, 0, payload_size);
+        free(payload);
+    }
+
+    /* release the read transaction. */
+    if (abort_dtxn)
+    {
+        dataservice_data_txn_abort(&dtxn);
+    }
+
+    /* clean up dreq. */
+    if (dispose_dreq)
+    {
+        dispose((disposable_t*)&dreq);
+    }
+
+    return retval;
+}
+
+/**
+ * \brief Walk consecutive blocks by height with a single cursor over the
+ * height index, starting at start_height, and optionally encode them.
+ *
+ * The walk stops at the first gap in the height index, after max_count blocks,
+ * or once the certificates read reach max_bytes.  The first block is always
+ * included, even if its certificate alone exceeds max_bytes.
+ *
+ * \param child         The child context for this operation.
+ * \param dtxn          The read transaction in which the walk occurs.
+ * \param start_height  The height of the first block to read.
+ * \param max_count     The maximum number of blocks to read.
+ * \param max_bytes     The certificate byte budget for this walk.
+ * \param out           The buffer to receive the encoded entries, or NULL if
+ *                      only the size of these entries should be computed.
+ * \param out_size      Pointer to receive the size of the encoded entries.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_DATASERVICE_NOT_FOUND if the first block was not found.
+ *      - AGENTD_ERROR_DATASERVICE_MDB_GET_FAILURE if the height index could not
+ *        be read.
+ *      - AGENTD_ERROR_DATASERVICE_INVALID_INDEX_ENTRY if an invalid height
+ *        index entry was encountered.
+ *      - a non-zero error code from dataservice_block_get() on failure.
+ */
+static int dataservice_block_range_walk(
+    dataservice_child_context_t* child, dataservice_transaction_context_t* dtxn,
+    uint64_t start_height, uint32_t max_count, uint32_t max_bytes,
+    uint8_t* out, size_t* out_size)
+{
+    int retval;
+    MDB_cursor* cursor = NULL;
+    size_t offset = 0U;
+    size_t cert_bytes = 0U;
+
+    /* get the details for this database connection. */
+    dataservice_database_details_t* details =
+        (dataservice_database_details_t*)child->root->details;
+
+    /* open a cursor on the height index. */
+    if (0 != mdb_cursor_open(dtxn->txn, details->height_db, &cursor))
+    {
+        retval = AGENTD_ERROR_DATASERVICE_MDB_GET_FAILURE;
+        goto done;
+    }
+
+    /* height keys are big endian, so cursor order is height order. */
+    uint64_t net_height = htonll(start_height);
+    MDB_val lkey = { sizeof(net_height), &net_height };
+    MDB_val lval = { 0, NULL };
+    MDB_cursor_op op = MDB_SET_KEY;
+
+    for (uint32_t count = 0U; count < max_count; ++count)
+    {
+        data_block_node_t node;
+        uint8_t* block_bytes = NULL;
+        size_t block_size = 0U;
+
+        /* position the cursor on the next height. */
+        retval = mdb_cursor_get(cursor, &lkey, &lval, op);
+        if (MDB_NOTFOUND == retval && count > 0U)
+        {
+            break;
+        }
+        else if (MDB_NOTFOUND == retval)
+        {
+            retval = AGENTD_ERROR_DATASERVICE_NOT_FOUND;
+            goto cleanup_cursor;
+        }
+        else if (0 != retval)
+        {
+            retval = AGENTD_ERROR_DATASERVICE_MDB_GET_FAILURE;
+            goto cleanup_cursor;
+        }
+
+        /* verify that this entry is well formed. */
+        if (sizeof(net_height) != lkey.mv_size || 16 != lval.mv_size)
+        {
+            retval = AGENTD_ERROR_DATASERVICE_INVALID_INDEX_ENTRY;
+            goto cleanup_cursor;
+        }
+
+        /* stop at the first gap in the height index. */
+        uint64_t entry_net_height;
+        memcpy(&entry_net_height, lkey.mv_data, sizeof(entry_net_height));
+        if (ntohll(entry_net_height) != start_height + count)
+        {
+            break;
+        }
+
+        /* read this block; the bytes point into the database. */
+        retval =
+            dataservice_block_get(
+                child, dtxn, (const uint8_t*)lval.mv_data, &node, &block_bytes,
+                &block_size);
+        if (AGENTD_STATUS_SUCCESS != retval)
+        {
+            goto cleanup_cursor;
+        }
+
+        /* the entry is the id array, the height, and the certificate. */
+        uint32_t entry_size =
+            4 * 16 + sizeof(node.net_block_height) + block_size;
+
+        /* encode this entry if requested. */
+        if (NULL != out)
+        {
+            uint8_t* entry = out + offset;
+            uint32_t nentry_size = htonl(entry_size);
+
+            memcpy(entry, &nentry_size, sizeof(nentry_size));
+            entry += sizeof(nentry_size);
+            memcpy(entry, node.key, 16);
+            memcpy(entry + 16, node.prev, 16);
+            memcpy(entry + 32, node.next, 16);
+            memcpy(entry + 48, node.first_transaction_id, 16);
+            memcpy(
+                entry + 64, &node.net_block_height,
+                sizeof(node.net_block_height));
+            memcpy(entry + 72, block_bytes, block_size);
+        }
+
+        offset += sizeof(uint32_t) + entry_size;
+
+        /* stop once the byte budget is spent. */
+        cert_bytes += block_size;
+        if (cert_bytes >= max_bytes)
+        {
+            break;
+        }
+
+        /* step the cursor from here on. */
+        op = MDB_NEXT;
+    }
+
+    *out_size = offset;
+    retval = AGENTD_STATUS_SUCCESS;
+
+    /* fall-through. */
+
+cleanup_cursor:
+    mdb_cursor_close(cursor);
+
+done:
+    return retval;
+}
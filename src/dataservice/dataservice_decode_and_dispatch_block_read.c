@@ -47,6 +47,7 @@ int dataservice_decode_and_dispatch_block_read(
     size_t payload_size = 0U;
     uint8_t* block_bytes = NULL;
     size_t block_size = 0U;
+    dataservice_data_txn_reference_t* ref = NULL;
 
     /* parameter sanity check. */
     MODEL_ASSERT(NULL != inst);
@@ -74,23 +75,39 @@ int dataservice_decode_and_dispatch_block_read(
         goto done;
     }
 
+    /* hold a read transaction open so the block certificate can be
+     * written directly from the database map, if possible. */
+    retval = dataservice_data_txn_reference_begin(&ref, inst, ctx);
+    if (AGENTD_STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
     /* call the block get method. */
     data_block_node_t node;
     retval =
         dataservice_block_get(
-            ctx, NULL, dreq.block_id, &node, &block_bytes, &block_size);
+            ctx, ref->txn_open ? &ref->dtxn : NULL,
+            dreq.block_id, &node, &block_bytes, &block_size);
     if (AGENTD_STATUS_SUCCESS != retval)
     {
         block_bytes = NULL;
         goto done;
     }
 
+    /* without a read transaction, the reference owns the copied value. */
+    if (!ref->txn_open)
+    {
+        ref->copy = block_bytes;
+        ref->copy_size = block_size;
+    }
+
     /* encode the payload. */
     retval =
         dataservice_encode_response_block_read(
             &payload, &payload_size, node.key, node.prev, node.next,
             node.first_transaction_id, ntohll(node.net_block_height),
-            dreq.read_cert, block_bytes, block_size);
+            false, block_bytes, block_size);
     if (AGENTD_STATUS_SUCCESS != retval)
     {
         goto done;
@@ -99,11 +116,26 @@ int dataservice_decode_and_dispatch_block_read(
     /* success. Fall through. */
 
 done:
+    /* write the status and certificate to the caller. */
+    if (AGENTD_STATUS_SUCCESS == retval && dreq.read_cert)
+    {
+        /* the write buffer takes ownership of the reference. */
+        retval =
+            dataservice_decode_and_dispatch_write_status_by_reference(
+                sock, DATASERVICE_API_METHOD_APP_BLOCK_READ,
+                dreq.hdr.child_index, (uint32_t)retval, payload, payload_size,
+                block_bytes, block_size,
+                &dataservice_data_txn_reference_release, ref);
+        ref = NULL;
+    }
     /* write the status to the caller. */
-    retval =
-        dataservice_decode_and_dispatch_write_status(
-            sock, DATASERVICE_API_METHOD_APP_BLOCK_READ,
-            dreq.hdr.child_index, (uint32_t)retval, payload, payload_size);
+    else
+    {
+        retval =
+            dataservice_decode_and_dispatch_write_status(
+                sock, DATASERVICE_API_METHOD_APP_BLOCK_READ,
+                dreq.hdr.child_index, (uint32_t)retval, payload, payload_size);
+    }
 
     /* clean up payload bytes. */
     if (NULL != payload)
@@ -112,11 +144,10 @@ done:
         free(payload);
     }
 
-    /* clean up block bytes. */
-    if (NULL != block_bytes)
+    /* release the reference if it was not handed off. */
+    if (NULL != ref)
     {
-        memset(block_bytes, 0, block_size);
-        free(block_bytes);
+        dataservice_data_txn_reference_release(NULL, 0U, ref);
     }
 
     /* clean up dreq. */
@@ -47,6 +47,7 @@ int dataservice_decode_and_dispatch_canonized_transaction_get(
     size_t payload_size = 0U;
     uint8_t* txn_bytes = NULL;
     size_t txn_size = 0U;
+    dataservice_data_txn_reference_t* ref = NULL;
 
     /* parameter sanity check. */
     MODEL_ASSERT(NULL != inst);
@@ -75,23 +76,39 @@ int dataservice_decode_and_dispatch_canonized_transaction_get(
         goto done;
     }
 
+    /* hold a read transaction open so the transaction certificate can be
+     * written directly from the database map, if possible. */
+    retval = dataservice_data_txn_reference_begin(&ref, inst, ctx);
+    if (AGENTD_STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
     /* call the transaction get method. */
     data_transaction_node_t node;
     retval =
         dataservice_canonized_transaction_get(
-            ctx, NULL, dreq.txn_id, &node, &txn_bytes, &txn_size);
+            ctx, ref->txn_open ? &ref->dtxn : NULL,
+            dreq.txn_id, &node, &txn_bytes, &txn_size);
     if (AGENTD_STATUS_SUCCESS != retval)
     {
         txn_bytes = NULL;
         goto done;
     }
 
+    /* without a read transaction, the reference owns the copied value. */
+    if (!ref->txn_open)
+    {
+        ref->copy = txn_bytes;
+        ref->copy_size = txn_size;
+    }
+
     /* encode the response. */
     retval =
         dataservice_encode_response_canonized_transaction_get(
             &payload, &payload_size, node.key, node.prev, node.next,
             node.artifact_id, node.block_id, node.net_txn_state,
-            dreq.read_cert, txn_bytes, txn_size);
+            false, txn_bytes, txn_size);
     if (AGENTD_STATUS_SUCCESS != retval)
     {
         goto done;
@@ -100,11 +117,26 @@ int dataservice_decode_and_dispatch_canonized_transaction_get(
     /* success. Fall through. */
 
 done:
+    /* write the status and certificate to the caller. */
+    if (AGENTD_STATUS_SUCCESS == retval && dreq.read_cert)
+    {
+        /* the write buffer takes ownership of the reference. */
+        retval =
+            dataservice_decode_and_dispatch_write_status_by_reference(
+                sock, DATASERVICE_API_METHOD_APP_TRANSACTION_READ,
+                dreq.hdr.child_index, (uint32_t)retval, payload, payload_size,
+                txn_bytes, txn_size, &dataservice_data_txn_reference_release,
+                ref);
+        ref = NULL;
+    }
     /* write the status to the caller. */
-    retval =
-        dataservice_decode_and_dispatch_write_status(
-            sock, DATASERVICE_API_METHOD_APP_TRANSACTION_READ,
-            dreq.hdr.child_index, (uint32_t)retval, payload, payload_size);
+    else
+    {
+        retval =
+            dataservice_decode_and_dispatch_write_status(
+                sock, DATASERVICE_API_METHOD_APP_TRANSACTION_READ,
+                dreq.hdr.child_index, (uint32_t)retval, payload, payload_size);
+    }
 
     /* clean up payload bytes. */
     if (NULL != payload)
@@ -113,11 +145,10 @@ done:
         free(payload);
     }
 
-    /* clean up transaction bytes. */
-    if (NULL != txn_bytes)
+    /* release the reference if it was not handed off. */
+    if (NULL != ref)
     {
-        memset(txn_bytes, 0, txn_size);
-        free(txn_bytes);
+        dataservice_data_txn_reference_release(NULL, 0U, ref);
     }
 
     /* clean up dreq. */
@@ -63,7 +63,14 @@ int dataservice_decode_and_dispatch_root_context_create(
     /* call the root context create method. */
     retval =
         dataservice_root_context_init(
-            &inst->ctx, dreq.max_database_size, dreq.datadir);
+            &inst->ctx, dreq.max_database_size, dreq.datastore_flags,
+            dreq.max_readers, dreq.datadir);
+
+    /* nested transactions are not available with a writable memory map, so
+     * transaction submissions can't share a group commit. */
+    inst->submit_batch_disabled =
+        AGENTD_STATUS_SUCCESS == retval
+     && (dreq.datastore_flags & DATASTORE_FLAG_WRITEMAP);
 
     /* clean up. */
     dispose((disposable_t*)&dreq);
@@ -0,0 +1,163 @@
+/**
+ * \file dataservice/dataservice_decode_and_dispatch_transaction_batch_update.c
+ *
+ * \brief Decode transaction batch update request and dispatch the call.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/dataservice/api.h>
+#include <agentd/dataservice/async_api.h>
+#include <agentd/dataservice/private/dataservice.h>
+#include <agentd/inet.h>
+#include <agentd/ipc.h>
+#include <agentd/status_codes.h>
+#include <cbmc/model_assert.h>
+#include <unistd.h>
+#include <vpr/parameters.h>
+
+#include "dataservice_internal.h"
+#include "dataservice_protocol_internal.h"
+
+/**
+ * \brief Decode and dispatch a transaction batch update request.
+ *
+ * Returns 0 on success or non-fatal error.  If a non-zero error message is
+ * returned, then a fatal error has occurred that should not be recovered from.
+ * Any additional information on the socket is suspect.
+ *
+ * \param inst          The instance on which the dispatch occurs.
+ * \param sock          The socket on which the request was received and the
+ *                      response is to be written.
+ * \param req           The request to be decoded and dispatched.
+ * \param size          The size of the request.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_GENERAL_OUT_OF_MEMORY if an out-of-memory condition was
+ *        encountered in this operation.
+ *      - AGENTD_ERROR_DATASERVICE_IPC_WRITE_DATA_FAILURE if data could not be
+ *        written to the client socket.
+ */
+int dataservice_decode_and_dispatch_transaction_batch_update(
+    dataservice_instance_t* inst, ipc_socket_context_t* sock, void* req,
+    size_t size)
+{
+    int retval = 0;
+    bool dispose_dreq = false;
+    data_transaction_batch_update_entry_t* entries = NULL;
+    uint32_t* statuses = NULL;
+    size_t payload_size = 0U;
+
+    /* parameter sanity check. */
+    MODEL_ASSERT(NULL != inst);
+    MODEL_ASSERT(NULL != sock);
+    MODEL_ASSERT(NULL != req);
+
+    /* transaction batch update request structure. */
+    dataservice_request_transaction_batch_update_t dreq;
+
+    /* parse the request payload. */
+    retval =
+        dataservice_decode_request_transaction_batch_update(req, size, &dreq);
+    if (AGENTD_STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* be sure to clean up dreq. */
+    dispose_dreq = true;
+
+    /* look up the child context. */
+    dataservice_child_context_t* ctx = NULL;
+    retval = dataservice_child_context_lookup(&ctx, inst, dreq.hdr.child_index);
+    if (AGENTD_STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* a single batch is bounded so that one request can't pin the writer. */
+    if (dreq.count > DATASERVICE_MAX_TRANSACTION_BATCH_UPDATE_COUNT)
+    {
+        retval = AGENTD_ERROR_DATASERVICE_REQUEST_PACKET_INVALID_SIZE;
+        goto done;
+    }
+
+    /* allocate the entries and their statuses. */
+    entries =
+        (data_transaction_batch_update_entry_t*)malloc(
+            dreq.count * sizeof(*entries));
+    statuses = (uint32_t*)malloc(dreq.count * sizeof(*statuses));
+    if (NULL == entries || NULL == statuses)
+    {
+        retval = AGENTD_ERROR_GENERAL_OUT_OF_MEMORY;
+        goto done;
+    }
+
+    /* decode the entries. */
+    const uint8_t* in = dreq.entries;
+    for (size_t i = 0; i < dreq.count; ++i)
+    {
+        memcpy(entries[i].txn_id, in, sizeof(entries[i].txn_id));
+        in += sizeof(entries[i].txn_id);
+
+        uint32_t net_action;
+        memcpy(&net_action, in, sizeof(net_action));
+        entries[i].action = ntohl(net_action);
+        in += sizeof(net_action);
+    }
+
+    /* call the transaction batch update method. */
+    retval =
+        dataservice_transaction_batch_update(
+            ctx, entries, dreq.count, statuses);
+    if (AGENTD_STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* | Transaction Batch Update response payload.                           */
+    /* | ---------------------------------------------------- | ----------- | */
+    /* | DATA                                                 | SIZE        | */
+    /* | ---------------------------------------------------- | ----------- | */
+    /* | entry statuses, each of which is:                    |             | */
+    /* |    status                                            |  4 bytes    | */
+    /* | ---------------------------------------------------- | ----------- | */
+    for (size_t i = 0; i < dreq.count; ++i)
+    {
+        statuses[i] = htonl(statuses[i]);
+    }
+
+    payload_size = dreq.count * sizeof(*statuses);
+
+    /* success. Fall through. */
+
+done:
+    /* write the status to the caller, with the entry statuses on success. */
+    retval =
+        dataservice_decode_and_dispatch_write_status(
+            sock, DATASERVICE_API_METHOD_APP_PQ_TRANSACTION_BATCH_UPDATE,
+            dreq.hdr.child_index, (uint32_t)retval,
+            (AGENTD_STATUS_SUCCESS == retval) ? statuses : NULL, payload_size);
+
+    /* clean up statuses. */
+    if (NULL != statuses)
+    {
+        free(statuses);
+    }
+
+    /* clean up entries. */
+    if (NULL != entries)
+    {
+        memset(entries, 0, dreq.count * sizeof(*entries));
+        free(entries);
+    }
+
+    /* clean up dreq. */
+    if (dispose_dreq)
+    {
+        dispose((disposable_t*)&dreq);
+    }
+
+    return retval;
+}
@@ -0,0 +1,245 @@
+/**
+ * \file dataservice/dataservice_decode_and_dispatch_transaction_list_get.c
+ *
+ * \brief Decode transaction list get request and dispatch the call.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/dataservice/api.h>
+#include <agentd/dataservice/private/dataservice.h>
+#include <agentd/inet.h>
+#include <agentd/ipc.h>
+#include <agentd/status_codes.h>
+#include <cbmc/model_assert.h>
+#include <unistd.h>
+#include <vpr/parameters.h>
+
+#include "dataservice_internal.h"
+#include "dataservice_protocol_internal.h"
+
+/* forward decls. */
+static int dataservice_transaction_list_walk(
+    dataservice_child_context_t* child, dataservice_transaction_context_t* dtxn,
+    const uint8_t* txn_id, uint32_t max_count, uint8_t* out, size_t* out_size);
+
+/**
+ * \brief Decode and dispatch a transaction list get request.
+ *
+ * Returns 0 on success or non-fatal error.  If a non-zero error message is
+ * returned, then a fatal error has occurred that should not be recovered from.
+ * Any additional information on the socket is suspect.
+ *
+ * \param inst          The instance on which the dispatch occurs.
+ * \param sock          The socket on which the request was received and the
+ *                      response is to be written.
+ * \param req           The request to be decoded and dispatched.
+ * \param size          The size of the request.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_GENERAL_OUT_OF_MEMORY if an out-of-memory condition was
+ *        encountered in this operation.
+ *      - AGENTD_ERROR_DATASERVICE_IPC_WRITE_DATA_FAILURE if data could not be
+ *        written to the client socket.
+ */
+int dataservice_decode_and_dispatch_transaction_list_get(
+    dataservice_instance_t* inst, ipc_socket_context_t* sock, void* req,
+    size_t size)
+{
+    int retval = 0;
+    bool dispose_dreq = false;
+    bool abort_dtxn = false;
+    uint8_t* payload = NULL;
+    size_t payload_size = 0U;
+    dataservice_transaction_context_t dtxn;
+
+    /* parameter sanity check. */
+    MODEL_ASSERT(NULL != inst);
+    MODEL_ASSERT(NULL != sock);
+    MODEL_ASSERT(NULL != req);
+
+    /* transaction list get request structure. */
+    dataservice_request_transaction_list_get_t dreq;
+
+    /* parse the request payload. */
+    retval = dataservice_decode_request_transaction_list_get(req, size, &dreq);
+    if (AGENTD_STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* be sure to clean up dreq. */
+    dispose_dreq = true;
+
+    /* look up the child context. */
+    dataservice_child_context_t* ctx = NULL;
+    retval = dataservice_child_context_lookup(&ctx, inst, dreq.hdr.child_index);
+    if (AGENTD_STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* clamp the count to what a single response may hold. */
+    uint32_t max_count = dreq.max_count;
+    if (0U == max_count)
+    {
+        max_count = 1U;
+    }
+    else if (max_count > DATASERVICE_MAX_TRANSACTION_LIST_COUNT)
+    {
+        max_count = DATASERVICE_MAX_TRANSACTION_LIST_COUNT;
+    }
+
+    /* walk the queue in a single read transaction. */
+    retval = dataservice_data_txn_begin(ctx, &dtxn, NULL, true);
+    if (AGENTD_STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* be sure to abort the read transaction. */
+    abort_dtxn = true;
+
+    /* size the response. */
+    retval =
+        dataservice_transaction_list_walk(
+            ctx, &dtxn, dreq.txn_id, max_count, NULL, &payload_size);
+    if (AGENTD_STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* allocate the response payload. */
+    payload = (uint8_t*)malloc(payload_size);
+    if (NULL == payload)
+    {
+        retval = AGENTD_ERROR_GENERAL_OUT_OF_MEMORY;
+        goto done;
+    }
+
+    /* encode the entries; the queue is unchanged within this transaction. */
+    retval =
+        dataservice_transaction_list_walk(
+            ctx, &dtxn, dreq.txn_id, max_count, payload, &payload_size);
+    if (AGENTD_STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* success. Fall through. */
+
+done:
+    /* write the status to the caller, with the entries on success. */
+    retval =
+        dataservice_decode_and_dispatch_write_status(
+            sock, DATASERVICE_API_METHOD_APP_PQ_TRANSACTION_LIST_READ,
+            dreq.hdr.child_index, (uint32_t)retval,
+            (AGENTD_STATUS_SUCCESS == retval) ? payload : NULL, payload_size);
+
+    /* clean up payload bytes. */
+    if (NULL != payload)
+    {
+        memset(payload, 0, payload_size);
+        free(payload);
+    }
+
+    /* release the read transaction. */
+    if (abort_dtxn)
+    {
+        dataservice_data_txn_abort(&dtxn);
+    }
+
+    /* clean up dreq. */
+    if (dispose_dreq)
+    {
+        dispose((disposable_t*)&dreq);
+    }
+
+    return retval;
+}
+
+/**
+ * \brief Walk up to max_count transactions in the process queue, starting at
+ * txn_id, and optionally encode them.
+ *
+ * \param child         The child context for this operation.
+ * \param dtxn          The read transaction in which the walk occurs.
+ * \param txn_id        The first transaction to read.
+ * \param max_count     The maximum number of transactions to read.
+ * \param out           The buffer to receive the encoded entries, or NULL if
+ *                      only the size of these entries should be computed.
+ * \param out_size      Pointer to receive the size of the encoded entries.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_DATASERVICE_NOT_FOUND if the first transaction was not
+ *        found.
+ *      - a non-zero error code from dataservice_transaction_get() on failure.
+ */
+static int dataservice_transaction_list_walk(
+    dataservice_child_context_t* child, dataservice_transaction_context_t* dtxn,
+    const uint8_t* txn_id, uint32_t max_count, uint8_t* out, size_t* out_size)
+{
+    int retval;
+    uint8_t id[16];
+    size_t offset = 0U;
+
+    /* start at the requested transaction. */
+    memcpy(id, txn_id, sizeof(id));
+
+    for (uint32_t count = 0U; count < max_count; ++count)
+    {
+        data_transaction_node_t node;
+        uint8_t* txn_bytes = NULL;
+        size_t txn_size = 0U;
+
+        /* read this transaction; the bytes point into the database. */
+        retval =
+            dataservice_transaction_get(
+                child, dtxn, id, &node, &txn_bytes, &txn_size);
+        if (AGENTD_ERROR_DATASERVICE_NOT_FOUND == retval && count > 0U)
+        {
+            break;
+        }
+        else if (AGENTD_STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        /* the entry is the id array followed by the certificate. */
+        uint32_t entry_size = 4 * 16 + sizeof(node.net_txn_state) + txn_size;
+
+        /* encode this entry if requested. */
+        if (NULL != out)
+        {
+            uint8_t* entry = out + offset;
+            uint32_t nentry_size = htonl(entry_size);
+
+            memcpy(entry, &nentry_size, sizeof(nentry_size));
+            entry += sizeof(nentry_size);
+            memcpy(entry, node.key, 16);
+            memcpy(entry + 16, node.prev, 16);
+            memcpy(entry + 32, node.next, 16);
+            memcpy(entry + 48, node.artifact_id, 16);
+            memcpy(
+                entry + 64, &node.net_txn_state, sizeof(node.net_txn_state));
+            memcpy(entry + 68, txn_bytes, txn_size);
+        }
+
+        offset += sizeof(uint32_t) + entry_size;
+
+        /* stop at the end of the queue. */
+        if (dataservice_api_node_ref_is_end(node.next))
+        {
+            break;
+        }
+
+        /* move to the next transaction. */
+        memcpy(id, node.next, sizeof(id));
+    }
+
+    *out_size = offset;
+
+    return AGENTD_STATUS_SUCCESS;
+}
@@ -0,0 +1,107 @@
+/**
+ * \file dataservice/dataservice_decode_and_dispatch_write_status_by_reference.c
+ *
+ * \brief Write the status code from a dataservice method to the caller's
+ * socket, appending a trailing value by reference.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/dataservice/private/dataservice.h>
+#include <agentd/ipc.h>
+#include <agentd/modelcheck.h>
+#include <agentd/status_codes.h>
+#include <cbmc/model_assert.h>
+#include <unistd.h>
+#include <vpr/parameters.h>
+
+#include "dataservice_internal.h"
+
+/**
+ * \brief Write a status response to the socket, appending a trailing value by
+ * reference.
+ *
+ * The response written is identical to one written by \ref
+ * dataservice_decode_and_dispatch_write_status() with the concatenation of
+ * data and ref as its payload.  The ref bytes are not copied; they must remain
+ * valid until the release callback is called, which occurs exactly once,
+ * including on failure.
+ *
+ * \param sock          The socket on which the request was received and the
+ *                      response is to be written.
+ * \param method        The API method of this request.
+ * \param offset        The offset for the child context.
+ * \param status        The status returned from this API method.
+ * \param data          Leading payload data for this call.  May be NULL.
+ * \param data_size     The size of this leading payload data.  Must be 0 if
+ *                      data is NULL.
+ * \param ref           Trailing payload data to reference for this call.
+ * \param ref_size      The size of this trailing payload data.
+ * \param release       The callback to release the trailing payload data.
+ * \param user_context  The user context passed to the release callback.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_GENERAL_OUT_OF_MEMORY if an out-of-memory condition was
+ *        encountered in this operation.
+ *      - AGENTD_ERROR_DATASERVICE_IPC_WRITE_DATA_FAILURE if data could not be
+ *        written to the client socket.
+ */
+int dataservice_decode_and_dispatch_write_status_by_reference(
+    ipc_socket_context_t* sock, uint32_t method, uint32_t offset,
+    uint32_t status, void* data, size_t data_size, const void* ref,
+    size_t ref_size, ipc_reference_release_cb_t release, void* user_context)
+{
+    /* parameter sanity check. */
+    MODEL_ASSERT(NULL != sock);
+    MODEL_ASSERT(NULL != ref);
+    MODEL_ASSERT(NULL != release);
+
+    /* the header is the method, offset, and status, followed by the data. */
+    size_t hdrsize = 3 * sizeof(uint32_t);
+
+    /* add the data size to the header. */
+    if (data != NULL)
+    {
+        hdrsize += data_size;
+    }
+
+    /* allocate memory for the header. */
+    uint8_t* hdr = (uint8_t*)malloc(hdrsize);
+    if (NULL == hdr)
+    {
+        release(ref, ref_size, user_context);
+        return AGENTD_ERROR_GENERAL_OUT_OF_MEMORY;
+    }
+
+    /* set the values for the header. */
+    uint32_t net_method = htonl(method);
+    uint32_t net_offset = htonl(offset);
+    uint32_t net_status = htonl(status);
+
+    memcpy(hdr + 0 * sizeof(uint32_t), &net_method, sizeof(net_method));
+    memcpy(hdr + 1 * sizeof(uint32_t), &net_offset, sizeof(net_offset));
+    memcpy(hdr + 2 * sizeof(uint32_t), &net_status, sizeof(net_status));
+
+    /* copy the data. */
+    if (data != NULL)
+    {
+        modelsafe_memcpy(hdr + 3 * sizeof(uint32_t), data, data_size);
+    }
+
+    /* write the data packet; the reference is released by this call. */
+    int retval =
+        ipc_write_data_by_reference_noblock(
+            sock, hdr, hdrsize, ref, ref_size, release, user_context);
+    if (AGENTD_STATUS_SUCCESS != retval)
+    {
+        retval = AGENTD_ERROR_DATASERVICE_IPC_WRITE_DATA_FAILURE;
+    }
+
+    /* clean up memory. */
+    modelsafe_memset(hdr, 0, hdrsize);
+    free(hdr);
+
+    /* return the status of the response write to the caller. */
+    return retval;
+}
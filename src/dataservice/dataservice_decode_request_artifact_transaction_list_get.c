@@ -0,0 +1,89 @@
+/**
+ * \file dataservice/dataservice_decode_request_artifact_transaction_list_get.c
+ *
+ * \brief Decode artifact transaction list get request payload.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/inet.h>
+#include <agentd/status_codes.h>
+#include <arpa/inet.h>
+#include <cbmc/model_assert.h>
+#include <string.h>
+
+#include "dataservice_protocol_internal.h"
+
+/**
+ * \brief Decode an artifact transaction list get request.
+ *
+ * \param req           The request payload to parse.
+ * \param size          The size of this request payload.
+ * \param dreq          The request structure into which this request is
+ *                      decoded.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_DATASERVICE_REQUEST_PACKET_INVALID_SIZE if the request
+ *        packet payload size is incorrect.
+ */
+int dataservice_decode_request_artifact_transaction_list_get(
+    const void* req, size_t size,
+    dataservice_request_artifact_transaction_list_get_t* dreq)
+{
+    int retval = AGENTD_STATUS_SUCCESS;
+
+    /* parameter sanity check. */
+    MODEL_ASSERT(NULL != req);
+    MODEL_ASSERT(NULL != dreq);
+
+    /* make working with the request more convenient. */
+    const uint8_t* breq = (const uint8_t*)req;
+
+    /* initialize the request structure. */
+    retval = dataservice_request_init(&breq, &size, &dreq->hdr, sizeof(*dreq));
+    if (AGENTD_STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* the remaining payload is the artifact id, start position, and count. */
+    if (size !=
+            sizeof(dreq->artifact_id) + sizeof(dreq->start_height)
+                + sizeof(dreq->start_index) + sizeof(dreq->max_count))
+    {
+        retval = AGENTD_ERROR_DATASERVICE_REQUEST_PACKET_INVALID_SIZE;
+        goto cleanup_dreq;
+    }
+
+    /* copy the artifact id. */
+    memcpy(dreq->artifact_id, breq, sizeof(dreq->artifact_id));
+    breq += sizeof(dreq->artifact_id);
+
+    /* copy the start height. */
+    uint64_t net_start_height;
+    memcpy(&net_start_height, breq, sizeof(net_start_height));
+    dreq->start_height = ntohll(net_start_height);
+    breq += sizeof(net_start_height);
+
+    /* copy the start index. */
+    uint32_t net_start_index;
+    memcpy(&net_start_index, breq, sizeof(net_start_index));
+    dreq->start_index = ntohl(net_start_index);
+    breq += sizeof(net_start_index);
+
+    /* copy the max count. */
+    uint32_t net_max_count;
+    memcpy(&net_max_count, breq, sizeof(net_max_count));
+    dreq->max_count = ntohl(net_max_count);
+
+    /* success. dreq contents are owned by the caller. */
+    goto done;
+
+cleanup_dreq:
+    /* we failed, so don't pass dreq contents to the caller. */
+    dispose((disposable_t*)dreq);
+
+done:
+    return retval;
+}
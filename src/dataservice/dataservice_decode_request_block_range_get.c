@@ -0,0 +1,85 @@
+/**
+ * \file dataservice/dataservice_decode_request_block_range_get.c
+ *
+ * \brief Decode block range get request payload.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/inet.h>
+#include <agentd/status_codes.h>
+#include <arpa/inet.h>
+#include <cbmc/model_assert.h>
+#include <string.h>
+
+#include "dataservice_protocol_internal.h"
+
+/**
+ * \brief Decode a block range get request.
+ *
+ * \param req           The request payload to parse.
+ * \param size          The size of this request payload.
+ * \param dreq          The request structure into which this request is
+ *                      decoded.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_DATASERVICE_REQUEST_PACKET_INVALID_SIZE if the request
+ *        packet payload size is incorrect.
+ */
+int dataservice_decode_request_block_range_get(
+    const void* req, size_t size,
+    dataservice_request_block_range_get_t* dreq)
+{
+    int retval = AGENTD_STATUS_SUCCESS;
+
+    /* parameter sanity check. */
+    MODEL_ASSERT(NULL != req);
+    MODEL_ASSERT(NULL != dreq);
+
+    /* make working with the request more convenient. */
+    const uint8_t* breq = (const uint8_t*)req;
+
+    /* initialize the request structure. */
+    retval = dataservice_request_init(&breq, &size, &dreq->hdr, sizeof(*dreq));
+    if (AGENTD_STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* the remaining payload is the start height, max count, and max bytes. */
+    if (size !=
+            sizeof(dreq->start_height) + sizeof(dreq->max_count)
+                + sizeof(dreq->max_bytes))
+    {
+        retval = AGENTD_ERROR_DATASERVICE_REQUEST_PACKET_INVALID_SIZE;
+        goto cleanup_dreq;
+    }
+
+    /* copy the start height. */
+    uint64_t net_start_height;
+    memcpy(&net_start_height, breq, sizeof(net_start_height));
+    dreq->start_height = ntohll(net_start_height);
+    breq += sizeof(net_start_height);
+
+    /* copy the max count. */
+    uint32_t net_max_count;
+    memcpy(&net_max_count, breq, sizeof(net_max_count));
+    dreq->max_count = ntohl(net_max_count);
+    breq += sizeof(net_max_count);
+
+    /* copy the max bytes. */
+    uint32_t net_max_bytes;
+    memcpy(&net_max_bytes, breq, sizeof(net_max_bytes));
+    dreq->max_bytes = ntohl(net_max_bytes);
+
+    /* success. dreq contents are owned by the caller. */
+    goto done;
+
+cleanup_dreq:
+    /* we failed, so don't pass dreq contents to the caller. */
+    dispose((disposable_t*)dreq);
+
+done:
+    return retval;
+}
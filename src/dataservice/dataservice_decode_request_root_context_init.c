@@ -45,8 +45,8 @@ int dataservice_decode_request_root_context_init(
         return AGENTD_ERROR_DATASERVICE_INVALID_PARAMETER;
     }
 
-    /* the payload size should be greater than eight. */
-    if (size <= 8U)
+    /* the payload size should be greater than sixteen. */
+    if (size <= 16U)
     {
         return AGENTD_ERROR_DATASERVICE_REQUEST_PACKET_INVALID_SIZE;
     }
@@ -75,6 +75,20 @@ int dataservice_decode_request_root_context_init(
     size -= sizeof(net_max_database_size);
     breq += sizeof(net_max_database_size);
 
+    /* get the datastore flags. */
+    uint32_t net_datastore_flags = 0U;
+    memcpy(&net_datastore_flags, breq, sizeof(net_datastore_flags));
+    dreq->datastore_flags = ntohl(net_datastore_flags);
+    size -= sizeof(net_datastore_flags);
+    breq += sizeof(net_datastore_flags);
+
+    /* get the max readers. */
+    uint32_t net_max_readers = 0U;
+    memcpy(&net_max_readers, breq, sizeof(net_max_readers));
+    dreq->max_readers = ntohl(net_max_readers);
+    size -= sizeof(net_max_readers);
+    breq += sizeof(net_max_readers);
+
     /* allocate memory for the datadir string. */
     dreq->datadir = allocate(alloc_opts, size + 1);
     if (NULL == dreq->datadir)
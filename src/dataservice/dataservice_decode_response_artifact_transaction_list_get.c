@@ -0,0 +1,142 @@
+/**
+ * \file dataservice/dataservice_decode_response_artifact_transaction_list_get.c
+ *
+ * \brief Decode the response from the artifact transaction list get api
+ * method.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/inet.h>
+#include <agentd/dataservice/async_api.h>
+#include <agentd/status_codes.h>
+#include <cbmc/model_assert.h>
+
+/**
+ * \brief Decode a response from the get artifact transaction list query.
+ *
+ * On success, the entries in this response are validated, counted, and can be
+ * read using
+ * \ref dataservice_decode_response_artifact_transaction_list_get_entry().
+ *
+ * \param resp          The response payload to parse.
+ * \param size          The size of this response payload.
+ * \param dresp         The decoded response structure into which this response
+ *                      is decoded.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_DATASERVICE_RESPONSE_PACKET_INVALID_SIZE if the response
+ *        packet payload size is incorrect.
+ *      - AGENTD_ERROR_DATASERVICE_RESPONSE_INVALID_PARAMETER if one of the
+ *        parameters to the function is invalid.
+ */
+int dataservice_decode_response_artifact_transaction_list_get(
+    const void* resp, size_t size,
+    dataservice_response_artifact_transaction_list_get_t* dresp)
+{
+    int retval = 0;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != resp);
+    MODEL_ASSERT(NULL != dresp);
+
+    /* runtime sanity checks. */
+    if (NULL == resp || NULL == dresp)
+    {
+        return AGENTD_ERROR_DATASERVICE_RESPONSE_INVALID_PARAMETER;
+    }
+
+    /* | Artifact transaction list get response packet.                     | */
+    /* | --------------------------------------------------- | ------------ | */
+    /* | DATA                                                | SIZE         | */
+    /* | --------------------------------------------------- | ------------ | */
+    /* | DATASERVICE_API_METHOD_APP_ARTIFACT_TRANSACTION_... |  4 bytes     | */
+    /* | offset                                              |  4 bytes     | */
+    /* | status                                              |  4 bytes     | */
+    /* | more                                                |  4 bytes     | */
+    /* | entries, each of which is:                          | n - 16 bytes | */
+    /* |    txn_id                                           | 16 bytes     | */
+    /* |    net_height                                       |  8 bytes     | */
+    /* |    net_index                                        |  4 bytes     | */
+    /* | --------------------------------------------------- | ------------ | */
+
+    /* clear dresp. */
+    memset(dresp, 0, sizeof(*dresp));
+
+    /* by default, the disposer is the memset disposer. */
+    dresp->hdr.hdr.dispose = &dataservice_decode_response_memset_disposer;
+    dresp->hdr.payload_size = 0U;
+
+    /* val is easier to work with. */
+    const uint32_t* val = (const uint32_t*)resp;
+
+    /* the size should be greater than or equal to the size we expect. */
+    uint32_t response_packet_size =
+        /* size of the API method. */
+        sizeof(uint32_t) +
+        /* size of the offset. */
+        sizeof(uint32_t) +
+        /* size of the status. */
+        sizeof(uint32_t);
+    if (size < response_packet_size)
+    {
+        retval = AGENTD_ERROR_DATASERVICE_RESPONSE_PACKET_INVALID_SIZE;
+        goto done;
+    }
+
+    /* verify that the method code is the code we expect. */
+    dresp->hdr.method_code = ntohl(val[0]);
+    if (DATASERVICE_API_METHOD_APP_ARTIFACT_TRANSACTION_LIST_READ !=
+        dresp->hdr.method_code)
+    {
+        retval = AGENTD_ERROR_DATASERVICE_RECVRESP_UNEXPECTED_METHOD_CODE;
+        goto done;
+    }
+
+    /* get the offset. */
+    dresp->hdr.offset = ntohl(val[1]);
+
+    /* get the status code. */
+    dresp->hdr.status = ntohl(val[2]);
+    if (AGENTD_STATUS_SUCCESS != dresp->hdr.status)
+    {
+        retval = AGENTD_STATUS_SUCCESS;
+        goto done;
+    }
+
+    /* the more flag follows the header. */
+    if (size < response_packet_size + sizeof(uint32_t))
+    {
+        retval = AGENTD_ERROR_DATASERVICE_RESPONSE_PACKET_INVALID_SIZE;
+        goto done;
+    }
+
+    /* get the more flag. */
+    dresp->more = (0U != ntohl(val[3]));
+
+    /* the entries follow the more flag, and must be whole. */
+    size_t entries_size = size - response_packet_size - sizeof(uint32_t);
+    if (0U == entries_size
+     || 0U != entries_size % DATASERVICE_ARTIFACT_TRANSACTION_ENTRY_SIZE)
+    {
+        retval = AGENTD_ERROR_DATASERVICE_RESPONSE_PACKET_INVALID_SIZE;
+        goto done;
+    }
+
+    /* set the entries. */
+    dresp->count = entries_size / DATASERVICE_ARTIFACT_TRANSACTION_ENTRY_SIZE;
+    dresp->data = (const void*)(val + 4);
+    dresp->data_size = entries_size;
+
+    /* set the payload size. */
+    dresp->hdr.payload_size = sizeof(*dresp) - sizeof(dresp->hdr);
+
+    /* success. */
+    retval = AGENTD_STATUS_SUCCESS;
+
+    /* fall-through. */
+
+done:
+    return retval;
+}
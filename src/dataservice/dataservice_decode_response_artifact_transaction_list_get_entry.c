@@ -0,0 +1,67 @@
+/**
+ * \file dataservice/dataservice_decode_response_artifact_transaction_list_get_entry.c
+ *
+ * \brief Decode a single entry from an artifact transaction list get response.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/inet.h>
+#include <agentd/dataservice/async_api.h>
+#include <agentd/status_codes.h>
+#include <cbmc/model_assert.h>
+
+/**
+ * \brief Decode the next entry from a get artifact transaction list response.
+ *
+ * On success, the entries pointer and size are advanced past this entry, and
+ * the entry is updated with the transaction id, height, and index.
+ *
+ * \param entries       Pointer to the remaining entries to decode.
+ * \param entries_size  Pointer to the size of the remaining entries.
+ * \param entry         The entry to update.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_DATASERVICE_RESPONSE_PACKET_INVALID_SIZE if the
+ *        remaining entries are truncated.
+ */
+int dataservice_decode_response_artifact_transaction_list_get_entry(
+    const void** entries, size_t* entries_size,
+    data_artifact_transaction_entry_t* entry)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != entries);
+    MODEL_ASSERT(NULL != *entries);
+    MODEL_ASSERT(NULL != entries_size);
+    MODEL_ASSERT(NULL != entry);
+
+    /* the remaining entries must hold a whole entry. */
+    if (*entries_size < DATASERVICE_ARTIFACT_TRANSACTION_ENTRY_SIZE)
+    {
+        return AGENTD_ERROR_DATASERVICE_RESPONSE_PACKET_INVALID_SIZE;
+    }
+
+    /* clear the entry. */
+    memset(entry, 0, sizeof(*entry));
+
+    /* copy the transaction id. */
+    const uint8_t* bval = (const uint8_t*)*entries;
+    memcpy(entry->txn_id, bval, sizeof(entry->txn_id));
+    bval += sizeof(entry->txn_id);
+
+    /* copy the height. */
+    memcpy(&entry->net_height, bval, sizeof(entry->net_height));
+    bval += sizeof(entry->net_height);
+
+    /* copy the index. */
+    memcpy(&entry->net_index, bval, sizeof(entry->net_index));
+    bval += sizeof(entry->net_index);
+
+    /* advance past this entry. */
+    *entries = bval;
+    *entries_size -= DATASERVICE_ARTIFACT_TRANSACTION_ENTRY_SIZE;
+
+    /* success. */
+    return AGENTD_STATUS_SUCCESS;
+}
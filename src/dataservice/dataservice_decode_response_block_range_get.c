@@ -0,0 +1,156 @@
+/**
+ * \file dataservice/dataservice_decode_response_block_range_get.c
+ *
+ * \brief Decode the response from the block range get api method.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/inet.h>
+#include <agentd/dataservice/async_api.h>
+#include <agentd/status_codes.h>
+#include <cbmc/model_assert.h>
+
+/**
+ * \brief Decode a response from the get block range query.
+ *
+ * On success, the entries in this response are validated, counted, and can be
+ * read using \ref dataservice_decode_response_block_range_get_entry().
+ *
+ * \param resp          The response payload to parse.
+ * \param size          The size of this response payload.
+ * \param dresp         The decoded response structure into which this response
+ *                      is decoded.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_DATASERVICE_RESPONSE_PACKET_INVALID_SIZE if the response
+ *        packet payload size is incorrect.
+ *      - AGENTD_ERROR_DATASERVICE_RESPONSE_INVALID_PARAMETER if one of the
+ *        parameters to the function is invalid.
+ */
+int dataservice_decode_response_block_range_get(
+    const void* resp, size_t size,
+    dataservice_response_block_range_get_t* dresp)
+{
+    int retval = 0;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != resp);
+    MODEL_ASSERT(NULL != dresp);
+
+    /* runtime sanity checks. */
+    if (NULL == resp || NULL == dresp)
+    {
+        return AGENTD_ERROR_DATASERVICE_RESPONSE_INVALID_PARAMETER;
+    }
+
+    /* | Block range get response packet.                                   | */
+    /* | --------------------------------------------------- | ------------ | */
+    /* | DATA                                                | SIZE         | */
+    /* | --------------------------------------------------- | ------------ | */
+    /* | DATASERVICE_API_METHOD_APP_BLOCK_RANGE_READ         |  4 bytes     | */
+    /* | offset                                              |  4 bytes     | */
+    /* | status                                              |  4 bytes     | */
+    /* | entries, each of which is:                          | n - 12 bytes | */
+    /* |    entry_size                                       |  4 bytes     | */
+    /* |    key                                              | 16 bytes     | */
+    /* |    prev                                             | 16 bytes     | */
+    /* |    next                                             | 16 bytes     | */
+    /* |    first_transaction_id                             | 16 bytes     | */
+    /* |    net_block_height                                 |  8 bytes     | */
+    /* |    data                                             | m - 72 bytes | */
+    /* | --------------------------------------------------- | ------------ | */
+
+    /* clear dresp. */
+    memset(dresp, 0, sizeof(*dresp));
+
+    /* by default, the disposer is the memset disposer. */
+    dresp->hdr.hdr.dispose = &dataservice_decode_response_memset_disposer;
+    dresp->hdr.payload_size = 0U;
+
+    /* val is easier to work with. */
+    const uint32_t* val = (const uint32_t*)resp;
+
+    /* the size should be greater than or equal to the size we expect. */
+    uint32_t response_packet_size =
+        /* size of the API method. */
+        sizeof(uint32_t) +
+        /* size of the offset. */
+        sizeof(uint32_t) +
+        /* size of the status. */
+        sizeof(uint32_t);
+    if (size < response_packet_size)
+    {
+        retval = AGENTD_ERROR_DATASERVICE_RESPONSE_PACKET_INVALID_SIZE;
+        goto done;
+    }
+
+    /* verify that the method code is the code we expect. */
+    dresp->hdr.method_code = ntohl(val[0]);
+    if (DATASERVICE_API_METHOD_APP_BLOCK_RANGE_READ !=
+        dresp->hdr.method_code)
+    {
+        retval = AGENTD_ERROR_DATASERVICE_RECVRESP_UNEXPECTED_METHOD_CODE;
+        goto done;
+    }
+
+    /* get the offset. */
+    dresp->hdr.offset = ntohl(val[1]);
+
+    /* get the status code. */
+    dresp->hdr.status = ntohl(val[2]);
+    if (AGENTD_STATUS_SUCCESS != dresp->hdr.status)
+    {
+        retval = AGENTD_STATUS_SUCCESS;
+        goto done;
+    }
+
+    /* the entries follow the header. */
+    const void* entries = (const void*)(val + 3);
+    size_t entries_size = size - response_packet_size;
+
+    /* walk the entries to verify and count them. */
+    const void* walk = entries;
+    size_t walk_size = entries_size;
+    size_t count = 0U;
+    while (walk_size > 0U)
+    {
+        data_block_node_t node;
+        const void* cert;
+        size_t cert_size;
+
+        retval =
+            dataservice_decode_response_block_range_get_entry(
+                &walk, &walk_size, &node, &cert, &cert_size);
+        if (AGENTD_STATUS_SUCCESS != retval)
+        {
+            goto done;
+        }
+
+        ++count;
+    }
+
+    /* a successful response holds at least one entry. */
+    if (0U == count)
+    {
+        retval = AGENTD_ERROR_DATASERVICE_RESPONSE_PACKET_INVALID_SIZE;
+        goto done;
+    }
+
+    /* set the entries. */
+    dresp->count = count;
+    dresp->data = entries;
+    dresp->data_size = entries_size;
+
+    /* set the payload size. */
+    dresp->hdr.payload_size = sizeof(*dresp) - sizeof(dresp->hdr);
+
+    /* success. */
+    retval = AGENTD_STATUS_SUCCESS;
+
+    /* fall-through. */
+
+done:
+    return retval;
+}
@@ -0,0 +1,99 @@
+/**
+ * \file dataservice/dataservice_decode_response_block_range_get_entry.c
+ *
+ * \brief Decode a single entry from a block range get response.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/inet.h>
+#include <agentd/dataservice/async_api.h>
+#include <agentd/status_codes.h>
+#include <cbmc/model_assert.h>
+
+/**
+ * \brief Decode the next entry from a get block range response.
+ *
+ * On success, the entries pointer and size are advanced past this entry, the
+ * node is updated with the entry's node data, and the cert pointer and size are
+ * updated to point to the entry's certificate inside of the response.
+ *
+ * \param entries       Pointer to the remaining entries to decode.
+ * \param entries_size  Pointer to the size of the remaining entries.
+ * \param node          The node to update with this entry.
+ * \param cert          Pointer to be updated with this entry's certificate.
+ * \param cert_size     Pointer to be updated with the certificate size.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_DATASERVICE_RESPONSE_PACKET_INVALID_SIZE if the
+ *        remaining entries are truncated or malformed.
+ */
+int dataservice_decode_response_block_range_get_entry(
+    const void** entries, size_t* entries_size, data_block_node_t* node,
+    const void** cert, size_t* cert_size)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != entries);
+    MODEL_ASSERT(NULL != *entries);
+    MODEL_ASSERT(NULL != entries_size);
+    MODEL_ASSERT(NULL != node);
+    MODEL_ASSERT(NULL != cert);
+    MODEL_ASSERT(NULL != cert_size);
+
+    /* the size of the id array. */
+    const size_t id_arr_size = 4 * 16 + 8;
+
+    /* the entry must be large enough to hold its size. */
+    if (*entries_size < sizeof(uint32_t))
+    {
+        return AGENTD_ERROR_DATASERVICE_RESPONSE_PACKET_INVALID_SIZE;
+    }
+
+    /* get the entry size. */
+    const uint8_t* bval = (const uint8_t*)*entries;
+    uint32_t nentry_size;
+    memcpy(&nentry_size, bval, sizeof(nentry_size));
+    size_t entry_size = ntohl(nentry_size);
+    bval += sizeof(nentry_size);
+
+    /* the entry must hold the id array and fit in the remaining entries. */
+    if (entry_size < id_arr_size
+     || entry_size > *entries_size - sizeof(uint32_t))
+    {
+        return AGENTD_ERROR_DATASERVICE_RESPONSE_PACKET_INVALID_SIZE;
+    }
+
+    /* clear the node. */
+    memset(node, 0, sizeof(*node));
+
+    /* copy the key. */
+    memcpy(node->key, bval, sizeof(node->key));
+
+    /* copy the prev. */
+    memcpy(node->prev, bval + 16, sizeof(node->prev));
+
+    /* copy the next. */
+    memcpy(node->next, bval + 32, sizeof(node->next));
+
+    /* copy the first transaction id. */
+    memcpy(
+        node->first_transaction_id, bval + 48,
+        sizeof(node->first_transaction_id));
+
+    /* copy the block height. */
+    memcpy(
+        &node->net_block_height, bval + 64, sizeof(node->net_block_height));
+
+    /* set the certificate. */
+    *cert = bval + id_arr_size;
+    *cert_size = entry_size - id_arr_size;
+    node->net_block_cert_size = htonll(*cert_size);
+
+    /* advance past this entry. */
+    *entries = bval + entry_size;
+    *entries_size -= sizeof(uint32_t) + entry_size;
+
+    /* success. */
+    return AGENTD_STATUS_SUCCESS;
+}
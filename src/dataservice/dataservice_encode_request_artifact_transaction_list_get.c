@@ -0,0 +1,116 @@
+/**
+ * \file dataservice/dataservice_encode_request_artifact_transaction_list_get.c
+ *
+ * \brief Encode a get artifact transaction list request.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/dataservice/async_api.h>
+#include <agentd/inet.h>
+#include <agentd/status_codes.h>
+
+/**
+ * \brief Encode a request to get a page of an artifact's transaction history,
+ * starting at the given block height and index.
+ *
+ * \param buffer        Pointer to an uninitialized \ref vccrypt_buffer_t to
+ *                      receive the encoded request.
+ * \param alloc_opts    The allocator options to use.
+ * \param child         The child context for this request.
+ * \param artifact_id   The artifact id for this request.
+ * \param start_height  The block height at which the page starts.
+ * \param start_index   The index within the start height at which the page
+ *                      starts.
+ * \param max_count     The maximum number of transactions to return.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status dataservice_encode_request_artifact_transaction_list_get(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts, uint32_t child,
+    const RCPR_SYM(rcpr_uuid)* artifact_id, uint64_t start_height,
+    uint32_t start_index, uint32_t max_count)
+{
+    status retval;
+    vccrypt_buffer_t tmp;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != buffer);
+    MODEL_ASSERT(prop_allocator_options_valid(alloc_opts));
+    MODEL_ASSERT(NULL != artifact_id);
+
+    /* runtime parameter sanity checks. */
+    if (NULL == buffer || NULL == alloc_opts || NULL == artifact_id)
+    {
+        return AGENTD_ERROR_DATASERVICE_INVALID_PARAMETER;
+    }
+
+    /* | Artifact Transaction List Get packet.                                */
+    /* | ---------------------------------------------------- | ----------- | */
+    /* | DATA                                                 | SIZE        | */
+    /* | ---------------------------------------------------- | ----------- | */
+    /* | DATASERVICE_API_METHOD_APP_ARTIFACT_TRANSACTION_...  |  4 bytes    | */
+    /* | child_context_index                                  |  4 bytes    | */
+    /* | artifact_id                                          | 16 bytes    | */
+    /* | start_height                                         |  8 bytes    | */
+    /* | start_index                                          |  4 bytes    | */
+    /* | max_count                                            |  4 bytes    | */
+    /* | ---------------------------------------------------- | ----------- | */
+
+    /* compute the request buffer size. */
+    size_t reqbuflen =
+        sizeof(uint32_t)    /* request id */
+      + sizeof(child)
+      + sizeof(*artifact_id)
+      + sizeof(start_height)
+      + sizeof(start_index)
+      + sizeof(max_count);
+
+    /* create a buffer for holding the request. */
+    retval = vccrypt_buffer_init(&tmp, alloc_opts, reqbuflen);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* make working with the buffer more convenient. */
+    uint8_t* breq = (uint8_t*)tmp.data;
+
+    /* copy the request id to the buffer. */
+    uint32_t req =
+        htonl(DATASERVICE_API_METHOD_APP_ARTIFACT_TRANSACTION_LIST_READ);
+    memcpy(breq, &req, sizeof(req));
+    breq += sizeof(req);
+
+    /* copy the child context index parameter to the buffer. */
+    uint32_t nchild = htonl(child);
+    memcpy(breq, &nchild, sizeof(nchild));
+    breq += sizeof(child);
+
+    /* copy the artifact id to this buffer. */
+    memcpy(breq, artifact_id, sizeof(*artifact_id));
+    breq += sizeof(*artifact_id);
+
+    /* copy the start height to this buffer. */
+    uint64_t nstart_height = htonll(start_height);
+    memcpy(breq, &nstart_height, sizeof(nstart_height));
+    breq += sizeof(nstart_height);
+
+    /* copy the start index to this buffer. */
+    uint32_t nstart_index = htonl(start_index);
+    memcpy(breq, &nstart_index, sizeof(nstart_index));
+    breq += sizeof(nstart_index);
+
+    /* copy the max count to this buffer. */
+    uint32_t nmax_count = htonl(max_count);
+    memcpy(breq, &nmax_count, sizeof(nmax_count));
+    breq += sizeof(nmax_count);
+
+    /* move the contents of the temporary buffer to the return buffer. */
+    vccrypt_buffer_move(buffer, &tmp);
+
+    /* success. */
+    return STATUS_SUCCESS;
+}
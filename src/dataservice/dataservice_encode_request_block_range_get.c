@@ -0,0 +1,105 @@
+/**
+ * \file dataservice/dataservice_encode_request_block_range_get.c
+ *
+ * \brief Encode a get block range request.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/dataservice/async_api.h>
+#include <agentd/inet.h>
+#include <agentd/status_codes.h>
+
+/**
+ * \brief Encode a request to get a run of consecutive blocks, starting at the
+ * given block height.
+ *
+ * \param buffer        Pointer to an uninitialized \ref vccrypt_buffer_t to
+ *                      receive the encoded request.
+ * \param alloc_opts    The allocator options to use.
+ * \param child         The child context for this request.
+ * \param start_height  The height of the first block to return.
+ * \param max_count     The maximum number of blocks to return.
+ * \param max_bytes     The certificate byte budget for this response.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status dataservice_encode_request_block_range_get(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts, uint32_t child,
+    uint64_t start_height, uint32_t max_count, uint32_t max_bytes)
+{
+    status retval;
+    vccrypt_buffer_t tmp;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != buffer);
+    MODEL_ASSERT(prop_allocator_options_valid(alloc_opts));
+
+    /* runtime parameter sanity checks. */
+    if (NULL == buffer || NULL == alloc_opts)
+    {
+        return AGENTD_ERROR_DATASERVICE_INVALID_PARAMETER;
+    }
+
+    /* | Block Range Get packet.                                              */
+    /* | ---------------------------------------------------- | ----------- | */
+    /* | DATA                                                 | SIZE        | */
+    /* | ---------------------------------------------------- | ----------- | */
+    /* | DATASERVICE_API_METHOD_APP_BLOCK_RANGE_READ          |  4 bytes    | */
+    /* | child_context_index                                  |  4 bytes    | */
+    /* | start_height                                         |  8 bytes    | */
+    /* | max_count                                            |  4 bytes    | */
+    /* | max_bytes                                            |  4 bytes    | */
+    /* | ---------------------------------------------------- | ----------- | */
+
+    /* compute the request buffer size. */
+    size_t reqbuflen =
+        sizeof(uint32_t)    /* request id */
+      + sizeof(child)
+      + sizeof(start_height)
+      + sizeof(max_count)
+      + sizeof(max_bytes);
+
+    /* create a buffer for holding the request. */
+    retval = vccrypt_buffer_init(&tmp, alloc_opts, reqbuflen);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* make working with the buffer more convenient. */
+    uint8_t* breq = (uint8_t*)tmp.data;
+
+    /* copy the request id to the buffer. */
+    uint32_t req = htonl(DATASERVICE_API_METHOD_APP_BLOCK_RANGE_READ);
+    memcpy(breq, &req, sizeof(req));
+    breq += sizeof(req);
+
+    /* copy the child context index parameter to the buffer. */
+    uint32_t nchild = htonl(child);
+    memcpy(breq, &nchild, sizeof(nchild));
+    breq += sizeof(child);
+
+    /* copy the start height to this buffer. */
+    uint64_t nstart_height = htonll(start_height);
+    memcpy(breq, &nstart_height, sizeof(nstart_height));
+    breq += sizeof(nstart_height);
+
+    /* copy the max count to this buffer. */
+    uint32_t nmax_count = htonl(max_count);
+    memcpy(breq, &nmax_count, sizeof(nmax_count));
+    breq += sizeof(nmax_count);
+
+    /* copy the max bytes to this buffer. */
+    uint32_t nmax_bytes = htonl(max_bytes);
+    memcpy(breq, &nmax_bytes, sizeof(nmax_bytes));
+    breq += sizeof(nmax_bytes);
+
+    /* move the contents of the temporary buffer to the return buffer. */
+    vccrypt_buffer_move(buffer, &tmp);
+
+    /* success. */
+    return STATUS_SUCCESS;
+}
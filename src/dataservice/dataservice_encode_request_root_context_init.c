@@ -18,6 +18,9 @@
  *                              request.
  * \param alloc_opts            The allocator options to use.
  * \param max_database_size     The maximum database size.
+ * \param datastore_flags       The DATASTORE_FLAG_* database tuning flags.
+ * \param max_readers           The size of the database reader table, or 0 for
+ *                              the default.
  * \param datadir               The data directory to open.
  *
  * \returns a status code indicating success or failure.
@@ -26,7 +29,8 @@
  */
 status dataservice_encode_request_root_context_init(
     vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
-    uint64_t max_database_size, const char* datadir)
+    uint64_t max_database_size, uint32_t datastore_flags,
+    uint32_t max_readers, const char* datadir)
 {
     status retval;
     vccrypt_buffer_t tmp;
@@ -48,7 +52,9 @@ status dataservice_encode_request_root_context_init(
     /* | --------------------------------------------- | ------------ | */
     /* | DATASERVICE_API_METHOD_LL_ROOT_CONTEXT_CREATE | 4 bytes      | */
     /* | max database size                             | 8 bytes      | */
-    /* | datadir                                       | n - 4 bytes  | */
+    /* | datastore flags                               | 4 bytes      | */
+    /* | max readers                                   | 4 bytes      | */
+    /* | datadir                                       | n - 20 bytes | */
     /* | --------------------------------------------- | ------------ | */
 
     /* get the datadir length. */
@@ -58,6 +64,8 @@ status dataservice_encode_request_root_context_init(
     size_t reqbuflen =
         sizeof(uint32_t)            /* request id */
       + sizeof(max_database_size)
+      + sizeof(datastore_flags)
+      + sizeof(max_readers)
       + datadirlen;
 
     /* create a buffer for holding the request. */
@@ -80,6 +88,16 @@ status dataservice_encode_request_root_context_init(
     memcpy(breq, &net_max_database_size, sizeof(net_max_database_size));
     breq += sizeof(net_max_database_size);
 
+    /* copy the datastore flags parameter to this buffer. */
+    uint32_t net_datastore_flags = htonl(datastore_flags);
+    memcpy(breq, &net_datastore_flags, sizeof(net_datastore_flags));
+    breq += sizeof(net_datastore_flags);
+
+    /* copy the max readers parameter to this buffer. */
+    uint32_t net_max_readers = htonl(max_readers);
+    memcpy(breq, &net_max_readers, sizeof(net_max_readers));
+    breq += sizeof(net_max_readers);
+
     /* copy the datadir parameter to this buffer. */
     memcpy(breq, datadir, datadirlen);
     breq += datadirlen;
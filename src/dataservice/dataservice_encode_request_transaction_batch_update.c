@@ -0,0 +1,99 @@
+/**
+ * \file dataservice/dataservice_encode_request_transaction_batch_update.c
+ *
+ * \brief Encode a request to promote or drop a batch of transactions.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/dataservice/async_api.h>
+#include <agentd/status_codes.h>
+
+/**
+ * \brief Encode a request to promote or drop a batch of transactions in the
+ * process queue.
+ *
+ * \param buffer        Pointer to an uninitialized \ref vccrypt_buffer_t to
+ *                      receive the encoded request.
+ * \param alloc_opts    The allocator options to use.
+ * \param child         The child context for this request.
+ * \param entries       The entries for this request.
+ * \param count         The number of entries for this request.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status dataservice_encode_request_transaction_batch_update(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts, uint32_t child,
+    const data_transaction_batch_update_entry_t* entries, size_t count)
+{
+    status retval;
+    vccrypt_buffer_t tmp;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != buffer);
+    MODEL_ASSERT(prop_allocator_options_valid(alloc_opts));
+    MODEL_ASSERT(NULL != entries);
+
+    /* runtime parameter sanity checks. */
+    if (NULL == buffer || NULL == alloc_opts || NULL == entries || 0U == count)
+    {
+        return AGENTD_ERROR_DATASERVICE_INVALID_PARAMETER;
+    }
+
+    /* | Transaction Queue Batch Update packet.                               */
+    /* | ---------------------------------------------------- | ----------- | */
+    /* | DATA                                                 | SIZE        | */
+    /* | ---------------------------------------------------- | ----------- | */
+    /* | DATASERVICE_API_METHOD_APP_PQ_TRANSACTION_BATCH_...  |  4 bytes    | */
+    /* | child_context_index                                  |  4 bytes    | */
+    /* | entries, each of which is:                           | n * 20      | */
+    /* |    transaction UUID                                  | 16 bytes    | */
+    /* |    action                                            |  4 bytes    | */
+    /* | ---------------------------------------------------- | ----------- | */
+
+    /* compute the request buffer size. */
+    size_t reqbuflen =
+        sizeof(uint32_t)    /* request id */
+      + sizeof(child)
+      + count * DATASERVICE_TRANSACTION_BATCH_UPDATE_ENTRY_SIZE;
+
+    /* create a buffer for holding the request. */
+    retval = vccrypt_buffer_init(&tmp, alloc_opts, reqbuflen);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* make working with the buffer more convenient. */
+    uint8_t* breq = (uint8_t*)tmp.data;
+
+    /* copy the request id to the buffer. */
+    uint32_t req =
+        htonl(DATASERVICE_API_METHOD_APP_PQ_TRANSACTION_BATCH_UPDATE);
+    memcpy(breq, &req, sizeof(req));
+    breq += sizeof(req);
+
+    /* copy the child context index parameter to the buffer. */
+    uint32_t nchild = htonl(child);
+    memcpy(breq, &nchild, sizeof(nchild));
+    breq += sizeof(child);
+
+    /* copy each entry to the buffer. */
+    for (size_t i = 0; i < count; ++i)
+    {
+        memcpy(breq, entries[i].txn_id, sizeof(entries[i].txn_id));
+        breq += sizeof(entries[i].txn_id);
+
+        uint32_t naction = htonl(entries[i].action);
+        memcpy(breq, &naction, sizeof(naction));
+        breq += sizeof(naction);
+    }
+
+    /* move the contents of the temporary buffer to the return buffer. */
+    vccrypt_buffer_move(buffer, &tmp);
+
+    /* success. */
+    return STATUS_SUCCESS;
+}
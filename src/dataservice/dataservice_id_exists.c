@@ -0,0 +1,148 @@
+/**
+ * \file dataservice/dataservice_id_exists.c
+ *
+ * \brief Check whether an id is in use as a block, transaction, or artifact id.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/dataservice/private/dataservice.h>
+#include <agentd/status_codes.h>
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "dataservice_internal.h"
+
+/**
+ * \brief Check whether an id is in use as a block, transaction, or artifact id.
+ *
+ * Most new ids are rejected by the id filter without reading the database.
+ *
+ * \param child         The child context for this operation.
+ * \param dtxn_ctx      The dataservice transaction context for this operation,
+ *                      or NULL.
+ * \param id            The 16 byte id to check.
+ *
+ * \returns A status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS if the id is in use.
+ *      - AGENTD_ERROR_DATASERVICE_NOT_FOUND if the id is not in use.
+ *      - AGENTD_ERROR_DATASERVICE_NOT_AUTHORIZED if this child context is not
+ *        authorized for this operation.
+ *      - AGENTD_ERROR_DATASERVICE_MDB_TXN_BEGIN_FAILURE if this operation
+ *        failed to begin a transaction.
+ *      - AGENTD_ERROR_DATASERVICE_MDB_GET_FAILURE if there was a failure
+ *        reading from the database.
+ */
+int dataservice_id_exists(
+    dataservice_child_context_t* child,
+    dataservice_transaction_context_t* dtxn_ctx, const uint8_t* id)
+{
+    int retval = 0;
+    MDB_txn* txn = NULL;
+
+    /* parameter sanity check. */
+    MODEL_ASSERT(NULL != child);
+    MODEL_ASSERT(NULL != child->root);
+    MODEL_ASSERT(NULL != child->root->details);
+    MODEL_ASSERT(NULL != id);
+
+    /* verify that we are allowed to read each of the id databases. */
+    if (!BITCAP_ISSET(child->childcaps, DATASERVICE_API_CAP_APP_BLOCK_READ)
+     || !BITCAP_ISSET(child->childcaps,
+            DATASERVICE_API_CAP_APP_TRANSACTION_READ)
+     || !BITCAP_ISSET(child->childcaps,
+            DATASERVICE_API_CAP_APP_ARTIFACT_READ))
+    {
+        retval = AGENTD_ERROR_DATASERVICE_NOT_AUTHORIZED;
+        goto done;
+    }
+
+    /* get the details for this database connection. */
+    dataservice_database_details_t* details =
+        (dataservice_database_details_t*)child->root->details;
+
+    /* set the parent transaction. */
+    MDB_txn* parent = (NULL != dtxn_ctx) ? dtxn_ctx->txn : NULL;
+
+    /* if the parent transaction is NULL, begin a transaction, or else use the
+     * parent transaction. */
+    if (NULL == parent)
+    {
+        if (0 != mdb_txn_begin(details->env, NULL, MDB_RDONLY, &txn))
+        {
+            retval = AGENTD_ERROR_DATASERVICE_MDB_TXN_BEGIN_FAILURE;
+            goto done;
+        }
+    }
+
+    /* set the transaction to be used for now on. */
+    MDB_txn* query_txn = (NULL != txn) ? txn : parent;
+
+    /* check the id. */
+    retval = dataservice_id_exists_internal(details, query_txn, id);
+
+    /* abort the transaction if we began it. */
+    if (NULL != txn)
+    {
+        mdb_txn_abort(txn);
+    }
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Check whether an id is in use as a block, transaction, or artifact id.
+ *
+ * This is the internal version of the function, which does not perform any
+ * capabilities checking.  As such, it SHOULD NOT BE USED OUTSIDE OF THE DATA
+ * SERVICE.
+ *
+ * \param details           The database details.
+ * \param txn               The transaction under which the databases are read.
+ * \param id                The 16 byte id to check.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS if the id is in use.
+ *      - AGENTD_ERROR_DATASERVICE_NOT_FOUND if the id is not in use.
+ *      - AGENTD_ERROR_DATASERVICE_MDB_GET_FAILURE if this function failed to
+ *        read from the database.
+ */
+int dataservice_id_exists_internal(
+    dataservice_database_details_t* details, MDB_txn* txn, const uint8_t* id)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != details);
+    MODEL_ASSERT(NULL != txn);
+    MODEL_ASSERT(NULL != id);
+
+    /* once the filter covers every block visible to this transaction, an id
+     * that was never added can't be in the database. */
+    if (AGENTD_STATUS_SUCCESS == dataservice_id_filter_sync(details, txn)
+     && !dataservice_id_filter_may_contain(&details->id_filter, id))
+    {
+        return AGENTD_ERROR_DATASERVICE_NOT_FOUND;
+    }
+
+    /* otherwise, check each database. */
+    MDB_dbi dbis[] = {
+        details->txn_db, details->block_db, details->artifact_db };
+    for (size_t i = 0; i < sizeof(dbis) / sizeof(dbis[0]); ++i)
+    {
+        MDB_val lkey = { 16, (void*)id };
+        MDB_val lval = { 0, NULL };
+
+        int retval = mdb_get(txn, dbis[i], &lkey, &lval);
+        if (0 == retval)
+        {
+            return AGENTD_STATUS_SUCCESS;
+        }
+        else if (MDB_NOTFOUND != retval)
+        {
+            return AGENTD_ERROR_DATASERVICE_MDB_GET_FAILURE;
+        }
+    }
+
+    return AGENTD_ERROR_DATASERVICE_NOT_FOUND;
+}
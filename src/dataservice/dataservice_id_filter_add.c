@@ -0,0 +1,65 @@
+/**
+ * \file dataservice/dataservice_id_filter_add.c
+ *
+ * \brief Add an id to the id filter.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/status_codes.h>
+#include <cbmc/model_assert.h>
+
+#include "dataservice_internal.h"
+
+/**
+ * \brief Add an id to the id filter.
+ *
+ * If the last layer is full, a larger layer is added.  If that fails, the id
+ * is added to the full layer anyway, which raises the false positive rate but
+ * never hides an id.
+ *
+ * \param filter            The id filter to update.
+ * \param id                The 16 byte id to add.
+ */
+void dataservice_id_filter_add(
+    dataservice_id_filter_t* filter, const uint8_t* id)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != filter);
+    MODEL_ASSERT(NULL != id);
+
+    /* a filter without layers already may contain every id. */
+    if (0U == filter->layer_count)
+    {
+        return;
+    }
+
+    /* grow the filter if the last layer is full. */
+    dataservice_id_filter_layer_t* layer =
+        &filter->layers[filter->layer_count - 1];
+    if (layer->count >= layer->capacity
+     && AGENTD_STATUS_SUCCESS ==
+            dataservice_id_filter_layer_create(filter, 2 * layer->capacity))
+    {
+        layer = &filter->layers[filter->layer_count - 1];
+    }
+
+    /* the upper bits of the hash pick the block, and the lower bits pick the
+     * bits within the block. */
+    uint64_t hash = dataservice_id_filter_hash(id);
+    uint64_t* block =
+        layer->blocks
+            + ((hash >> 32) & (layer->block_count - 1))
+                * DATASERVICE_ID_FILTER_BLOCK_WORDS;
+    uint32_t bit = hash & 511U;
+    uint32_t step = ((hash >> 9) & 511U) | 1U;
+
+    /* set the bits for this id. */
+    for (int i = 0; i < DATASERVICE_ID_FILTER_HASH_COUNT; ++i)
+    {
+        block[bit >> 6] |= UINT64_C(1) << (bit & 63U);
+        bit = (bit + step) & 511U;
+    }
+
+    ++layer->count;
+}
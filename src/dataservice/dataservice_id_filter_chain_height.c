@@ -0,0 +1,66 @@
+/**
+ * \file dataservice/dataservice_id_filter_chain_height.c
+ *
+ * \brief Get the height of the block chain for the id filter.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/inet.h>
+#include <agentd/status_codes.h>
+#include <cbmc/model_assert.h>
+#include <string.h>
+
+#include "dataservice_internal.h"
+
+/**
+ * \brief Get the height of the block chain as seen by a transaction.
+ *
+ * \param details           The database details.
+ * \param txn               The transaction under which the database is read.
+ * \param height            Set to the height of the latest block, or zero if
+ *                          there are no blocks.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_DATASERVICE_MDB_GET_FAILURE if this function failed to
+ *        read from the database.
+ *      - AGENTD_ERROR_DATASERVICE_INVALID_STORED_BLOCK_NODE if the stored end
+ *        node is invalid.
+ */
+int dataservice_id_filter_chain_height(
+    dataservice_database_details_t* details, MDB_txn* txn, uint64_t* height)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != details);
+    MODEL_ASSERT(NULL != txn);
+    MODEL_ASSERT(NULL != height);
+
+    /* the end node of the block queue holds the latest block height. */
+    uint8_t key[16];
+    memset(key, 0xFF, sizeof(key));
+    MDB_val lkey = { sizeof(key), key };
+    MDB_val lval = { 0, NULL };
+
+    int retval = mdb_get(txn, details->block_db, &lkey, &lval);
+    if (MDB_NOTFOUND == retval)
+    {
+        /* there are no blocks yet. */
+        *height = 0U;
+        return AGENTD_STATUS_SUCCESS;
+    }
+    else if (0 != retval)
+    {
+        return AGENTD_ERROR_DATASERVICE_MDB_GET_FAILURE;
+    }
+    else if (lval.mv_size < sizeof(data_block_node_t))
+    {
+        return AGENTD_ERROR_DATASERVICE_INVALID_STORED_BLOCK_NODE;
+    }
+
+    data_block_node_t end;
+    memcpy(&end, lval.mv_data, sizeof(end));
+    *height = ntohll(end.net_block_height);
+
+    return AGENTD_STATUS_SUCCESS;
+}
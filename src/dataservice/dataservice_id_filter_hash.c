@@ -0,0 +1,56 @@
+/**
+ * \file dataservice/dataservice_id_filter_hash.c
+ *
+ * \brief Hash an id for the id filter.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+
+#include "dataservice_internal.h"
+
+/* forward decls. */
+static uint64_t dataservice_id_filter_mix(uint64_t val);
+
+/**
+ * \brief Hash an id for the id filter.
+ *
+ * Ids are supplied by clients, so they are mixed rather than trusted to be
+ * random.
+ *
+ * \param id                The 16 byte id to hash.
+ *
+ * \returns the 64-bit hash of this id.
+ */
+uint64_t dataservice_id_filter_hash(const uint8_t* id)
+{
+    uint64_t lo, hi;
+
+    /* parameter sanity check. */
+    MODEL_ASSERT(NULL != id);
+
+    memcpy(&lo, id, sizeof(lo));
+    memcpy(&hi, id + sizeof(lo), sizeof(hi));
+
+    return dataservice_id_filter_mix(lo ^ dataservice_id_filter_mix(hi));
+}
+
+/**
+ * \brief Mix the bits of a 64-bit value, using the MurmurHash3 finalizer.
+ *
+ * \param val               The value to mix.
+ *
+ * \returns the mixed value.
+ */
+static uint64_t dataservice_id_filter_mix(uint64_t val)
+{
+    val ^= val >> 33;
+    val *= 0xff51afd7ed558ccdULL;
+    val ^= val >> 33;
+    val *= 0xc4ceb9fe1a85ec53ULL;
+    val ^= val >> 33;
+
+    return val;
+}
@@ -0,0 +1,65 @@
+/**
+ * \file dataservice/dataservice_id_filter_layer_create.c
+ *
+ * \brief Append a new layer to the id filter.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/status_codes.h>
+#include <cbmc/model_assert.h>
+#include <stdlib.h>
+
+#include "dataservice_internal.h"
+
+/**
+ * \brief Create a new, empty id filter layer and append it to the id filter.
+ *
+ * \param filter            The id filter to update.
+ * \param capacity          The number of ids that the new layer should hold.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_GENERAL_OUT_OF_MEMORY if the layer could not be
+ *        allocated, or if the filter already has the maximum number of layers.
+ */
+int dataservice_id_filter_layer_create(
+    dataservice_id_filter_t* filter, size_t capacity)
+{
+    /* parameter sanity check. */
+    MODEL_ASSERT(NULL != filter);
+
+    /* don't grow past the maximum number of layers. */
+    if (filter->layer_count >= DATASERVICE_ID_FILTER_MAX_LAYERS)
+    {
+        return AGENTD_ERROR_GENERAL_OUT_OF_MEMORY;
+    }
+
+    /* the block count is a power of two, so a block is picked with a mask. */
+    size_t block_count = 1U;
+    while (block_count * DATASERVICE_ID_FILTER_IDS_PER_BLOCK < capacity)
+    {
+        block_count <<= 1;
+    }
+
+    /* allocate the cleared blocks for this layer. */
+    uint64_t* blocks =
+        (uint64_t*)calloc(
+            block_count,
+            DATASERVICE_ID_FILTER_BLOCK_WORDS * sizeof(uint64_t));
+    if (NULL == blocks)
+    {
+        return AGENTD_ERROR_GENERAL_OUT_OF_MEMORY;
+    }
+
+    /* append the layer. */
+    dataservice_id_filter_layer_t* layer =
+        &filter->layers[filter->layer_count];
+    layer->blocks = blocks;
+    layer->block_count = block_count;
+    layer->capacity = block_count * DATASERVICE_ID_FILTER_IDS_PER_BLOCK;
+    layer->count = 0U;
+    ++filter->layer_count;
+
+    return AGENTD_STATUS_SUCCESS;
+}
@@ -0,0 +1,68 @@
+/**
+ * \file dataservice/dataservice_id_filter_may_contain.c
+ *
+ * \brief Check whether an id may be in the id filter.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+
+#include "dataservice_internal.h"
+
+/**
+ * \brief Check whether an id may be in the id filter.
+ *
+ * \param filter            The id filter to check.
+ * \param id                The 16 byte id to check.
+ *
+ * \returns false if this id was never added to the filter, or true if it may
+ * have been added.
+ */
+bool dataservice_id_filter_may_contain(
+    const dataservice_id_filter_t* filter, const uint8_t* id)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != filter);
+    MODEL_ASSERT(NULL != id);
+
+    /* a filter without layers may contain every id. */
+    if (0U == filter->layer_count)
+    {
+        return true;
+    }
+
+    uint64_t hash = dataservice_id_filter_hash(id);
+
+    /* the id may have been added to any layer. */
+    for (size_t l = 0; l < filter->layer_count; ++l)
+    {
+        const dataservice_id_filter_layer_t* layer = &filter->layers[l];
+        const uint64_t* block =
+            layer->blocks
+                + ((hash >> 32) & (layer->block_count - 1))
+                    * DATASERVICE_ID_FILTER_BLOCK_WORDS;
+        uint32_t bit = hash & 511U;
+        uint32_t step = ((hash >> 9) & 511U) | 1U;
+        bool found = true;
+
+        /* every bit for this id must be set. */
+        for (int i = 0; i < DATASERVICE_ID_FILTER_HASH_COUNT; ++i)
+        {
+            if (0U == (block[bit >> 6] & (UINT64_C(1) << (bit & 63U))))
+            {
+                found = false;
+                break;
+            }
+
+            bit = (bit + step) & 511U;
+        }
+
+        if (found)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
@@ -0,0 +1,168 @@
+/**
+ * \file dataservice/dataservice_id_filter_rebuild.c
+ *
+ * \brief Build the id filter from the database.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/status_codes.h>
+#include <cbmc/model_assert.h>
+
+#include "dataservice_internal.h"
+
+/* forward decls. */
+static int dataservice_id_filter_rebuild_db(
+    dataservice_database_details_t* details, MDB_txn* txn, MDB_dbi dbi);
+
+/**
+ * \brief Build the id filter from the block, transaction, and artifact
+ * databases.
+ *
+ * This is done each time the database is opened, and when the filter is ahead
+ * of the database.  If there isn't enough memory for the filter, it is left
+ * empty, and every id lookup goes to the database.
+ *
+ * \param details           The database details.
+ * \param txn               The transaction under which the databases are read.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_DATASERVICE_MDB_GET_FAILURE if this function failed to
+ *        read from the database.
+ *      - AGENTD_ERROR_DATASERVICE_INVALID_STORED_BLOCK_NODE if the stored end
+ *        node is invalid.
+ */
+int dataservice_id_filter_rebuild(
+    dataservice_database_details_t* details, MDB_txn* txn)
+{
+    int retval;
+    uint64_t height;
+    MDB_stat block_stat, txn_stat, artifact_stat;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != details);
+    MODEL_ASSERT(NULL != txn);
+
+    /* start from an empty filter. */
+    dataservice_id_filter_release(&details->id_filter);
+
+    /* the filter will cover the chain as seen by this transaction. */
+    retval = dataservice_id_filter_chain_height(details, txn, &height);
+    if (AGENTD_STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* count the ids to add to the filter. */
+    if (0 != mdb_stat(txn, details->block_db, &block_stat)
+     || 0 != mdb_stat(txn, details->txn_db, &txn_stat)
+     || 0 != mdb_stat(txn, details->artifact_db, &artifact_stat))
+    {
+        retval = AGENTD_ERROR_DATASERVICE_MDB_GET_FAILURE;
+        goto done;
+    }
+
+    /* leave room for the database to double before adding a layer. */
+    size_t capacity =
+        2 * (block_stat.ms_entries + txn_stat.ms_entries
+                + artifact_stat.ms_entries);
+    if (capacity < DATASERVICE_ID_FILTER_MIN_CAPACITY)
+    {
+        capacity = DATASERVICE_ID_FILTER_MIN_CAPACITY;
+    }
+
+    /* without memory for the filter, every lookup goes to the database. */
+    if (AGENTD_STATUS_SUCCESS !=
+            dataservice_id_filter_layer_create(&details->id_filter, capacity))
+    {
+        details->id_filter.height = height;
+        retval = AGENTD_STATUS_SUCCESS;
+        goto done;
+    }
+
+    /* add the ids from each database. */
+    retval = dataservice_id_filter_rebuild_db(details, txn, details->block_db);
+    if (AGENTD_STATUS_SUCCESS != retval)
+    {
+        goto release_filter;
+    }
+
+    retval = dataservice_id_filter_rebuild_db(details, txn, details->txn_db);
+    if (AGENTD_STATUS_SUCCESS != retval)
+    {
+        goto release_filter;
+    }
+
+    retval =
+        dataservice_id_filter_rebuild_db(details, txn, details->artifact_db);
+    if (AGENTD_STATUS_SUCCESS != retval)
+    {
+        goto release_filter;
+    }
+
+    /* success. */
+    details->id_filter.height = height;
+    goto done;
+
+release_filter:
+    dataservice_id_filter_release(&details->id_filter);
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Add the id of each record in a database to the id filter.
+ *
+ * \param details           The database details.
+ * \param txn               The transaction under which the database is read.
+ * \param dbi               The database to read.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_DATASERVICE_MDB_GET_FAILURE if this function failed to
+ *        read from the database.
+ */
+static int dataservice_id_filter_rebuild_db(
+    dataservice_database_details_t* details, MDB_txn* txn, MDB_dbi dbi)
+{
+    int retval;
+    MDB_cursor* cursor = NULL;
+
+    /* open a cursor on the database. */
+    if (0 != mdb_cursor_open(txn, dbi, &cursor))
+    {
+        return AGENTD_ERROR_DATASERVICE_MDB_GET_FAILURE;
+    }
+
+    /* add each id. */
+    MDB_val lkey, lval;
+    for (retval = mdb_cursor_get(cursor, &lkey, &lval, MDB_FIRST);
+         0 == retval;
+         retval = mdb_cursor_get(cursor, &lkey, &lval, MDB_NEXT))
+    {
+        /* skip keys that are not ids, such as the root block key. */
+        if (16U != lkey.mv_size)
+        {
+            continue;
+        }
+
+        dataservice_id_filter_add(
+            &details->id_filter, (const uint8_t*)lkey.mv_data);
+    }
+
+    /* the walk ends when we run out of records. */
+    if (MDB_NOTFOUND != retval)
+    {
+        retval = AGENTD_ERROR_DATASERVICE_MDB_GET_FAILURE;
+    }
+    else
+    {
+        retval = AGENTD_STATUS_SUCCESS;
+    }
+
+    mdb_cursor_close(cursor);
+
+    return retval;
+}
@@ -0,0 +1,31 @@
+/**
+ * \file dataservice/dataservice_id_filter_release.c
+ *
+ * \brief Release the layers of the id filter.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "dataservice_internal.h"
+
+/**
+ * \brief Release the layers of an id filter, leaving it empty.
+ *
+ * \param filter            The id filter to release.
+ */
+void dataservice_id_filter_release(dataservice_id_filter_t* filter)
+{
+    /* parameter sanity check. */
+    MODEL_ASSERT(NULL != filter);
+
+    for (size_t l = 0; l < filter->layer_count; ++l)
+    {
+        free(filter->layers[l].blocks);
+    }
+
+    memset(filter, 0, sizeof(*filter));
+}
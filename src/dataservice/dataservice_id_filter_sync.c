@@ -0,0 +1,241 @@
+/**
+ * \file dataservice/dataservice_id_filter_sync.c
+ *
+ * \brief Bring the id filter up to the height of the block chain.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/inet.h>
+#include <agentd/status_codes.h>
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vccert/fields.h>
+
+#include "dataservice_internal.h"
+
+/* forward decls. */
+static int dataservice_id_filter_sync_block(
+    dataservice_database_details_t* details, MDB_txn* txn, uint64_t height);
+static int dataservice_id_filter_sync_transaction(
+    dataservice_database_details_t* details, const uint8_t* cert,
+    size_t cert_size);
+
+/**
+ * \brief Bring the id filter up to the block height seen by a transaction.
+ *
+ * Blocks written by another dataservice process since the filter was last
+ * synced are read back and their ids are added.  If the filter is ahead of the
+ * database, because a block it saw was rolled back, it is rebuilt.
+ *
+ * \param details           The database details.
+ * \param txn               The transaction under which the database is read.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS if the filter covers every id visible to this
+ *        transaction, so that a miss can be trusted.
+ *      - a non-zero error code if the filter could not be synced, in which case
+ *        a miss must be checked against the database.
+ */
+int dataservice_id_filter_sync(
+    dataservice_database_details_t* details, MDB_txn* txn)
+{
+    int retval;
+    uint64_t height;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != details);
+    MODEL_ASSERT(NULL != txn);
+
+    /* a filter without layers may contain any id, so it is never stale. */
+    if (0U == details->id_filter.layer_count)
+    {
+        return AGENTD_STATUS_SUCCESS;
+    }
+
+    /* get the height of the chain as seen by this transaction. */
+    retval = dataservice_id_filter_chain_height(details, txn, &height);
+    if (AGENTD_STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* the filter already covers this chain. */
+    if (height == details->id_filter.height)
+    {
+        return AGENTD_STATUS_SUCCESS;
+    }
+
+    /* the filter saw a block that was rolled back, so start over. */
+    if (height < details->id_filter.height)
+    {
+        return dataservice_id_filter_rebuild(details, txn);
+    }
+
+    /* add the ids from each block written since the filter was synced. */
+    while (details->id_filter.height < height)
+    {
+        retval =
+            dataservice_id_filter_sync_block(
+                details, txn, details->id_filter.height + 1);
+        if (AGENTD_STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        ++details->id_filter.height;
+    }
+
+    return AGENTD_STATUS_SUCCESS;
+}
+
+/**
+ * \brief Add the block id and the wrapped transaction and artifact ids of the
+ * block at the given height to the id filter.
+ *
+ * \param details           The database details.
+ * \param txn               The transaction under which the database is read.
+ * \param height            The height of the block to add.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static int dataservice_id_filter_sync_block(
+    dataservice_database_details_t* details, MDB_txn* txn, uint64_t height)
+{
+    int retval;
+    vccert_parser_context_t parser;
+    uint8_t block_id[16];
+
+    /* look up the block id for this height. */
+    uint64_t net_height = htonll(height);
+    MDB_val lkey = { sizeof(net_height), &net_height };
+    MDB_val lval = { 0, NULL };
+    if (0 != mdb_get(txn, details->height_db, &lkey, &lval))
+    {
+        return AGENTD_ERROR_DATASERVICE_MDB_GET_FAILURE;
+    }
+    else if (sizeof(block_id) != lval.mv_size)
+    {
+        return AGENTD_ERROR_DATASERVICE_INVALID_STORED_BLOCK_NODE;
+    }
+
+    memcpy(block_id, lval.mv_data, sizeof(block_id));
+
+    /* read the block. */
+    lkey.mv_size = sizeof(block_id);
+    lkey.mv_data = block_id;
+    if (0 != mdb_get(txn, details->block_db, &lkey, &lval))
+    {
+        return AGENTD_ERROR_DATASERVICE_MDB_GET_FAILURE;
+    }
+    else if (lval.mv_size < sizeof(data_block_node_t))
+    {
+        return AGENTD_ERROR_DATASERVICE_INVALID_STORED_BLOCK_NODE;
+    }
+
+    /* the block certificate follows the block node. */
+    const uint8_t* cert =
+        (const uint8_t*)lval.mv_data + sizeof(data_block_node_t);
+    size_t cert_size = lval.mv_size - sizeof(data_block_node_t);
+
+    /* create a parser for this block. */
+    if (VCCERT_STATUS_SUCCESS !=
+            vccert_parser_init(
+                &details->parser_options, &parser, cert, cert_size))
+    {
+        return AGENTD_ERROR_DATASERVICE_VCCERT_PARSER_INIT_FAILURE;
+    }
+
+    dataservice_id_filter_add(&details->id_filter, block_id);
+
+    /* add the ids of each wrapped transaction. */
+    const uint8_t* raw = NULL;
+    size_t raw_size = 0U;
+    int status =
+        vccert_parser_find_short(
+            &parser, VCCERT_FIELD_TYPE_WRAPPED_TRANSACTION_TUPLE, &raw,
+            &raw_size);
+    while (VCCERT_STATUS_SUCCESS == status)
+    {
+        retval =
+            dataservice_id_filter_sync_transaction(details, raw, raw_size);
+        if (AGENTD_STATUS_SUCCESS != retval)
+        {
+            goto dispose_parser;
+        }
+
+        status = vccert_parser_find_next(&parser, &raw, &raw_size);
+    }
+
+    /* success. */
+    retval = AGENTD_STATUS_SUCCESS;
+
+dispose_parser:
+    dispose((disposable_t*)&parser);
+
+    return retval;
+}
+
+/**
+ * \brief Add the transaction and artifact ids of a wrapped transaction to the
+ * id filter.
+ *
+ * \param details           The database details.
+ * \param cert              The wrapped transaction certificate.
+ * \param cert_size         The size of the wrapped transaction certificate.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static int dataservice_id_filter_sync_transaction(
+    dataservice_database_details_t* details, const uint8_t* cert,
+    size_t cert_size)
+{
+    int retval;
+    vccert_parser_context_t parser;
+    const uint8_t* id = NULL;
+    size_t id_size = 0U;
+
+    /* create a parser for this transaction. */
+    if (VCCERT_STATUS_SUCCESS !=
+            vccert_parser_init(
+                &details->parser_options, &parser, cert, cert_size))
+    {
+        return AGENTD_ERROR_DATASERVICE_VCCERT_PARSER_INIT_FAILURE;
+    }
+
+    /* add the transaction id. */
+    if (VCCERT_STATUS_SUCCESS !=
+            vccert_parser_find_short(
+                &parser, VCCERT_FIELD_TYPE_CERTIFICATE_ID, &id, &id_size)
+     || 16 != id_size)
+    {
+        retval = AGENTD_ERROR_DATASERVICE_MISSING_CHILD_TRANSACTION_UUID;
+        goto dispose_parser;
+    }
+
+    dataservice_id_filter_add(&details->id_filter, id);
+
+    /* add the artifact id. */
+    if (VCCERT_STATUS_SUCCESS !=
+            vccert_parser_find_short(
+                &parser, VCCERT_FIELD_TYPE_ARTIFACT_ID, &id, &id_size)
+     || 16 != id_size)
+    {
+        retval = AGENTD_ERROR_DATASERVICE_MISSING_CHILD_ARTIFACT_UUID;
+        goto dispose_parser;
+    }
+
+    dataservice_id_filter_add(&details->id_filter, id);
+
+    /* success. */
+    retval = AGENTD_STATUS_SUCCESS;
+
+dispose_parser:
+    dispose((disposable_t*)&parser);
+
+    return retval;
+}
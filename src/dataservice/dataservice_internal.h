@@ -12,8 +12,11 @@
 #include <agentd/dataservice.h>
 #include <agentd/dataservice/private/dataservice.h>
 #include <agentd/ipc.h>
+#include <agentd/workpool.h>
 #include <event.h>
 #include <lmdb.h>
+#include <vccert/parser.h>
+#include <vccrypt/suite.h>
 #include <vpr/allocator/malloc_allocator.h>
 
 /* make this header C++ friendly. */
@@ -21,6 +24,75 @@
 extern "C" {
 #endif  //__cplusplus
 
+/**
+ * \brief The number of threads, including the caller, that parse large blocks.
+ */
+#define DATASERVICE_BLOCK_MAKE_PARSE_THREADS 4
+
+/**
+ * \brief Blocks with fewer wrapped transactions than this are parsed inline.
+ */
+#define DATASERVICE_BLOCK_MAKE_PARALLEL_MIN 64
+
+/**
+ * \brief The number of 64-bit words in an id filter block.  A block is one
+ * cache line, so checking an id touches a single line per layer.
+ */
+#define DATASERVICE_ID_FILTER_BLOCK_WORDS 8
+
+/**
+ * \brief The number of bits set in a block for each id in the id filter.
+ */
+#define DATASERVICE_ID_FILTER_HASH_COUNT 8
+
+/**
+ * \brief The number of ids an id filter block holds before a layer is
+ * considered full.  At 16 bits per id, the false positive rate of a full layer
+ * stays around one in a thousand.
+ */
+#define DATASERVICE_ID_FILTER_IDS_PER_BLOCK 32
+
+/**
+ * \brief The smallest capacity of an id filter layer.
+ */
+#define DATASERVICE_ID_FILTER_MIN_CAPACITY 65536
+
+/**
+ * \brief The maximum number of layers in an id filter.  Each layer holds twice
+ * as many ids as the layer before it.
+ */
+#define DATASERVICE_ID_FILTER_MAX_LAYERS 16
+
+/**
+ * \brief A single layer of the id filter; a blocked Bloom filter.
+ */
+typedef struct dataservice_id_filter_layer
+{
+    uint64_t* blocks;
+    size_t block_count;
+    size_t capacity;
+    size_t count;
+} dataservice_id_filter_layer_t;
+
+/**
+ * \brief The id filter tracks every block, transaction, and artifact id known
+ * to the database, so that most lookups for new ids skip the database.
+ *
+ * A Bloom filter can't grow, so a new, larger layer is added once the last
+ * layer is full.  An id may be in the database only if some layer may contain
+ * it.  A filter without layers may contain any id.
+ *
+ * Each dataservice process keeps its own filter, but blocks are written by
+ * only one of them.  The filter records the block height it covers, and must
+ * be synced to the chain height before a miss can be trusted.
+ */
+typedef struct dataservice_id_filter
+{
+    dataservice_id_filter_layer_t layers[DATASERVICE_ID_FILTER_MAX_LAYERS];
+    size_t layer_count;
+    uint64_t height;
+} dataservice_id_filter_t;
+
 /**
  * \brief The database details structure used to maintain a database connection.
  */
@@ -33,6 +105,13 @@ typedef struct dataservice_database_details
     MDB_dbi pq_db;
     MDB_dbi artifact_db;
     MDB_dbi height_db;
+    MDB_dbi artifact_txn_db;
+    dataservice_id_filter_t id_filter;
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t crypto_suite;
+    vccert_parser_options_t parser_options;
+    RCPR_SYM(allocator)* rcpr_alloc;
+    workpool* parse_pool;
 } dataservice_database_details_t;
 
 /**
@@ -50,6 +129,44 @@ typedef struct dataservice_child_details
  */
 #define DATASERVICE_MAX_CHILD_CONTEXTS 1024
 
+/**
+ * \brief The maximum number of transactions returned by a single process queue
+ * transaction list read.
+ */
+#define DATASERVICE_MAX_TRANSACTION_LIST_COUNT 1024
+
+/**
+ * \brief The maximum number of blocks returned by a single block range read.
+ */
+#define DATASERVICE_MAX_BLOCK_RANGE_COUNT 1024
+
+/**
+ * \brief The block range read stops adding blocks to a response once the
+ * certificates in that response reach this many bytes.
+ */
+#define DATASERVICE_MAX_BLOCK_RANGE_BYTES (1024 * 1024)
+
+/**
+ * \brief The maximum number of entries returned by a single artifact
+ * transaction list read.
+ */
+#define DATASERVICE_MAX_ARTIFACT_TRANSACTION_LIST_COUNT 1024
+
+/**
+ * \brief The maximum number of entries accepted by a single process queue
+ * transaction batch update.
+ */
+#define DATASERVICE_MAX_TRANSACTION_BATCH_UPDATE_COUNT 1024
+
+/**
+ * \brief The size of an artifact transaction index key.
+ *
+ * The key is the artifact id, followed by the big endian block height and the
+ * big endian index of the transaction among the artifact's transactions in
+ * that block, so that a cursor walks an artifact's history in order.
+ */
+#define DATASERVICE_ARTIFACT_TXN_KEY_SIZE (16 + 8 + 4)
+
 /**
  * \brief The database service instance.
  */
@@ -61,6 +178,8 @@ typedef struct dataservice_instance
     dataservice_child_details_t children[DATASERVICE_MAX_CHILD_CONTEXTS];
     dataservice_child_details_t* child_head;
     bool dataservice_force_exit;
+    bool submit_batch_disabled;
+    size_t referenced_responses;
     ipc_event_loop_context_t* loop_context;
 } dataservice_instance_t;
 
@@ -73,22 +192,83 @@ struct dataservice_transaction_context
     MDB_txn* txn;
 };
 
+/**
+ * \brief The maximum number of responses that may reference the database map
+ * at once.
+ *
+ * Each referenced response holds a read transaction, and with it a reader
+ * slot, until the socket drains.  The data service serves a single socket, so
+ * this is the limit for that socket.  Past it, values are copied instead.  A
+ * small reader table lowers this limit; see \ref
+ * dataservice_data_txn_reference_begin().
+ */
+#define DATASERVICE_MAX_REFERENCED_RESPONSES 16
+
+/**
+ * \brief A value read from the database to be written by reference.
+ *
+ * When \ref txn_open is set, the value points into the database map, and
+ * \ref dtxn is held open until the value is released.  Otherwise, the value
+ * was copied to \ref copy, which is freed when the value is released.
+ */
+typedef struct dataservice_data_txn_reference
+{
+    dataservice_instance_t* inst;
+    dataservice_transaction_context_t dtxn;
+    bool txn_open;
+    uint8_t* copy;
+    size_t copy_size;
+} dataservice_data_txn_reference_t;
+
+/**
+ * \brief The maximum number of transaction submissions committed together.
+ */
+#define DATASERVICE_MAX_SUBMIT_BATCH 256
+
+/**
+ * \brief A group of transaction submissions sharing a single write
+ * transaction.
+ *
+ * Submissions are applied under nested transactions of \ref txn and their
+ * responses are held until the group is committed by
+ * \ref dataservice_submit_batch_flush.
+ */
+typedef struct dataservice_submit_batch
+{
+    dataservice_transaction_context_t txn;
+    bool txn_open;
+    size_t count;
+    uint32_t offset[DATASERVICE_MAX_SUBMIT_BATCH];
+    uint32_t status[DATASERVICE_MAX_SUBMIT_BATCH];
+} dataservice_submit_batch_t;
+
 /**
  * \brief Open the database using the given data directory.
  *
  * \param ctx               The initialized root context that stores this
  *                          database.
  * \param max_database_size The maximum size for this database.
+ * \param datastore_flags   The DATASTORE_FLAG_* tuning flags for the database.
+ * \param max_readers       The size of the database reader table, or 0 for
+ *                          the default.
  * \param datadir           The directory where the database is stored.
  *
  * \returns a status code indicating success or failure.
  *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_GENERAL_OUT_OF_MEMORY if this function could not
+ *        allocate the database details or the block parse workers.
+ *      - AGENTD_ERROR_DATASERVICE_VCCRYPT_SUITE_OPTIONS_INIT_FAILURE if this
+ *        function failed to initialize crypto suite options.
+ *      - AGENTD_ERROR_DATASERVICE_VCCERT_PARSER_OPTIONS_INIT_FAILURE if this
+ *        function failed to initialize parser options.
  *      - AGENTD_ERROR_DATASERVICE_MDB_ENV_CREATE_FAILURE if this function
  *        failed to create a database environment.
  *      - AGENTD_ERROR_DATASERVICE_MDB_ENV_SET_MAPSIZE_FAILURE if this function
  *        failed to set the database map size.
  *      - AGENTD_ERROR_DATASERVICE_MDB_ENV_SET_MAXDBS_FAILURE if this function
  *        failed to set the maximum number of databases.
+ *      - AGENTD_ERROR_DATASERVICE_MDB_ENV_SET_MAXREADERS_FAILURE if this
+ *        function failed to set the maximum number of readers.
  *      - AGENTD_ERROR_DATASERVICE_MDB_ENV_OPEN_FAILURE if this function failed
  *        to open the database environment.
  *      - AGENTD_ERROR_DATASERVICE_MDB_TXN_BEGIN_FAILURE if this function failed
@@ -100,7 +280,7 @@ struct dataservice_transaction_context
  */
 int dataservice_database_open(
     dataservice_root_context_t* ctx, uint64_t max_database_size,
-    const char* datadir);
+    uint32_t datastore_flags, uint32_t max_readers, const char* datadir);
 
 /**
  * \brief Close the database.
@@ -268,6 +448,79 @@ int dataservice_decode_and_dispatch_write_status(
     ipc_socket_context_t* sock, uint32_t method, uint32_t offset,
     uint32_t status, void* data, size_t data_size);
 
+/**
+ * \brief Write a status response to the socket, appending a trailing value by
+ * reference.
+ *
+ * The response written is identical to one written by \ref
+ * dataservice_decode_and_dispatch_write_status() with the concatenation of
+ * data and ref as its payload.  The ref bytes are not copied; they must remain
+ * valid until the release callback is called, which occurs exactly once,
+ * including on failure.
+ *
+ * \param sock          The socket on which the request was received and the
+ *                      response is to be written.
+ * \param method        The API method of this request.
+ * \param offset        The offset for the child context.
+ * \param status        The status returned from this API method.
+ * \param data          Leading payload data for this call.  May be NULL.
+ * \param data_size     The size of this leading payload data.  Must be 0 if
+ *                      data is NULL.
+ * \param ref           Trailing payload data to reference for this call.
+ * \param ref_size      The size of this trailing payload data.
+ * \param release       The callback to release the trailing payload data.
+ * \param user_context  The user context passed to the release callback.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_GENERAL_OUT_OF_MEMORY if an out-of-memory condition was
+ *        encountered in this operation.
+ *      - AGENTD_ERROR_DATASERVICE_IPC_WRITE_DATA_FAILURE if data could not be
+ *        written to the client socket.
+ */
+int dataservice_decode_and_dispatch_write_status_by_reference(
+    ipc_socket_context_t* sock, uint32_t method, uint32_t offset,
+    uint32_t status, void* data, size_t data_size, const void* ref,
+    size_t ref_size, ipc_reference_release_cb_t release, void* user_context);
+
+/**
+ * \brief Begin a read for a value to be written by reference.
+ *
+ * If fewer responses reference the database map than the lesser of \ref
+ * DATASERVICE_MAX_REFERENCED_RESPONSES and half of the reader table, a read
+ * transaction is begun and counted against the instance.  If the limit is
+ * reached or the transaction cannot begin, no transaction is held, and the
+ * caller must read the value as a copy and store it in the reference.
+ *
+ * \param ref           Pointer to receive the heap allocated reference, which
+ *                      must be released with \ref
+ *                      dataservice_data_txn_reference_release().
+ * \param inst          The instance on which the read occurs.
+ * \param ctx           The child context for this read.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_GENERAL_OUT_OF_MEMORY if an out-of-memory condition was
+ *        encountered in this operation.
+ */
+int dataservice_data_txn_reference_begin(
+    dataservice_data_txn_reference_t** ref, dataservice_instance_t* inst,
+    dataservice_child_context_t* ctx);
+
+/**
+ * \brief Release a value that was written by reference.
+ *
+ * This callback aborts the held read transaction, or frees the copied value,
+ * and then frees the reference passed as the user context once the write
+ * buffer no longer references its value.
+ *
+ * \param data          The referenced data (unused).
+ * \param size          The size of the referenced data (unused).
+ * \param user_context  The dataservice_data_txn_reference_t to release.
+ */
+void dataservice_data_txn_reference_release(
+    const void* data, size_t size, void* user_context);
+
 /**
  * \brief Decode and dispatch a root context create request.
  *
@@ -484,6 +737,54 @@ int dataservice_decode_and_dispatch_transaction_get(
     dataservice_instance_t* inst, ipc_socket_context_t* sock, void* req,
     size_t size);
 
+/**
+ * \brief Decode and dispatch a transaction list get request.
+ *
+ * Returns 0 on success or non-fatal error.  If a non-zero error message is
+ * returned, then a fatal error has occurred that should not be recovered from.
+ * Any additional information on the socket is suspect.
+ *
+ * \param inst          The instance on which the dispatch occurs.
+ * \param sock          The socket on which the request was received and the
+ *                      response is to be written.
+ * \param req           The request to be decoded and dispatched.
+ * \param size          The size of the request.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_GENERAL_OUT_OF_MEMORY if an out-of-memory condition was
+ *        encountered in this operation.
+ *      - AGENTD_ERROR_DATASERVICE_IPC_WRITE_DATA_FAILURE if data could not be
+ *        written to the client socket.
+ */
+int dataservice_decode_and_dispatch_transaction_list_get(
+    dataservice_instance_t* inst, ipc_socket_context_t* sock, void* req,
+    size_t size);
+
+/**
+ * \brief Decode and dispatch a block range get request.
+ *
+ * Returns 0 on success or non-fatal error.  If a non-zero error message is
+ * returned, then a fatal error has occurred that should not be recovered from.
+ * Any additional information on the socket is suspect.
+ *
+ * \param inst          The instance on which the dispatch occurs.
+ * \param sock          The socket on which the request was received and the
+ *                      response is to be written.
+ * \param req           The request to be decoded and dispatched.
+ * \param size          The size of the request.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_GENERAL_OUT_OF_MEMORY if an out-of-memory condition was
+ *        encountered in this operation.
+ *      - AGENTD_ERROR_DATASERVICE_IPC_WRITE_DATA_FAILURE if data could not be
+ *        written to the client socket.
+ */
+int dataservice_decode_and_dispatch_block_range_get(
+    dataservice_instance_t* inst, ipc_socket_context_t* sock, void* req,
+    size_t size);
+
 /**
  * \brief Decode and dispatch a transaction drop request.
  *
@@ -556,6 +857,285 @@ int dataservice_decode_and_dispatch_artifact_read(
     dataservice_instance_t* inst, ipc_socket_context_t* sock, void* req,
     size_t size);
 
+/**
+ * \brief Decode and dispatch an artifact transaction list get request.
+ *
+ * Returns 0 on success or non-fatal error.  If a non-zero error message is
+ * returned, then a fatal error has occurred that should not be recovered from.
+ * Any additional information on the socket is suspect.
+ *
+ * \param inst          The instance on which the dispatch occurs.
+ * \param sock          The socket on which the request was received and the
+ *                      response is to be written.
+ * \param req           The request to be decoded and dispatched.
+ * \param size          The size of the request.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_GENERAL_OUT_OF_MEMORY if an out-of-memory condition was
+ *        encountered in this operation.
+ *      - AGENTD_ERROR_DATASERVICE_IPC_WRITE_DATA_FAILURE if data could not be
+ *        written to the client socket.
+ */
+int dataservice_decode_and_dispatch_artifact_transaction_list_get(
+    dataservice_instance_t* inst, ipc_socket_context_t* sock, void* req,
+    size_t size);
+
+/**
+ * \brief Decode and dispatch a transaction batch update request.
+ *
+ * Returns 0 on success or non-fatal error.  If a non-zero error message is
+ * returned, then a fatal error has occurred that should not be recovered from.
+ * Any additional information on the socket is suspect.
+ *
+ * \param inst          The instance on which the dispatch occurs.
+ * \param sock          The socket on which the request was received and the
+ *                      response is to be written.
+ * \param req           The request to be decoded and dispatched.
+ * \param size          The size of the request.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_GENERAL_OUT_OF_MEMORY if an out-of-memory condition was
+ *        encountered in this operation.
+ *      - AGENTD_ERROR_DATASERVICE_IPC_WRITE_DATA_FAILURE if data could not be
+ *        written to the client socket.
+ */
+int dataservice_decode_and_dispatch_transaction_batch_update(
+    dataservice_instance_t* inst, ipc_socket_context_t* sock, void* req,
+    size_t size);
+
+/**
+ * \brief Decode and dispatch an id exists request.
+ *
+ * Returns 0 on success or non-fatal error.  If a non-zero error message is
+ * returned, then a fatal error has occurred that should not be recovered from.
+ * Any additional information on the socket is suspect.
+ *
+ * \param inst          The instance on which the dispatch occurs.
+ * \param sock          The socket on which the request was received and the
+ *                      response is to be written.
+ * \param req           The request to be decoded and dispatched.
+ * \param size          The size of the request.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_GENERAL_OUT_OF_MEMORY if an out-of-memory condition was
+ *        encountered in this operation.
+ *      - AGENTD_ERROR_DATASERVICE_IPC_WRITE_DATA_FAILURE if data could not be
+ *        written to the client socket.
+ */
+int dataservice_decode_and_dispatch_id_exists(
+    dataservice_instance_t* inst, ipc_socket_context_t* sock, void* req,
+    size_t size);
+
+/**
+ * \brief Append a transaction to an artifact's history in the artifact
+ * transaction index.
+ *
+ * Transactions must be appended in the order in which they are canonized.
+ * The transaction is indexed after any transaction already indexed for this
+ * artifact at the same block height.
+ *
+ * \param artifact_txn_db   The artifact transaction index database.
+ * \param txn               The transaction under which updates are done.
+ * \param artifact_id       The artifact id for this transaction.
+ * \param height            The height of the block holding this transaction.
+ * \param transaction_id    The transaction id to index.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_DATASERVICE_MDB_GET_FAILURE if this function failed to
+ *        read from the database.
+ *      - AGENTD_ERROR_DATASERVICE_MDB_PUT_FAILURE if this function failed to
+ *        update the database.
+ */
+int dataservice_artifact_transaction_index_put(
+    MDB_dbi artifact_txn_db, MDB_txn* txn, const uint8_t* artifact_id,
+    uint64_t height, const uint8_t* transaction_id);
+
+/**
+ * \brief Build the artifact transaction index from the artifact and
+ * transaction databases.
+ *
+ * This is done once, when a database created before the index existed is
+ * opened.  Each artifact's history is walked from its first transaction.
+ *
+ * \param details           The database details.
+ * \param txn               The write transaction under which the index is
+ *                          built.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_DATASERVICE_MDB_GET_FAILURE if this function failed to
+ *        read from the database.
+ *      - AGENTD_ERROR_DATASERVICE_MDB_PUT_FAILURE if this function failed to
+ *        update the database.
+ *      - AGENTD_ERROR_DATASERVICE_INVALID_STORED_TRANSACTION_NODE if a stored
+ *        transaction node was invalid.
+ *      - AGENTD_ERROR_DATASERVICE_INVALID_STORED_BLOCK_NODE if a stored block
+ *        node was invalid.
+ */
+int dataservice_artifact_transaction_index_rebuild(
+    dataservice_database_details_t* details, MDB_txn* txn);
+
+/**
+ * \brief Create a new, empty id filter layer and append it to the id filter.
+ *
+ * \param filter            The id filter to update.
+ * \param capacity          The number of ids that the new layer should hold.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_GENERAL_OUT_OF_MEMORY if the layer could not be
+ *        allocated, or if the filter already has the maximum number of layers.
+ */
+int dataservice_id_filter_layer_create(
+    dataservice_id_filter_t* filter, size_t capacity);
+
+/**
+ * \brief Hash an id for the id filter.
+ *
+ * \param id                The 16 byte id to hash.
+ *
+ * \returns the 64-bit hash of this id.
+ */
+uint64_t dataservice_id_filter_hash(const uint8_t* id);
+
+/**
+ * \brief Add an id to the id filter.
+ *
+ * If the last layer is full, a larger layer is added.  If that fails, the id
+ * is added to the full layer anyway, which raises the false positive rate but
+ * never hides an id.
+ *
+ * \param filter            The id filter to update.
+ * \param id                The 16 byte id to add.
+ */
+void dataservice_id_filter_add(
+    dataservice_id_filter_t* filter, const uint8_t* id);
+
+/**
+ * \brief Check whether an id may be in the id filter.
+ *
+ * \param filter            The id filter to check.
+ * \param id                The 16 byte id to check.
+ *
+ * \returns false if this id was never added to the filter, or true if it may
+ * have been added.
+ */
+bool dataservice_id_filter_may_contain(
+    const dataservice_id_filter_t* filter, const uint8_t* id);
+
+/**
+ * \brief Release the layers of an id filter, leaving it empty.
+ *
+ * \param filter            The id filter to release.
+ */
+void dataservice_id_filter_release(dataservice_id_filter_t* filter);
+
+/**
+ * \brief Build the id filter from the block, transaction, and artifact
+ * databases.
+ *
+ * This is done each time the database is opened, and when the filter is ahead
+ * of the database.  If there isn't enough memory for the filter, it is left
+ * empty, and every id lookup goes to the database.
+ *
+ * \param details           The database details.
+ * \param txn               The transaction under which the databases are read.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_DATASERVICE_MDB_GET_FAILURE if this function failed to
+ *        read from the database.
+ *      - AGENTD_ERROR_DATASERVICE_INVALID_STORED_BLOCK_NODE if the stored end
+ *        node is invalid.
+ */
+int dataservice_id_filter_rebuild(
+    dataservice_database_details_t* details, MDB_txn* txn);
+
+/**
+ * \brief Get the height of the block chain as seen by a transaction.
+ *
+ * \param details           The database details.
+ * \param txn               The transaction under which the database is read.
+ * \param height            Set to the height of the latest block, or zero if
+ *                          there are no blocks.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_DATASERVICE_MDB_GET_FAILURE if this function failed to
+ *        read from the database.
+ *      - AGENTD_ERROR_DATASERVICE_INVALID_STORED_BLOCK_NODE if the stored end
+ *        node is invalid.
+ */
+int dataservice_id_filter_chain_height(
+    dataservice_database_details_t* details, MDB_txn* txn, uint64_t* height);
+
+/**
+ * \brief Bring the id filter up to the block height seen by a transaction.
+ *
+ * Blocks written by another dataservice process since the filter was last
+ * synced are read back and their ids are added.  If the filter is ahead of the
+ * database, because a block it saw was rolled back, it is rebuilt.
+ *
+ * \param details           The database details.
+ * \param txn               The transaction under which the database is read.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS if the filter covers every id visible to this
+ *        transaction, so that a miss can be trusted.
+ *      - a non-zero error code if the filter could not be synced, in which case
+ *        a miss must be checked against the database.
+ */
+int dataservice_id_filter_sync(
+    dataservice_database_details_t* details, MDB_txn* txn);
+
+/**
+ * \brief Begin a transaction under an optional parent transaction.
+ *
+ * LMDB does not support nested transactions when the environment is opened
+ * with MDB_WRITEMAP.  In this case, the parent transaction itself is returned,
+ * and the operation runs directly in it.  The caller must not commit or abort
+ * a returned parent.  If the operation fails after writing, the write stays in
+ * the parent, which the owner of the parent must then abort.
+ *
+ * \param details           The database details.
+ * \param parent            The parent transaction, or NULL for none.
+ * \param flags             The flags for a transaction without a parent.
+ * \param txn               Pointer to receive the transaction, which is
+ *                          \p parent if nesting is not available.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_DATASERVICE_MDB_TXN_BEGIN_FAILURE if the transaction
+ *        could not begin.
+ */
+int dataservice_nested_txn_begin(
+    dataservice_database_details_t* details, MDB_txn* parent,
+    unsigned int flags, MDB_txn** txn);
+
+/**
+ * \brief Check whether an id is in use as a block, transaction, or artifact id.
+ *
+ * This is the internal version of the function, which does not perform any
+ * capabilities checking.  As such, it SHOULD NOT BE USED OUTSIDE OF THE DATA
+ * SERVICE.
+ *
+ * \param details           The database details.
+ * \param txn               The transaction under which the databases are read.
+ * \param id                The 16 byte id to check.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS if the id is in use.
+ *      - AGENTD_ERROR_DATASERVICE_NOT_FOUND if the id is not in use.
+ *      - AGENTD_ERROR_DATASERVICE_MDB_GET_FAILURE if this function failed to
+ *        read from the database.
+ */
+int dataservice_id_exists_internal(
+    dataservice_database_details_t* details, MDB_txn* txn, const uint8_t* id);
+
 /**
  * \brief Decode and dispatch a block make request.
  *
@@ -652,6 +1232,61 @@ int dataservice_decode_and_dispatch_block_id_latest_read(
     dataservice_instance_t* inst, ipc_socket_context_t* sock, void* req,
     size_t size);
 
+/**
+ * \brief Read only the block node for a given block ID.
+ *
+ * The caller is responsible for checking the capabilities of the child
+ * context before calling this function.
+ *
+ * \param child         The child context for this operation.
+ * \param dtxn_ctx      The dataservice transaction context for this operation,
+ *                      or NULL.
+ * \param block_id      The block ID to query.
+ * \param node          The block node to populate.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_DATASERVICE_NOT_FOUND if the block was not found.
+ *      - AGENTD_ERROR_DATASERVICE_MDB_TXN_BEGIN_FAILURE if this function failed
+ *        to begin a transaction.
+ *      - AGENTD_ERROR_DATASERVICE_MDB_GET_FAILURE if this function failed to
+ *        read data from the database.
+ *      - AGENTD_ERROR_DATASERVICE_INVALID_STORED_BLOCK_NODE if the block node
+ *        read from the database could not be deserialized.
+ */
+int dataservice_block_node_read(
+    dataservice_child_context_t* child,
+    dataservice_transaction_context_t* dtxn_ctx, const uint8_t* block_id,
+    data_block_node_t* node);
+
+/**
+ * \brief Decode and dispatch a block id link read request.
+ *
+ * This handles the block id next, block id prev, and block id with
+ * transaction read requests, which share a request and response format.
+ *
+ * Returns 0 on success or non-fatal error.  If a non-zero error message is
+ * returned, then a fatal error has occurred that should not be recovered from.
+ * Any additional information on the socket is suspect.
+ *
+ * \param inst          The instance on which the dispatch occurs.
+ * \param sock          The socket on which the request was received and the
+ *                      response is to be written.
+ * \param method        The API method of this request.
+ * \param req           The request to be decoded and dispatched.
+ * \param size          The size of the request.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_GENERAL_OUT_OF_MEMORY if an out-of-memory condition was
+ *        encountered in this operation.
+ *      - AGENTD_ERROR_DATASERVICE_IPC_WRITE_DATA_FAILURE if data could not be
+ *        written to the client socket.
+ */
+int dataservice_decode_and_dispatch_block_id_link_read(
+    dataservice_instance_t* inst, ipc_socket_context_t* sock, uint32_t method,
+    void* req, size_t size);
+
 /**
  * \brief Decode and dispatch a canonized transaction get data request.
  *
@@ -676,6 +1311,51 @@ int dataservice_decode_and_dispatch_canonized_transaction_get(
     dataservice_instance_t* inst, ipc_socket_context_t* sock, void* req,
     size_t size);
 
+/**
+ * \brief Decode a transaction submission request and apply it to the given
+ * submit batch.
+ *
+ * The status of the submission is recorded in the batch; no response is
+ * written until the batch is flushed.  A submission that fails is still
+ * recorded, so that its status is reported when the batch is flushed.
+ *
+ * \param inst          The instance on which the dispatch occurs.
+ * \param batch         The submit batch to which this request is added.
+ * \param req           The request to be decoded and dispatched.
+ * \param size          The size of the request.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS if the submission was recorded in the batch.
+ *      - AGENTD_ERROR_DATASERVICE_INVALID_PARAMETER if the batch has no room
+ *        for another submission.
+ */
+int dataservice_submit_batch_add(
+    dataservice_instance_t* inst, dataservice_submit_batch_t* batch, void* req,
+    size_t size);
+
+/**
+ * \brief Commit the write transaction of a submit batch and write the status
+ * of each submission to the caller.
+ *
+ * If the commit fails, every submission that succeeded under the batch is
+ * reported as failed.  The batch is empty on return.  Flushing an empty batch
+ * does nothing.
+ *
+ * \param inst          The instance on which the dispatch occurs.
+ * \param sock          The socket on which the responses are written.
+ * \param batch         The submit batch to flush.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_GENERAL_OUT_OF_MEMORY if an out-of-memory condition was
+ *        encountered in this operation.
+ *      - AGENTD_ERROR_DATASERVICE_IPC_WRITE_DATA_FAILURE if data could not be
+ *        written to the client socket.
+ */
+int dataservice_submit_batch_flush(
+    dataservice_instance_t* inst, ipc_socket_context_t* sock,
+    dataservice_submit_batch_t* batch);
+
 /**
  * \brief Read callback for the data service protocol socket.
  *
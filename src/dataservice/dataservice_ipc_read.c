@@ -7,9 +7,11 @@
  */
 
 #include <agentd/dataservice/private/dataservice.h>
+#include <agentd/inet.h>
 #include <agentd/ipc.h>
 #include <agentd/status_codes.h>
 #include <cbmc/model_assert.h>
+#include <string.h>
 #include <vpr/parameters.h>
 
 #include "dataservice_internal.h"
@@ -30,7 +32,9 @@ void dataservice_ipc_read(
     ssize_t retval = 0;
     void* req;
     uint32_t size = 0;
+    uint32_t method;
     dataservice_instance_t* instance = (dataservice_instance_t*)user_context;
+    dataservice_submit_batch_t batch;
 
     /* parameter sanity check. */
     MODEL_ASSERT(NULL != ctx);
@@ -41,24 +45,64 @@ void dataservice_ipc_read(
     if (instance->dataservice_force_exit)
         return;
 
+    /* transaction submissions drained in this read share one commit. */
+    memset(&batch, 0, sizeof(batch));
+
     /* loop until the read buffer is empty. */
     do {
         /* attempt to read a request. */
-        retval = ipc_read_data_noblock(ctx, &req, &size);
+        retval = ipc_read_data_view_noblock(ctx, &req, &size);
         switch (retval)
         {
             /* on success, decode and dispatch. */
             case 0:
-                if (AGENTD_STATUS_SUCCESS !=
-                        dataservice_decode_and_dispatch(
-                            instance, ctx, req, size))
+                /* peek at the method of this request. */
+                method = 0U;
+                if (size >= sizeof(method))
+                {
+                    memcpy(&method, req, sizeof(method));
+                    method = ntohl(method);
+                }
+
+                /* add transaction submissions to the pending batch. */
+                if (DATASERVICE_API_METHOD_APP_PQ_TRANSACTION_SUBMIT == method
+                 && !instance->submit_batch_disabled)
+                {
+                    /* a full batch is flushed before this submission joins. */
+                    if (DATASERVICE_MAX_SUBMIT_BATCH == batch.count
+                     && AGENTD_STATUS_SUCCESS !=
+                            dataservice_submit_batch_flush(
+                                instance, ctx, &batch))
+                    {
+                        dataservice_exit_event_loop(instance);
+                    }
+                    /* only dispatch into the batch if that flush worked. */
+                    else if (AGENTD_STATUS_SUCCESS !=
+                                dataservice_submit_batch_add(
+                                    instance, &batch,
+                                    (uint8_t*)req + sizeof(method),
+                                    size - sizeof(method)))
+                    {
+                        dataservice_exit_event_loop(instance);
+                    }
+                }
+                /* flush pending submissions first so that responses stay in
+                 * order and this request sees the submitted transactions. */
+                else if (AGENTD_STATUS_SUCCESS !=
+                            dataservice_submit_batch_flush(
+                                instance, ctx, &batch)
+                      || AGENTD_STATUS_SUCCESS !=
+                            dataservice_decode_and_dispatch(
+                                instance, ctx, req, size))
                 {
                     dataservice_exit_event_loop(instance);
                 }
 
-                /* clear and free the request data. */
-                memset(req, 0, size);
-                free(req);
+                /* return the request view to the read buffer. */
+                if (AGENTD_STATUS_SUCCESS != ipc_read_data_view_release(ctx))
+                {
+                    dataservice_exit_event_loop(instance);
+                }
                 break;
 
             /* Wait for more data on the socket. */
@@ -72,8 +116,16 @@ void dataservice_ipc_read(
                 break;
         }
     } while (AGENTD_STATUS_SUCCESS == retval
+             && !instance->dataservice_force_exit
              && ipc_socket_readbuffer_size(ctx) > 0);
 
+    /* commit and respond to any pending transaction submissions. */
+    if (AGENTD_STATUS_SUCCESS !=
+            dataservice_submit_batch_flush(instance, ctx, &batch))
+    {
+        dataservice_exit_event_loop(instance);
+    }
+
     /* fire up the write callback if there is data to write. */
     if (ipc_socket_writebuffer_size(ctx) > 0)
     {
@@ -0,0 +1,71 @@
+/**
+ * \file dataservice/dataservice_nested_txn_begin.c
+ *
+ * \brief Begin a transaction under an optional parent transaction.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/status_codes.h>
+#include <cbmc/model_assert.h>
+
+#include "dataservice_internal.h"
+
+/**
+ * \brief Begin a transaction under an optional parent transaction.
+ *
+ * LMDB does not support nested transactions when the environment is opened
+ * with MDB_WRITEMAP.  In this case, the parent transaction itself is returned,
+ * and the operation runs directly in it.  The caller must not commit or abort
+ * a returned parent.  If the operation fails after writing, the write stays in
+ * the parent, which the owner of the parent must then abort.
+ *
+ * \param details           The database details.
+ * \param parent            The parent transaction, or NULL for none.
+ * \param flags             The flags for a transaction without a parent.
+ * \param txn               Pointer to receive the transaction, which is
+ *                          \p parent if nesting is not available.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_DATASERVICE_MDB_TXN_BEGIN_FAILURE if the transaction
+ *        could not begin.
+ */
+int dataservice_nested_txn_begin(
+    dataservice_database_details_t* details, MDB_txn* parent,
+    unsigned int flags, MDB_txn** txn)
+{
+    unsigned int env_flags = 0U;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != details);
+    MODEL_ASSERT(NULL != txn);
+
+    /* nested transactions are not available under MDB_WRITEMAP. */
+    if (NULL != parent)
+    {
+        if (0 != mdb_env_get_flags(details->env, &env_flags))
+        {
+            *txn = NULL;
+            return AGENTD_ERROR_DATASERVICE_MDB_TXN_BEGIN_FAILURE;
+        }
+
+        if (env_flags & MDB_WRITEMAP)
+        {
+            *txn = parent;
+            return AGENTD_STATUS_SUCCESS;
+        }
+
+        /* a child transaction takes its state from the parent. */
+        flags = 0U;
+    }
+
+    /* begin the transaction. */
+    if (0 != mdb_txn_begin(details->env, parent, flags, txn))
+    {
+        *txn = NULL;
+        return AGENTD_ERROR_DATASERVICE_MDB_TXN_BEGIN_FAILURE;
+    }
+
+    return AGENTD_STATUS_SUCCESS;
+}
@@ -38,6 +38,8 @@ typedef struct dataservice_request_payload_root_context_init
 {
     dataservice_request_header_t hdr;
     uint64_t max_database_size;
+    uint32_t datastore_flags;
+    uint32_t max_readers;
     allocator_options_t* alloc_opts;
     char* datadir;
     size_t datadir_size;
@@ -78,6 +80,19 @@ typedef struct dataservice_request_block_id_latest_read
     dataservice_request_header_t hdr;
 } dataservice_request_block_id_latest_read_t;
 
+/**
+ * \brief Block ID Link Read Request structure.
+ *
+ * This request is shared by the block id next, block id prev, and block id
+ * with transaction read methods.  The id is a block ID for the first two and a
+ * transaction ID for the last.
+ */
+typedef struct dataservice_request_block_id_link_read
+{
+    dataservice_request_header_t hdr;
+    uint8_t id[16];
+} dataservice_request_block_id_link_read_t;
+
 /**
  * \brief Block Make Request structure.
  */
@@ -173,6 +188,61 @@ typedef struct dataservice_request_transaction_get
     uint8_t txn_id[16];
 } dataservice_request_transaction_get_t;
 
+/**
+ * \brief Transaction List Get Request structure.
+ */
+typedef struct dataservice_request_transaction_list_get
+{
+    dataservice_request_header_t hdr;
+    uint8_t txn_id[16];
+    uint32_t max_count;
+} dataservice_request_transaction_list_get_t;
+
+/**
+ * \brief Block Range Get Request structure.
+ */
+typedef struct dataservice_request_block_range_get
+{
+    dataservice_request_header_t hdr;
+    uint64_t start_height;
+    uint32_t max_count;
+    uint32_t max_bytes;
+} dataservice_request_block_range_get_t;
+
+/**
+ * \brief Artifact Transaction List Get Request structure.
+ */
+typedef struct dataservice_request_artifact_transaction_list_get
+{
+    dataservice_request_header_t hdr;
+    uint8_t artifact_id[16];
+    uint64_t start_height;
+    uint32_t start_index;
+    uint32_t max_count;
+} dataservice_request_artifact_transaction_list_get_t;
+
+/**
+ * \brief Transaction Batch Update Request structure.
+ *
+ * The entries member points into the request payload, and holds count encoded
+ * entries.
+ */
+typedef struct dataservice_request_transaction_batch_update
+{
+    dataservice_request_header_t hdr;
+    size_t count;
+    const uint8_t* entries;
+} dataservice_request_transaction_batch_update_t;
+
+/**
+ * \brief ID Exists Request structure.
+ */
+typedef struct dataservice_request_id_exists
+{
+    dataservice_request_header_t hdr;
+    uint8_t id[16];
+} dataservice_request_id_exists_t;
+
 /**
  * \brief Transaction Get First Request structure.
  */
@@ -387,6 +457,43 @@ int dataservice_decode_request_block_id_latest_read(
 int dataservice_encode_response_block_id_latest_read(
     void** payload, size_t* payload_size, const uint8_t* block_id);
 
+/**
+ * \brief Decode a block id link read request.
+ *
+ * \param req           The request payload to parse.
+ * \param size          The size of this request payload.
+ * \param dreq          The request structure into which this request is
+ *                      decoded.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_DATASERVICE_REQUEST_PACKET_INVALID_SIZE if the request
+ *        packet payload size is incorrect.
+ */
+int dataservice_decode_request_block_id_link_read(
+    const void* req, size_t size,
+    dataservice_request_block_id_link_read_t* dreq);
+
+/**
+ * \brief Encode a block id link read response payload packet.
+ *
+ * \param payload           Pointer to receive the allocated packet payload.
+ * \param payload_size      Pointer to receive the size of the payload.
+ * \param block_id          Pointer to the block UUID.
+ *
+ * On successful completion of this function, the payload pointer is updated
+ * with a buffer containing the payload packet, and the payload_size pointer is
+ * updated with the size of this payload packet.  The caller owns the payload
+ * packet and must clear and free it when it is no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_GENERAL_OUT_OF_MEMORY if an out-of-memory condition was
+ *        encountered during this operation.
+ */
+int dataservice_encode_response_block_id_link_read(
+    void** payload, size_t* payload_size, const uint8_t* block_id);
+
 /**
  * \brief Decode a make block request.
  *
@@ -636,6 +743,90 @@ int dataservice_decode_request_transaction_promote(
 int dataservice_decode_request_transaction_get(
     const void* req, size_t size, dataservice_request_transaction_get_t* dreq);
 
+/**
+ * \brief Decode a transaction list get request.
+ *
+ * \param req           The request payload to parse.
+ * \param size          The size of this request payload.
+ * \param dreq          The request structure into which this request is
+ *                      decoded.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_DATASERVICE_REQUEST_PACKET_INVALID_SIZE if the request
+ *        packet payload size is incorrect.
+ */
+int dataservice_decode_request_transaction_list_get(
+    const void* req, size_t size,
+    dataservice_request_transaction_list_get_t* dreq);
+
+/**
+ * \brief Decode a block range get request.
+ *
+ * \param req           The request payload to parse.
+ * \param size          The size of this request payload.
+ * \param dreq          The request structure into which this request is
+ *                      decoded.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_DATASERVICE_REQUEST_PACKET_INVALID_SIZE if the request
+ *        packet payload size is incorrect.
+ */
+int dataservice_decode_request_block_range_get(
+    const void* req, size_t size,
+    dataservice_request_block_range_get_t* dreq);
+
+/**
+ * \brief Decode an artifact transaction list get request.
+ *
+ * \param req           The request payload to parse.
+ * \param size          The size of this request payload.
+ * \param dreq          The request structure into which this request is
+ *                      decoded.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_DATASERVICE_REQUEST_PACKET_INVALID_SIZE if the request
+ *        packet payload size is incorrect.
+ */
+int dataservice_decode_request_artifact_transaction_list_get(
+    const void* req, size_t size,
+    dataservice_request_artifact_transaction_list_get_t* dreq);
+
+/**
+ * \brief Decode a transaction batch update request.
+ *
+ * \param req           The request payload to parse.
+ * \param size          The size of this request payload.
+ * \param dreq          The request structure into which this request is
+ *                      decoded.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_DATASERVICE_REQUEST_PACKET_INVALID_SIZE if the request
+ *        packet payload size is incorrect.
+ */
+int dataservice_decode_request_transaction_batch_update(
+    const void* req, size_t size,
+    dataservice_request_transaction_batch_update_t* dreq);
+
+/**
+ * \brief Decode an id exists request.
+ *
+ * \param req           The request payload to parse.
+ * \param size          The size of this request payload.
+ * \param dreq          The request structure into which this request is
+ *                      decoded.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_DATASERVICE_REQUEST_PACKET_INVALID_SIZE if the request
+ *        packet payload size is incorrect.
+ */
+int dataservice_decode_request_id_exists(
+    const void* req, size_t size, dataservice_request_id_exists_t* dreq);
+
 /**
  * \brief Encode a transaction get response payload packet.
  *
@@ -22,18 +22,27 @@ static void dataservice_root_context_dispose(void* disposable);
  *
  * \param ctx               The private data service context to initialize.
  * \param max_database_size The max database size for this data service.
+ * \param datastore_flags   The DATASTORE_FLAG_* tuning flags for the database.
+ * \param max_readers       The size of the database reader table, or 0 for
+ *                          the default.
  * \param datadir           The data directory for this private data service.
  *
  * \returns a status code indicating success or failure.
  *      - AGENTD_STATUS_SUCCESS on success.
  *      - AGENTD_ERROR_DATASERVICE_NOT_AUTHORIZED if the root context is not
  *        authorized to perform this action.
+ *      - AGENTD_ERROR_DATASERVICE_VCCRYPT_SUITE_OPTIONS_INIT_FAILURE if this
+ *        function failed to initialize crypto suite options.
+ *      - AGENTD_ERROR_DATASERVICE_VCCERT_PARSER_OPTIONS_INIT_FAILURE if this
+ *        function failed to initialize parser options.
  *      - AGENTD_ERROR_DATASERVICE_MDB_ENV_CREATE_FAILURE if this function
  *        failed to create a database environment.
  *      - AGENTD_ERROR_DATASERVICE_MDB_ENV_SET_MAPSIZE_FAILURE if this function
  *        failed to set the database map size.
  *      - AGENTD_ERROR_DATASERVICE_MDB_ENV_SET_MAXDBS_FAILURE if this function
  *        failed to set the maximum number of databases.
+ *      - AGENTD_ERROR_DATASERVICE_MDB_ENV_SET_MAXREADERS_FAILURE if this
+ *        function failed to set the maximum number of readers.
  *      - AGENTD_ERROR_DATASERVICE_MDB_ENV_OPEN_FAILURE if this function failed
  *        to open the database environment.
  *      - AGENTD_ERROR_DATASERVICE_MDB_TXN_BEGIN_FAILURE if this function failed
@@ -45,7 +54,7 @@ static void dataservice_root_context_dispose(void* disposable);
  */
 int dataservice_root_context_init(
     dataservice_root_context_t* ctx, uint64_t max_database_size,
-    const char* datadir)
+    uint32_t datastore_flags, uint32_t max_readers, const char* datadir)
 {
     /* parameter sanity check. */
     MODEL_ASSERT(NULL != ctx);
@@ -68,7 +77,9 @@ int dataservice_root_context_init(
     ctx->hdr.dispose = &dataservice_root_context_dispose;
 
     /* attempt to open the database and forward status to the caller. */
-    return dataservice_database_open(ctx, max_database_size, datadir);
+    return
+        dataservice_database_open(
+            ctx, max_database_size, datastore_flags, max_readers, datadir);
 }
 
 /**
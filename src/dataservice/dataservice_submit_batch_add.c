@@ -0,0 +1,117 @@
+/**
+ * \file dataservice/dataservice_submit_batch_add.c
+ *
+ * \brief Decode transaction submit request and apply it to a submit batch.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/dataservice/private/dataservice.h>
+#include <agentd/inet.h>
+#include <agentd/ipc.h>
+#include <agentd/status_codes.h>
+#include <cbmc/model_assert.h>
+#include <unistd.h>
+#include <vpr/parameters.h>
+
+#include "dataservice_internal.h"
+#include "dataservice_protocol_internal.h"
+
+/**
+ * \brief Decode a transaction submission request and apply it to the given
+ * submit batch.
+ *
+ * The status of the submission is recorded in the batch; no response is
+ * written until the batch is flushed.  A submission that fails is still
+ * recorded, so that its status is reported when the batch is flushed.
+ *
+ * \param inst          The instance on which the dispatch occurs.
+ * \param batch         The submit batch to which this request is added.
+ * \param req           The request to be decoded and dispatched.
+ * \param size          The size of the request.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS if the submission was recorded in the batch.
+ *      - AGENTD_ERROR_DATASERVICE_INVALID_PARAMETER if the batch has no room
+ *        for another submission.
+ */
+int dataservice_submit_batch_add(
+    dataservice_instance_t* inst, dataservice_submit_batch_t* batch, void* req,
+    size_t size)
+{
+    int retval = 0;
+    uint32_t offset = 0U;
+    bool dispose_dreq = false;
+
+    /* parameter sanity check. */
+    MODEL_ASSERT(NULL != inst);
+    MODEL_ASSERT(NULL != batch);
+    MODEL_ASSERT(NULL != req);
+
+    /* the caller must flush a full batch first. */
+    if (batch->count >= DATASERVICE_MAX_SUBMIT_BATCH)
+    {
+        return AGENTD_ERROR_DATASERVICE_INVALID_PARAMETER;
+    }
+
+    /* transaction submit request structure. */
+    dataservice_request_transaction_submit_t dreq;
+
+    /* parse the request. */
+    retval = dataservice_decode_request_transaction_submit(req, size, &dreq);
+    if (AGENTD_STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* be sure to clean up dreq. */
+    dispose_dreq = true;
+    offset = dreq.hdr.child_index;
+
+    /* the certificate size should be greater than zero. */
+    MODEL_ASSERT(dreq.cert_size > 0);
+
+    /* look up the child context. */
+    dataservice_child_context_t* ctx = NULL;
+    retval = dataservice_child_context_lookup(&ctx, inst, dreq.hdr.child_index);
+    if (AGENTD_STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* open the shared write transaction for this batch if needed. */
+    if (!batch->txn_open)
+    {
+        retval = dataservice_data_txn_begin(ctx, &batch->txn, NULL, false);
+        if (AGENTD_STATUS_SUCCESS != retval)
+        {
+            goto done;
+        }
+
+        batch->txn_open = true;
+    }
+
+    /* call the transaction submit method under the batch transaction.  The
+     * submission runs in its own nested transaction, so a failure here only
+     * discards this submission. */
+    retval =
+        dataservice_transaction_submit(
+            ctx, &batch->txn, dreq.txn_id, dreq.artifact_id, dreq.cert,
+            dreq.cert_size);
+
+    /* success. Fall through. */
+
+done:
+    /* record the status for this submission. */
+    batch->offset[batch->count] = offset;
+    batch->status[batch->count] = (uint32_t)retval;
+    ++batch->count;
+
+    /* clean up dreq. */
+    if (dispose_dreq)
+    {
+        dispose((disposable_t*)&dreq);
+    }
+
+    return AGENTD_STATUS_SUCCESS;
+}
@@ -0,0 +1,84 @@
+/**
+ * \file dataservice/dataservice_submit_batch_flush.c
+ *
+ * \brief Commit a submit batch and write its responses.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/dataservice/private/dataservice.h>
+#include <agentd/inet.h>
+#include <agentd/ipc.h>
+#include <agentd/status_codes.h>
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "dataservice_internal.h"
+
+/**
+ * \brief Commit the write transaction of a submit batch and write the status
+ * of each submission to the caller.
+ *
+ * If the commit fails, every submission that succeeded under the batch is
+ * reported as failed.  The batch is empty on return.  Flushing an empty batch
+ * does nothing.
+ *
+ * \param inst          The instance on which the dispatch occurs.
+ * \param sock          The socket on which the responses are written.
+ * \param batch         The submit batch to flush.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_GENERAL_OUT_OF_MEMORY if an out-of-memory condition was
+ *        encountered in this operation.
+ *      - AGENTD_ERROR_DATASERVICE_IPC_WRITE_DATA_FAILURE if data could not be
+ *        written to the client socket.
+ */
+int dataservice_submit_batch_flush(
+    dataservice_instance_t* UNUSED(inst), ipc_socket_context_t* sock,
+    dataservice_submit_batch_t* batch)
+{
+    int retval = AGENTD_STATUS_SUCCESS;
+    bool commit_failed = false;
+
+    /* parameter sanity check. */
+    MODEL_ASSERT(NULL != inst);
+    MODEL_ASSERT(NULL != sock);
+    MODEL_ASSERT(NULL != batch);
+
+    /* commit every submission in this batch at once. */
+    if (batch->txn_open)
+    {
+        if (0 != mdb_txn_commit(batch->txn.txn))
+        {
+            commit_failed = true;
+        }
+    }
+
+    /* write the status of each submission to the caller, in order. */
+    for (size_t i = 0; i < batch->count; ++i)
+    {
+        uint32_t status = batch->status[i];
+
+        /* a failed commit discards every submission in the batch. */
+        if (commit_failed && AGENTD_STATUS_SUCCESS == status)
+        {
+            status = AGENTD_ERROR_DATASERVICE_MDB_TXN_COMMIT_FAILURE;
+        }
+
+        retval =
+            dataservice_decode_and_dispatch_write_status(
+                sock, DATASERVICE_API_METHOD_APP_PQ_TRANSACTION_SUBMIT,
+                batch->offset[i], status, NULL, 0);
+        if (AGENTD_STATUS_SUCCESS != retval)
+        {
+            break;
+        }
+    }
+
+    /* reset the batch. */
+    memset(batch, 0, sizeof(dataservice_submit_batch_t));
+
+    return retval;
+}
@@ -0,0 +1,271 @@
+/**
+ * \file dataservice/dataservice_transaction_batch_update.c
+ *
+ * \brief Promote or drop a batch of transactions in the queue.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/dataservice/private/dataservice.h>
+#include <agentd/status_codes.h>
+#include <cbmc/model_assert.h>
+#include <unistd.h>
+#include <vpr/parameters.h>
+
+#include "dataservice_internal.h"
+
+/* forward decls. */
+static int dataservice_transaction_batch_update_entry_validate(
+    dataservice_database_details_t* details, MDB_txn* txn,
+    const uint8_t* txn_id);
+static int dataservice_transaction_batch_update_entry_apply(
+    dataservice_child_context_t* child,
+    dataservice_transaction_context_t* dtxn_ctx,
+    const data_transaction_batch_update_entry_t* entry);
+
+/**
+ * \brief Promote or drop a batch of transactions in the queue.
+ *
+ * Every entry is applied under a single write transaction, which is committed
+ * once for the whole batch.  Each entry runs in its own nested transaction, so
+ * an entry that fails leaves the rest of the batch intact; the outcome of each
+ * entry is written to the matching element of the statuses array.
+ *
+ * LMDB does not support nested transactions when the environment is opened
+ * with MDB_WRITEMAP.  In this case, each entry is first validated against the
+ * queue, and only valid entries are applied directly to the batch
+ * transaction.  If applying a valid entry fails, the whole batch is aborted.
+ *
+ * \param ctx           The child context for this operation.
+ * \param entries       The array of entries to apply.
+ * \param count         The number of entries in the array.
+ * \param statuses      The array, of count elements, which receives the status
+ *                      of each entry.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_DATASERVICE_NOT_AUTHORIZED if this child context is not
+ *        authorized to apply one of the actions in this batch.
+ *      - AGENTD_ERROR_DATASERVICE_REQUEST_PACKET_BAD if an entry holds an
+ *        unknown action.
+ *      - AGENTD_ERROR_DATASERVICE_MDB_TXN_BEGIN_FAILURE if this function could
+ *        not create a transaction.
+ *      - a non-zero error code if a valid entry could not be applied when
+ *        nested transactions are unavailable.
+ *      - AGENTD_ERROR_DATASERVICE_MDB_TXN_COMMIT_FAILURE if this function could
+ *        not commit the batch.
+ */
+int dataservice_transaction_batch_update(
+    dataservice_child_context_t* child,
+    const data_transaction_batch_update_entry_t* entries, size_t count,
+    uint32_t* statuses)
+{
+    int retval = 0;
+    unsigned int env_flags = 0U;
+    dataservice_transaction_context_t batch_txn;
+    dataservice_transaction_context_t entry_txn;
+
+    /* parameter sanity check. */
+    MODEL_ASSERT(NULL != child);
+    MODEL_ASSERT(NULL != child->root);
+    MODEL_ASSERT(NULL != entries || 0U == count);
+    MODEL_ASSERT(NULL != statuses || 0U == count);
+
+    /* verify that every action in this batch is known and allowed before
+     * touching the database. */
+    for (size_t i = 0; i < count; ++i)
+    {
+        switch (entries[i].action)
+        {
+            case DATASERVICE_TRANSACTION_BATCH_ACTION_PROMOTE:
+                if (!BITCAP_ISSET(child->childcaps,
+                        DATASERVICE_API_CAP_APP_PQ_TRANSACTION_PROMOTE))
+                {
+                    return AGENTD_ERROR_DATASERVICE_NOT_AUTHORIZED;
+                }
+                break;
+
+            case DATASERVICE_TRANSACTION_BATCH_ACTION_DROP:
+                if (!BITCAP_ISSET(child->childcaps,
+                        DATASERVICE_API_CAP_APP_PQ_TRANSACTION_DROP))
+                {
+                    return AGENTD_ERROR_DATASERVICE_NOT_AUTHORIZED;
+                }
+                break;
+
+            default:
+                return AGENTD_ERROR_DATASERVICE_REQUEST_PACKET_BAD;
+        }
+    }
+
+    /* get the details for this database connection. */
+    dataservice_database_details_t* details =
+        (dataservice_database_details_t*)child->root->details;
+
+    /* nested transactions are not available under MDB_WRITEMAP. */
+    if (0 != mdb_env_get_flags(details->env, &env_flags))
+    {
+        return AGENTD_ERROR_DATASERVICE_MDB_TXN_BEGIN_FAILURE;
+    }
+
+    /* begin the write transaction shared by every entry in this batch. */
+    retval = dataservice_data_txn_begin(child, &batch_txn, NULL, false);
+    if (AGENTD_STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (env_flags & MDB_WRITEMAP)
+        {
+            /* skip entries that would fail, so that a failure applying an
+             * entry below is a database error. */
+            statuses[i] =
+                dataservice_transaction_batch_update_entry_validate(
+                    details, batch_txn.txn, entries[i].txn_id);
+            if (AGENTD_STATUS_SUCCESS != statuses[i])
+            {
+                continue;
+            }
+
+            /* apply this entry directly to the batch transaction. */
+            statuses[i] =
+                dataservice_transaction_batch_update_entry_apply(
+                    child, &batch_txn, &entries[i]);
+            if (AGENTD_STATUS_SUCCESS != statuses[i])
+            {
+                retval = (int)statuses[i];
+                goto abort_batch_txn;
+            }
+        }
+        else
+        {
+            /* apply this entry under its own nested transaction. */
+            retval =
+                dataservice_data_txn_begin(
+                    child, &entry_txn, &batch_txn, false);
+            if (AGENTD_STATUS_SUCCESS != retval)
+            {
+                goto abort_batch_txn;
+            }
+
+            statuses[i] =
+                dataservice_transaction_batch_update_entry_apply(
+                    child, &entry_txn, &entries[i]);
+
+            /* keep the changes for this entry only if it succeeded. */
+            if (AGENTD_STATUS_SUCCESS == statuses[i])
+            {
+                dataservice_data_txn_commit(&entry_txn);
+            }
+            else
+            {
+                dataservice_data_txn_abort(&entry_txn);
+            }
+        }
+    }
+
+    /* commit every entry in this batch at once. */
+    if (0 != mdb_txn_commit(batch_txn.txn))
+    {
+        retval = AGENTD_ERROR_DATASERVICE_MDB_TXN_COMMIT_FAILURE;
+        goto done;
+    }
+
+    /* success. */
+    retval = AGENTD_STATUS_SUCCESS;
+    goto done;
+
+abort_batch_txn:
+    dataservice_data_txn_abort(&batch_txn);
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Verify that a batch entry refers to a transaction in the queue.
+ *
+ * \param details       The details for this database connection.
+ * \param txn           The batch transaction.
+ * \param txn_id        The transaction ID for this entry.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS if this entry can be applied.
+ *      - AGENTD_ERROR_DATASERVICE_NOT_FOUND if the transaction uuid could not
+ *        be found.
+ *      - AGENTD_ERROR_DATASERVICE_MDB_GET_FAILURE if this function failed to
+ *        read from the database.
+ */
+static int dataservice_transaction_batch_update_entry_validate(
+    dataservice_database_details_t* details, MDB_txn* txn,
+    const uint8_t* txn_id)
+{
+    int retval;
+    uint8_t key[16];
+
+    /* the begin and end transactions are never found. */
+    memset(key, 0, sizeof(key));
+    if (0 == memcmp(txn_id, key, sizeof(key)))
+    {
+        return AGENTD_ERROR_DATASERVICE_NOT_FOUND;
+    }
+
+    memset(key, 0xff, sizeof(key));
+    if (0 == memcmp(txn_id, key, sizeof(key)))
+    {
+        return AGENTD_ERROR_DATASERVICE_NOT_FOUND;
+    }
+
+    /* query the transaction queue. */
+    MDB_val lkey;
+    lkey.mv_size = 16;
+    lkey.mv_data = (uint8_t*)txn_id;
+    MDB_val lval;
+    memset(&lval, 0, sizeof(lval));
+    retval = mdb_get(txn, details->pq_db, &lkey, &lval);
+    if (MDB_NOTFOUND == retval
+     || lval.mv_size < sizeof(data_transaction_node_t))
+    {
+        return AGENTD_ERROR_DATASERVICE_NOT_FOUND;
+    }
+    else if (0 != retval)
+    {
+        return AGENTD_ERROR_DATASERVICE_MDB_GET_FAILURE;
+    }
+
+    return AGENTD_STATUS_SUCCESS;
+}
+
+/**
+ * \brief Apply a single batch entry under the given transaction.
+ *
+ * \param child         The child context for this operation.
+ * \param dtxn_ctx      The transaction under which this entry is applied.
+ * \param entry         The entry to apply.
+ *
+ * \returns the status of the promote or drop operation.
+ */
+static int dataservice_transaction_batch_update_entry_apply(
+    dataservice_child_context_t* child,
+    dataservice_transaction_context_t* dtxn_ctx,
+    const data_transaction_batch_update_entry_t* entry)
+{
+    /* the transaction context must be valid, or the internal functions would
+     * begin a second write transaction. */
+    MODEL_ASSERT(NULL != dtxn_ctx->txn);
+
+    if (DATASERVICE_TRANSACTION_BATCH_ACTION_PROMOTE == entry->action)
+    {
+        return
+            dataservice_transaction_promote_internal(
+                child, dtxn_ctx, entry->txn_id);
+    }
+    else
+    {
+        return
+            dataservice_transaction_drop_internal(
+                child, dtxn_ctx, entry->txn_id);
+    }
+}
@@ -76,16 +76,23 @@ int dataservice_transaction_get_first(
 
     /* set the parent transaction. */
     MDB_txn* parent = (NULL != dtxn_ctx) ? dtxn_ctx->txn : NULL;
-    int parent_flags = (NULL != parent) ? 0 : MDB_RDONLY;
 
     /* create the read transaction for the root transaction node. */
-    if (0 != mdb_txn_begin(details->env, parent, parent_flags, &txn))
+    retval = dataservice_nested_txn_begin(details, parent, MDB_RDONLY, &txn);
+    if (AGENTD_STATUS_SUCCESS != retval)
     {
-        retval = AGENTD_ERROR_DATASERVICE_MDB_TXN_BEGIN_FAILURE;
-        txn = NULL;
         goto done;
     }
 
+    /* a parent returned in place of a nested transaction is not ours. */
+    if (txn == parent)
+    {
+        txn = NULL;
+    }
+
+    /* set the transaction for the root transaction node query. */
+    MDB_txn* root_txn = (NULL != txn) ? txn : parent;
+
     /* set up the key and val. */
     uint8_t key[16];
     memset(key, 0, sizeof(key));
@@ -96,7 +103,7 @@ int dataservice_transaction_get_first(
     memset(&lval, 0, sizeof(lval));
 
     /* attempt to read the start of the queue from the database. */
-    retval = mdb_get(txn, details->pq_db, &lkey, &lval);
+    retval = mdb_get(root_txn, details->pq_db, &lkey, &lval);
     if (MDB_NOTFOUND == retval)
     {
         /* the value was not found. */
@@ -135,8 +142,11 @@ int dataservice_transaction_get_first(
     memcpy(key, first_node->next, sizeof(key));
 
     /* stop the transaction (free memory) */
-    mdb_txn_abort(txn);
-    txn = NULL;
+    if (NULL != txn)
+    {
+        mdb_txn_abort(txn);
+        txn = NULL;
+    }
 
     /* if the parent transaction is NULL, begin a transaction, or else use the
      * parent transaction. */
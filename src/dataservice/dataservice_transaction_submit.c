@@ -40,6 +40,8 @@ static int dataservice_transaction_submit_update_end(
  *            not authorized to perform this operation.
  *          - AGENTD_ERROR_DATASERVICE_MDB_TXN_BEGIN_FAILURE if this function
  *            could not begin a database transaction to insert this transaction.
+ *          - AGENTD_ERROR_DATASERVICE_DUPLICATE_TRANSACTION_ID if this
+ *            transaction id is already in use by a canonized transaction.
  *          - AGENTD_ERROR_DATASERVICE_INVALID_STORED_TRANSACTION_NODE if this
  *            function encountered an invalid transaction node in the
  *            transaction queue.
@@ -82,13 +84,33 @@ int dataservice_transaction_submit(
     MDB_txn* parent = (NULL != dtxn_ctx) ? dtxn_ctx->txn : NULL;
 
     /* create the transaction for the end transaction node. */
-    if (0 != mdb_txn_begin(details->env, parent, 0, &txn))
+    retval = dataservice_nested_txn_begin(details, parent, 0, &txn);
+    if (AGENTD_STATUS_SUCCESS != retval)
     {
-        retval = AGENTD_ERROR_DATASERVICE_MDB_TXN_BEGIN_FAILURE;
-        txn = NULL;
         goto done;
     }
 
+    /* reject a transaction id that has already been canonized.  Once the id
+     * filter has caught up with the blocks written by the canonization
+     * service, it answers for most new ids without reading the database. */
+    if (AGENTD_STATUS_SUCCESS != dataservice_id_filter_sync(details, txn)
+     || dataservice_id_filter_may_contain(&details->id_filter, txn_id))
+    {
+        MDB_val lid = { 16, (void*)txn_id };
+        MDB_val lcanonized = { 0, NULL };
+        retval = mdb_get(txn, details->txn_db, &lid, &lcanonized);
+        if (0 == retval)
+        {
+            retval = AGENTD_ERROR_DATASERVICE_DUPLICATE_TRANSACTION_ID;
+            goto maybe_transaction_abort;
+        }
+        else if (MDB_NOTFOUND != retval)
+        {
+            retval = AGENTD_ERROR_DATASERVICE_MDB_GET_FAILURE;
+            goto maybe_transaction_abort;
+        }
+    }
+
     /* set up the key and val. */
     uint8_t key[16];
     memset(key, 0xFF, sizeof(key));
@@ -204,8 +226,12 @@ int dataservice_transaction_submit(
         }
     }
 
-    /* commit the transaction. */
-    mdb_txn_commit(txn);
+    /* commit the transaction, unless it is the parent. */
+    if (txn != parent)
+    {
+        mdb_txn_commit(txn);
+    }
+
     txn = NULL;
 
     /* success. */
@@ -218,7 +244,7 @@ cleanup_newnode:
     free(newnode);
 
 maybe_transaction_abort:
-    if (NULL != txn)
+    if (NULL != txn && txn != parent)
     {
         mdb_txn_abort(txn);
     }
@@ -0,0 +1,118 @@
+/**
+ * \file ipc/ipc_authed_session_get.c
+ *
+ * \brief Get or create the authenticated session for a non-blocking socket.
+ *
+ * \copyright 2021 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/status_codes.h>
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vccrypt/compare.h>
+#include <vpr/parameters.h>
+
+#include "ipc_internal.h"
+
+/**
+ * \brief Get the authenticated session for a non-blocking socket.
+ *
+ * The session is created on first use.  If the suite or shared secret differs
+ * from the one the session was keyed with, the session is re-keyed.
+ *
+ * \param impl          The socket implementation owning the session.
+ * \param suite         The crypto suite to use for this session.
+ * \param secret        The shared secret between the peer and host.
+ * \param session       Pointer to receive the session on success.
+ *
+ * \returns A status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_GENERAL_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error condition while executing.
+ *      - AGENTD_ERROR_IPC_CRYPTO_FAILURE if the stream cipher could not be
+ *        keyed.
+ */
+int ipc_authed_session_get(
+    ipc_socket_impl_t* impl, vccrypt_suite_options_t* suite,
+    const vccrypt_buffer_t* secret, ipc_authed_session_t** session)
+{
+    int retval;
+    ipc_authed_session_t* tmp;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != impl);
+    MODEL_ASSERT(NULL != suite);
+    MODEL_ASSERT(NULL != secret);
+    MODEL_ASSERT(NULL != session);
+
+    /* reuse the existing session if it was keyed with this secret. */
+    tmp = impl->authed_session;
+    if (NULL != tmp && tmp->suite == suite
+     && tmp->secret.size == secret->size
+     && 0 == crypto_memcmp(tmp->secret.data, secret->data, secret->size))
+    {
+        *session = tmp;
+        return AGENTD_STATUS_SUCCESS;
+    }
+
+    /* the secret changed; drop the old session. */
+    ipc_authed_session_release(impl);
+
+    /* allocate a new session. */
+    tmp = (ipc_authed_session_t*)malloc(sizeof(ipc_authed_session_t));
+    if (NULL == tmp)
+    {
+        retval = AGENTD_ERROR_GENERAL_OUT_OF_MEMORY;
+        goto done;
+    }
+
+    /* clear the session. */
+    memset(tmp, 0, sizeof(ipc_authed_session_t));
+    tmp->suite = suite;
+
+    /* keep a copy of the secret so a re-key can be detected. */
+    if (VCCRYPT_STATUS_SUCCESS !=
+        vccrypt_buffer_init(&tmp->secret, suite->alloc_opts, secret->size))
+    {
+        retval = AGENTD_ERROR_GENERAL_OUT_OF_MEMORY;
+        goto free_session;
+    }
+
+    memcpy(tmp->secret.data, secret->data, secret->size);
+
+    /* key the stream cipher once for this session. */
+    if (VCCRYPT_STATUS_SUCCESS !=
+        vccrypt_suite_stream_init(suite, &tmp->stream, secret))
+    {
+        retval = AGENTD_ERROR_IPC_CRYPTO_FAILURE;
+        goto cleanup_secret;
+    }
+
+    /* create a digest buffer to be reused by every packet. */
+    if (VCCRYPT_STATUS_SUCCESS !=
+        vccrypt_buffer_init(
+            &tmp->digest, suite->alloc_opts, suite->mac_short_opts.mac_size))
+    {
+        retval = AGENTD_ERROR_GENERAL_OUT_OF_MEMORY;
+        goto cleanup_stream;
+    }
+
+    /* success. */
+    impl->authed_session = tmp;
+    *session = tmp;
+    retval = AGENTD_STATUS_SUCCESS;
+    goto done;
+
+cleanup_stream:
+    dispose((disposable_t*)&tmp->stream);
+
+cleanup_secret:
+    dispose((disposable_t*)&tmp->secret);
+
+free_session:
+    memset(tmp, 0, sizeof(ipc_authed_session_t));
+    free(tmp);
+
+done:
+    return retval;
+}
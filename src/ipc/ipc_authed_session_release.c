@@ -0,0 +1,41 @@
+/**
+ * \file ipc/ipc_authed_session_release.c
+ *
+ * \brief Release the authenticated session for a non-blocking socket.
+ *
+ * \copyright 2021 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "ipc_internal.h"
+
+/**
+ * \brief Release the authenticated session for a non-blocking socket, if any.
+ *
+ * \param impl          The socket implementation owning the session.
+ */
+void ipc_authed_session_release(ipc_socket_impl_t* impl)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != impl);
+
+    ipc_authed_session_t* session = impl->authed_session;
+    if (NULL == session)
+    {
+        return;
+    }
+
+    /* dispose the keyed state; buffer disposal clears key material. */
+    dispose((disposable_t*)&session->digest);
+    dispose((disposable_t*)&session->stream);
+    dispose((disposable_t*)&session->secret);
+
+    /* clear and free the session. */
+    memset(session, 0, sizeof(ipc_authed_session_t));
+    free(session);
+
+    impl->authed_session = NULL;
+}
@@ -11,7 +11,9 @@
 
 #include <agentd/ipc.h>
 #include <event.h>
+#include <stdbool.h>
 #include <stdint.h>
+#include <vccrypt/suite.h>
 #include <vpr/disposable.h>
 
 /* make this header C++ friendly. */
@@ -19,6 +21,20 @@
 extern "C" {
 #endif  //__cplusplus
 
+/**
+ * \brief Authenticated session state for a non-blocking socket.
+ *
+ * The stream cipher is keyed once per suite and shared secret, and is only
+ * re-IVed for each packet.  The digest buffer is reused across packets.
+ */
+typedef struct ipc_authed_session
+{
+    vccrypt_suite_options_t* suite;
+    vccrypt_buffer_t secret;
+    vccrypt_stream_context_t stream;
+    vccrypt_buffer_t digest;
+} ipc_authed_session_t;
+
 /**
  * \brief Internal context for non-blocking sockets.
  */
@@ -28,6 +44,9 @@ typedef struct ipc_socket_impl
     struct event* write_ev;
     struct evbuffer* readbuf;
     struct evbuffer* writebuf;
+    ipc_authed_session_t* authed_session;
+    size_t view_size;
+    bool secure_zero;
 } ipc_socket_impl_t;
 
 /**
@@ -66,6 +85,35 @@ typedef struct ipc_event_loop_impl
 void ipc_event_loop_cb(
     evutil_socket_t UNUSED(fd), short what, void* ctx);
 
+/**
+ * \brief Get the authenticated session for a non-blocking socket.
+ *
+ * The session is created on first use.  If the suite or shared secret differs
+ * from the one the session was keyed with, the session is re-keyed.
+ *
+ * \param impl          The socket implementation owning the session.
+ * \param suite         The crypto suite to use for this session.
+ * \param secret        The shared secret between the peer and host.
+ * \param session       Pointer to receive the session on success.
+ *
+ * \returns A status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_GENERAL_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error condition while executing.
+ *      - AGENTD_ERROR_IPC_CRYPTO_FAILURE if the stream cipher could not be
+ *        keyed.
+ */
+int ipc_authed_session_get(
+    ipc_socket_impl_t* impl, vccrypt_suite_options_t* suite,
+    const vccrypt_buffer_t* secret, ipc_authed_session_t** session);
+
+/**
+ * \brief Release the authenticated session for a non-blocking socket, if any.
+ *
+ * \param impl          The socket implementation owning the session.
+ */
+void ipc_authed_session_release(ipc_socket_impl_t* impl);
+
 /* make this header C++ friendly. */
 #ifdef __cplusplus
 }
@@ -145,6 +145,9 @@ static void ipc_socket_context_dispose(void* disposable)
         evbuffer_free(impl->writebuf);
     }
 
+    /* release the authenticated session, if one was established. */
+    ipc_authed_session_release(impl);
+
     /* close the socket. */
     close(ctx->fd);
 
@@ -0,0 +1,76 @@
+/**
+ * \file ipc/ipc_queue_data_noblock.c
+ *
+ * \brief Queue a data packet value on a non-blocking socket without writing.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/ipc.h>
+#include <agentd/inet.h>
+#include <agentd/status_codes.h>
+#include <arpa/inet.h>
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <unistd.h>
+#include <vpr/parameters.h>
+
+#include "ipc_internal.h"
+
+/**
+ * \brief Queue a raw data packet on a non-blocking socket.
+ *
+ * The packet queued is identical to one written by \ref
+ * ipc_write_data_noblock(), but no write is attempted.  The caller is
+ * responsible for flushing the write buffer, typically from its write
+ * callback.  This allows several packets to be flushed in a single vectored
+ * write.
+ *
+ * \param sock          The socket on which the value is queued.
+ * \param val           The raw data to queue.
+ * \param size          The size of the raw data to queue.
+ *
+ * \returns A status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_IPC_WRITE_BUFFER_TYPE_ADD_FAILURE if adding the type
+ *        data to the write buffer failed.
+ *      - AGENTD_ERROR_IPC_WRITE_BUFFER_SIZE_ADD_FAILURE if adding the size
+ *        data to the write buffer failed.
+ *      - AGENTD_ERROR_IPC_WRITE_BUFFER_PAYLOAD_ADD_FAILURE if adding the
+ *        payload data to the write buffer failed.
+ */
+int ipc_queue_data_noblock(
+    ipc_socket_context_t* sock, const void* val, uint32_t size)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != sock);
+    MODEL_ASSERT(NULL != sock->impl);
+    MODEL_ASSERT(NULL != ((ipc_socket_impl_t*)sock->impl)->writebuf);
+    MODEL_ASSERT(NULL != val);
+
+    /* get the socket details. */
+    ipc_socket_impl_t* sock_impl = (ipc_socket_impl_t*)sock->impl;
+
+    /* attempt to queue the type. */
+    uint32_t type = htonl(IPC_DATA_TYPE_DATA_PACKET);
+    if (0 != evbuffer_add(sock_impl->writebuf, &type, sizeof(type)))
+    {
+        return AGENTD_ERROR_IPC_WRITE_BUFFER_TYPE_ADD_FAILURE;
+    }
+
+    /* attempt to queue the size. */
+    uint32_t nsize = htonl(size);
+    if (0 != evbuffer_add(sock_impl->writebuf, &nsize, sizeof(nsize)))
+    {
+        return AGENTD_ERROR_IPC_WRITE_BUFFER_SIZE_ADD_FAILURE;
+    }
+
+    /* add the data to the buffer. */
+    if (0 != evbuffer_add(sock_impl->writebuf, val, size))
+    {
+        return AGENTD_ERROR_IPC_WRITE_BUFFER_PAYLOAD_ADD_FAILURE;
+    }
+
+    /* success. */
+    return AGENTD_STATUS_SUCCESS;
+}
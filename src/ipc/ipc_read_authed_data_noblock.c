@@ -60,8 +60,9 @@ int ipc_read_authed_data_noblock(
     int retval = 0;
     uint32_t type = 0U;
     uint32_t nsize = 0U;
-    uint8_t* dheader = NULL;
+    uint8_t dheader[sizeof(type) + sizeof(nsize)];
     uint8_t* header = NULL;
+    ipc_authed_session_t* session = NULL;
 
     /* parameter sanity checks. */
     MODEL_ASSERT(NULL != sock);
@@ -106,49 +107,37 @@ int ipc_read_authed_data_noblock(
         }
     }
 
-    /* attempt to allocate space for the decrypted header. */
-    size_t dheader_sz =
-        sizeof(type) + sizeof(nsize);
-    vccrypt_buffer_t dbuffer;
-    if (VCCRYPT_STATUS_SUCCESS !=
-        vccrypt_buffer_init(&dbuffer, suite->alloc_opts, dheader_sz))
-    {
-        retval = AGENTD_ERROR_GENERAL_OUT_OF_MEMORY;
-        goto done;
-    }
-
-    /* set up pointers for convenience. */
-    dheader = (uint8_t*)dbuffer.data;
+    /* the decrypted header is small enough to live on the stack. */
+    size_t dheader_sz = sizeof(dheader);
 
     /* get the encrypted header data. */
     header = (uint8_t*)evbuffer_pullup(sock_impl->readbuf, header_sz);
     if (NULL == header)
     {
         retval = AGENTD_ERROR_IPC_WOULD_BLOCK;
-        goto cleanup_dbuffer;
+        goto done;
     }
 
-    /* set up the stream cipher. */
-    vccrypt_stream_context_t stream;
-    if (VCCRYPT_STATUS_SUCCESS !=
-        vccrypt_suite_stream_init(suite, &stream, secret))
+    /* get the authenticated session, keying it if needed. */
+    retval = ipc_authed_session_get(sock_impl, suite, secret, &session);
+    if (AGENTD_STATUS_SUCCESS != retval)
     {
-        retval = AGENTD_ERROR_IPC_CRYPTO_FAILURE;
-        goto cleanup_dbuffer;
+        goto done;
     }
 
-    /* set up MAC. */
+    /* set up MAC; it has no reset, so it is still keyed per packet. */
     vccrypt_mac_context_t mac;
     if (VCCRYPT_STATUS_SUCCESS !=
         vccrypt_suite_mac_short_init(suite, &mac, secret))
     {
         retval = AGENTD_ERROR_IPC_CRYPTO_FAILURE;
-        goto cleanup_stream;
+        goto cleanup_dheader;
     }
 
-    /* start decryption of the stream. */
+    /* re-IV the session stream cipher for this packet. */
     if (VCCRYPT_STATUS_SUCCESS !=
-        vccrypt_stream_continue_decryption(&stream, &iv, sizeof(iv), 0))
+        vccrypt_stream_continue_decryption(
+            &session->stream, &iv, sizeof(iv), 0))
     {
         retval = AGENTD_ERROR_IPC_CRYPTO_FAILURE;
         goto cleanup_mac;
@@ -158,7 +147,7 @@ int ipc_read_authed_data_noblock(
     size_t offset = 0;
     if (VCCRYPT_STATUS_SUCCESS !=
         vccrypt_stream_decrypt(
-            &stream, header, dheader_sz, dbuffer.data, &offset))
+            &session->stream, header, dheader_sz, dheader, &offset))
     {
         retval = AGENTD_ERROR_IPC_CRYPTO_FAILURE;
         goto cleanup_mac;
@@ -226,33 +215,25 @@ int ipc_read_authed_data_noblock(
         goto cleanup_mac;
     }
 
-    /* create a buffer to hold the digest. */
-    /* TODO - there should be a suite method for this. */
-    vccrypt_buffer_t digest;
-    if (VCCRYPT_STATUS_SUCCESS !=
-        vccrypt_buffer_init(
-            &digest, suite->alloc_opts, suite->mac_short_opts.mac_size))
-    {
-        retval = AGENTD_ERROR_GENERAL_OUT_OF_MEMORY;
-        goto cleanup_mac;
-    }
+    /* the digest buffer is owned by the session. */
+    vccrypt_buffer_t* digest = &session->digest;
 
     /* finalize the mac. */
     if (VCCRYPT_STATUS_SUCCESS !=
-        vccrypt_mac_finalize(&mac, &digest))
+        vccrypt_mac_finalize(&mac, digest))
     {
         retval = AGENTD_ERROR_IPC_CRYPTO_FAILURE;
-        goto cleanup_digest;
+        goto cleanup_mac;
     }
 
     /* compare the digest against the mac in the packet. */
     if (0 !=
         crypto_memcmp(
-            digest.data, header + dheader_sz,
-            digest.size))
+            digest->data, header + dheader_sz,
+            digest->size))
     {
         retval = AGENTD_ERROR_IPC_UNAUTHORIZED_PACKET;
-        goto cleanup_digest;
+        goto cleanup_mac;
     }
 
     /* the payload has been authenticated.  create output buffer. */
@@ -260,13 +241,13 @@ int ipc_read_authed_data_noblock(
     if (NULL == *val)
     {
         retval = AGENTD_ERROR_GENERAL_OUT_OF_MEMORY;
-        goto cleanup_digest;
+        goto cleanup_mac;
     }
 
     /* continue decryption in the payload. */
     if (VCCRYPT_STATUS_SUCCESS !=
         vccrypt_stream_continue_decryption(
-            &stream, &iv, sizeof(iv), offset))
+            &session->stream, &iv, sizeof(iv), offset))
     {
         retval = AGENTD_ERROR_IPC_CRYPTO_FAILURE;
         goto cleanup_val;
@@ -278,7 +259,7 @@ int ipc_read_authed_data_noblock(
     /* decrypt the payload. */
     if (VCCRYPT_STATUS_SUCCESS !=
         vccrypt_stream_decrypt(
-            &stream, header + header_sz, *size, *val, &offset))
+            &session->stream, header + header_sz, *size, *val, &offset))
     {
         retval = AGENTD_ERROR_IPC_CRYPTO_FAILURE;
         goto cleanup_val;
@@ -293,24 +274,18 @@ int ipc_read_authed_data_noblock(
 
     /* success. */
     retval = AGENTD_STATUS_SUCCESS;
-    goto cleanup_digest;
+    goto cleanup_mac;
 
 cleanup_val:
     memset(*val, 0, *size);
     free(*val);
     *val = NULL;
 
-cleanup_digest:
-    dispose((disposable_t*)&digest);
-
 cleanup_mac:
     dispose((disposable_t*)&mac);
 
-cleanup_stream:
-    dispose((disposable_t*)&stream);
-
-cleanup_dbuffer:
-    dispose((disposable_t*)&dbuffer);
+cleanup_dheader:
+    memset(dheader, 0, sizeof(dheader));
 
 done:
     return retval;
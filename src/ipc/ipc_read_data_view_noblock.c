@@ -0,0 +1,144 @@
+/**
+ * \file ipc/ipc_read_data_view_noblock.c
+ *
+ * \brief Non-blocking read of a data packet as a view into the read buffer.
+ *
+ * \copyright 2021 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/ipc.h>
+#include <agentd/inet.h>
+#include <agentd/status_codes.h>
+#include <arpa/inet.h>
+#include <cbmc/model_assert.h>
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include <vpr/parameters.h>
+
+#include "ipc_internal.h"
+
+/**
+ * \brief Read a raw data packet from a non-blocking socket as a view into the
+ * socket's read buffer.
+ *
+ * On success, val points to the packet payload inside of the socket's read
+ * buffer.  No copy is made, and the caller does not own this memory.  The view
+ * remains valid until ipc_read_data_view_release() is called, or until the
+ * next read from this socket, which releases any outstanding view.
+ *
+ * \param sock          The socket from which the value is read.
+ * \param val           Pointer to the pointer to receive the payload view.
+ * \param size          Pointer to the variable to receive the size of this
+ *                      packet.
+ *
+ * \returns A status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_IPC_WOULD_BLOCK if the the operation was halted because
+ *        it would block this thread.
+ *      - AGENTD_ERROR_IPC_READ_UNEXPECTED_DATA_TYPE if an unexpected data type
+ *        was encountered when attempting to read this value.
+ *      - AGENTD_ERROR_IPC_READ_UNEXPECTED_DATA_SIZE if an unexpected data size
+ *        was encountered when attempting to read this value.
+ *      - AGENTD_ERROR_IPC_READ_BUFFER_DRAIN_FAILURE if draining a previous
+ *        view from the read buffer failed.
+ */
+int ipc_read_data_view_noblock(
+    ipc_socket_context_t* sock, void** val, uint32_t* size)
+{
+    ssize_t retval = 0;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != sock);
+    MODEL_ASSERT(NULL != sock->impl);
+    MODEL_ASSERT(NULL != ((ipc_socket_impl_t*)sock->impl)->readbuf);
+    MODEL_ASSERT(NULL != val);
+    MODEL_ASSERT(NULL != size);
+
+    /* get the socket details. */
+    ipc_socket_impl_t* sock_impl = (ipc_socket_impl_t*)sock->impl;
+
+    /* release any view still outstanding from a previous read. */
+    retval = ipc_read_data_view_release(sock);
+    if (AGENTD_STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* compute the header size. */
+    ssize_t header_sz = sizeof(uint32_t) + sizeof(uint32_t);
+
+    /* read data from the socket into our buffer. */
+    retval = evbuffer_read(sock_impl->readbuf, sock->fd, -1);
+    if (retval < 0 && (errno == EWOULDBLOCK || errno == EAGAIN))
+    {
+        retval = AGENTD_ERROR_IPC_WOULD_BLOCK;
+        /* fall through, since we might have enough data in the buffer. */
+    }
+    else if (retval < 0)
+    {
+        retval = AGENTD_ERROR_IPC_EVBUFFER_READ_FAILURE;
+        goto done;
+    }
+    else if (retval == 0)
+    {
+        retval = AGENTD_ERROR_IPC_EVBUFFER_EOF;
+        goto done;
+    }
+
+    /* we need the header data. */
+    uint8_t* mem = (uint8_t*)evbuffer_pullup(sock_impl->readbuf, header_sz);
+    if (NULL == mem)
+    {
+        retval = AGENTD_ERROR_IPC_WOULD_BLOCK;
+        goto done;
+    }
+
+    /* if the type does not match our expected type, return an error. */
+    uint32_t ntype;
+    memcpy(&ntype, mem, sizeof(ntype));
+    if (IPC_DATA_TYPE_DATA_PACKET != ntohl(ntype))
+    {
+        retval = AGENTD_ERROR_IPC_READ_UNEXPECTED_DATA_TYPE;
+        goto done;
+    }
+
+    /* decode the size of this packet. */
+    uint32_t nsize = 0;
+    memcpy(&nsize, mem + sizeof(ntype), sizeof(uint32_t));
+
+    /* sanity check on size. */
+    *size = ntohl(nsize);
+    if (*size <= 0 || *size >= 1024 * 1024 * 1024)
+    {
+        retval = AGENTD_ERROR_IPC_READ_UNEXPECTED_DATA_SIZE;
+        goto done;
+    }
+
+    /* if the buffer size is less than this size, wait for more data to be
+     * available. */
+    size_t packet_sz = *size + (size_t)header_sz;
+    if (evbuffer_get_length(sock_impl->readbuf) < packet_sz)
+    {
+        retval = AGENTD_ERROR_IPC_WOULD_BLOCK;
+        goto done;
+    }
+
+    /* make the whole packet contiguous in the read buffer. */
+    mem = (uint8_t*)evbuffer_pullup(sock_impl->readbuf, packet_sz);
+    if (NULL == mem)
+    {
+        retval = AGENTD_ERROR_IPC_WOULD_BLOCK;
+        goto done;
+    }
+
+    /* hand out a view of the payload; it is drained on release. */
+    *val = mem + header_sz;
+    sock_impl->view_size = packet_sz;
+
+    /* success. */
+    retval = AGENTD_STATUS_SUCCESS;
+
+done:
+    return retval;
+}
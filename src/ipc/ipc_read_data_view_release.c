@@ -0,0 +1,67 @@
+/**
+ * \file ipc/ipc_read_data_view_release.c
+ *
+ * \brief Release a packet view read from a non-blocking socket.
+ *
+ * \copyright 2021 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/ipc.h>
+#include <agentd/status_codes.h>
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "ipc_internal.h"
+
+/**
+ * \brief Release the packet view returned by ipc_read_data_view_noblock().
+ *
+ * The packet is drained from the socket's read buffer.  If secure zeroing is
+ * enabled for this socket, the packet is cleared before it is drained.  It is
+ * safe to call this method when no view is outstanding.
+ *
+ * \param sock          The socket owning the view.
+ *
+ * \returns A status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_IPC_READ_BUFFER_DRAIN_FAILURE if draining the read buffer
+ *        failed.
+ */
+int ipc_read_data_view_release(ipc_socket_context_t* sock)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != sock);
+    MODEL_ASSERT(NULL != sock->impl);
+
+    /* get the socket details. */
+    ipc_socket_impl_t* sock_impl = (ipc_socket_impl_t*)sock->impl;
+    size_t view_size = sock_impl->view_size;
+
+    /* nothing to do if there is no outstanding view. */
+    if (0 == view_size)
+    {
+        return AGENTD_STATUS_SUCCESS;
+    }
+
+    sock_impl->view_size = 0;
+
+    /* the view is still contiguous, so this pullup does not copy. */
+    if (sock_impl->secure_zero)
+    {
+        uint8_t* mem =
+            (uint8_t*)evbuffer_pullup(sock_impl->readbuf, view_size);
+        if (NULL != mem)
+        {
+            memset(mem, 0, view_size);
+        }
+    }
+
+    /* drain the packet from the read buffer. */
+    if (0 != evbuffer_drain(sock_impl->readbuf, view_size))
+    {
+        return AGENTD_ERROR_IPC_READ_BUFFER_DRAIN_FAILURE;
+    }
+
+    return AGENTD_STATUS_SUCCESS;
+}
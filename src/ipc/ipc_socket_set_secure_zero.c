@@ -0,0 +1,31 @@
+/**
+ * \file ipc/ipc_socket_set_secure_zero.c
+ *
+ * \brief Enable or disable secure zeroing of released packet views.
+ *
+ * \copyright 2021 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/ipc.h>
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "ipc_internal.h"
+
+/**
+ * \brief Enable or disable secure zeroing of released packet views.
+ *
+ * Secure zeroing is disabled by default.  Sockets carrying key material should
+ * enable it.
+ *
+ * \param sock          The non-blocking socket to configure.
+ * \param secure_zero   true if released views should be cleared.
+ */
+void ipc_socket_set_secure_zero(ipc_socket_context_t* sock, bool secure_zero)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != sock);
+    MODEL_ASSERT(NULL != sock->impl);
+
+    ((ipc_socket_impl_t*)sock->impl)->secure_zero = secure_zero;
+}
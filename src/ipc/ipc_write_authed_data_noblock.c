@@ -60,62 +60,54 @@ int ipc_write_authed_data_noblock(
     /* get the socket details. */
     ipc_socket_impl_t* sock_impl = (ipc_socket_impl_t*)sock->impl;
 
-    /* create a buffer for holding the digest. */
-    /* TODO - there should be a suite method for this. */
-    vccrypt_buffer_t digest;
-    if (VCCRYPT_STATUS_SUCCESS !=
-        vccrypt_buffer_init(
-            &digest, suite->alloc_opts, suite->mac_short_opts.mac_size))
+    /* get the authenticated session, keying it if needed. */
+    ipc_authed_session_t* session;
+    retval = ipc_authed_session_get(sock_impl, suite, secret, &session);
+    if (AGENTD_STATUS_SUCCESS != retval)
     {
-        retval = AGENTD_ERROR_GENERAL_OUT_OF_MEMORY;
         goto done;
     }
 
-    /* create a packet buffer large enough for this authed packet. */
-    size_t packet_size =
-        sizeof(type) + sizeof(nsize) + digest.size + size;
-    vccrypt_buffer_t packet;
-    if (VCCRYPT_STATUS_SUCCESS !=
-        vccrypt_buffer_init(&packet, suite->alloc_opts, packet_size))
-    {
-        retval = AGENTD_ERROR_GENERAL_OUT_OF_MEMORY;
-        goto cleanup_digest;
-    }
-
-    /* create a stream cipher for encrypting this packet. */
-    vccrypt_stream_context_t stream;
-    if (VCCRYPT_STATUS_SUCCESS !=
-        vccrypt_suite_stream_init(suite, &stream, secret))
-    {
-        retval = AGENTD_ERROR_IPC_CRYPTO_FAILURE;
-        goto cleanup_packet;
-    }
+    /* the digest buffer is owned by the session. */
+    vccrypt_buffer_t* digest = &session->digest;
 
     /* create a mac instance for building the packet authentication code. */
+    /* the mac has no reset, so it is still keyed per packet. */
     vccrypt_mac_context_t mac;
     if (VCCRYPT_STATUS_SUCCESS !=
         vccrypt_suite_mac_short_init(suite, &mac, secret))
     {
         retval = AGENTD_ERROR_IPC_CRYPTO_FAILURE;
-        goto cleanup_stream;
+        goto done;
     }
 
-    /* start the stream cipher. */
+    /* re-IV the session stream cipher for this packet. */
     if (VCCRYPT_STATUS_SUCCESS !=
-        vccrypt_stream_continue_encryption(&stream, &iv, sizeof(iv), 0))
+        vccrypt_stream_continue_encryption(
+            &session->stream, &iv, sizeof(iv), 0))
     {
         retval = AGENTD_ERROR_IPC_CRYPTO_FAILURE;
         goto cleanup_mac;
     }
 
-    /* treat the packet as a byte array for convenience. */
-    uint8_t* bpacket = (uint8_t*)packet.data;
+    /* reserve contiguous space for the packet in the output buffer. */
+    size_t packet_size =
+        sizeof(type) + sizeof(nsize) + digest->size + size;
+    struct evbuffer_iovec vec;
+    if (1 != evbuffer_reserve_space(sock_impl->writebuf, packet_size, &vec, 1))
+    {
+        retval = AGENTD_ERROR_IPC_WRITE_BUFFER_PAYLOAD_ADD_FAILURE;
+        goto cleanup_mac;
+    }
+
+    /* the packet is encrypted directly into the output buffer. */
+    uint8_t* bpacket = (uint8_t*)vec.iov_base;
     size_t offset = 0;
 
     /* encrypt the type. */
     if (VCCRYPT_STATUS_SUCCESS !=
         vccrypt_stream_encrypt(
-            &stream, &type, sizeof(type), bpacket, &offset))
+            &session->stream, &type, sizeof(type), bpacket, &offset))
     {
         retval = AGENTD_ERROR_IPC_CRYPTO_FAILURE;
         goto cleanup_mac;
@@ -124,7 +116,7 @@ int ipc_write_authed_data_noblock(
     /* encrypt the size. */
     if (VCCRYPT_STATUS_SUCCESS !=
         vccrypt_stream_encrypt(
-            &stream, &nsize, sizeof(nsize), bpacket, &offset))
+            &session->stream, &nsize, sizeof(nsize), bpacket, &offset))
     {
         retval = AGENTD_ERROR_IPC_CRYPTO_FAILURE;
         goto cleanup_mac;
@@ -133,7 +125,7 @@ int ipc_write_authed_data_noblock(
     /* encrypt the payload. */
     if (VCCRYPT_STATUS_SUCCESS !=
         vccrypt_stream_encrypt(
-            &stream, val, size, bpacket + digest.size, &offset))
+            &session->stream, val, size, bpacket + digest->size, &offset))
     {
         retval = AGENTD_ERROR_IPC_CRYPTO_FAILURE;
         goto cleanup_mac;
@@ -145,7 +137,7 @@ int ipc_write_authed_data_noblock(
                 &mac, bpacket, sizeof(type) + sizeof(nsize)) ||
         VCCRYPT_STATUS_SUCCESS !=
             vccrypt_mac_digest(
-                &mac, bpacket + sizeof(type) + sizeof(nsize) + digest.size,
+                &mac, bpacket + sizeof(type) + sizeof(nsize) + digest->size,
                 size))
     {
         retval = AGENTD_ERROR_IPC_CRYPTO_FAILURE;
@@ -153,17 +145,19 @@ int ipc_write_authed_data_noblock(
     }
 
     /* finalize the digest. */
-    if (VCCRYPT_STATUS_SUCCESS != vccrypt_mac_finalize(&mac, &digest))
+    if (VCCRYPT_STATUS_SUCCESS != vccrypt_mac_finalize(&mac, digest))
     {
         retval = AGENTD_ERROR_IPC_CRYPTO_FAILURE;
         goto cleanup_mac;
     }
 
     /* copy the digest to the packet. */
-    memcpy(bpacket + sizeof(type) + sizeof(nsize), digest.data, digest.size);
+    memcpy(
+        bpacket + sizeof(type) + sizeof(nsize), digest->data, digest->size);
 
-    /* attempt to write the packet to the output buffer. */
-    if (0 != evbuffer_add(sock_impl->writebuf, packet.data, packet.size))
+    /* commit the packet to the output buffer. */
+    vec.iov_len = packet_size;
+    if (0 != evbuffer_commit_space(sock_impl->writebuf, &vec, 1))
     {
         retval = AGENTD_ERROR_IPC_WRITE_BUFFER_PAYLOAD_ADD_FAILURE;
         goto cleanup_mac;
@@ -175,15 +169,6 @@ int ipc_write_authed_data_noblock(
 cleanup_mac:
     dispose((disposable_t*)&mac);
 
-cleanup_stream:
-    dispose((disposable_t*)&stream);
-
-cleanup_packet:
-    dispose((disposable_t*)&packet);
-
-cleanup_digest:
-    dispose((disposable_t*)&digest);
-
 done:
     return retval;
 }
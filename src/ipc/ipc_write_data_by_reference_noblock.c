@@ -0,0 +1,122 @@
+/**
+ * \file ipc/ipc_write_data_by_reference_noblock.c
+ *
+ * \brief Non-blocking write of a data packet value whose tail is appended to
+ * the write buffer by reference.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/ipc.h>
+#include <agentd/inet.h>
+#include <agentd/status_codes.h>
+#include <arpa/inet.h>
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <unistd.h>
+#include <vpr/parameters.h>
+
+#include "ipc_internal.h"
+
+/**
+ * \brief Write a raw data packet to a non-blocking socket, appending the tail
+ * of this packet to the write buffer by reference instead of by copy.
+ *
+ * The packet written is identical to one written by \ref
+ * ipc_write_data_noblock() with the concatenation of hdr and ref as its value.
+ * The hdr bytes are copied into the write buffer.  The ref bytes are not
+ * copied; they must remain valid until the release callback is called.
+ *
+ * The release callback is always called exactly once: either by the write
+ * buffer when the referenced bytes have been written or the socket has been
+ * disposed, or by this function before it returns if it fails.
+ *
+ * \param sock          The socket to which the value is written.
+ * \param hdr           The leading data to copy into the packet.
+ * \param hdr_size      The size of the leading data.
+ * \param ref           The trailing data to reference in the packet.
+ * \param ref_size      The size of the trailing data.
+ * \param release       The callback to release the trailing data.
+ * \param user_context  The user context passed to the release callback.
+ *
+ * \returns A status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_IPC_WRITE_BUFFER_TYPE_ADD_FAILURE if adding the type
+ *        data to the write buffer failed.
+ *      - AGENTD_ERROR_IPC_WRITE_BUFFER_SIZE_ADD_FAILURE if adding the size
+ *        data to the write buffer failed.
+ *      - AGENTD_ERROR_IPC_WRITE_BUFFER_PAYLOAD_ADD_FAILURE if adding the
+ *        payload data to the write buffer failed.
+ *      - AGENTD_ERROR_IPC_WRITE_NONBLOCK_FAILURE if a non-blocking write
+ *        failed.
+ */
+int ipc_write_data_by_reference_noblock(
+    ipc_socket_context_t* sock, const void* hdr, uint32_t hdr_size,
+    const void* ref, uint32_t ref_size, ipc_reference_release_cb_t release,
+    void* user_context)
+{
+    int retval;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != sock);
+    MODEL_ASSERT(NULL != sock->impl);
+    MODEL_ASSERT(NULL != ((ipc_socket_impl_t*)sock->impl)->writebuf);
+    MODEL_ASSERT(NULL != hdr);
+    MODEL_ASSERT(NULL != ref);
+    MODEL_ASSERT(NULL != release);
+
+    /* get the socket details. */
+    ipc_socket_impl_t* sock_impl = (ipc_socket_impl_t*)sock->impl;
+
+    /* attempt to write the type. */
+    uint32_t type = htonl(IPC_DATA_TYPE_DATA_PACKET);
+    if (0 != evbuffer_add(sock_impl->writebuf, &type, sizeof(type)))
+    {
+        retval = AGENTD_ERROR_IPC_WRITE_BUFFER_TYPE_ADD_FAILURE;
+        goto release_reference;
+    }
+
+    /* attempt to write the size of the full packet. */
+    uint32_t nsize = htonl(hdr_size + ref_size);
+    if (0 != evbuffer_add(sock_impl->writebuf, &nsize, sizeof(nsize)))
+    {
+        retval = AGENTD_ERROR_IPC_WRITE_BUFFER_SIZE_ADD_FAILURE;
+        goto release_reference;
+    }
+
+    /* copy the leading data to the buffer. */
+    if (0 != evbuffer_add(sock_impl->writebuf, hdr, hdr_size))
+    {
+        retval = AGENTD_ERROR_IPC_WRITE_BUFFER_PAYLOAD_ADD_FAILURE;
+        goto release_reference;
+    }
+
+    /* an empty reference has nothing to append. */
+    if (0U == ref_size)
+    {
+        release(ref, ref_size, user_context);
+    }
+    /* append the trailing data by reference. The buffer now owns it. */
+    else if (
+        0 != evbuffer_add_reference(
+                sock_impl->writebuf, ref, ref_size, release, user_context))
+    {
+        retval = AGENTD_ERROR_IPC_WRITE_BUFFER_PAYLOAD_ADD_FAILURE;
+        goto release_reference;
+    }
+
+    /* attempt to write the data. */
+    retval = ipc_socket_write_from_buffer(sock);
+    if (retval < 0)
+    {
+        return AGENTD_ERROR_IPC_WRITE_NONBLOCK_FAILURE;
+    }
+
+    /* success. */
+    return AGENTD_STATUS_SUCCESS;
+
+release_reference:
+    release(ref, ref_size, user_context);
+
+    return retval;
+}
@@ -37,11 +37,26 @@ status listenservice_accept_endpoint_context_release(RCPR_SYM(resource)* r)
     /* cache the allocator. */
     rcpr_allocator* alloc = ctx->alloc;
 
-    /* attempt to release the accept socket. */
-    if (NULL != ctx->accept_socket)
+    /* attempt to release each accept socket. */
+    for (size_t i = 0; i < ctx->accept_socket_count; ++i)
     {
-        accept_socket_release_retval =
-            resource_release(psock_resource_handle(ctx->accept_socket));
+        status release_retval =
+            resource_release(psock_resource_handle(ctx->accept_sockets[i]));
+        if (STATUS_SUCCESS != release_retval)
+        {
+            accept_socket_release_retval = release_retval;
+        }
+    }
+
+    /* release the accept socket array. */
+    if (NULL != ctx->accept_sockets)
+    {
+        status release_retval =
+            rcpr_allocator_reclaim(alloc, ctx->accept_sockets);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            accept_socket_release_retval = release_retval;
+        }
     }
 
     /* attempt to close the endpoint mailbox. */
@@ -21,7 +21,9 @@ RCPR_IMPORT_resource;
  * \param sched         The scheduler to which this endpoint fiber should be
  *                      assigned.
  * \param endpoint_addr Pointer to receive the endpoint's mailbox address.
- * \param acceptsock    The socket descriptor to send accepted sockets.
+ * \param acceptstart   The first socket descriptor to send accepted sockets.
+ * \param acceptcount   The number of consecutive accept socket descriptors,
+ *                      one for each protocol service instance.
  *
  * \returns a status code indicating success or failure.
  *      - STATUS_SUCCESS on success.
@@ -29,7 +31,8 @@ RCPR_IMPORT_resource;
  */
 status listenservice_accept_endpoint_fiber_add(
     RCPR_SYM(allocator)* alloc, RCPR_SYM(fiber_scheduler)* sched,
-    RCPR_SYM(mailbox_address)* endpoint_addr, int acceptsock)
+    RCPR_SYM(mailbox_address)* endpoint_addr, int acceptstart,
+    size_t acceptcount)
 {
     status retval, release_retval;
     listenservice_accept_endpoint_context* ctx = NULL;
@@ -39,7 +42,8 @@ status listenservice_accept_endpoint_fiber_add(
     /* parameter sanity checks. */
     MODEL_ASSERT(rcpr_prop_allocator_valid(alloc));
     MODEL_ASSERT(prop_fiber_scheduler_valid(sched));
-    MODEL_ASSERT(acceptsock >= 0);
+    MODEL_ASSERT(acceptstart >= 0);
+    MODEL_ASSERT(acceptcount > 0);
 
     /* allocate memory for the accept endpoint fiber context. */
     retval = rcpr_allocator_allocate(alloc, (void**)&ctx, sizeof(*ctx));
@@ -57,9 +61,24 @@ status listenservice_accept_endpoint_fiber_add(
     /* set the allocator and scheduler. */
     ctx->alloc = alloc;
     ctx->sched = sched;
-    ctx->accept_socket = NULL;
+    ctx->accept_sockets = NULL;
+    ctx->accept_socket_count = 0;
+    ctx->next_accept_socket = 0;
     ctx->endpoint_addr = (uint64_t)-1;
 
+    /* allocate memory for the accept socket array. */
+    retval =
+        rcpr_allocator_allocate(
+            alloc, (void**)&ctx->accept_sockets,
+            acceptcount * sizeof(psock*));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_context;
+    }
+
+    /* clear the accept socket array. */
+    memset(ctx->accept_sockets, 0, acceptcount * sizeof(psock*));
+
     /* look up the messaging discipline. */
     retval = message_discipline_get_or_create(&ctx->msgdisc, alloc, sched);
     if (STATUS_SUCCESS != retval)
@@ -100,24 +119,30 @@ status listenservice_accept_endpoint_fiber_add(
         goto cleanup_accept_endpoint;
     }
 
-    /* create the inner psock for the accept socket. */
-    retval = psock_create_from_descriptor(&inner, alloc, acceptsock);
-    if (STATUS_SUCCESS != retval)
+    /* wrap each accept socket for the endpoint fiber. */
+    for (size_t i = 0; i < acceptcount; ++i)
     {
-        goto cleanup_accept_endpoint;
-    }
+        /* create the inner psock for this accept socket. */
+        retval =
+            psock_create_from_descriptor(&inner, alloc, acceptstart + (int)i);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_accept_endpoint;
+        }
 
-    /* wrap this as an async psock. */
-    retval =
-        psock_create_wrap_async(
-            &ctx->accept_socket, alloc, accept_endpoint, inner);
-    if (STATUS_SUCCESS != retval)
-    {
-        goto cleanup_inner_psock;
-    }
+        /* wrap this as an async psock. */
+        retval =
+            psock_create_wrap_async(
+                &ctx->accept_sockets[i], alloc, accept_endpoint, inner);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_inner_psock;
+        }
 
-    /* the inner psock is now owned by the accept endpoint context. */
-    inner = NULL;
+        /* the inner psock is now owned by the accept endpoint context. */
+        inner = NULL;
+        ++ctx->accept_socket_count;
+    }
 
     /* add the accept endpoint to the scheduler. */
     retval = fiber_scheduler_add(sched, accept_endpoint);
@@ -19,7 +19,7 @@ RCPR_IMPORT_resource;
  * \brief Entry point for the accept endpoint fiber.
  *
  * This fiber receives sockets from each of the listen fibers and forwards these
- * to the protocol service.
+ * to the protocol service instances in turn.
  *
  * \param vctx          The type erased context.
  *
@@ -52,10 +52,16 @@ status listenservice_accept_endpoint_fiber_entry(void* vctx)
         payload =
             (listenservice_accept_message*)message_payload(recvmsg, false);
 
-        /* write the descriptor to the accept socket. */
-        retval = psock_write_raw_descriptor(ctx->accept_socket, payload->desc);
+        /* write the descriptor to the next protocol service instance. */
+        retval =
+            psock_write_raw_descriptor(
+                ctx->accept_sockets[ctx->next_accept_socket], payload->desc);
         /* TODO - log failure. */
 
+        /* round-robin to the next instance. */
+        ctx->next_accept_socket =
+            (ctx->next_accept_socket + 1) % ctx->accept_socket_count;
+
         /* clean up the message. */
         release_retval = resource_release(message_resource_handle(recvmsg));
         if (STATUS_SUCCESS != release_retval)
@@ -28,7 +28,10 @@ RCPR_IMPORT_thread;
  *
  * \param logsock       The logging service socket.  The listen service logs
  *                      on this socket.
- * \param acceptsock    The socket to which newly accepted sockets are sent.
+ * \param acceptstart   The first socket to which newly accepted sockets are
+ *                      sent.  The listen service iterates from this socket
+ *                      until it encounters a closed descriptor and sends each
+ *                      accepted socket to the next of these sockets in turn.
  * \param listenstart   The first socket to which this service will listen.  The
  *                      listen service will iterate from this socket until it
  *                      encounters a closed descriptor and use each as a listen
@@ -46,7 +49,7 @@ RCPR_IMPORT_thread;
  *            the listen service event loop failed.
  */
 int listenservice_event_loop(
-    int UNUSED(logsock), int acceptsock, int listenstart)
+    int UNUSED(logsock), int acceptstart, int listenstart)
 {
     int retval, release_retval;
     rcpr_allocator* alloc;
@@ -59,8 +62,12 @@ int listenservice_event_loop(
 
     /* parameter sanity checking. */
     MODEL_ASSERT(logsock >= 0);
+    MODEL_ASSERT(acceptstart >= 0);
     MODEL_ASSERT(listenstart >= 0);
 
+    /* count the number of accept sockets. */
+    int acceptsocket_count = inet_count_sockets(acceptstart);
+
     /* count the number of listen sockets. */
     int listensocket_count = inet_count_sockets(listenstart);
 
@@ -88,7 +95,8 @@ int listenservice_event_loop(
     /* create the accept endpoint fiber. */
     retval =
         listenservice_accept_endpoint_fiber_add(
-            alloc, sched, &endpoint_addr, acceptsock);
+            alloc, sched, &endpoint_addr, acceptstart,
+            (size_t)acceptsocket_count);
     if (STATUS_SUCCESS != retval)
     {
         goto cleanup_scheduler;
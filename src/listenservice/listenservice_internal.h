@@ -59,7 +59,9 @@ struct listenservice_accept_endpoint_context
 {
     RCPR_SYM(resource) hdr;
     RCPR_SYM(allocator)* alloc;
-    RCPR_SYM(psock)* accept_socket;
+    RCPR_SYM(psock)** accept_sockets;
+    size_t accept_socket_count;
+    size_t next_accept_socket;
     RCPR_SYM(fiber_scheduler)* sched;
     RCPR_SYM(fiber_scheduler_discipline)* msgdisc;
     RCPR_SYM(mailbox_address) endpoint_addr;
@@ -117,7 +119,9 @@ status listenservice_listen_fiber_add(
  * \param sched         The scheduler to which this endpoint fiber should be
  *                      assigned.
  * \param endpoint_addr Pointer to receive the endpoint's mailbox address.
- * \param acceptsock    The socket descriptor to send accepted sockets.
+ * \param acceptstart   The first socket descriptor to send accepted sockets.
+ * \param acceptcount   The number of consecutive accept socket descriptors,
+ *                      one for each protocol service instance.
  *
  * \returns a status code indicating success or failure.
  *      - STATUS_SUCCESS on success.
@@ -125,7 +129,8 @@ status listenservice_listen_fiber_add(
  */
 status listenservice_accept_endpoint_fiber_add(
     RCPR_SYM(allocator)* alloc, RCPR_SYM(fiber_scheduler)* sched,
-    RCPR_SYM(mailbox_address)* endpoint_addr, int acceptsock);
+    RCPR_SYM(mailbox_address)* endpoint_addr, int acceptstart,
+    size_t acceptcount);
 
 /**
  * \brief Entry point for the listen service fiber manager fiber.
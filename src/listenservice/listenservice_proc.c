@@ -20,9 +20,14 @@
 #include <unistd.h>
 #include <vpr/parameters.h>
 
+/* extra accept descriptors are parked here while the fixed descriptors are
+ * set. */
+#define AGENTD_FD_LISTENSERVICE_ACCEPT_HIGH 600
+
 /* forward decls */
 int listenservice_proc_open_listen_sockets(
-    const bootstrap_config_t* bconf, const agent_config_t* conf);
+    const bootstrap_config_t* bconf, const agent_config_t* conf,
+    size_t acceptcount);
 
 /**
  * \brief Spawn an unauthorized listen service process using the provided
@@ -36,7 +41,9 @@ int listenservice_proc_open_listen_sockets(
  *
  * \param bconf         The bootstrap configuration for this service.
  * \param conf          The configuration for this service.
- * \param acceptsock    Pointer to the socket used to pass accepted sockets.
+ * \param acceptsocks   Array of sockets used to pass accepted sockets, one for
+ *                      each protocol service instance.
+ * \param acceptcount   The number of sockets in acceptsocks.
  * \param logsock       Pointer to the socket used to communicate with the
  *                      logger.
  * \param listenpid     Pointer to the listen service pid, to be updated on
@@ -66,19 +73,28 @@ int listenservice_proc_open_listen_sockets(
  */
 int listenservice_proc(
     const bootstrap_config_t* bconf, const agent_config_t* conf,
-    int* acceptsock, int* logsock, pid_t* listenpid, bool runsecure)
+    int* acceptsocks, size_t acceptcount, int* logsock, pid_t* listenpid,
+    bool runsecure)
 {
     int retval = 1;
     uid_t uid;
     gid_t gid;
+    int extrasocks[PROTOCOL_INSTANCES_MAXIMUM];
 
     /* parameter sanity checks. */
     MODEL_ASSERT(NULL != bconf);
     MODEL_ASSERT(NULL != conf);
-    MODEL_ASSERT(NULL != acceptsock);
+    MODEL_ASSERT(NULL != acceptsocks);
     MODEL_ASSERT(NULL != logsock);
     MODEL_ASSERT(NULL != listenpid);
 
+    /* there must be at least one accept socket, and we can only map so many. */
+    if (0 == acceptcount || acceptcount > PROTOCOL_INSTANCES_MAXIMUM)
+    {
+        retval = AGENTD_ERROR_LISTENSERVICE_PRIVSEP_SETFDS_FAILURE;
+        goto done;
+    }
+
     /* verify that this process is running as root. */
     if (runsecure && 0 != geteuid())
     {
@@ -99,9 +115,27 @@ int listenservice_proc(
     /* child */
     if (0 == *listenpid)
     {
+        /* move the extra accept fds above the range used by protect
+         * descriptors. */
+        for (size_t i = 1; i < acceptcount; ++i)
+        {
+            extrasocks[i] =
+                fcntl(
+                    acceptsocks[i], F_DUPFD,
+                    AGENTD_FD_LISTENSERVICE_ACCEPT_HIGH + (int)i);
+            if (extrasocks[i] < 0)
+            {
+                perror("fcntl");
+                retval = AGENTD_ERROR_LISTENSERVICE_PRIVSEP_SETFDS_FAILURE;
+                goto done;
+            }
+
+            close(acceptsocks[i]);
+        }
+
         /* move the fds out of the way. */
         if (AGENTD_STATUS_SUCCESS !=
-            privsep_protect_descriptors(logsock, acceptsock, NULL))
+            privsep_protect_descriptors(logsock, &acceptsocks[0], NULL))
         {
             retval = AGENTD_ERROR_LISTENSERVICE_PRIVSEP_SETFDS_FAILURE;
             goto done;
@@ -120,7 +154,7 @@ int listenservice_proc(
         retval =
             privsep_setfds(
                 *logsock, /* ==> */ AGENTD_FD_LISTENSERVICE_LOG,
-                *acceptsock, /* ==> */ AGENTD_FD_LISTENSERVICE_ACCEPT,
+                acceptsocks[0], /* ==> */ AGENTD_FD_LISTENSERVICE_ACCEPT,
                 -1);
         if (0 != retval)
         {
@@ -129,9 +163,24 @@ int listenservice_proc(
             goto done;
         }
 
+        /* map the extra accept fds into place after the first. */
+        for (size_t i = 1; i < acceptcount; ++i)
+        {
+            int acceptfd = AGENTD_FD_LISTENSERVICE_ACCEPT + (int)i;
+            if (dup2(extrasocks[i], acceptfd) < 0)
+            {
+                perror("dup2");
+                retval = AGENTD_ERROR_LISTENSERVICE_PRIVSEP_SETFDS_FAILURE;
+                goto done;
+            }
+
+            close(extrasocks[i]);
+        }
+
         /* close any socket above the given value. */
         retval =
-            privsep_close_other_fds(AGENTD_FD_LISTENSERVICE_ACCEPT);
+            privsep_close_other_fds(
+                AGENTD_FD_LISTENSERVICE_ACCEPT + (int)acceptcount - 1);
         if (0 != retval)
         {
             perror("privsep_close_other_fds");
@@ -140,7 +189,8 @@ int listenservice_proc(
         }
 
         /* open listen sockets. */
-        retval = listenservice_proc_open_listen_sockets(bconf, conf);
+        retval =
+            listenservice_proc_open_listen_sockets(bconf, conf, acceptcount);
         if (0 != retval)
         {
             retval =
@@ -213,8 +263,11 @@ int listenservice_proc(
     else
     {
         /* close sockets passed to child. */
-        close(*acceptsock);
-        *acceptsock = -1;
+        for (size_t i = 0; i < acceptcount; ++i)
+        {
+            close(acceptsocks[i]);
+            acceptsocks[i] = -1;
+        }
         close(*logsock);
         *logsock = -1;
 
@@ -231,16 +284,21 @@ done:
 /**
  * \brief Open the listen sockets for agentd.
  *
+ * The listen sockets are placed after the accept sockets, leaving a single
+ * closed descriptor between the two ranges.
+ *
  * \param bconf         The bootstrap config for this process.
  * \param conf          The config for this process.
+ * \param acceptcount   The number of accept sockets.
  *
  * \returns AGENTD_STATUS_SUCCESS on success and a non-zero status on failure.
  */
 int listenservice_proc_open_listen_sockets(
-    const bootstrap_config_t* UNUSED(bconf), const agent_config_t* conf)
+    const bootstrap_config_t* UNUSED(bconf), const agent_config_t* conf,
+    size_t acceptcount)
 {
     int retval = 0;
-    int setsock = AGENTD_FD_LISTENSERVICE_SOCK_START;
+    int setsock = AGENTD_FD_LISTENSERVICE_SOCK_START(acceptcount);
     const config_listen_address_t* listen_head = conf->listen_head;
 
     while (NULL != listen_head)
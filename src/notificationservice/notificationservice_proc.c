@@ -21,6 +21,10 @@
 #include <unistd.h>
 #include <vpr/parameters.h>
 
+/* extra protocol descriptors are parked here while the fixed descriptors are
+ * set. */
+#define AGENTD_FD_NOTIFICATIONSERVICE_PROTOCOL_HIGH 600
+
 /**
  * \brief Spawn a notification service process using the provided config
  * structure and logger socket.
@@ -36,7 +40,9 @@
  * \param randomsock    Socket used to communicate with the random service.
  * \param logsock       Socket used to communicate with the logger.
  * \param consensussock Socket connection to the consensus service.
- * \param protocolsock  Socket connection to the protocol service.
+ * \param protocolsocks Array of socket connections to the protocol service
+ *                      instances.
+ * \param protocolcount The number of sockets in protocolsocks.
  * \param pid           Pointer to the notification service pid, to be updated
  *                      on the successful completion of this function.
  * \param runsecure     Set to false if we are not being run in secure mode.
@@ -47,11 +53,14 @@
  */
 int notificationservice_proc(
     const bootstrap_config_t* bconf, const agent_config_t* conf, int logsock,
-    int consensussock, int protocolsock, pid_t* pid, bool runsecure)
+    int consensussock, const int* protocolsocks, size_t protocolcount,
+    pid_t* pid, bool runsecure)
 {
     int retval = 1;
     uid_t uid;
     gid_t gid;
+    int protocolsock;
+    int extrasocks[PROTOCOL_INSTANCES_MAXIMUM];
 
     /* parameter sanity checks. */
     MODEL_ASSERT(NULL != bconf);
@@ -59,7 +68,18 @@ int notificationservice_proc(
     MODEL_ASSERT(NULL != pid);
     MODEL_ASSERT(logsock >= 0);
     MODEL_ASSERT(consensussock >= 0);
-    MODEL_ASSERT(protocolsock >= 0);
+    MODEL_ASSERT(NULL != protocolsocks);
+
+    /* there must be at least one protocol socket, and we can only map so
+     * many. */
+    if (0 == protocolcount || protocolcount > PROTOCOL_INSTANCES_MAXIMUM)
+    {
+        retval = AGENTD_ERROR_NOTIFICATIONSERVICE_PRIVSEP_SETFDS_FAILURE;
+        goto done;
+    }
+
+    /* the first protocol socket is mapped with the fixed descriptors. */
+    protocolsock = protocolsocks[0];
 
     /* verify that this process is running as root. */
     if (runsecure && 0 != geteuid())
@@ -117,6 +137,25 @@ int notificationservice_proc(
             }
         }
 
+        /* move the extra protocol fds above the range used by protect
+         * descriptors. */
+        for (size_t i = 1; i < protocolcount; ++i)
+        {
+            extrasocks[i] =
+                fcntl(
+                    protocolsocks[i], F_DUPFD,
+                    AGENTD_FD_NOTIFICATIONSERVICE_PROTOCOL_HIGH + (int)i);
+            if (extrasocks[i] < 0)
+            {
+                perror("fcntl");
+                retval =
+                    AGENTD_ERROR_NOTIFICATIONSERVICE_PRIVSEP_SETFDS_FAILURE;
+                goto done;
+            }
+
+            close(protocolsocks[i]);
+        }
+
         /* move the fds out of the way. */
         if (AGENTD_STATUS_SUCCESS !=
             privsep_protect_descriptors(
@@ -149,9 +188,25 @@ int notificationservice_proc(
             goto done;
         }
 
+        /* map the extra protocol fds into place after the first. */
+        for (size_t i = 1; i < protocolcount; ++i)
+        {
+            int protocolfd = AGENTD_FD_NOTIFICATION_SVC_CLIENT2 + (int)i;
+            if (dup2(extrasocks[i], protocolfd) < 0)
+            {
+                perror("dup2");
+                retval =
+                    AGENTD_ERROR_NOTIFICATIONSERVICE_PRIVSEP_SETFDS_FAILURE;
+                goto done;
+            }
+
+            close(extrasocks[i]);
+        }
+
         /* close any socket above the given value. */
         retval =
-            privsep_close_other_fds(AGENTD_FD_NOTIFICATION_SVC_CLIENT2);
+            privsep_close_other_fds(
+                AGENTD_FD_NOTIFICATION_SVC_CLIENT2 + (int)protocolcount - 1);
         if (0 != retval)
         {
             perror("privsep_close_other_fds");
@@ -6,6 +6,7 @@
  * \copyright 2022 Velo Payments, Inc.  All rights reserved.
  */
 
+#include <agentd/inet.h>
 #include <agentd/notificationservice.h>
 #include <agentd/signalthread.h>
 #include <vpr/parameters.h>
@@ -28,14 +29,17 @@ RCPR_IMPORT_thread;
  *
  * \param logsock       The socket to the logging service service.
  * \param consensussock Socket connection to the consensus service.
- * \param protocolsock  Socket connection to the protocol service.
+ * \param protocolstart The first socket connection to a protocol service
+ *                      instance.  The notification service iterates from this
+ *                      socket until it encounters a closed descriptor and
+ *                      serves each of these sockets.
  *
  * \returns a status code on service exit indicating a normal or abnormal exit.
  *          - AGENTD_STATUS_SUCCESS on normal exit.
  *          - a non-zero error code on failure.
  */
 status notificationservice_run(
-    int UNUSED(logsock), int consensussock, int protocolsock)
+    int UNUSED(logsock), int consensussock, int protocolstart)
 {
     status retval, release_retval;
     rcpr_allocator* alloc;
@@ -45,14 +49,17 @@ status notificationservice_run(
     psock* signal_sock;
     notificationservice_context* ctx;
     notificationservice_instance* cinst;
-    notificationservice_instance* pinst;
+    notificationservice_instance* pinst = NULL;
     bool release_cinst = true;
-    bool release_pinst = true;
+    bool release_pinst = false;
 
     /* parameter sanity checks. */
     MODEL_ASSERT(logsock >= 0);
     MODEL_ASSERT(consensussock >= 0);
-    MODEL_ASSERT(protocolsock >= 0);
+    MODEL_ASSERT(protocolstart >= 0);
+
+    /* count the number of protocol service instance sockets. */
+    int protocolsock_count = inet_count_sockets(protocolstart);
 
     /* create the allocator instance. */
     retval = rcpr_malloc_allocator_create(&alloc);
@@ -109,39 +116,13 @@ status notificationservice_run(
     /* cinst is now owned by the context. */
     release_cinst = false;
 
-    /* create an instance for the protocol socket. */
-    retval = notificationservice_instance_create(&pinst, ctx);
-    if (STATUS_SUCCESS != retval)
-    {
-        goto cleanup_cinst;
-    }
-
-    /* add the protocol socket instance to the context. */
-    retval = notificationservice_context_add_instance(ctx, pinst);
-    if (STATUS_SUCCESS != retval)
-    {
-        goto cleanup_pinst;
-    }
-
-    /* pinst is now owned by the context. */
-    release_pinst = false;
-
     /* add a protocol fiber for the consensus socket. */
     retval =
         notificationservice_protocol_fiber_add(
             alloc, cinst, consensussock);
     if (STATUS_SUCCESS != retval)
     {
-        goto cleanup_pinst;
-    }
-
-    /* add a protocol fiber for the protocol socket. */
-    retval =
-        notificationservice_protocol_fiber_add(
-            alloc, pinst, protocolsock);
-    if (STATUS_SUCCESS != retval)
-    {
-        goto cleanup_pinst;
+        goto cleanup_cinst;
     }
 
     /* add an outbound endpoint fiber for the consensus socket. */
@@ -149,15 +130,48 @@ status notificationservice_run(
         notificationservice_protocol_outbound_endpoint_add(alloc, cinst);
     if (STATUS_SUCCESS != retval)
     {
-        goto cleanup_pinst;
+        goto cleanup_cinst;
     }
 
-    /* add an outbound endpoint fiber for the protocol socket. */
-    retval =
-        notificationservice_protocol_outbound_endpoint_add(alloc, pinst);
-    if (STATUS_SUCCESS != retval)
+    /* add an instance for each protocol service socket. */
+    for (int i = 0; i < protocolsock_count; ++i)
     {
-        goto cleanup_pinst;
+        /* create an instance for this protocol socket. */
+        retval = notificationservice_instance_create(&pinst, ctx);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_cinst;
+        }
+
+        /* pinst must be released if it can't be added to the context. */
+        release_pinst = true;
+
+        /* add the protocol socket instance to the context. */
+        retval = notificationservice_context_add_instance(ctx, pinst);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_pinst;
+        }
+
+        /* pinst is now owned by the context. */
+        release_pinst = false;
+
+        /* add a protocol fiber for the protocol socket. */
+        retval =
+            notificationservice_protocol_fiber_add(
+                alloc, pinst, protocolstart + i);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_pinst;
+        }
+
+        /* add an outbound endpoint fiber for the protocol socket. */
+        retval =
+            notificationservice_protocol_outbound_endpoint_add(alloc, pinst);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_pinst;
+        }
     }
 
     /* create the signal thread. */
@@ -25,7 +25,9 @@ RCPR_IMPORT_resource;
  * \param return_address    The return mailbox address, needed for looking up
  *                          the request context.
  * \param reply_payload     Pointer to the pointer to receive the reply payload
- *                          for this request.
+ *                          for this request. This is set to NULL if the reply
+ *                          is sent by the endpoint read fiber once the
+ *                          dataservice responds.
  *
  * \returns a status code indicating success or failure.
  *      - STATUS_SUCCESS on success.
@@ -34,12 +36,12 @@ RCPR_IMPORT_resource;
 status pde_decode_and_dispatch_req_context_close(
     protocolservice_dataservice_endpoint_context* ctx,
     protocolservice_dataservice_request_message* req_payload,
-    RCPR_SYM(mailbox_address) /*return_address*/,
+    RCPR_SYM(mailbox_address) return_address,
     protocolservice_protocol_write_endpoint_message** reply_payload)
 {
     status retval;
-    uint32_t status, offset;
     protocolservice_dataservice_mailbox_context_entry* entry = NULL;
+    protocolservice_dataservice_pending_request* pending = NULL;
 
     /* parameter sanity checks. */
     MODEL_ASSERT(prop_protocolservice_dataservice_endpoint_context_valid(ctx));
@@ -57,47 +59,34 @@ status pde_decode_and_dispatch_req_context_close(
         goto send_response;
     }
 
-    /* send the dataservice child context close request. */
+    /* create a pending request so the read fiber can complete this close. */
     retval =
-        dataservice_api_sendreq_child_context_close(
-            ctx->datasock, &ctx->vpr_alloc, entry->context);
+        protocolservice_dataservice_pending_request_create(
+            &pending, ctx, req_payload, return_address);
     if (STATUS_SUCCESS != retval)
     {
         goto send_response;
     }
 
-    /* receive the dataservice child context close response. */
-    retval =
-        dataservice_api_recvresp_child_context_close(
-            ctx->datasock, ctx->alloc, &offset, &status);
-    if (STATUS_SUCCESS != retval)
-    {
-        goto send_response;
-    }
-
-    /* if the request failed on the dataservice side, log the error. */
-    if (STATUS_SUCCESS != status)
-    {
-        retval = status;
-        goto send_response;
-    }
+    /* queue the pending request behind any outstanding requests for this
+     * context; the queue owns it after this call. */
+    protocolservice_dataservice_pending_queue_push(&entry->pending, pending);
 
-    /* remove the entry from the mailbox_context tree. */
-    retval = rbtree_delete(NULL, ctx->mailbox_context_tree, &entry->addr);
+    /* send the dataservice child context close request. */
+    retval =
+        dataservice_api_sendreq_child_context_close(
+            ctx->datasock, &ctx->vpr_alloc, entry->context);
     if (STATUS_SUCCESS != retval)
     {
-        goto send_response;
+        goto done;
     }
 
-    /* remove the entry from the context_mailbox tree. */
-    retval = rbtree_delete(NULL, ctx->context_mailbox_tree, &entry->context);
-    if (STATUS_SUCCESS != retval)
-    {
-        goto send_response;
-    }
+    /* the reply is sent by the read fiber. */
+    *reply_payload = NULL;
 
     /* success. */
-    goto send_response;
+    retval = STATUS_SUCCESS;
+    goto done;
 
 send_response:
     return
@@ -105,4 +94,7 @@ send_response:
             reply_payload, ctx->ctx,
             PROTOCOLSERVICE_PROTOCOL_WRITE_ENDPOINT_DATASERVICE_CONTEXT_CREATE_MSG,
             0U, req_payload->offset, NULL, 0U);
+
+done:
+    return retval;
 }
@@ -15,7 +15,6 @@
 #include "protocolservice_internal.h"
 
 RCPR_IMPORT_allocator_as(rcpr);
-RCPR_IMPORT_rbtree;
 RCPR_IMPORT_resource;
 
 /**
@@ -26,7 +25,9 @@ RCPR_IMPORT_resource;
  * \param return_address    The return mailbox address, needed for looking up
  *                          the request context.
  * \param reply_payload     Pointer to the pointer to receive the reply payload
- *                          for this request.
+ *                          for this request. This is set to NULL if the reply
+ *                          is sent by the endpoint read fiber once the
+ *                          dataservice responds.
  *
  * \returns a status code indicating success or failure.
  *      - STATUS_SUCCESS on success.
@@ -39,8 +40,8 @@ status pde_decode_and_dispatch_req_context_open(
     protocolservice_protocol_write_endpoint_message** reply_payload)
 {
     status retval, release_retval;
-    uint32_t offset, status, child;
     protocolservice_dataservice_mailbox_context_entry* tmp = NULL;
+    protocolservice_dataservice_pending_request* pending = NULL;
 
     /* parameter sanity checks. */
     MODEL_ASSERT(prop_protocolservice_dataservice_endpoint_context_valid(ctx));
@@ -49,6 +50,9 @@ status pde_decode_and_dispatch_req_context_open(
     MODEL_ASSERT(return_address > 0);
     MODEL_ASSERT(NULL != reply_payload);
 
+    /* the reply is sent by the read fiber. */
+    *reply_payload = NULL;
+
     /* create a mailbox_context entry. */
     retval = rcpr_allocator_allocate(ctx->alloc, (void**)&tmp, sizeof(*tmp));
     if (STATUS_SUCCESS != retval)
@@ -66,83 +70,38 @@ status pde_decode_and_dispatch_req_context_open(
     tmp->reference_count = 1;
     tmp->addr = req_payload->data;
 
-    /* send a dataservice child context create request to the data service. */
+    /* create a pending request so the read fiber can complete this open. */
     retval =
-        dataservice_api_sendreq_child_context_create(    
-            ctx->datasock, &ctx->vpr_alloc, req_payload->payload.data,
-            req_payload->payload.size);
-    if (STATUS_SUCCESS != retval)
-    {
-        goto cleanup_mailbox_context;
-    }
-
-    /* read the response from this operation. */
-    retval =
-        dataservice_api_recvresp_child_context_create(
-            ctx->datasock, ctx->alloc, &offset, &status, &child);
-    if (STATUS_SUCCESS != retval)
-    {
-        goto cleanup_mailbox_context;
-    }
-
-    /* verify that context allocation was successful. */
-    if (STATUS_SUCCESS != status)
-    {
-        goto cleanup_mailbox_context;
-    }
-
-    /* set the context. */
-    tmp->context = child;
-
-    /* insert this record into the mailbox_context map. */
-    retval = rbtree_insert(ctx->mailbox_context_tree, &tmp->hdr);
+        protocolservice_dataservice_pending_request_create(
+            &pending, ctx, req_payload, return_address);
     if (STATUS_SUCCESS != retval)
     {
         goto cleanup_mailbox_context;
     }
 
-    /* bump the reference count. */
-    tmp->reference_count += 1;
-
-    /* insert this record into the context_mailbox map. */
-    retval = rbtree_insert(ctx->context_mailbox_tree, &tmp->hdr);
-    if (STATUS_SUCCESS != retval)
-    {
-        goto remove_mailbox_context_entry;
-    }
-
-    /* on success, this map owns our reference. */
+    /* the pending request now owns the mailbox context entry. */
+    pending->entry = tmp;
     tmp = NULL;
 
-    /* create the response message. */
+    /* queue the pending request; the queue owns it after this call. Child
+     * context create responses carry no child index, so these are matched in
+     * request order. */
+    protocolservice_dataservice_pending_queue_push(&ctx->pending_open, pending);
+
+    /* send a dataservice child context create request to the data service. */
     retval =
-        protocolservice_protocol_write_endpoint_message_create(
-            reply_payload, ctx->ctx,
-            PROTOCOLSERVICE_PROTOCOL_WRITE_ENDPOINT_DATASERVICE_CONTEXT_CREATE_MSG,
-            0U, 0U, NULL, 0);
+        dataservice_api_sendreq_child_context_create(    
+            ctx->datasock, &ctx->vpr_alloc, req_payload->payload.data,
+            req_payload->payload.size);
     if (STATUS_SUCCESS != retval)
     {
-        goto remove_context_mailbox_entry;
+        goto done;
     }
 
     /* success. */
+    retval = STATUS_SUCCESS;
     goto done;
 
-remove_context_mailbox_entry:
-    release_retval = rbtree_delete(NULL, ctx->context_mailbox_tree, &child);
-    if (STATUS_SUCCESS != release_retval)
-    {
-        retval = release_retval;
-    }
-
-remove_mailbox_context_entry:
-    release_retval =
-        rbtree_delete(NULL, ctx->mailbox_context_tree, &return_address);
-    if (STATUS_SUCCESS != release_retval)
-    {
-        retval = release_retval;
-    }
-
 cleanup_mailbox_context:
     if (NULL != tmp)
     {
@@ -13,10 +13,8 @@
 
 #include "protocolservice_internal.h"
 
-RCPR_IMPORT_allocator_as(rcpr);
 RCPR_IMPORT_psock;
 RCPR_IMPORT_rbtree;
-RCPR_IMPORT_resource;
 
 /**
  * \brief Decode and dispatch a generic dataservice request.
@@ -26,7 +24,9 @@ RCPR_IMPORT_resource;
  * \param return_address    The return mailbox address, needed for looking up
  *                          the request context.
  * \param reply_payload     Pointer to the pointer to receive the reply payload
- *                          for this request.
+ *                          for this request. This is set to NULL if the reply
+ *                          is sent by the endpoint read fiber once the
+ *                          dataservice responds.
  *
  * \returns a status code indicating success or failure.
  *      - STATUS_SUCCESS on success.
@@ -38,10 +38,12 @@ status pde_decode_and_dispatch_req_dataservice_req(
     RCPR_SYM(mailbox_address) return_address,
     protocolservice_protocol_write_endpoint_message** reply_payload)
 {
-    status retval, release_retval;
+    status retval;
     protocolservice_dataservice_mailbox_context_entry* context_entry;
-    void* reply_data = NULL;
-    size_t reply_data_size;
+    protocolservice_dataservice_pending_request* pending = NULL;
+
+    /* the reply is sent by the read fiber. */
+    *reply_payload = NULL;
 
     /* look up the child context entry. */
     retval =
@@ -61,50 +63,33 @@ status pde_decode_and_dispatch_req_dataservice_req(
     uint32_t ncontext = htonl(context_entry->context);
     memcpy(breq + 4, &ncontext, sizeof(ncontext));
 
-    /* write this message to the dataservice socket. */
+    /* create a pending request so the read fiber can route the response. */
     retval =
-        psock_write_boxed_data(
-            ctx->datasock, req_payload->payload.data,
-            req_payload->payload.size);
+        protocolservice_dataservice_pending_request_create(
+            &pending, ctx, req_payload, return_address);
     if (STATUS_SUCCESS != retval)
     {
         goto done;
     }
 
-    /* read the response back from the dataservice socket. */
-    retval =
-        psock_read_boxed_data(
-            ctx->datasock, ctx->alloc, &reply_data, &reply_data_size);
-    if (STATUS_SUCCESS != retval)
-    {
-        goto done;
-    }
+    /* queue the pending request before writing, since the response can be
+     * read as soon as this write completes. The queue owns the request. */
+    protocolservice_dataservice_pending_queue_push(
+        &context_entry->pending, pending);
 
-    /* create the payload to send to the protocolservice write endpoint. */
+    /* write this message to the dataservice socket. */
     retval =
-        protocolservice_protocol_write_endpoint_message_create(
-            reply_payload, ctx->ctx,
-            PROTOCOLSERVICE_PROTOCOL_WRITE_ENDPOINT_DATASERVICE_MSG,
-            req_payload->protocol_request_id, req_payload->offset, reply_data,
-            reply_data_size);
+        psock_write_boxed_data(
+            ctx->datasock, req_payload->payload.data,
+            req_payload->payload.size);
     if (STATUS_SUCCESS != retval)
     {
-        goto cleanup_reply_data;
+        goto done;
     }
 
     /* success. */
-    goto cleanup_reply_data;
-
-cleanup_reply_data:
-    if (NULL != reply_data)
-    {
-        release_retval = rcpr_allocator_reclaim(ctx->alloc, reply_data);
-        if (STATUS_SUCCESS != release_retval)
-        {
-            retval = release_retval;
-        }
-        reply_data = NULL;
-    }
+    retval = STATUS_SUCCESS;
+    goto done;
 
 done:
     return retval;
@@ -0,0 +1,111 @@
+/**
+ * \file
+ * protocolservice/pde_decode_and_dispatch_resp_context_close.c
+ *
+ * \brief Decode and dispatch a child context close response.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/dataservice/api.h>
+#include <agentd/dataservice/async_api.h>
+#include <agentd/status_codes.h>
+#include <cbmc/model_assert.h>
+
+#include "protocolservice_internal.h"
+
+RCPR_IMPORT_rbtree;
+
+/**
+ * \brief Decode and dispatch a dataservice child context close response.
+ *
+ * \param ctx               The endpoint context.
+ * \param entry             The mailbox context entry for this response.
+ * \param pending           The pending request matching this response.
+ * \param resp              The response data.
+ * \param resp_size         The size of the response data.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status pde_decode_and_dispatch_resp_context_close(
+    protocolservice_dataservice_endpoint_context* ctx,
+    protocolservice_dataservice_mailbox_context_entry* entry,
+    protocolservice_dataservice_pending_request* pending, const void* resp,
+    size_t resp_size)
+{
+    status retval;
+    protocolservice_protocol_write_endpoint_message* reply_payload;
+    dataservice_response_child_context_close_t dresp;
+    uint32_t context;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_protocolservice_dataservice_endpoint_context_valid(ctx));
+    MODEL_ASSERT(
+        prop_protocolservice_dataservice_mailbox_context_entry_valid(entry));
+    MODEL_ASSERT(
+        prop_protocolservice_dataservice_pending_request_valid(pending));
+    MODEL_ASSERT(NULL != resp);
+
+    /* decode the response. */
+    retval =
+        dataservice_decode_response_child_context_close(
+            resp, resp_size, &dresp);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto send_response;
+    }
+
+    /* if the request failed on the dataservice side, log the error. */
+    if (STATUS_SUCCESS != dresp.hdr.status)
+    {
+        retval = dresp.hdr.status;
+        goto cleanup_dresp;
+    }
+
+    /* cache the context, since the entry may be released below. */
+    context = entry->context;
+
+    /* remove the entry from the mailbox_context tree. */
+    retval = rbtree_delete(NULL, ctx->mailbox_context_tree, &entry->addr);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_dresp;
+    }
+
+    /* remove the entry from the context_mailbox tree. */
+    /* NOTE that after this, entry will be dangling. */
+    retval = rbtree_delete(NULL, ctx->context_mailbox_tree, &context);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_dresp;
+    }
+
+    /* success. */
+    goto cleanup_dresp;
+
+cleanup_dresp:
+    dispose((disposable_t*)&dresp);
+
+send_response:
+    /* the requesting fiber is always answered, as the context is now closed
+     * from its perspective. */
+    retval =
+        protocolservice_protocol_write_endpoint_message_create(
+            &reply_payload, ctx->ctx,
+            PROTOCOLSERVICE_PROTOCOL_WRITE_ENDPOINT_DATASERVICE_CONTEXT_CREATE_MSG,
+            0U, pending->offset, NULL, 0U);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* send the response to the requesting fiber. */
+    retval =
+        protocolservice_dataservice_endpoint_send_reply(
+            ctx, pending->return_address, reply_payload);
+
+done:
+    return retval;
+}
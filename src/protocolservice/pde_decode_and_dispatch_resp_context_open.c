@@ -0,0 +1,163 @@
+/**
+ * \file
+ * protocolservice/pde_decode_and_dispatch_resp_context_open.c
+ *
+ * \brief Decode and dispatch a child context create response.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/dataservice/api.h>
+#include <agentd/dataservice/async_api.h>
+#include <agentd/status_codes.h>
+#include <cbmc/model_assert.h>
+
+#include "protocolservice_internal.h"
+
+RCPR_IMPORT_rbtree;
+RCPR_IMPORT_resource;
+
+/**
+ * \brief Decode and dispatch a dataservice child context create response.
+ *
+ * The requesting fiber is always answered. If the context could not be
+ * opened, it receives an error reply carrying the failure status.
+ *
+ * \param ctx               The endpoint context.
+ * \param resp              The response data.
+ * \param resp_size         The size of the response data.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status pde_decode_and_dispatch_resp_context_open(
+    protocolservice_dataservice_endpoint_context* ctx, const void* resp,
+    size_t resp_size)
+{
+    status retval, release_retval, send_retval;
+    protocolservice_dataservice_pending_request* pending;
+    protocolservice_dataservice_mailbox_context_entry* entry;
+    protocolservice_protocol_write_endpoint_message* reply_payload;
+    dataservice_response_child_context_create_t dresp;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_protocolservice_dataservice_endpoint_context_valid(ctx));
+    MODEL_ASSERT(NULL != resp);
+
+    /* get the oldest pending context open request. */
+    pending = protocolservice_dataservice_pending_queue_pop(&ctx->pending_open);
+    if (NULL == pending)
+    {
+        retval = AGENTD_ERROR_PROTOCOLSERVICE_DATASERVICE_UNEXPECTED_RESPONSE;
+        goto done;
+    }
+
+    /* decode the response. */
+    retval =
+        dataservice_decode_response_child_context_create(
+            resp, resp_size, &dresp);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto send_error;
+    }
+
+    /* verify that context allocation was successful. */
+    if (STATUS_SUCCESS != dresp.hdr.status)
+    {
+        retval = dresp.hdr.status;
+        goto cleanup_dresp;
+    }
+
+    /* set the context. */
+    entry = pending->entry;
+    entry->context = dresp.child;
+
+    /* insert this record into the mailbox_context map. */
+    retval = rbtree_insert(ctx->mailbox_context_tree, &entry->hdr);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_dresp;
+    }
+
+    /* the mailbox_context map now owns the pending request's reference. */
+    pending->entry = NULL;
+
+    /* bump the reference count. */
+    entry->reference_count += 1;
+
+    /* insert this record into the context_mailbox map. */
+    retval = rbtree_insert(ctx->context_mailbox_tree, &entry->hdr);
+    if (STATUS_SUCCESS != retval)
+    {
+        entry->reference_count -= 1;
+        goto remove_mailbox_context_entry;
+    }
+
+    /* create the response message. */
+    retval =
+        protocolservice_protocol_write_endpoint_message_create(
+            &reply_payload, ctx->ctx,
+            PROTOCOLSERVICE_PROTOCOL_WRITE_ENDPOINT_DATASERVICE_CONTEXT_CREATE_MSG,
+            0U, 0U, NULL, 0);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto remove_context_mailbox_entry;
+    }
+
+    /* send the response to the requesting fiber. */
+    retval =
+        protocolservice_dataservice_endpoint_send_reply(
+            ctx, pending->return_address, reply_payload);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto remove_context_mailbox_entry;
+    }
+
+    /* success. */
+    goto cleanup_dresp;
+
+remove_context_mailbox_entry:
+    release_retval =
+        rbtree_delete(NULL, ctx->context_mailbox_tree, &entry->context);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+remove_mailbox_context_entry:
+    /* NOTE that after this, entry will be dangling. */
+    release_retval =
+        rbtree_delete(NULL, ctx->mailbox_context_tree, &entry->addr);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_dresp:
+    dispose((disposable_t*)&dresp);
+
+send_error:
+    /* on failure, answer the requesting fiber with an error, so that it is
+     * not left waiting for a reply that will never come. */
+    if (STATUS_SUCCESS != retval)
+    {
+        send_retval =
+            protocolservice_dataservice_endpoint_send_error(
+                ctx, pending, retval);
+        if (STATUS_SUCCESS != send_retval)
+        {
+            retval = send_retval;
+        }
+    }
+
+    /* release the pending request. */
+    release_retval = resource_release(&pending->hdr);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+done:
+    return retval;
+}
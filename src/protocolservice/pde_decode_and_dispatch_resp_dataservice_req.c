@@ -0,0 +1,66 @@
+/**
+ * \file
+ * protocolservice/pde_decode_and_dispatch_resp_dataservice_req.c
+ *
+ * \brief Decode and dispatch a generic dataservice response.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+
+#include "protocolservice_internal.h"
+
+/**
+ * \brief Decode and dispatch a generic dataservice response.
+ *
+ * \param ctx               The endpoint context.
+ * \param pending           The pending request matching this response.
+ * \param resp              The response data.
+ * \param resp_size         The size of the response data.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status pde_decode_and_dispatch_resp_dataservice_req(
+    protocolservice_dataservice_endpoint_context* ctx,
+    protocolservice_dataservice_pending_request* pending, const void* resp,
+    size_t resp_size)
+{
+    status retval;
+    protocolservice_protocol_write_endpoint_message* reply_payload;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_protocolservice_dataservice_endpoint_context_valid(ctx));
+    MODEL_ASSERT(
+        prop_protocolservice_dataservice_pending_request_valid(pending));
+    MODEL_ASSERT(NULL != resp);
+
+    /* create the payload to send to the protocolservice write endpoint. */
+    retval =
+        protocolservice_protocol_write_endpoint_message_create(
+            &reply_payload, ctx->ctx,
+            PROTOCOLSERVICE_PROTOCOL_WRITE_ENDPOINT_DATASERVICE_MSG,
+            pending->protocol_request_id, pending->offset, resp, resp_size);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* send the response to the protocol write endpoint. */
+    retval =
+        protocolservice_dataservice_endpoint_send_reply(
+            ctx, pending->return_address, reply_payload);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    goto done;
+
+done:
+    return retval;
+}
@@ -0,0 +1,156 @@
+/**
+ * \file protocolservice/protocolservice_api_recvresp_artifact_transaction_list_get.c
+ *
+ * \brief Receive an artifact transaction list get response.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/ipc.h>
+#include <agentd/protocolservice/api.h>
+#include <agentd/status_codes.h>
+#include <cbmc/model_assert.h>
+
+/**
+ * \brief Receive an artifact transaction list get response.
+ *
+ * \param sock                      The socket from which this response is read.
+ * \param suite                     The crypto suite to use to verify this
+ *                                  response.
+ * \param server_iv                 Pointer to the server IV, updated by this
+ *                                  call.
+ * \param shared_secret             The shared secret key for this response.
+ * \param offset                    The offset for this response.
+ * \param status                    The status for this response.
+ * \param more                      Set to true if the artifact's history
+ *                                  continues past this page.
+ * \param entries                   Pointer to be populated with the entries in
+ *                                  this page on success.  This array is
+ *                                  dynamically allocated and must be freed by
+ *                                  the caller.
+ * \param count                     The number of entries returned.
+ *
+ * On a successful return from this function, the status is updated with the
+ * status code from the API request.  This status should be checked.  A zero
+ * status indicates the request to the remote peer was successful, and a
+ * non-zero status indicates that the request to the remote peer failed.  The
+ * entries are only populated on success.
+ *
+ * If the status code is updated with an error from the service, then this error
+ * will be reflected in the status variable, and a AGENTD_STATUS_SUCCESS will be
+ * returned by this function.  Thus, both the return value of this function and
+ * the upstream status code must be checked for correct operation.
+ *
+ * Possible upstream status codes:
+ *      - AGENTD_ERROR_DATASERVICE_NOT_FOUND if no transactions were found for
+ *        this artifact at or after the start position.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_IPC_READ_BLOCK_FAILURE if a blocking read on the socket
+ *        failed.
+ *      - AGENTD_ERROR_IPC_READ_UNEXPECTED_DATA_TYPE if the data type read from
+ *        the socket was unexpected.
+ *      - AGENTD_ERROR_GENERAL_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ */
+int protocolservice_api_recvresp_artifact_transaction_list_get(
+    int sock, vccrypt_suite_options_t* suite, uint64_t* server_iv,
+    const vccrypt_buffer_t* shared_secret, uint32_t* offset, uint32_t* status,
+    bool* more, data_artifact_transaction_entry_t** entries, size_t* count)
+{
+    int retval;
+    uint32_t* val;
+    uint32_t size;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != suite);
+    MODEL_ASSERT(NULL != server_iv);
+    MODEL_ASSERT(NULL != shared_secret);
+    MODEL_ASSERT(NULL != offset);
+    MODEL_ASSERT(NULL != status);
+    MODEL_ASSERT(NULL != more);
+    MODEL_ASSERT(NULL != entries);
+    MODEL_ASSERT(NULL != count);
+
+    /* read the response from the server. */
+    retval =
+        ipc_read_authed_data_block(
+            sock, *server_iv, (void**)&val, &size, suite, shared_secret);
+    if (AGENTD_STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* update the server_iv on successful read. */
+    *server_iv += 1;
+
+    /* verify that the response is the correct size. */
+    if (size < 3 * sizeof(uint32_t))
+    {
+        retval = AGENTD_ERROR_IPC_READ_UNEXPECTED_DATA_SIZE;
+        goto cleanup_val;
+    }
+
+    /* verify the request id. */
+    if (UNAUTH_PROTOCOL_REQ_ID_ARTIFACT_TXN_LIST_GET != ntohl(val[0]))
+    {
+        retval = AGENTD_ERROR_IPC_READ_UNEXPECTED_DATA_TYPE;
+        goto cleanup_val;
+    }
+
+    /* set the status and offset. */
+    *status = ntohl(val[1]);
+    *offset = ntohl(val[2]);
+
+    /* was the status successful? */
+    if (AGENTD_STATUS_SUCCESS != *status)
+    {
+        retval = AGENTD_STATUS_SUCCESS;
+        goto cleanup_val;
+    }
+
+    /* the more flag is followed by whole entries. */
+    const size_t header_size = 4 * sizeof(uint32_t);
+    const size_t entry_size = 16 + 8 + 4;
+    if (size <= header_size || 0U != (size - header_size) % entry_size)
+    {
+        retval = AGENTD_ERROR_IPC_READ_UNEXPECTED_DATA_SIZE;
+        goto cleanup_val;
+    }
+
+    /* allocate space for the entries. */
+    *count = (size - header_size) / entry_size;
+    *entries =
+        (data_artifact_transaction_entry_t*)
+            malloc(*count * sizeof(data_artifact_transaction_entry_t));
+    if (NULL == *entries)
+    {
+        retval = AGENTD_ERROR_GENERAL_OUT_OF_MEMORY;
+        goto cleanup_val;
+    }
+
+    /* set the more flag. */
+    *more = (0U != ntohl(val[3]));
+
+    /* copy the entries. */
+    const uint8_t* bval = (const uint8_t*)(val + 4);
+    for (size_t i = 0; i < *count; ++i)
+    {
+        memcpy((*entries)[i].txn_id, bval, 16);
+        memcpy(&(*entries)[i].net_height, bval + 16, 8);
+        memcpy(&(*entries)[i].net_index, bval + 24, 4);
+        bval += entry_size;
+    }
+
+    /* success. */
+    retval = AGENTD_STATUS_SUCCESS;
+    goto cleanup_val;
+
+cleanup_val:
+    memset(val, 0, size);
+    free(val);
+
+done:
+    return retval;
+}
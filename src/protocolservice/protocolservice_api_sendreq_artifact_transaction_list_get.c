@@ -0,0 +1,106 @@
+/**
+ * \file protocolservice/protocolservice_api_sendreq_artifact_transaction_list_get.c
+ *
+ * \brief Send the artifact transaction list get request.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <arpa/inet.h>
+#include <agentd/inet.h>
+#include <agentd/ipc.h>
+#include <agentd/protocolservice/api.h>
+#include <agentd/status_codes.h>
+#include <cbmc/model_assert.h>
+#include <unistd.h>
+#include <vccrypt/compare.h>
+#include <vpr/parameters.h>
+
+/**
+ * \brief Send an artifact transaction list get request.
+ *
+ * \param sock                      The socket to which this request is written.
+ * \param suite                     The crypto suite to use for this handshake.
+ * \param client_iv                 Pointer to the client IV, updated by this
+ *                                  call.
+ * \param shared_secret             The shared secret key for this request.
+ * \param artifact_id               The artifact UUID to query.
+ * \param start_height              The block height at which the page starts.
+ * \param start_index               The index within the start height at which
+ *                                  the page starts.
+ * \param max_count                 The maximum number of transactions to
+ *                                  return.
+ *
+ * This function sends an artifact transaction list get request as an
+ * authorized packet to the server.  To read the next page, send another request
+ * starting just after the height and index of the last entry returned.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_IPC_WRITE_BLOCK_FAILURE if a blocking write on the socket
+ *        failed.
+ *      - AGENTD_ERROR_GENERAL_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+int protocolservice_api_sendreq_artifact_transaction_list_get(
+    int sock, vccrypt_suite_options_t* suite, uint64_t* client_iv,
+    const vccrypt_buffer_t* shared_secret, const uint8_t* artifact_id,
+    uint64_t start_height, uint32_t start_index, uint32_t max_count)
+{
+    int retval;
+
+    /* parameter sanity checking. */
+    MODEL_ASSERT(NULL != suite);
+    MODEL_ASSERT(NULL != client_iv);
+    MODEL_ASSERT(NULL != shared_secret);
+    MODEL_ASSERT(NULL != artifact_id);
+
+    /* create a buffer for holding the request. */
+    size_t req_size = 4 * sizeof(uint32_t) + 16 + 1 * sizeof(uint64_t);
+    vccrypt_buffer_t req;
+    if (VCCRYPT_STATUS_SUCCESS !=
+        vccrypt_buffer_init(
+            &req, suite->alloc_opts, req_size))
+    {
+        retval = AGENTD_ERROR_GENERAL_OUT_OF_MEMORY;
+        goto done;
+    }
+
+    /* populate the request. */
+    uint8_t* breq = (uint8_t*)req.data;
+    uint32_t net_method_id =
+        htonl(UNAUTH_PROTOCOL_REQ_ID_ARTIFACT_TXN_LIST_GET);
+    uint32_t net_request_id = htonl(0UL);
+    uint64_t net_start_height = htonll(start_height);
+    uint32_t net_start_index = htonl(start_index);
+    uint32_t net_max_count = htonl(max_count);
+    memcpy(breq, &net_method_id, sizeof(net_method_id));
+    memcpy(breq + 4, &net_request_id, sizeof(net_request_id));
+    memcpy(breq + 8, artifact_id, 16);
+    memcpy(breq + 24, &net_start_height, sizeof(net_start_height));
+    memcpy(breq + 32, &net_start_index, sizeof(net_start_index));
+    memcpy(breq + 36, &net_max_count, sizeof(net_max_count));
+
+    /* write IPC authed request packet to the server. */
+    retval =
+        ipc_write_authed_data_block(
+            sock, *client_iv, req.data, req.size, suite, shared_secret);
+    if (AGENTD_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_req;
+    }
+
+    /* increment client IV. */
+    *client_iv += 1;
+
+    /* success. */
+    retval = AGENTD_STATUS_SUCCESS;
+    goto cleanup_req;
+
+cleanup_req:
+    dispose((disposable_t*)&req);
+
+done:
+    return retval;
+}
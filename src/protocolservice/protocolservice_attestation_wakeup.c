@@ -0,0 +1,39 @@
+/**
+ * \file protocolservice/protocolservice_attestation_wakeup.c
+ *
+ * \brief Wake the attestation service after a transaction submission.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <sys/socket.h>
+
+#include "protocolservice_internal.h"
+
+/**
+ * \brief Wake the attestation service after a transaction has been submitted.
+ *
+ * This is a best-effort, non-blocking signal.  If the wakeup socket is full or
+ * unavailable, the attestation service will still find the transaction on its
+ * next timed wakeup, so errors are ignored.
+ *
+ * \param ctx           The protocol service context.
+ */
+void protocolservice_attestation_wakeup(protocolservice_context* ctx)
+{
+    const uint8_t wakeup = 1;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_protocolservice_context_valid(ctx));
+
+    /* if there is no wakeup socket, there is nothing to do. */
+    if (ctx->attestation_wakeup_sock < 0)
+    {
+        return;
+    }
+
+    /* send the wakeup datagram, ignoring errors. */
+    (void)send(
+        ctx->attestation_wakeup_sock, &wakeup, sizeof(wakeup),
+        MSG_DONTWAIT | MSG_NOSIGNAL);
+}
@@ -0,0 +1,74 @@
+/**
+ * \file protocolservice/protocolservice_block_range_request_chunk.c
+ *
+ * \brief Request the next chunk of a block range stream.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/dataservice/async_api.h>
+#include <agentd/protocolservice/api.h>
+#include <cbmc/model_assert.h>
+#include <stdint.h>
+
+#include "protocolservice_internal.h"
+
+/**
+ * \brief Request the next chunk of an active block range stream from the
+ * dataservice.
+ *
+ * Only one chunk is requested at a time.  The next chunk is requested after the
+ * previous chunk has been flushed to the client, so a slow client holds at most
+ * one chunk in the write endpoint.
+ *
+ * \param ctx           The protocol service protocol fiber context.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_block_range_request_chunk(
+    protocolservice_protocol_fiber_context* ctx)
+{
+    status retval;
+    vccrypt_buffer_t reqbuf;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_protocolservice_protocol_fiber_context_valid(ctx));
+    MODEL_ASSERT(ctx->block_range_active);
+
+    /* the dataservice clamps this budget to its own per-chunk limit. */
+    uint32_t max_bytes =
+        (ctx->block_range_remaining_bytes > UINT32_MAX)
+            ? UINT32_MAX : (uint32_t)ctx->block_range_remaining_bytes;
+
+    /* encode the request to the dataservice endpoint. */
+    retval =
+        dataservice_encode_request_block_range_get(
+            &reqbuf, &ctx->ctx->vpr_alloc, 0U, ctx->block_range_next_height,
+            ctx->block_range_remaining_count, max_bytes);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* send this message to the dataservice endpoint. */
+    retval =
+        protocolservice_dataservice_send_request(
+            ctx, UNAUTH_PROTOCOL_REQ_ID_BLOCK_RANGE_GET,
+            ctx->block_range_client_offset, &reqbuf);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_reqbuf;
+    }
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    goto cleanup_reqbuf;
+
+cleanup_reqbuf:
+    dispose((disposable_t*)&reqbuf);
+
+done:
+    return retval;
+}
@@ -0,0 +1,43 @@
+/**
+ * \file protocolservice/protocolservice_cert_cache_dispose.c
+ *
+ * \brief Dispose a certificate cache.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+
+#include "protocolservice_internal.h"
+
+RCPR_IMPORT_rbtree;
+RCPR_IMPORT_resource;
+
+/**
+ * \brief Dispose a certificate cache, releasing all of its entries.
+ *
+ * \param cache         The certificate cache to dispose.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_cert_cache_dispose(protocolservice_cert_cache* cache)
+{
+    status retval = STATUS_SUCCESS;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != cache);
+
+    /* releasing the tree releases every entry. */
+    if (NULL != cache->entries)
+    {
+        retval = resource_release(rbtree_resource_handle(cache->entries));
+    }
+
+    /* clear the cache. */
+    memset(cache, 0, sizeof(*cache));
+
+    return retval;
+}
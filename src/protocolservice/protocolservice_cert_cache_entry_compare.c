@@ -0,0 +1,58 @@
+/**
+ * \file protocolservice/protocolservice_cert_cache_entry_compare.c
+ *
+ * \brief Compare the keys of two certificate cache entries.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <string.h>
+
+#include "protocolservice_internal.h"
+
+/**
+ * \brief Compare two opaque \ref protocolservice_cert_cache_key keys.
+ *
+ * \param context       Unused.
+ * \param lhs           The left-hand side of the comparison.
+ * \param rhs           The right-hand side of the comparison.
+ *
+ * \returns an integer value representing the comparison result.
+ *      - RCPR_COMPARE_LT if \p lhs &lt; \p rhs.
+ *      - RCPR_COMPARE_EQ if \p lhs == \p rhs.
+ *      - RCPR_COMPARE_GT if \p lhs &gt; \p rhs.
+ */
+RCPR_SYM(rcpr_comparison_result) protocolservice_cert_cache_entry_compare(
+    void* /*context*/, const void* lhs, const void* rhs)
+{
+    const protocolservice_cert_cache_key* l =
+        (const protocolservice_cert_cache_key*)lhs;
+    const protocolservice_cert_cache_key* r =
+        (const protocolservice_cert_cache_key*)rhs;
+    int cmp;
+
+    /* first, compare the record types. */
+    if (l->type < r->type)
+    {
+        return RCPR_COMPARE_LT;
+    }
+    else if (l->type > r->type)
+    {
+        return RCPR_COMPARE_GT;
+    }
+
+    /* then, compare the ids. */
+    cmp = memcmp(&l->id, &r->id, sizeof(l->id));
+    if (cmp < 0)
+    {
+        return RCPR_COMPARE_LT;
+    }
+    else if (cmp > 0)
+    {
+        return RCPR_COMPARE_GT;
+    }
+    else
+    {
+        return RCPR_COMPARE_EQ;
+    }
+}
@@ -0,0 +1,27 @@
+/**
+ * \file protocolservice/protocolservice_cert_cache_entry_key.c
+ *
+ * \brief Get the key for a certificate cache entry.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "protocolservice_internal.h"
+
+/**
+ * \brief Given a \ref protocolservice_cert_cache_entry resource handle, return
+ * its \ref protocolservice_cert_cache_key key.
+ *
+ * \param context       Unused.
+ * \param r             The resource handle of a certificate cache entry.
+ *
+ * \returns the key for the certificate cache entry.
+ */
+const void* protocolservice_cert_cache_entry_key(
+    void* /*context*/, const RCPR_SYM(resource)* r)
+{
+    protocolservice_cert_cache_entry* entry =
+        (protocolservice_cert_cache_entry*)r;
+
+    return &entry->key;
+}
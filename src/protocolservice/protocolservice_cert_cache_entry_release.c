@@ -0,0 +1,42 @@
+/**
+ * \file protocolservice/protocolservice_cert_cache_entry_release.c
+ *
+ * \brief Release a certificate cache entry.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+
+#include "protocolservice_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+
+/**
+ * \brief Release a certificate cache entry.
+ *
+ * \param r             The certificate cache entry resource to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_cert_cache_entry_release(RCPR_SYM(resource)* r)
+{
+    protocolservice_cert_cache_entry* entry =
+        (protocolservice_cert_cache_entry*)r;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != entry);
+
+    /* cache the allocator. */
+    rcpr_allocator* alloc = entry->alloc;
+    size_t size = sizeof(*entry) + entry->cert_size;
+
+    /* clear the entry. */
+    memset(entry, 0, size);
+
+    /* reclaim the entry. */
+    return rcpr_allocator_reclaim(alloc, entry);
+}
@@ -0,0 +1,45 @@
+/**
+ * \file protocolservice/protocolservice_cert_cache_init.c
+ *
+ * \brief Initialize a certificate cache.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+
+#include "protocolservice_internal.h"
+
+RCPR_IMPORT_rbtree;
+
+/**
+ * \brief Initialize a certificate cache.
+ *
+ * \param cache         The certificate cache to initialize.
+ * \param alloc         The allocator to use for this cache.
+ * \param max_size      The maximum number of bytes held by this cache.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_cert_cache_init(
+    protocolservice_cert_cache* cache, RCPR_SYM(allocator)* alloc,
+    size_t max_size)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != cache);
+    MODEL_ASSERT(prop_allocator_valid(alloc));
+
+    /* clear the cache. */
+    memset(cache, 0, sizeof(*cache));
+    cache->alloc = alloc;
+    cache->max_size = max_size;
+
+    /* create the entry tree. */
+    return
+        rbtree_create(
+            &cache->entries, alloc, &protocolservice_cert_cache_entry_compare,
+            &protocolservice_cert_cache_entry_key, NULL);
+}
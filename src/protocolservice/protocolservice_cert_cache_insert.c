@@ -0,0 +1,208 @@
+/**
+ * \file protocolservice/protocolservice_cert_cache_insert.c
+ *
+ * \brief Insert a record into the certificate cache.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/status_codes.h>
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vccrypt/compare.h>
+
+#include "protocolservice_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+RCPR_IMPORT_rbtree;
+RCPR_IMPORT_resource;
+
+/* forward decls. */
+static status protocolservice_cert_cache_remove(
+    protocolservice_cert_cache* cache,
+    protocolservice_cert_cache_entry* entry);
+
+static const uint8_t ff_uuid[16] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+/**
+ * \brief Insert a canonized block or transaction into the certificate cache.
+ *
+ * Records without a successor are skipped, as their next link can still
+ * change.  The least recently used entries are evicted to make room.
+ *
+ * \param cache         The certificate cache.
+ * \param type          The type of record to insert.
+ * \param node          The block or transaction node to insert.
+ * \param cert          The certificate, or NULL if only the node was read.
+ * \param cert_size     The size of the certificate.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_cert_cache_insert(
+    protocolservice_cert_cache* cache, uint32_t type, const void* node,
+    const void* cert, size_t cert_size)
+{
+    status retval;
+    protocolservice_cert_cache_entry* tmp;
+    protocolservice_cert_cache_key key;
+    const uint8_t* node_key;
+    const uint8_t* node_next;
+    size_t node_size, entry_size;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != cache);
+    MODEL_ASSERT(NULL != node);
+    MODEL_ASSERT(NULL != cert || 0U == cert_size);
+
+    /* get the key and next link of this record. */
+    if (PROTOCOLSERVICE_CERT_CACHE_TYPE_BLOCK == type)
+    {
+        node_key = ((const data_block_node_t*)node)->key;
+        node_next = ((const data_block_node_t*)node)->next;
+        node_size = sizeof(data_block_node_t);
+    }
+    else
+    {
+        node_key = ((const data_transaction_node_t*)node)->key;
+        node_next = ((const data_transaction_node_t*)node)->next;
+        node_size = sizeof(data_transaction_node_t);
+    }
+
+    /* the newest record can still gain a successor, so don't cache it. */
+    if (!crypto_memcmp(node_next, ff_uuid, 16))
+    {
+        return STATUS_SUCCESS;
+    }
+
+    /* skip records that would never fit. */
+    entry_size = sizeof(*tmp) + cert_size;
+    if (entry_size > cache->max_size)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    /* build the key. */
+    memset(&key, 0, sizeof(key));
+    key.type = type;
+    memcpy(&key.id, node_key, sizeof(key.id));
+
+    /* check for an existing entry. */
+    retval = rbtree_find((resource**)&tmp, cache->entries, &key);
+    if (STATUS_SUCCESS == retval)
+    {
+        /* keep the existing entry unless this one adds the certificate. */
+        if (0U != tmp->cert_size || 0U == cert_size)
+        {
+            return STATUS_SUCCESS;
+        }
+
+        /* replace the header-only entry. */
+        retval = protocolservice_cert_cache_remove(cache, tmp);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    /* evict least recently used entries until this entry fits. */
+    while (cache->size + entry_size > cache->max_size)
+    {
+        retval = protocolservice_cert_cache_remove(cache, cache->lru_tail);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    /* allocate the entry. */
+    retval = rcpr_allocator_allocate(cache->alloc, (void**)&tmp, entry_size);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* initialize the entry. */
+    memset(tmp, 0, sizeof(*tmp));
+    resource_init(&tmp->hdr, &protocolservice_cert_cache_entry_release);
+    tmp->alloc = cache->alloc;
+    memcpy(&tmp->key, &key, sizeof(key));
+    memcpy(&tmp->node, node, node_size);
+    tmp->cert_size = cert_size;
+    if (cert_size > 0)
+    {
+        memcpy(tmp->cert, cert, cert_size);
+    }
+
+    /* insert the entry into the tree. */
+    retval = rbtree_insert(cache->entries, &tmp->hdr);
+    if (STATUS_SUCCESS != retval)
+    {
+        resource_release(&tmp->hdr);
+        return retval;
+    }
+
+    /* link it at the head of the LRU list. */
+    tmp->lru_next = cache->lru_head;
+    if (NULL != cache->lru_head)
+    {
+        cache->lru_head->lru_prev = tmp;
+    }
+    else
+    {
+        cache->lru_tail = tmp;
+    }
+    cache->lru_head = tmp;
+    cache->size += entry_size;
+
+    /* success. */
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Remove an entry from the certificate cache and release it.
+ *
+ * \param cache         The certificate cache.
+ * \param entry         The entry to remove.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status protocolservice_cert_cache_remove(
+    protocolservice_cert_cache* cache,
+    protocolservice_cert_cache_entry* entry)
+{
+    protocolservice_cert_cache_key key;
+
+    /* unlink the entry from the LRU list. */
+    if (NULL != entry->lru_prev)
+    {
+        entry->lru_prev->lru_next = entry->lru_next;
+    }
+    else
+    {
+        cache->lru_head = entry->lru_next;
+    }
+
+    if (NULL != entry->lru_next)
+    {
+        entry->lru_next->lru_prev = entry->lru_prev;
+    }
+    else
+    {
+        cache->lru_tail = entry->lru_prev;
+    }
+
+    cache->size -= sizeof(*entry) + entry->cert_size;
+
+    /* copy the key, as deleting the entry releases it. */
+    memcpy(&key, &entry->key, sizeof(key));
+
+    /* delete and release the entry. */
+    return rbtree_delete(NULL, cache->entries, &key);
+}
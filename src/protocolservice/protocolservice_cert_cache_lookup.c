@@ -0,0 +1,87 @@
+/**
+ * \file protocolservice/protocolservice_cert_cache_lookup.c
+ *
+ * \brief Look up an entry in the certificate cache.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/status_codes.h>
+#include <cbmc/model_assert.h>
+#include <string.h>
+
+#include "protocolservice_internal.h"
+
+RCPR_IMPORT_rbtree;
+RCPR_IMPORT_resource;
+RCPR_IMPORT_uuid;
+
+/**
+ * \brief Look up an entry in the certificate cache.
+ *
+ * On a hit, the entry becomes the most recently used entry.  The entry is
+ * owned by the cache and is only valid until the next insert.
+ *
+ * \param entry         Pointer to receive the entry on success.
+ * \param cache         The certificate cache.
+ * \param type          The type of record to look up.
+ * \param id            The block or transaction id to look up.
+ * \param cert_needed   Set to true if a header-only entry is a miss.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on a cache hit.
+ *      - AGENTD_ERROR_DATASERVICE_NOT_FOUND on a cache miss.
+ */
+status protocolservice_cert_cache_lookup(
+    protocolservice_cert_cache_entry** entry,
+    protocolservice_cert_cache* cache, uint32_t type, const rcpr_uuid* id,
+    bool cert_needed)
+{
+    status retval;
+    protocolservice_cert_cache_key key;
+    protocolservice_cert_cache_entry* tmp;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != entry);
+    MODEL_ASSERT(NULL != cache);
+    MODEL_ASSERT(NULL != id);
+
+    /* build the key. */
+    memset(&key, 0, sizeof(key));
+    key.type = type;
+    memcpy(&key.id, id, sizeof(key.id));
+
+    /* look up the entry. */
+    retval = rbtree_find((resource**)&tmp, cache->entries, &key);
+    if (STATUS_SUCCESS != retval || (cert_needed && 0U == tmp->cert_size))
+    {
+        cache->misses += 1;
+        return AGENTD_ERROR_DATASERVICE_NOT_FOUND;
+    }
+
+    /* move this entry to the head of the LRU list. */
+    if (cache->lru_head != tmp)
+    {
+        /* unlink the entry. */
+        tmp->lru_prev->lru_next = tmp->lru_next;
+        if (NULL != tmp->lru_next)
+        {
+            tmp->lru_next->lru_prev = tmp->lru_prev;
+        }
+        else
+        {
+            cache->lru_tail = tmp->lru_prev;
+        }
+
+        /* link it at the head. */
+        tmp->lru_prev = NULL;
+        tmp->lru_next = cache->lru_head;
+        cache->lru_head->lru_prev = tmp;
+        cache->lru_head = tmp;
+    }
+
+    /* success. */
+    cache->hits += 1;
+    *entry = tmp;
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,97 @@
+/**
+ * \file protocolservice/protocolservice_cert_cache_send_response.c
+ *
+ * \brief Answer a block or transaction read from the certificate cache.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/status_codes.h>
+#include <cbmc/model_assert.h>
+
+#include "protocolservice_internal.h"
+
+RCPR_IMPORT_uuid;
+
+/**
+ * \brief Answer a block or transaction read from the certificate cache.
+ *
+ * \param ctx               The protocol service protocol fiber context.
+ * \param request_id        The protocol request id.
+ * \param request_offset    The protocol request offset.
+ * \param type              The type of record requested.
+ * \param id                The block or transaction id requested.
+ * \param cert_needed       Set to true if the response carries the cert.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS if the response was sent from the cache.
+ *      - AGENTD_ERROR_DATASERVICE_NOT_FOUND if the caller must ask the
+ *        dataservice.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_cert_cache_send_response(
+    protocolservice_protocol_fiber_context* ctx, uint32_t request_id,
+    uint32_t request_offset, uint32_t type, const rcpr_uuid* id,
+    bool cert_needed)
+{
+    status retval;
+    protocolservice_cert_cache_entry* entry;
+    vccrypt_buffer_t respbuf;
+    const rcpr_uuid* capability;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_protocolservice_protocol_fiber_context_valid(ctx));
+    MODEL_ASSERT(NULL != id);
+
+    /* the dataservice enforces this capability for uncached requests. */
+    capability =
+        (PROTOCOLSERVICE_CERT_CACHE_TYPE_BLOCK == type)
+            ? &PROTOCOLSERVICE_API_CAPABILITY_BLOCK_READ
+            : &PROTOCOLSERVICE_API_CAPABILITY_TRANSACTION_READ;
+    if (!protocolservice_authorized_entity_capability_check(
+            ctx->entity, &ctx->entity_uuid, capability,
+            &ctx->ctx->agentd_uuid))
+    {
+        return AGENTD_ERROR_DATASERVICE_NOT_FOUND;
+    }
+
+    /* look up the record. */
+    retval =
+        protocolservice_cert_cache_lookup(
+            &entry, &ctx->ctx->cert_cache, type, id, cert_needed);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* encode the response. */
+    if (PROTOCOLSERVICE_CERT_CACHE_TYPE_BLOCK == type)
+    {
+        retval =
+            protocolservice_encode_block_response(
+                &respbuf, ctx, request_id, request_offset, &entry->node.block,
+                entry->cert, entry->cert_size);
+    }
+    else
+    {
+        retval =
+            protocolservice_encode_transaction_response(
+                &respbuf, ctx, request_id, request_offset,
+                &entry->node.transaction, entry->cert, entry->cert_size);
+    }
+
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* send the response to the protocol write endpoint. */
+    retval =
+        protocolservice_protocol_send_local_response(
+            ctx, request_id, request_offset, &respbuf);
+
+    /* clean up. */
+    dispose((disposable_t*)&respbuf);
+
+    return retval;
+}
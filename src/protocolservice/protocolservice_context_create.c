@@ -64,6 +64,7 @@ status protocolservice_context_create(
     tmp->sched = sched;
     tmp->data_endpoint_addr = data_addr;
     tmp->random_endpoint_addr = random_addr;
+    tmp->attestation_wakeup_sock = -1;
 
     /* look up the messaging discipline. */
     retval = message_discipline_get_or_create(&tmp->msgdisc, alloc, sched);
@@ -94,6 +95,15 @@ status protocolservice_context_create(
         goto cleanup_context;
     }
 
+    /* create the certificate cache. */
+    retval =
+        protocolservice_cert_cache_init(
+            &tmp->cert_cache, alloc, PROTOCOLSERVICE_CERT_CACHE_MAX_SIZE);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_context;
+    }
+
     /* initialize the VPR allocator. */
     malloc_allocator_options_init(&tmp->vpr_alloc);
 
@@ -27,6 +27,8 @@ status protocolservice_context_release(RCPR_SYM(resource)* r)
 {
     status authorized_entity_dict_release_retval = STATUS_SUCCESS;
     status extended_api_dict_release_retval = STATUS_SUCCESS;
+    status reader_addrs_release_retval = STATUS_SUCCESS;
+    status cert_cache_release_retval = STATUS_SUCCESS;
     status context_release_retval = STATUS_SUCCESS;
     protocolservice_context* ctx = (protocolservice_context*)r;
 
@@ -76,6 +78,17 @@ status protocolservice_context_release(RCPR_SYM(resource)* r)
                 rbtree_resource_handle(ctx->extended_api_dict));
     }
 
+    /* release the reader endpoint addresses if initialized. */
+    if (NULL != ctx->data_reader_endpoint_addrs)
+    {
+        reader_addrs_release_retval =
+            rcpr_allocator_reclaim(alloc, ctx->data_reader_endpoint_addrs);
+    }
+
+    /* dispose the certificate cache. */
+    cert_cache_release_retval =
+        protocolservice_cert_cache_dispose(&ctx->cert_cache);
+
     /* release the context memory. */
     context_release_retval = rcpr_allocator_reclaim(alloc, ctx);
 
@@ -88,6 +101,14 @@ status protocolservice_context_release(RCPR_SYM(resource)* r)
     {
         return extended_api_dict_release_retval;
     }
+    else if (STATUS_SUCCESS != reader_addrs_release_retval)
+    {
+        return reader_addrs_release_retval;
+    }
+    else if (STATUS_SUCCESS != cert_cache_release_retval)
+    {
+        return cert_cache_release_retval;
+    }
     else
     {
         return context_release_retval;
@@ -21,7 +21,10 @@ RCPR_IMPORT_rbtree;
 RCPR_IMPORT_resource;
 
 /**
- * \brief Create and add the protocol service data service endpoint fiber.
+ * \brief Create and add the protocol service data service endpoint fibers.
+ *
+ * Two fibers share the endpoint context: the endpoint fiber, which writes
+ * requests to the dataservice, and the read fiber, which routes responses.
  *
  * \param ctx           Pointer to the saved context. NOTE THAT THIS IS OWNED
  *                      BY THE DATASERVICE ENDPOINT.
@@ -44,6 +47,7 @@ status protocolservice_dataservice_endpoint_add(
     status retval, release_retval;
     protocolservice_dataservice_endpoint_context* tmp = NULL;
     fiber* endpoint_fiber = NULL;
+    fiber* read_endpoint_fiber = NULL;
     psock* inner = NULL;
 
     /* parameter sanity checks. */
@@ -70,6 +74,9 @@ status protocolservice_dataservice_endpoint_add(
     tmp->alloc = alloc;
     tmp->addr = 0;
 
+    /* set the reference count to start at 1. */
+    tmp->reference_count = 1;
+
     /* Initialize a VPR allocator for this instance. */
     malloc_allocator_options_init(&tmp->vpr_alloc);
 
@@ -161,17 +168,66 @@ status protocolservice_dataservice_endpoint_add(
         goto cleanup_endpoint_fiber;
     }
 
-    /* give the caller a weak reference to the context. */
-    *ctx = tmp;
     /* the endpoint fiber is now owned by the scheduler. */
     endpoint_fiber = NULL;
-    /* the context is now owned by the endpoint fiber. */
+
+    /* create the dataservice endpoint read fiber. */
+    retval =
+        fiber_create(
+            &read_endpoint_fiber, alloc, sched,
+            DATASERVICE_ENDPOINT_STACK_SIZE, tmp,
+            &protocolservice_dataservice_endpoint_read_fiber_entry);
+    if (STATUS_SUCCESS != retval)
+    {
+        /* the context is owned by the endpoint fiber. */
+        goto done;
+    }
+
+    /* increment the reference count on the context to denote the read fiber's
+     * ownership. */
+    tmp->reference_count += 1;
+
+    /* save the read fiber. */
+    tmp->read_fib = read_endpoint_fiber;
+
+    /* set the unexpected handler for the read fiber. */
+    retval =
+        fiber_unexpected_event_callback_add(
+            read_endpoint_fiber, &protocolservice_fiber_unexpected_handler,
+            NULL);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_read_endpoint_fiber;
+    }
+
+    /* add the read fiber to the scheduler. */
+    retval = fiber_scheduler_add(sched, read_endpoint_fiber);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_read_endpoint_fiber;
+    }
+
+    /* give the caller a weak reference to the context. */
+    *ctx = tmp;
+    /* the read fiber is now owned by the scheduler. */
+    read_endpoint_fiber = NULL;
+    /* the context is now owned by both endpoint fibers. */
     tmp = NULL;
 
     /* success. */
     retval = STATUS_SUCCESS;
     goto done;
 
+cleanup_read_endpoint_fiber:
+    release_retval =
+        resource_release(fiber_resource_handle(read_endpoint_fiber));
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+    read_endpoint_fiber = NULL;
+    goto cleanup_context;
+
 cleanup_inner_psock:
     if (NULL != inner)
     {
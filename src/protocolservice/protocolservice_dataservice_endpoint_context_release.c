@@ -33,6 +33,7 @@ status protocolservice_dataservice_endpoint_context_release(
     status datasock_release_retval = STATUS_SUCCESS;
     status mailbox_context_tree_release_retval = STATUS_SUCCESS;
     status context_mailbox_tree_release_retval = STATUS_SUCCESS;
+    status pending_open_release_retval = STATUS_SUCCESS;
     status reclaim_retval = STATUS_SUCCESS;
     protocolservice_dataservice_endpoint_context* ctx =
         (protocolservice_dataservice_endpoint_context*)r;
@@ -40,9 +41,22 @@ status protocolservice_dataservice_endpoint_context_release(
     /* parameter sanity checks. */
     MODEL_ASSERT(prop_protocolservice_dataservice_endpoint_context_valid(ctx));
 
+    /* decrement the reference count. */
+    ctx->reference_count -= 1;
+
+    /* if the reference count is greater than zero, then don't release. */
+    if (ctx->reference_count > 0)
+    {
+        return STATUS_SUCCESS;
+    }
+
     /* cache the allocator. */
     rcpr_allocator* alloc = ctx->alloc;
 
+    /* release any context opens still awaiting a response. */
+    pending_open_release_retval =
+        protocolservice_dataservice_pending_queue_clear(&ctx->pending_open);
+
     /* release the VPR allocator. */
     dispose((disposable_t*)&ctx->vpr_alloc);
 
@@ -93,6 +107,10 @@ status protocolservice_dataservice_endpoint_context_release(
     {
         return context_mailbox_tree_release_retval;
     }
+    else if (STATUS_SUCCESS != pending_open_release_retval)
+    {
+        return pending_open_release_retval;
+    }
     else
     {
         return reclaim_retval;
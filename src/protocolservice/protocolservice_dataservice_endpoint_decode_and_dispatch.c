@@ -21,7 +21,9 @@
  * \param return_address    The return mailbox address, needed for looking up
  *                          the request context.
  * \param reply_payload     Pointer to the pointer to receive the reply payload
- *                          for this request.
+ *                          for this request. This is set to NULL if the reply
+ *                          is sent by the endpoint read fiber once the
+ *                          dataservice responds.
  *
  * \returns a status code indicating success or failure.
  *      - STATUS_SUCCESS on success.
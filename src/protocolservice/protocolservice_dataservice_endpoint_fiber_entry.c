@@ -19,7 +19,9 @@ RCPR_IMPORT_resource;
  * \brief Entry point for the protocol service dataservice endpoint fiber.
  *
  * This fiber manages communication with the dataservice instance assigned to
- * the protocol service.
+ * the protocol service. It writes requests to the dataservice without waiting
+ * for their responses, which are routed by the endpoint read fiber. This
+ * allows many requests to be in flight on the dataservice socket at once.
  *
  * \param vctx          The type erased context for this endpoint fiber.
  *
@@ -59,9 +61,10 @@ status protocolservice_dataservice_endpoint_fiber_entry(void* vctx)
         /* get the return address. */
         return_address = message_return_address(req_msg);
 
-        /* decode and dispatch this request, returning a reply. */
-        /* TODO - decouple request and reply by adding reference IDs to
-         * dataservice API. */
+        /* decode and dispatch this request. Replies to requests forwarded
+         * to the dataservice are sent by the read fiber. */
+        reply_payload = NULL;
+        reply_msg = NULL;
         retval =
             protocolservice_dataservice_endpoint_decode_and_dispatch(
                 ctx, req_payload, return_address, &reply_payload);
@@ -70,30 +73,34 @@ status protocolservice_dataservice_endpoint_fiber_entry(void* vctx)
             goto cleanup_req_msg;
         }
 
-        /* create a response message. */
-        retval =
-            message_create(
-                &reply_msg, ctx->alloc, ctx->addr, &reply_payload->hdr);
-        if (STATUS_SUCCESS != retval)
+        /* if this request was answered immediately, send the reply. */
+        if (NULL != reply_payload)
         {
-            goto cleanup_reply_payload;
+            /* create a response message. */
+            retval =
+                message_create(
+                    &reply_msg, ctx->alloc, ctx->addr, &reply_payload->hdr);
+            if (STATUS_SUCCESS != retval)
+            {
+                goto cleanup_reply_payload;
+            }
+
+            /* the payload is now owned by the message. */
+            reply_payload = NULL;
+
+            /* send the response message. */
+            retval =
+                message_send(
+                    return_address, reply_msg, ctx->msgdisc);
+            if (STATUS_SUCCESS != retval)
+            {
+                goto cleanup_reply_msg;
+            }
+
+            /* the reply message is nown owned by the message discipline. */
+            reply_msg = NULL;
         }
 
-        /* the payload is now owned by the message. */
-        reply_payload = NULL;
-
-        /* send the response message. */
-        retval =
-            message_send(
-                return_address, reply_msg, ctx->msgdisc);
-        if (STATUS_SUCCESS != retval)
-        {
-            goto cleanup_reply_msg;
-        }
-
-        /* the reply message is nown owned by the message discipline. */
-        reply_msg = NULL;
-
         /* clean up the request message. */
         retval = resource_release(message_resource_handle(req_msg));
         if (STATUS_SUCCESS != retval)
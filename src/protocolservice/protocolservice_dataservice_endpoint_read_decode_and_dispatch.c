@@ -0,0 +1,125 @@
+/**
+ * \file
+ * protocolservice/protocolservice_dataservice_endpoint_read_decode_and_dispatch.c
+ *
+ * \brief Decode and dispatch a response read from the dataservice socket.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/dataservice/api.h>
+#include <agentd/status_codes.h>
+#include <cbmc/model_assert.h>
+#include <string.h>
+
+#include "protocolservice_internal.h"
+
+RCPR_IMPORT_rbtree;
+RCPR_IMPORT_resource;
+
+/**
+ * \brief Decode and dispatch a response read from the dataservice socket.
+ *
+ * Every dataservice response starts with the method id, the child context
+ * offset, and the status code. The child context offset is used to find the
+ * mailbox context entry, and the oldest pending request for that entry is the
+ * request that this response answers. If a matched response can't be
+ * delivered, the requesting fiber is sent an error reply instead.
+ *
+ * \param ctx               The endpoint context.
+ * \param resp              The response data.
+ * \param resp_size         The size of the response data.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_dataservice_endpoint_read_decode_and_dispatch(
+    protocolservice_dataservice_endpoint_context* ctx, const void* resp,
+    size_t resp_size)
+{
+    status retval, release_retval;
+    uint32_t method, offset;
+    protocolservice_dataservice_mailbox_context_entry* entry;
+    protocolservice_dataservice_pending_request* pending;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_protocolservice_dataservice_endpoint_context_valid(ctx));
+    MODEL_ASSERT(NULL != resp);
+
+    /* the response must at least hold the method, offset, and status. */
+    if (resp_size < 3 * sizeof(uint32_t))
+    {
+        retval = AGENTD_ERROR_PROTOCOLSERVICE_MALFORMED_RESPONSE;
+        goto done;
+    }
+
+    /* decode the method and offset. */
+    const uint8_t* bresp = (const uint8_t*)resp;
+    memcpy(&method, bresp, sizeof(method));
+    memcpy(&offset, bresp + sizeof(method), sizeof(offset));
+    method = ntohl(method);
+    offset = ntohl(offset);
+
+    /* child context create responses are matched in request order. */
+    if (DATASERVICE_API_METHOD_LL_CHILD_CONTEXT_CREATE == method)
+    {
+        retval = pde_decode_and_dispatch_resp_context_open(ctx, resp, resp_size);
+        goto done;
+    }
+
+    /* look up the mailbox context entry for this child context. */
+    retval =
+        rbtree_find((resource**)&entry, ctx->context_mailbox_tree, &offset);
+    if (STATUS_SUCCESS != retval)
+    {
+        retval = AGENTD_ERROR_PROTOCOLSERVICE_DATASERVICE_UNEXPECTED_RESPONSE;
+        goto done;
+    }
+
+    /* get the oldest pending request for this child context. */
+    pending = protocolservice_dataservice_pending_queue_pop(&entry->pending);
+    if (NULL == pending)
+    {
+        retval = AGENTD_ERROR_PROTOCOLSERVICE_DATASERVICE_UNEXPECTED_RESPONSE;
+        goto done;
+    }
+
+    /* dispatch the response based on the pending request type. */
+    if (PROTOCOLSERVICE_DATASERVICE_ENDPOINT_REQ_CONTEXT_CLOSE
+            == pending->request_id)
+    {
+        retval =
+            pde_decode_and_dispatch_resp_context_close(
+                ctx, entry, pending, resp, resp_size);
+    }
+    else
+    {
+        retval =
+            pde_decode_and_dispatch_resp_dataservice_req(
+                ctx, pending, resp, resp_size);
+
+        /* if the response could not be delivered, answer with an error so
+         * that the requesting fiber releases its request window slot. */
+        if (STATUS_SUCCESS != retval)
+        {
+            release_retval =
+                protocolservice_dataservice_endpoint_send_error(
+                    ctx, pending, retval);
+            if (STATUS_SUCCESS != release_retval)
+            {
+                retval = release_retval;
+            }
+        }
+    }
+
+    /* release the pending request. */
+    release_retval = resource_release(&pending->hdr);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+done:
+    return retval;
+}
@@ -0,0 +1,83 @@
+/**
+ * \file
+ * protocolservice/protocolservice_dataservice_endpoint_read_fiber_entry.c
+ *
+ * \brief Entry point for the data service read fiber.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+
+#include "protocolservice_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+RCPR_IMPORT_psock;
+RCPR_IMPORT_resource;
+
+/**
+ * \brief Entry point for the protocol service dataservice endpoint read fiber.
+ *
+ * This fiber reads responses from the dataservice instance assigned to the
+ * protocol service and routes each response to the mailbox that made the
+ * matching request.  A response that matches a pending request but can't be
+ * delivered is answered with an error reply.  A response that matches no
+ * pending request has no one to answer, so it is dropped.  This fiber only
+ * exits if the dataservice socket fails.
+ *
+ * \param vctx          The type erased context for this endpoint fiber.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_dataservice_endpoint_read_fiber_entry(void* vctx)
+{
+    status retval, release_retval;
+    void* resp_data = NULL;
+    size_t resp_data_size;
+    protocolservice_dataservice_endpoint_context* ctx =
+        (protocolservice_dataservice_endpoint_context*)vctx;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_protocolservice_dataservice_endpoint_context_valid(ctx));
+
+    /* read loop for the data service endpoint. */
+    for (;;)
+    {
+        /* read a response from the dataservice socket. */
+        retval =
+            psock_read_boxed_data(
+                ctx->datasock, ctx->alloc, &resp_data, &resp_data_size);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_context;
+        }
+
+        /* route this response to the requesting mailbox.  Routing failures
+         * have already been answered with an error reply where a requester
+         * exists, and this fiber is the only reader of the dataservice
+         * socket, so the status is not fatal here. */
+        (void)protocolservice_dataservice_endpoint_read_decode_and_dispatch(
+            ctx, resp_data, resp_data_size);
+
+        /* clean up the response data. */
+        memset(resp_data, 0, resp_data_size);
+        retval = rcpr_allocator_reclaim(ctx->alloc, resp_data);
+        resp_data = NULL;
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_context;
+        }
+    }
+
+cleanup_context:
+    release_retval = resource_release(&ctx->hdr);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
@@ -0,0 +1,58 @@
+/**
+ * \file protocolservice/protocolservice_dataservice_endpoint_send_error.c
+ *
+ * \brief Send an error reply from the dataservice endpoint.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <arpa/inet.h>
+#include <cbmc/model_assert.h>
+
+#include "protocolservice_internal.h"
+
+/**
+ * \brief Send an error reply for a pending request that could not be
+ * completed.
+ *
+ * Every pending request is answered exactly once, so that the requesting fiber
+ * is not left blocked and its request window slot is released.
+ *
+ * \param ctx               The endpoint context.
+ * \param pending           The pending request to answer.
+ * \param status_           The error status to report.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_dataservice_endpoint_send_error(
+    protocolservice_dataservice_endpoint_context* ctx,
+    protocolservice_dataservice_pending_request* pending, int status_)
+{
+    status retval;
+    protocolservice_protocol_write_endpoint_message* reply_payload;
+    uint32_t net_status = htonl((uint32_t)status_);
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_protocolservice_dataservice_endpoint_context_valid(ctx));
+    MODEL_ASSERT(
+        prop_protocolservice_dataservice_pending_request_valid(pending));
+
+    /* create the error reply, carrying the status code. */
+    retval =
+        protocolservice_protocol_write_endpoint_message_create(
+            &reply_payload, ctx->ctx,
+            PROTOCOLSERVICE_PROTOCOL_WRITE_ENDPOINT_ERROR_MESSAGE,
+            pending->protocol_request_id, pending->offset, &net_status,
+            sizeof(net_status));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* send the error reply to the requesting fiber. */
+    return
+        protocolservice_dataservice_endpoint_send_reply(
+            ctx, pending->return_address, reply_payload);
+}
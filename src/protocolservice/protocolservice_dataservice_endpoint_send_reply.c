@@ -0,0 +1,80 @@
+/**
+ * \file protocolservice/protocolservice_dataservice_endpoint_send_reply.c
+ *
+ * \brief Send a reply from the dataservice endpoint.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+
+#include "protocolservice_internal.h"
+
+RCPR_IMPORT_message;
+RCPR_IMPORT_resource;
+
+/**
+ * \brief Send a reply payload from the dataservice endpoint to the given
+ * mailbox.
+ *
+ * \param ctx               The endpoint context.
+ * \param return_address    The mailbox address to which the reply is sent.
+ * \param reply_payload     The reply payload to send. On success, ownership of
+ *                          this payload is transferred to the message
+ *                          discipline.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_dataservice_endpoint_send_reply(
+    protocolservice_dataservice_endpoint_context* ctx,
+    RCPR_SYM(mailbox_address) return_address,
+    protocolservice_protocol_write_endpoint_message* reply_payload)
+{
+    status retval, release_retval;
+    message* reply_msg = NULL;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_protocolservice_dataservice_endpoint_context_valid(ctx));
+    MODEL_ASSERT(return_address > 0);
+    MODEL_ASSERT(NULL != reply_payload);
+
+    /* create a response message. */
+    retval =
+        message_create(&reply_msg, ctx->alloc, ctx->addr, &reply_payload->hdr);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_reply_payload;
+    }
+
+    /* send the response message. */
+    retval = message_send(return_address, reply_msg, ctx->msgdisc);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_reply_msg;
+    }
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    goto done;
+
+cleanup_reply_msg:
+    /* releasing the message also releases the payload. */
+    release_retval = resource_release(message_resource_handle(reply_msg));
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+    goto done;
+
+cleanup_reply_payload:
+    release_retval = resource_release(&reply_payload->hdr);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+done:
+    return retval;
+}
@@ -26,6 +26,7 @@ RCPR_IMPORT_allocator_as(rcpr);
 status protocolservice_dataservice_mailbox_context_release(
     RCPR_SYM(resource)* r)
 {
+    status pending_release_retval, reclaim_retval;
     protocolservice_dataservice_mailbox_context_entry* entry =
         (protocolservice_dataservice_mailbox_context_entry*)r;
 
@@ -45,7 +46,20 @@ status protocolservice_dataservice_mailbox_context_release(
     /* cache allocator. */
     rcpr_allocator* alloc = entry->alloc;
 
+    /* release any requests still awaiting a response. */
+    pending_release_retval =
+        protocolservice_dataservice_pending_queue_clear(&entry->pending);
+
     /* reclaim memory. */
-    return
-        rcpr_allocator_reclaim(alloc, entry);
+    reclaim_retval = rcpr_allocator_reclaim(alloc, entry);
+
+    /* decode the return value. */
+    if (STATUS_SUCCESS != pending_release_retval)
+    {
+        return pending_release_retval;
+    }
+    else
+    {
+        return reclaim_retval;
+    }
 }
@@ -89,6 +89,10 @@ status protocolservice_dataservice_map_user_capabilities(
     {
         BITCAP_SET_TRUE(
             dataservice_caps, DATASERVICE_API_CAP_APP_BLOCK_READ);
+        BITCAP_SET_TRUE(
+            dataservice_caps, DATASERVICE_API_CAP_APP_BLOCK_ID_NEXT_READ);
+        BITCAP_SET_TRUE(
+            dataservice_caps, DATASERVICE_API_CAP_APP_BLOCK_ID_PREV_READ);
     }
 
     /* check block id by height read cap. */
@@ -109,6 +113,9 @@ status protocolservice_dataservice_map_user_capabilities(
     {
         BITCAP_SET_TRUE(
             dataservice_caps, DATASERVICE_API_CAP_APP_TRANSACTION_READ);
+        BITCAP_SET_TRUE(
+            dataservice_caps,
+            DATASERVICE_API_CAP_APP_BLOCK_ID_WITH_TRANSACTION_READ);
     }
 
     /* check artifact read cap. */
@@ -0,0 +1,47 @@
+/**
+ * \file
+ * protocolservice/protocolservice_dataservice_pending_queue_clear.c
+ *
+ * \brief Release all pending requests in a pending queue.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+
+#include "protocolservice_internal.h"
+
+RCPR_IMPORT_resource;
+
+/**
+ * \brief Release all pending requests in a pending queue.
+ *
+ * \param queue         The queue to clear.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_dataservice_pending_queue_clear(
+    protocolservice_dataservice_pending_queue* queue)
+{
+    status retval = STATUS_SUCCESS;
+    status release_retval;
+    protocolservice_dataservice_pending_request* pending;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != queue);
+
+    /* release each pending request. */
+    while (NULL != (pending = protocolservice_dataservice_pending_queue_pop(
+                                queue)))
+    {
+        release_retval = resource_release(&pending->hdr);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+    return retval;
+}
@@ -0,0 +1,48 @@
+/**
+ * \file
+ * protocolservice/protocolservice_dataservice_pending_queue_pop.c
+ *
+ * \brief Remove the pending request at the head of a pending queue.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+
+#include "protocolservice_internal.h"
+
+/**
+ * \brief Remove the pending request at the head of a pending queue.
+ *
+ * \param queue         The queue from which the request is removed.
+ *
+ * \returns the pending request, now owned by the caller, or NULL if the queue
+ * is empty.
+ */
+protocolservice_dataservice_pending_request*
+protocolservice_dataservice_pending_queue_pop(
+    protocolservice_dataservice_pending_queue* queue)
+{
+    protocolservice_dataservice_pending_request* pending;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != queue);
+
+    /* get the head of the queue. */
+    pending = queue->head;
+    if (NULL == pending)
+    {
+        return NULL;
+    }
+
+    /* unlink the head. */
+    queue->head = pending->next;
+    if (NULL == queue->head)
+    {
+        queue->tail = NULL;
+    }
+
+    pending->next = NULL;
+
+    return pending;
+}
@@ -0,0 +1,44 @@
+/**
+ * \file
+ * protocolservice/protocolservice_dataservice_pending_queue_push.c
+ *
+ * \brief Append a pending request to a pending queue.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+
+#include "protocolservice_internal.h"
+
+/**
+ * \brief Append a pending request to the tail of a pending queue.
+ *
+ * \param queue         The queue to which the request is appended.
+ * \param pending       The pending request, which is owned by the queue after
+ *                      this call.
+ */
+void protocolservice_dataservice_pending_queue_push(
+    protocolservice_dataservice_pending_queue* queue,
+    protocolservice_dataservice_pending_request* pending)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != queue);
+    MODEL_ASSERT(
+        prop_protocolservice_dataservice_pending_request_valid(pending));
+
+    /* this request is the new tail. */
+    pending->next = NULL;
+
+    /* link it into the queue. */
+    if (NULL == queue->tail)
+    {
+        queue->head = pending;
+    }
+    else
+    {
+        queue->tail->next = pending;
+    }
+
+    queue->tail = pending;
+}
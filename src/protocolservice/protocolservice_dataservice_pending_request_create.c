@@ -0,0 +1,78 @@
+/**
+ * \file
+ * protocolservice/protocolservice_dataservice_pending_request_create.c
+ *
+ * \brief Create a pending dataservice request record.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+
+#include "protocolservice_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+RCPR_IMPORT_resource;
+
+/**
+ * \brief Create a pending dataservice request record.
+ *
+ * \param pending           Pointer to receive the pending request on success.
+ * \param ctx               The endpoint context.
+ * \param req_payload       The request payload being written to the
+ *                          dataservice.
+ * \param return_address    The mailbox address to which the response should be
+ *                          routed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_dataservice_pending_request_create(
+    protocolservice_dataservice_pending_request** pending,
+    protocolservice_dataservice_endpoint_context* ctx,
+    const protocolservice_dataservice_request_message* req_payload,
+    RCPR_SYM(mailbox_address) return_address)
+{
+    status retval;
+    protocolservice_dataservice_pending_request* tmp = NULL;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != pending);
+    MODEL_ASSERT(prop_protocolservice_dataservice_endpoint_context_valid(ctx));
+    MODEL_ASSERT(
+        prop_protocolservice_dataservice_request_message_valid(req_payload));
+    MODEL_ASSERT(return_address > 0);
+
+    /* allocate memory for the pending request. */
+    retval = rcpr_allocator_allocate(ctx->alloc, (void**)&tmp, sizeof(*tmp));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* clear memory. */
+    memset(tmp, 0, sizeof(*tmp));
+
+    /* initialize resource. */
+    resource_init(
+        &tmp->hdr, &protocolservice_dataservice_pending_request_release);
+
+    /* set the pending request values. */
+    tmp->alloc = ctx->alloc;
+    tmp->request_id = req_payload->request_id;
+    tmp->protocol_request_id = req_payload->protocol_request_id;
+    tmp->offset = req_payload->offset;
+    tmp->return_address = return_address;
+
+    /* return this pending request to the caller. */
+    *pending = tmp;
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    goto done;
+
+done:
+    return retval;
+}
@@ -0,0 +1,63 @@
+/**
+ * \file
+ * protocolservice/protocolservice_dataservice_pending_request_release.c
+ *
+ * \brief Release a pending dataservice request record.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+
+#include "protocolservice_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+RCPR_IMPORT_resource;
+
+/**
+ * \brief Release a pending dataservice request record.
+ *
+ * \param r             The resource to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_dataservice_pending_request_release(
+    RCPR_SYM(resource)* r)
+{
+    status entry_release_retval = STATUS_SUCCESS;
+    status reclaim_retval;
+    protocolservice_dataservice_pending_request* pending =
+        (protocolservice_dataservice_pending_request*)r;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(
+        prop_protocolservice_dataservice_pending_request_valid(pending));
+
+    /* cache the allocator. */
+    rcpr_allocator* alloc = pending->alloc;
+
+    /* release the mailbox context entry of an incomplete open, if owned. */
+    if (NULL != pending->entry)
+    {
+        entry_release_retval = resource_release(&pending->entry->hdr);
+    }
+
+    /* clear the struct. */
+    memset(pending, 0, sizeof(*pending));
+
+    /* reclaim memory. */
+    reclaim_retval = rcpr_allocator_reclaim(alloc, pending);
+
+    /* decode the return value. */
+    if (STATUS_SUCCESS != entry_release_retval)
+    {
+        return entry_release_retval;
+    }
+    else
+    {
+        return reclaim_retval;
+    }
+}
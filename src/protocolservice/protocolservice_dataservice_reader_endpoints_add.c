@@ -0,0 +1,136 @@
+/**
+ * \file protocolservice/protocolservice_dataservice_reader_endpoints_add.c
+ *
+ * \brief Add an endpoint for each read-only data service in the pool.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+
+#include "protocolservice_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+RCPR_IMPORT_message;
+
+/**
+ * \brief Create and add a data service endpoint for each socket in the
+ * read-only data service pool.
+ *
+ * The mailbox addresses for these endpoints are saved in the protocol service
+ * context, which owns them.  If any endpoint can't be added, the endpoints
+ * that were already added are shut down and none of them are routed to.
+ *
+ * \param ctx               The protocol service context.
+ * \param datareaderstart   The first read-only data service socket.
+ * \param datareadercount   The number of read-only data service sockets.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_dataservice_reader_endpoints_add(
+    protocolservice_context* ctx, int datareaderstart, size_t datareadercount)
+{
+    status retval, release_retval;
+    protocolservice_dataservice_endpoint_context** readers = NULL;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_protocolservice_context_valid(ctx));
+    MODEL_ASSERT(NULL == ctx->data_reader_endpoint_addrs);
+
+    /* if there is no reader pool, then there is nothing to do. */
+    if (0 == datareadercount)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    /* allocate memory for the reader endpoint addresses. */
+    retval =
+        rcpr_allocator_allocate(
+            ctx->alloc, (void**)&ctx->data_reader_endpoint_addrs,
+            datareadercount * sizeof(mailbox_address));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* clear the addresses. */
+    memset(
+        ctx->data_reader_endpoint_addrs, 0,
+        datareadercount * sizeof(mailbox_address));
+
+    /* keep track of the reader endpoint contexts in case we must back out. */
+    retval =
+        rcpr_allocator_allocate(
+            ctx->alloc, (void**)&readers,
+            datareadercount * sizeof(*readers));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_addrs;
+    }
+
+    /* add an endpoint for each reader. */
+    for (size_t i = 0; i < datareadercount; ++i)
+    {
+        retval =
+            protocolservice_dataservice_endpoint_add(
+                &readers[i], &ctx->data_reader_endpoint_addrs[i], ctx->alloc,
+                ctx->sched, datareaderstart + (int)i);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto shutdown_readers;
+        }
+
+        /* save the context to the dataservice endpoint context. */
+        readers[i]->ctx = ctx;
+
+        /* this reader can now be routed to. */
+        ++ctx->data_reader_endpoint_count;
+    }
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    goto cleanup_readers;
+
+shutdown_readers:
+    /* close the mailbox of each reader that was added.  Its endpoint fiber
+     * exits as soon as it tries to receive a request. */
+    for (size_t i = 0; i < ctx->data_reader_endpoint_count; ++i)
+    {
+        release_retval = mailbox_close(readers[i]->addr, readers[i]->msgdisc);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+
+        /* the mailbox is already closed. */
+        readers[i]->addr = 0;
+    }
+
+    /* no reader can be routed to. */
+    ctx->data_reader_endpoint_count = 0;
+
+cleanup_readers:
+    release_retval = rcpr_allocator_reclaim(ctx->alloc, readers);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_addrs:
+    /* the addresses are only kept if the readers are routed to. */
+    if (0 == ctx->data_reader_endpoint_count)
+    {
+        release_retval =
+            rcpr_allocator_reclaim(ctx->alloc, ctx->data_reader_endpoint_addrs);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+        ctx->data_reader_endpoint_addrs = NULL;
+    }
+
+    return retval;
+}
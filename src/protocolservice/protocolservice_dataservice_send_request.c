@@ -6,6 +6,10 @@
  * \copyright 2022 Velo Payments, Inc.  All rights reserved.
  */
 
+#include <agentd/dataservice/api.h>
+#include <arpa/inet.h>
+#include <string.h>
+
 #include "protocolservice_internal.h"
 
 RCPR_IMPORT_message;
@@ -14,6 +18,10 @@ RCPR_IMPORT_resource;
 /**
  * \brief Send a message to the dataservice endpoint.
  *
+ * If this connection has a read-only data service context, then read requests
+ * are routed to that reader.  Transaction submissions are always sent to the
+ * writer endpoint.
+ *
  * \note This function takes ownership of the contents of the request buffer on
  * success. These contents are moved to the internal message sent to the
  * endpoint and are no longer available to the caller when ownership is taken.
@@ -32,6 +40,8 @@ status protocolservice_dataservice_send_request(
     uint32_t request_offset, vccrypt_buffer_t* request_buffer)
 {
     status retval, release_retval;
+    uint32_t method = 0U;
+    mailbox_address endpoint_addr;
     message* request = NULL;
     protocolservice_dataservice_request_message* request_payload = NULL;
 
@@ -39,6 +49,24 @@ status protocolservice_dataservice_send_request(
     MODEL_ASSERT(prop_protocolservice_protocol_fiber_context_valid(ctx));
     MODEL_ASSERT(prop_vccrypt_buffer_valid(request_buffer));
 
+    /* get the request method before the buffer is moved. */
+    if (request_buffer->size >= sizeof(method))
+    {
+        memcpy(&method, request_buffer->data, sizeof(method));
+        method = ntohl(method);
+    }
+
+    /* route reads to the reader pool; pin submissions to the writer. */
+    if (ctx->dataservice_reader_context_opened
+     && DATASERVICE_API_METHOD_APP_PQ_TRANSACTION_SUBMIT != method)
+    {
+        endpoint_addr = ctx->data_reader_endpoint_addr;
+    }
+    else
+    {
+        endpoint_addr = ctx->ctx->data_endpoint_addr;
+    }
+
     /* create the request payload. */
     retval =
         protocolservice_dataservice_request_message_create(
@@ -64,7 +92,7 @@ status protocolservice_dataservice_send_request(
 
     /* send the request message. */
     retval =
-        message_send(ctx->ctx->data_endpoint_addr, request, ctx->ctx->msgdisc);
+        message_send(endpoint_addr, request, ctx->ctx->msgdisc);
     if (STATUS_SUCCESS != retval)
     {
         goto cleanup_request;
@@ -73,6 +101,9 @@ status protocolservice_dataservice_send_request(
     /* the request message is now owned by the messaging discipline. */
     request = NULL;
 
+    /* this request occupies a slot in the request window. */
+    ++ctx->requests_in_flight;
+
     /* success. */
     retval = STATUS_SUCCESS;
     goto done;
@@ -0,0 +1,100 @@
+/**
+ * \file protocolservice/protocolservice_encode_block_response.c
+ *
+ * \brief Encode the protocol response for a block read.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/inet.h>
+#include <agentd/status_codes.h>
+#include <cbmc/model_assert.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vccrypt/compare.h>
+
+#include "protocolservice_internal.h"
+
+static const uint8_t ff_uuid[16] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const uint8_t zero_uuid[16] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+/**
+ * \brief Encode the protocol response for a block read.
+ *
+ * The response payload is selected by the original protocol request id.
+ *
+ * \param respbuf       The buffer in which the response is stored.
+ * \param ctx           The protocol service protocol fiber context.
+ * \param request_id    The original protocol request id.
+ * \param offset        The protocol request offset.
+ * \param node          The block node.
+ * \param cert          The block certificate.
+ * \param cert_size     The size of the block certificate.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_encode_block_response(
+    vccrypt_buffer_t* respbuf, protocolservice_protocol_fiber_context* ctx,
+    uint32_t request_id, uint32_t offset, const data_block_node_t* node,
+    const void* cert, size_t cert_size)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != respbuf);
+    MODEL_ASSERT(prop_protocolservice_protocol_fiber_context_valid(ctx));
+    MODEL_ASSERT(NULL != node);
+
+    /* decode the protocol request id to determine the response payload. */
+    switch (request_id)
+    {
+        case UNAUTH_PROTOCOL_REQ_ID_BLOCK_ID_GET_NEXT:
+            if (!crypto_memcmp(node->next, ff_uuid, 16))
+            {
+                /* Encode an error response. */
+                return
+                    vcblockchain_protocol_encode_error_resp(
+                        respbuf, &ctx->ctx->vpr_alloc, request_id, offset,
+                        AGENTD_ERROR_DATASERVICE_NOT_FOUND);
+            }
+
+            /* build a block get next id payload. */
+            return
+                vcblockchain_protocol_encode_resp_block_next_id_get(
+                    respbuf, &ctx->ctx->vpr_alloc, offset, STATUS_SUCCESS,
+                    (const vpr_uuid*)node->next);
+
+        case UNAUTH_PROTOCOL_REQ_ID_BLOCK_ID_GET_PREV:
+            if (!crypto_memcmp(node->prev, zero_uuid, 16))
+            {
+                /* Encode an error response. */
+                return
+                    vcblockchain_protocol_encode_error_resp(
+                        respbuf, &ctx->ctx->vpr_alloc, request_id, offset,
+                        AGENTD_ERROR_DATASERVICE_NOT_FOUND);
+            }
+
+            /* build a block get prev id payload. */
+            return
+                vcblockchain_protocol_encode_resp_block_prev_id_get(
+                    respbuf, &ctx->ctx->vpr_alloc, offset, STATUS_SUCCESS,
+                    (const vpr_uuid*)node->prev);
+
+        default:
+            /* build a block get payload. */
+            return
+                vcblockchain_protocol_encode_resp_block_get(
+                    respbuf, &ctx->ctx->vpr_alloc, offset, STATUS_SUCCESS,
+                    (const vpr_uuid*)node->key, (const vpr_uuid*)node->prev,
+                    (const vpr_uuid*)node->next,
+                    (const vpr_uuid*)node->first_transaction_id,
+                    ntohll(node->net_block_height),
+                    ntohll(node->net_block_cert_size), cert, cert_size);
+    }
+}
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <config.h>
+#include <agentd/dataservice/data.h>
 #include <agentd/protocolservice/api.h>
 #include <rcpr/allocator.h>
 #include <rcpr/fiber.h>
@@ -32,6 +33,12 @@ extern "C" {
 /** \brief The random endpoint fiber stack size. */
 #define RANDOM_ENDPOINT_STACK_SIZE 16384
 
+/** \brief The size of the random endpoint entropy pool. */
+#define RANDOM_ENDPOINT_POOL_SIZE 65536
+
+/** \brief Top up the entropy pool when it falls below this many bytes. */
+#define RANDOM_ENDPOINT_POOL_LOW_WATER 16384
+
 /** \brief The dataservice endpoint fiber stack size. */
 #define DATASERVICE_ENDPOINT_STACK_SIZE 16384
 
@@ -47,6 +54,18 @@ extern "C" {
 /** \brief The size of the notificationservice endpoint fiber. */
 #define NOTIFICATION_ENDPOINT_FIBER_STACK_SIZE 16384
 
+/**
+ * \brief The notificationservice offset reserved for the latest block id
+ * cache subscription.  Client assertions start at offset 1.
+ */
+#define LATEST_BLOCK_ID_CACHE_OFFSET 0U
+
+/**
+ * \brief The maximum number of dataservice requests that a single connection
+ * may have outstanding before the protocol fiber stops reading new requests.
+ */
+#define PROTOCOLSERVICE_MAX_REQUESTS_IN_FLIGHT 16U
+
 /**
  * \brief An authorized entity.
  */
@@ -95,6 +114,39 @@ struct protocolservice_authorized_entity_capability
 typedef struct protocolservice_dataservice_mailbox_context_entry
 protocolservice_dataservice_mailbox_context_entry;
 
+/**
+ * \brief A dataservice request awaiting a response from the dataservice.
+ */
+typedef struct protocolservice_dataservice_pending_request
+protocolservice_dataservice_pending_request;
+
+struct protocolservice_dataservice_pending_request
+{
+    RCPR_SYM(resource) hdr;
+    RCPR_SYM(allocator)* alloc;
+    protocolservice_dataservice_pending_request* next;
+    uint32_t request_id;
+    uint32_t protocol_request_id;
+    uint32_t offset;
+    RCPR_SYM(mailbox_address) return_address;
+    protocolservice_dataservice_mailbox_context_entry* entry;
+};
+
+/**
+ * \brief A FIFO queue of pending dataservice requests.
+ *
+ * The dataservice processes requests on a socket in order, so responses for a
+ * given child context arrive in the same order as the requests were written.
+ */
+typedef struct protocolservice_dataservice_pending_queue
+protocolservice_dataservice_pending_queue;
+
+struct protocolservice_dataservice_pending_queue
+{
+    protocolservice_dataservice_pending_request* head;
+    protocolservice_dataservice_pending_request* tail;
+};
+
 struct protocolservice_dataservice_mailbox_context_entry
 {
     RCPR_SYM(resource) hdr;
@@ -102,6 +154,80 @@ struct protocolservice_dataservice_mailbox_context_entry
     int reference_count;
     RCPR_SYM(mailbox_address) addr;
     uint32_t context;
+    protocolservice_dataservice_pending_queue pending;
+};
+
+/**
+ * \brief The maximum number of bytes held by the certificate cache of a
+ * protocol service instance.
+ */
+#define PROTOCOLSERVICE_CERT_CACHE_MAX_SIZE (8U * 1024U * 1024U)
+
+/**
+ * \brief The type of record held by a certificate cache entry.
+ */
+enum protocolservice_cert_cache_type
+{
+    PROTOCOLSERVICE_CERT_CACHE_TYPE_BLOCK = 1,
+    PROTOCOLSERVICE_CERT_CACHE_TYPE_TRANSACTION = 2,
+};
+
+/**
+ * \brief Key for a certificate cache entry.
+ */
+typedef struct protocolservice_cert_cache_key
+protocolservice_cert_cache_key;
+
+struct protocolservice_cert_cache_key
+{
+    uint32_t type;
+    RCPR_SYM(rcpr_uuid) id;
+};
+
+/**
+ * \brief A canonized block or transaction held by the certificate cache.
+ *
+ * The certificate is empty if only the record header has been read.
+ */
+typedef struct protocolservice_cert_cache_entry
+protocolservice_cert_cache_entry;
+
+struct protocolservice_cert_cache_entry
+{
+    RCPR_SYM(resource) hdr;
+    RCPR_SYM(allocator)* alloc;
+    protocolservice_cert_cache_key key;
+    protocolservice_cert_cache_entry* lru_prev;
+    protocolservice_cert_cache_entry* lru_next;
+    union
+    {
+        data_block_node_t block;
+        data_transaction_node_t transaction;
+    } node;
+    size_t cert_size;
+    uint8_t cert[];
+};
+
+/**
+ * \brief Size-bounded LRU cache of canonized blocks and transactions.
+ *
+ * Canonized records are immutable except for the next link of the newest
+ * record in a chain, so only records that already have a successor are
+ * cached.
+ */
+typedef struct protocolservice_cert_cache
+protocolservice_cert_cache;
+
+struct protocolservice_cert_cache
+{
+    RCPR_SYM(allocator)* alloc;
+    RCPR_SYM(rbtree)* entries;
+    protocolservice_cert_cache_entry* lru_head;
+    protocolservice_cert_cache_entry* lru_tail;
+    size_t size;
+    size_t max_size;
+    uint64_t hits;
+    uint64_t misses;
 };
 
 /**
@@ -120,6 +246,9 @@ struct protocolservice_context
     RCPR_SYM(mailbox_address) data_endpoint_addr;
     RCPR_SYM(mailbox_address) random_endpoint_addr;
     RCPR_SYM(mailbox_address) notificationservice_endpoint_addr;
+    RCPR_SYM(mailbox_address)* data_reader_endpoint_addrs;
+    size_t data_reader_endpoint_count;
+    size_t data_reader_endpoint_next;
     RCPR_SYM(fiber)* main_fiber;
     RCPR_SYM(rbtree)* authorized_entity_dict;
     RCPR_SYM(rbtree)* extended_api_dict;
@@ -131,6 +260,12 @@ struct protocolservice_context
     vccrypt_buffer_t agentd_sign_privkey;
     bool private_key_set;
     size_t protocol_fiber_count;
+    protocolservice_cert_cache cert_cache;
+    bool latest_block_id_cached;
+    bool latest_block_id_subscribed;
+    bool latest_block_id_invalidated;
+    RCPR_SYM(rcpr_uuid) latest_block_id;
+    int attestation_wakeup_sock;
     bool quiesce;
     bool terminate;
 };
@@ -164,6 +299,9 @@ struct protocolservice_random_endpoint_context
     RCPR_SYM(fiber_scheduler_discipline)* msgdisc;
     RCPR_SYM(mailbox_address) addr;
     RCPR_SYM(psock)* randomsock;
+    uint8_t* pool;
+    size_t pool_avail;
+    bool refill_pending;
 };
 
 /**
@@ -229,6 +367,7 @@ struct protocolservice_notificationservice_block_assertion_request
     RCPR_SYM(rcpr_uuid) block_id;
     RCPR_SYM(mailbox_address) reply_addr;
     bool cancel;
+    bool cache_subscription;
 };
 
 /**
@@ -288,12 +427,15 @@ struct protocolservice_dataservice_endpoint_context
     RCPR_SYM(resource) hdr;
     RCPR_SYM(allocator)* alloc;
     allocator_options_t vpr_alloc;
+    int reference_count;
     RCPR_SYM(fiber)* fib;
+    RCPR_SYM(fiber)* read_fib;
     RCPR_SYM(fiber_scheduler_discipline)* msgdisc;
     RCPR_SYM(mailbox_address) addr;
     RCPR_SYM(psock)* datasock;
     RCPR_SYM(rbtree)* mailbox_context_tree;
     RCPR_SYM(rbtree)* context_mailbox_tree;
+    protocolservice_dataservice_pending_queue pending_open;
     protocolservice_context* ctx;
 };
 
@@ -351,6 +493,7 @@ enum protocolservice_protocol_write_endpoint_message_type
     PROTOCOLSERVICE_PROTOCOL_WRITE_ENDPOINT_NOTIFICATION_MSG,
     PROTOCOLSERVICE_PROTOCOL_WRITE_ENDPOINT_PACKET,
     PROTOCOLSERVICE_PROTOCOL_WRITE_ENDPOINT_ERROR_MESSAGE,
+    PROTOCOLSERVICE_PROTOCOL_WRITE_ENDPOINT_REQUEST_WINDOW_OPEN,
 };
 
 /**
@@ -383,11 +526,22 @@ struct protocolservice_protocol_fiber_context
     RCPR_SYM(mailbox_address) fiber_addr;
     const protocolservice_authorized_entity* entity;
     bool dataservice_context_opened;
+    bool dataservice_reader_context_opened;
+    RCPR_SYM(mailbox_address) data_reader_endpoint_addr;
     bool latest_block_id_assertion_set;
     uint32_t latest_block_id_assertion_client_offset;
     uint64_t latest_block_id_assertion_server_offset;
     uint64_t extended_api_offset;
     RCPR_SYM(rbtree)* extended_api_offset_dict;
+    bool block_range_active;
+    uint32_t block_range_client_offset;
+    uint64_t block_range_next_height;
+    uint32_t block_range_remaining_count;
+    uint64_t block_range_remaining_bytes;
+    bool block_range_sent;
+    uint32_t requests_in_flight;
+    bool request_window_wait;
+    RCPR_SYM(psock)* write_buffer;
 };
 
 /**
@@ -441,7 +595,10 @@ status protocolservice_dataservice_send_request(
     uint32_t request_offset, vccrypt_buffer_t* request_buffer);
 
 /**
- * \brief Create and add the protocol service data service endpoint fiber.
+ * \brief Create and add the protocol service data service endpoint fibers.
+ *
+ * Two fibers share the endpoint context: the endpoint fiber, which writes
+ * requests to the dataservice, and the read fiber, which routes responses.
  *
  * \param ctx           Pointer to the saved context. NOTE THAT THIS IS OWNED
  *                      BY THE DATASERVICE ENDPOINT.
@@ -461,6 +618,24 @@ status protocolservice_dataservice_endpoint_add(
     RCPR_SYM(mailbox_address)* addr, RCPR_SYM(allocator)* alloc,
     RCPR_SYM(fiber_scheduler)* sched, int datasock);
 
+/**
+ * \brief Create and add a data service endpoint for each socket in the
+ * read-only data service pool.
+ *
+ * The mailbox addresses for these endpoints are saved in the protocol service
+ * context, which owns them.
+ *
+ * \param ctx               The protocol service context.
+ * \param datareaderstart   The first read-only data service socket.
+ * \param datareadercount   The number of read-only data service sockets.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_dataservice_reader_endpoints_add(
+    protocolservice_context* ctx, int datareaderstart, size_t datareadercount);
+
 /**
  * \brief Release a protocolservice dataservice endpoint context resource.
  *
@@ -477,7 +652,9 @@ status protocolservice_dataservice_endpoint_context_release(
  * \brief Entry point for the protocol service dataservice endpoint fiber.
  *
  * This fiber manages communication with the dataservice instance assigned to
- * the protocol service.
+ * the protocol service. It writes requests to the dataservice without waiting
+ * for their responses, which are routed by the endpoint read fiber. This
+ * allows many requests to be in flight on the dataservice socket at once.
  *
  * \param vctx          The type erased context for this endpoint fiber.
  *
@@ -487,6 +664,193 @@ status protocolservice_dataservice_endpoint_context_release(
  */
 status protocolservice_dataservice_endpoint_fiber_entry(void* vctx);
 
+/**
+ * \brief Entry point for the protocol service dataservice endpoint read fiber.
+ *
+ * This fiber reads responses from the dataservice instance assigned to the
+ * protocol service and routes each response to the mailbox that made the
+ * matching request.  Responses that cannot be routed are counted and dropped;
+ * this fiber only exits if the dataservice socket fails.
+ *
+ * \param vctx          The type erased context for this endpoint fiber.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_dataservice_endpoint_read_fiber_entry(void* vctx);
+
+/**
+ * \brief Decode and dispatch a response read from the dataservice socket.
+ *
+ * \param ctx               The endpoint context.
+ * \param resp              The response data.
+ * \param resp_size         The size of the response data.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_dataservice_endpoint_read_decode_and_dispatch(
+    protocolservice_dataservice_endpoint_context* ctx, const void* resp,
+    size_t resp_size);
+
+/**
+ * \brief Decode and dispatch a dataservice child context create response.
+ *
+ * \param ctx               The endpoint context.
+ * \param resp              The response data.
+ * \param resp_size         The size of the response data.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status pde_decode_and_dispatch_resp_context_open(
+    protocolservice_dataservice_endpoint_context* ctx, const void* resp,
+    size_t resp_size);
+
+/**
+ * \brief Decode and dispatch a dataservice child context close response.
+ *
+ * \param ctx               The endpoint context.
+ * \param entry             The mailbox context entry for this response.
+ * \param pending           The pending request matching this response.
+ * \param resp              The response data.
+ * \param resp_size         The size of the response data.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status pde_decode_and_dispatch_resp_context_close(
+    protocolservice_dataservice_endpoint_context* ctx,
+    protocolservice_dataservice_mailbox_context_entry* entry,
+    protocolservice_dataservice_pending_request* pending, const void* resp,
+    size_t resp_size);
+
+/**
+ * \brief Decode and dispatch a generic dataservice response.
+ *
+ * \param ctx               The endpoint context.
+ * \param pending           The pending request matching this response.
+ * \param resp              The response data.
+ * \param resp_size         The size of the response data.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status pde_decode_and_dispatch_resp_dataservice_req(
+    protocolservice_dataservice_endpoint_context* ctx,
+    protocolservice_dataservice_pending_request* pending, const void* resp,
+    size_t resp_size);
+
+/**
+ * \brief Send a reply payload from the dataservice endpoint to the given
+ * mailbox.
+ *
+ * \param ctx               The endpoint context.
+ * \param return_address    The mailbox address to which the reply is sent.
+ * \param reply_payload     The reply payload to send. On success, ownership of
+ *                          this payload is transferred to the message
+ *                          discipline.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_dataservice_endpoint_send_reply(
+    protocolservice_dataservice_endpoint_context* ctx,
+    RCPR_SYM(mailbox_address) return_address,
+    protocolservice_protocol_write_endpoint_message* reply_payload);
+
+/**
+ * \brief Send an error reply for a pending request that could not be
+ * completed.
+ *
+ * Every pending request is answered exactly once, so that the requesting fiber
+ * is not left blocked and its request window slot is released.
+ *
+ * \param ctx               The endpoint context.
+ * \param pending           The pending request to answer.
+ * \param status_           The error status to report.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_dataservice_endpoint_send_error(
+    protocolservice_dataservice_endpoint_context* ctx,
+    protocolservice_dataservice_pending_request* pending, int status_);
+
+/**
+ * \brief Create a pending dataservice request record.
+ *
+ * \param pending           Pointer to receive the pending request on success.
+ * \param ctx               The endpoint context.
+ * \param req_payload       The request payload being written to the
+ *                          dataservice.
+ * \param return_address    The mailbox address to which the response should be
+ *                          routed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_dataservice_pending_request_create(
+    protocolservice_dataservice_pending_request** pending,
+    protocolservice_dataservice_endpoint_context* ctx,
+    const protocolservice_dataservice_request_message* req_payload,
+    RCPR_SYM(mailbox_address) return_address);
+
+/**
+ * \brief Release a pending dataservice request record.
+ *
+ * \param r             The resource to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_dataservice_pending_request_release(
+    RCPR_SYM(resource)* r);
+
+/**
+ * \brief Append a pending request to the tail of a pending queue.
+ *
+ * \param queue         The queue to which the request is appended.
+ * \param pending       The pending request, which is owned by the queue after
+ *                      this call.
+ */
+void protocolservice_dataservice_pending_queue_push(
+    protocolservice_dataservice_pending_queue* queue,
+    protocolservice_dataservice_pending_request* pending);
+
+/**
+ * \brief Remove the pending request at the head of a pending queue.
+ *
+ * \param queue         The queue from which the request is removed.
+ *
+ * \returns the pending request, now owned by the caller, or NULL if the queue
+ * is empty.
+ */
+protocolservice_dataservice_pending_request*
+protocolservice_dataservice_pending_queue_pop(
+    protocolservice_dataservice_pending_queue* queue);
+
+/**
+ * \brief Release all pending requests in a pending queue.
+ *
+ * \param queue         The queue to clear.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_dataservice_pending_queue_clear(
+    protocolservice_dataservice_pending_queue* queue);
+
 /**
  * \brief Decode and dispatch a dataservice endpoint request.
  *
@@ -495,7 +859,9 @@ status protocolservice_dataservice_endpoint_fiber_entry(void* vctx);
  * \param return_address    The return mailbox address, needed for looking up
  *                          the request context.
  * \param reply_payload     Pointer to the pointer to receive the reply payload
- *                          for this request.
+ *                          for this request. This is set to NULL if the reply
+ *                          is sent by the endpoint read fiber once the
+ *                          dataservice responds.
  *
  * \returns a status code indicating success or failure.
  *      - STATUS_SUCCESS on success.
@@ -515,7 +881,9 @@ status protocolservice_dataservice_endpoint_decode_and_dispatch(
  * \param return_address    The return mailbox address, needed for looking up
  *                          the request context.
  * \param reply_payload     Pointer to the pointer to receive the reply payload
- *                          for this request.
+ *                          for this request. This is set to NULL if the reply
+ *                          is sent by the endpoint read fiber once the
+ *                          dataservice responds.
  *
  * \returns a status code indicating success or failure.
  *      - STATUS_SUCCESS on success.
@@ -535,7 +903,9 @@ status pde_decode_and_dispatch_req_context_open(
  * \param return_address    The return mailbox address, needed for looking up
  *                          the request context.
  * \param reply_payload     Pointer to the pointer to receive the reply payload
- *                          for this request.
+ *                          for this request. This is set to NULL if the reply
+ *                          is sent by the endpoint read fiber once the
+ *                          dataservice responds.
  *
  * \returns a status code indicating success or failure.
  *      - STATUS_SUCCESS on success.
@@ -555,7 +925,9 @@ status pde_decode_and_dispatch_req_context_close(
  * \param return_address    The return mailbox address, needed for looking up
  *                          the request context.
  * \param reply_payload     Pointer to the pointer to receive the reply payload
- *                          for this request.
+ *                          for this request. This is set to NULL if the reply
+ *                          is sent by the endpoint read fiber once the
+ *                          dataservice responds.
  *
  * \returns a status code indicating success or failure.
  *      - STATUS_SUCCESS on success.
@@ -889,7 +1261,8 @@ status protocolservice_random_endpoint_context_release(RCPR_SYM(resource)* r);
 /**
  * \brief Entry point for the protocol service random endpoint fiber.
  *
- * This fiber forwards requests to the random service and returns responses.
+ * This fiber serves requests from an entropy pool, which it tops up from the
+ * random service after replying.
  *
  * \param vctx          The type erased random endopint context.
  *
@@ -899,6 +1272,60 @@ status protocolservice_random_endpoint_context_release(RCPR_SYM(resource)* r);
  */
 status protocolservice_random_endpoint_fiber_entry(void* vctx);
 
+/**
+ * \brief Ask the random service for enough bytes to fill the entropy pool.
+ *
+ * Only the request is written here. The response is collected by
+ * \ref protocolservice_random_endpoint_refill_end once the pool actually needs
+ * it, so the endpoint keeps serving from what is left in the pool in the
+ * meantime. At most one refill is in flight at a time.
+ *
+ * \param ctx           The random endpoint context.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_random_endpoint_refill_begin(
+    protocolservice_random_endpoint_context* ctx);
+
+/**
+ * \brief Read the response to a pending refill into the entropy pool.
+ *
+ * The pool may have been drawn down further since the refill was requested,
+ * so all of the returned bytes fit. If no refill is pending, this call does
+ * nothing.
+ *
+ * \param ctx           The random endpoint context.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_random_endpoint_refill_end(
+    protocolservice_random_endpoint_context* ctx);
+
+/**
+ * \brief Fill a buffer with random bytes for a random endpoint request.
+ *
+ * Requests are served from the entropy pool. Bytes served from the pool are
+ * cleared. When the pool falls below RANDOM_ENDPOINT_POOL_LOW_WATER, a refill
+ * is requested without waiting for it. This call only waits on the random
+ * service if the pool can't cover the request.
+ *
+ * Requests larger than the pool are read directly from the random service.
+ *
+ * \param ctx           The random endpoint context.
+ * \param data          The buffer to fill.
+ * \param size          The number of bytes to write to \p data.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_random_endpoint_read_bytes(
+    protocolservice_random_endpoint_context* ctx, void* data, size_t size);
+
 /**
  * \brief Create a request message payload for the random service endpoint.
  *
@@ -1407,6 +1834,10 @@ status protocolservice_protocol_write_handshake_ack_resp(
 /**
  * \brief Request a data service context for this connection.
  *
+ * A context is always opened on the writer endpoint.  If the protocol service
+ * has a pool of read-only data service endpoints, then a context is also
+ * opened on the next reader in the pool.
+ *
  * \param ctx               The protocol service protocol fiber context.
  *
  * \returns a status code indicating success or failure.
@@ -1428,6 +1859,37 @@ status protocolservice_protocol_request_data_service_context(
 status protocolservice_protocol_close_data_service_context(
     protocolservice_protocol_fiber_context* ctx);
 
+/**
+ * \brief Request a data service context for this connection from the given
+ * data service endpoint.
+ *
+ * \param ctx               The protocol service protocol fiber context.
+ * \param endpoint_addr     The mailbox address of the data service endpoint.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - the dataservice error status if the context could not be opened.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_protocol_request_data_service_endpoint_context(
+    protocolservice_protocol_fiber_context* ctx,
+    RCPR_SYM(mailbox_address) endpoint_addr);
+
+/**
+ * \brief Close the data service context for this connection on the given
+ * data service endpoint.
+ *
+ * \param ctx               The protocol service protocol fiber context.
+ * \param endpoint_addr     The mailbox address of the data service endpoint.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_protocol_close_data_service_endpoint_context(
+    protocolservice_protocol_fiber_context* ctx,
+    RCPR_SYM(mailbox_address) endpoint_addr);
+
 /**
  * \brief Map the user capabilities in a form that the data service open context
  * request can understand.
@@ -1481,6 +1943,39 @@ status protocolservice_protocol_write_endpoint_entry(void* vctx);
 status protocolservice_protocol_shutdown_write_endpoint(
     protocolservice_protocol_fiber_context* ctx);
 
+/**
+ * \brief Wait until this connection has room for another outstanding request.
+ *
+ * If the number of dataservice requests in flight for this connection has
+ * reached \ref PROTOCOLSERVICE_MAX_REQUESTS_IN_FLIGHT, then the protocol fiber
+ * blocks on its mailbox until the write endpoint releases a slot or the
+ * connection is shutting down.
+ *
+ * \param ctx               The protocol service protocol fiber context.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_protocol_request_window_wait(
+    protocolservice_protocol_fiber_context* ctx);
+
+/**
+ * \brief Release a slot in this connection's request window.
+ *
+ * This is called by the write endpoint when a dataservice response arrives.
+ * If the protocol fiber is waiting for a slot, and either a slot is now open
+ * or the connection is shutting down, it is woken.
+ *
+ * \param ctx               The protocol service protocol fiber context.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_protocol_request_window_release(
+    protocolservice_protocol_fiber_context* ctx);
+
 /**
  * \brief Release a protocol write endpoint message.
  *
@@ -1520,6 +2015,23 @@ status protocolservice_pwe_dnd_dataservice_message(
     protocolservice_protocol_fiber_context* ctx,
     protocolservice_protocol_write_endpoint_message* payload);
 
+/**
+ * \brief Decode and dispatch an error message from the dataservice endpoint.
+ *
+ * The endpoint sends this message when a request could not be completed. The
+ * peer receives an error response for the original request and offset.
+ *
+ * \param ctx           The protocol service protocol fiber context.
+ * \param payload       The message payload.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_pwe_dnd_error_message(
+    protocolservice_protocol_fiber_context* ctx,
+    protocolservice_protocol_write_endpoint_message* payload);
+
 /**
  * \brief Decode and dispatch a latest block id get response.
  *
@@ -1604,6 +2116,66 @@ status protocolservice_pwe_dnd_dataservice_block_id_by_height_get(
     protocolservice_protocol_fiber_context* ctx,
     protocolservice_protocol_write_endpoint_message* payload);
 
+/**
+ * \brief Decode and dispatch a block id next, block id prev, or block id with
+ * transaction get response.
+ *
+ * \param ctx           The protocol service protocol fiber context.
+ * \param payload       The message payload.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_pwe_dnd_dataservice_block_id_link_get(
+    protocolservice_protocol_fiber_context* ctx,
+    protocolservice_protocol_write_endpoint_message* payload);
+
+/**
+ * \brief Decode and dispatch a block range get response.
+ *
+ * Each block in the response is written to the client as its own packet.  If
+ * the stream has not finished, the next chunk is requested from the
+ * dataservice once this chunk has been written.
+ *
+ * \param ctx           The protocol service protocol fiber context.
+ * \param payload       The message payload.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_pwe_dnd_dataservice_block_range_get(
+    protocolservice_protocol_fiber_context* ctx,
+    protocolservice_protocol_write_endpoint_message* payload);
+
+/**
+ * \brief Request the next chunk of an active block range stream from the
+ * dataservice.
+ *
+ * \param ctx           The protocol service protocol fiber context.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_block_range_request_chunk(
+    protocolservice_protocol_fiber_context* ctx);
+
+/**
+ * \brief Decode and dispatch an artifact transaction list get response.
+ *
+ * \param ctx           The protocol service protocol fiber context.
+ * \param payload       The message payload.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_pwe_dnd_dataservice_artifact_transaction_list_get(
+    protocolservice_protocol_fiber_context* ctx,
+    protocolservice_protocol_write_endpoint_message* payload);
+
 /**
  * \brief Decode and dispatch a response message from the notificationservice.
  *
@@ -1635,6 +2207,11 @@ status protocolservice_protocol_write_endpoint_write_packet(
 /**
  * \brief Write a packet to the peer.
  *
+ * If \ref protocolservice_protocol_write_endpoint_buffer_begin has been called
+ * for the current message, the packet is buffered until the next call to
+ * \ref protocolservice_protocol_write_endpoint_flush. Otherwise, it is written
+ * directly to the peer.
+ *
  * \param ctx           The protocol service protocol fiber context.
  * \param msg           The raw message buffer to write.
  * \param size          The size of the message buffer to write.
@@ -1646,6 +2223,41 @@ status protocolservice_protocol_write_endpoint_write_packet(
 status protocolservice_protocol_write_endpoint_write_raw_packet(
     protocolservice_protocol_fiber_context* ctx, const void* msg, size_t size);
 
+/**
+ * \brief Buffer the packets written for the current message.
+ *
+ * A message that produces more than one packet calls this before writing
+ * them, so that \ref protocolservice_protocol_write_endpoint_flush sends them
+ * all in a single write. Messages that produce a single packet write it
+ * directly to the peer and never pay for the buffer.
+ *
+ * \param ctx           The protocol service protocol fiber context.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_protocol_write_endpoint_buffer_begin(
+    protocolservice_protocol_fiber_context* ctx);
+
+/**
+ * \brief Flush any packets buffered by the write endpoint to the peer.
+ *
+ * Messages that produce more than one packet encrypt them into an in-memory
+ * buffer started by \ref protocolservice_protocol_write_endpoint_buffer_begin.
+ * This function writes the buffered packets to the peer socket in a single
+ * write and releases the buffer, so that the next message writes directly to
+ * the peer unless it also asks to be buffered.
+ *
+ * \param ctx           The protocol service protocol fiber context.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_protocol_write_endpoint_flush(
+    protocolservice_protocol_fiber_context* ctx);
+
 /**
  * \brief Read a packet from the client socket, and decode / dispatch it.
  *
@@ -1771,6 +2383,22 @@ status protocolservice_protocol_dnd_block_id_by_height_get(
     protocolservice_protocol_fiber_context* ctx, uint32_t request_offset,
     const uint8_t* payload, size_t payload_size);
 
+/**
+ * \brief Decode and dispatch a block range get request.
+ *
+ * \param ctx               The protocol service protocol fiber context.
+ * \param request_offset    The request offset of the packet.
+ * \param payload           The payload of the packet.
+ * \param payload_size      The size of the payload.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_protocol_dnd_block_range_get(
+    protocolservice_protocol_fiber_context* ctx, uint32_t request_offset,
+    const uint8_t* payload, size_t payload_size);
+
 /**
  * \brief Decode and dispatch a transaction by id get request.
  *
@@ -1867,6 +2495,22 @@ status protocolservice_protocol_dnd_artifact_last_transaction_id_get(
     protocolservice_protocol_fiber_context* ctx, uint32_t request_offset,
     const uint8_t* payload, size_t payload_size);
 
+/**
+ * \brief Decode and dispatch an artifact transaction list get request.
+ *
+ * \param ctx               The protocol service protocol fiber context.
+ * \param request_offset    The request offset of the packet.
+ * \param payload           The payload of the packet.
+ * \param payload_size      The size of the payload.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_protocol_dnd_artifact_transaction_list_get(
+    protocolservice_protocol_fiber_context* ctx, uint32_t request_offset,
+    const uint8_t* payload, size_t payload_size);
+
 /**
  * \brief Decode and dispatch a block assertion request.
  *
@@ -2016,6 +2660,221 @@ status protocolservice_notificationservice_endpoint_fiber_entry(void* vctx);
 status protocolservice_notificationservice_write_endpoint_fiber_entry(
     void* vctx);
 
+/**
+ * \brief Update the latest block id cache from a dataservice response.
+ *
+ * The first time a block id is cached, a block assertion for it is sent to
+ * the notificationservice endpoint.  When the notificationservice invalidates
+ * this assertion, the cache is cleared.
+ *
+ * \param ctx           The protocolservice protocol context for this update.
+ * \param block_id      The latest block id read from the dataservice.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_latest_block_id_cache_update(
+    protocolservice_protocol_fiber_context* ctx,
+    const RCPR_SYM(rcpr_uuid)* block_id);
+
+/**
+ * \brief Invalidate the latest block id cache.
+ *
+ * \param ctx           The protocolservice context owning the cache.
+ */
+void protocolservice_latest_block_id_cache_invalidate(
+    protocolservice_context* ctx);
+
+/**
+ * \brief Initialize a certificate cache.
+ *
+ * \param cache         The certificate cache to initialize.
+ * \param alloc         The allocator to use for this cache.
+ * \param max_size      The maximum number of bytes held by this cache.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_cert_cache_init(
+    protocolservice_cert_cache* cache, RCPR_SYM(allocator)* alloc,
+    size_t max_size);
+
+/**
+ * \brief Dispose a certificate cache, releasing all of its entries.
+ *
+ * \param cache         The certificate cache to dispose.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_cert_cache_dispose(protocolservice_cert_cache* cache);
+
+/**
+ * \brief Look up an entry in the certificate cache.
+ *
+ * On a hit, the entry becomes the most recently used entry.  The entry is
+ * owned by the cache and is only valid until the next insert.
+ *
+ * \param entry         Pointer to receive the entry on success.
+ * \param cache         The certificate cache.
+ * \param type          The type of record to look up.
+ * \param id            The block or transaction id to look up.
+ * \param cert_needed   Set to true if a header-only entry is a miss.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on a cache hit.
+ *      - AGENTD_ERROR_DATASERVICE_NOT_FOUND on a cache miss.
+ */
+status protocolservice_cert_cache_lookup(
+    protocolservice_cert_cache_entry** entry,
+    protocolservice_cert_cache* cache, uint32_t type,
+    const RCPR_SYM(rcpr_uuid)* id, bool cert_needed);
+
+/**
+ * \brief Insert a canonized block or transaction into the certificate cache.
+ *
+ * Records without a successor are skipped, as their next link can still
+ * change.  The least recently used entries are evicted to make room.
+ *
+ * \param cache         The certificate cache.
+ * \param type          The type of record to insert.
+ * \param node          The block or transaction node to insert.
+ * \param cert          The certificate, or NULL if only the node was read.
+ * \param cert_size     The size of the certificate.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_cert_cache_insert(
+    protocolservice_cert_cache* cache, uint32_t type, const void* node,
+    const void* cert, size_t cert_size);
+
+/**
+ * \brief Compare two opaque \ref protocolservice_cert_cache_key keys.
+ *
+ * \param context       Unused.
+ * \param lhs           The left-hand side of the comparison.
+ * \param rhs           The right-hand side of the comparison.
+ *
+ * \returns an integer value representing the comparison result.
+ *      - RCPR_COMPARE_LT if \p lhs &lt; \p rhs.
+ *      - RCPR_COMPARE_EQ if \p lhs == \p rhs.
+ *      - RCPR_COMPARE_GT if \p lhs &gt; \p rhs.
+ */
+RCPR_SYM(rcpr_comparison_result) protocolservice_cert_cache_entry_compare(
+    void* context, const void* lhs, const void* rhs);
+
+/**
+ * \brief Given a \ref protocolservice_cert_cache_entry resource handle, return
+ * its \ref protocolservice_cert_cache_key key.
+ *
+ * \param context       Unused.
+ * \param r             The resource handle of a certificate cache entry.
+ *
+ * \returns the key for the certificate cache entry.
+ */
+const void* protocolservice_cert_cache_entry_key(
+    void* context, const RCPR_SYM(resource)* r);
+
+/**
+ * \brief Release a certificate cache entry.
+ *
+ * \param r             The certificate cache entry resource to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_cert_cache_entry_release(RCPR_SYM(resource)* r);
+
+/**
+ * \brief Encode the protocol response for a block read.
+ *
+ * The response payload is selected by the original protocol request id.
+ *
+ * \param respbuf       The buffer in which the response is stored.
+ * \param ctx           The protocol service protocol fiber context.
+ * \param request_id    The original protocol request id.
+ * \param offset        The protocol request offset.
+ * \param node          The block node.
+ * \param cert          The block certificate.
+ * \param cert_size     The size of the block certificate.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_encode_block_response(
+    vccrypt_buffer_t* respbuf, protocolservice_protocol_fiber_context* ctx,
+    uint32_t request_id, uint32_t offset, const data_block_node_t* node,
+    const void* cert, size_t cert_size);
+
+/**
+ * \brief Encode the protocol response for a transaction read.
+ *
+ * The response payload is selected by the original protocol request id.
+ *
+ * \param respbuf       The buffer in which the response is stored.
+ * \param ctx           The protocol service protocol fiber context.
+ * \param request_id    The original protocol request id.
+ * \param offset        The protocol request offset.
+ * \param node          The transaction node.
+ * \param cert          The transaction certificate.
+ * \param cert_size     The size of the transaction certificate.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_encode_transaction_response(
+    vccrypt_buffer_t* respbuf, protocolservice_protocol_fiber_context* ctx,
+    uint32_t request_id, uint32_t offset, const data_transaction_node_t* node,
+    const void* cert, size_t cert_size);
+
+/**
+ * \brief Send a response packet built by the protocol fiber to the protocol
+ * write endpoint.
+ *
+ * This is used for requests answered without a dataservice round trip.
+ *
+ * \param ctx               The protocol service protocol fiber context.
+ * \param request_id        The protocol request id.
+ * \param request_offset    The protocol request offset.
+ * \param respbuf           The encoded response packet.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_protocol_send_local_response(
+    protocolservice_protocol_fiber_context* ctx, uint32_t request_id,
+    uint32_t request_offset, const vccrypt_buffer_t* respbuf);
+
+/**
+ * \brief Answer a block or transaction read from the certificate cache.
+ *
+ * \param ctx               The protocol service protocol fiber context.
+ * \param request_id        The protocol request id.
+ * \param request_offset    The protocol request offset.
+ * \param type              The type of record requested.
+ * \param id                The block or transaction id requested.
+ * \param cert_needed       Set to true if the response carries the cert.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS if the response was sent from the cache.
+ *      - AGENTD_ERROR_DATASERVICE_NOT_FOUND if the caller must ask the
+ *        dataservice.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_cert_cache_send_response(
+    protocolservice_protocol_fiber_context* ctx, uint32_t request_id,
+    uint32_t request_offset, uint32_t type, const RCPR_SYM(rcpr_uuid)* id,
+    bool cert_needed);
+
 /**
  * \brief Handle an assert block request from the protocol.
  *
@@ -2410,6 +3269,17 @@ status protocolservice_extended_api_response_xlat_entry_add(
 status protocolservice_extended_api_response_xlat_entry_release(
     RCPR_SYM(resource)* r);
 
+/**
+ * \brief Wake the attestation service after a transaction has been submitted.
+ *
+ * This is a best-effort, non-blocking signal.  If the wakeup socket is full or
+ * unavailable, the attestation service will still find the transaction on its
+ * next timed wakeup, so errors are ignored.
+ *
+ * \param ctx           The protocol service context.
+ */
+void protocolservice_attestation_wakeup(protocolservice_context* ctx);
+
 /* make this header C++ friendly. */
 #ifdef __cplusplus
 }
@@ -0,0 +1,30 @@
+/**
+ * \file protocolservice/protocolservice_latest_block_id_cache_invalidate.c
+ *
+ * \brief Invalidate the latest block id cache.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+
+#include "protocolservice_internal.h"
+
+/**
+ * \brief Invalidate the latest block id cache.
+ *
+ * The invalidated block id is kept, so that a stale dataservice response for
+ * the same block id does not re-subscribe.
+ *
+ * \param ctx           The protocolservice context owning the cache.
+ */
+void protocolservice_latest_block_id_cache_invalidate(
+    protocolservice_context* ctx)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_protocolservice_context_valid(ctx));
+
+    ctx->latest_block_id_cached = false;
+    ctx->latest_block_id_subscribed = false;
+    ctx->latest_block_id_invalidated = true;
+}
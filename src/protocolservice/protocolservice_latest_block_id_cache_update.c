@@ -0,0 +1,138 @@
+/**
+ * \file protocolservice/protocolservice_latest_block_id_cache_update.c
+ *
+ * \brief Update the latest block id cache.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/status_codes.h>
+#include <cbmc/model_assert.h>
+#include <string.h>
+
+#include "protocolservice_internal.h"
+
+RCPR_IMPORT_message;
+RCPR_IMPORT_resource;
+RCPR_IMPORT_uuid;
+
+/**
+ * \brief Update the latest block id cache from a dataservice response.
+ *
+ * The first time a block id is cached, a block assertion for it is sent to
+ * the notificationservice endpoint.  When the notificationservice invalidates
+ * this assertion, the cache is cleared.
+ *
+ * \param ctx           The protocolservice protocol context for this update.
+ * \param block_id      The latest block id read from the dataservice.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_latest_block_id_cache_update(
+    protocolservice_protocol_fiber_context* ctx, const rcpr_uuid* block_id)
+{
+    status retval, release_retval;
+    message* req_message = NULL;
+    protocolservice_notificationservice_block_assertion_request*
+        req_payload = NULL;
+    protocolservice_context* pctx;
+    bool matches;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_protocolservice_protocol_fiber_context_valid(ctx));
+    MODEL_ASSERT(NULL != block_id);
+
+    pctx = ctx->ctx;
+    matches =
+        !memcmp(&pctx->latest_block_id, block_id, sizeof(*block_id));
+
+    /* while subscribed, only the asserted block id can be cached.  A different
+     * block id means this response raced a block update; the invalidation
+     * will follow. */
+    if (pctx->latest_block_id_subscribed)
+    {
+        pctx->latest_block_id_cached = matches;
+        return STATUS_SUCCESS;
+    }
+
+    /* the notificationservice already rejected this block id, so asserting it
+     * again would only be invalidated again. */
+    if (pctx->latest_block_id_invalidated && matches)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    /* create the subscription request. */
+    retval =
+        protocolservice_notificationservice_block_assertion_request_create(
+            &req_payload, ctx->alloc, LATEST_BLOCK_ID_CACHE_OFFSET, block_id,
+            ctx->fiber_addr);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* the notificationservice endpoint does not reply to this request. */
+    req_payload->cache_subscription = true;
+
+    /* create the message to send to the notificationservice endpoint. */
+    retval =
+        message_create(
+            &req_message, ctx->alloc, ctx->fiber_addr, &req_payload->hdr);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_req_payload;
+    }
+
+    /* the request payload is now owned by the request message. */
+    req_payload = NULL;
+
+    /* send the message to the notificationservice endpoint. */
+    retval =
+        message_send(
+            pctx->notificationservice_endpoint_addr, req_message,
+            pctx->msgdisc);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_req_message;
+    }
+
+    /* the request message is now owned by the message discipline. */
+    req_message = NULL;
+
+    /* cache this block id until the assertion is invalidated. */
+    memcpy(&pctx->latest_block_id, block_id, sizeof(*block_id));
+    pctx->latest_block_id_cached = true;
+    pctx->latest_block_id_subscribed = true;
+    pctx->latest_block_id_invalidated = false;
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    goto done;
+
+cleanup_req_message:
+    if (NULL != req_message)
+    {
+        release_retval =
+            resource_release(message_resource_handle(req_message));
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+cleanup_req_payload:
+    if (NULL != req_payload)
+    {
+        release_retval = resource_release(&req_payload->hdr);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+done:
+    return retval;
+}
@@ -55,8 +55,29 @@ status protocolservice_notificationservice_endpoint_fiber_entry(void* vctx)
             (protocolservice_notificationservice_block_assertion_request*)
             message_payload(req_msg, false);
 
+        /* subscribe the latest block id cache to block updates.  The
+         * subscription uses a reserved offset and is never replied to. */
+        if (req_payload->cache_subscription)
+        {
+            retval =
+                notificationservice_api_sendreq_block_assertion(
+                    ctx->notifysock, ctx->alloc, LATEST_BLOCK_ID_CACHE_OFFSET,
+                    &req_payload->block_id);
+            if (STATUS_SUCCESS != retval)
+            {
+                goto cleanup_req_msg;
+            }
+
+            retval = resource_release(message_resource_handle(req_msg));
+            if (STATUS_SUCCESS != retval)
+            {
+                goto cleanup_ctx;
+            }
+
+            continue;
+        }
         /* decode the request type. */
-        if (!req_payload->cancel)
+        else if (!req_payload->cancel)
         {
             /* compute a new offset. */
             ctx->request_offset_counter += 1;
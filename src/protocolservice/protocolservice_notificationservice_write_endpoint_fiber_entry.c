@@ -70,6 +70,20 @@ status protocolservice_notificationservice_write_endpoint_fiber_entry(
             goto cleanup_buf;
         }
 
+        /* the only response for the cache offset is an invalidation. */
+        if (LATEST_BLOCK_ID_CACHE_OFFSET == offset)
+        {
+            protocolservice_latest_block_id_cache_invalidate(ctx->ctx);
+
+            retval = rcpr_allocator_reclaim(ctx->alloc, buf);
+            if (STATUS_SUCCESS != retval)
+            {
+                goto cleanup_ctx;
+            }
+
+            continue;
+        }
+
         /* look up the return address and offset. */
         retval =
             protocolservice_notificationservice_lookup_return_address_from_offset(
@@ -21,6 +21,9 @@
 #include <unistd.h>
 #include <vpr/parameters.h>
 
+/* reader descriptors are parked here while the fixed descriptors are set. */
+#define AGENTD_FD_PROTOCOLSERVICE_READER_HIGH 600
+
 /**
  * \brief Spawn a protocol service process using the provided config structure
  * and logger socket.
@@ -40,6 +43,10 @@
  * \param datasock      Socket used to communicate with the data service.
  * \param notifysock    Socket used to communicate with the notification
  *                      service.
+ * \param wakeupsock    Socket used to wake the attestation service.
+ * \param datareadersocks   Array of sockets used to communicate with the
+ *                      read-only data service pool.
+ * \param datareadercount   The number of sockets in datareadersocks.
  * \param protopid      Pointer to the protocol service pid, to be updated on
  *                      the successful completion of this function.
  * \param runsecure     Set to false if we are not being run in secure mode.
@@ -70,16 +77,26 @@
 int protocolservice_proc(
     const bootstrap_config_t* bconf, const agent_config_t* conf, int randomsock,
     int logsock, int acceptsock, int controlsock, int datasock, int notifysock,
+    int wakeupsock, const int* datareadersocks, size_t datareadercount,
     pid_t* protopid, bool runsecure)
 {
     int retval = 1;
     uid_t uid;
     gid_t gid;
+    int readersocks[DATASTORE_READERS_MAXIMUM];
 
     /* parameter sanity checks. */
     MODEL_ASSERT(NULL != bconf);
     MODEL_ASSERT(NULL != conf);
     MODEL_ASSERT(NULL != protopid);
+    MODEL_ASSERT(0 == datareadercount || NULL != datareadersocks);
+
+    /* we can only map so many reader sockets. */
+    if (datareadercount > DATASTORE_READERS_MAXIMUM)
+    {
+        retval = AGENTD_ERROR_PROTOCOLSERVICE_PRIVSEP_SETFDS_FAILURE;
+        goto done;
+    }
 
     /* verify that this process is running as root. */
     if (runsecure && 0 != geteuid())
@@ -136,11 +153,28 @@ int protocolservice_proc(
             }
         }
 
+        /* move the reader fds above the range used by protect descriptors. */
+        for (size_t i = 0; i < datareadercount; ++i)
+        {
+            readersocks[i] =
+                fcntl(
+                    datareadersocks[i], F_DUPFD,
+                    AGENTD_FD_PROTOCOLSERVICE_READER_HIGH + (int)i);
+            if (readersocks[i] < 0)
+            {
+                perror("fcntl");
+                retval = AGENTD_ERROR_PROTOCOLSERVICE_PRIVSEP_SETFDS_FAILURE;
+                goto done;
+            }
+
+            close(datareadersocks[i]);
+        }
+
         /* move the fds out of the way. */
         if (AGENTD_STATUS_SUCCESS !=
             privsep_protect_descriptors(
                 &randomsock, &acceptsock, &controlsock, &logsock, &datasock,
-                &notifysock, NULL))
+                &notifysock, &wakeupsock, NULL))
         {
             retval = AGENTD_ERROR_CONFIG_PRIVSEP_SETFDS_FAILURE;
             goto done;
@@ -164,6 +198,8 @@ int protocolservice_proc(
                 logsock, /* ==> */ AGENTD_FD_UNAUTHORIZED_PROTOSVC_LOG,
                 datasock, /* ==> */ AGENTD_FD_UNAUTHORIZED_PROTOSVC_DATA,
                 notifysock, /* ==> */ AGENTD_FD_UNAUTHORIZED_PROTOSVC_NOTIFY,
+                wakeupsock, /* ==> */
+                    AGENTD_FD_UNAUTHORIZED_PROTOSVC_ATTESTATION_WAKEUP,
                 -1);
         if (0 != retval)
         {
@@ -172,9 +208,26 @@ int protocolservice_proc(
             goto done;
         }
 
+        /* map the reader fds into place after the fixed descriptors. */
+        for (size_t i = 0; i < datareadercount; ++i)
+        {
+            int readerfd =
+                AGENTD_FD_UNAUTHORIZED_PROTOSVC_DATA_READER_START + (int)i;
+            if (dup2(readersocks[i], readerfd) < 0)
+            {
+                perror("dup2");
+                retval = AGENTD_ERROR_PROTOCOLSERVICE_PRIVSEP_SETFDS_FAILURE;
+                goto done;
+            }
+
+            close(readersocks[i]);
+        }
+
         /* close any socket above the given value. */
         retval =
-            privsep_close_other_fds(AGENTD_FD_UNAUTHORIZED_PROTOSVC_NOTIFY);
+            privsep_close_other_fds(
+                AGENTD_FD_UNAUTHORIZED_PROTOSVC_ATTESTATION_WAKEUP
+                    + (int)datareadercount);
         if (0 != retval)
         {
             perror("privsep_close_other_fds");
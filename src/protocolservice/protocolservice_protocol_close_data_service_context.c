@@ -13,12 +13,12 @@
 
 #include "protocolservice_internal.h"
 
-RCPR_IMPORT_message;
-RCPR_IMPORT_resource;
-
 /**
  * \brief Close the data service context for this connection.
  *
+ * This closes the reader context, if one was opened, followed by the writer
+ * context.
+ *
  * \param ctx               The protocol service protocol fiber context.
  *
  * \returns a status code indicating success or failure.
@@ -28,90 +28,37 @@ RCPR_IMPORT_resource;
 status protocolservice_protocol_close_data_service_context(
     protocolservice_protocol_fiber_context* ctx)
 {
-    status retval, release_retval;
-    message* request = NULL;
-    protocolservice_dataservice_request_message* request_payload = NULL;
-    message* response = NULL;
+    status reader_retval = STATUS_SUCCESS;
+    status writer_retval = STATUS_SUCCESS;
 
     /* parameter sanity checks. */
     MODEL_ASSERT(prop_protocolservice_protocol_fiber_context_valid(ctx));
 
-    /* create the request payload. */
-    retval =
-        protocolservice_dataservice_request_message_create(
-            &request_payload, ctx, 0U,
-            PROTOCOLSERVICE_DATASERVICE_ENDPOINT_REQ_CONTEXT_CLOSE,
-            0U, ctx->return_addr, NULL);
-    if (STATUS_SUCCESS != retval)
+    /* close the reader context if opened. */
+    if (ctx->dataservice_reader_context_opened)
     {
-        goto done;
+        reader_retval =
+            protocolservice_protocol_close_data_service_endpoint_context(
+                ctx, ctx->data_reader_endpoint_addr);
+        ctx->dataservice_reader_context_opened = false;
     }
 
-    /* create the request message. */
-    retval =
-        message_create(&request, ctx->alloc, ctx->fiber_addr,
-        &request_payload->hdr);
-    if (STATUS_SUCCESS != retval)
+    /* close the writer context if opened. */
+    if (ctx->dataservice_context_opened)
     {
-        goto cleanup_request_payload;
+        writer_retval =
+            protocolservice_protocol_close_data_service_endpoint_context(
+                ctx, ctx->ctx->data_endpoint_addr);
+        ctx->dataservice_context_opened = false;
     }
 
-    /* the request payload is now owned by the request message. */
-    request_payload = NULL;
-
-    /* send the request message. */
-    retval =
-        message_send(ctx->ctx->data_endpoint_addr, request, ctx->ctx->msgdisc);
-    if (STATUS_SUCCESS != retval)
+    /* decode the appropriate return value. */
+    if (STATUS_SUCCESS != reader_retval)
     {
-        goto cleanup_request;
+        return reader_retval;
     }
-
-    /* the request message is now owned by the messaging discipline. */
-    request = NULL;
-
-    /* receive the response message. */
-    retval = message_receive(ctx->fiber_addr, &response, ctx->ctx->msgdisc);
-    if (STATUS_SUCCESS != retval)
-    {
-        goto done;
-    }
-
-    /* the context is now closed. */
-    ctx->dataservice_context_opened = false;
-
-    /* release the response message. */
-    release_retval = resource_release(message_resource_handle(response));
-    if (STATUS_SUCCESS != release_retval)
+    else
     {
-        retval = release_retval;
+        return writer_retval;
     }
-
-    /* return the status code of the response. */
-    goto done;
-
-cleanup_request:
-    if (NULL != request)
-    {
-        release_retval = resource_release(message_resource_handle(request));
-        if (STATUS_SUCCESS != release_retval)
-        {
-            retval = release_retval;
-        }
-        request = NULL;
-    }
-
-cleanup_request_payload:
-    if (NULL != request_payload)
-    {
-        release_retval = resource_release(&request_payload->hdr);
-        if (STATUS_SUCCESS != release_retval)
-        {
-            retval = release_retval;
-        }
-        request_payload = NULL;
-    }
-
-done:
-    return retval;
 }
@@ -77,6 +77,12 @@ status protocolservice_protocol_decode_and_dispatch(
                     ctx, request_offset, payload, payload_size);
             break;
 
+        case UNAUTH_PROTOCOL_REQ_ID_BLOCK_RANGE_GET:
+            retval =
+                protocolservice_protocol_dnd_block_range_get(
+                    ctx, request_offset, payload, payload_size);
+            break;
+
         case UNAUTH_PROTOCOL_REQ_ID_TRANSACTION_BY_ID_GET:
             retval =
                 protocolservice_protocol_dnd_transaction_by_id_get(
@@ -113,6 +119,12 @@ status protocolservice_protocol_decode_and_dispatch(
                     ctx, request_offset, payload, payload_size);
             break;
 
+        case UNAUTH_PROTOCOL_REQ_ID_ARTIFACT_TXN_LIST_GET:
+            retval =
+                protocolservice_protocol_dnd_artifact_transaction_list_get(
+                    ctx, request_offset, payload, payload_size);
+            break;
+
         case UNAUTH_PROTOCOL_REQ_ID_ASSERT_LATEST_BLOCK_ID:
             retval =
                 protocolservice_protocol_dnd_assert_latest_block_id(
@@ -0,0 +1,115 @@
+/**
+ * \file protocolservice/protocolservice_protocol_dnd_artifact_transaction_list_get.c
+ *
+ * \brief Decode and dispatch an artifact transaction list get request.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/dataservice/async_api.h>
+#include <agentd/inet.h>
+#include <agentd/status_codes.h>
+#include <cbmc/model_assert.h>
+#include <string.h>
+
+#include "protocolservice_internal.h"
+
+RCPR_IMPORT_uuid;
+
+/**
+ * \brief Decode and dispatch an artifact transaction list get request.
+ *
+ * \param ctx               The protocol service protocol fiber context.
+ * \param request_offset    The request offset of the packet.
+ * \param payload           The payload of the packet.
+ * \param payload_size      The size of the payload.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_protocol_dnd_artifact_transaction_list_get(
+    protocolservice_protocol_fiber_context* ctx, uint32_t request_offset,
+    const uint8_t* payload, size_t payload_size)
+{
+    status retval;
+    vccrypt_buffer_t reqbuf;
+    rcpr_uuid artifact_id;
+    uint64_t net_start_height;
+    uint32_t net_start_index;
+    uint32_t net_max_count;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_protocolservice_protocol_fiber_context_valid(ctx));
+    MODEL_ASSERT(NULL != payload);
+
+    /* | Artifact transaction list get request.                             | */
+    /* | ----------------------------------------------------- | ---------- | */
+    /* | DATA                                                  | SIZE       | */
+    /* | ----------------------------------------------------- | ---------- | */
+    /* | UNAUTH_PROTOCOL_REQ_ID_ARTIFACT_TXN_LIST_GET          |  4 bytes   | */
+    /* | offset                                                |  4 bytes   | */
+    /* | artifact_id                                           | 16 bytes   | */
+    /* | start_height                                          |  8 bytes   | */
+    /* | start_index                                           |  4 bytes   | */
+    /* | max_count                                             |  4 bytes   | */
+    /* | ----------------------------------------------------- | ---------- | */
+
+    /* verify the request size. */
+    const size_t header_size = 2 * sizeof(uint32_t);
+    if (payload_size !=
+            header_size + sizeof(artifact_id) + sizeof(net_start_height)
+                + sizeof(net_start_index) + sizeof(net_max_count))
+    {
+        retval = AGENTD_ERROR_PROTOCOLSERVICE_MALFORMED_REQUEST;
+        goto done;
+    }
+
+    /* decode the request parameters. */
+    const uint8_t* breq = payload + header_size;
+    memcpy(&artifact_id, breq, sizeof(artifact_id));
+    breq += sizeof(artifact_id);
+    memcpy(&net_start_height, breq, sizeof(net_start_height));
+    breq += sizeof(net_start_height);
+    memcpy(&net_start_index, breq, sizeof(net_start_index));
+    breq += sizeof(net_start_index);
+    memcpy(&net_max_count, breq, sizeof(net_max_count));
+
+    /* a page must hold at least one transaction. */
+    uint32_t max_count = ntohl(net_max_count);
+    if (0U == max_count)
+    {
+        retval = AGENTD_ERROR_PROTOCOLSERVICE_MALFORMED_REQUEST;
+        goto done;
+    }
+
+    /* encode the request to the dataservice endpoint. */
+    retval =
+        dataservice_encode_request_artifact_transaction_list_get(
+            &reqbuf, &ctx->ctx->vpr_alloc, 0U, &artifact_id,
+            ntohll(net_start_height), ntohl(net_start_index), max_count);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* send this message to the dataservice endpoint. */
+    retval =
+        protocolservice_dataservice_send_request(
+            ctx, UNAUTH_PROTOCOL_REQ_ID_ARTIFACT_TXN_LIST_GET, request_offset,
+            &reqbuf);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_reqbuf;
+    }
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    goto cleanup_reqbuf;
+
+cleanup_reqbuf:
+    dispose((disposable_t*)&reqbuf);
+
+done:
+    return retval;
+}
@@ -46,6 +46,17 @@ status protocolservice_protocol_dnd_block_by_id_get(
         goto done;
     }
 
+    /* answer from the certificate cache if possible. */
+    retval =
+        protocolservice_cert_cache_send_response(
+            ctx, req.request_id, request_offset,
+            PROTOCOLSERVICE_CERT_CACHE_TYPE_BLOCK,
+            (const rcpr_uuid*)&req.block_id, true);
+    if (AGENTD_ERROR_DATASERVICE_NOT_FOUND != retval)
+    {
+        goto cleanup_req;
+    }
+
     /* encode the request to the dataservice endpoint. */
     retval = 0;
         dataservice_encode_request_block_get(
@@ -47,11 +47,22 @@ status protocolservice_protocol_dnd_block_id_prev_get(
         goto done;
     }
 
+    /* answer from the certificate cache if possible. */
+    retval =
+        protocolservice_cert_cache_send_response(
+            ctx, req.request_id, request_offset,
+            PROTOCOLSERVICE_CERT_CACHE_TYPE_BLOCK,
+            (const rcpr_uuid*)&req.block_id, false);
+    if (AGENTD_ERROR_DATASERVICE_NOT_FOUND != retval)
+    {
+        goto cleanup_req;
+    }
+
     /* encode the request to the dataservice endpoint. */
-    retval = 0;
-        dataservice_encode_request_block_get(
-            &reqbuf, &ctx->ctx->vpr_alloc, 0U, (const rcpr_uuid*)&req.block_id,
-            false);
+    retval =
+        dataservice_encode_request_block_id_prev_get(
+            &reqbuf, &ctx->ctx->vpr_alloc, 0U,
+            (const rcpr_uuid*)&req.block_id);
     if (STATUS_SUCCESS != retval)
     {
         goto cleanup_req;
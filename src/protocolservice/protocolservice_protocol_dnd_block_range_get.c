@@ -0,0 +1,112 @@
+/**
+ * \file protocolservice/protocolservice_protocol_dnd_block_range_get.c
+ *
+ * \brief Decode and dispatch a block range get request.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/inet.h>
+#include <agentd/status_codes.h>
+#include <cbmc/model_assert.h>
+#include <string.h>
+
+#include "protocolservice_internal.h"
+
+/**
+ * \brief Decode and dispatch a block range get request.
+ *
+ * The blocks are streamed back to the client as one response packet per block.
+ * Only one block range stream may be active on a connection at a time.
+ *
+ * \param ctx               The protocol service protocol fiber context.
+ * \param request_offset    The request offset of the packet.
+ * \param payload           The payload of the packet.
+ * \param payload_size      The size of the payload.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_protocol_dnd_block_range_get(
+    protocolservice_protocol_fiber_context* ctx, uint32_t request_offset,
+    const uint8_t* payload, size_t payload_size)
+{
+    status retval;
+    uint64_t net_start_height;
+    uint32_t net_max_count;
+    uint32_t net_max_bytes;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_protocolservice_protocol_fiber_context_valid(ctx));
+    MODEL_ASSERT(NULL != payload);
+
+    /* | Block range get request.                                           | */
+    /* | ----------------------------------------------------- | ---------- | */
+    /* | DATA                                                  | SIZE       | */
+    /* | ----------------------------------------------------- | ---------- | */
+    /* | UNAUTH_PROTOCOL_REQ_ID_BLOCK_RANGE_GET                |  4 bytes   | */
+    /* | offset                                                |  4 bytes   | */
+    /* | start_height                                          |  8 bytes   | */
+    /* | max_count                                             |  4 bytes   | */
+    /* | max_bytes                                             |  4 bytes   | */
+    /* | ----------------------------------------------------- | ---------- | */
+
+    /* verify the request size. */
+    const size_t header_size = 2 * sizeof(uint32_t);
+    if (payload_size !=
+            header_size + sizeof(net_start_height) + sizeof(net_max_count)
+                + sizeof(net_max_bytes))
+    {
+        retval = AGENTD_ERROR_PROTOCOLSERVICE_MALFORMED_REQUEST;
+        goto done;
+    }
+
+    /* decode the request parameters. */
+    const uint8_t* breq = payload + header_size;
+    memcpy(&net_start_height, breq, sizeof(net_start_height));
+    breq += sizeof(net_start_height);
+    memcpy(&net_max_count, breq, sizeof(net_max_count));
+    breq += sizeof(net_max_count);
+    memcpy(&net_max_bytes, breq, sizeof(net_max_bytes));
+
+    /* a range must hold at least one block. */
+    uint32_t max_count = ntohl(net_max_count);
+    if (0U == max_count)
+    {
+        retval = AGENTD_ERROR_PROTOCOLSERVICE_MALFORMED_REQUEST;
+        goto done;
+    }
+
+    /* only one stream can be active at a time. */
+    if (ctx->block_range_active)
+    {
+        retval = AGENTD_ERROR_PROTOCOLSERVICE_BLOCK_RANGE_ALREADY_ACTIVE;
+        goto done;
+    }
+
+    /* set up the stream; a zero byte budget means no byte limit. */
+    uint32_t max_bytes = ntohl(net_max_bytes);
+    ctx->block_range_active = true;
+    ctx->block_range_client_offset = request_offset;
+    ctx->block_range_next_height = ntohll(net_start_height);
+    ctx->block_range_remaining_count = max_count;
+    ctx->block_range_remaining_bytes =
+        (0U == max_bytes) ? UINT64_MAX : (uint64_t)max_bytes;
+    ctx->block_range_sent = false;
+
+    /* request the first chunk. */
+    retval = protocolservice_block_range_request_chunk(ctx);
+    if (STATUS_SUCCESS != retval)
+    {
+        ctx->block_range_active = false;
+        goto done;
+    }
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    goto done;
+
+done:
+    return retval;
+}
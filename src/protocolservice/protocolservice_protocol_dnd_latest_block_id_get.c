@@ -11,10 +11,15 @@
 #include <cbmc/model_assert.h>
 #include <string.h>
 #include <unistd.h>
+#include <vcblockchain/protocol/serialization.h>
 #include <vcblockchain/psock.h>
 
 #include "protocolservice_internal.h"
 
+/* forward decls. */
+static status protocolservice_protocol_dnd_latest_block_id_get_cached(
+    protocolservice_protocol_fiber_context* ctx, uint32_t request_offset);
+
 /**
  * \brief Decode and dispatch a latest block id get request.
  *
@@ -37,6 +42,20 @@ status protocolservice_protocol_dnd_latest_block_id_get(
     /* parameter sanity checks. */
     MODEL_ASSERT(prop_protocolservice_protocol_fiber_context_valid(ctx));
 
+    /* answer from the cache if the latest block id is still valid.  The
+     * dataservice enforces this capability for uncached requests. */
+    if (
+        ctx->ctx->latest_block_id_cached
+     && protocolservice_authorized_entity_capability_check(
+            ctx->entity, &ctx->entity_uuid,
+            &PROTOCOLSERVICE_API_CAPABILITY_BLOCK_ID_LATEST_READ,
+            &ctx->ctx->agentd_uuid))
+    {
+        return
+            protocolservice_protocol_dnd_latest_block_id_get_cached(
+                ctx, request_offset);
+    }
+
     /* encode this request. */
     retval =
         dataservice_encode_request_latest_block_id_get(
@@ -66,3 +85,42 @@ cleanup_reqbuf:
 done:
     return retval;
 }
+
+/**
+ * \brief Answer a latest block id get request from the cache.
+ *
+ * \param ctx               The protocol service protocol fiber context.
+ * \param request_offset    The request offset of the packet.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status protocolservice_protocol_dnd_latest_block_id_get_cached(
+    protocolservice_protocol_fiber_context* ctx, uint32_t request_offset)
+{
+    status retval;
+    vccrypt_buffer_t respbuf;
+
+    /* build the response. */
+    retval =
+        vcblockchain_protocol_encode_resp_latest_block_id_get(
+            &respbuf, &ctx->ctx->vpr_alloc, request_offset, STATUS_SUCCESS,
+            (const vpr_uuid*)&ctx->ctx->latest_block_id);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* send the response to the protocol write endpoint. */
+    retval =
+        protocolservice_protocol_send_local_response(
+            ctx, UNAUTH_PROTOCOL_REQ_ID_LATEST_BLOCK_ID_GET, request_offset,
+            &respbuf);
+
+    /* clean up. */
+    dispose((disposable_t*)&respbuf);
+
+done:
+    return retval;
+}
@@ -7,6 +7,7 @@
  */
 
 #include <agentd/dataservice/async_api.h>
+#include <agentd/status_codes.h>
 #include <vcblockchain/protocol/serialization.h>
 
 #include "protocolservice_internal.h"
@@ -45,6 +46,17 @@ status protocolservice_protocol_dnd_transaction_by_id_get(
         goto done;
     }
 
+    /* answer from the certificate cache if possible. */
+    retval =
+        protocolservice_cert_cache_send_response(
+            ctx, req.request_id, request_offset,
+            PROTOCOLSERVICE_CERT_CACHE_TYPE_TRANSACTION,
+            (const rcpr_uuid*)&req.txn_id, true);
+    if (AGENTD_ERROR_DATASERVICE_NOT_FOUND != retval)
+    {
+        goto cleanup_req;
+    }
+
     /* encode the request to the dataservice endpoint. */
     retval = 0;
         dataservice_encode_request_canonized_transaction_get(
@@ -31,6 +31,7 @@ status protocolservice_protocol_fiber_context_release(RCPR_SYM(resource)* r)
 {
     status dataservice_context_release_retval = STATUS_SUCCESS;
     status protosock_release_retval = STATUS_SUCCESS;
+    status write_buffer_release_retval = STATUS_SUCCESS;
     status mailbox_close_retval = STATUS_SUCCESS;
     status fiber_mailbox_close_retval = STATUS_SUCCESS;
     status context_release_retval = STATUS_SUCCESS;
@@ -68,6 +69,13 @@ status protocolservice_protocol_fiber_context_release(RCPR_SYM(resource)* r)
             protocolservice_protocol_close_data_service_context(ctx);
     }
 
+    /* release any unflushed write buffer. */
+    if (NULL != ctx->write_buffer)
+    {
+        write_buffer_release_retval =
+            resource_release(psock_resource_handle(ctx->write_buffer));
+    }
+
     /* release the protocol socket. */
     if (NULL != ctx->protosock)
     {
@@ -139,6 +147,10 @@ status protocolservice_protocol_fiber_context_release(RCPR_SYM(resource)* r)
     {
         return dataservice_context_release_retval;
     }
+    else if (STATUS_SUCCESS != write_buffer_release_retval)
+    {
+        return write_buffer_release_retval;
+    }
     else if (STATUS_SUCCESS != protosock_release_retval)
     {
         return protosock_release_retval;
@@ -61,6 +61,19 @@ status protocolservice_protocol_fiber_entry(void* vctx)
     /* decode-and-dispatch loop. */
     while (!ctx->ctx->quiesce && !ctx->shutdown && !ctx->req_shutdown)
     {
+        /* don't read another request until there is room for it. */
+        retval = protocolservice_protocol_request_window_wait(ctx);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto shutdown_write_endpoint;
+        }
+
+        /* the window may have closed because we are shutting down. */
+        if (ctx->ctx->quiesce || ctx->shutdown || ctx->req_shutdown)
+        {
+            break;
+        }
+
         retval = protocolservice_protocol_read_decode_and_dispatch_packet(ctx);
         if (STATUS_SUCCESS != retval)
         {
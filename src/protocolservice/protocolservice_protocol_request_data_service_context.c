@@ -13,12 +13,14 @@
 
 #include "protocolservice_internal.h"
 
-RCPR_IMPORT_message;
-RCPR_IMPORT_resource;
-
 /**
  * \brief Request a data service context for this connection.
  *
+ * A context is always opened on the writer endpoint.  If the protocol service
+ * has a pool of read-only data service endpoints, then a context is also
+ * opened on the next reader in the pool, and read requests for this
+ * connection are routed to that reader.
+ *
  * \param ctx               The protocol service protocol fiber context.
  *
  * \returns a status code indicating success or failure.
@@ -28,99 +30,54 @@ RCPR_IMPORT_resource;
 status protocolservice_protocol_request_data_service_context(
     protocolservice_protocol_fiber_context* ctx)
 {
-    status retval, release_retval;
-    message* request = NULL;
-    protocolservice_dataservice_request_message* request_payload = NULL;
-    message* response = NULL;
+    status retval;
 
     /* parameter sanity checks. */
     MODEL_ASSERT(prop_protocolservice_protocol_fiber_context_valid(ctx));
 
-    /* create the request payload. */
+    /* request a context from the writer endpoint. */
     retval =
-        protocolservice_dataservice_request_message_create(
-            &request_payload, ctx, 0U,
-            PROTOCOLSERVICE_DATASERVICE_ENDPOINT_REQ_CONTEXT_OPEN,
-            0U, ctx->return_addr, NULL);
+        protocolservice_protocol_request_data_service_endpoint_context(
+            ctx, ctx->ctx->data_endpoint_addr);
     if (STATUS_SUCCESS != retval)
     {
         goto done;
     }
 
-    /* create the capabilities set for this user, saved to the payload. */
-    retval =
-        protocolservice_dataservice_map_user_capabilities(
-            &request_payload->payload, ctx);
-    if (STATUS_SUCCESS != retval)
-    {
-        goto cleanup_request_payload;
-    }
+    /* the context is now opened. */
+    ctx->dataservice_context_opened = true;
 
-    /* create the request message. */
-    retval =
-        message_create(&request, ctx->alloc, ctx->fiber_addr,
-        &request_payload->hdr);
-    if (STATUS_SUCCESS != retval)
+    /* if there is no reader pool, then we're done. */
+    if (0 == ctx->ctx->data_reader_endpoint_count)
     {
-        goto cleanup_request_payload;
+        retval = STATUS_SUCCESS;
+        goto done;
     }
 
-    /* the request payload is now owned by the request message. */
-    request_payload = NULL;
+    /* assign the next reader in the pool to this connection. */
+    ctx->data_reader_endpoint_addr =
+        ctx->ctx->data_reader_endpoint_addrs[
+            ctx->ctx->data_reader_endpoint_next];
+    ctx->ctx->data_reader_endpoint_next =
+        (ctx->ctx->data_reader_endpoint_next + 1)
+            % ctx->ctx->data_reader_endpoint_count;
 
-    /* send the request message. */
+    /* request a context from the reader endpoint. */
     retval =
-        message_send(ctx->ctx->data_endpoint_addr, request, ctx->ctx->msgdisc);
-    if (STATUS_SUCCESS != retval)
-    {
-        goto cleanup_request;
-    }
-
-    /* the request message is now owned by the messaging discipline. */
-    request = NULL;
-
-    /* receive the response message. */
-    retval = message_receive(ctx->fiber_addr, &response, ctx->ctx->msgdisc);
+        protocolservice_protocol_request_data_service_endpoint_context(
+            ctx, ctx->data_reader_endpoint_addr);
     if (STATUS_SUCCESS != retval)
     {
         goto done;
     }
 
-    /* the context is now opened. */
-    ctx->dataservice_context_opened = true;
-
-    /* release the response message. */
-    release_retval = resource_release(message_resource_handle(response));
-    if (STATUS_SUCCESS != release_retval)
-    {
-        retval = release_retval;
-    }
+    /* the reader context is now opened. */
+    ctx->dataservice_reader_context_opened = true;
 
-    /* return the status code of the response. */
+    /* success. */
+    retval = STATUS_SUCCESS;
     goto done;
 
-cleanup_request:
-    if (NULL != request)
-    {
-        release_retval = resource_release(message_resource_handle(request));
-        if (STATUS_SUCCESS != release_retval)
-        {
-            retval = release_retval;
-        }
-        request = NULL;
-    }
-
-cleanup_request_payload:
-    if (NULL != request_payload)
-    {
-        release_retval = resource_release(&request_payload->hdr);
-        if (STATUS_SUCCESS != release_retval)
-        {
-            retval = release_retval;
-        }
-        request_payload = NULL;
-    }
-
 done:
     return retval;
 }
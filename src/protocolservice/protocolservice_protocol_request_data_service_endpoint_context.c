@@ -0,0 +1,152 @@
+/**
+ * \file protocolservice/protocolservice_protocol_request_data_service_endpoint_context.c
+ *
+ * \brief Send a context open request to a given data service endpoint.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <arpa/inet.h>
+#include <cbmc/model_assert.h>
+#include <agentd/status_codes.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "protocolservice_internal.h"
+
+RCPR_IMPORT_message;
+RCPR_IMPORT_resource;
+
+/**
+ * \brief Request a data service context for this connection from the given
+ * data service endpoint.
+ *
+ * \param ctx               The protocol service protocol fiber context.
+ * \param endpoint_addr     The mailbox address of the data service endpoint.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - the dataservice error status if the context could not be opened.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_protocol_request_data_service_endpoint_context(
+    protocolservice_protocol_fiber_context* ctx,
+    RCPR_SYM(mailbox_address) endpoint_addr)
+{
+    status retval, release_retval;
+    message* request = NULL;
+    protocolservice_dataservice_request_message* request_payload = NULL;
+    message* response = NULL;
+    protocolservice_protocol_write_endpoint_message* response_payload;
+    uint32_t net_status;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_protocolservice_protocol_fiber_context_valid(ctx));
+
+    /* create the request payload. */
+    retval =
+        protocolservice_dataservice_request_message_create(
+            &request_payload, ctx, 0U,
+            PROTOCOLSERVICE_DATASERVICE_ENDPOINT_REQ_CONTEXT_OPEN,
+            0U, ctx->return_addr, NULL);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* create the capabilities set for this user, saved to the payload. */
+    retval =
+        protocolservice_dataservice_map_user_capabilities(
+            &request_payload->payload, ctx);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_request_payload;
+    }
+
+    /* create the request message. */
+    retval =
+        message_create(&request, ctx->alloc, ctx->fiber_addr,
+        &request_payload->hdr);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_request_payload;
+    }
+
+    /* the request payload is now owned by the request message. */
+    request_payload = NULL;
+
+    /* send the request message. */
+    retval =
+        message_send(endpoint_addr, request, ctx->ctx->msgdisc);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_request;
+    }
+
+    /* the request message is now owned by the messaging discipline. */
+    request = NULL;
+
+    /* receive the response message. */
+    retval = message_receive(ctx->fiber_addr, &response, ctx->ctx->msgdisc);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* get the response payload. */
+    response_payload =
+        (protocolservice_protocol_write_endpoint_message*)message_payload(
+            response, false);
+
+    /* if the context could not be opened, return the error status. */
+    if (PROTOCOLSERVICE_PROTOCOL_WRITE_ENDPOINT_ERROR_MESSAGE
+            == response_payload->message_type)
+    {
+        if (sizeof(net_status) == response_payload->payload.size)
+        {
+            memcpy(
+                &net_status, response_payload->payload.data,
+                sizeof(net_status));
+            retval = (status)ntohl(net_status);
+        }
+        else
+        {
+            retval = AGENTD_ERROR_PROTOCOLSERVICE_MALFORMED_RESPONSE;
+        }
+    }
+
+    /* release the response message. */
+    release_retval = resource_release(message_resource_handle(response));
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    /* return the status code of the response. */
+    goto done;
+
+cleanup_request:
+    if (NULL != request)
+    {
+        release_retval = resource_release(message_resource_handle(request));
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+        request = NULL;
+    }
+
+cleanup_request_payload:
+    if (NULL != request_payload)
+    {
+        release_retval = resource_release(&request_payload->hdr);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+        request_payload = NULL;
+    }
+
+done:
+    return retval;
+}
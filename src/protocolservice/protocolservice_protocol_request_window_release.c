@@ -0,0 +1,128 @@
+/**
+ * \file protocolservice/protocolservice_protocol_request_window_release.c
+ *
+ * \brief Release a slot in a connection's request window.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <agentd/status_codes.h>
+#include <string.h>
+
+#include "protocolservice_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+RCPR_IMPORT_message;
+RCPR_IMPORT_resource;
+
+/**
+ * \brief Release a slot in this connection's request window.
+ *
+ * This is called by the write endpoint when a dataservice response arrives.
+ * If the protocol fiber is waiting for a slot, and either a slot is now open
+ * or the connection is shutting down, it is woken.
+ *
+ * \param ctx               The protocol service protocol fiber context.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_protocol_request_window_release(
+    protocolservice_protocol_fiber_context* ctx)
+{
+    status retval, release_retval;
+    protocolservice_protocol_write_endpoint_message* payload = NULL;
+    message* msg = NULL;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_protocolservice_protocol_fiber_context_valid(ctx));
+
+    /* this response frees up a slot. */
+    if (ctx->requests_in_flight > 0U)
+    {
+        --ctx->requests_in_flight;
+    }
+
+    /* only wake the protocol fiber if it is blocked waiting for a slot. */
+    if (!ctx->request_window_wait
+     || (ctx->requests_in_flight >= PROTOCOLSERVICE_MAX_REQUESTS_IN_FLIGHT
+      && !ctx->ctx->quiesce && !ctx->shutdown && !ctx->req_shutdown))
+    {
+        return STATUS_SUCCESS;
+    }
+
+    /* allocate memory for the message payload. */
+    retval =
+        rcpr_allocator_allocate(ctx->alloc, (void**)&payload, sizeof(*payload));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* clear payload memory. */
+    memset(payload, 0, sizeof(*payload));
+
+    /* initialize payload resource. */
+    resource_init(
+        &payload->hdr,
+        &protocolservice_protocol_write_endpoint_message_release);
+
+    /* set init values. */
+    payload->alloc = ctx->alloc;
+    payload->message_type =
+        PROTOCOLSERVICE_PROTOCOL_WRITE_ENDPOINT_REQUEST_WINDOW_OPEN;
+
+    /* wrap this payload in a message envelope. */
+    retval = message_create(&msg, ctx->alloc, ctx->return_addr, &payload->hdr);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_payload;
+    }
+
+    /* the payload is now owned by the message. */
+    payload = NULL;
+
+    /* wake the protocol fiber. */
+    retval = message_send(ctx->fiber_addr, msg, ctx->ctx->msgdisc);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_message;
+    }
+
+    /* the message is now owned by the message discipline. */
+    msg = NULL;
+
+    /* only one wake message per wait. */
+    ctx->request_window_wait = false;
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    goto done;
+
+cleanup_message:
+    if (NULL != msg)
+    {
+        release_retval = resource_release(message_resource_handle(msg));
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+        msg = NULL;
+    }
+
+cleanup_payload:
+    if (NULL != payload)
+    {
+        release_retval = resource_release(&payload->hdr);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+        payload = NULL;
+    }
+
+done:
+    return retval;
+}
@@ -0,0 +1,64 @@
+/**
+ * \file protocolservice/protocolservice_protocol_request_window_wait.c
+ *
+ * \brief Wait for room in a connection's request window.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <agentd/status_codes.h>
+
+#include "protocolservice_internal.h"
+
+RCPR_IMPORT_message;
+RCPR_IMPORT_resource;
+
+/**
+ * \brief Wait until this connection has room for another outstanding request.
+ *
+ * If the number of dataservice requests in flight for this connection has
+ * reached \ref PROTOCOLSERVICE_MAX_REQUESTS_IN_FLIGHT, then the protocol fiber
+ * blocks on its mailbox until the write endpoint releases a slot or the
+ * connection is shutting down.
+ *
+ * \param ctx               The protocol service protocol fiber context.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_protocol_request_window_wait(
+    protocolservice_protocol_fiber_context* ctx)
+{
+    status retval;
+    message* msg;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_protocolservice_protocol_fiber_context_valid(ctx));
+
+    while (
+        ctx->requests_in_flight >= PROTOCOLSERVICE_MAX_REQUESTS_IN_FLIGHT
+     && !ctx->ctx->quiesce && !ctx->shutdown && !ctx->req_shutdown)
+    {
+        /* let the write endpoint know that we are waiting for a slot. */
+        ctx->request_window_wait = true;
+
+        /* wait for the write endpoint to wake us. */
+        retval = message_receive(ctx->fiber_addr, &msg, ctx->ctx->msgdisc);
+        ctx->request_window_wait = false;
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        /* the wake message carries no data. */
+        retval = resource_release(message_resource_handle(msg));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    return STATUS_SUCCESS;
+}
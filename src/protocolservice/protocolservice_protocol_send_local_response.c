@@ -0,0 +1,102 @@
+/**
+ * \file protocolservice/protocolservice_protocol_send_local_response.c
+ *
+ * \brief Send a locally built response to the protocol write endpoint.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+
+#include "protocolservice_internal.h"
+
+RCPR_IMPORT_message;
+RCPR_IMPORT_resource;
+
+/**
+ * \brief Send a response packet built by the protocol fiber to the protocol
+ * write endpoint.
+ *
+ * This is used for requests answered without a dataservice round trip.
+ *
+ * \param ctx               The protocol service protocol fiber context.
+ * \param request_id        The protocol request id.
+ * \param request_offset    The protocol request offset.
+ * \param respbuf           The encoded response packet.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_protocol_send_local_response(
+    protocolservice_protocol_fiber_context* ctx, uint32_t request_id,
+    uint32_t request_offset, const vccrypt_buffer_t* respbuf)
+{
+    status retval, release_retval;
+    protocolservice_protocol_write_endpoint_message* reply_payload = NULL;
+    message* reply_msg = NULL;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_protocolservice_protocol_fiber_context_valid(ctx));
+    MODEL_ASSERT(NULL != respbuf);
+
+    /* wrap the response in a write endpoint packet. */
+    retval =
+        protocolservice_protocol_write_endpoint_message_create(
+            &reply_payload, ctx->ctx,
+            PROTOCOLSERVICE_PROTOCOL_WRITE_ENDPOINT_PACKET, request_id,
+            request_offset, respbuf->data, respbuf->size);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* wrap this payload in a message envelope. */
+    retval =
+        message_create(
+            &reply_msg, ctx->alloc, ctx->return_addr, &reply_payload->hdr);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_reply_payload;
+    }
+
+    /* the payload is now owned by the message. */
+    reply_payload = NULL;
+
+    /* send the message to the protocol write endpoint. */
+    retval = message_send(ctx->return_addr, reply_msg, ctx->ctx->msgdisc);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_reply_msg;
+    }
+
+    /* the message is now owned by the message discipline. */
+    reply_msg = NULL;
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    goto done;
+
+cleanup_reply_msg:
+    if (NULL != reply_msg)
+    {
+        release_retval = resource_release(message_resource_handle(reply_msg));
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+cleanup_reply_payload:
+    if (NULL != reply_payload)
+    {
+        release_retval = resource_release(&reply_payload->hdr);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+done:
+    return retval;
+}
@@ -0,0 +1,44 @@
+/**
+ * \file
+ * protocolservice/protocolservice_protocol_write_endpoint_buffer_begin.c
+ *
+ * \brief Start buffering packets written to the peer.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <agentd/status_codes.h>
+
+#include "protocolservice_internal.h"
+
+RCPR_IMPORT_psock;
+
+/**
+ * \brief Buffer the packets written for the current message.
+ *
+ * A message that produces more than one packet calls this before writing
+ * them, so that \ref protocolservice_protocol_write_endpoint_flush sends them
+ * all in a single write. Messages that produce a single packet write it
+ * directly to the peer and never pay for the buffer.
+ *
+ * \param ctx           The protocol service protocol fiber context.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_protocol_write_endpoint_buffer_begin(
+    protocolservice_protocol_fiber_context* ctx)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_protocolservice_protocol_fiber_context_valid(ctx));
+
+    /* packets are already being buffered. */
+    if (NULL != ctx->write_buffer)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    return psock_create_from_buffer(&ctx->write_buffer, ctx->alloc, NULL, 0);
+}
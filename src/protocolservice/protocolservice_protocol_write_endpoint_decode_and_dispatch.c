@@ -29,6 +29,7 @@ RCPR_IMPORT_message;
 status protocolservice_protocol_write_endpoint_decode_and_dispatch(
     protocolservice_protocol_fiber_context* ctx, RCPR_SYM(message)* msg)
 {
+    status retval;
     protocolservice_protocol_write_endpoint_message* payload = NULL;
 
     /* parameter sanity checks. */
@@ -53,10 +54,26 @@ status protocolservice_protocol_write_endpoint_decode_and_dispatch(
 
         /* decode and dispatch for datasservice response messages. */
         case PROTOCOLSERVICE_PROTOCOL_WRITE_ENDPOINT_DATASERVICE_MSG:
+            retval = protocolservice_protocol_request_window_release(ctx);
+            if (STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+
             return
                 protocolservice_pwe_dnd_dataservice_message(
                     ctx, payload);
 
+        /* a dataservice request failed in the endpoint. */
+        case PROTOCOLSERVICE_PROTOCOL_WRITE_ENDPOINT_ERROR_MESSAGE:
+            retval = protocolservice_protocol_request_window_release(ctx);
+            if (STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+
+            return protocolservice_pwe_dnd_error_message(ctx, payload);
+
         /* decode and dispatch for notification service responses. */
         case PROTOCOLSERVICE_PROTOCOL_WRITE_ENDPOINT_NOTIFICATION_MSG:
             return
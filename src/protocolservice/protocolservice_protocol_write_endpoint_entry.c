@@ -62,6 +62,13 @@ status protocolservice_protocol_write_endpoint_entry(void* vctx)
         {
             goto cleanup_context;
         }
+
+        /* write any packets produced by this message in a single write. */
+        retval = protocolservice_protocol_write_endpoint_flush(ctx);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_context;
+        }
     }
 
     /* we are shutting down. */
@@ -75,7 +82,22 @@ cleanup_message:
         retval = release_retval;
     }
 
+    /* send anything that was written before the failure. */
+    release_retval = protocolservice_protocol_write_endpoint_flush(ctx);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
 cleanup_context:
+    /* don't leave the protocol fiber waiting on a response that won't come. */
+    ctx->req_shutdown = true;
+    release_retval = protocolservice_protocol_request_window_release(ctx);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
     release_retval = resource_release(&ctx->hdr);
     if (STATUS_SUCCESS != release_retval)
     {
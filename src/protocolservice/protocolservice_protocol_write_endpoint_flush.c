@@ -0,0 +1,81 @@
+/**
+ * \file protocolservice/protocolservice_protocol_write_endpoint_flush.c
+ *
+ * \brief Flush buffered packets to the peer.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <agentd/status_codes.h>
+
+#include "protocolservice_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+RCPR_IMPORT_psock;
+RCPR_IMPORT_resource;
+
+/**
+ * \brief Flush any packets buffered by the write endpoint to the peer.
+ *
+ * Messages that produce more than one packet encrypt them into an in-memory
+ * buffer started by \ref protocolservice_protocol_write_endpoint_buffer_begin.
+ * This function writes the buffered packets to the peer socket in a single
+ * write and releases the buffer, so that the next message writes directly to
+ * the peer unless it also asks to be buffered.
+ *
+ * \param ctx           The protocol service protocol fiber context.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_protocol_write_endpoint_flush(
+    protocolservice_protocol_fiber_context* ctx)
+{
+    status retval, release_retval;
+    void* buffer = NULL;
+    size_t size = 0U;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_protocolservice_protocol_fiber_context_valid(ctx));
+
+    /* if nothing has been buffered, there is nothing to do. */
+    if (NULL == ctx->write_buffer)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    /* get the buffered packets. */
+    retval =
+        psock_from_buffer_get_output_buffer(
+            ctx->write_buffer, ctx->alloc, &buffer, &size);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto release_write_buffer;
+    }
+
+    /* write all buffered packets to the peer at once. */
+    if (size > 0U)
+    {
+        retval = psock_write_raw_data(ctx->protosock, buffer, size);
+    }
+
+    /* clean up the output buffer. */
+    release_retval = rcpr_allocator_reclaim(ctx->alloc, buffer);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+release_write_buffer:
+    /* the next packet starts a new buffer. */
+    release_retval = resource_release(psock_resource_handle(ctx->write_buffer));
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+    ctx->write_buffer = NULL;
+
+    return retval;
+}
@@ -29,15 +29,8 @@ status protocolservice_protocol_write_endpoint_write_packet(
     protocolservice_protocol_fiber_context* ctx,
     const protocolservice_protocol_write_endpoint_message* msg)
 {
-    /* encrypt and write the message to the endpoint. */
-    status retval =
-        psock_write_authed_data(
-            ctx->protosock, ctx->server_iv, msg->payload.data,
-            msg->payload.size, &ctx->ctx->suite, &ctx->shared_secret);
-
-    /* update the server iv. */
-    ++ctx->server_iv;
-
-    /* return the result of the write to the caller. */
-    return retval;
+    /* encrypt and buffer the message for the endpoint. */
+    return
+        protocolservice_protocol_write_endpoint_write_raw_packet(
+            ctx, msg->payload.data, msg->payload.size);
 }
@@ -16,6 +16,11 @@ RCPR_IMPORT_psock;
 /**
  * \brief Write a packet to the peer.
  *
+ * If \ref protocolservice_protocol_write_endpoint_buffer_begin has been called
+ * for the current message, the packet is buffered until the next call to
+ * \ref protocolservice_protocol_write_endpoint_flush. Otherwise, it is written
+ * directly to the peer.
+ *
  * \param ctx           The protocol service protocol fiber context.
  * \param msg           The raw message buffer to write.
  * \param size          The size of the message buffer to write.
@@ -29,10 +34,14 @@ status protocolservice_protocol_write_endpoint_write_raw_packet(
 {
     status retval;
 
-    /* write the raw packet to the peer as an authed packet. */
-    retval = 
+    /* write to the buffer if this message is buffered, else to the peer. */
+    psock* sock =
+        (NULL != ctx->write_buffer) ? ctx->write_buffer : ctx->protosock;
+
+    /* write the raw packet as an authed packet. */
+    retval =
         psock_write_authed_data(
-            ctx->protosock, ctx->server_iv, msg, size, &ctx->ctx->suite,
+            sock, ctx->server_iv, msg, size, &ctx->ctx->suite,
             &ctx->shared_secret);
 
     /* update the server iv. */
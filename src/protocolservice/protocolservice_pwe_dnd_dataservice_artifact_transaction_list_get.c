@@ -0,0 +1,123 @@
+/**
+ * \file protocolservice/protocolservice_pwe_dnd_dataservice_artifact_transaction_list_get.c
+ *
+ * \brief Decode and dispatch a dataservice artifact transaction list get
+ * response.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/dataservice/async_api.h>
+#include <agentd/inet.h>
+#include <agentd/protocolservice/api.h>
+#include <agentd/status_codes.h>
+#include <string.h>
+#include <vcblockchain/protocol/serialization.h>
+
+#include "protocolservice_internal.h"
+
+/**
+ * \brief Decode and dispatch an artifact transaction list get response.
+ *
+ * The page of transaction ids is written to the client as a single packet.
+ *
+ * \param ctx           The protocol service protocol fiber context.
+ * \param payload       The message payload.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_pwe_dnd_dataservice_artifact_transaction_list_get(
+    protocolservice_protocol_fiber_context* ctx,
+    protocolservice_protocol_write_endpoint_message* payload)
+{
+    status retval;
+    dataservice_response_artifact_transaction_list_get_t dresp;
+    vccrypt_buffer_t respbuf;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_protocolservice_protocol_fiber_context_valid(ctx));
+    MODEL_ASSERT(
+        prop_protocolservice_protocol_write_endpoint_mesasge_valid(payload));
+
+    /* decode the response. */
+    retval =
+        dataservice_decode_response_artifact_transaction_list_get(
+            payload->payload.data, payload->payload.size, &dresp);
+    if (STATUS_SUCCESS != retval)
+    {
+        /* TODO - log fatal error here. */
+        goto done;
+    }
+
+    /* check to see if the call succeeded. */
+    if (STATUS_SUCCESS != dresp.hdr.status)
+    {
+        /* Encode an error response. */
+        retval =
+            vcblockchain_protocol_encode_error_resp(
+                &respbuf, &ctx->ctx->vpr_alloc, payload->original_request_id,
+                payload->offset, dresp.hdr.status);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_dresp;
+        }
+    }
+    else
+    {
+        /* | Artifact transaction list get response packet.                 | */
+        /* | ----------------------------------------------- | ------------ | */
+        /* | DATA                                            | SIZE         | */
+        /* | ----------------------------------------------- | ------------ | */
+        /* | UNAUTH_PROTOCOL_REQ_ID_ARTIFACT_TXN_LIST_GET    |  4 bytes     | */
+        /* | status                                          |  4 bytes     | */
+        /* | offset                                          |  4 bytes     | */
+        /* | more                                            |  4 bytes     | */
+        /* | entries, each of which is:                      | n - 16 bytes | */
+        /* |    txn_id                                       | 16 bytes     | */
+        /* |    height                                       |  8 bytes     | */
+        /* |    index                                        |  4 bytes     | */
+        /* | ----------------------------------------------- | ------------ | */
+
+        /* create the response buffer. */
+        const size_t header_size = 4 * sizeof(uint32_t);
+        retval =
+            vccrypt_buffer_init(
+                &respbuf, &ctx->ctx->vpr_alloc,
+                header_size + dresp.data_size);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_dresp;
+        }
+
+        /* encode the header. */
+        uint8_t* bresp = (uint8_t*)respbuf.data;
+        uint32_t net_hdr[4] = {
+            htonl(UNAUTH_PROTOCOL_REQ_ID_ARTIFACT_TXN_LIST_GET),
+            htonl(STATUS_SUCCESS),
+            htonl(payload->offset),
+            htonl(dresp.more ? 1U : 0U) };
+        memcpy(bresp, net_hdr, sizeof(net_hdr));
+
+        /* the entries are already encoded by the dataservice. */
+        memcpy(bresp + header_size, dresp.data, dresp.data_size);
+    }
+
+    /* write this payload to the socket. */
+    retval =
+        protocolservice_protocol_write_endpoint_write_raw_packet(
+            ctx, respbuf.data, respbuf.size);
+
+    /* clean up. */
+    goto cleanup_respbuf;
+
+cleanup_respbuf:
+    dispose((disposable_t*)&respbuf);
+
+cleanup_dresp:
+    dispose((disposable_t*)&dresp);
+
+done:
+    return retval;
+}
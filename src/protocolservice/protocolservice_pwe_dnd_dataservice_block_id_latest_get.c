@@ -14,6 +14,7 @@
 #include "protocolservice_internal.h"
 
 RCPR_IMPORT_psock;
+RCPR_IMPORT_uuid;
 
 /**
  * \brief Decode and dispatch a latest block id get response.
@@ -48,6 +49,18 @@ status protocolservice_pwe_dnd_dataservice_block_id_latest_get(
         goto done;
     }
 
+    /* cache a successfully read block id. */
+    if (STATUS_SUCCESS == dresp.hdr.status)
+    {
+        retval =
+            protocolservice_latest_block_id_cache_update(
+                ctx, (const rcpr_uuid*)dresp.block_id);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_dresp;
+        }
+    }
+
     /* build the payload. */
     retval =
         vcblockchain_protocol_encode_resp_latest_block_id_get(
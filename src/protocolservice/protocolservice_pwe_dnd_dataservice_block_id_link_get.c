@@ -0,0 +1,109 @@
+/**
+ * \file
+ * protocolservice/protocolservice_pwe_dnd_dataservice_block_id_link_get.c
+ *
+ * \brief Decode and dispatch a dataservice block id link get response.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/dataservice/async_api.h>
+#include <agentd/status_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+
+#include "protocolservice_internal.h"
+
+/**
+ * \brief Decode and dispatch a block id next, block id prev, or block id with
+ * transaction get response.
+ *
+ * \param ctx           The protocol service protocol fiber context.
+ * \param payload       The message payload.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_pwe_dnd_dataservice_block_id_link_get(
+    protocolservice_protocol_fiber_context* ctx,
+    protocolservice_protocol_write_endpoint_message* payload)
+{
+    status retval;
+    dataservice_response_block_id_link_get_t dresp;
+    vccrypt_buffer_t respbuf;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_protocolservice_protocol_fiber_context_valid(ctx));
+    MODEL_ASSERT(
+        prop_protocolservice_protocol_write_endpoint_mesasge_valid(payload));
+
+    /* decode the response. */
+    retval =
+        dataservice_decode_response_block_id_link_get(
+            payload->payload.data, payload->payload.size, &dresp);
+    if (STATUS_SUCCESS != retval)
+    {
+        /* TODO - log fatal error here. */
+        goto done;
+    }
+
+    /* check to see if the call succeeded. */
+    if (STATUS_SUCCESS != dresp.hdr.status)
+    {
+        /* Encode an error response. */
+        retval =
+            vcblockchain_protocol_encode_error_resp(
+                &respbuf, &ctx->ctx->vpr_alloc, payload->original_request_id,
+                payload->offset, dresp.hdr.status);
+    }
+    else
+    {
+        /* build the payload for the method that was called. */
+        switch (dresp.hdr.method_code)
+        {
+            case DATASERVICE_API_METHOD_APP_BLOCK_ID_NEXT_READ:
+                retval =
+                    vcblockchain_protocol_encode_resp_block_next_id_get(
+                        &respbuf, &ctx->ctx->vpr_alloc, payload->offset,
+                        STATUS_SUCCESS, (const vpr_uuid*)dresp.block_id);
+                break;
+
+            case DATASERVICE_API_METHOD_APP_BLOCK_ID_PREV_READ:
+                retval =
+                    vcblockchain_protocol_encode_resp_block_prev_id_get(
+                        &respbuf, &ctx->ctx->vpr_alloc, payload->offset,
+                        STATUS_SUCCESS, (const vpr_uuid*)dresp.block_id);
+                break;
+
+            default:
+                retval =
+                    vcblockchain_protocol_encode_resp_txn_block_id_get(
+                        &respbuf, &ctx->ctx->vpr_alloc, payload->offset,
+                        STATUS_SUCCESS, (const vpr_uuid*)dresp.block_id);
+                break;
+        }
+    }
+
+    /* check the result of the payload build. */
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_dresp;
+    }
+
+    /* write this payload to the socket. */
+    retval =
+        protocolservice_protocol_write_endpoint_write_raw_packet(
+            ctx, respbuf.data, respbuf.size);
+
+    /* clean up. */
+    goto cleanup_respbuf;
+
+cleanup_respbuf:
+    dispose((disposable_t*)&respbuf);
+
+cleanup_dresp:
+    dispose((disposable_t*)&dresp);
+
+done:
+    return retval;
+}
@@ -0,0 +1,328 @@
+/**
+ * \file
+ * protocolservice/protocolservice_pwe_dnd_dataservice_block_range_get.c
+ *
+ * \brief Decode and dispatch a dataservice block range get response.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/dataservice/async_api.h>
+#include <agentd/inet.h>
+#include <agentd/protocolservice/api.h>
+#include <agentd/status_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vccrypt/compare.h>
+
+#include "protocolservice_internal.h"
+
+static const uint8_t ff_uuid[16] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+/* forward decls. */
+static status protocolservice_block_range_write_block(
+    protocolservice_protocol_fiber_context* ctx, uint32_t offset, bool more,
+    const data_block_node_t* node, const void* cert, size_t cert_size);
+static status protocolservice_block_range_write_error(
+    protocolservice_protocol_fiber_context* ctx, uint32_t offset,
+    uint32_t error_status);
+static status protocolservice_block_range_write_end(
+    protocolservice_protocol_fiber_context* ctx, uint32_t offset);
+
+/**
+ * \brief Decode and dispatch a block range get response.
+ *
+ * Each block in the response is written to the client as its own packet.  If
+ * the stream has not finished, this chunk is flushed to the client before the
+ * next chunk is requested from the dataservice.  If the next chunk starts at a
+ * gap in the chain, the stream ends with a packet that carries no block.
+ *
+ * \param ctx           The protocol service protocol fiber context.
+ * \param payload       The message payload.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_pwe_dnd_dataservice_block_range_get(
+    protocolservice_protocol_fiber_context* ctx,
+    protocolservice_protocol_write_endpoint_message* payload)
+{
+    status retval;
+    dataservice_response_block_range_get_t dresp;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_protocolservice_protocol_fiber_context_valid(ctx));
+    MODEL_ASSERT(
+        prop_protocolservice_protocol_write_endpoint_mesasge_valid(payload));
+
+    /* decode the response. */
+    retval =
+        dataservice_decode_response_block_range_get(
+            payload->payload.data, payload->payload.size, &dresp);
+    if (STATUS_SUCCESS != retval)
+    {
+        /* TODO - log fatal error here. */
+        ctx->block_range_active = false;
+        goto done;
+    }
+
+    /* an error ends the stream. */
+    if (STATUS_SUCCESS != dresp.hdr.status)
+    {
+        ctx->block_range_active = false;
+
+        /* a gap after the client was told to expect more isn't an error. */
+        if (ctx->block_range_sent
+         && AGENTD_ERROR_DATASERVICE_NOT_FOUND == (int)dresp.hdr.status)
+        {
+            retval =
+                protocolservice_block_range_write_end(ctx, payload->offset);
+        }
+        else
+        {
+            retval =
+                protocolservice_block_range_write_error(
+                    ctx, payload->offset, dresp.hdr.status);
+        }
+
+        goto cleanup_dresp;
+    }
+
+    /* a chunk of several blocks is sent to the client in a single write. */
+    if (dresp.count > 1)
+    {
+        retval = protocolservice_protocol_write_endpoint_buffer_begin(ctx);
+        if (STATUS_SUCCESS != retval)
+        {
+            ctx->block_range_active = false;
+            goto cleanup_dresp;
+        }
+    }
+
+    /* write each block in this chunk as its own packet. */
+    const void* entries = dresp.data;
+    size_t entries_size = dresp.data_size;
+    for (size_t i = 0; i < dresp.count; ++i)
+    {
+        data_block_node_t node;
+        const void* cert;
+        size_t cert_size;
+
+        retval =
+            dataservice_decode_response_block_range_get_entry(
+                &entries, &entries_size, &node, &cert, &cert_size);
+        if (STATUS_SUCCESS != retval)
+        {
+            ctx->block_range_active = false;
+            goto cleanup_dresp;
+        }
+
+        /* charge this block against the stream budget. */
+        ctx->block_range_remaining_count -= 1;
+        ctx->block_range_remaining_bytes -=
+            (cert_size > ctx->block_range_remaining_bytes)
+                ? ctx->block_range_remaining_bytes : cert_size;
+        ctx->block_range_next_height = ntohll(node.net_block_height) + 1;
+
+        /* the stream ends when its budget is spent or at the latest block. */
+        bool more =
+            0U != ctx->block_range_remaining_count
+         && 0U != ctx->block_range_remaining_bytes
+         && 0 != crypto_memcmp(node.next, ff_uuid, sizeof(ff_uuid));
+
+        retval =
+            protocolservice_block_range_write_block(
+                ctx, payload->offset, more, &node, cert, cert_size);
+        if (STATUS_SUCCESS != retval || !more)
+        {
+            ctx->block_range_active = false;
+            goto cleanup_dresp;
+        }
+
+        ctx->block_range_sent = true;
+    }
+
+    /* send this chunk before requesting the next one. */
+    retval = protocolservice_protocol_write_endpoint_flush(ctx);
+    if (STATUS_SUCCESS != retval)
+    {
+        ctx->block_range_active = false;
+        goto cleanup_dresp;
+    }
+
+    /* this chunk has been written, so request the next one. */
+    if (ctx->req_shutdown)
+    {
+        ctx->block_range_active = false;
+    }
+    else
+    {
+        retval = protocolservice_block_range_request_chunk(ctx);
+        if (STATUS_SUCCESS != retval)
+        {
+            ctx->block_range_active = false;
+            retval =
+                protocolservice_block_range_write_error(
+                    ctx, payload->offset, retval);
+        }
+    }
+
+    /* fall-through. */
+
+cleanup_dresp:
+    dispose((disposable_t*)&dresp);
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Write a single block from a block range stream to the client.
+ *
+ * \param ctx           The protocol service protocol fiber context.
+ * \param offset        The protocol request offset.
+ * \param more          true if more blocks follow in this stream.
+ * \param node          The block node.
+ * \param cert          The block certificate.
+ * \param cert_size     The size of the block certificate.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status protocolservice_block_range_write_block(
+    protocolservice_protocol_fiber_context* ctx, uint32_t offset, bool more,
+    const data_block_node_t* node, const void* cert, size_t cert_size)
+{
+    status retval;
+    vccrypt_buffer_t respbuf;
+
+    /* | Block range get response packet.                                   | */
+    /* | --------------------------------------------------- | ------------ | */
+    /* | DATA                                                | SIZE         | */
+    /* | --------------------------------------------------- | ------------ | */
+    /* | UNAUTH_PROTOCOL_REQ_ID_BLOCK_RANGE_GET              |  4 bytes     | */
+    /* | status                                              |  4 bytes     | */
+    /* | offset                                              |  4 bytes     | */
+    /* | more                                                |  4 bytes     | */
+    /* | key                                                 | 16 bytes     | */
+    /* | prev                                                | 16 bytes     | */
+    /* | next                                                | 16 bytes     | */
+    /* | first_transaction_id                                | 16 bytes     | */
+    /* | net_block_height                                    |  8 bytes     | */
+    /* | net_block_cert_size                                 |  8 bytes     | */
+    /* | cert                                                | n - 96 bytes | */
+    /* | --------------------------------------------------- | ------------ | */
+
+    /* create the response buffer. */
+    const size_t header_size = 4 * sizeof(uint32_t) + 4 * 16 + 2 * 8;
+    retval =
+        vccrypt_buffer_init(
+            &respbuf, &ctx->ctx->vpr_alloc, header_size + cert_size);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* encode the header. */
+    uint8_t* bresp = (uint8_t*)respbuf.data;
+    uint32_t net_hdr[4] = {
+        htonl(UNAUTH_PROTOCOL_REQ_ID_BLOCK_RANGE_GET),
+        htonl(STATUS_SUCCESS),
+        htonl(offset),
+        htonl(more ? 1U : 0U) };
+    memcpy(bresp, net_hdr, sizeof(net_hdr));
+    bresp += sizeof(net_hdr);
+
+    /* encode the block node. */
+    uint64_t net_cert_size = htonll(cert_size);
+    memcpy(bresp, node->key, 16);
+    memcpy(bresp + 16, node->prev, 16);
+    memcpy(bresp + 32, node->next, 16);
+    memcpy(bresp + 48, node->first_transaction_id, 16);
+    memcpy(bresp + 64, &node->net_block_height, 8);
+    memcpy(bresp + 72, &net_cert_size, 8);
+
+    /* encode the certificate. */
+    memcpy(bresp + 80, cert, cert_size);
+
+    /* write this packet to the socket. */
+    retval =
+        protocolservice_protocol_write_endpoint_write_raw_packet(
+            ctx, respbuf.data, respbuf.size);
+
+    /* clean up. */
+    dispose((disposable_t*)&respbuf);
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Write an error packet, ending a block range stream.
+ *
+ * \param ctx           The protocol service protocol fiber context.
+ * \param offset        The protocol request offset.
+ * \param error_status  The error status to write.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status protocolservice_block_range_write_error(
+    protocolservice_protocol_fiber_context* ctx, uint32_t offset,
+    uint32_t error_status)
+{
+    status retval;
+    vccrypt_buffer_t respbuf;
+
+    /* encode the error response. */
+    retval =
+        vcblockchain_protocol_encode_error_resp(
+            &respbuf, &ctx->ctx->vpr_alloc,
+            UNAUTH_PROTOCOL_REQ_ID_BLOCK_RANGE_GET, offset, error_status);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* write this payload to the socket. */
+    retval =
+        protocolservice_protocol_write_endpoint_write_raw_packet(
+            ctx, respbuf.data, respbuf.size);
+
+    /* clean up. */
+    dispose((disposable_t*)&respbuf);
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Write a final packet with no block, ending a block range stream.
+ *
+ * \param ctx           The protocol service protocol fiber context.
+ * \param offset        The protocol request offset.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status protocolservice_block_range_write_end(
+    protocolservice_protocol_fiber_context* ctx, uint32_t offset)
+{
+    /* this packet holds the header only, with more cleared. */
+    uint32_t net_hdr[4] = {
+        htonl(UNAUTH_PROTOCOL_REQ_ID_BLOCK_RANGE_GET),
+        htonl(STATUS_SUCCESS),
+        htonl(offset),
+        htonl(0U) };
+
+    /* write this packet to the socket. */
+    return
+        protocolservice_protocol_write_endpoint_write_raw_packet(
+            ctx, net_hdr, sizeof(net_hdr));
+}
@@ -63,6 +63,23 @@ status protocolservice_pwe_dnd_dataservice_message(
                 protocolservice_pwe_dnd_dataservice_block_id_by_height_get(
                     ctx, payload);
 
+        case DATASERVICE_API_METHOD_APP_BLOCK_ID_NEXT_READ:
+        case DATASERVICE_API_METHOD_APP_BLOCK_ID_PREV_READ:
+        case DATASERVICE_API_METHOD_APP_BLOCK_ID_WITH_TRANSACTION_READ:
+            return
+                protocolservice_pwe_dnd_dataservice_block_id_link_get(
+                    ctx, payload);
+
+        case DATASERVICE_API_METHOD_APP_BLOCK_RANGE_READ:
+            return
+                protocolservice_pwe_dnd_dataservice_block_range_get(
+                    ctx, payload);
+
+        case DATASERVICE_API_METHOD_APP_ARTIFACT_TRANSACTION_LIST_READ:
+            return
+                protocolservice_pwe_dnd_dataservice_artifact_transaction_list_get(
+                    ctx, payload);
+
         default:
             return AGENTD_ERROR_PROTOCOLSERVICE_DATASERVICE_INVALID_RESPONSE_ID;
     }
@@ -8,41 +8,11 @@
  */
 
 #include <agentd/dataservice/async_api.h>
-#include <agentd/inet.h>
 #include <agentd/status_codes.h>
 #include <vcblockchain/protocol/serialization.h>
-#include <vccrypt/compare.h>
 
 #include "protocolservice_internal.h"
 
-/* forward decls. */
-static status protocolservice_pwe_dnd_encode_protocol_transaction_id_get_next(
-    vccrypt_buffer_t* respbuf, protocolservice_protocol_fiber_context* ctx,
-    protocolservice_protocol_write_endpoint_message* payload,
-    const dataservice_response_canonized_transaction_get_t* dresp);
-static status protocolservice_pwe_dnd_encode_protocol_transaction_id_get_prev(
-    vccrypt_buffer_t* respbuf, protocolservice_protocol_fiber_context* ctx,
-    protocolservice_protocol_write_endpoint_message* payload,
-    const dataservice_response_canonized_transaction_get_t* dresp);
-static status protocolservice_pwe_dnd_encode_protocol_transaction_block_id_get(
-    vccrypt_buffer_t* respbuf, protocolservice_protocol_fiber_context* ctx,
-    protocolservice_protocol_write_endpoint_message* payload,
-    const dataservice_response_canonized_transaction_get_t* dresp);
-static status protocolservice_pwe_dnd_encode_protocol_transaction_get(
-    vccrypt_buffer_t* respbuf, protocolservice_protocol_fiber_context* ctx,
-    protocolservice_protocol_write_endpoint_message* payload,
-    const dataservice_response_canonized_transaction_get_t* dresp);
-
-static const uint8_t ff_uuid[16] = {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-};
-
-static const uint8_t zero_uuid[16] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-
 /**
  * \brief Decode and dispatch a transaction read response.
  *
@@ -91,33 +61,22 @@ status protocolservice_pwe_dnd_dataservice_transaction_get(
     }
     else
     {
-        /* decode the protocol request id to determine the response payload. */
-        switch (payload->original_request_id)
+        /* canonized records are immutable, so cache this one. */
+        retval =
+            protocolservice_cert_cache_insert(
+                &ctx->ctx->cert_cache,
+                PROTOCOLSERVICE_CERT_CACHE_TYPE_TRANSACTION, &dresp.node,
+                dresp.data, dresp.data_size);
+        if (STATUS_SUCCESS != retval)
         {
-            case UNAUTH_PROTOCOL_REQ_ID_TRANSACTION_ID_GET_NEXT:
-                retval =
-                    protocolservice_pwe_dnd_encode_protocol_transaction_id_get_next(
-                        &respbuf, ctx, payload, &dresp);
-                break;
-
-            case UNAUTH_PROTOCOL_REQ_ID_TRANSACTION_ID_GET_PREV:
-                retval =
-                    protocolservice_pwe_dnd_encode_protocol_transaction_id_get_prev(
-                        &respbuf, ctx, payload, &dresp);
-                break;
-
-            case UNAUTH_PROTOCOL_REQ_ID_TRANSACTION_ID_GET_BLOCK_ID:
-                retval =
-                    protocolservice_pwe_dnd_encode_protocol_transaction_block_id_get(
-                        &respbuf, ctx, payload, &dresp);
-                break;
-
-            default:
-                retval =
-                    protocolservice_pwe_dnd_encode_protocol_transaction_get(
-                        &respbuf, ctx, payload, &dresp);
-                break;
+            goto cleanup_dresp;
         }
+
+        /* encode the response payload for the original request. */
+        retval =
+            protocolservice_encode_transaction_response(
+                &respbuf, ctx, payload->original_request_id, payload->offset,
+                &dresp.node, dresp.data, dresp.data_size);
     }
 
     /* check the result of the payload build. */
@@ -143,125 +102,3 @@ cleanup_dresp:
 done:
     return retval;
 }
-
-/**
- * \brief Encode a transaction id get next response.
- *
- * \param respbuf       The buffer in which the response is stored.
- * \param ctx           The protocol service protocol fiber context.
- * \param payload       The message payload.
- * \param dresp         The decoded response from the data service.
- *
- * \returns a status code indicating success or failure.
- *      - STATUS_SUCCESS on success.
- *      - a non-zero error code on failure.
- */
-static status protocolservice_pwe_dnd_encode_protocol_transaction_id_get_next(
-    vccrypt_buffer_t* respbuf, protocolservice_protocol_fiber_context* ctx,
-    protocolservice_protocol_write_endpoint_message* payload,
-    const dataservice_response_canonized_transaction_get_t* dresp)
-{
-    if (!crypto_memcmp(dresp->node.next, ff_uuid, 16))
-    {
-        /* Encode an error response. */
-        return
-            vcblockchain_protocol_encode_error_resp(
-                respbuf, &ctx->ctx->vpr_alloc, payload->original_request_id,
-                payload->offset, AGENTD_ERROR_DATASERVICE_NOT_FOUND);
-    }
-    else
-    {
-        /* build a transaction get next id payload. */
-        return
-            vcblockchain_protocol_encode_resp_txn_next_id_get(
-                respbuf, &ctx->ctx->vpr_alloc, payload->offset,
-                dresp->hdr.status, (const vpr_uuid*)dresp->node.next);
-    }
-}
-
-/**
- * \brief Encode a transaction id get prev response.
- *
- * \param respbuf       The buffer in which the response is stored.
- * \param ctx           The protocol service protocol fiber context.
- * \param payload       The message payload.
- * \param dresp         The decoded response from the data service.
- *
- * \returns a status code indicating success or failure.
- *      - STATUS_SUCCESS on success.
- *      - a non-zero error code on failure.
- */
-static status protocolservice_pwe_dnd_encode_protocol_transaction_id_get_prev(
-    vccrypt_buffer_t* respbuf, protocolservice_protocol_fiber_context* ctx,
-    protocolservice_protocol_write_endpoint_message* payload,
-    const dataservice_response_canonized_transaction_get_t* dresp)
-{
-    if (!crypto_memcmp(dresp->node.prev, zero_uuid, 16))
-    {
-        /* Encode an error response. */
-        return
-            vcblockchain_protocol_encode_error_resp(
-                respbuf, &ctx->ctx->vpr_alloc, payload->original_request_id,
-                payload->offset, AGENTD_ERROR_DATASERVICE_NOT_FOUND);
-    }
-    else
-    {
-        /* build a transaction get prev id payload. */
-        return
-            vcblockchain_protocol_encode_resp_txn_prev_id_get(
-                respbuf, &ctx->ctx->vpr_alloc, payload->offset,
-                dresp->hdr.status, (const vpr_uuid*)dresp->node.prev);
-    }
-}
-
-/**
- * \brief Encode a transaction block id get response.
- *
- * \param respbuf       The buffer in which the response is stored.
- * \param ctx           The protocol service protocol fiber context.
- * \param payload       The message payload.
- * \param dresp         The decoded response from the data service.
- *
- * \returns a status code indicating success or failure.
- *      - STATUS_SUCCESS on success.
- *      - a non-zero error code on failure.
- */
-static status protocolservice_pwe_dnd_encode_protocol_transaction_block_id_get(
-    vccrypt_buffer_t* respbuf, protocolservice_protocol_fiber_context* ctx,
-    protocolservice_protocol_write_endpoint_message* payload,
-    const dataservice_response_canonized_transaction_get_t* dresp)
-{
-    /* build a transaction get block id payload. */
-    return
-        vcblockchain_protocol_encode_resp_txn_block_id_get(
-            respbuf, &ctx->ctx->vpr_alloc, payload->offset,
-            dresp->hdr.status, (const vpr_uuid*)dresp->node.block_id);
-}
-
-/**
- * \brief Encode a transaction get response.
- *
- * \param respbuf       The buffer in which the response is stored.
- * \param ctx           The protocol service protocol fiber context.
- * \param payload       The message payload.
- * \param dresp         The decoded response from the data service.
- *
- * \returns a status code indicating success or failure.
- *      - STATUS_SUCCESS on success.
- *      - a non-zero error code on failure.
- */
-static status protocolservice_pwe_dnd_encode_protocol_transaction_get(
-    vccrypt_buffer_t* respbuf, protocolservice_protocol_fiber_context* ctx,
-    protocolservice_protocol_write_endpoint_message* payload,
-    const dataservice_response_canonized_transaction_get_t* dresp)
-{
-    return
-        vcblockchain_protocol_encode_resp_txn_get(
-            respbuf, &ctx->ctx->vpr_alloc, payload->offset, dresp->hdr.status,
-            (const vpr_uuid*)dresp->node.key, (const vpr_uuid*)dresp->node.prev,
-            (const vpr_uuid*)dresp->node.next,
-            (const vpr_uuid*)dresp->node.artifact_id,
-            (const vpr_uuid*)dresp->node.block_id,
-            ntohll(dresp->node.net_txn_cert_size),
-            dresp->data, dresp->data_size, ntohl(dresp->node.net_txn_state));
-}
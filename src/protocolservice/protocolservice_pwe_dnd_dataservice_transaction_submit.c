@@ -45,6 +45,12 @@ status protocolservice_pwe_dnd_dataservice_transaction_submit(
         goto done;
     }
 
+    /* let the attestation service know that there is new work. */
+    if (STATUS_SUCCESS == dresp.hdr.status)
+    {
+        protocolservice_attestation_wakeup(ctx->ctx);
+    }
+
     /* build the payload. */
     retval =
         vcblockchain_protocol_encode_resp_transaction_submit(
@@ -0,0 +1,63 @@
+/**
+ * \file protocolservice/protocolservice_pwe_dnd_error_message.c
+ *
+ * \brief Decode and dispatch an endpoint error message.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <arpa/inet.h>
+#include <agentd/status_codes.h>
+#include <string.h>
+
+#include "protocolservice_internal.h"
+
+/**
+ * \brief Decode and dispatch an error message from the dataservice endpoint.
+ *
+ * The endpoint sends this message when a request could not be completed. The
+ * peer receives an error response for the original request and offset.
+ *
+ * \param ctx           The protocol service protocol fiber context.
+ * \param payload       The message payload.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_pwe_dnd_error_message(
+    protocolservice_protocol_fiber_context* ctx,
+    protocolservice_protocol_write_endpoint_message* payload)
+{
+    uint32_t net_status;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_protocolservice_protocol_fiber_context_valid(ctx));
+    MODEL_ASSERT(
+        prop_protocolservice_protocol_write_endpoint_message_valid(payload));
+
+    /* the payload holds the error status. */
+    if (sizeof(net_status) != payload->payload.size)
+    {
+        return AGENTD_ERROR_PROTOCOLSERVICE_MALFORMED_RESPONSE;
+    }
+
+    memcpy(&net_status, payload->payload.data, sizeof(net_status));
+
+    /* | Error response packet.                                       | */
+    /* | --------------------------------------------- | ------------ | */
+    /* | DATA                                          | SIZE         | */
+    /* | --------------------------------------------- | ------------ | */
+    /* | request_id                                    | 4 bytes      | */
+    /* | status                                        | 4 bytes      | */
+    /* | offset                                        | 4 bytes      | */
+    /* | --------------------------------------------- | ------------ | */
+    uint32_t resp[3] = {
+        htonl(payload->original_request_id), net_status,
+        htonl(payload->offset) };
+
+    /* write the error response to the peer. */
+    return
+        protocolservice_protocol_write_endpoint_write_raw_packet(
+            ctx, resp, sizeof(resp));
+}
@@ -31,6 +31,7 @@ status protocolservice_random_endpoint_context_release(RCPR_SYM(resource)* r)
 {
     status mailbox_close_retval = STATUS_SUCCESS;
     status randomsock_release_retval = STATUS_SUCCESS;
+    status pool_reclaim_retval = STATUS_SUCCESS;
     status reclaim_retval = STATUS_SUCCESS;
 
     protocolservice_random_endpoint_context* ctx =
@@ -55,6 +56,13 @@ status protocolservice_random_endpoint_context_release(RCPR_SYM(resource)* r)
             resource_release(psock_resource_handle(ctx->randomsock));
     }
 
+    /* clear and reclaim the entropy pool, if allocated. */
+    if (NULL != ctx->pool)
+    {
+        memset(ctx->pool, 0, RANDOM_ENDPOINT_POOL_SIZE);
+        pool_reclaim_retval = rcpr_allocator_reclaim(alloc, ctx->pool);
+    }
+
     /* reclaim the memory for this context. */
     reclaim_retval = rcpr_allocator_reclaim(alloc, ctx);
 
@@ -67,6 +75,10 @@ status protocolservice_random_endpoint_context_release(RCPR_SYM(resource)* r)
     {
         return randomsock_release_retval;
     }
+    else if (STATUS_SUCCESS != pool_reclaim_retval)
+    {
+        return pool_reclaim_retval;
+    }
     else
     {
         return reclaim_retval;
@@ -6,19 +6,21 @@
  * \copyright 2022 Velo Payments, Inc.  All rights reserved.
  */
 
-#include <agentd/randomservice/api.h>
 #include <cbmc/model_assert.h>
 #include <unistd.h>
 
 #include "protocolservice_internal.h"
 
+RCPR_IMPORT_allocator_as(rcpr);
 RCPR_IMPORT_message;
 RCPR_IMPORT_resource;
 
 /**
  * \brief Entry point for the protocol service random endpoint fiber.
  *
- * This fiber forwards requests to the random service and returns responses.
+ * This fiber serves requests from an entropy pool.  Refills are requested from
+ * the random service ahead of need and collected only when the pool runs dry,
+ * so replies don't wait on the cross-process round trip.
  *
  * \param vctx          The type erased random endopint context.
  *
@@ -33,7 +35,6 @@ status protocolservice_random_endpoint_fiber_entry(void* vctx)
     protocolservice_random_response_message* reply_payload;
     message* req_msg;
     message* reply_msg;
-    uint32_t offset, status;
 
     protocolservice_random_endpoint_context* ctx =
         (protocolservice_random_endpoint_context*)vctx;
@@ -41,6 +42,19 @@ status protocolservice_random_endpoint_fiber_entry(void* vctx)
     /* parameter sanity checks. */
     MODEL_ASSERT(prop_protocolservice_random_endpoint_context_valid(ctx));
 
+    /* fill the entropy pool before serving requests. */
+    retval = protocolservice_random_endpoint_refill_begin(ctx);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_context;
+    }
+
+    retval = protocolservice_random_endpoint_refill_end(ctx);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_context;
+    }
+
     /* event loop for random service. */
     for (;;)
     {
@@ -65,20 +79,21 @@ status protocolservice_random_endpoint_fiber_entry(void* vctx)
             goto cleanup_req_msg;
         }
 
-        /* send the api request to the random service. */
+        /* allocate the response data. */
         retval =
-            random_service_api_sendreq_random_bytes_get(
-                ctx->randomsock, 0, req_payload->size);
+            rcpr_allocator_allocate(
+                ctx->alloc, &reply_payload->data, req_payload->size);
         if (STATUS_SUCCESS != retval)
         {
             goto cleanup_reply_payload;
         }
 
-        /* receive the response from the random service. */
+        reply_payload->size = req_payload->size;
+
+        /* fill the response data. */
         retval =
-            random_service_api_recvresp_random_bytes_get(
-                ctx->randomsock, ctx->alloc, &offset, &status,
-                &reply_payload->data, &reply_payload->size);
+            protocolservice_random_endpoint_read_bytes(
+                ctx, reply_payload->data, req_payload->size);
         if (STATUS_SUCCESS != retval)
         {
             goto cleanup_reply_payload;
@@ -0,0 +1,163 @@
+/**
+ * \file protocolservice/protocolservice_random_endpoint_read_bytes.c
+ *
+ * \brief Serve random bytes from the random endpoint.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/randomservice/api.h>
+#include <agentd/status_codes.h>
+#include <cbmc/model_assert.h>
+#include <string.h>
+
+#include "protocolservice_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+
+/* forward decls. */
+static status protocolservice_random_endpoint_read_direct(
+    protocolservice_random_endpoint_context* ctx, void* data, size_t size);
+
+/**
+ * \brief Fill a buffer with random bytes for a random endpoint request.
+ *
+ * Requests are served from the entropy pool. Bytes served from the pool are
+ * cleared. When the pool falls below RANDOM_ENDPOINT_POOL_LOW_WATER, a refill
+ * is requested without waiting for it. This call only waits on the random
+ * service if the pool can't cover the request.
+ *
+ * Requests larger than the pool are read directly from the random service.
+ *
+ * \param ctx           The random endpoint context.
+ * \param data          The buffer to fill.
+ * \param size          The number of bytes to write to \p data.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_random_endpoint_read_bytes(
+    protocolservice_random_endpoint_context* ctx, void* data, size_t size)
+{
+    status retval;
+    uint8_t* pool_bytes;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_protocolservice_random_endpoint_context_valid(ctx));
+    MODEL_ASSERT(NULL != data);
+
+    /* the pool can't hold this request, so read it directly. */
+    if (size > RANDOM_ENDPOINT_POOL_SIZE)
+    {
+        return protocolservice_random_endpoint_read_direct(ctx, data, size);
+    }
+
+    /* if the pool has run dry, wait for a refill. */
+    if (ctx->pool_avail < size)
+    {
+        retval = protocolservice_random_endpoint_refill_begin(ctx);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        retval = protocolservice_random_endpoint_refill_end(ctx);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        /* the random service must have covered the shortfall. */
+        if (ctx->pool_avail < size)
+        {
+            return AGENTD_ERROR_PROTOCOLSERVICE_PRNG_REQUEST_FAILURE;
+        }
+    }
+
+    /* serve the bytes from the top of the pool, and clear them. */
+    pool_bytes = ctx->pool + ctx->pool_avail - size;
+    memcpy(data, pool_bytes, size);
+    memset(pool_bytes, 0, size);
+    ctx->pool_avail -= size;
+
+    /* request a refill ahead of need. */
+    if (ctx->pool_avail < RANDOM_ENDPOINT_POOL_LOW_WATER)
+    {
+        return protocolservice_random_endpoint_refill_begin(ctx);
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Read a request that is larger than the pool from the random service.
+ *
+ * \param ctx           The random endpoint context.
+ * \param data          The buffer to fill.
+ * \param size          The number of bytes to write to \p data.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status protocolservice_random_endpoint_read_direct(
+    protocolservice_random_endpoint_context* ctx, void* data, size_t size)
+{
+    status retval, release_retval;
+    void* resp;
+    size_t resp_size;
+    uint32_t offset, status;
+
+    /* the random service can't satisfy this request. */
+    if (size > RANDOMSERVICE_GET_RANDOM_BYTES_BULK_MAXIMUM_SIZE)
+    {
+        return AGENTD_ERROR_PROTOCOLSERVICE_PRNG_REQUEST_FAILURE;
+    }
+
+    /* responses arrive in order, so collect any pending refill first. */
+    retval = protocolservice_random_endpoint_refill_end(ctx);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* request the bytes. */
+    retval =
+        random_service_api_sendreq_random_bytes_get_bulk(
+            ctx->randomsock, 0U, (uint32_t)size);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* read the response. */
+    retval =
+        random_service_api_recvresp_random_bytes_get_bulk(
+            ctx->randomsock, ctx->alloc, &offset, &status, &resp, &resp_size);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* the random service must satisfy the whole request. */
+    if (resp_size < size)
+    {
+        retval = AGENTD_ERROR_PROTOCOLSERVICE_PRNG_REQUEST_FAILURE;
+        goto cleanup_resp;
+    }
+
+    /* copy the bytes to the caller. */
+    memcpy(data, resp, size);
+    retval = STATUS_SUCCESS;
+
+cleanup_resp:
+    memset(resp, 0, resp_size);
+    release_retval = rcpr_allocator_reclaim(ctx->alloc, resp);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
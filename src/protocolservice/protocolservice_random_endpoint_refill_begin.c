@@ -0,0 +1,58 @@
+/**
+ * \file protocolservice/protocolservice_random_endpoint_refill_begin.c
+ *
+ * \brief Start topping up the random endpoint entropy pool.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/randomservice/api.h>
+#include <agentd/status_codes.h>
+#include <cbmc/model_assert.h>
+
+#include "protocolservice_internal.h"
+
+/**
+ * \brief Ask the random service for enough bytes to fill the entropy pool.
+ *
+ * Only the request is written here. The response is collected by
+ * \ref protocolservice_random_endpoint_refill_end once the pool actually needs
+ * it, so the endpoint keeps serving from what is left in the pool in the
+ * meantime. At most one refill is in flight at a time.
+ *
+ * \param ctx           The random endpoint context.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_random_endpoint_refill_begin(
+    protocolservice_random_endpoint_context* ctx)
+{
+    status retval;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_protocolservice_random_endpoint_context_valid(ctx));
+    MODEL_ASSERT(NULL != ctx->pool);
+
+    /* nothing to do if a refill is in flight or the pool is full. */
+    if (ctx->refill_pending || ctx->pool_avail >= RANDOM_ENDPOINT_POOL_SIZE)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    /* request the shortfall in one bulk request. */
+    retval =
+        random_service_api_sendreq_random_bytes_get_bulk(
+            ctx->randomsock, 0U,
+            (uint32_t)(RANDOM_ENDPOINT_POOL_SIZE - ctx->pool_avail));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* the response is collected when the pool needs it. */
+    ctx->refill_pending = true;
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,80 @@
+/**
+ * \file protocolservice/protocolservice_random_endpoint_refill_end.c
+ *
+ * \brief Collect a pending top up of the random endpoint entropy pool.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/randomservice/api.h>
+#include <agentd/status_codes.h>
+#include <cbmc/model_assert.h>
+#include <string.h>
+
+#include "protocolservice_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+
+/**
+ * \brief Read the response to a pending refill into the entropy pool.
+ *
+ * The pool may have been drawn down further since the refill was requested,
+ * so all of the returned bytes fit. If no refill is pending, this call does
+ * nothing.
+ *
+ * \param ctx           The random endpoint context.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status protocolservice_random_endpoint_refill_end(
+    protocolservice_random_endpoint_context* ctx)
+{
+    status retval, release_retval;
+    void* data;
+    size_t data_size, copy_size;
+    uint32_t offset, status;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_protocolservice_random_endpoint_context_valid(ctx));
+    MODEL_ASSERT(NULL != ctx->pool);
+
+    /* nothing to do if no refill is in flight. */
+    if (!ctx->refill_pending)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    /* read the response. */
+    ctx->refill_pending = false;
+    retval =
+        random_service_api_recvresp_random_bytes_get_bulk(
+            ctx->randomsock, ctx->alloc, &offset, &status, &data, &data_size);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* copy as many bytes as the pool can hold. */
+    copy_size = RANDOM_ENDPOINT_POOL_SIZE - ctx->pool_avail;
+    if (data_size < copy_size)
+    {
+        copy_size = data_size;
+    }
+
+    memcpy(ctx->pool + ctx->pool_avail, data, copy_size);
+    ctx->pool_avail += copy_size;
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+
+    memset(data, 0, data_size);
+    release_retval = rcpr_allocator_reclaim(ctx->alloc, data);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
@@ -64,6 +64,20 @@ status protocolservice_randomservice_endpoint_add(
     tmp->alloc = alloc;
     tmp->addr = 0;
 
+    /* allocate the entropy pool. */
+    retval =
+        rcpr_allocator_allocate(
+            alloc, (void**)&tmp->pool, RANDOM_ENDPOINT_POOL_SIZE);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_context;
+    }
+
+    /* the pool starts empty. */
+    memset(tmp->pool, 0, RANDOM_ENDPOINT_POOL_SIZE);
+    tmp->pool_avail = 0;
+    tmp->refill_pending = false;
+
     /* create the random endpoint fiber. */
     retval =
         fiber_create(
@@ -8,6 +8,7 @@
 
 #include <cbmc/model_assert.h>
 #include <config.h>
+#include <agentd/inet.h>
 #include <agentd/signalthread.h>
 #include <agentd/status_codes.h>
 #include <stdlib.h>
@@ -40,6 +41,13 @@ RCPR_IMPORT_thread;
  * \param logsock       The logging service socket.  The protocol service logs
  *                      on this socket.
  * \param notifysock    The notification service socket.
+ * \param wakeupsock    The attestation service wakeup socket.  The protocol
+ *                      service signals this socket after a transaction is
+ *                      submitted.
+ * \param datareaderstart   The first read-only data service socket. The
+ *                      protocol service iterates from this socket until it
+ *                      encounters a closed descriptor and routes read requests
+ *                      across each of these sockets.
  *
  * \returns a status code on service exit indicating a normal or abnormal exit.
  *          - AGENTD_STATUS_SUCCESS on normal exit.
@@ -54,7 +62,7 @@ RCPR_IMPORT_thread;
  */
 int protocolservice_run(
     int randomsock, int protosock, int controlsock, int datasock,
-    int UNUSED(logsock), int notifysock)
+    int UNUSED(logsock), int notifysock, int wakeupsock, int datareaderstart)
 {
     status retval, release_retval;
     rcpr_allocator* alloc;
@@ -74,6 +82,11 @@ int protocolservice_run(
     MODEL_ASSERT(controlsock >= 0);
     MODEL_ASSERT(datasock >= 0);
     MODEL_ASSERT(logsock >= 0);
+    MODEL_ASSERT(wakeupsock >= 0);
+    MODEL_ASSERT(datareaderstart >= 0);
+
+    /* count the number of read-only data service sockets. */
+    int datareadercount = inet_count_sockets(datareaderstart);
 
     /* create the allocator instance. */
     retval = rcpr_malloc_allocator_create(&alloc);
@@ -119,6 +132,18 @@ int protocolservice_run(
     /* save the context to the dataservice endpoint context. */
     data_ctx->ctx = ctx;
 
+    /* save the attestation service wakeup socket. */
+    ctx->attestation_wakeup_sock = wakeupsock;
+
+    /* add the read-only data service endpoint fibers. */
+    retval =
+        protocolservice_dataservice_reader_endpoints_add(
+            ctx, datareaderstart, (size_t)datareadercount);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_context;
+    }
+
     /* add the notification service endpoint fiber. */
     retval =
         protocolservice_notificationservice_endpoint_add(
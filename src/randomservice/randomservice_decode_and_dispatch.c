@@ -70,6 +70,11 @@ int randomservice_decode_and_dispatch(
             return randomservice_decode_and_dispatch_get_random_bytes(
                 inst, sock, breq, payload_size);
 
+        /* handle bulk get random bytes call. */
+        case RANDOMSERVICE_API_METHOD_GET_RANDOM_BYTES_BULK:
+            return randomservice_decode_and_dispatch_get_random_bytes_bulk(
+                inst, sock, breq, payload_size);
+
         /* unknown method.  Return an error. */
         default:
             /* make sure to write an error to the socket as well. */
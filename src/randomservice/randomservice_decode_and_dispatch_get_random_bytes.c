@@ -89,8 +89,10 @@ int randomservice_decode_and_dispatch_get_random_bytes(
         goto done;
     }
 
-    /* read data from the random fd. */
-    if (read(inst->random_fd, buffer, rndsize) < rndsize)
+    /* read random data. */
+    if (
+        AGENTD_STATUS_SUCCESS
+            != randomservice_read_random_bytes(inst, buffer, rndsize))
     {
         rndsize = 0;
         retval = AGENTD_ERROR_RANDOMSERVICE_GET_RANDOM_BYTES_READ_FAILED;
@@ -0,0 +1,155 @@
+/**
+ * \file randomservice/randomservice_decode_and_dispatch_get_random_bytes_bulk.c
+ *
+ * \brief Decode and dispatch a bulk get random bytes request.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/randomservice/private/randomservice.h>
+#include <agentd/inet.h>
+#include <agentd/ipc.h>
+#include <agentd/status_codes.h>
+#include <arpa/inet.h>
+#include <cbmc/model_assert.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <vpr/parameters.h>
+
+#include "randomservice_internal.h"
+
+/* forward decls. */
+static void random_bytes_release(
+    const void* data, size_t size, void* user_context);
+
+/**
+ * \brief Decode and dispatch a bulk get random bytes request.
+ *
+ * The random bytes are generated directly into a heap buffer which is
+ * appended to the write buffer by reference, so a large response is never
+ * copied.  The response is only queued; it is flushed along with any other
+ * queued responses by the caller.
+ *
+ * Returns 0 on success or non-fatal error.  If a non-zero error message is
+ * returned, then a fatal error has occurred that should not be recovered from.
+ * Any additional information on the socket is suspect.
+ *
+ * \param inst          The instance on which the dispatch occurs.
+ * \param sock          The socket on which the request was received and the
+ *                      response is to be written.
+ * \param req           The request to be decoded and dispatched.
+ * \param size          The size of the request.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - A non-zero fatal error.
+ */
+int randomservice_decode_and_dispatch_get_random_bytes_bulk(
+    randomservice_root_context_t* inst, ipc_socket_context_t* sock, void* req,
+    size_t size)
+{
+    int retval = 0;
+    uint32_t offset = 0;
+    uint32_t rndsize = 0;
+    uint8_t* buffer = NULL;
+
+    /* parameter sanity check. */
+    MODEL_ASSERT(NULL != inst);
+    MODEL_ASSERT(NULL != sock);
+    MODEL_ASSERT(NULL != req);
+
+    /* make working with the request more convenient. */
+    uint8_t* breq = (uint8_t*)req;
+
+    /* the payload size should be equal to the size of a 32-bit size and the
+     * 32-bit offset. */
+    if (size != sizeof(uint32_t) * 2)
+    {
+        retval = AGENTD_ERROR_RANDOMSERVICE_REQUEST_PACKET_INVALID_SIZE;
+        goto write_status;
+    }
+
+    /* decode the offset. */
+    memcpy(&offset, breq, sizeof(uint32_t));
+    offset = ntohl(offset);
+    breq += sizeof(uint32_t);
+
+    /* decode the size. */
+    memcpy(&rndsize, breq, sizeof(uint32_t));
+    rndsize = ntohl(rndsize);
+
+    /* verify that this size is sane. */
+    if (
+        rndsize == 0
+     || rndsize > RANDOMSERVICE_GET_RANDOM_BYTES_BULK_MAXIMUM_SIZE)
+    {
+        retval = AGENTD_ERROR_RANDOMSERVICE_GET_RANDOM_BYTES_INVALID_SIZE;
+        goto write_status;
+    }
+
+    /* allocate the random buffer. */
+    buffer = (uint8_t*)malloc(rndsize);
+    if (NULL == buffer)
+    {
+        return AGENTD_ERROR_GENERAL_OUT_OF_MEMORY;
+    }
+
+    /* fill the buffer with random data. */
+    retval = randomservice_read_random_bytes(inst, buffer, rndsize);
+    if (AGENTD_STATUS_SUCCESS != retval)
+    {
+        memset(buffer, 0, rndsize);
+        free(buffer);
+        goto write_status;
+    }
+
+    /* | Response packet.                                             | */
+    /* | --------------------------------------------- | ------------ | */
+    /* | DATA                                          | SIZE         | */
+    /* | --------------------------------------------- | ------------ | */
+    /* | method_id                                     | 4 bytes      | */
+    /* | offset                                        | 4 bytes      | */
+    /* | status                                        | 4 bytes      | */
+    /* | data                                          | n - 12 bytes | */
+    /* | --------------------------------------------- | ------------ | */
+    uint32_t hdr[3] = {
+        htonl(RANDOMSERVICE_API_METHOD_GET_RANDOM_BYTES_BULK),
+        htonl(offset),
+        htonl(AGENTD_STATUS_SUCCESS)
+    };
+
+    /* queue the response; the write buffer now owns the random buffer. */
+    retval =
+        ipc_queue_data_by_reference_noblock(
+            sock, hdr, sizeof(hdr), buffer, rndsize, &random_bytes_release,
+            NULL);
+    if (AGENTD_STATUS_SUCCESS != retval)
+    {
+        return AGENTD_ERROR_RANDOMSERVICE_IPC_WRITE_DATA_FAILURE;
+    }
+
+    /* success. */
+    return AGENTD_STATUS_SUCCESS;
+
+write_status:
+    /* write the error status to the caller. */
+    return
+        randomservice_decode_and_dispatch_write_status(
+            sock, RANDOMSERVICE_API_METHOD_GET_RANDOM_BYTES_BULK, offset,
+            (uint32_t)retval, NULL, 0);
+}
+
+/**
+ * \brief Clear and free a random buffer once it has been written.
+ *
+ * \param data          The random buffer.
+ * \param size          The size of the random buffer.
+ * \param user_context  Unused.
+ */
+static void random_bytes_release(
+    const void* data, size_t size, void* UNUSED(user_context))
+{
+    memset((void*)data, 0, size);
+    free((void*)data);
+}
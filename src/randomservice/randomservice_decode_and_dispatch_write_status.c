@@ -19,6 +19,9 @@
 /**
  * \brief Write a status response to the socket.
  *
+ * The response is only queued.  The read callback flushes every response
+ * queued while draining its read buffer in a single write.
+ *
  * Returns 0 on success or non-fatal error.  If a non-zero error message is
  * returned, then a fatal error has occurred that should not be recovered from.
  *
@@ -88,8 +91,8 @@ int randomservice_decode_and_dispatch_write_status(
         memcpy(resp + 3, data, data_size);
     }
 
-    /* write the data packet. */
-    int retval = ipc_write_data_noblock(sock, resp, respsize);
+    /* queue the data packet; the caller flushes all queued responses. */
+    int retval = ipc_queue_data_noblock(sock, resp, respsize);
     if (AGENTD_STATUS_SUCCESS != retval)
     {
         retval = AGENTD_ERROR_RANDOMSERVICE_IPC_WRITE_DATA_FAILURE;
@@ -53,6 +53,9 @@ int randomservice_decode_and_dispatch(
 /**
  * \brief Write a status response to the socket.
  *
+ * The response is only queued.  The read callback flushes every response
+ * queued while draining its read buffer in a single write.
+ *
  * Returns 0 on success or non-fatal error.  If a non-zero error message is
  * returned, then a fatal error has occurred that should not be recovered from.
  *
@@ -97,6 +100,46 @@ int randomservice_decode_and_dispatch_get_random_bytes(
     randomservice_root_context_t* inst, ipc_socket_context_t* sock, void* req,
     size_t size);
 
+/**
+ * \brief Decode and dispatch a bulk get random bytes request.
+ *
+ * Returns 0 on success or non-fatal error.  If a non-zero error message is
+ * returned, then a fatal error has occurred that should not be recovered from.
+ * Any additional information on the socket is suspect.
+ *
+ * \param inst          The instance on which the dispatch occurs.
+ * \param sock          The socket on which the request was received and the
+ *                      response is to be written.
+ * \param req           The request to be decoded and dispatched.
+ * \param size          The size of the request.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - A non-zero fatal error.
+ */
+int randomservice_decode_and_dispatch_get_random_bytes_bulk(
+    randomservice_root_context_t* inst, ipc_socket_context_t* sock, void* req,
+    size_t size);
+
+/**
+ * \brief Fill a buffer with random bytes.
+ *
+ * The kernel's getrandom() interface is preferred, since it avoids a
+ * descriptor round trip and can satisfy large requests in few calls.  If it
+ * is unavailable, the instance's random device descriptor is read instead.
+ *
+ * \param inst          The instance providing the random device.
+ * \param buffer        The buffer to fill.
+ * \param size          The number of bytes to fill.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_RANDOMSERVICE_GET_RANDOM_BYTES_READ_FAILED if the
+ *        random bytes could not be read.
+ */
+int randomservice_read_random_bytes(
+    randomservice_root_context_t* inst, void* buffer, size_t size);
+
 /**
  * \brief Read callback for the random service protocol socket.
  *
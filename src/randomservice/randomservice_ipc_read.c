@@ -10,6 +10,7 @@
 #include <agentd/ipc.h>
 #include <agentd/status_codes.h>
 #include <cbmc/model_assert.h>
+#include <errno.h>
 #include <vpr/parameters.h>
 
 #include "randomservice_internal.h"
@@ -46,7 +47,7 @@ void randomservice_ipc_read(
     do
     {
         /* attempt to read a request. */
-        retval = ipc_read_data_noblock(ctx, &req, &size);
+        retval = ipc_read_data_view_noblock(ctx, &req, &size);
         switch (retval)
         {
             /* on success, decode and dispatch. */
@@ -57,9 +58,11 @@ void randomservice_ipc_read(
                     randomservice_exit_event_loop(instance);
                 }
 
-                /* clear and free the request data. */
-                memset(req, 0, size);
-                free(req);
+                /* return the request view to the read buffer. */
+                if (AGENTD_STATUS_SUCCESS != ipc_read_data_view_release(ctx))
+                {
+                    randomservice_exit_event_loop(instance);
+                }
                 break;
 
             /* Wait for more data on the socket. */
@@ -75,7 +78,19 @@ void randomservice_ipc_read(
     } while (AGENTD_STATUS_SUCCESS == retval
              && ipc_socket_readbuffer_size(ctx) > 0);
 
-    /* fire up the write callback if there is data to write. */
+    /* flush all queued responses at once; evbuffer_write gathers them into
+     * a single writev. */
+    if (ipc_socket_writebuffer_size(ctx) > 0)
+    {
+        ssize_t bytes_written = ipc_socket_write_from_buffer(ctx);
+        if (bytes_written < 0 && errno != EAGAIN && errno != EWOULDBLOCK)
+        {
+            randomservice_exit_event_loop(instance);
+            return;
+        }
+    }
+
+    /* fire up the write callback if there is data left to write. */
     if (ipc_socket_writebuffer_size(ctx) > 0)
     {
         ipc_set_writecb_noblock(
@@ -0,0 +1,87 @@
+/**
+ * \file randomservice/randomservice_read_random_bytes.c
+ *
+ * \brief Fill a buffer with random bytes.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/randomservice/private/randomservice.h>
+#include <agentd/status_codes.h>
+#include <cbmc/model_assert.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <sys/random.h>
+#include <unistd.h>
+
+#include "randomservice_internal.h"
+
+/**
+ * \brief Fill a buffer with random bytes.
+ *
+ * The kernel's getrandom() interface is preferred, since it avoids a
+ * descriptor round trip and can satisfy large requests in few calls.  If it
+ * is unavailable, the instance's random device descriptor is read instead.
+ *
+ * \param inst          The instance providing the random device.
+ * \param buffer        The buffer to fill.
+ * \param size          The number of bytes to fill.
+ *
+ * \returns a status code indicating success or failure.
+ *      - AGENTD_STATUS_SUCCESS on success.
+ *      - AGENTD_ERROR_RANDOMSERVICE_GET_RANDOM_BYTES_READ_FAILED if the
+ *        random bytes could not be read.
+ */
+int randomservice_read_random_bytes(
+    randomservice_root_context_t* inst, void* buffer, size_t size)
+{
+    uint8_t* bbuf = (uint8_t*)buffer;
+    bool use_getrandom = true;
+    ssize_t bytes_read;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != inst);
+    MODEL_ASSERT(NULL != buffer);
+
+    /* large reads may be satisfied in several pieces. */
+    while (size > 0)
+    {
+        if (use_getrandom)
+        {
+            bytes_read = getrandom(bbuf, size, 0);
+        }
+        else
+        {
+            bytes_read = read(inst->random_fd, bbuf, size);
+        }
+
+        if (bytes_read < 0)
+        {
+            /* retry if interrupted by a signal. */
+            if (EINTR == errno)
+            {
+                continue;
+            }
+            /* fall back to the random device if getrandom is unusable. */
+            else if (use_getrandom)
+            {
+                use_getrandom = false;
+                continue;
+            }
+
+            return AGENTD_ERROR_RANDOMSERVICE_GET_RANDOM_BYTES_READ_FAILED;
+        }
+        /* the random device should never reach end of file. */
+        else if (0 == bytes_read)
+        {
+            return AGENTD_ERROR_RANDOMSERVICE_GET_RANDOM_BYTES_READ_FAILED;
+        }
+
+        bbuf += bytes_read;
+        size -= bytes_read;
+    }
+
+    /* success. */
+    return AGENTD_STATUS_SUCCESS;
+}
@@ -8,6 +8,7 @@
 
 #include <agentd/control.h>
 #include <agentd/attestationservice.h>
+#include <agentd/attestationservice/api.h>
 #include <agentd/supervisor/supervisor_internal.h>
 #include <agentd/ipc.h>
 #include <vpr/allocator/malloc_allocator.h>
@@ -26,6 +27,7 @@ typedef struct attestation_process
     int* data_socket;
     int* log_socket;
     int control_socket;
+    int* wakeup_socket;
     /* do not close the srv socket. */
     int control_srv_socket;
 } attestation_process_t;
@@ -47,6 +49,8 @@ static int supervisor_start_attestationservice(process_t* proc);
  * \param data_socket           The data socket descriptor.
  * \param log_socket            The log socket descriptor.
  * \param control_socket        The control socket descriptor.
+ * \param wakeup_socket         The read side of the transaction submit wakeup
+ *                              socket.
  *
  * \returns a status indicating success or failure.
  *          - AGENTD_STATUS_SUCCESS on success.
@@ -55,7 +59,8 @@ static int supervisor_start_attestationservice(process_t* proc);
 int supervisor_create_attestationservice(
     process_t** svc, const bootstrap_config_t* bconf,
     const agent_config_t* conf, config_private_key_t* private_key,
-    int* data_socket, int* log_socket, int* control_socket)
+    int* data_socket, int* log_socket, int* control_socket,
+    int* wakeup_socket)
 {
     int retval;
 
@@ -78,6 +83,7 @@ int supervisor_create_attestationservice(
     attestation_proc->private_key = private_key;
     attestation_proc->data_socket = data_socket;
     attestation_proc->log_socket = log_socket;
+    attestation_proc->wakeup_socket = wakeup_socket;
 
     /* create the socketpair for the control socket. */
     retval =
@@ -115,6 +121,7 @@ static int supervisor_start_attestationservice(process_t* proc)
 {
     attestation_process_t* attestation_proc = (attestation_process_t*)proc;
     int retval;
+    uint32_t offset, status;
     allocator_options_t alloc_opts;
 
     /* create an allocator instance. */
@@ -126,11 +133,25 @@ static int supervisor_start_attestationservice(process_t* proc)
             attestation_proc->bconf, attestation_proc->conf,
             attestation_proc->log_socket, attestation_proc->data_socket,
             &attestation_proc->control_socket,
+            attestation_proc->wakeup_socket,
             &attestation_proc->hdr.process_id,
             true),
         done);
 
-    /* TODO - send configuration data to the attestion process. */
+    /* attempt to send config data to the attestation proc. */
+    TRY_OR_FAIL(
+        attestationservice_api_sendreq_configure(
+            attestation_proc->control_srv_socket, attestation_proc->conf),
+        terminate_proc);
+
+    /* attempt to read the response from this configure. */
+    TRY_OR_FAIL(
+        attestationservice_api_recvresp_configure(
+            attestation_proc->control_srv_socket, &offset, &status),
+        terminate_proc);
+
+    /* verify that the configure operation completed successfully. */
+    TRY_OR_FAIL(status, terminate_proc);
 
     /* TODO - add supervisor configuration steps here. */
 
@@ -138,14 +159,12 @@ static int supervisor_start_attestationservice(process_t* proc)
     retval = AGENTD_STATUS_SUCCESS;
     goto done;
 
-#if 0
 terminate_proc:
     /* force the running status to true so we can terminate the process. */
     attestation_proc->hdr.running = true;
     process_stop((process_t*)attestation_proc);
     sleep(5);
     process_kill((process_t*)attestation_proc);
-#endif
 
 done:
     dispose((disposable_t*)&alloc_opts);
@@ -182,6 +201,13 @@ static void supervisor_dispose_attestationservice(void* disposable)
         attestation_proc->control_socket = -1;
     }
 
+    /* clean up the wakeup socket if valid. */
+    if (*attestation_proc->wakeup_socket > 0)
+    {
+        close(*attestation_proc->wakeup_socket);
+        *attestation_proc->wakeup_socket = -1;
+    }
+
     if (attestation_proc->hdr.running)
     {
         /* call the process stop method. */
@@ -19,7 +19,8 @@ typedef struct listener_process
     process_t hdr;
     const bootstrap_config_t* bconf;
     const agent_config_t* conf;
-    int accept_lsocket;
+    int accept_lsocket[PROTOCOL_INSTANCES_MAXIMUM];
+    size_t accept_count;
     int* log_socket;
 } listener_process_t;
 
@@ -36,8 +37,9 @@ static int supervisor_start_listener_service(process_t* proc);
  * \param conf                  Agentd configuration to be used to build the
  *                              listener service.  This configuration must be
  *                              valid for the lifetime of the service.
- * \param accept_socket         Pointer to the descriptor to receive the accept
- *                              socket.
+ * \param accept_sockets        Array of descriptors to receive the accept
+ *                              sockets, one for each protocol service instance.
+ * \param accept_count          The number of entries in accept_sockets.
  * \param log_socket            Pointer to the descriptor holding the log socket
  *                              for this instance.
  *
@@ -47,10 +49,18 @@ static int supervisor_start_listener_service(process_t* proc);
  */
 int supervisor_create_listener_service(
     process_t** svc, const bootstrap_config_t* bconf,
-    const agent_config_t* conf, int* accept_socket, int* log_socket)
+    const agent_config_t* conf, int* accept_sockets, size_t accept_count,
+    int* log_socket)
 {
     int retval;
 
+    /* we can only hand connections to so many protocol service instances. */
+    if (0 == accept_count || accept_count > PROTOCOL_INSTANCES_MAXIMUM)
+    {
+        retval = AGENTD_ERROR_LISTENSERVICE_PRIVSEP_SETFDS_FAILURE;
+        goto done;
+    }
+
     /* allocate memory for the listener process. */
     listener_process_t* listener_proc =
         (listener_process_t*)malloc(sizeof(listener_process_t));
@@ -67,14 +77,23 @@ int supervisor_create_listener_service(
     listener_proc->bconf = bconf;
     listener_proc->conf = conf;
     listener_proc->log_socket = log_socket;
+    for (size_t i = 0; i < PROTOCOL_INSTANCES_MAXIMUM; ++i)
+    {
+        listener_proc->accept_lsocket[i] = -1;
+    }
 
-    /* create a socket pair for sending the protocol service accepted
-     * connections. */
-    TRY_OR_FAIL(
-        ipc_socketpair(
-            AF_UNIX, SOCK_DGRAM, 0,
-            &listener_proc->accept_lsocket, accept_socket),
-        cleanup_listener_proc);
+    /* create a socket pair for sending each protocol service instance its
+     * accepted connections. */
+    for (size_t i = 0; i < accept_count; ++i)
+    {
+        TRY_OR_FAIL(
+            ipc_socketpair(
+                AF_UNIX, SOCK_DGRAM, 0,
+                &listener_proc->accept_lsocket[i], &accept_sockets[i]),
+            cleanup_listener_proc);
+
+        ++listener_proc->accept_count;
+    }
 
     /* success */
     retval = AGENTD_STATUS_SUCCESS;
@@ -105,8 +124,9 @@ static int supervisor_start_listener_service(process_t* proc)
     /* attempt to create the listener service. */
     TRY_OR_FAIL(
         listenservice_proc(
-            listen_proc->bconf, listen_proc->conf, &listen_proc->accept_lsocket,
-            listen_proc->log_socket, &listen_proc->hdr.process_id, true),
+            listen_proc->bconf, listen_proc->conf, listen_proc->accept_lsocket,
+            listen_proc->accept_count, listen_proc->log_socket,
+            &listen_proc->hdr.process_id, true),
         done);
 
     /* success */
@@ -123,11 +143,14 @@ static void supervisor_dispose_listener_service(void* disposable)
 {
     listener_process_t* listener = (listener_process_t*)disposable;
 
-    /* clean up the accept socket if valid. */
-    if (listener->accept_lsocket >= 0)
+    /* clean up the accept sockets if valid. */
+    for (size_t i = 0; i < listener->accept_count; ++i)
     {
-        close(listener->accept_lsocket);
-        listener->accept_lsocket = -1;
+        if (listener->accept_lsocket[i] >= 0)
+        {
+            close(listener->accept_lsocket[i]);
+            listener->accept_lsocket[i] = -1;
+        }
     }
 
     /* clean up the log socket if valid. */
@@ -21,7 +21,8 @@ typedef struct notification_process
     const agent_config_t* conf;
     int log_socket;
     int consensus_socket;
-    int protocol_socket;
+    int protocol_socket[PROTOCOL_INSTANCES_MAXIMUM];
+    size_t protocol_count;
 } notification_process_t;
 
 /* forward decls. */
@@ -40,8 +41,9 @@ static int supervisor_start_notification_service(process_t* proc);
  * \param log_socket            The log socket descriptor.
  * \param consensus_socket      The socket pointer to receive the socket for the
  *                              consensus service.
- * \param protocol_socket       The socket pointer to receive the socket for the
- *                              protocol service.
+ * \param protocol_sockets      Array of socket descriptors to receive the
+ *                              sockets for each protocol service instance.
+ * \param protocol_count        The number of entries in protocol_sockets.
  *
  * \returns a status indicating success or failure.
  *          - AGENTD_STATUS_SUCCESS on success.
@@ -50,10 +52,17 @@ static int supervisor_start_notification_service(process_t* proc);
 int supervisor_create_notification_service(
     process_t** svc, const bootstrap_config_t* bconf,
     const agent_config_t* conf, int* log_socket, int* consensus_socket,
-    int* protocol_socket)
+    int* protocol_sockets, size_t protocol_count)
 {
     int retval;
 
+    /* we can only serve so many protocol service instances. */
+    if (0 == protocol_count || protocol_count > PROTOCOL_INSTANCES_MAXIMUM)
+    {
+        retval = AGENTD_ERROR_NOTIFICATIONSERVICE_PRIVSEP_SETFDS_FAILURE;
+        goto done;
+    }
+
     /* allocate memory for the notification process. */
     notification_process_t* notification_proc =
         (notification_process_t*)malloc(sizeof(notification_process_t));
@@ -72,7 +81,10 @@ int supervisor_create_notification_service(
     notification_proc->conf = conf;
     notification_proc->log_socket = -1;
     notification_proc->consensus_socket = -1;
-    notification_proc->protocol_socket = -1;
+    for (size_t i = 0; i < PROTOCOL_INSTANCES_MAXIMUM; ++i)
+    {
+        notification_proc->protocol_socket[i] = -1;
+    }
 
     /* create the socketpair for the consennus socket. */
     retval =
@@ -84,14 +96,19 @@ int supervisor_create_notification_service(
         goto cleanup_notification_proc;
     }
 
-    /* create the socketpair for the protocol socket. */
-    retval =
-        ipc_socketpair(
-            AF_UNIX, SOCK_STREAM, 0, protocol_socket,
-            &notification_proc->protocol_socket);
-    if (AGENTD_STATUS_SUCCESS != retval)
+    /* create a socketpair for each protocol service instance. */
+    for (size_t i = 0; i < protocol_count; ++i)
     {
-        goto cleanup_notification_proc;
+        retval =
+            ipc_socketpair(
+                AF_UNIX, SOCK_STREAM, 0, &protocol_sockets[i],
+                &notification_proc->protocol_socket[i]);
+        if (AGENTD_STATUS_SUCCESS != retval)
+        {
+            goto cleanup_notification_proc;
+        }
+
+        ++notification_proc->protocol_count;
     }
 
     /* take ownership of the log socket. */
@@ -132,10 +149,13 @@ static void supervisor_dispose_notification_service(void* disposable)
         close(notification_proc->consensus_socket);
     }
 
-    /* close the protocol socket, if open. */
-    if (-1 != notification_proc->protocol_socket)
+    /* close the protocol sockets, if open. */
+    for (size_t i = 0; i < notification_proc->protocol_count; ++i)
     {
-        close(notification_proc->protocol_socket);
+        if (-1 != notification_proc->protocol_socket[i])
+        {
+            close(notification_proc->protocol_socket[i]);
+        }
     }
 
     /* clear out structure. */
@@ -162,13 +182,17 @@ static int supervisor_start_notification_service(process_t* proc)
             notification_proc->bconf, notification_proc->conf,
             notification_proc->log_socket, notification_proc->consensus_socket,
             notification_proc->protocol_socket,
+            notification_proc->protocol_count,
             &notification_proc->hdr.process_id, true),
         done);
 
     /* if successful, the child process owns the sockets. */
     notification_proc->log_socket = -1;
     notification_proc->consensus_socket = -1;
-    notification_proc->protocol_socket = -1;
+    for (size_t i = 0; i < notification_proc->protocol_count; ++i)
+    {
+        notification_proc->protocol_socket[i] = -1;
+    }
 
     /* success. */
     retval = AGENTD_STATUS_SUCCESS;
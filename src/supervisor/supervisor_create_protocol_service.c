@@ -29,6 +29,9 @@ typedef struct protocol_process
     int* data_socket;
     int* log_socket;
     int* notify_socket;
+    int wakeup_socket;
+    int* data_reader_sockets;
+    size_t data_reader_count;
     int control;
 } protocol_process_t;
 
@@ -54,6 +57,13 @@ static int supervisor_start_protocol_service(process_t* proc);
  * \param data_socket           The data socket descriptor.
  * \param log_socket            The log socket descriptor.
  * \param notify_socket         The notificationservice socket descriptor.
+ * \param wakeup_socket         The write side of the attestation service
+ *                              wakeup socket. This socket is shared by every
+ *                              protocol service instance and is not owned by
+ *                              this process.
+ * \param data_reader_sockets   Array of read-only data service socket
+ *                              descriptors.
+ * \param data_reader_count     The number of read-only data service sockets.
  *
  * \returns a status indicating success or failure.
  *          - AGENTD_STATUS_SUCCESS on success.
@@ -64,7 +74,8 @@ int supervisor_create_protocol_service(
     const agent_config_t* conf, config_private_key_t* private_key,
     config_public_entity_node_t* public_entities, int* random_socket,
     int* accept_socket, int* control_socket, int* data_socket, int* log_socket,
-    int* notify_socket)
+    int* notify_socket, int wakeup_socket, int* data_reader_sockets,
+    size_t data_reader_count)
 {
     int retval;
 
@@ -90,6 +101,9 @@ int supervisor_create_protocol_service(
     protocol_proc->data_socket = data_socket;
     protocol_proc->log_socket = log_socket;
     protocol_proc->notify_socket = notify_socket;
+    protocol_proc->wakeup_socket = wakeup_socket;
+    protocol_proc->data_reader_sockets = data_reader_sockets;
+    protocol_proc->data_reader_count = data_reader_count;
 
     /* create the socketpair for the control socket. */
     retval =
@@ -142,7 +156,9 @@ static int supervisor_start_protocol_service(process_t* proc)
             *protocol_proc->random_socket, *protocol_proc->log_socket,
             *protocol_proc->accept_socket, protocol_proc->control_socket,
             *protocol_proc->data_socket, *protocol_proc->notify_socket,
-            &protocol_proc->hdr.process_id, true),
+            protocol_proc->wakeup_socket, protocol_proc->data_reader_sockets,
+            protocol_proc->data_reader_count, &protocol_proc->hdr.process_id,
+            true),
         done);
 
     /* if successful, the child process owns the sockets. */
@@ -152,6 +168,10 @@ static int supervisor_start_protocol_service(process_t* proc)
     protocol_proc->control_socket = -1;
     *protocol_proc->data_socket = -1;
     *protocol_proc->notify_socket = -1;
+    for (size_t i = 0; i < protocol_proc->data_reader_count; ++i)
+    {
+        protocol_proc->data_reader_sockets[i] = -1;
+    }
 
     /* write the private key request to the protocol service control socket. */
     TRY_OR_FAIL(
@@ -283,6 +303,16 @@ static void supervisor_dispose_protocol_service(void* disposable)
         *protocol_proc->notify_socket = -1;
     }
 
+    /* clean up the data reader sockets if valid. */
+    for (size_t i = 0; i < protocol_proc->data_reader_count; ++i)
+    {
+        if (protocol_proc->data_reader_sockets[i] > 0)
+        {
+            close(protocol_proc->data_reader_sockets[i]);
+            protocol_proc->data_reader_sockets[i] = -1;
+        }
+    }
+
     if (protocol_proc->hdr.running)
     {
         /* call the process stop method. */
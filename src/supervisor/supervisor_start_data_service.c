@@ -44,7 +44,10 @@ int supervisor_start_data_service(process_t* proc)
     TRY_OR_FAIL(
         dataservice_api_sendreq_root_context_init_block(
             *data_proc->supervisor_data_socket, &alloc_opts,
-            data_proc->conf->database_max_size, data_proc->conf->datastore),
+            data_proc->conf->database_max_size,
+            (uint32_t)data_proc->conf->datastore_flags,
+            (uint32_t)data_proc->conf->datastore_max_readers,
+            data_proc->conf->datastore),
         terminate_proc);
 
     /* attempt to read the response from this init. */
@@ -0,0 +1,122 @@
+/**
+ * \file workpool/workpool_create.c
+ *
+ * \brief Create a worker pool.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <signal.h>
+#include <string.h>
+
+#include "workpool_internal.h"
+
+RCPR_IMPORT_allocator;
+RCPR_IMPORT_resource;
+
+/**
+ * \brief Create a worker pool.
+ *
+ * The worker threads are started here and live until the pool is released.
+ * The caller of \ref workpool_run counts as one of the threads, so a pool
+ * created with \p threads set to 4 starts three workers. If a worker fails to
+ * start, the pool runs with the workers that did.
+ *
+ * \param pool          Pointer to the pool pointer, populated with the pool
+ *                      on success.
+ * \param alloc         The allocator to use for this operation.
+ * \param threads       The number of threads that run slices, including the
+ *                      caller of \ref workpool_run.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status workpool_create(
+    workpool** pool, RCPR_SYM(allocator)* alloc, size_t threads)
+{
+    status retval, release_retval;
+    workpool* tmp;
+    sigset_t sigset, oldset;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != pool);
+    MODEL_ASSERT(NULL != alloc);
+    MODEL_ASSERT(threads > 0);
+
+    /* allocate memory for the pool. */
+    retval = allocator_allocate(alloc, (void**)&tmp, sizeof(workpool));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* clear the struct. */
+    memset(tmp, 0, sizeof(workpool));
+
+    /* set the resource handler. */
+    resource_init(&tmp->hdr, &workpool_resource_release);
+
+    /* set the init values. */
+    tmp->alloc = alloc;
+    pthread_mutex_init(&tmp->run_lock, NULL);
+    pthread_mutex_init(&tmp->lock, NULL);
+    pthread_cond_init(&tmp->work_cond, NULL);
+    pthread_cond_init(&tmp->done_cond, NULL);
+
+    /* the calling thread runs the first slice. */
+    if (threads <= 1)
+    {
+        goto success;
+    }
+
+    /* allocate the worker array. */
+    retval =
+        allocator_allocate(
+            alloc, (void**)&tmp->workers,
+            (threads - 1) * sizeof(workpool_worker));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_pool;
+    }
+
+    /* the workers must not take signals meant for the service. */
+    sigfillset(&sigset);
+    pthread_sigmask(SIG_BLOCK, &sigset, &oldset);
+
+    /* start the workers, keeping the ones that started. */
+    for (size_t i = 0; i < threads - 1; ++i)
+    {
+        workpool_worker* worker = &tmp->workers[tmp->worker_count];
+        worker->pool = tmp;
+        worker->slice = tmp->worker_count + 1;
+
+        if (0 !=
+                pthread_create(
+                    &worker->thread, NULL, &workpool_worker_entry, worker))
+        {
+            break;
+        }
+
+        ++tmp->worker_count;
+    }
+
+    /* restore the caller's signal mask. */
+    pthread_sigmask(SIG_SETMASK, &oldset, NULL);
+
+success:
+    *pool = tmp;
+    retval = STATUS_SUCCESS;
+    goto done;
+
+cleanup_pool:
+    release_retval = resource_release(&tmp->hdr);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+done:
+    return retval;
+}
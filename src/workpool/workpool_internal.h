@@ -0,0 +1,93 @@
+/**
+ * \file workpool/workpool_internal.h
+ *
+ * \brief Internal types and definitions for the worker pool.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#pragma once
+
+#include <agentd/workpool.h>
+#include <pthread.h>
+#include <rcpr/resource/protected.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif  //__cplusplus
+
+/**
+ * \brief A worker thread in a pool.
+ */
+typedef struct workpool_worker workpool_worker;
+
+struct workpool_worker
+{
+    workpool* pool;
+    size_t slice;
+    pthread_t thread;
+};
+
+/**
+ * \brief A pool of worker threads.
+ *
+ * Every field after run_lock is guarded by lock.
+ */
+struct workpool
+{
+    RCPR_SYM(resource) hdr;
+
+    RCPR_SYM(allocator)* alloc;
+    pthread_mutex_t run_lock;
+    pthread_mutex_t lock;
+    pthread_cond_t work_cond;
+    pthread_cond_t done_cond;
+    bool terminate;
+    uint64_t generation;
+    size_t pending;
+    workpool_slice_fn fn;
+    void* context;
+    size_t count;
+    size_t worker_count;
+    workpool_worker* workers;
+};
+
+/**
+ * \brief Release a \ref workpool resource.
+ *
+ * \param r             The workpool resource to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status workpool_resource_release(RCPR_SYM(resource)* r);
+
+/**
+ * \brief The entry point for a worker thread.
+ *
+ * \param context       Opaque pointer to the \ref workpool_worker instance
+ *                      for this thread.
+ *
+ * \returns NULL.
+ */
+void* workpool_worker_entry(void* context);
+
+/**
+ * \brief Get the bounds of a slice of the current loop.
+ *
+ * \param pool          The pool running the loop.
+ * \param slice         The slice index; 0 is the calling thread.
+ * \param begin         Pointer to receive the first index in the slice.
+ * \param end           Pointer to receive one past the last index.
+ */
+void workpool_slice_bounds(
+    const workpool* pool, size_t slice, size_t* begin, size_t* end);
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif  //__cplusplus
@@ -0,0 +1,30 @@
+/**
+ * \file workpool/workpool_resource_handle.c
+ *
+ * \brief Get the resource handle for a \ref workpool.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+
+#include "workpool_internal.h"
+
+RCPR_IMPORT_resource;
+
+/**
+ * \brief Given a worker pool, return the resource handle for this pool.
+ *
+ * Releasing this resource stops and joins the worker threads.
+ *
+ * \param pool          The pool for this operation.
+ *
+ * \returns the resource handle for this pool.
+ */
+resource* workpool_resource_handle(workpool* pool)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != pool);
+
+    return &pool->hdr;
+}
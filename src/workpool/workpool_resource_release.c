@@ -0,0 +1,75 @@
+/**
+ * \file workpool/workpool_resource_release.c
+ *
+ * \brief Release a \ref workpool.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+
+#include "workpool_internal.h"
+
+RCPR_IMPORT_allocator;
+RCPR_IMPORT_resource;
+
+/**
+ * \brief Release a \ref workpool resource.
+ *
+ * The workers are stopped and joined before the pool memory is reclaimed.
+ *
+ * \param r             The workpool resource to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status workpool_resource_release(resource* r)
+{
+    status release_workers_retval = STATUS_SUCCESS;
+    status release_retval = STATUS_SUCCESS;
+
+    workpool* pool = (workpool*)r;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != pool);
+
+    /* cache the allocator. */
+    allocator* alloc = pool->alloc;
+
+    /* stop the workers. */
+    pthread_mutex_lock(&pool->lock);
+    pool->terminate = true;
+    pthread_cond_broadcast(&pool->work_cond);
+    pthread_mutex_unlock(&pool->lock);
+
+    /* wait for the workers to exit. */
+    for (size_t i = 0; i < pool->worker_count; ++i)
+    {
+        pthread_join(pool->workers[i].thread, NULL);
+    }
+
+    /* release the worker array if allocated. */
+    if (NULL != pool->workers)
+    {
+        release_workers_retval = allocator_reclaim(alloc, pool->workers);
+    }
+
+    pthread_cond_destroy(&pool->done_cond);
+    pthread_cond_destroy(&pool->work_cond);
+    pthread_mutex_destroy(&pool->lock);
+    pthread_mutex_destroy(&pool->run_lock);
+
+    /* release pool memory. */
+    release_retval = allocator_reclaim(alloc, pool);
+
+    /* return the appropriate status code. */
+    if (STATUS_SUCCESS != release_workers_retval)
+    {
+        return release_workers_retval;
+    }
+    else
+    {
+        return release_retval;
+    }
+}
@@ -0,0 +1,81 @@
+/**
+ * \file workpool/workpool_run.c
+ *
+ * \brief Run a loop on a worker pool.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+
+#include "workpool_internal.h"
+
+/**
+ * \brief Split a loop over \p count items into slices and run them on the
+ * pool, returning when every slice has run.
+ *
+ * The first slice runs on the calling thread. Loops with fewer than
+ * \p parallel_min items, or a NULL pool, run inline as a single slice. Calls
+ * from several threads are serialized; a slice function must not call
+ * \ref workpool_run on the same pool.
+ *
+ * \param pool          The pool to use, or NULL to run inline.
+ * \param fn            The loop body.
+ * \param context       The context passed to \p fn.
+ * \param count         The number of items in the loop.
+ * \param parallel_min  Loops with fewer items than this run inline.
+ */
+void workpool_run(
+    workpool* pool, workpool_slice_fn fn, void* context, size_t count,
+    size_t parallel_min)
+{
+    size_t begin, end;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != fn);
+
+    /* small loops are not worth waking the workers. */
+    if (NULL == pool || 0 == pool->worker_count || count < parallel_min)
+    {
+        if (count > 0)
+        {
+            fn(context, 0, count);
+        }
+
+        return;
+    }
+
+    /* only one loop runs on the pool at a time. */
+    pthread_mutex_lock(&pool->run_lock);
+
+    /* publish the loop and wake the workers. */
+    pthread_mutex_lock(&pool->lock);
+    pool->fn = fn;
+    pool->context = context;
+    pool->count = count;
+    pool->pending = pool->worker_count;
+    ++pool->generation;
+    pthread_cond_broadcast(&pool->work_cond);
+    pthread_mutex_unlock(&pool->lock);
+
+    /* run the first slice on this thread. */
+    workpool_slice_bounds(pool, 0, &begin, &end);
+    if (begin < end)
+    {
+        fn(context, begin, end);
+    }
+
+    /* wait for the workers to finish their slices. */
+    pthread_mutex_lock(&pool->lock);
+    while (pool->pending > 0)
+    {
+        pthread_cond_wait(&pool->done_cond, &pool->lock);
+    }
+
+    pool->fn = NULL;
+    pool->context = NULL;
+    pool->count = 0;
+    pthread_mutex_unlock(&pool->lock);
+
+    pthread_mutex_unlock(&pool->run_lock);
+}
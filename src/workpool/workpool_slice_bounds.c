@@ -0,0 +1,47 @@
+/**
+ * \file workpool/workpool_slice_bounds.c
+ *
+ * \brief Get the bounds of a slice of the current loop.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+
+#include "workpool_internal.h"
+
+/**
+ * \brief Get the bounds of a slice of the current loop.
+ *
+ * The loop is split into one contiguous slice per worker, plus one for the
+ * calling thread. Trailing slices may be empty.
+ *
+ * \param pool          The pool running the loop.
+ * \param slice         The slice index; 0 is the calling thread.
+ * \param begin         Pointer to receive the first index in the slice.
+ * \param end           Pointer to receive one past the last index.
+ */
+void workpool_slice_bounds(
+    const workpool* pool, size_t slice, size_t* begin, size_t* end)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != pool);
+    MODEL_ASSERT(slice <= pool->worker_count);
+    MODEL_ASSERT(NULL != begin);
+    MODEL_ASSERT(NULL != end);
+
+    size_t slices = pool->worker_count + 1;
+    size_t size = (pool->count + slices - 1) / slices;
+
+    *begin = slice * size;
+    if (*begin > pool->count)
+    {
+        *begin = pool->count;
+    }
+
+    *end = *begin + size;
+    if (*end > pool->count)
+    {
+        *end = pool->count;
+    }
+}
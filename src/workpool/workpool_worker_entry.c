@@ -0,0 +1,75 @@
+/**
+ * \file workpool/workpool_worker_entry.c
+ *
+ * \brief The entry point for a worker pool thread.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+
+#include "workpool_internal.h"
+
+/**
+ * \brief The entry point for a worker thread.
+ *
+ * The worker sleeps until a loop is published or the pool is released. It
+ * runs its slice of each loop once, then reports back to the caller.
+ *
+ * \param context       Opaque pointer to the \ref workpool_worker instance
+ *                      for this thread.
+ *
+ * \returns NULL.
+ */
+void* workpool_worker_entry(void* context)
+{
+    workpool_worker* worker = (workpool_worker*)context;
+    uint64_t generation = 0;
+    workpool_slice_fn fn;
+    void* fn_context;
+    size_t begin, end;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != worker);
+    MODEL_ASSERT(NULL != worker->pool);
+
+    workpool* pool = worker->pool;
+
+    pthread_mutex_lock(&pool->lock);
+    for (;;)
+    {
+        /* wait for a new loop or for the pool to be released. */
+        while (!pool->terminate && generation == pool->generation)
+        {
+            pthread_cond_wait(&pool->work_cond, &pool->lock);
+        }
+
+        if (pool->terminate)
+        {
+            break;
+        }
+
+        /* take this worker's slice of the loop. */
+        generation = pool->generation;
+        fn = pool->fn;
+        fn_context = pool->context;
+        workpool_slice_bounds(pool, worker->slice, &begin, &end);
+        pthread_mutex_unlock(&pool->lock);
+
+        if (begin < end)
+        {
+            fn(fn_context, begin, end);
+        }
+
+        /* report back; the last worker wakes the caller. */
+        pthread_mutex_lock(&pool->lock);
+        if (0 == --pool->pending)
+        {
+            pthread_cond_signal(&pool->done_cond);
+        }
+    }
+
+    pthread_mutex_unlock(&pool->lock);
+
+    return NULL;
+}
@@ -910,57 +910,57 @@ BEGIN_TEST_F(multiple_attested_txns_one_block)
             }
         });
 
-    /* mock the transaction query api call. */
-    fixture.dataservice->register_callback_transaction_get(
-        [&](const dataservice_request_transaction_get_t& txn,
+    /* mock the transaction list query api call. */
+    fixture.dataservice->register_callback_transaction_list_get(
+        [&](const dataservice_request_transaction_list_get_t& txn,
             std::ostream& out) {
             void* payload;
             size_t payload_size;
+            uint32_t entry_size;
             int retval;
 
-            if (!crypto_memcmp(txn.txn_id, EXPECTED_TRANSACTION_ID_02, 16))
+            if (crypto_memcmp(txn.txn_id, EXPECTED_TRANSACTION_ID_02, 16))
             {
-                retval =
-                    dataservice_encode_response_transaction_get(
-                        &payload, &payload_size, EXPECTED_TRANSACTION_ID_02,
-                        EXPECTED_TRANSACTION_ID_01, EXPECTED_TRANSACTION_ID_03,
-                        EXPECTED_ARTIFACT_ID,
-                        htonl(DATASERVICE_TRANSACTION_NODE_STATE_ATTESTED),
-                        EXPECTED_CERT, EXPECTED_CERT_SIZE);
-                if (AGENTD_STATUS_SUCCESS != retval)
-                {
-                    return retval;
-                }
-
-                out.write((const char*)payload, payload_size);
-                free(payload);
-
-                return AGENTD_STATUS_SUCCESS;
+                /* no more records found. */
+                return AGENTD_ERROR_DATASERVICE_NOT_FOUND;
             }
-            else if (!crypto_memcmp(txn.txn_id, EXPECTED_TRANSACTION_ID_03, 16))
+
+            /* return the second and third records in a single response. */
+            retval =
+                dataservice_encode_response_transaction_get(
+                    &payload, &payload_size, EXPECTED_TRANSACTION_ID_02,
+                    EXPECTED_TRANSACTION_ID_01, EXPECTED_TRANSACTION_ID_03,
+                    EXPECTED_ARTIFACT_ID,
+                    htonl(DATASERVICE_TRANSACTION_NODE_STATE_ATTESTED),
+                    EXPECTED_CERT, EXPECTED_CERT_SIZE);
+            if (AGENTD_STATUS_SUCCESS != retval)
             {
-                retval =
-                    dataservice_encode_response_transaction_get(
-                        &payload, &payload_size, EXPECTED_TRANSACTION_ID_03,
-                        EXPECTED_TRANSACTION_ID_02, EXPECTED_TRANSACTION_END,
-                        EXPECTED_ARTIFACT_ID,
-                        htonl(DATASERVICE_TRANSACTION_NODE_STATE_ATTESTED),
-                        EXPECTED_CERT, EXPECTED_CERT_SIZE);
-                if (AGENTD_STATUS_SUCCESS != retval)
-                {
-                    return retval;
-                }
+                return retval;
+            }
 
-                out.write((const char*)payload, payload_size);
-                free(payload);
+            entry_size = htonl(payload_size);
+            out.write((const char*)&entry_size, sizeof(entry_size));
+            out.write((const char*)payload, payload_size);
+            free(payload);
 
-                return AGENTD_STATUS_SUCCESS;
-            }
-            else
+            retval =
+                dataservice_encode_response_transaction_get(
+                    &payload, &payload_size, EXPECTED_TRANSACTION_ID_03,
+                    EXPECTED_TRANSACTION_ID_02, EXPECTED_TRANSACTION_END,
+                    EXPECTED_ARTIFACT_ID,
+                    htonl(DATASERVICE_TRANSACTION_NODE_STATE_ATTESTED),
+                    EXPECTED_CERT, EXPECTED_CERT_SIZE);
+            if (AGENTD_STATUS_SUCCESS != retval)
             {
-                /* no more records found. */
-                return AGENTD_ERROR_DATASERVICE_NOT_FOUND;
+                return retval;
             }
+
+            entry_size = htonl(payload_size);
+            out.write((const char*)&entry_size, sizeof(entry_size));
+            out.write((const char*)payload, payload_size);
+            free(payload);
+
+            return AGENTD_STATUS_SUCCESS;
         });
 
     /* mock the latest block id query api call. */
@@ -1017,15 +1017,11 @@ BEGIN_TEST_F(multiple_attested_txns_one_block)
         fixture.dataservice->request_matches_transaction_get_first(
             fixture.EXPECTED_CHILD_INDEX));
 
-    /* a get call should have been made. */
-    TEST_EXPECT(
-        fixture.dataservice->request_matches_transaction_get(
-            fixture.EXPECTED_CHILD_INDEX, EXPECTED_TRANSACTION_ID_02));
-
-    /* a get call should have been made. */
+    /* a single list get call should have been made for the rest of the
+     * block. */
     TEST_EXPECT(
-        fixture.dataservice->request_matches_transaction_get(
-            fixture.EXPECTED_CHILD_INDEX, EXPECTED_TRANSACTION_ID_03));
+        fixture.dataservice->request_matches_transaction_list_get(
+            fixture.EXPECTED_CHILD_INDEX, EXPECTED_TRANSACTION_ID_02, 9));
 
     /* a block make call should have been made. */
     TEST_EXPECT(
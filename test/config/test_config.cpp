@@ -1373,6 +1373,172 @@ TEST(block_max_transactions_large)
     dispose((disposable_t*)&user_context);
 }
 
+/**
+ * Test that an empty attestation block is accepted.
+ */
+TEST(empty_attestation_block)
+{
+    YY_BUFFER_STATE state;
+    yyscan_t scanner;
+    config_context_t context;
+    test_context user_context;
+
+    test_context_init(&user_context);
+
+    context.set_error = &set_error;
+    context.val_callback = &config_callback;
+    context.user_context = &user_context;
+
+    TEST_ASSERT(0 == yylex_init(&scanner));
+    TEST_ASSERT(nullptr !=
+        (state =
+            yy_scan_string(
+                "attestation { }", scanner)));
+    TEST_ASSERT(0 == yyparse(scanner, &context));
+    yy_delete_buffer(state, scanner);
+    yylex_destroy(scanner);
+
+    /* there are no errors. */
+    TEST_ASSERT(0U == user_context.errors.size());
+
+    /* verify user config. */
+    TEST_ASSERT(nullptr != user_context.config);
+    TEST_ASSERT(!user_context.config->attestation_max_milliseconds_set);
+
+    dispose((disposable_t*)&user_context);
+}
+
+/**
+ * Test that the attestation max milliseconds can be overridden.
+ */
+TEST(attestation_max_milliseconds)
+{
+    YY_BUFFER_STATE state;
+    yyscan_t scanner;
+    config_context_t context;
+    test_context user_context;
+
+    test_context_init(&user_context);
+
+    context.set_error = &set_error;
+    context.val_callback = &config_callback;
+    context.user_context = &user_context;
+
+    TEST_ASSERT(0 == yylex_init(&scanner));
+    TEST_ASSERT(nullptr !=
+        (state =
+            yy_scan_string(
+                "attestation { max milliseconds 250 }", scanner)));
+    TEST_ASSERT(0 == yyparse(scanner, &context));
+    yy_delete_buffer(state, scanner);
+    yylex_destroy(scanner);
+
+    /* there are no errors. */
+    TEST_ASSERT(0U == user_context.errors.size());
+
+    /* verify user config. */
+    TEST_ASSERT(nullptr != user_context.config);
+    TEST_ASSERT(user_context.config->attestation_max_milliseconds_set);
+    TEST_ASSERT(250 == user_context.config->attestation_max_milliseconds);
+    TEST_ASSERT(!user_context.config->block_max_milliseconds_set);
+
+    dispose((disposable_t*)&user_context);
+}
+
+/**
+ * Test that an attestation max milliseconds below the minimum is invalid.
+ */
+TEST(attestation_max_milliseconds_small)
+{
+    YY_BUFFER_STATE state;
+    yyscan_t scanner;
+    config_context_t context;
+    test_context user_context;
+
+    test_context_init(&user_context);
+
+    context.set_error = &set_error;
+    context.val_callback = &config_callback;
+    context.user_context = &user_context;
+
+    TEST_ASSERT(0 == yylex_init(&scanner));
+    TEST_ASSERT(nullptr !=
+        (state =
+            yy_scan_string(
+                "attestation { max milliseconds 5 }", scanner)));
+    TEST_ASSERT(0 == yyparse(scanner, &context));
+    yy_delete_buffer(state, scanner);
+    yylex_destroy(scanner);
+
+    /* there is one error. */
+    TEST_ASSERT(1U == user_context.errors.size());
+
+    dispose((disposable_t*)&user_context);
+}
+
+/**
+ * Test that too large of an attestation max milliseconds is invalid.
+ */
+TEST(attestation_max_milliseconds_large)
+{
+    YY_BUFFER_STATE state;
+    yyscan_t scanner;
+    config_context_t context;
+    test_context user_context;
+
+    test_context_init(&user_context);
+
+    context.set_error = &set_error;
+    context.val_callback = &config_callback;
+    context.user_context = &user_context;
+
+    TEST_ASSERT(0 == yylex_init(&scanner));
+    TEST_ASSERT(nullptr !=
+        (state =
+            yy_scan_string(
+                "attestation { max milliseconds 9999999999 }", scanner)));
+    TEST_ASSERT(0 == yyparse(scanner, &context));
+    yy_delete_buffer(state, scanner);
+    yylex_destroy(scanner);
+
+    /* there is one error. */
+    TEST_ASSERT(1U == user_context.errors.size());
+
+    dispose((disposable_t*)&user_context);
+}
+
+/**
+ * Test that setting the attestation max milliseconds twice is an error.
+ */
+TEST(attestation_max_milliseconds_duplicate)
+{
+    YY_BUFFER_STATE state;
+    yyscan_t scanner;
+    config_context_t context;
+    test_context user_context;
+
+    test_context_init(&user_context);
+
+    context.set_error = &set_error;
+    context.val_callback = &config_callback;
+    context.user_context = &user_context;
+
+    TEST_ASSERT(0 == yylex_init(&scanner));
+    TEST_ASSERT(nullptr !=
+        (state =
+            yy_scan_string(
+                "attestation { max milliseconds 250 } "
+                "attestation { max milliseconds 500 }", scanner)));
+    TEST_ASSERT(0 == yyparse(scanner, &context));
+    yy_delete_buffer(state, scanner);
+    yylex_destroy(scanner);
+
+    /* there is one error. */
+    TEST_ASSERT(1U == user_context.errors.size());
+
+    dispose((disposable_t*)&user_context);
+}
+
 /**
  * Test that we can add a materialized view section.
  */
@@ -3443,3 +3609,424 @@ TEST(endorser_key_duplicates)
 
     dispose((disposable_t*)&user_context);
 }
+
+/**
+ * Test that we can set the number of datastore readers.
+ */
+TEST(datastore_readers)
+{
+    YY_BUFFER_STATE state;
+    yyscan_t scanner;
+    config_context_t context;
+    test_context user_context;
+
+    test_context_init(&user_context);
+
+    context.set_error = &set_error;
+    context.val_callback = &config_callback;
+    context.user_context = &user_context;
+
+    TEST_ASSERT(0 == yylex_init(&scanner));
+    TEST_ASSERT(nullptr !=
+        (state = yy_scan_string("datastore { readers 4 }", scanner)));
+    TEST_ASSERT(0 == yyparse(scanner, &context));
+    yy_delete_buffer(state, scanner);
+    yylex_destroy(scanner);
+
+    /* there are no errors. */
+    TEST_ASSERT(0U == user_context.errors.size());
+
+    /* verify user config. */
+    TEST_ASSERT(nullptr != user_context.config);
+    TEST_ASSERT(user_context.config->datastore_readers_set);
+    TEST_ASSERT(4 == user_context.config->datastore_readers);
+    TEST_ASSERT(nullptr == user_context.config->datastore);
+
+    dispose((disposable_t*)&user_context);
+}
+
+/**
+ * Test that setting the datastore readers twice is an error.
+ */
+TEST(datastore_readers_duplicate)
+{
+    YY_BUFFER_STATE state;
+    yyscan_t scanner;
+    config_context_t context;
+    test_context user_context;
+
+    test_context_init(&user_context);
+
+    context.set_error = &set_error;
+    context.val_callback = &config_callback;
+    context.user_context = &user_context;
+
+    TEST_ASSERT(0 == yylex_init(&scanner));
+    TEST_ASSERT(nullptr !=
+        (state = yy_scan_string(
+            "datastore { readers 4 } datastore { readers 2 }", scanner)));
+    TEST_ASSERT(0 == yyparse(scanner, &context));
+    yy_delete_buffer(state, scanner);
+    yylex_destroy(scanner);
+
+    /* there is one error. */
+    TEST_ASSERT(1U == user_context.errors.size());
+
+    dispose((disposable_t*)&user_context);
+}
+
+/**
+ * Test that too many datastore readers is invalid.
+ */
+TEST(datastore_readers_large)
+{
+    YY_BUFFER_STATE state;
+    yyscan_t scanner;
+    config_context_t context;
+    test_context user_context;
+
+    test_context_init(&user_context);
+
+    context.set_error = &set_error;
+    context.val_callback = &config_callback;
+    context.user_context = &user_context;
+
+    TEST_ASSERT(0 == yylex_init(&scanner));
+    TEST_ASSERT(nullptr !=
+        (state = yy_scan_string("datastore { readers 9999 }", scanner)));
+    TEST_ASSERT(0 == yyparse(scanner, &context));
+    yy_delete_buffer(state, scanner);
+    yylex_destroy(scanner);
+
+    /* there is one error. */
+    TEST_ASSERT(1U == user_context.errors.size());
+
+    dispose((disposable_t*)&user_context);
+}
+
+/**
+ * Test that an empty datastore tuning block sets nothing.
+ */
+TEST(datastore_tuning_empty)
+{
+    YY_BUFFER_STATE state;
+    yyscan_t scanner;
+    config_context_t context;
+    test_context user_context;
+
+    test_context_init(&user_context);
+
+    context.set_error = &set_error;
+    context.val_callback = &config_callback;
+    context.user_context = &user_context;
+
+    TEST_ASSERT(0 == yylex_init(&scanner));
+    TEST_ASSERT(nullptr !=
+        (state = yy_scan_string(
+            "datastore { }", scanner)));
+    TEST_ASSERT(0 == yyparse(scanner, &context));
+    yy_delete_buffer(state, scanner);
+    yylex_destroy(scanner);
+
+    /* there are no errors. */
+    TEST_ASSERT(0U == user_context.errors.size());
+
+    /* verify user config. */
+    TEST_ASSERT(nullptr != user_context.config);
+    TEST_ASSERT(!user_context.config->datastore_flags_set);
+    TEST_ASSERT(!user_context.config->datastore_max_readers_set);
+
+    dispose((disposable_t*)&user_context);
+}
+
+/**
+ * Test that we can set the datastore tuning flags and reader table size.
+ */
+TEST(datastore_tuning)
+{
+    YY_BUFFER_STATE state;
+    yyscan_t scanner;
+    config_context_t context;
+    test_context user_context;
+
+    test_context_init(&user_context);
+
+    context.set_error = &set_error;
+    context.val_callback = &config_callback;
+    context.user_context = &user_context;
+
+    TEST_ASSERT(0 == yylex_init(&scanner));
+    TEST_ASSERT(nullptr !=
+        (state = yy_scan_string(
+            "datastore { nometasync writemap nordahead max readers 512 }",
+            scanner)));
+    TEST_ASSERT(0 == yyparse(scanner, &context));
+    yy_delete_buffer(state, scanner);
+    yylex_destroy(scanner);
+
+    /* there are no errors. */
+    TEST_ASSERT(0U == user_context.errors.size());
+
+    /* verify user config. */
+    TEST_ASSERT(nullptr != user_context.config);
+    TEST_ASSERT(user_context.config->datastore_flags_set);
+    TEST_ASSERT(
+        (DATASTORE_FLAG_NOMETASYNC | DATASTORE_FLAG_WRITEMAP
+            | DATASTORE_FLAG_NORDAHEAD)
+                == user_context.config->datastore_flags);
+    TEST_ASSERT(user_context.config->datastore_max_readers_set);
+    TEST_ASSERT(512 == user_context.config->datastore_max_readers);
+    TEST_ASSERT(nullptr == user_context.config->datastore);
+
+    dispose((disposable_t*)&user_context);
+}
+
+/**
+ * Test that mapasync can be set along with writemap.
+ */
+TEST(datastore_tuning_mapasync)
+{
+    YY_BUFFER_STATE state;
+    yyscan_t scanner;
+    config_context_t context;
+    test_context user_context;
+
+    test_context_init(&user_context);
+
+    context.set_error = &set_error;
+    context.val_callback = &config_callback;
+    context.user_context = &user_context;
+
+    TEST_ASSERT(0 == yylex_init(&scanner));
+    TEST_ASSERT(nullptr !=
+        (state = yy_scan_string(
+            "datastore { writemap mapasync }", scanner)));
+    TEST_ASSERT(0 == yyparse(scanner, &context));
+    yy_delete_buffer(state, scanner);
+    yylex_destroy(scanner);
+
+    /* there are no errors. */
+    TEST_ASSERT(0U == user_context.errors.size());
+
+    /* verify user config. */
+    TEST_ASSERT(nullptr != user_context.config);
+    TEST_ASSERT(user_context.config->datastore_flags_set);
+    TEST_ASSERT(
+        (DATASTORE_FLAG_WRITEMAP | DATASTORE_FLAG_MAPASYNC)
+            == user_context.config->datastore_flags);
+    TEST_ASSERT(!user_context.config->datastore_max_readers_set);
+
+    dispose((disposable_t*)&user_context);
+}
+
+/**
+ * Test that mapasync without writemap is an error.
+ */
+TEST(datastore_tuning_mapasync_without_writemap)
+{
+    YY_BUFFER_STATE state;
+    yyscan_t scanner;
+    config_context_t context;
+    test_context user_context;
+
+    test_context_init(&user_context);
+
+    context.set_error = &set_error;
+    context.val_callback = &config_callback;
+    context.user_context = &user_context;
+
+    TEST_ASSERT(0 == yylex_init(&scanner));
+    TEST_ASSERT(nullptr !=
+        (state = yy_scan_string(
+            "datastore { mapasync }", scanner)));
+    TEST_ASSERT(0 == yyparse(scanner, &context));
+    yy_delete_buffer(state, scanner);
+    yylex_destroy(scanner);
+
+    /* there is one error. */
+    TEST_ASSERT(1U == user_context.errors.size());
+
+    dispose((disposable_t*)&user_context);
+}
+
+/**
+ * Test that setting a datastore flag twice is an error.
+ */
+TEST(datastore_tuning_duplicate_flag)
+{
+    YY_BUFFER_STATE state;
+    yyscan_t scanner;
+    config_context_t context;
+    test_context user_context;
+
+    test_context_init(&user_context);
+
+    context.set_error = &set_error;
+    context.val_callback = &config_callback;
+    context.user_context = &user_context;
+
+    TEST_ASSERT(0 == yylex_init(&scanner));
+    TEST_ASSERT(nullptr !=
+        (state = yy_scan_string(
+            "datastore { nometasync } datastore { nometasync }", scanner)));
+    TEST_ASSERT(0 == yyparse(scanner, &context));
+    yy_delete_buffer(state, scanner);
+    yylex_destroy(scanner);
+
+    /* there is one error. */
+    TEST_ASSERT(1U == user_context.errors.size());
+
+    dispose((disposable_t*)&user_context);
+}
+
+/**
+ * Test that setting the max readers twice is an error.
+ */
+TEST(datastore_tuning_duplicate_max_readers)
+{
+    YY_BUFFER_STATE state;
+    yyscan_t scanner;
+    config_context_t context;
+    test_context user_context;
+
+    test_context_init(&user_context);
+
+    context.set_error = &set_error;
+    context.val_callback = &config_callback;
+    context.user_context = &user_context;
+
+    TEST_ASSERT(0 == yylex_init(&scanner));
+    TEST_ASSERT(nullptr !=
+        (state = yy_scan_string(
+            "datastore { max readers 512 max readers 256 }", scanner)));
+    TEST_ASSERT(0 == yyparse(scanner, &context));
+    yy_delete_buffer(state, scanner);
+    yylex_destroy(scanner);
+
+    /* there is one error. */
+    TEST_ASSERT(1U == user_context.errors.size());
+
+    dispose((disposable_t*)&user_context);
+}
+
+/**
+ * Test that a reader table size out of range is invalid.
+ */
+TEST(datastore_tuning_max_readers_range)
+{
+    YY_BUFFER_STATE state;
+    yyscan_t scanner;
+    config_context_t context;
+    test_context user_context;
+
+    test_context_init(&user_context);
+
+    context.set_error = &set_error;
+    context.val_callback = &config_callback;
+    context.user_context = &user_context;
+
+    TEST_ASSERT(0 == yylex_init(&scanner));
+    TEST_ASSERT(nullptr !=
+        (state = yy_scan_string(
+            "datastore { max readers 0 }", scanner)));
+    TEST_ASSERT(0 == yyparse(scanner, &context));
+    yy_delete_buffer(state, scanner);
+    yylex_destroy(scanner);
+
+    /* there is one error. */
+    TEST_ASSERT(1U == user_context.errors.size());
+
+    dispose((disposable_t*)&user_context);
+}
+
+/**
+ * Test that we can set the number of protocol service instances.
+ */
+TEST(protocol_instances)
+{
+    YY_BUFFER_STATE state;
+    yyscan_t scanner;
+    config_context_t context;
+    test_context user_context;
+
+    test_context_init(&user_context);
+
+    context.set_error = &set_error;
+    context.val_callback = &config_callback;
+    context.user_context = &user_context;
+
+    TEST_ASSERT(0 == yylex_init(&scanner));
+    TEST_ASSERT(nullptr !=
+        (state = yy_scan_string("protocol instances 4", scanner)));
+    TEST_ASSERT(0 == yyparse(scanner, &context));
+    yy_delete_buffer(state, scanner);
+    yylex_destroy(scanner);
+
+    /* there are no errors. */
+    TEST_ASSERT(0U == user_context.errors.size());
+
+    /* verify user config. */
+    TEST_ASSERT(nullptr != user_context.config);
+    TEST_ASSERT(user_context.config->protocol_instances_set);
+    TEST_ASSERT(4 == user_context.config->protocol_instances);
+
+    dispose((disposable_t*)&user_context);
+}
+
+/**
+ * Test that setting the protocol instances twice is an error.
+ */
+TEST(protocol_instances_duplicate)
+{
+    YY_BUFFER_STATE state;
+    yyscan_t scanner;
+    config_context_t context;
+    test_context user_context;
+
+    test_context_init(&user_context);
+
+    context.set_error = &set_error;
+    context.val_callback = &config_callback;
+    context.user_context = &user_context;
+
+    TEST_ASSERT(0 == yylex_init(&scanner));
+    TEST_ASSERT(nullptr !=
+        (state = yy_scan_string("protocol instances 4 protocol instances 2", scanner)));
+    TEST_ASSERT(0 == yyparse(scanner, &context));
+    yy_delete_buffer(state, scanner);
+    yylex_destroy(scanner);
+
+    /* there is one error. */
+    TEST_ASSERT(1U == user_context.errors.size());
+
+    dispose((disposable_t*)&user_context);
+}
+
+/**
+ * Test that zero protocol instances is invalid.
+ */
+TEST(protocol_instances_zero)
+{
+    YY_BUFFER_STATE state;
+    yyscan_t scanner;
+    config_context_t context;
+    test_context user_context;
+
+    test_context_init(&user_context);
+
+    context.set_error = &set_error;
+    context.val_callback = &config_callback;
+    context.user_context = &user_context;
+
+    TEST_ASSERT(0 == yylex_init(&scanner));
+    TEST_ASSERT(nullptr !=
+        (state = yy_scan_string("protocol instances 0", scanner)));
+    TEST_ASSERT(0 == yyparse(scanner, &context));
+    yy_delete_buffer(state, scanner);
+    yylex_destroy(scanner);
+
+    /* there is one error. */
+    TEST_ASSERT(1U == user_context.errors.size());
+
+    dispose((disposable_t*)&user_context);
+}
@@ -109,6 +109,11 @@ TEST(empty_config)
     TEST_ASSERT(!user_context.config->database_max_size_set);
     TEST_ASSERT(!user_context.config->block_max_milliseconds_set);
     TEST_ASSERT(!user_context.config->block_max_transactions_set);
+    TEST_ASSERT(!user_context.config->datastore_readers_set);
+    TEST_ASSERT(!user_context.config->datastore_flags_set);
+    TEST_ASSERT(!user_context.config->datastore_max_readers_set);
+    TEST_ASSERT(!user_context.config->protocol_instances_set);
+    TEST_ASSERT(!user_context.config->attestation_max_milliseconds_set);
     TEST_ASSERT(nullptr == user_context.config->secret);
     TEST_ASSERT(nullptr == user_context.config->rootblock);
     TEST_ASSERT(nullptr == user_context.config->datastore);
@@ -130,6 +135,16 @@ TEST(empty_config)
     TEST_ASSERT(5000 == user_context.config->block_max_milliseconds);
     TEST_ASSERT(user_context.config->block_max_transactions_set);
     TEST_ASSERT(500 == user_context.config->block_max_transactions);
+    TEST_ASSERT(user_context.config->datastore_readers_set);
+    TEST_ASSERT(0 == user_context.config->datastore_readers);
+    TEST_ASSERT(user_context.config->datastore_flags_set);
+    TEST_ASSERT(0 == user_context.config->datastore_flags);
+    TEST_ASSERT(user_context.config->datastore_max_readers_set);
+    TEST_ASSERT(0 == user_context.config->datastore_max_readers);
+    TEST_ASSERT(user_context.config->protocol_instances_set);
+    TEST_ASSERT(1 == user_context.config->protocol_instances);
+    TEST_ASSERT(user_context.config->attestation_max_milliseconds_set);
+    TEST_ASSERT(5000 == user_context.config->attestation_max_milliseconds);
     TEST_ASSERT(!strcmp("root/secret.cert", user_context.config->secret));
     TEST_ASSERT(!strcmp("root/root.cert", user_context.config->rootblock));
     TEST_ASSERT(!strcmp("data", user_context.config->datastore));
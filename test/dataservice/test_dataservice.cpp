@@ -6,6 +6,7 @@
  * \copyright 2018-2023 Velo-Payments, Inc.  All rights reserved.
  */
 
+#include <agentd/config.h>
 #include <agentd/dataservice/api.h>
 #include <agentd/status_codes.h>
 #include <minunit/minunit.h>
@@ -51,7 +52,7 @@ BEGIN_TEST_F(root_context_init)
     TEST_ASSERT(
         0
             == dataservice_root_context_init(
-                    &ctx, DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    &ctx, DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
 
     /* there should be a disposer set. */
     TEST_ASSERT(nullptr != ctx.hdr.dispose);
@@ -104,6 +105,40 @@ BEGIN_TEST_F(root_context_init)
     dispose((disposable_t*)&ctx);
 END_TEST_F()
 
+/**
+ * Test that the data service root context can be initialized with datastore
+ * tuning flags and a reader table size.
+ */
+BEGIN_TEST_F(root_context_init_tuned)
+    dataservice_root_context_t ctx;
+    string DB_PATH;
+
+    /* create the directory for this test. */
+    TEST_ASSERT(0 == fixture.createDirectoryName(__COUNTER__, DB_PATH));
+
+    /* precondition: ctx is invalid. */
+    memset(&ctx, 0xFF, sizeof(ctx));
+    /* precondition: disposer is NULL. */
+    ctx.hdr.dispose = nullptr;
+
+    /* explicitly grant the capability to create this root context. */
+    BITCAP_SET_TRUE(ctx.apicaps, DATASERVICE_API_CAP_LL_ROOT_CONTEXT_CREATE);
+
+    /* initialize the root context given a test data directory. */
+    TEST_ASSERT(
+        0
+            == dataservice_root_context_init(
+                    &ctx, DEFAULT_DATABASE_SIZE,
+                    DATASTORE_FLAG_NOMETASYNC | DATASTORE_FLAG_NORDAHEAD, 256U,
+                    DB_PATH.c_str()));
+
+    /* there should be a disposer set. */
+    TEST_ASSERT(nullptr != ctx.hdr.dispose);
+
+    /* dispose of the context. */
+    dispose((disposable_t*)&ctx);
+END_TEST_F()
+
 /**
  * Test that without the root create capability, we cannot create a root
  * context.
@@ -127,7 +162,7 @@ BEGIN_TEST_F(root_context_init_no_permission)
     TEST_ASSERT(
         0
             != dataservice_root_context_init(
-                    &ctx, DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    &ctx, DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
 END_TEST_F()
 
 /**
@@ -157,7 +192,7 @@ BEGIN_TEST_F(root_context_reduce_capabilities)
     TEST_ASSERT(
         0
             == dataservice_root_context_init(
-                    &ctx, DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    &ctx, DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
 
     /* We can't create a root context again. */
     TEST_EXPECT(!BITCAP_ISSET(ctx.apicaps,
@@ -342,7 +377,7 @@ BEGIN_TEST_F(child_context_create)
     TEST_ASSERT(
         0
             == dataservice_root_context_init(
-                    &ctx, DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    &ctx, DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
 
     /* there should be a disposer set. */
     TEST_ASSERT(nullptr != ctx.hdr.dispose);
@@ -422,7 +457,7 @@ BEGIN_TEST_F(child_context_create_denied)
     TEST_ASSERT(
         0
             == dataservice_root_context_init(
-                    &ctx, DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    &ctx, DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
 
     /* there should be a disposer set. */
     TEST_ASSERT(nullptr != ctx.hdr.dispose);
@@ -481,7 +516,7 @@ BEGIN_TEST_F(child_context_close)
     TEST_ASSERT(
         0
             == dataservice_root_context_init(
-                    &ctx, DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    &ctx, DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
 
     /* there should be a disposer set. */
     TEST_ASSERT(nullptr != ctx.hdr.dispose);
@@ -539,7 +574,7 @@ BEGIN_TEST_F(child_context_close_denied)
     TEST_ASSERT(
         0
             == dataservice_root_context_init(
-                    &ctx, DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    &ctx, DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
 
     /* there should be a disposer set. */
     TEST_ASSERT(nullptr != ctx.hdr.dispose);
@@ -606,7 +641,7 @@ BEGIN_TEST_F(global_settings_get)
     TEST_ASSERT(
         0
             == dataservice_root_context_init(
-                    &ctx, DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    &ctx, DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
 
     /* there should be a disposer set. */
     TEST_ASSERT(nullptr != ctx.hdr.dispose);
@@ -691,7 +726,7 @@ BEGIN_TEST_F(global_settings_get_denied)
     TEST_ASSERT(
         0
             == dataservice_root_context_init(
-                    &ctx, DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    &ctx, DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
 
     /* there should be a disposer set. */
     TEST_ASSERT(nullptr != ctx.hdr.dispose);
@@ -769,7 +804,7 @@ BEGIN_TEST_F(global_settings_get_would_truncate)
     TEST_ASSERT(
         0
             == dataservice_root_context_init(
-                    &ctx, DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    &ctx, DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
 
     /* there should be a disposer set. */
     TEST_ASSERT(nullptr != ctx.hdr.dispose);
@@ -846,7 +881,7 @@ BEGIN_TEST_F(global_settings_get_not_found)
     TEST_ASSERT(
         0
             == dataservice_root_context_init(
-                    &ctx, DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    &ctx, DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
 
     /* there should be a disposer set. */
     TEST_ASSERT(nullptr != ctx.hdr.dispose);
@@ -910,7 +945,7 @@ BEGIN_TEST_F(global_settings_set_get)
     TEST_ASSERT(
         0
             == dataservice_root_context_init(
-                    &ctx, DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    &ctx, DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
 
     /* there should be a disposer set. */
     TEST_ASSERT(nullptr != ctx.hdr.dispose);
@@ -987,7 +1022,7 @@ BEGIN_TEST_F(global_settings_set_denied)
     TEST_ASSERT(
         0
             == dataservice_root_context_init(
-                    &ctx, DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    &ctx, DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
 
     /* there should be a disposer set. */
     TEST_ASSERT(nullptr != ctx.hdr.dispose);
@@ -1043,7 +1078,7 @@ BEGIN_TEST_F(transaction_get_first_empty)
     TEST_ASSERT(
         0
             == dataservice_root_context_init(
-                    &ctx, DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    &ctx, DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
 
     /* create a reduced capabilities set for the child context. */
     BITCAP_INIT_FALSE(reducedcaps);
@@ -1102,7 +1137,7 @@ BEGIN_TEST_F(transaction_get_first_empty_with_start_end)
     TEST_ASSERT(
         0
             == dataservice_root_context_init(
-                    &ctx, DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    &ctx, DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
 
     /* create a reduced capabilities set for the child context. */
     BITCAP_INIT_FALSE(reducedcaps);
@@ -1197,7 +1232,7 @@ BEGIN_TEST_F(transaction_get_first_no_capability)
     TEST_ASSERT(
         0
             == dataservice_root_context_init(
-                    &ctx, DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    &ctx, DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
 
     /* create a reduced capabilities set for the child context. */
     BITCAP_INIT_FALSE(reducedcaps);
@@ -1257,7 +1292,7 @@ BEGIN_TEST_F(transaction_get_first_happy_path)
     TEST_ASSERT(
         0
             == dataservice_root_context_init(
-                    &ctx, DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    &ctx, DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
 
     /* create a reduced capabilities set for the child context. */
     BITCAP_INIT_FALSE(reducedcaps);
@@ -1400,7 +1435,7 @@ BEGIN_TEST_F(transaction_get_first_txn_happy_path)
     TEST_ASSERT(
         0
             == dataservice_root_context_init(
-                    &ctx, DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    &ctx, DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
 
     /* create a reduced capabilities set for the child context. */
     BITCAP_INIT_FALSE(reducedcaps);
@@ -1552,7 +1587,7 @@ BEGIN_TEST_F(transaction_get_first_with_node_happy_path)
     TEST_ASSERT(
         0
             == dataservice_root_context_init(
-                    &ctx, DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    &ctx, DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
 
     /* create a reduced capabilities set for the child context. */
     BITCAP_INIT_FALSE(reducedcaps);
@@ -1733,7 +1768,7 @@ BEGIN_TEST_F(transaction_submit_get_first_with_node_happy_path)
     TEST_ASSERT(
         0
             == dataservice_root_context_init(
-                    &ctx, DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    &ctx, DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
 
     /* create a reduced capabilities set for the child context. */
     BITCAP_INIT_FALSE(reducedcaps);
@@ -1839,7 +1874,7 @@ BEGIN_TEST_F(transaction_submit_txn_get_first_with_node_happy_path)
     TEST_ASSERT(
         0
             == dataservice_root_context_init(
-                    &ctx, DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    &ctx, DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
 
     /* create a reduced capabilities set for the child context. */
     BITCAP_INIT_FALSE(reducedcaps);
@@ -1950,7 +1985,7 @@ BEGIN_TEST_F(transaction_submit_get_with_node_happy_path)
     TEST_ASSERT(
         0
             == dataservice_root_context_init(
-                    &ctx, DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    &ctx, DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
 
     /* create a reduced capabilities set for the child context. */
     BITCAP_INIT_FALSE(reducedcaps);
@@ -2056,7 +2091,7 @@ BEGIN_TEST_F(transaction_submit_txn_get_with_node_happy_path)
     TEST_ASSERT(
         0
             == dataservice_root_context_init(
-                    &ctx, DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    &ctx, DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
 
     /* create a reduced capabilities set for the child context. */
     BITCAP_INIT_FALSE(reducedcaps);
@@ -2172,7 +2207,7 @@ BEGIN_TEST_F(transaction_drop_00_ff)
     TEST_ASSERT(
         0
             == dataservice_root_context_init(
-                    &ctx, DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    &ctx, DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
 
     /* create a reduced capabilities set for the child context. */
     BITCAP_INIT_FALSE(reducedcaps);
@@ -2267,7 +2302,7 @@ BEGIN_TEST_F(transaction_drop)
     TEST_ASSERT(
         0
             == dataservice_root_context_init(
-                    &ctx, DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    &ctx, DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
 
     /* create a reduced capabilities set for the child context. */
     BITCAP_INIT_FALSE(reducedcaps);
@@ -2399,7 +2434,7 @@ BEGIN_TEST_F(transaction_drop_ordering)
     TEST_ASSERT(
         0
             == dataservice_root_context_init(
-                    &ctx, DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    &ctx, DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
 
     /* create a reduced capabilities set for the child context. */
     BITCAP_INIT_FALSE(reducedcaps);
@@ -2666,7 +2701,7 @@ BEGIN_TEST_F(transaction_drop_first_ordering)
     TEST_ASSERT(
         0
             == dataservice_root_context_init(
-                    &ctx, DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    &ctx, DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
 
     /* create a reduced capabilities set for the child context. */
     BITCAP_INIT_FALSE(reducedcaps);
@@ -2913,7 +2948,7 @@ BEGIN_TEST_F(transaction_promote_00_ff)
     TEST_ASSERT(
         0
             == dataservice_root_context_init(
-                    &ctx, DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    &ctx, DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
 
     /* create a reduced capabilities set for the child context. */
     BITCAP_INIT_FALSE(reducedcaps);
@@ -3009,7 +3044,7 @@ BEGIN_TEST_F(transaction_promote)
     TEST_ASSERT(
         0
             == dataservice_root_context_init(
-                    &ctx, DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    &ctx, DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
 
     /* create a reduced capabilities set for the child context. */
     BITCAP_INIT_FALSE(reducedcaps);
@@ -3111,7 +3146,7 @@ BEGIN_TEST_F(transaction_submit_bitcap)
     TEST_ASSERT(
         0
             == dataservice_root_context_init(
-                    &ctx, DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    &ctx, DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
 
     /* create a reduced capabilities set for the child context. */
     BITCAP_INIT_FALSE(reducedcaps);
@@ -3167,7 +3202,7 @@ BEGIN_TEST_F(transaction_get_first_bitcap)
     TEST_ASSERT(
         0
             == dataservice_root_context_init(
-                    &ctx, DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    &ctx, DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
 
     /* create a reduced capabilities set for the child context. */
     BITCAP_INIT_FALSE(reducedcaps);
@@ -3223,7 +3258,7 @@ BEGIN_TEST_F(transaction_get_bitcap)
     TEST_ASSERT(
         0
             == dataservice_root_context_init(
-                    &ctx, DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    &ctx, DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
 
     /* create a reduced capabilities set for the child context. */
     BITCAP_INIT_FALSE(reducedcaps);
@@ -3277,7 +3312,7 @@ BEGIN_TEST_F(transaction_drop_bitcap)
     TEST_ASSERT(
         0
             == dataservice_root_context_init(
-                    &ctx, DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    &ctx, DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
 
     /* create a reduced capabilities set for the child context. */
     BITCAP_INIT_FALSE(reducedcaps);
@@ -3331,7 +3366,7 @@ BEGIN_TEST_F(transaction_promote_bitcap)
     TEST_ASSERT(
         0
             == dataservice_root_context_init(
-                    &ctx, DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    &ctx, DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
 
     /* create a reduced capabilities set for the child context. */
     BITCAP_INIT_FALSE(reducedcaps);
@@ -3356,43 +3391,37 @@ BEGIN_TEST_F(transaction_promote_bitcap)
 END_TEST_F()
 
 /**
- * Test that we can add a transaction to the transaction queue, create a block
- * containing this transaction, and the dataservice_block_make API call
- * automatically drops this transaction.
+ * Test that a batch update promotes and drops transactions under one commit,
+ * and reports the outcome of each entry.
  */
-BEGIN_TEST_F(transaction_make_block_simple)
+BEGIN_TEST_F(transaction_batch_update)
     uint8_t foo_key[16] = {
         0x9b, 0xfe, 0xec, 0xc9, 0x28, 0x5d, 0x44, 0xba,
         0x84, 0xdf, 0xd6, 0xfd, 0x3e, 0xe8, 0x79, 0x2f
     };
-    uint8_t foo_prev[16] = {
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    uint8_t bar_key[16] = {
+        0x01, 0x71, 0x3c, 0x2b, 0x4f, 0x8e, 0x4b, 0x1a,
+        0x9e, 0x4d, 0x63, 0x6c, 0x52, 0xa1, 0x0a, 0x77
+    };
+    uint8_t baz_key[16] = {
+        0x5c, 0x2e, 0x61, 0x0f, 0x3a, 0x94, 0x4d, 0x2c,
+        0x8b, 0x1e, 0x07, 0xd4, 0x9a, 0x3b, 0x6e, 0x12
     };
     uint8_t foo_artifact[16] = {
-        0xef, 0x44, 0xe7, 0xb4, 0xbf, 0x39, 0x45, 0xe4,
-        0xb3, 0x4b, 0x6e, 0x82, 0xee, 0x41, 0x76, 0x21
+        0xcf, 0xa1, 0x51, 0xc4, 0x7c, 0x0f, 0x4d, 0xbd,
+        0xa0, 0xd6, 0x22, 0x51, 0x34, 0xd1, 0x61, 0xdc
     };
-    uint8_t foo_block_id[16] = {
-        0x96, 0x1e, 0xdd, 0x16, 0xbd, 0xa6, 0x4b, 0x9d,
-        0x93, 0xac, 0x40, 0xd4, 0x74, 0x85, 0x0d, 0xe5
+    uint8_t foo_data[5] = {
+        0Xfa, 0X12, 0X22, 0X13, 0X99
     };
-    uint8_t* foo_cert = nullptr;
-    size_t foo_cert_length = 0;
-    uint8_t* foo_block_cert = nullptr;
-    size_t foo_block_cert_length = 0;
-    string DB_PATH;
+    uint8_t* txn_bytes = NULL;
+    size_t txn_size = 0;
+    data_transaction_node_t node;
+    data_transaction_batch_update_entry_t entries[3];
+    uint32_t statuses[3];
     dataservice_root_context_t ctx;
     dataservice_child_context_t child;
-    data_transaction_node_t node;
-    data_artifact_record_t foo_artifact_record;
-    data_block_node_t block_node;
-    uint8_t* txn_bytes;
-    size_t txn_size;
-    uint8_t* block_txn_bytes;
-    size_t block_txn_size;
-    uint8_t block_id_for_height_1[16];
-    uint8_t latest_block_id[16];
+    string DB_PATH;
 
     /* create the directory for this test. */
     TEST_ASSERT(0 == fixture.createDirectoryName(__COUNTER__, DB_PATH));
@@ -3411,26 +3440,19 @@ BEGIN_TEST_F(transaction_make_block_simple)
     TEST_ASSERT(
         0
             == dataservice_root_context_init(
-                    &ctx, DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    &ctx, DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
 
     /* create a reduced capabilities set for the child context. */
     BITCAP_INIT_FALSE(reducedcaps);
-    BITCAP_SET_TRUE(reducedcaps,
-        DATASERVICE_API_CAP_APP_BLOCK_WRITE);
-    BITCAP_SET_TRUE(reducedcaps,
-        DATASERVICE_API_CAP_APP_BLOCK_READ);
+    /* only allow transaction submit, read, promote, and drop. */
     BITCAP_SET_TRUE(reducedcaps,
         DATASERVICE_API_CAP_APP_PQ_TRANSACTION_READ);
     BITCAP_SET_TRUE(reducedcaps,
         DATASERVICE_API_CAP_APP_PQ_TRANSACTION_SUBMIT);
     BITCAP_SET_TRUE(reducedcaps,
-        DATASERVICE_API_CAP_APP_TRANSACTION_READ);
-    BITCAP_SET_TRUE(reducedcaps,
-        DATASERVICE_API_CAP_APP_ARTIFACT_READ);
-    BITCAP_SET_TRUE(reducedcaps,
-        DATASERVICE_API_CAP_APP_BLOCK_ID_LATEST_READ);
+        DATASERVICE_API_CAP_APP_PQ_TRANSACTION_PROMOTE);
     BITCAP_SET_TRUE(reducedcaps,
-        DATASERVICE_API_CAP_APP_BLOCK_ID_BY_HEIGHT_READ);
+        DATASERVICE_API_CAP_APP_PQ_TRANSACTION_DROP);
 
     /* explicitly grant the capability to create child contexts in the child
      * context. */
@@ -3441,139 +3463,1183 @@ BEGIN_TEST_F(transaction_make_block_simple)
     TEST_ASSERT(
         0 == dataservice_child_context_create(&ctx, &child, reducedcaps));
 
-    /* verify that our block does not exist. */
+    /* submit foo and bar transactions. */
     TEST_ASSERT(
-        AGENTD_ERROR_DATASERVICE_NOT_FOUND
-            == dataservice_block_get(
-                    &child, nullptr, foo_block_id, &block_node,
-                    &block_txn_bytes, &block_txn_size));
-
-    /* verify that a block ID does not exist for block height 1. */
+        0
+            == dataservice_transaction_submit(
+                    &child, nullptr, foo_key, foo_artifact, foo_data,
+                    sizeof(foo_data)));
     TEST_ASSERT(
-        AGENTD_ERROR_DATASERVICE_NOT_FOUND
-            == dataservice_block_id_by_height_get(
-                    &child, nullptr, 1, block_id_for_height_1));
+        0
+            == dataservice_transaction_submit(
+                    &child, nullptr, bar_key, foo_artifact, foo_data,
+                    sizeof(foo_data)));
 
-    /* verify that the latest block id get call returns the root UUID. */
+    /* promote foo, drop bar, and promote baz, which was never submitted. */
+    memcpy(entries[0].txn_id, foo_key, 16);
+    entries[0].action = DATASERVICE_TRANSACTION_BATCH_ACTION_PROMOTE;
+    memcpy(entries[1].txn_id, bar_key, 16);
+    entries[1].action = DATASERVICE_TRANSACTION_BATCH_ACTION_DROP;
+    memcpy(entries[2].txn_id, baz_key, 16);
+    entries[2].action = DATASERVICE_TRANSACTION_BATCH_ACTION_PROMOTE;
+
+    /* the batch update succeeds. */
     TEST_ASSERT(
         AGENTD_STATUS_SUCCESS
-            == dataservice_latest_block_id_get(
-                    &child, nullptr, latest_block_id));
-    TEST_ASSERT(
-        0
-            == memcmp(
-                    latest_block_id, vccert_certificate_type_uuid_root_block,
-                    16));
+            == dataservice_transaction_batch_update(
+                    &child, entries, 3, statuses));
 
-    /* verify that our artifact does not exist. */
-    /* getting the artifact record by artifact id should return not found. */
+    /* foo and bar succeeded, and baz was not found. */
+    TEST_EXPECT(AGENTD_STATUS_SUCCESS == statuses[0]);
+    TEST_EXPECT(AGENTD_STATUS_SUCCESS == statuses[1]);
+    TEST_EXPECT(AGENTD_ERROR_DATASERVICE_NOT_FOUND == (int)statuses[2]);
+
+    /* foo is attested. */
     TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == dataservice_transaction_get(
+                    &child, nullptr, foo_key, &node, &txn_bytes, &txn_size));
+    TEST_EXPECT(
+        DATASERVICE_TRANSACTION_NODE_STATE_ATTESTED
+            == ntohl(node.net_txn_state));
+
+    /* bar was dropped. */
+    TEST_EXPECT(
         AGENTD_ERROR_DATASERVICE_NOT_FOUND
-            == dataservice_artifact_get(
-                    &child, nullptr, foo_artifact, &foo_artifact_record));
+            == dataservice_transaction_get(
+                    &child, nullptr, bar_key, &node, &txn_bytes, &txn_size));
 
-    /* create foo transaction. */
+    /* dispose of the context. */
+    dispose((disposable_t*)&ctx);
+END_TEST_F()
+
+/**
+ * Test that dataservice_transaction_batch_update works when the database is
+ * opened with a writable memory map, which does not support nested
+ * transactions.
+ */
+BEGIN_TEST_F(transaction_batch_update_writemap)
+    uint8_t foo_key[16] = {
+        0x9b, 0xfe, 0xec, 0xc9, 0x28, 0x5d, 0x44, 0xba,
+        0x84, 0xdf, 0xd6, 0xfd, 0x3e, 0xe8, 0x79, 0x2f
+    };
+    uint8_t bar_key[16] = {
+        0x01, 0x71, 0x3c, 0x2b, 0x4f, 0x8e, 0x4b, 0x1a,
+        0x9e, 0x4d, 0x63, 0x6c, 0x52, 0xa1, 0x0a, 0x77
+    };
+    uint8_t baz_key[16] = {
+        0x5c, 0x2e, 0x61, 0x0f, 0x3a, 0x94, 0x4d, 0x2c,
+        0x8b, 0x1e, 0x07, 0xd4, 0x9a, 0x3b, 0x6e, 0x12
+    };
+    uint8_t foo_artifact[16] = {
+        0xcf, 0xa1, 0x51, 0xc4, 0x7c, 0x0f, 0x4d, 0xbd,
+        0xa0, 0xd6, 0x22, 0x51, 0x34, 0xd1, 0x61, 0xdc
+    };
+    uint8_t foo_data[5] = {
+        0Xfa, 0X12, 0X22, 0X13, 0X99
+    };
+    uint8_t* txn_bytes = NULL;
+    size_t txn_size = 0;
+    data_transaction_node_t node;
+    data_transaction_batch_update_entry_t entries[4];
+    uint32_t statuses[4];
+    dataservice_root_context_t ctx;
+    dataservice_child_context_t child;
+    string DB_PATH;
+
+    /* create the directory for this test. */
+    TEST_ASSERT(0 == fixture.createDirectoryName(__COUNTER__, DB_PATH));
+
+    BITCAP(reducedcaps, DATASERVICE_API_CAP_BITS_MAX);
+
+    /* precondition: ctx is invalid. */
+    memset(&ctx, 0xFF, sizeof(ctx));
+    /* precondition: disposer is NULL. */
+    ctx.hdr.dispose = nullptr;
+
+    /* explicitly grant the capability to create this root context. */
+    BITCAP_SET_TRUE(ctx.apicaps, DATASERVICE_API_CAP_LL_ROOT_CONTEXT_CREATE);
+
+    /* initialize the root context with a writable memory map. */
     TEST_ASSERT(
         0
-            == fixture.create_dummy_transaction(
-                    foo_key, foo_prev, foo_artifact, &foo_cert,
-                    &foo_cert_length));
+            == dataservice_root_context_init(
+                    &ctx, DEFAULT_DATABASE_SIZE, DATASTORE_FLAG_WRITEMAP, 0U,
+                    DB_PATH.c_str()));
 
-    /* submit foo transaction. */
+    /* create a reduced capabilities set for the child context. */
+    BITCAP_INIT_FALSE(reducedcaps);
+    /* only allow transaction submit, read, promote, and drop. */
+    BITCAP_SET_TRUE(reducedcaps,
+        DATASERVICE_API_CAP_APP_PQ_TRANSACTION_READ);
+    BITCAP_SET_TRUE(reducedcaps,
+        DATASERVICE_API_CAP_APP_PQ_TRANSACTION_SUBMIT);
+    BITCAP_SET_TRUE(reducedcaps,
+        DATASERVICE_API_CAP_APP_PQ_TRANSACTION_PROMOTE);
+    BITCAP_SET_TRUE(reducedcaps,
+        DATASERVICE_API_CAP_APP_PQ_TRANSACTION_DROP);
+
+    /* explicitly grant the capability to create child contexts in the child
+     * context. */
+    BITCAP_SET_TRUE(child.childcaps,
+        DATASERVICE_API_CAP_LL_CHILD_CONTEXT_CREATE);
+
+    /* create a child context using this reduced capabilities set. */
     TEST_ASSERT(
-        0
-            == dataservice_transaction_submit(
-                    &child, nullptr, foo_key, foo_artifact, foo_cert,
-                    foo_cert_length));
+        0 == dataservice_child_context_create(&ctx, &child, reducedcaps));
 
-    /* getting the transaction by id should return success. */
+    /* submit foo and bar transactions. */
     TEST_ASSERT(
         0
-            == dataservice_transaction_get(
-                    &child, nullptr, foo_key, &node, &txn_bytes, &txn_size));
-    free(txn_bytes);
-
-    /* create foo block. */
+            == dataservice_transaction_submit(
+                    &child, nullptr, foo_key, foo_artifact, foo_data,
+                    sizeof(foo_data)));
     TEST_ASSERT(
         0
-            == create_dummy_block(
-                    &fixture.builder_opts, foo_block_id,
-                    vccert_certificate_type_uuid_root_block, 1, &foo_block_cert,
-                    &foo_block_cert_length, foo_cert, foo_cert_length,
-                    nullptr));
+            == dataservice_transaction_submit(
+                    &child, nullptr, bar_key, foo_artifact, foo_data,
+                    sizeof(foo_data)));
 
-    /* getting the block transaction by id should return not found. */
-    TEST_ASSERT(
-        AGENTD_ERROR_DATASERVICE_NOT_FOUND
-            == dataservice_block_transaction_get(
-                    &child, nullptr, foo_key, &node, &txn_bytes, &txn_size));
+    /* promote foo, drop bar, promote baz, which was never submitted, and drop
+     * bar a second time. */
+    memcpy(entries[0].txn_id, foo_key, 16);
+    entries[0].action = DATASERVICE_TRANSACTION_BATCH_ACTION_PROMOTE;
+    memcpy(entries[1].txn_id, bar_key, 16);
+    entries[1].action = DATASERVICE_TRANSACTION_BATCH_ACTION_DROP;
+    memcpy(entries[2].txn_id, baz_key, 16);
+    entries[2].action = DATASERVICE_TRANSACTION_BATCH_ACTION_PROMOTE;
+    memcpy(entries[3].txn_id, bar_key, 16);
+    entries[3].action = DATASERVICE_TRANSACTION_BATCH_ACTION_DROP;
 
-    /* make block. */
+    /* the batch update succeeds. */
     TEST_ASSERT(
-        0
-            == dataservice_block_make(
-                    &child, nullptr, foo_block_id,
-                    foo_block_cert, foo_block_cert_length));
+        AGENTD_STATUS_SUCCESS
+            == dataservice_transaction_batch_update(
+                    &child, entries, 4, statuses));
 
-    /* getting the transaction by id should return not found. */
-    TEST_ASSERT(
-        AGENTD_ERROR_DATASERVICE_NOT_FOUND
-            == dataservice_transaction_get(
-                    &child, nullptr, foo_key, &node, &txn_bytes, &txn_size));
+    /* foo and bar succeeded, and baz and the second bar were not found. */
+    TEST_EXPECT(AGENTD_STATUS_SUCCESS == statuses[0]);
+    TEST_EXPECT(AGENTD_STATUS_SUCCESS == statuses[1]);
+    TEST_EXPECT(AGENTD_ERROR_DATASERVICE_NOT_FOUND == (int)statuses[2]);
+    TEST_EXPECT(AGENTD_ERROR_DATASERVICE_NOT_FOUND == (int)statuses[3]);
 
-    /* getting the block transaction by id should return success. */
+    /* foo is attested. */
     TEST_ASSERT(
-        0
-            == dataservice_block_transaction_get(
+        AGENTD_STATUS_SUCCESS
+            == dataservice_transaction_get(
                     &child, nullptr, foo_key, &node, &txn_bytes, &txn_size));
+    TEST_EXPECT(
+        DATASERVICE_TRANSACTION_NODE_STATE_ATTESTED
+            == ntohl(node.net_txn_state));
     free(txn_bytes);
 
-    /* getting the block record by block id should return success. */
-    TEST_ASSERT(
-        0
-            == dataservice_block_get(
-                    &child, nullptr, foo_block_id, &block_node,
-                    &block_txn_bytes, &block_txn_size));
-    /* the key should match our block id. */
-    TEST_ASSERT(0 == memcmp(block_node.key, foo_block_id, 16));
-    TEST_ASSERT(0 == memcmp(block_node.first_transaction_id, foo_key, 16));
-    TEST_ASSERT(1U == ntohll(block_node.net_block_height));
+    /* bar was dropped. */
+    TEST_EXPECT(
+        AGENTD_ERROR_DATASERVICE_NOT_FOUND
+            == dataservice_transaction_get(
+                    &child, nullptr, bar_key, &node, &txn_bytes, &txn_size));
 
-    /* verify that a block ID exists for block height 1. */
-    TEST_ASSERT(
+    /* the batch transaction was released, so later writes still work. */
+    TEST_EXPECT(
         0
-            == dataservice_block_id_by_height_get(
-                    &child, nullptr, 1, block_id_for_height_1));
-    /* this block ID matches our block ID. */
-    TEST_EXPECT(0 == memcmp(foo_block_id, block_id_for_height_1, 16));
+            == dataservice_transaction_submit(
+                    &child, nullptr, baz_key, foo_artifact, foo_data,
+                    sizeof(foo_data)));
 
-    /* verify that the latest block id matches our block id. */
-    TEST_ASSERT(
-        0
-            == dataservice_latest_block_id_get(
-                    &child, nullptr, latest_block_id));
-    /* this block ID matches our block ID. */
-    TEST_EXPECT(0 == memcmp(foo_block_id, latest_block_id, 16));
+    /* dispose of the context. */
+    dispose((disposable_t*)&ctx);
+END_TEST_F()
 
-    /* getting the artifact record by artifact id should return success. */
-    TEST_ASSERT(
+/**
+ * Test that a submit and a queue read given a parent transaction run in that
+ * transaction when the database is opened with a writable memory map, which
+ * does not support nested transactions.
+ */
+BEGIN_TEST_F(transaction_submit_parent_writemap)
+    uint8_t foo_key[16] = {
+        0x9b, 0xfe, 0xec, 0xc9, 0x28, 0x5d, 0x44, 0xba,
+        0x84, 0xdf, 0xd6, 0xfd, 0x3e, 0xe8, 0x79, 0x2f
+    };
+    uint8_t bar_key[16] = {
+        0x01, 0x71, 0x3c, 0x2b, 0x4f, 0x8e, 0x4b, 0x1a,
+        0x9e, 0x4d, 0x63, 0x6c, 0x52, 0xa1, 0x0a, 0x77
+    };
+    uint8_t foo_artifact[16] = {
+        0xcf, 0xa1, 0x51, 0xc4, 0x7c, 0x0f, 0x4d, 0xbd,
+        0xa0, 0xd6, 0x22, 0x51, 0x34, 0xd1, 0x61, 0xdc
+    };
+    uint8_t foo_data[5] = {
+        0Xfa, 0X12, 0X22, 0X13, 0X99
+    };
+    uint8_t* txn_bytes = NULL;
+    size_t txn_size = 0;
+    data_transaction_node_t node;
+    dataservice_transaction_context_t txn_ctx;
+    dataservice_root_context_t ctx;
+    dataservice_child_context_t child;
+    string DB_PATH;
+
+    /* create the directory for this test. */
+    TEST_ASSERT(0 == fixture.createDirectoryName(__COUNTER__, DB_PATH));
+
+    BITCAP(reducedcaps, DATASERVICE_API_CAP_BITS_MAX);
+
+    /* precondition: ctx is invalid. */
+    memset(&ctx, 0xFF, sizeof(ctx));
+    /* precondition: disposer is NULL. */
+    ctx.hdr.dispose = nullptr;
+
+    /* explicitly grant the capability to create this root context. */
+    BITCAP_SET_TRUE(ctx.apicaps, DATASERVICE_API_CAP_LL_ROOT_CONTEXT_CREATE);
+
+    /* initialize the root context with a writable memory map. */
+    TEST_ASSERT(
+        0
+            == dataservice_root_context_init(
+                    &ctx, DEFAULT_DATABASE_SIZE, DATASTORE_FLAG_WRITEMAP, 0U,
+                    DB_PATH.c_str()));
+
+    /* create a reduced capabilities set for the child context. */
+    BITCAP_INIT_FALSE(reducedcaps);
+    /* only allow transaction submit and first read. */
+    BITCAP_SET_TRUE(reducedcaps,
+        DATASERVICE_API_CAP_APP_PQ_TRANSACTION_SUBMIT);
+    BITCAP_SET_TRUE(reducedcaps,
+        DATASERVICE_API_CAP_APP_PQ_TRANSACTION_FIRST_READ);
+
+    /* explicitly grant the capability to create child contexts in the child
+     * context. */
+    BITCAP_SET_TRUE(child.childcaps,
+        DATASERVICE_API_CAP_LL_CHILD_CONTEXT_CREATE);
+
+    /* create a child context using this reduced capabilities set. */
+    TEST_ASSERT(
+        0 == dataservice_child_context_create(&ctx, &child, reducedcaps));
+
+    /* submit foo under a parent transaction, and abort the parent. */
+    TEST_ASSERT(
+        0 == dataservice_data_txn_begin(&child, &txn_ctx, nullptr, false));
+    TEST_ASSERT(
+        0
+            == dataservice_transaction_submit(
+                    &child, &txn_ctx, foo_key, foo_artifact, foo_data,
+                    sizeof(foo_data)));
+    dataservice_data_txn_abort(&txn_ctx);
+
+    /* the aborted submit is not in the queue. */
+    TEST_EXPECT(
+        AGENTD_ERROR_DATASERVICE_NOT_FOUND
+            == dataservice_transaction_get_first(
+                    &child, nullptr, &node, &txn_bytes, &txn_size));
+
+    /* submit foo and bar under a parent transaction. */
+    TEST_ASSERT(
+        0 == dataservice_data_txn_begin(&child, &txn_ctx, nullptr, false));
+    TEST_ASSERT(
+        0
+            == dataservice_transaction_submit(
+                    &child, &txn_ctx, foo_key, foo_artifact, foo_data,
+                    sizeof(foo_data)));
+    TEST_ASSERT(
+        0
+            == dataservice_transaction_submit(
+                    &child, &txn_ctx, bar_key, foo_artifact, foo_data,
+                    sizeof(foo_data)));
+
+    /* the parent transaction sees foo at the head of the queue. */
+    TEST_ASSERT(
+        0
+            == dataservice_transaction_get_first(
+                    &child, &txn_ctx, &node, &txn_bytes, &txn_size));
+    TEST_EXPECT(0 == memcmp(node.key, foo_key, sizeof(foo_key)));
+    TEST_EXPECT(sizeof(foo_data) == txn_size);
+
+    /* commit the parent transaction. */
+    dataservice_data_txn_commit(&txn_ctx);
+
+    /* both submits were committed with the parent. */
+    TEST_ASSERT(
+        0
+            == dataservice_transaction_get_first(
+                    &child, nullptr, &node, &txn_bytes, &txn_size));
+    TEST_EXPECT(0 == memcmp(node.key, foo_key, sizeof(foo_key)));
+    TEST_EXPECT(0 == memcmp(node.next, bar_key, sizeof(bar_key)));
+    free(txn_bytes);
+
+    /* dispose of the context. */
+    dispose((disposable_t*)&ctx);
+END_TEST_F()
+
+/**
+ * Test that dataservice_transaction_batch_update requires the capability for
+ * every action in the batch.
+ */
+BEGIN_TEST_F(transaction_batch_update_bitcap)
+    uint8_t foo_key[16] = {
+        0x9b, 0xfe, 0xec, 0xc9, 0x28, 0x5d, 0x44, 0xba,
+        0x84, 0xdf, 0xd6, 0xfd, 0x3e, 0xe8, 0x79, 0x2f
+    };
+    data_transaction_batch_update_entry_t entries[2];
+    uint32_t statuses[2];
+    dataservice_root_context_t ctx;
+    dataservice_child_context_t child;
+    string DB_PATH;
+
+    /* create the directory for this test. */
+    TEST_ASSERT(0 == fixture.createDirectoryName(__COUNTER__, DB_PATH));
+
+    BITCAP(reducedcaps, DATASERVICE_API_CAP_BITS_MAX);
+
+    /* precondition: ctx is invalid. */
+    memset(&ctx, 0xFF, sizeof(ctx));
+    /* precondition: disposer is NULL. */
+    ctx.hdr.dispose = nullptr;
+
+    /* explicitly grant the capability to create this root context. */
+    BITCAP_SET_TRUE(ctx.apicaps, DATASERVICE_API_CAP_LL_ROOT_CONTEXT_CREATE);
+
+    /* initialize the root context given a test data directory. */
+    TEST_ASSERT(
+        0
+            == dataservice_root_context_init(
+                    &ctx, DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
+
+    /* create a reduced capabilities set that only allows promote. */
+    BITCAP_INIT_FALSE(reducedcaps);
+    BITCAP_SET_TRUE(reducedcaps,
+        DATASERVICE_API_CAP_APP_PQ_TRANSACTION_PROMOTE);
+
+    /* explicitly grant the capability to create child contexts in the child
+     * context. */
+    BITCAP_SET_TRUE(child.childcaps,
+        DATASERVICE_API_CAP_LL_CHILD_CONTEXT_CREATE);
+
+    /* create a child context using this reduced capabilities set. */
+    TEST_ASSERT(
+        0 == dataservice_child_context_create(&ctx, &child, reducedcaps));
+
+    /* build a batch holding a promote and a drop. */
+    memcpy(entries[0].txn_id, foo_key, 16);
+    entries[0].action = DATASERVICE_TRANSACTION_BATCH_ACTION_PROMOTE;
+    memcpy(entries[1].txn_id, foo_key, 16);
+    entries[1].action = DATASERVICE_TRANSACTION_BATCH_ACTION_DROP;
+
+    /* the batch fails, because this child can't drop transactions. */
+    TEST_ASSERT(
+        AGENTD_ERROR_DATASERVICE_NOT_AUTHORIZED
+            == dataservice_transaction_batch_update(
+                    &child, entries, 2, statuses));
+
+    /* dispose of the context. */
+    dispose((disposable_t*)&ctx);
+END_TEST_F()
+
+/**
+ * Test that we can add a transaction to the transaction queue, create a block
+ * containing this transaction, and the dataservice_block_make API call
+ * automatically drops this transaction.
+ */
+BEGIN_TEST_F(transaction_make_block_simple)
+    uint8_t foo_key[16] = {
+        0x9b, 0xfe, 0xec, 0xc9, 0x28, 0x5d, 0x44, 0xba,
+        0x84, 0xdf, 0xd6, 0xfd, 0x3e, 0xe8, 0x79, 0x2f
+    };
+    uint8_t foo_prev[16] = {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    };
+    uint8_t foo_artifact[16] = {
+        0xef, 0x44, 0xe7, 0xb4, 0xbf, 0x39, 0x45, 0xe4,
+        0xb3, 0x4b, 0x6e, 0x82, 0xee, 0x41, 0x76, 0x21
+    };
+    uint8_t foo_block_id[16] = {
+        0x96, 0x1e, 0xdd, 0x16, 0xbd, 0xa6, 0x4b, 0x9d,
+        0x93, 0xac, 0x40, 0xd4, 0x74, 0x85, 0x0d, 0xe5
+    };
+    uint8_t* foo_cert = nullptr;
+    size_t foo_cert_length = 0;
+    uint8_t* foo_block_cert = nullptr;
+    size_t foo_block_cert_length = 0;
+    string DB_PATH;
+    dataservice_root_context_t ctx;
+    dataservice_child_context_t child;
+    data_transaction_node_t node;
+    data_artifact_record_t foo_artifact_record;
+    data_block_node_t block_node;
+    uint8_t* txn_bytes;
+    size_t txn_size;
+    uint8_t* block_txn_bytes;
+    size_t block_txn_size;
+    uint8_t block_id_for_height_1[16];
+    uint8_t latest_block_id[16];
+
+    /* create the directory for this test. */
+    TEST_ASSERT(0 == fixture.createDirectoryName(__COUNTER__, DB_PATH));
+
+    BITCAP(reducedcaps, DATASERVICE_API_CAP_BITS_MAX);
+
+    /* precondition: ctx is invalid. */
+    memset(&ctx, 0xFF, sizeof(ctx));
+    /* precondition: disposer is NULL. */
+    ctx.hdr.dispose = nullptr;
+
+    /* explicitly grant the capability to create this root context. */
+    BITCAP_SET_TRUE(ctx.apicaps, DATASERVICE_API_CAP_LL_ROOT_CONTEXT_CREATE);
+
+    /* initialize the root context given a test data directory. */
+    TEST_ASSERT(
+        0
+            == dataservice_root_context_init(
+                    &ctx, DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
+
+    /* create a reduced capabilities set for the child context. */
+    BITCAP_INIT_FALSE(reducedcaps);
+    BITCAP_SET_TRUE(reducedcaps,
+        DATASERVICE_API_CAP_APP_BLOCK_WRITE);
+    BITCAP_SET_TRUE(reducedcaps,
+        DATASERVICE_API_CAP_APP_BLOCK_READ);
+    BITCAP_SET_TRUE(reducedcaps,
+        DATASERVICE_API_CAP_APP_PQ_TRANSACTION_READ);
+    BITCAP_SET_TRUE(reducedcaps,
+        DATASERVICE_API_CAP_APP_PQ_TRANSACTION_SUBMIT);
+    BITCAP_SET_TRUE(reducedcaps,
+        DATASERVICE_API_CAP_APP_TRANSACTION_READ);
+    BITCAP_SET_TRUE(reducedcaps,
+        DATASERVICE_API_CAP_APP_ARTIFACT_READ);
+    BITCAP_SET_TRUE(reducedcaps,
+        DATASERVICE_API_CAP_APP_BLOCK_ID_LATEST_READ);
+    BITCAP_SET_TRUE(reducedcaps,
+        DATASERVICE_API_CAP_APP_BLOCK_ID_BY_HEIGHT_READ);
+
+    /* explicitly grant the capability to create child contexts in the child
+     * context. */
+    BITCAP_SET_TRUE(child.childcaps,
+        DATASERVICE_API_CAP_LL_CHILD_CONTEXT_CREATE);
+
+    /* create a child context using this reduced capabilities set. */
+    TEST_ASSERT(
+        0 == dataservice_child_context_create(&ctx, &child, reducedcaps));
+
+    /* verify that our block does not exist. */
+    TEST_ASSERT(
+        AGENTD_ERROR_DATASERVICE_NOT_FOUND
+            == dataservice_block_get(
+                    &child, nullptr, foo_block_id, &block_node,
+                    &block_txn_bytes, &block_txn_size));
+
+    /* verify that a block ID does not exist for block height 1. */
+    TEST_ASSERT(
+        AGENTD_ERROR_DATASERVICE_NOT_FOUND
+            == dataservice_block_id_by_height_get(
+                    &child, nullptr, 1, block_id_for_height_1));
+
+    /* verify that the latest block id get call returns the root UUID. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == dataservice_latest_block_id_get(
+                    &child, nullptr, latest_block_id));
+    TEST_ASSERT(
+        0
+            == memcmp(
+                    latest_block_id, vccert_certificate_type_uuid_root_block,
+                    16));
+
+    /* verify that our artifact does not exist. */
+    /* getting the artifact record by artifact id should return not found. */
+    TEST_ASSERT(
+        AGENTD_ERROR_DATASERVICE_NOT_FOUND
+            == dataservice_artifact_get(
+                    &child, nullptr, foo_artifact, &foo_artifact_record));
+
+    /* none of our ids are in use yet. */
+    TEST_EXPECT(
+        AGENTD_ERROR_DATASERVICE_NOT_FOUND
+            == dataservice_id_exists(&child, nullptr, foo_block_id));
+    TEST_EXPECT(
+        AGENTD_ERROR_DATASERVICE_NOT_FOUND
+            == dataservice_id_exists(&child, nullptr, foo_key));
+    TEST_EXPECT(
+        AGENTD_ERROR_DATASERVICE_NOT_FOUND
+            == dataservice_id_exists(&child, nullptr, foo_artifact));
+
+    /* create foo transaction. */
+    TEST_ASSERT(
+        0
+            == fixture.create_dummy_transaction(
+                    foo_key, foo_prev, foo_artifact, &foo_cert,
+                    &foo_cert_length));
+
+    /* submit foo transaction. */
+    TEST_ASSERT(
+        0
+            == dataservice_transaction_submit(
+                    &child, nullptr, foo_key, foo_artifact, foo_cert,
+                    foo_cert_length));
+
+    /* getting the transaction by id should return success. */
+    TEST_ASSERT(
+        0
+            == dataservice_transaction_get(
+                    &child, nullptr, foo_key, &node, &txn_bytes, &txn_size));
+    free(txn_bytes);
+
+    /* create foo block. */
+    TEST_ASSERT(
+        0
+            == create_dummy_block(
+                    &fixture.builder_opts, foo_block_id,
+                    vccert_certificate_type_uuid_root_block, 1, &foo_block_cert,
+                    &foo_block_cert_length, foo_cert, foo_cert_length,
+                    nullptr));
+
+    /* getting the block transaction by id should return not found. */
+    TEST_ASSERT(
+        AGENTD_ERROR_DATASERVICE_NOT_FOUND
+            == dataservice_block_transaction_get(
+                    &child, nullptr, foo_key, &node, &txn_bytes, &txn_size));
+
+    /* make block. */
+    TEST_ASSERT(
+        0
+            == dataservice_block_make(
+                    &child, nullptr, foo_block_id,
+                    foo_block_cert, foo_block_cert_length));
+
+    /* getting the transaction by id should return not found. */
+    TEST_ASSERT(
+        AGENTD_ERROR_DATASERVICE_NOT_FOUND
+            == dataservice_transaction_get(
+                    &child, nullptr, foo_key, &node, &txn_bytes, &txn_size));
+
+    /* getting the block transaction by id should return success. */
+    TEST_ASSERT(
+        0
+            == dataservice_block_transaction_get(
+                    &child, nullptr, foo_key, &node, &txn_bytes, &txn_size));
+    free(txn_bytes);
+
+    /* getting the block record by block id should return success. */
+    TEST_ASSERT(
+        0
+            == dataservice_block_get(
+                    &child, nullptr, foo_block_id, &block_node,
+                    &block_txn_bytes, &block_txn_size));
+    /* the key should match our block id. */
+    TEST_ASSERT(0 == memcmp(block_node.key, foo_block_id, 16));
+    TEST_ASSERT(0 == memcmp(block_node.first_transaction_id, foo_key, 16));
+    TEST_ASSERT(1U == ntohll(block_node.net_block_height));
+
+    /* verify that a block ID exists for block height 1. */
+    TEST_ASSERT(
+        0
+            == dataservice_block_id_by_height_get(
+                    &child, nullptr, 1, block_id_for_height_1));
+    /* this block ID matches our block ID. */
+    TEST_EXPECT(0 == memcmp(foo_block_id, block_id_for_height_1, 16));
+
+    /* verify that the latest block id matches our block id. */
+    TEST_ASSERT(
+        0
+            == dataservice_latest_block_id_get(
+                    &child, nullptr, latest_block_id));
+    /* this block ID matches our block ID. */
+    TEST_EXPECT(0 == memcmp(foo_block_id, latest_block_id, 16));
+
+    /* getting the artifact record by artifact id should return success. */
+    TEST_ASSERT(
+        0
+            == dataservice_artifact_get(
+                    &child, nullptr, foo_artifact, &foo_artifact_record));
+    /* the key should match the artifact ID. */
+    TEST_ASSERT(0 == memcmp(foo_artifact_record.key, foo_artifact, 16));
+    /* the first transaction should be the foo transaction. */
+    TEST_ASSERT(0 == memcmp(foo_artifact_record.txn_first, foo_key, 16));
+    /* the latest transaction should be the foo transaction. */
+    TEST_ASSERT(0 == memcmp(foo_artifact_record.txn_latest, foo_key, 16));
+    /* the first height for this artifact should be 1. */
+    TEST_ASSERT(1U == ntohll(foo_artifact_record.net_height_first));
+    /* the latest height for this artifact should be 1. */
+    TEST_ASSERT(1U == ntohll(foo_artifact_record.net_height_latest));
+
+    /* the block, transaction, and artifact ids are now in use. */
+    TEST_EXPECT(
+        AGENTD_STATUS_SUCCESS
+            == dataservice_id_exists(&child, nullptr, foo_block_id));
+    TEST_EXPECT(
+        AGENTD_STATUS_SUCCESS
+            == dataservice_id_exists(&child, nullptr, foo_key));
+    TEST_EXPECT(
+        AGENTD_STATUS_SUCCESS
+            == dataservice_id_exists(&child, nullptr, foo_artifact));
+
+    /* an unknown id is not in use. */
+    TEST_EXPECT(
+        AGENTD_ERROR_DATASERVICE_NOT_FOUND
+            == dataservice_id_exists(&child, nullptr, foo_prev));
+
+    /* the canonized transaction can't be submitted again. */
+    TEST_EXPECT(
+        AGENTD_ERROR_DATASERVICE_DUPLICATE_TRANSACTION_ID
+            == dataservice_transaction_submit(
+                    &child, nullptr, foo_key, foo_artifact, foo_cert,
+                    foo_cert_length));
+
+    /* clean up. */
+    dispose((disposable_t*)&ctx);
+    free(foo_cert);
+    free(foo_block_cert);
+END_TEST_F()
+
+/**
+ * Test that a dataservice instance that did not write a block still sees the
+ * ids in that block, even though its id filter was built before the block was
+ * written.
+ */
+BEGIN_TEST_F(id_exists_stale_filter)
+    uint8_t foo_key[16] = {
+        0x9b, 0xfe, 0xec, 0xc9, 0x28, 0x5d, 0x44, 0xba,
+        0x84, 0xdf, 0xd6, 0xfd, 0x3e, 0xe8, 0x79, 0x2f
+    };
+    uint8_t foo_prev[16] = {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    };
+    uint8_t foo_artifact[16] = {
+        0xef, 0x44, 0xe7, 0xb4, 0xbf, 0x39, 0x45, 0xe4,
+        0xb3, 0x4b, 0x6e, 0x82, 0xee, 0x41, 0x76, 0x21
+    };
+    uint8_t foo_block_id[16] = {
+        0x96, 0x1e, 0xdd, 0x16, 0xbd, 0xa6, 0x4b, 0x9d,
+        0x93, 0xac, 0x40, 0xd4, 0x74, 0x85, 0x0d, 0xe5
+    };
+    uint8_t* foo_cert = nullptr;
+    size_t foo_cert_length = 0;
+    uint8_t* foo_block_cert = nullptr;
+    size_t foo_block_cert_length = 0;
+    string DB_PATH;
+    dataservice_root_context_t canonizer_ctx;
+    dataservice_child_context_t canonizer;
+    dataservice_root_context_t submitter_ctx;
+    dataservice_child_context_t submitter;
+
+    /* create the directory for this test. */
+    TEST_ASSERT(0 == fixture.createDirectoryName(__COUNTER__, DB_PATH));
+
+    BITCAP(reducedcaps, DATASERVICE_API_CAP_BITS_MAX);
+
+    /* open the database twice, as two dataservice processes would. */
+    memset(&canonizer_ctx, 0xFF, sizeof(canonizer_ctx));
+    canonizer_ctx.hdr.dispose = nullptr;
+    BITCAP_SET_TRUE(
+        canonizer_ctx.apicaps, DATASERVICE_API_CAP_LL_ROOT_CONTEXT_CREATE);
+    TEST_ASSERT(
+        0
+            == dataservice_root_context_init(
+                    &canonizer_ctx, DEFAULT_DATABASE_SIZE, 0U, 0U,
+                    DB_PATH.c_str()));
+
+    memset(&submitter_ctx, 0xFF, sizeof(submitter_ctx));
+    submitter_ctx.hdr.dispose = nullptr;
+    BITCAP_SET_TRUE(
+        submitter_ctx.apicaps, DATASERVICE_API_CAP_LL_ROOT_CONTEXT_CREATE);
+    TEST_ASSERT(
+        0
+            == dataservice_root_context_init(
+                    &submitter_ctx, DEFAULT_DATABASE_SIZE, 0U, 0U,
+                    DB_PATH.c_str()));
+
+    /* both child contexts can submit, read, and write blocks. */
+    BITCAP_INIT_FALSE(reducedcaps);
+    BITCAP_SET_TRUE(reducedcaps,
+        DATASERVICE_API_CAP_APP_BLOCK_WRITE);
+    BITCAP_SET_TRUE(reducedcaps,
+        DATASERVICE_API_CAP_APP_BLOCK_READ);
+    BITCAP_SET_TRUE(reducedcaps,
+        DATASERVICE_API_CAP_APP_PQ_TRANSACTION_SUBMIT);
+    BITCAP_SET_TRUE(reducedcaps,
+        DATASERVICE_API_CAP_APP_TRANSACTION_READ);
+    BITCAP_SET_TRUE(reducedcaps,
+        DATASERVICE_API_CAP_APP_ARTIFACT_READ);
+
+    BITCAP_SET_TRUE(canonizer.childcaps,
+        DATASERVICE_API_CAP_LL_CHILD_CONTEXT_CREATE);
+    TEST_ASSERT(
+        0
+            == dataservice_child_context_create(
+                    &canonizer_ctx, &canonizer, reducedcaps));
+
+    BITCAP_SET_TRUE(submitter.childcaps,
+        DATASERVICE_API_CAP_LL_CHILD_CONTEXT_CREATE);
+    TEST_ASSERT(
+        0
+            == dataservice_child_context_create(
+                    &submitter_ctx, &submitter, reducedcaps));
+
+    /* the submitter's filter is built before the block exists. */
+    TEST_EXPECT(
+        AGENTD_ERROR_DATASERVICE_NOT_FOUND
+            == dataservice_id_exists(&submitter, nullptr, foo_key));
+
+    /* create foo transaction. */
+    TEST_ASSERT(
+        0
+            == fixture.create_dummy_transaction(
+                    foo_key, foo_prev, foo_artifact, &foo_cert,
+                    &foo_cert_length));
+
+    /* submit foo transaction. */
+    TEST_ASSERT(
+        0
+            == dataservice_transaction_submit(
+                    &canonizer, nullptr, foo_key, foo_artifact, foo_cert,
+                    foo_cert_length));
+
+    /* create foo block. */
+    TEST_ASSERT(
+        0
+            == create_dummy_block(
+                    &fixture.builder_opts, foo_block_id,
+                    vccert_certificate_type_uuid_root_block, 1, &foo_block_cert,
+                    &foo_block_cert_length, foo_cert, foo_cert_length,
+                    nullptr));
+
+    /* the canonizer makes the block. */
+    TEST_ASSERT(
+        0
+            == dataservice_block_make(
+                    &canonizer, nullptr, foo_block_id,
+                    foo_block_cert, foo_block_cert_length));
+
+    /* the submitter sees the block, transaction, and artifact ids. */
+    TEST_EXPECT(
+        AGENTD_STATUS_SUCCESS
+            == dataservice_id_exists(&submitter, nullptr, foo_block_id));
+    TEST_EXPECT(
+        AGENTD_STATUS_SUCCESS
+            == dataservice_id_exists(&submitter, nullptr, foo_key));
+    TEST_EXPECT(
+        AGENTD_STATUS_SUCCESS
+            == dataservice_id_exists(&submitter, nullptr, foo_artifact));
+
+    /* an unknown id is still not in use. */
+    TEST_EXPECT(
+        AGENTD_ERROR_DATASERVICE_NOT_FOUND
+            == dataservice_id_exists(&submitter, nullptr, foo_prev));
+
+    /* the submitter rejects the canonized transaction. */
+    TEST_EXPECT(
+        AGENTD_ERROR_DATASERVICE_DUPLICATE_TRANSACTION_ID
+            == dataservice_transaction_submit(
+                    &submitter, nullptr, foo_key, foo_artifact, foo_cert,
+                    foo_cert_length));
+
+    /* clean up. */
+    dispose((disposable_t*)&submitter_ctx);
+    dispose((disposable_t*)&canonizer_ctx);
+    free(foo_cert);
+    free(foo_block_cert);
+END_TEST_F()
+
+/**
+ * Test that dataservice_id_exists requires the block, transaction, and
+ * artifact read capabilities.
+ */
+BEGIN_TEST_F(id_exists_bitcap)
+    uint8_t foo_id[16] = {
+        0x9b, 0xfe, 0xec, 0xc9, 0x28, 0x5d, 0x44, 0xba,
+        0x84, 0xdf, 0xd6, 0xfd, 0x3e, 0xe8, 0x79, 0x2f
+    };
+    string DB_PATH;
+    dataservice_root_context_t ctx;
+    dataservice_child_context_t child;
+
+    /* create the directory for this test. */
+    TEST_ASSERT(0 == fixture.createDirectoryName(__COUNTER__, DB_PATH));
+
+    BITCAP(reducedcaps, DATASERVICE_API_CAP_BITS_MAX);
+
+    /* precondition: ctx is invalid. */
+    memset(&ctx, 0xFF, sizeof(ctx));
+    /* precondition: disposer is NULL. */
+    ctx.hdr.dispose = nullptr;
+
+    /* explicitly grant the capability to create this root context. */
+    BITCAP_SET_TRUE(ctx.apicaps, DATASERVICE_API_CAP_LL_ROOT_CONTEXT_CREATE);
+
+    /* initialize the root context given a test data directory. */
+    TEST_ASSERT(
         0
-            == dataservice_artifact_get(
-                    &child, nullptr, foo_artifact, &foo_artifact_record));
-    /* the key should match the artifact ID. */
-    TEST_ASSERT(0 == memcmp(foo_artifact_record.key, foo_artifact, 16));
-    /* the first transaction should be the foo transaction. */
-    TEST_ASSERT(0 == memcmp(foo_artifact_record.txn_first, foo_key, 16));
-    /* the latest transaction should be the foo transaction. */
-    TEST_ASSERT(0 == memcmp(foo_artifact_record.txn_latest, foo_key, 16));
-    /* the first height for this artifact should be 1. */
-    TEST_ASSERT(1U == ntohll(foo_artifact_record.net_height_first));
-    /* the latest height for this artifact should be 1. */
-    TEST_ASSERT(1U == ntohll(foo_artifact_record.net_height_latest));
+            == dataservice_root_context_init(
+                    &ctx, DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
+
+    /* create a reduced capabilities set without artifact read. */
+    BITCAP_INIT_FALSE(reducedcaps);
+    BITCAP_SET_TRUE(reducedcaps,
+        DATASERVICE_API_CAP_APP_BLOCK_READ);
+    BITCAP_SET_TRUE(reducedcaps,
+        DATASERVICE_API_CAP_APP_TRANSACTION_READ);
+
+    /* explicitly grant the capability to create child contexts in the child
+     * context. */
+    BITCAP_SET_TRUE(child.childcaps,
+        DATASERVICE_API_CAP_LL_CHILD_CONTEXT_CREATE);
+
+    /* create a child context using this reduced capabilities set. */
+    TEST_ASSERT(
+        0 == dataservice_child_context_create(&ctx, &child, reducedcaps));
+
+    /* the id exists check is not authorized. */
+    TEST_EXPECT(
+        AGENTD_ERROR_DATASERVICE_NOT_AUTHORIZED
+            == dataservice_id_exists(&child, nullptr, foo_id));
 
     /* clean up. */
     dispose((disposable_t*)&ctx);
-    free(foo_cert);
+END_TEST_F()
+
+/**
+ * Test that an artifact's transactions can be read back in canonization order,
+ * one page at a time, from the artifact transaction index.
+ */
+BEGIN_TEST_F(artifact_transaction_list_get_paged)
+    uint8_t foo1_key[16] = {
+        0x2d, 0x4a, 0x8e, 0x71, 0x03, 0x5c, 0x4f, 0x96,
+        0xa1, 0x7e, 0x3b, 0xc2, 0x58, 0x0f, 0xd4, 0x19
+    };
+    uint8_t foo2_key[16] = {
+        0x84, 0x13, 0x6f, 0xe2, 0x9a, 0x47, 0x42, 0x0d,
+        0xb5, 0x2c, 0x61, 0x9e, 0x07, 0xf3, 0x48, 0xaa
+    };
+    uint8_t foo3_key[16] = {
+        0x11, 0xc9, 0x5e, 0x37, 0x6d, 0x80, 0x4b, 0x52,
+        0x8f, 0xe4, 0x0a, 0x73, 0xbd, 0x26, 0x95, 0x6c
+    };
+    uint8_t foo_artifact[16] = {
+        0xef, 0x44, 0xe7, 0xb4, 0xbf, 0x39, 0x45, 0xe4,
+        0xb3, 0x4b, 0x6e, 0x82, 0xee, 0x41, 0x76, 0x21
+    };
+    uint8_t bar_artifact[16] = {
+        0x5f, 0x0e, 0x93, 0x28, 0xd1, 0x7a, 0x4c, 0x3b,
+        0x9b, 0x06, 0xe8, 0x45, 0x2f, 0xa0, 0x1d, 0x74
+    };
+    uint8_t block1_id[16] = {
+        0x96, 0x1e, 0xdd, 0x16, 0xbd, 0xa6, 0x4b, 0x9d,
+        0x93, 0xac, 0x40, 0xd4, 0x74, 0x85, 0x0d, 0xe5
+    };
+    uint8_t block2_id[16] = {
+        0x4c, 0x27, 0xb0, 0x5a, 0x12, 0xe9, 0x46, 0x8f,
+        0xa3, 0x5d, 0x79, 0x0c, 0xe6, 0x31, 0xb8, 0x02
+    };
+    uint8_t* foo1_cert = nullptr;
+    size_t foo1_cert_length = 0;
+    uint8_t* foo2_cert = nullptr;
+    size_t foo2_cert_length = 0;
+    uint8_t* foo3_cert = nullptr;
+    size_t foo3_cert_length = 0;
+    uint8_t* block1_cert = nullptr;
+    size_t block1_cert_length = 0;
+    uint8_t* block2_cert = nullptr;
+    size_t block2_cert_length = 0;
+    string DB_PATH;
+    dataservice_root_context_t ctx;
+    dataservice_child_context_t child;
+    data_artifact_transaction_entry_t entries[4];
+    size_t count;
+    bool more;
+
+    /* create the directory for this test. */
+    TEST_ASSERT(0 == fixture.createDirectoryName(__COUNTER__, DB_PATH));
+
+    BITCAP(reducedcaps, DATASERVICE_API_CAP_BITS_MAX);
+
+    /* precondition: ctx is invalid. */
+    memset(&ctx, 0xFF, sizeof(ctx));
+    /* precondition: disposer is NULL. */
+    ctx.hdr.dispose = nullptr;
+
+    /* explicitly grant the capability to create this root context. */
+    BITCAP_SET_TRUE(ctx.apicaps, DATASERVICE_API_CAP_LL_ROOT_CONTEXT_CREATE);
+
+    /* initialize the root context given a test data directory. */
+    TEST_ASSERT(
+        0
+            == dataservice_root_context_init(
+                    &ctx, DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
+
+    /* create a reduced capabilities set for the child context. */
+    BITCAP_INIT_FALSE(reducedcaps);
+    BITCAP_SET_TRUE(reducedcaps,
+        DATASERVICE_API_CAP_APP_BLOCK_WRITE);
+    BITCAP_SET_TRUE(reducedcaps,
+        DATASERVICE_API_CAP_APP_PQ_TRANSACTION_SUBMIT);
+    BITCAP_SET_TRUE(reducedcaps,
+        DATASERVICE_API_CAP_APP_ARTIFACT_READ);
+
+    /* explicitly grant the capability to create child contexts in the child
+     * context. */
+    BITCAP_SET_TRUE(child.childcaps,
+        DATASERVICE_API_CAP_LL_CHILD_CONTEXT_CREATE);
+
+    /* create a child context using this reduced capabilities set. */
+    TEST_ASSERT(
+        0 == dataservice_child_context_create(&ctx, &child, reducedcaps));
+
+    /* the artifact has no history yet. */
+    count = 4;
+    TEST_ASSERT(
+        AGENTD_ERROR_DATASERVICE_NOT_FOUND
+            == dataservice_artifact_transaction_list_get(
+                    &child, nullptr, foo_artifact, 0, 0, entries, &count,
+                    &more));
+
+    /* create and submit the foo transactions. */
+    TEST_ASSERT(
+        0
+            == fixture.create_dummy_transaction(
+                    foo1_key, fixture.zero_uuid, foo_artifact, &foo1_cert,
+                    &foo1_cert_length));
+    TEST_ASSERT(
+        0
+            == dataservice_transaction_submit(
+                    &child, nullptr, foo1_key, foo_artifact, foo1_cert,
+                    foo1_cert_length));
+    TEST_ASSERT(
+        0
+            == fixture.create_dummy_transaction(
+                    foo2_key, foo1_key, foo_artifact, &foo2_cert,
+                    &foo2_cert_length));
+    TEST_ASSERT(
+        0
+            == dataservice_transaction_submit(
+                    &child, nullptr, foo2_key, foo_artifact, foo2_cert,
+                    foo2_cert_length));
+    TEST_ASSERT(
+        0
+            == fixture.create_dummy_transaction(
+                    foo3_key, foo2_key, foo_artifact, &foo3_cert,
+                    &foo3_cert_length));
+    TEST_ASSERT(
+        0
+            == dataservice_transaction_submit(
+                    &child, nullptr, foo3_key, foo_artifact, foo3_cert,
+                    foo3_cert_length));
+
+    /* block 1 holds foo1. */
+    TEST_ASSERT(
+        0
+            == create_dummy_block(
+                    &fixture.builder_opts, block1_id,
+                    vccert_certificate_type_uuid_root_block, 1, &block1_cert,
+                    &block1_cert_length, foo1_cert, foo1_cert_length,
+                    nullptr));
+    TEST_ASSERT(
+        0
+            == dataservice_block_make(
+                    &child, nullptr, block1_id, block1_cert,
+                    block1_cert_length));
+
+    /* block 2 holds foo2 and foo3. */
+    TEST_ASSERT(
+        0
+            == create_dummy_block(
+                    &fixture.builder_opts, block2_id, block1_id, 2,
+                    &block2_cert, &block2_cert_length, foo2_cert,
+                    foo2_cert_length, foo3_cert, foo3_cert_length, nullptr));
+    TEST_ASSERT(
+        0
+            == dataservice_block_make(
+                    &child, nullptr, block2_id, block2_cert,
+                    block2_cert_length));
+
+    /* the first page holds foo1 and foo2, and there is more. */
+    count = 2;
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == dataservice_artifact_transaction_list_get(
+                    &child, nullptr, foo_artifact, 0, 0, entries, &count,
+                    &more));
+    TEST_ASSERT(2U == count);
+    TEST_EXPECT(more);
+    TEST_EXPECT(0 == memcmp(foo1_key, entries[0].txn_id, 16));
+    TEST_EXPECT(1U == ntohll(entries[0].net_height));
+    TEST_EXPECT(0U == ntohl(entries[0].net_index));
+    TEST_EXPECT(0 == memcmp(foo2_key, entries[1].txn_id, 16));
+    TEST_EXPECT(2U == ntohll(entries[1].net_height));
+    TEST_EXPECT(0U == ntohl(entries[1].net_index));
+
+    /* the next page starts after foo2, and holds only foo3. */
+    count = 2;
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == dataservice_artifact_transaction_list_get(
+                    &child, nullptr, foo_artifact, 2, 1, entries, &count,
+                    &more));
+    TEST_ASSERT(1U == count);
+    TEST_EXPECT(!more);
+    TEST_EXPECT(0 == memcmp(foo3_key, entries[0].txn_id, 16));
+    TEST_EXPECT(2U == ntohll(entries[0].net_height));
+    TEST_EXPECT(1U == ntohl(entries[0].net_index));
+
+    /* there is nothing past the end of the history. */
+    count = 2;
+    TEST_EXPECT(
+        AGENTD_ERROR_DATASERVICE_NOT_FOUND
+            == dataservice_artifact_transaction_list_get(
+                    &child, nullptr, foo_artifact, 3, 0, entries, &count,
+                    &more));
+
+    /* another artifact has no history. */
+    count = 2;
+    TEST_EXPECT(
+        AGENTD_ERROR_DATASERVICE_NOT_FOUND
+            == dataservice_artifact_transaction_list_get(
+                    &child, nullptr, bar_artifact, 0, 0, entries, &count,
+                    &more));
+
+    /* clean up. */
+    dispose((disposable_t*)&ctx);
+    free(foo1_cert);
+    free(foo2_cert);
+    free(foo3_cert);
+    free(block1_cert);
+    free(block2_cert);
+END_TEST_F()
+
+/**
+ * Test that a block large enough to be parsed on worker threads is made with
+ * every transaction applied in block order.
+ */
+BEGIN_TEST_F(transaction_make_block_parallel_parse)
+    const size_t TXN_COUNT = 64;
+    uint8_t foo_block_id[16] = {
+        0x17, 0x0c, 0x4e, 0x0e, 0x8d, 0x6a, 0x4f, 0x2f,
+        0x9e, 0x0b, 0x5b, 0x41, 0xa3, 0x54, 0x2c, 0x7d
+    };
+    uint8_t txn_ids[TXN_COUNT][16];
+    uint8_t artifact_ids[TXN_COUNT][16];
+    uint8_t* certs[TXN_COUNT];
+    size_t cert_sizes[TXN_COUNT];
+    uint8_t* foo_block_cert = nullptr;
+    size_t foo_block_cert_length = 0;
+    string DB_PATH;
+    dataservice_root_context_t ctx;
+    dataservice_child_context_t child;
+    data_transaction_node_t node;
+    data_block_node_t block_node;
+    uint8_t* txn_bytes;
+    size_t txn_size;
+    uint8_t* block_txn_bytes;
+    size_t block_txn_size;
+
+    /* create the directory for this test. */
+    TEST_ASSERT(0 == fixture.createDirectoryName(__COUNTER__, DB_PATH));
+
+    BITCAP(reducedcaps, DATASERVICE_API_CAP_BITS_MAX);
+
+    /* precondition: ctx is invalid. */
+    memset(&ctx, 0xFF, sizeof(ctx));
+    /* precondition: disposer is NULL. */
+    ctx.hdr.dispose = nullptr;
+
+    /* explicitly grant the capability to create this root context. */
+    BITCAP_SET_TRUE(ctx.apicaps, DATASERVICE_API_CAP_LL_ROOT_CONTEXT_CREATE);
+
+    /* initialize the root context given a test data directory. */
+    TEST_ASSERT(
+        0
+            == dataservice_root_context_init(
+                    &ctx, DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
+
+    /* create a reduced capabilities set for the child context. */
+    BITCAP_INIT_FALSE(reducedcaps);
+    BITCAP_SET_TRUE(reducedcaps,
+        DATASERVICE_API_CAP_APP_BLOCK_WRITE);
+    BITCAP_SET_TRUE(reducedcaps,
+        DATASERVICE_API_CAP_APP_BLOCK_READ);
+    BITCAP_SET_TRUE(reducedcaps,
+        DATASERVICE_API_CAP_APP_PQ_TRANSACTION_SUBMIT);
+    BITCAP_SET_TRUE(reducedcaps,
+        DATASERVICE_API_CAP_APP_TRANSACTION_READ);
+
+    /* explicitly grant the capability to create child contexts in the child
+     * context. */
+    BITCAP_SET_TRUE(child.childcaps,
+        DATASERVICE_API_CAP_LL_CHILD_CONTEXT_CREATE);
+
+    /* create a child context using this reduced capabilities set. */
+    TEST_ASSERT(
+        0 == dataservice_child_context_create(&ctx, &child, reducedcaps));
+
+    /* create and submit each transaction. */
+    for (size_t i = 0; i < TXN_COUNT; ++i)
+    {
+        memset(txn_ids[i], 0x5a, 16);
+        txn_ids[i][15] = (uint8_t)i;
+        memset(artifact_ids[i], 0xa5, 16);
+        artifact_ids[i][15] = (uint8_t)i;
+
+        TEST_ASSERT(
+            0
+                == fixture.create_dummy_transaction(
+                        txn_ids[i], fixture.zero_uuid, artifact_ids[i],
+                        &certs[i], &cert_sizes[i]));
+
+        TEST_ASSERT(
+            0
+                == dataservice_transaction_submit(
+                        &child, nullptr, txn_ids[i], artifact_ids[i],
+                        certs[i], cert_sizes[i]));
+    }
+
+    /* create the block. */
+    TEST_ASSERT(
+        0
+            == create_dummy_block_list(
+                    &fixture.builder_opts, foo_block_id,
+                    vccert_certificate_type_uuid_root_block, 1,
+                    &foo_block_cert, &foo_block_cert_length, certs,
+                    cert_sizes, TXN_COUNT));
+
+    /* make block. */
+    TEST_ASSERT(
+        0
+            == dataservice_block_make(
+                    &child, nullptr, foo_block_id,
+                    foo_block_cert, foo_block_cert_length));
+
+    /* the block links to the first transaction in the block. */
+    TEST_ASSERT(
+        0
+            == dataservice_block_get(
+                    &child, nullptr, foo_block_id, &block_node,
+                    &block_txn_bytes, &block_txn_size));
+    TEST_EXPECT(0 == memcmp(block_node.first_transaction_id, txn_ids[0], 16));
+    free(block_txn_bytes);
+
+    /* every transaction moved from the queue into the block. */
+    for (size_t i = 0; i < TXN_COUNT; ++i)
+    {
+        TEST_EXPECT(
+            AGENTD_ERROR_DATASERVICE_NOT_FOUND
+                == dataservice_transaction_get(
+                        &child, nullptr, txn_ids[i], &node, &txn_bytes,
+                        &txn_size));
+
+        TEST_ASSERT(
+            0
+                == dataservice_block_transaction_get(
+                        &child, nullptr, txn_ids[i], &node, &txn_bytes,
+                        &txn_size));
+        TEST_EXPECT(0 == memcmp(node.block_id, foo_block_id, 16));
+        free(txn_bytes);
+    }
+
+    /* clean up. */
+    dispose((disposable_t*)&ctx);
+    for (size_t i = 0; i < TXN_COUNT; ++i)
+    {
+        free(certs[i]);
+    }
     free(foo_block_cert);
 END_TEST_F()
 
@@ -3622,7 +4688,7 @@ BEGIN_TEST_F(transaction_make_block_bitset)
     TEST_ASSERT(
         0
             == dataservice_root_context_init(
-                    &ctx, DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    &ctx, DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
 
     /* create a reduced capabilities set for the child context. */
     BITCAP_INIT_FALSE(reducedcaps);
@@ -3726,7 +4792,7 @@ BEGIN_TEST_F(transaction_make_block_bad_height)
     TEST_ASSERT(
         0
             == dataservice_root_context_init(
-                    &ctx, DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    &ctx, DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
 
     /* create a reduced capabilities set for the child context. */
     BITCAP_INIT_FALSE(reducedcaps);
@@ -3829,7 +4895,7 @@ BEGIN_TEST_F(transaction_make_block_bad_prev_block_id)
     TEST_ASSERT(
         0
             == dataservice_root_context_init(
-                    &ctx, DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    &ctx, DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
 
     /* create a reduced capabilities set for the child context. */
     BITCAP_INIT_FALSE(reducedcaps);
@@ -3931,7 +4997,7 @@ BEGIN_TEST_F(transaction_make_block_bad_block_id)
     TEST_ASSERT(
         0
             == dataservice_root_context_init(
-                    &ctx, DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    &ctx, DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
 
     /* create a reduced capabilities set for the child context. */
     BITCAP_INIT_FALSE(reducedcaps);
@@ -4080,7 +5146,7 @@ BEGIN_TEST_F(transaction_empty_root_next_block_id)
     TEST_ASSERT(
         0
             == dataservice_root_context_init(
-                    &ctx, DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    &ctx, DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
 
     /* create a reduced capabilities set for the child context. */
     BITCAP_INIT_FALSE(reducedcaps);
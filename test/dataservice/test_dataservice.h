@@ -55,6 +55,12 @@ int create_dummy_block(
     const uint8_t* block_uuid, const uint8_t* prev_block_uuid,
     uint64_t block_height,
     uint8_t** block_cert, size_t* block_cert_length, ...);
+int create_dummy_block_list(
+    vccert_builder_options_t* builder_opts,
+    const uint8_t* block_uuid, const uint8_t* prev_block_uuid,
+    uint64_t block_height,
+    uint8_t** block_cert, size_t* block_cert_length,
+    const uint8_t* const* txns, const size_t* txn_sizes, size_t txn_count);
 }
 
 #endif /*TEST_DATASERVICE_HEADER_GUARD*/
@@ -42,7 +42,7 @@ TEST(request_root_context_init_bad_sizes)
         AGENTD_ERROR_DATASERVICE_REQUEST_PACKET_INVALID_SIZE
             == dataservice_decode_request_root_context_init(
                     req, &alloc_opts,
-                    8 /* must have at least one byte for data dir. */, &dreq));
+                    16 /* must have at least one byte for data dir. */, &dreq));
 
     dispose((disposable_t*)&alloc_opts);
 }
@@ -84,10 +84,16 @@ TEST(request_root_context_init_null_checks)
  */
 TEST(request_root_context_init_decoded)
 {
-    uint8_t req[13] = {
+    uint8_t req[21] = {
         /* size == 16383 */
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
 
+        /* datastore flags == NOMETASYNC | WRITEMAP */
+        0x00, 0x00, 0x00, 0x03,
+
+        /* max readers == 512 */
+        0x00, 0x00, 0x02, 0x00,
+
         /* datadir == "/data" */
         '/', 'd', 'a', 't', 'a'
     };
@@ -104,6 +110,12 @@ TEST(request_root_context_init_decoded)
 
     /* the size is correct. */
     TEST_ASSERT(16383UL == dreq.max_database_size);
+    /* the datastore flags are correct. */
+    TEST_ASSERT(
+        (DATASTORE_FLAG_NOMETASYNC | DATASTORE_FLAG_WRITEMAP)
+            == dreq.datastore_flags);
+    /* the max readers are correct. */
+    TEST_ASSERT(512U == dreq.max_readers);
     /* the data directory is correct. */
     TEST_ASSERT(!strcmp("/data",dreq.datadir));
 
@@ -1356,6 +1368,502 @@ TEST(response_transaction_get_decoded_full_payload)
     TEST_ASSERT(resp + 80 == dresp.data);
 }
 
+/**
+ * Test that a transaction list response with an invalid method code returns an
+ * error.
+ */
+TEST(response_transaction_list_get_bad_method_code)
+{
+    uint8_t resp[12] = {
+        /* bad method code. */
+        0x00, 0x00, 0x00, 0x12,
+
+        /* offset == 1023 */
+        0x00, 0x00, 0x03, 0xFF,
+
+        /* status == 0x12345678 */
+        0x12, 0x34, 0x56, 0x78
+    };
+    dataservice_response_transaction_list_get_t dresp;
+
+    /* the method code for a single transaction read is rejected. */
+    TEST_ASSERT(
+        AGENTD_ERROR_DATASERVICE_RECVRESP_UNEXPECTED_METHOD_CODE
+            == dataservice_decode_response_transaction_list_get(
+                    resp, sizeof(resp), &dresp));
+}
+
+/**
+ * Test that a transaction list response with entries is successfully decoded,
+ * and that its entries can be read in order.
+ */
+TEST(response_transaction_list_get_decoded_entries)
+{
+    const uint8_t EXPECTED_KEY_1[16] = {
+        0x37, 0xfb, 0x38, 0xd3, 0xfe, 0x6b, 0x4e, 0x9c,
+        0xba, 0x15, 0x91, 0xbe, 0xf7, 0xf3, 0x87, 0xef
+    };
+    const uint8_t EXPECTED_KEY_2[16] = {
+        0xf5, 0x17, 0xda, 0x53, 0xcb, 0x26, 0x45, 0x45,
+        0xaa, 0x62, 0x8f, 0x2b, 0x7f, 0x16, 0xfb, 0x7c
+    };
+    const uint8_t EXPECTED_CERT_1[] = { 0x01, 0x02, 0x03 };
+    const uint8_t EXPECTED_CERT_2[] = { 0x04, 0x05, 0x06, 0x07, 0x08 };
+    uint8_t resp[12 + 2 * (4 + 68) + 3 + 5] = { 0 };
+    uint8_t* bresp = resp;
+    uint32_t val;
+    dataservice_response_transaction_list_get_t dresp;
+    data_transaction_node_t node;
+    const void* cert;
+    size_t cert_size;
+
+    /* write the header. */
+    val = htonl(DATASERVICE_API_METHOD_APP_PQ_TRANSACTION_LIST_READ);
+    memcpy(bresp, &val, sizeof(val));
+    bresp += sizeof(val);
+    val = htonl(1023);
+    memcpy(bresp, &val, sizeof(val));
+    bresp += sizeof(val);
+    val = htonl(AGENTD_STATUS_SUCCESS);
+    memcpy(bresp, &val, sizeof(val));
+    bresp += sizeof(val);
+
+    /* write the first entry. */
+    val = htonl(68 + sizeof(EXPECTED_CERT_1));
+    memcpy(bresp, &val, sizeof(val));
+    bresp += sizeof(val);
+    memcpy(bresp, EXPECTED_KEY_1, 16);
+    memcpy(bresp + 32, EXPECTED_KEY_2, 16);
+    val = htonl(DATASERVICE_TRANSACTION_NODE_STATE_ATTESTED);
+    memcpy(bresp + 64, &val, sizeof(val));
+    memcpy(bresp + 68, EXPECTED_CERT_1, sizeof(EXPECTED_CERT_1));
+    bresp += 68 + sizeof(EXPECTED_CERT_1);
+
+    /* write the second entry. */
+    val = htonl(68 + sizeof(EXPECTED_CERT_2));
+    memcpy(bresp, &val, sizeof(val));
+    bresp += sizeof(val);
+    memcpy(bresp, EXPECTED_KEY_2, 16);
+    memcpy(bresp + 16, EXPECTED_KEY_1, 16);
+    memcpy(bresp + 68, EXPECTED_CERT_2, sizeof(EXPECTED_CERT_2));
+
+    /* a valid response is successfully decoded. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == dataservice_decode_response_transaction_list_get(
+                    resp, sizeof(resp), &dresp));
+
+    /* the header is correct. */
+    TEST_ASSERT(
+        DATASERVICE_API_METHOD_APP_PQ_TRANSACTION_LIST_READ
+            == dresp.hdr.method_code);
+    TEST_ASSERT(1023U == dresp.hdr.offset);
+    TEST_ASSERT(AGENTD_STATUS_SUCCESS == (int)dresp.hdr.status);
+    /* there are two entries. */
+    TEST_ASSERT(2U == dresp.count);
+    TEST_ASSERT(resp + 12 == dresp.data);
+    TEST_ASSERT(sizeof(resp) - 12 == dresp.data_size);
+
+    const void* entries = dresp.data;
+    size_t entries_size = dresp.data_size;
+
+    /* the first entry is decoded. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == dataservice_decode_response_transaction_list_get_entry(
+                    &entries, &entries_size, &node, &cert, &cert_size));
+    TEST_EXPECT(0 == memcmp(EXPECTED_KEY_1, node.key, 16));
+    TEST_EXPECT(0 == memcmp(EXPECTED_KEY_2, node.next, 16));
+    TEST_EXPECT(
+        DATASERVICE_TRANSACTION_NODE_STATE_ATTESTED
+            == ntohl(node.net_txn_state));
+    TEST_ASSERT(sizeof(EXPECTED_CERT_1) == cert_size);
+    TEST_EXPECT(0 == memcmp(EXPECTED_CERT_1, cert, cert_size));
+
+    /* the second entry is decoded. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == dataservice_decode_response_transaction_list_get_entry(
+                    &entries, &entries_size, &node, &cert, &cert_size));
+    TEST_EXPECT(0 == memcmp(EXPECTED_KEY_2, node.key, 16));
+    TEST_EXPECT(0 == memcmp(EXPECTED_KEY_1, node.prev, 16));
+    TEST_ASSERT(sizeof(EXPECTED_CERT_2) == cert_size);
+    TEST_EXPECT(0 == memcmp(EXPECTED_CERT_2, cert, cert_size));
+
+    /* all entries have been read. */
+    TEST_EXPECT(0U == entries_size);
+
+    /* a truncated response is invalid. */
+    TEST_EXPECT(
+        AGENTD_ERROR_DATASERVICE_RESPONSE_PACKET_INVALID_SIZE
+            == dataservice_decode_response_transaction_list_get(
+                    resp, sizeof(resp) - 1, &dresp));
+}
+
+/**
+ * Test that a block range response with an invalid method code returns an
+ * error.
+ */
+TEST(response_block_range_get_bad_method_code)
+{
+    uint8_t resp[12] = {
+        /* bad method code. */
+        0x00, 0x00, 0x00, 0x12,
+
+        /* offset == 1023 */
+        0x00, 0x00, 0x03, 0xFF,
+
+        /* status == 0x12345678 */
+        0x12, 0x34, 0x56, 0x78
+    };
+    dataservice_response_block_range_get_t dresp;
+
+    /* a method code other than the block range read is rejected. */
+    TEST_ASSERT(
+        AGENTD_ERROR_DATASERVICE_RECVRESP_UNEXPECTED_METHOD_CODE
+            == dataservice_decode_response_block_range_get(
+                    resp, sizeof(resp), &dresp));
+}
+
+/**
+ * Test that a block range response with entries is successfully decoded, and
+ * that its entries can be read in order.
+ */
+TEST(response_block_range_get_decoded_entries)
+{
+    const uint8_t EXPECTED_KEY_1[16] = {
+        0x37, 0xfb, 0x38, 0xd3, 0xfe, 0x6b, 0x4e, 0x9c,
+        0xba, 0x15, 0x91, 0xbe, 0xf7, 0xf3, 0x87, 0xef
+    };
+    const uint8_t EXPECTED_KEY_2[16] = {
+        0xf5, 0x17, 0xda, 0x53, 0xcb, 0x26, 0x45, 0x45,
+        0xaa, 0x62, 0x8f, 0x2b, 0x7f, 0x16, 0xfb, 0x7c
+    };
+    const uint8_t EXPECTED_CERT_1[] = { 0x01, 0x02, 0x03 };
+    const uint8_t EXPECTED_CERT_2[] = { 0x04, 0x05, 0x06, 0x07, 0x08 };
+    uint8_t resp[12 + 2 * (4 + 72) + 3 + 5] = { 0 };
+    uint8_t* bresp = resp;
+    uint32_t val;
+    uint64_t height;
+    dataservice_response_block_range_get_t dresp;
+    data_block_node_t node;
+    const void* cert;
+    size_t cert_size;
+
+    /* write the header. */
+    val = htonl(DATASERVICE_API_METHOD_APP_BLOCK_RANGE_READ);
+    memcpy(bresp, &val, sizeof(val));
+    bresp += sizeof(val);
+    val = htonl(1023);
+    memcpy(bresp, &val, sizeof(val));
+    bresp += sizeof(val);
+    val = htonl(AGENTD_STATUS_SUCCESS);
+    memcpy(bresp, &val, sizeof(val));
+    bresp += sizeof(val);
+
+    /* write the first entry. */
+    val = htonl(72 + sizeof(EXPECTED_CERT_1));
+    memcpy(bresp, &val, sizeof(val));
+    bresp += sizeof(val);
+    memcpy(bresp, EXPECTED_KEY_1, 16);
+    memcpy(bresp + 32, EXPECTED_KEY_2, 16);
+    height = htonll(7);
+    memcpy(bresp + 64, &height, sizeof(height));
+    memcpy(bresp + 72, EXPECTED_CERT_1, sizeof(EXPECTED_CERT_1));
+    bresp += 72 + sizeof(EXPECTED_CERT_1);
+
+    /* write the second entry. */
+    val = htonl(72 + sizeof(EXPECTED_CERT_2));
+    memcpy(bresp, &val, sizeof(val));
+    bresp += sizeof(val);
+    memcpy(bresp, EXPECTED_KEY_2, 16);
+    memcpy(bresp + 16, EXPECTED_KEY_1, 16);
+    height = htonll(8);
+    memcpy(bresp + 64, &height, sizeof(height));
+    memcpy(bresp + 72, EXPECTED_CERT_2, sizeof(EXPECTED_CERT_2));
+
+    /* a valid response is successfully decoded. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == dataservice_decode_response_block_range_get(
+                    resp, sizeof(resp), &dresp));
+
+    /* the header is correct. */
+    TEST_ASSERT(
+        DATASERVICE_API_METHOD_APP_BLOCK_RANGE_READ == dresp.hdr.method_code);
+    TEST_ASSERT(1023U == dresp.hdr.offset);
+    TEST_ASSERT(AGENTD_STATUS_SUCCESS == (int)dresp.hdr.status);
+    /* there are two entries. */
+    TEST_ASSERT(2U == dresp.count);
+    TEST_ASSERT(resp + 12 == dresp.data);
+    TEST_ASSERT(sizeof(resp) - 12 == dresp.data_size);
+
+    const void* entries = dresp.data;
+    size_t entries_size = dresp.data_size;
+
+    /* the first entry is decoded. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == dataservice_decode_response_block_range_get_entry(
+                    &entries, &entries_size, &node, &cert, &cert_size));
+    TEST_EXPECT(0 == memcmp(EXPECTED_KEY_1, node.key, 16));
+    TEST_EXPECT(0 == memcmp(EXPECTED_KEY_2, node.next, 16));
+    TEST_EXPECT(7U == ntohll(node.net_block_height));
+    TEST_ASSERT(sizeof(EXPECTED_CERT_1) == cert_size);
+    TEST_EXPECT(sizeof(EXPECTED_CERT_1) == ntohll(node.net_block_cert_size));
+    TEST_EXPECT(0 == memcmp(EXPECTED_CERT_1, cert, cert_size));
+
+    /* the second entry is decoded. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == dataservice_decode_response_block_range_get_entry(
+                    &entries, &entries_size, &node, &cert, &cert_size));
+    TEST_EXPECT(0 == memcmp(EXPECTED_KEY_2, node.key, 16));
+    TEST_EXPECT(0 == memcmp(EXPECTED_KEY_1, node.prev, 16));
+    TEST_EXPECT(8U == ntohll(node.net_block_height));
+    TEST_ASSERT(sizeof(EXPECTED_CERT_2) == cert_size);
+    TEST_EXPECT(0 == memcmp(EXPECTED_CERT_2, cert, cert_size));
+
+    /* all entries have been read. */
+    TEST_EXPECT(0U == entries_size);
+
+    /* a truncated response is invalid. */
+    TEST_EXPECT(
+        AGENTD_ERROR_DATASERVICE_RESPONSE_PACKET_INVALID_SIZE
+            == dataservice_decode_response_block_range_get(
+                    resp, sizeof(resp) - 1, &dresp));
+}
+
+/**
+ * Test that an artifact transaction list response with entries is successfully
+ * decoded, and that its entries can be read in order.
+ */
+TEST(response_artifact_transaction_list_get_decoded_entries)
+{
+    const uint8_t EXPECTED_TXN_1[16] = {
+        0x37, 0xfb, 0x38, 0xd3, 0xfe, 0x6b, 0x4e, 0x9c,
+        0xba, 0x15, 0x91, 0xbe, 0xf7, 0xf3, 0x87, 0xef
+    };
+    const uint8_t EXPECTED_TXN_2[16] = {
+        0xf5, 0x17, 0xda, 0x53, 0xcb, 0x26, 0x45, 0x45,
+        0xaa, 0x62, 0x8f, 0x2b, 0x7f, 0x16, 0xfb, 0x7c
+    };
+    uint8_t resp[16 + 2 * 28] = { 0 };
+    uint8_t* bresp = resp;
+    uint32_t val;
+    uint64_t height;
+    dataservice_response_artifact_transaction_list_get_t dresp;
+    data_artifact_transaction_entry_t entry;
+
+    /* write the header. */
+    val = htonl(DATASERVICE_API_METHOD_APP_ARTIFACT_TRANSACTION_LIST_READ);
+    memcpy(bresp, &val, sizeof(val));
+    bresp += sizeof(val);
+    val = htonl(1023);
+    memcpy(bresp, &val, sizeof(val));
+    bresp += sizeof(val);
+    val = htonl(AGENTD_STATUS_SUCCESS);
+    memcpy(bresp, &val, sizeof(val));
+    bresp += sizeof(val);
+
+    /* write the more flag. */
+    val = htonl(1);
+    memcpy(bresp, &val, sizeof(val));
+    bresp += sizeof(val);
+
+    /* write the first entry. */
+    memcpy(bresp, EXPECTED_TXN_1, 16);
+    height = htonll(7);
+    memcpy(bresp + 16, &height, sizeof(height));
+    val = htonl(0);
+    memcpy(bresp + 24, &val, sizeof(val));
+    bresp += 28;
+
+    /* write the second entry. */
+    memcpy(bresp, EXPECTED_TXN_2, 16);
+    memcpy(bresp + 16, &height, sizeof(height));
+    val = htonl(1);
+    memcpy(bresp + 24, &val, sizeof(val));
+
+    /* a valid response is successfully decoded. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == dataservice_decode_response_artifact_transaction_list_get(
+                    resp, sizeof(resp), &dresp));
+
+    /* the header is correct. */
+    TEST_ASSERT(
+        DATASERVICE_API_METHOD_APP_ARTIFACT_TRANSACTION_LIST_READ
+            == dresp.hdr.method_code);
+    TEST_ASSERT(1023U == dresp.hdr.offset);
+    TEST_ASSERT(AGENTD_STATUS_SUCCESS == (int)dresp.hdr.status);
+    /* the history continues. */
+    TEST_EXPECT(dresp.more);
+    /* there are two entries. */
+    TEST_ASSERT(2U == dresp.count);
+    TEST_ASSERT(resp + 16 == dresp.data);
+    TEST_ASSERT(sizeof(resp) - 16 == dresp.data_size);
+
+    const void* entries = dresp.data;
+    size_t entries_size = dresp.data_size;
+
+    /* the first entry is decoded. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == dataservice_decode_response_artifact_transaction_list_get_entry(
+                    &entries, &entries_size, &entry));
+    TEST_EXPECT(0 == memcmp(EXPECTED_TXN_1, entry.txn_id, 16));
+    TEST_EXPECT(7U == ntohll(entry.net_height));
+    TEST_EXPECT(0U == ntohl(entry.net_index));
+
+    /* the second entry is decoded. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == dataservice_decode_response_artifact_transaction_list_get_entry(
+                    &entries, &entries_size, &entry));
+    TEST_EXPECT(0 == memcmp(EXPECTED_TXN_2, entry.txn_id, 16));
+    TEST_EXPECT(7U == ntohll(entry.net_height));
+    TEST_EXPECT(1U == ntohl(entry.net_index));
+
+    /* all entries have been read. */
+    TEST_EXPECT(0U == entries_size);
+
+    /* a truncated response is invalid. */
+    TEST_EXPECT(
+        AGENTD_ERROR_DATASERVICE_RESPONSE_PACKET_INVALID_SIZE
+            == dataservice_decode_response_artifact_transaction_list_get(
+                    resp, sizeof(resp) - 1, &dresp));
+
+    /* a response without entries is invalid. */
+    TEST_EXPECT(
+        AGENTD_ERROR_DATASERVICE_RESPONSE_PACKET_INVALID_SIZE
+            == dataservice_decode_response_artifact_transaction_list_get(
+                    resp, 16, &dresp));
+}
+
+/**
+ * Test that a transaction batch update response is successfully decoded.
+ */
+TEST(response_transaction_batch_update_decoded)
+{
+    uint8_t resp[12 + 2 * 4] = { 0 };
+    uint8_t* bresp = resp;
+    uint32_t val;
+    dataservice_response_transaction_batch_update_t dresp;
+
+    /* write the header. */
+    val = htonl(DATASERVICE_API_METHOD_APP_PQ_TRANSACTION_BATCH_UPDATE);
+    memcpy(bresp, &val, sizeof(val));
+    bresp += sizeof(val);
+    val = htonl(1023);
+    memcpy(bresp, &val, sizeof(val));
+    bresp += sizeof(val);
+    val = htonl(AGENTD_STATUS_SUCCESS);
+    memcpy(bresp, &val, sizeof(val));
+    bresp += sizeof(val);
+
+    /* write the entry statuses. */
+    val = htonl(AGENTD_STATUS_SUCCESS);
+    memcpy(bresp, &val, sizeof(val));
+    bresp += sizeof(val);
+    val = htonl(AGENTD_ERROR_DATASERVICE_NOT_FOUND);
+    memcpy(bresp, &val, sizeof(val));
+
+    /* a valid response is successfully decoded. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == dataservice_decode_response_transaction_batch_update(
+                    resp, sizeof(resp), &dresp));
+
+    /* the header is correct. */
+    TEST_ASSERT(
+        DATASERVICE_API_METHOD_APP_PQ_TRANSACTION_BATCH_UPDATE
+            == dresp.hdr.method_code);
+    TEST_ASSERT(1023U == dresp.hdr.offset);
+    TEST_ASSERT(AGENTD_STATUS_SUCCESS == (int)dresp.hdr.status);
+    /* there are two entry statuses. */
+    TEST_ASSERT(2U == dresp.count);
+    TEST_ASSERT(resp + 12 == dresp.data);
+    TEST_ASSERT(sizeof(resp) - 12 == dresp.data_size);
+
+    /* a truncated response is invalid. */
+    TEST_EXPECT(
+        AGENTD_ERROR_DATASERVICE_RESPONSE_PACKET_INVALID_SIZE
+            == dataservice_decode_response_transaction_batch_update(
+                    resp, sizeof(resp) - 1, &dresp));
+
+    /* a response without entry statuses is invalid. */
+    TEST_EXPECT(
+        AGENTD_ERROR_DATASERVICE_RESPONSE_PACKET_INVALID_SIZE
+            == dataservice_decode_response_transaction_batch_update(
+                    resp, 12, &dresp));
+
+    /* a response for a different method is invalid. */
+    val = htonl(DATASERVICE_API_METHOD_APP_PQ_TRANSACTION_PROMOTE);
+    memcpy(resp, &val, sizeof(val));
+    TEST_EXPECT(
+        AGENTD_ERROR_DATASERVICE_RECVRESP_UNEXPECTED_METHOD_CODE
+            == dataservice_decode_response_transaction_batch_update(
+                    resp, sizeof(resp), &dresp));
+}
+
+/**
+ * Test that an id exists response is successfully decoded.
+ */
+TEST(response_id_exists_decoded)
+{
+    uint8_t resp[12] = { 0 };
+    uint8_t* bresp = resp;
+    uint32_t val;
+    dataservice_response_id_exists_t dresp;
+
+    /* write the header. */
+    val = htonl(DATASERVICE_API_METHOD_APP_ID_EXISTS_READ);
+    memcpy(bresp, &val, sizeof(val));
+    bresp += sizeof(val);
+    val = htonl(1023);
+    memcpy(bresp, &val, sizeof(val));
+    bresp += sizeof(val);
+    val = htonl(AGENTD_ERROR_DATASERVICE_NOT_FOUND);
+    memcpy(bresp, &val, sizeof(val));
+
+    /* a valid response is successfully decoded. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == dataservice_decode_response_id_exists(
+                    resp, sizeof(resp), &dresp));
+
+    /* the header is correct. */
+    TEST_ASSERT(
+        &dataservice_decode_response_memset_disposer == dresp.hdr.hdr.dispose);
+    TEST_ASSERT(
+        DATASERVICE_API_METHOD_APP_ID_EXISTS_READ == dresp.hdr.method_code);
+    TEST_ASSERT(1023U == dresp.hdr.offset);
+    TEST_ASSERT(
+        AGENTD_ERROR_DATASERVICE_NOT_FOUND == (int)dresp.hdr.status);
+    TEST_ASSERT(0U == dresp.hdr.payload_size);
+
+    /* a truncated response is invalid. */
+    TEST_EXPECT(
+        AGENTD_ERROR_DATASERVICE_RESPONSE_PACKET_INVALID_SIZE
+            == dataservice_decode_response_id_exists(
+                    resp, sizeof(resp) - 1, &dresp));
+
+    /* a null response packet pointer is invalid. */
+    TEST_EXPECT(
+        AGENTD_ERROR_DATASERVICE_RESPONSE_INVALID_PARAMETER
+            == dataservice_decode_response_id_exists(
+                    nullptr, sizeof(resp), &dresp));
+
+    /* a response for a different method is invalid. */
+    val = htonl(DATASERVICE_API_METHOD_APP_PQ_TRANSACTION_PROMOTE);
+    memcpy(resp, &val, sizeof(val));
+    TEST_EXPECT(
+        AGENTD_ERROR_DATASERVICE_RECVRESP_UNEXPECTED_METHOD_CODE
+            == dataservice_decode_response_id_exists(
+                    resp, sizeof(resp), &dresp));
+}
+
 /**
  * Test that we check for sizes when decoding.
  */
@@ -2071,6 +2579,116 @@ TEST(response_block_id_by_height_get_decoded_full_payload)
     TEST_ASSERT(0 == memcmp(EXPECTED_BLOCK_ID, dresp.block_id, 16));
 }
 
+/**
+ * Test that a block id link response with an invalid method code returns an
+ * error.
+ */
+TEST(response_block_id_link_get_bad_method_code)
+{
+    uint8_t resp[12] = {
+        /* block id by height is not a block id link method. */
+        0x00, 0x00, 0x00, 0x16,
+
+        /* offset == 1023 */
+        0x00, 0x00, 0x03, 0xFF,
+
+        /* status == 0x12345678 */
+        0x12, 0x34, 0x56, 0x78
+    };
+    dataservice_response_block_id_link_get_t dresp;
+
+    /* the method code is rejected. */
+    TEST_ASSERT(
+        AGENTD_ERROR_DATASERVICE_RECVRESP_UNEXPECTED_METHOD_CODE
+            == dataservice_decode_response_block_id_link_get(
+                    resp, sizeof(resp), &dresp));
+}
+
+/**
+ * Test that a block id link response with a truncated block id returns an
+ * error.
+ */
+TEST(response_block_id_link_get_bad_sizes)
+{
+    uint8_t resp[16] = {
+        /* method code == DATASERVICE_API_METHOD_APP_BLOCK_ID_PREV_READ */
+        0x00, 0x00, 0x00, 0x0B,
+
+        /* offset == 1023 */
+        0x00, 0x00, 0x03, 0xFF,
+
+        /* status == AGENTD_STATUS_SUCCESS. */
+        0x00, 0x00, 0x00, 0x00,
+
+        /* truncated block_id */
+        0x37, 0xfb, 0x38, 0xd3
+    };
+    dataservice_response_block_id_link_get_t dresp;
+
+    /* a truncated header is rejected. */
+    TEST_ASSERT(
+        AGENTD_ERROR_DATASERVICE_RESPONSE_PACKET_INVALID_SIZE
+            == dataservice_decode_response_block_id_link_get(
+                    resp, 8, &dresp));
+
+    /* a truncated block id is rejected. */
+    TEST_ASSERT(
+        AGENTD_ERROR_DATASERVICE_RESPONSE_PACKET_INVALID_SIZE
+            == dataservice_decode_response_block_id_link_get(
+                    resp, sizeof(resp), &dresp));
+}
+
+/**
+ * Test that a block id link response is successfully decoded with a complete
+ * payload.
+ */
+TEST(response_block_id_link_get_decoded_full_payload)
+{
+    const uint8_t EXPECTED_BLOCK_ID[] = {
+        0x37, 0xfb, 0x38, 0xd3, 0xfe, 0x6b, 0x4e, 0x9c,
+        0xba, 0x15, 0x91, 0xbe, 0xf7, 0xf3, 0x87, 0xef
+    };
+
+    uint8_t resp[28] = {
+        /* method code == DATASERVICE_API_METHOD_APP_BLOCK_ID_NEXT_READ */
+        0x00, 0x00, 0x00, 0x0A,
+
+        /* offset == 1023 */
+        0x00, 0x00, 0x03, 0xFF,
+
+        /* status == AGENTD_STATUS_SUCCESS. */
+        0x00, 0x00, 0x00, 0x00,
+
+        /* block_id */
+        0x37, 0xfb, 0x38, 0xd3, 0xfe, 0x6b, 0x4e, 0x9c,
+        0xba, 0x15, 0x91, 0xbe, 0xf7, 0xf3, 0x87, 0xef
+    };
+    dataservice_response_block_id_link_get_t dresp;
+
+    /* a valid response is successfully decoded. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == dataservice_decode_response_block_id_link_get(
+                    resp, sizeof(resp), &dresp));
+
+    /* the disposer is set to the memset disposer. */
+    TEST_ASSERT(
+        &dataservice_decode_response_memset_disposer == dresp.hdr.hdr.dispose);
+    /* the method code is correct. */
+    TEST_ASSERT(
+        DATASERVICE_API_METHOD_APP_BLOCK_ID_NEXT_READ
+            == dresp.hdr.method_code);
+    /* the offset is correct. */
+    TEST_ASSERT(1023U == dresp.hdr.offset);
+    /* the status is correct. */
+    TEST_ASSERT(AGENTD_STATUS_SUCCESS == (int)dresp.hdr.status);
+    /* the payload size is correct. */
+    TEST_ASSERT(sizeof(dresp) - sizeof(dresp.hdr) == dresp.hdr.payload_size);
+    /* the block id is correct. */
+    TEST_EXPECT(
+        0 == memcmp(dresp.block_id, EXPECTED_BLOCK_ID, sizeof(dresp.block_id)));
+}
+
 /**
  * Test that we check for sizes when decoding.
  */
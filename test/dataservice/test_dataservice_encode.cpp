@@ -298,6 +298,220 @@ TEST(request_block_id_by_height_get_decoded)
     dispose((disposable_t*)&alloc_opts);
 }
 
+/**
+ * Test that the encode function performs parameter checks.
+ */
+TEST(request_block_id_next_get)
+{
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+    const uint32_t child = 0x1234;
+    const rcpr_uuid block_id = { .data = {
+        0x8a, 0x47, 0x2e, 0x19, 0x63, 0x5b, 0x4d, 0x0c,
+        0xb2, 0x71, 0x9f, 0x3e, 0xd4, 0x06, 0xa8, 0x5d } };
+
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* a NULL buffer is invalid. */
+    TEST_EXPECT(
+        AGENTD_ERROR_DATASERVICE_INVALID_PARAMETER
+            == dataservice_encode_request_block_id_next_get(
+                    nullptr, &alloc_opts, child, &block_id));
+
+    /* a NULL allocator is invalid. */
+    TEST_EXPECT(
+        AGENTD_ERROR_DATASERVICE_INVALID_PARAMETER
+            == dataservice_encode_request_block_id_next_get(
+                    &buffer, nullptr, child, &block_id));
+
+    /* a NULL block id is invalid. */
+    TEST_EXPECT(
+        AGENTD_ERROR_DATASERVICE_INVALID_PARAMETER
+            == dataservice_encode_request_block_id_next_get(
+                    &buffer, &alloc_opts, child, nullptr));
+
+    /* clean up. */
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * Test that the decoded values match the encoded values.
+ */
+TEST(request_block_id_next_get_decoded)
+{
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+    dataservice_request_block_id_link_read_t req;
+    const uint32_t child = 0x1234;
+    const rcpr_uuid block_id = { .data = {
+        0x8a, 0x47, 0x2e, 0x19, 0x63, 0x5b, 0x4d, 0x0c,
+        0xb2, 0x71, 0x9f, 0x3e, 0xd4, 0x06, 0xa8, 0x5d } };
+
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* the encode call should succeed. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == dataservice_encode_request_block_id_next_get(
+                    &buffer, &alloc_opts, child, &block_id));
+
+    /* make working with the request more convenient. */
+    const uint8_t* breq = (const uint8_t*)buffer.data;
+
+    /* the payload should be at least large enough for the method. */
+    TEST_ASSERT(buffer.size >= sizeof(uint32_t));
+
+    /* get the method. */
+    uint32_t nmethod = 0U;
+    memcpy(&nmethod, breq, sizeof(uint32_t));
+    uint32_t method = htonl(nmethod);
+
+    /* method should be DATASERVICE_API_METHOD_APP_BLOCK_ID_NEXT_READ */
+    TEST_ASSERT(DATASERVICE_API_METHOD_APP_BLOCK_ID_NEXT_READ == method);
+
+    /* increment breq past command. */
+    breq += sizeof(uint32_t);
+
+    /* derive the payload size. */
+    size_t payload_size = buffer.size - sizeof(uint32_t);
+
+    /* the decode should succeed. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == dataservice_decode_request_block_id_link_read(
+                    breq, payload_size, &req));
+
+    /* the child index should match. */
+    TEST_EXPECT(child == req.hdr.child_index);
+
+    /* the block id should match. */
+    TEST_EXPECT(0 == memcmp(&block_id, req.id, sizeof(req.id)));
+
+    /* clean up. */
+    dispose((disposable_t*)&buffer);
+    dispose((disposable_t*)&req);
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * Test that the decoded values match the encoded values.
+ */
+TEST(request_block_id_prev_get_decoded)
+{
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+    dataservice_request_block_id_link_read_t req;
+    const uint32_t child = 0x1234;
+    const rcpr_uuid block_id = { .data = {
+        0x1e, 0xc9, 0x54, 0x7a, 0x02, 0xbf, 0x43, 0x96,
+        0x85, 0x3d, 0x6c, 0xe1, 0x70, 0x2a, 0x9b, 0x48 } };
+
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* the encode call should succeed. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == dataservice_encode_request_block_id_prev_get(
+                    &buffer, &alloc_opts, child, &block_id));
+
+    /* make working with the request more convenient. */
+    const uint8_t* breq = (const uint8_t*)buffer.data;
+
+    /* the payload should be at least large enough for the method. */
+    TEST_ASSERT(buffer.size >= sizeof(uint32_t));
+
+    /* get the method. */
+    uint32_t nmethod = 0U;
+    memcpy(&nmethod, breq, sizeof(uint32_t));
+    uint32_t method = htonl(nmethod);
+
+    /* method should be DATASERVICE_API_METHOD_APP_BLOCK_ID_PREV_READ */
+    TEST_ASSERT(DATASERVICE_API_METHOD_APP_BLOCK_ID_PREV_READ == method);
+
+    /* increment breq past command. */
+    breq += sizeof(uint32_t);
+
+    /* derive the payload size. */
+    size_t payload_size = buffer.size - sizeof(uint32_t);
+
+    /* the decode should succeed. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == dataservice_decode_request_block_id_link_read(
+                    breq, payload_size, &req));
+
+    /* the child index should match. */
+    TEST_EXPECT(child == req.hdr.child_index);
+
+    /* the block id should match. */
+    TEST_EXPECT(0 == memcmp(&block_id, req.id, sizeof(req.id)));
+
+    /* clean up. */
+    dispose((disposable_t*)&buffer);
+    dispose((disposable_t*)&req);
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * Test that the decoded values match the encoded values.
+ */
+TEST(request_block_id_with_transaction_get_decoded)
+{
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+    dataservice_request_block_id_link_read_t req;
+    const uint32_t child = 0x1234;
+    const rcpr_uuid txn_id = { .data = {
+        0x64, 0xd2, 0x0b, 0x8e, 0x3f, 0xa1, 0x47, 0x15,
+        0x9c, 0x58, 0xe7, 0x2d, 0x16, 0xb3, 0x40, 0xfa } };
+
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* the encode call should succeed. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == dataservice_encode_request_block_id_with_transaction_get(
+                    &buffer, &alloc_opts, child, &txn_id));
+
+    /* make working with the request more convenient. */
+    const uint8_t* breq = (const uint8_t*)buffer.data;
+
+    /* the payload should be at least large enough for the method. */
+    TEST_ASSERT(buffer.size >= sizeof(uint32_t));
+
+    /* get the method. */
+    uint32_t nmethod = 0U;
+    memcpy(&nmethod, breq, sizeof(uint32_t));
+    uint32_t method = htonl(nmethod);
+
+    /* method should be the block id with transaction read method. */
+    TEST_ASSERT(
+        DATASERVICE_API_METHOD_APP_BLOCK_ID_WITH_TRANSACTION_READ == method);
+
+    /* increment breq past command. */
+    breq += sizeof(uint32_t);
+
+    /* derive the payload size. */
+    size_t payload_size = buffer.size - sizeof(uint32_t);
+
+    /* the decode should succeed. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == dataservice_decode_request_block_id_link_read(
+                    breq, payload_size, &req));
+
+    /* the child index should match. */
+    TEST_EXPECT(child == req.hdr.child_index);
+
+    /* the transaction id should match. */
+    TEST_EXPECT(0 == memcmp(&txn_id, req.id, sizeof(req.id)));
+
+    /* clean up. */
+    dispose((disposable_t*)&buffer);
+    dispose((disposable_t*)&req);
+    dispose((disposable_t*)&alloc_opts);
+}
+
 /**
  * Test that the encode function performs parameter checks.
  */
@@ -962,19 +1176,19 @@ TEST(request_root_context_init)
     TEST_EXPECT(
         AGENTD_ERROR_DATASERVICE_INVALID_PARAMETER
             == dataservice_encode_request_root_context_init(
-                    nullptr, &alloc_opts, max_database_size, datadir));
+                    nullptr, &alloc_opts, max_database_size, 0U, 0U, datadir));
 
     /* a NULL allocator is invalid. */
     TEST_EXPECT(
         AGENTD_ERROR_DATASERVICE_INVALID_PARAMETER
             == dataservice_encode_request_root_context_init(
-                    &buffer, nullptr, max_database_size, datadir));
+                    &buffer, nullptr, max_database_size, 0U, 0U, datadir));
 
     /* a NULL data directory is invalid. */
     TEST_EXPECT(
         AGENTD_ERROR_DATASERVICE_INVALID_PARAMETER
             == dataservice_encode_request_root_context_init(
-                    &buffer, &alloc_opts, max_database_size, nullptr));
+                    &buffer, &alloc_opts, max_database_size, 0U, 0U, nullptr));
 
     /* clean up. */
     dispose((disposable_t*)&alloc_opts);
@@ -988,6 +1202,8 @@ TEST(request_root_context_init_decoded)
     allocator_options_t alloc_opts;
     vccrypt_buffer_t buffer;
     uint64_t max_database_size = 10 * 1024 * 1024;
+    uint32_t datastore_flags = DATASTORE_FLAG_NORDAHEAD;
+    uint32_t max_readers = 256;
     const char* datadir = "/data";
     dataservice_request_payload_root_context_init_t req;
 
@@ -997,7 +1213,8 @@ TEST(request_root_context_init_decoded)
     TEST_ASSERT(
         STATUS_SUCCESS
             == dataservice_encode_request_root_context_init(
-                    &buffer, &alloc_opts, max_database_size, datadir));
+                    &buffer, &alloc_opts, max_database_size, datastore_flags,
+                    max_readers, datadir));
 
     /* make working with the request more convenient. */
     const uint8_t* breq = (const uint8_t*)buffer.data;
@@ -1028,6 +1245,12 @@ TEST(request_root_context_init_decoded)
     /* the max database size should match. */
     TEST_EXPECT(max_database_size == req.max_database_size);
 
+    /* the datastore flags should match. */
+    TEST_EXPECT(datastore_flags == req.datastore_flags);
+
+    /* the max readers should match. */
+    TEST_EXPECT(max_readers == req.max_readers);
+
     /* the data dir string should match. */
     TEST_EXPECT(!strcmp(datadir, req.datadir));
 
@@ -1315,6 +1538,552 @@ TEST(request_transaction_get_decoded)
     dispose((disposable_t*)&alloc_opts);
 }
 
+/**
+ * Test that the encode function performs parameter checks.
+ */
+TEST(request_transaction_list_get)
+{
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+    rcpr_uuid txn_id = { .data = {
+        0x26, 0xdb, 0x11, 0x43, 0x69, 0x99, 0x48, 0x49,
+        0xaf, 0x3a, 0xd8, 0xc6, 0x83, 0x36, 0x85, 0xb9 } };
+    const uint32_t child = 0x1234;
+
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* a NULL buffer is invalid. */
+    TEST_EXPECT(
+        AGENTD_ERROR_DATASERVICE_INVALID_PARAMETER
+            == dataservice_encode_request_transaction_list_get(
+                    nullptr, &alloc_opts, child, &txn_id, 10));
+
+    /* a NULL allocator is invalid. */
+    TEST_EXPECT(
+        AGENTD_ERROR_DATASERVICE_INVALID_PARAMETER
+            == dataservice_encode_request_transaction_list_get(
+                    &buffer, nullptr, child, &txn_id, 10));
+
+    /* a NULL transaction id is invalid. */
+    TEST_EXPECT(
+        AGENTD_ERROR_DATASERVICE_INVALID_PARAMETER
+            == dataservice_encode_request_transaction_list_get(
+                    &buffer, &alloc_opts, child, nullptr, 10));
+
+    /* clean up. */
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * Test that the decoded values match the encoded values.
+ */
+TEST(request_transaction_list_get_decoded)
+{
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+    dataservice_request_transaction_list_get_t req;
+    rcpr_uuid txn_id = { .data = {
+        0x26, 0xdb, 0x11, 0x43, 0x69, 0x99, 0x48, 0x49,
+        0xaf, 0x3a, 0xd8, 0xc6, 0x83, 0x36, 0x85, 0xb9 } };
+    const uint32_t child = 0x1234;
+    const uint32_t max_count = 0x10203;
+
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* the encode call should succeed. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == dataservice_encode_request_transaction_list_get(
+                    &buffer, &alloc_opts, child, &txn_id, max_count));
+
+    /* make working with the request more convenient. */
+    const uint8_t* breq = (const uint8_t*)buffer.data;
+
+    /* the payload should be at least large enough for the method. */
+    TEST_ASSERT(buffer.size >= sizeof(uint32_t));
+
+    /* get the method. */
+    uint32_t nmethod = 0U;
+    memcpy(&nmethod, breq, sizeof(uint32_t));
+    uint32_t method = htonl(nmethod);
+
+    /* the method should be the transaction list read method. */
+    TEST_ASSERT(DATASERVICE_API_METHOD_APP_PQ_TRANSACTION_LIST_READ == method);
+
+    /* increment breq past command. */
+    breq += sizeof(uint32_t);
+
+    /* derive the payload size. */
+    size_t payload_size = buffer.size - sizeof(uint32_t);
+
+    /* the decode should succeed. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == dataservice_decode_request_transaction_list_get(
+                    breq, payload_size, &req));
+
+    /* the child index should match. */
+    TEST_EXPECT(child == req.hdr.child_index);
+
+    /* the txn id should match. */
+    TEST_EXPECT(0 == memcmp(req.txn_id, &txn_id, 16));
+
+    /* the max count should match. */
+    TEST_EXPECT(max_count == req.max_count);
+
+    /* clean up. */
+    dispose((disposable_t*)&buffer);
+    dispose((disposable_t*)&req);
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * Test that the encode function performs parameter checks.
+ */
+TEST(request_block_range_get)
+{
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+    const uint32_t child = 0x1234;
+
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* a NULL buffer is invalid. */
+    TEST_EXPECT(
+        AGENTD_ERROR_DATASERVICE_INVALID_PARAMETER
+            == dataservice_encode_request_block_range_get(
+                    nullptr, &alloc_opts, child, 1, 10, 1024));
+
+    /* a NULL allocator is invalid. */
+    TEST_EXPECT(
+        AGENTD_ERROR_DATASERVICE_INVALID_PARAMETER
+            == dataservice_encode_request_block_range_get(
+                    &buffer, nullptr, child, 1, 10, 1024));
+
+    /* clean up. */
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * Test that the decoded values match the encoded values.
+ */
+TEST(request_block_range_get_decoded)
+{
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+    dataservice_request_block_range_get_t req;
+    const uint32_t child = 0x1234;
+    const uint64_t start_height = 0x0102030405060708ULL;
+    const uint32_t max_count = 0x10203;
+    const uint32_t max_bytes = 0x40506;
+
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* the encode call should succeed. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == dataservice_encode_request_block_range_get(
+                    &buffer, &alloc_opts, child, start_height, max_count,
+                    max_bytes));
+
+    /* make working with the request more convenient. */
+    const uint8_t* breq = (const uint8_t*)buffer.data;
+
+    /* the payload should be at least large enough for the method. */
+    TEST_ASSERT(buffer.size >= sizeof(uint32_t));
+
+    /* get the method. */
+    uint32_t nmethod = 0U;
+    memcpy(&nmethod, breq, sizeof(uint32_t));
+    uint32_t method = htonl(nmethod);
+
+    /* the method should be the block range read method. */
+    TEST_ASSERT(DATASERVICE_API_METHOD_APP_BLOCK_RANGE_READ == method);
+
+    /* increment breq past command. */
+    breq += sizeof(uint32_t);
+
+    /* derive the payload size. */
+    size_t payload_size = buffer.size - sizeof(uint32_t);
+
+    /* a truncated request is invalid. */
+    TEST_EXPECT(
+        AGENTD_ERROR_DATASERVICE_REQUEST_PACKET_INVALID_SIZE
+            == dataservice_decode_request_block_range_get(
+                    breq, payload_size - 1, &req));
+
+    /* the decode should succeed. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == dataservice_decode_request_block_range_get(
+                    breq, payload_size, &req));
+
+    /* the child index should match. */
+    TEST_EXPECT(child == req.hdr.child_index);
+
+    /* the start height should match. */
+    TEST_EXPECT(start_height == req.start_height);
+
+    /* the max count should match. */
+    TEST_EXPECT(max_count == req.max_count);
+
+    /* the max bytes should match. */
+    TEST_EXPECT(max_bytes == req.max_bytes);
+
+    /* clean up. */
+    dispose((disposable_t*)&buffer);
+    dispose((disposable_t*)&req);
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * Test that the encode function performs parameter checks.
+ */
+TEST(request_artifact_transaction_list_get)
+{
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+    const uint32_t child = 0x1234;
+    const rcpr_uuid artifact_id = { .data = {
+        0x3f, 0x6c, 0x2a, 0x19, 0x84, 0x05, 0x4b, 0x1e,
+        0x9d, 0x02, 0x71, 0xa8, 0x44, 0xe0, 0x5c, 0x33 } };
+
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* a NULL buffer is invalid. */
+    TEST_EXPECT(
+        AGENTD_ERROR_DATASERVICE_INVALID_PARAMETER
+            == dataservice_encode_request_artifact_transaction_list_get(
+                    nullptr, &alloc_opts, child, &artifact_id, 1, 0, 10));
+
+    /* a NULL allocator is invalid. */
+    TEST_EXPECT(
+        AGENTD_ERROR_DATASERVICE_INVALID_PARAMETER
+            == dataservice_encode_request_artifact_transaction_list_get(
+                    &buffer, nullptr, child, &artifact_id, 1, 0, 10));
+
+    /* a NULL artifact id is invalid. */
+    TEST_EXPECT(
+        AGENTD_ERROR_DATASERVICE_INVALID_PARAMETER
+            == dataservice_encode_request_artifact_transaction_list_get(
+                    &buffer, &alloc_opts, child, nullptr, 1, 0, 10));
+
+    /* clean up. */
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * Test that the decoded values match the encoded values.
+ */
+TEST(request_artifact_transaction_list_get_decoded)
+{
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+    dataservice_request_artifact_transaction_list_get_t req;
+    const uint32_t child = 0x1234;
+    const rcpr_uuid artifact_id = { .data = {
+        0x3f, 0x6c, 0x2a, 0x19, 0x84, 0x05, 0x4b, 0x1e,
+        0x9d, 0x02, 0x71, 0xa8, 0x44, 0xe0, 0x5c, 0x33 } };
+    const uint64_t start_height = 0x0102030405060708ULL;
+    const uint32_t start_index = 0x70605;
+    const uint32_t max_count = 0x10203;
+
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* the encode call should succeed. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == dataservice_encode_request_artifact_transaction_list_get(
+                    &buffer, &alloc_opts, child, &artifact_id, start_height,
+                    start_index, max_count));
+
+    /* make working with the request more convenient. */
+    const uint8_t* breq = (const uint8_t*)buffer.data;
+
+    /* the payload should be at least large enough for the method. */
+    TEST_ASSERT(buffer.size >= sizeof(uint32_t));
+
+    /* get the method. */
+    uint32_t nmethod = 0U;
+    memcpy(&nmethod, breq, sizeof(uint32_t));
+    uint32_t method = htonl(nmethod);
+
+    /* the method should be the artifact transaction list read method. */
+    TEST_ASSERT(
+        DATASERVICE_API_METHOD_APP_ARTIFACT_TRANSACTION_LIST_READ == method);
+
+    /* increment breq past command. */
+    breq += sizeof(uint32_t);
+
+    /* derive the payload size. */
+    size_t payload_size = buffer.size - sizeof(uint32_t);
+
+    /* a truncated request is invalid. */
+    TEST_EXPECT(
+        AGENTD_ERROR_DATASERVICE_REQUEST_PACKET_INVALID_SIZE
+            == dataservice_decode_request_artifact_transaction_list_get(
+                    breq, payload_size - 1, &req));
+
+    /* the decode should succeed. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == dataservice_decode_request_artifact_transaction_list_get(
+                    breq, payload_size, &req));
+
+    /* the child index should match. */
+    TEST_EXPECT(child == req.hdr.child_index);
+
+    /* the artifact id should match. */
+    TEST_EXPECT(
+        0 == memcmp(&artifact_id, req.artifact_id, sizeof(req.artifact_id)));
+
+    /* the start height should match. */
+    TEST_EXPECT(start_height == req.start_height);
+
+    /* the start index should match. */
+    TEST_EXPECT(start_index == req.start_index);
+
+    /* the max count should match. */
+    TEST_EXPECT(max_count == req.max_count);
+
+    /* clean up. */
+    dispose((disposable_t*)&buffer);
+    dispose((disposable_t*)&req);
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * Test that the encode function performs parameter checks.
+ */
+TEST(request_transaction_batch_update)
+{
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+    const uint32_t child = 0x1234;
+    const data_transaction_batch_update_entry_t entries[1] = {
+        { { 0x3f, 0x6c, 0x2a, 0x19, 0x84, 0x05, 0x4b, 0x1e,
+            0x9d, 0x02, 0x71, 0xa8, 0x44, 0xe0, 0x5c, 0x33 },
+          DATASERVICE_TRANSACTION_BATCH_ACTION_PROMOTE } };
+
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* a NULL buffer is invalid. */
+    TEST_EXPECT(
+        AGENTD_ERROR_DATASERVICE_INVALID_PARAMETER
+            == dataservice_encode_request_transaction_batch_update(
+                    nullptr, &alloc_opts, child, entries, 1));
+
+    /* a NULL allocator is invalid. */
+    TEST_EXPECT(
+        AGENTD_ERROR_DATASERVICE_INVALID_PARAMETER
+            == dataservice_encode_request_transaction_batch_update(
+                    &buffer, nullptr, child, entries, 1));
+
+    /* a NULL entries array is invalid. */
+    TEST_EXPECT(
+        AGENTD_ERROR_DATASERVICE_INVALID_PARAMETER
+            == dataservice_encode_request_transaction_batch_update(
+                    &buffer, &alloc_opts, child, nullptr, 1));
+
+    /* an empty batch is invalid. */
+    TEST_EXPECT(
+        AGENTD_ERROR_DATASERVICE_INVALID_PARAMETER
+            == dataservice_encode_request_transaction_batch_update(
+                    &buffer, &alloc_opts, child, entries, 0));
+
+    /* clean up. */
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * Test that the decoded values match the encoded values.
+ */
+TEST(request_transaction_batch_update_decoded)
+{
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+    dataservice_request_transaction_batch_update_t req;
+    const uint32_t child = 0x1234;
+    const data_transaction_batch_update_entry_t entries[2] = {
+        { { 0x3f, 0x6c, 0x2a, 0x19, 0x84, 0x05, 0x4b, 0x1e,
+            0x9d, 0x02, 0x71, 0xa8, 0x44, 0xe0, 0x5c, 0x33 },
+          DATASERVICE_TRANSACTION_BATCH_ACTION_PROMOTE },
+        { { 0xf5, 0x17, 0xda, 0x53, 0xcb, 0x26, 0x45, 0x45,
+            0xaa, 0x62, 0x8f, 0x2b, 0x7f, 0x16, 0xfb, 0x7c },
+          DATASERVICE_TRANSACTION_BATCH_ACTION_DROP } };
+
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* the encode call should succeed. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == dataservice_encode_request_transaction_batch_update(
+                    &buffer, &alloc_opts, child, entries, 2));
+
+    /* make working with the request more convenient. */
+    const uint8_t* breq = (const uint8_t*)buffer.data;
+
+    /* the payload should be at least large enough for the method. */
+    TEST_ASSERT(buffer.size >= sizeof(uint32_t));
+
+    /* get the method. */
+    uint32_t nmethod = 0U;
+    memcpy(&nmethod, breq, sizeof(uint32_t));
+    uint32_t method = htonl(nmethod);
+
+    /* the method should be the transaction batch update method. */
+    TEST_ASSERT(
+        DATASERVICE_API_METHOD_APP_PQ_TRANSACTION_BATCH_UPDATE == method);
+
+    /* increment breq past command. */
+    breq += sizeof(uint32_t);
+
+    /* derive the payload size. */
+    size_t payload_size = buffer.size - sizeof(uint32_t);
+
+    /* a truncated request is invalid. */
+    TEST_EXPECT(
+        AGENTD_ERROR_DATASERVICE_REQUEST_PACKET_INVALID_SIZE
+            == dataservice_decode_request_transaction_batch_update(
+                    breq, payload_size - 1, &req));
+
+    /* a request without entries is invalid. */
+    TEST_EXPECT(
+        AGENTD_ERROR_DATASERVICE_REQUEST_PACKET_INVALID_SIZE
+            == dataservice_decode_request_transaction_batch_update(
+                    breq, sizeof(uint32_t), &req));
+
+    /* the decode should succeed. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == dataservice_decode_request_transaction_batch_update(
+                    breq, payload_size, &req));
+
+    /* the child index should match. */
+    TEST_EXPECT(child == req.hdr.child_index);
+
+    /* there should be two entries. */
+    TEST_ASSERT(2U == req.count);
+
+    /* each entry should match. */
+    const uint8_t* in = req.entries;
+    for (size_t i = 0; i < 2; ++i)
+    {
+        uint32_t naction = 0U;
+        memcpy(&naction, in + 16, sizeof(naction));
+
+        TEST_EXPECT(0 == memcmp(entries[i].txn_id, in, 16));
+        TEST_EXPECT(entries[i].action == ntohl(naction));
+
+        in += DATASERVICE_TRANSACTION_BATCH_UPDATE_ENTRY_SIZE;
+    }
+
+    /* clean up. */
+    dispose((disposable_t*)&buffer);
+    dispose((disposable_t*)&req);
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * Test that the encode function performs parameter checks.
+ */
+TEST(request_id_exists)
+{
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+    rcpr_uuid id = { .data = {
+        0x32, 0x64, 0x56, 0xe9, 0x8c, 0x37, 0x4a, 0x4b,
+        0x9a, 0x91, 0x98, 0xc1, 0x60, 0x12, 0x9a, 0x97 } };
+    const uint32_t child = 0x1234;
+
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* a NULL buffer is invalid. */
+    TEST_EXPECT(
+        AGENTD_ERROR_DATASERVICE_INVALID_PARAMETER
+            == dataservice_encode_request_id_exists(
+                    nullptr, &alloc_opts, child, &id));
+
+    /* a NULL allocator is invalid. */
+    TEST_EXPECT(
+        AGENTD_ERROR_DATASERVICE_INVALID_PARAMETER
+            == dataservice_encode_request_id_exists(
+                    &buffer, nullptr, child, &id));
+
+    /* a NULL id is invalid. */
+    TEST_EXPECT(
+        AGENTD_ERROR_DATASERVICE_INVALID_PARAMETER
+            == dataservice_encode_request_id_exists(
+                    &buffer, &alloc_opts, child, nullptr));
+
+    /* clean up. */
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * Test that the decoded values match the encoded values.
+ */
+TEST(request_id_exists_decoded)
+{
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+    dataservice_request_id_exists_t req;
+    rcpr_uuid id = { .data = {
+        0x32, 0x64, 0x56, 0xe9, 0x8c, 0x37, 0x4a, 0x4b,
+        0x9a, 0x91, 0x98, 0xc1, 0x60, 0x12, 0x9a, 0x97 } };
+    const uint32_t child = 0x1234;
+
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* the encode call should succeed. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == dataservice_encode_request_id_exists(
+                    &buffer, &alloc_opts, child, &id));
+
+    /* make working with the request more convenient. */
+    const uint8_t* breq = (const uint8_t*)buffer.data;
+
+    /* the payload should be at least large enough for the method. */
+    TEST_ASSERT(buffer.size >= sizeof(uint32_t));
+
+    /* get the method. */
+    uint32_t nmethod = 0U;
+    memcpy(&nmethod, breq, sizeof(uint32_t));
+    uint32_t method = htonl(nmethod);
+
+    /* the method should be DATASERVICE_API_METHOD_APP_ID_EXISTS_READ */
+    TEST_ASSERT(DATASERVICE_API_METHOD_APP_ID_EXISTS_READ == method);
+
+    /* increment breq past command. */
+    breq += sizeof(uint32_t);
+
+    /* derive the payload size. */
+    size_t payload_size = buffer.size - sizeof(uint32_t);
+
+    /* the decode should succeed. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == dataservice_decode_request_id_exists(
+                    breq, payload_size, &req));
+
+    /* the child index should match. */
+    TEST_EXPECT(child == req.hdr.child_index);
+
+    /* the id should match. */
+    TEST_EXPECT(0 == memcmp(req.id, &id, 16));
+
+    /* a truncated request is invalid. */
+    TEST_EXPECT(
+        AGENTD_ERROR_DATASERVICE_REQUEST_PACKET_INVALID_SIZE
+            == dataservice_decode_request_id_exists(
+                    breq, payload_size - 1, &req));
+
+    /* clean up. */
+    dispose((disposable_t*)&buffer);
+    dispose((disposable_t*)&alloc_opts);
+}
+
 /**
  * Test that the encode function performs parameter checks.
  */
@@ -9,6 +9,8 @@
 #include <vccert/fields.h>
 #include <vccert/certificate_types.h>
 
+#include <vector>
+
 #include "test_dataservice.h"
 
 using namespace std;
@@ -204,6 +206,38 @@ int create_dummy_block(
     const uint8_t* block_uuid, const uint8_t* prev_block_uuid,
     uint64_t block_height,
     uint8_t** block_cert, size_t* block_cert_length, ...)
+{
+    vector<const uint8_t*> txns;
+    vector<size_t> txn_sizes;
+    va_list txn_list;
+
+    va_start(txn_list, block_cert_length);
+    for (;;)
+    {
+        const uint8_t* txn = va_arg(txn_list, const uint8_t*);
+        size_t txn_size = va_arg(txn_list, size_t);
+
+        if (txn == NULL)
+            break;
+
+        txns.push_back(txn);
+        txn_sizes.push_back(txn_size);
+    }
+    va_end(txn_list);
+
+    return
+        create_dummy_block_list(
+            builder_opts, block_uuid, prev_block_uuid, block_height,
+            block_cert, block_cert_length, txns.data(), txn_sizes.data(),
+            txns.size());
+}
+
+int create_dummy_block_list(
+    vccert_builder_options_t* builder_opts,
+    const uint8_t* block_uuid, const uint8_t* prev_block_uuid,
+    uint64_t block_height,
+    uint8_t** block_cert, size_t* block_cert_length,
+    const uint8_t* const* txns, const size_t* txn_sizes, size_t txn_count)
 {
     vccert_builder_context_t builder;
     int retval = 0;
@@ -271,24 +305,15 @@ int create_dummy_block(
         goto dispose_builder;
     }
 
-    va_list txn_list;
-
-    va_start(txn_list, block_cert_length);
-    for (;;)
+    for (size_t i = 0; i < txn_count; ++i)
     {
-        const uint8_t* txn = va_arg(txn_list, const uint8_t*);
-        size_t txn_size = va_arg(txn_list, size_t);
-
-        if (txn == NULL)
-            break;
-
         retval = vccert_builder_add_short_buffer(
-            &builder, VCCERT_FIELD_TYPE_WRAPPED_TRANSACTION_TUPLE, txn,
-            txn_size);
+            &builder, VCCERT_FIELD_TYPE_WRAPPED_TRANSACTION_TUPLE, txns[i],
+            txn_sizes[i]);
         if (VCCERT_STATUS_SUCCESS != retval)
         {
             retval = 8;
-            goto dispose_txnlist;
+            goto dispose_builder;
         }
     }
 
@@ -302,7 +327,7 @@ int create_dummy_block(
     if (NULL == *block_cert)
     {
         retval = 8;
-        goto dispose_txnlist;
+        goto dispose_builder;
     }
 
     /* copy the certificate data into the certificate buffer. */
@@ -312,9 +337,6 @@ int create_dummy_block(
     /* success. */
     retval = 0;
 
-dispose_txnlist:
-    va_end(txn_list);
-
 dispose_builder:
     dispose((disposable_t*)&builder);
 
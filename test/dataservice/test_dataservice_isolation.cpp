@@ -58,7 +58,7 @@ BEGIN_TEST_F(create_root_block_blocking)
         0
             == dataservice_api_sendreq_root_context_init_block(
                     fixture.datasock, &fixture.alloc_opts,
-                    DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
     TEST_ASSERT(
         0
             == dataservice_api_recvresp_root_context_init_block(
@@ -84,7 +84,7 @@ BEGIN_TEST_F(reduce_root_caps_blocking)
         0
             == dataservice_api_sendreq_root_context_init_block(
                     fixture.datasock, &fixture.alloc_opts,
-                    DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
     TEST_ASSERT(
         0
             == dataservice_api_recvresp_root_context_init_block(
@@ -171,7 +171,7 @@ BEGIN_TEST_F(create_root_block)
         0
             == dataservice_api_sendreq_root_context_init(
                     fixture.datapsock, &fixture.alloc_opts,
-                    DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
 
     /* we should be able to receive the response from this request. */
     TEST_ASSERT(
@@ -221,7 +221,7 @@ BEGIN_TEST_F(create_root_block_old)
                 sendreq_status =
                     dataservice_api_sendreq_root_context_init_old(
                         &fixture.nonblockdatasock, &fixture.alloc_opts,
-                        DEFAULT_DATABASE_SIZE, DB_PATH.c_str());
+                        DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str());
             }
         });
 
@@ -251,7 +251,7 @@ BEGIN_TEST_F(reduce_root_caps)
         0
             == dataservice_api_sendreq_root_context_init(
                     fixture.datapsock, &fixture.alloc_opts,
-                    DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
     TEST_ASSERT(
         0
             == dataservice_api_recvresp_root_context_init(
@@ -359,7 +359,7 @@ BEGIN_TEST_F(reduce_root_caps_old)
                 sendreq_status =
                     dataservice_api_sendreq_root_context_init_old(
                         &fixture.nonblockdatasock, &fixture.alloc_opts,
-                        DEFAULT_DATABASE_SIZE, DB_PATH.c_str());
+                        DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str());
             }
         });
 
@@ -507,7 +507,7 @@ BEGIN_TEST_F(child_context_create_close_blocking)
         0
             == dataservice_api_sendreq_root_context_init_block(
                     fixture.datasock, &fixture.alloc_opts,
-                    DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
     TEST_ASSERT(
         0
             == dataservice_api_recvresp_root_context_init_block(
@@ -590,7 +590,7 @@ BEGIN_TEST_F(child_context_create_close)
         0
             == dataservice_api_sendreq_root_context_init(
                     fixture.datapsock, &fixture.alloc_opts,
-                    DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
     TEST_ASSERT(
         0
             == dataservice_api_recvresp_root_context_init(
@@ -677,7 +677,7 @@ BEGIN_TEST_F(child_context_create_close_old)
                 sendreq_status =
                     dataservice_api_sendreq_root_context_init_old(
                         &fixture.nonblockdatasock, &fixture.alloc_opts,
-                        DEFAULT_DATABASE_SIZE, DB_PATH.c_str());
+                        DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str());
             }
         });
 
@@ -788,7 +788,7 @@ BEGIN_TEST_F(global_setting_not_found)
         0
             == dataservice_api_sendreq_root_context_init(
                     fixture.datapsock, &fixture.alloc_opts,
-                    DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
     TEST_ASSERT(
         0
             == dataservice_api_recvresp_root_context_init(
@@ -882,7 +882,7 @@ BEGIN_TEST_F(global_setting_not_found_old)
                 sendreq_status =
                     dataservice_api_sendreq_root_context_init_old(
                         &fixture.nonblockdatasock, &fixture.alloc_opts,
-                        DEFAULT_DATABASE_SIZE, DB_PATH.c_str());
+                        DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str());
             }
         });
 
@@ -995,7 +995,7 @@ BEGIN_TEST_F(global_setting_set_get_blocking)
         0
             == dataservice_api_sendreq_root_context_init_block(
                     fixture.datasock, &fixture.alloc_opts,
-                    DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
     TEST_ASSERT(
         0
             == dataservice_api_recvresp_root_context_init_block(
@@ -1105,7 +1105,7 @@ BEGIN_TEST_F(global_setting_set_get)
         0
             == dataservice_api_sendreq_root_context_init(
                     fixture.datapsock, &fixture.alloc_opts,
-                    DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
     TEST_ASSERT(
         0
             == dataservice_api_recvresp_root_context_init(
@@ -1222,7 +1222,7 @@ BEGIN_TEST_F(global_setting_set_get_old)
                 sendreq_status =
                     dataservice_api_sendreq_root_context_init_old(
                         &fixture.nonblockdatasock, &fixture.alloc_opts,
-                        DEFAULT_DATABASE_SIZE, DB_PATH.c_str());
+                        DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str());
             }
         });
 
@@ -1386,7 +1386,7 @@ BEGIN_TEST_F(txn_submit_get_first)
         0
             == dataservice_api_sendreq_root_context_init(
                     fixture.datapsock, &fixture.alloc_opts,
-                    DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
     TEST_ASSERT(
         0
             == dataservice_api_recvresp_root_context_init(
@@ -1496,6 +1496,148 @@ BEGIN_TEST_F(txn_submit_get_first)
     free(txn_data);
 END_TEST_F()
 
+/**
+ * Test that transaction submissions sent back-to-back are each answered in
+ * order, that a failed submission does not discard the others, and that a
+ * subsequent read sees the submitted transactions.
+ */
+BEGIN_TEST_F(txn_submit_pipelined_get_first)
+    uint32_t offset;
+    uint32_t status;
+    uint32_t child_context;
+    string DB_PATH;
+
+    /* we are using psock for this. */
+    TEST_ASSERT(0 == fixture.use_psock());
+
+    /* create the directory for this test. */
+    TEST_ASSERT(0 == fixture.createDirectoryName(__COUNTER__, DB_PATH));
+
+    /* Run the send / receive on creating the root context. */
+    TEST_ASSERT(
+        0
+            == dataservice_api_sendreq_root_context_init(
+                    fixture.datapsock, &fixture.alloc_opts,
+                    DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
+    TEST_ASSERT(
+        0
+            == dataservice_api_recvresp_root_context_init(
+                    fixture.datapsock, fixture.alloc, &offset, &status));
+
+    /* verify that everything ran correctly. */
+    TEST_EXPECT(0U == offset);
+    TEST_EXPECT(0U == status);
+
+    /* create a reduced capabilities set for the child context. */
+    BITCAP(reducedcaps, DATASERVICE_API_CAP_BITS_MAX);
+    BITCAP_INIT_FALSE(reducedcaps);
+
+    /* explicitly grant submitting and getting the first transaction. */
+    BITCAP_SET_TRUE(reducedcaps,
+        DATASERVICE_API_CAP_APP_PQ_TRANSACTION_SUBMIT);
+    BITCAP_SET_TRUE(reducedcaps,
+        DATASERVICE_API_CAP_APP_PQ_TRANSACTION_FIRST_READ);
+
+    /* create child context. */
+    TEST_ASSERT(
+        0
+            == dataservice_api_sendreq_child_context_create(
+                    fixture.datapsock, &fixture.alloc_opts, reducedcaps,
+                    sizeof(reducedcaps)));
+    TEST_ASSERT(
+        0
+            == dataservice_api_recvresp_child_context_create(
+                    fixture.datapsock, fixture.alloc, &offset, &status,
+                    &child_context));
+
+    /* verify that everything ran correctly. */
+    TEST_ASSERT(0U == offset);
+    TEST_ASSERT(0U == status);
+    TEST_ASSERT(DATASERVICE_MAX_CHILD_CONTEXTS - 1U == child_context);
+
+    const uint8_t foo_key[16] = {
+        0x05, 0x09, 0x43, 0x34, 0x0f, 0xb0, 0x4a, 0xa2,
+        0xa1, 0xf2, 0x26, 0x15, 0x6a, 0x56, 0x45, 0x4d
+    };
+    const uint8_t bar_key[16] = {
+        0x9c, 0x1b, 0x2e, 0x4f, 0x76, 0x3a, 0x4d, 0x0e,
+        0x8f, 0x21, 0x5d, 0x4b, 0x0a, 0xc7, 0x13, 0x66
+    };
+    const uint8_t foo_artifact[16] = {
+        0xc3, 0x84, 0x33, 0x0b, 0xf5, 0x0d, 0x42, 0xa2,
+        0x9a, 0x52, 0xb5, 0xa4, 0xb3, 0x5b, 0xcf, 0x72
+    };
+    const uint8_t foo_data[16] = {
+        0x80, 0xfb, 0x52, 0x78, 0xa0, 0x63, 0x4a, 0xf0,
+        0x81, 0x56, 0xba, 0xab, 0xe5, 0xe0, 0x56, 0x68
+    };
+    size_t foo_data_size = sizeof(foo_data);
+
+    /* send two submissions, a duplicate submission, and a read without
+     * waiting for any of the responses. */
+    TEST_ASSERT(
+        0
+            == dataservice_api_sendreq_transaction_submit(
+                    fixture.datapsock, &fixture.alloc_opts, child_context,
+                    foo_key, foo_artifact, foo_data, foo_data_size));
+    TEST_ASSERT(
+        0
+            == dataservice_api_sendreq_transaction_submit(
+                    fixture.datapsock, &fixture.alloc_opts, child_context,
+                    bar_key, foo_artifact, foo_data, foo_data_size));
+    TEST_ASSERT(
+        0
+            == dataservice_api_sendreq_transaction_submit(
+                    fixture.datapsock, &fixture.alloc_opts, child_context,
+                    foo_key, foo_artifact, foo_data, foo_data_size));
+    TEST_ASSERT(
+        0
+            == dataservice_api_sendreq_transaction_get_first(
+                    fixture.datapsock, &fixture.alloc_opts, child_context));
+
+    /* the first two submissions succeed. */
+    TEST_ASSERT(
+        0
+            == dataservice_api_recvresp_transaction_submit(
+                    fixture.datapsock, fixture.alloc, &offset, &status));
+    TEST_ASSERT(DATASERVICE_MAX_CHILD_CONTEXTS - 1U == offset);
+    TEST_ASSERT(0U == status);
+    TEST_ASSERT(
+        0
+            == dataservice_api_recvresp_transaction_submit(
+                    fixture.datapsock, fixture.alloc, &offset, &status));
+    TEST_ASSERT(DATASERVICE_MAX_CHILD_CONTEXTS - 1U == offset);
+    TEST_ASSERT(0U == status);
+
+    /* the duplicate submission fails. */
+    TEST_ASSERT(
+        0
+            == dataservice_api_recvresp_transaction_submit(
+                    fixture.datapsock, fixture.alloc, &offset, &status));
+    TEST_ASSERT(DATASERVICE_MAX_CHILD_CONTEXTS - 1U == offset);
+    TEST_ASSERT(AGENTD_ERROR_DATASERVICE_MDB_PUT_FAILURE == status);
+
+    void* txn_data = nullptr;
+    size_t txn_data_size = 0U;
+    data_transaction_node_t node;
+
+    /* the read sees both submitted transactions. */
+    TEST_ASSERT(
+        0
+            == dataservice_api_recvresp_transaction_get_first(
+                    fixture.datapsock, fixture.alloc, &offset, &status, &node,
+                    &txn_data, &txn_data_size));
+    TEST_ASSERT(DATASERVICE_MAX_CHILD_CONTEXTS - 1U == offset);
+    TEST_ASSERT(0U == status);
+    TEST_ASSERT(txn_data_size == foo_data_size);
+    TEST_ASSERT(0 == memcmp(txn_data, foo_data, txn_data_size));
+    TEST_ASSERT(0 == memcmp(node.key, foo_key, sizeof(node.key)));
+    TEST_ASSERT(0 == memcmp(node.next, bar_key, sizeof(node.next)));
+
+    /* clean up. */
+    free(txn_data);
+END_TEST_F()
+
 /**
  * Test that we can submit a transaction and get it back from the transaction
  * queue, using the legacy API.
@@ -1534,7 +1676,7 @@ BEGIN_TEST_F(txn_submit_get_first_old)
                 sendreq_status =
                     dataservice_api_sendreq_root_context_init_old(
                         &fixture.nonblockdatasock, &fixture.alloc_opts,
-                        DEFAULT_DATABASE_SIZE, DB_PATH.c_str());
+                        DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str());
             }
         });
 
@@ -1727,7 +1869,7 @@ BEGIN_TEST_F(txn_submit_get)
         0
             == dataservice_api_sendreq_root_context_init(
                     fixture.datapsock, &fixture.alloc_opts,
-                    DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
     TEST_ASSERT(
         0
             == dataservice_api_recvresp_root_context_init(
@@ -1876,7 +2018,7 @@ BEGIN_TEST_F(txn_submit_get_old)
                 sendreq_status =
                     dataservice_api_sendreq_root_context_init_old(
                         &fixture.nonblockdatasock, &fixture.alloc_opts,
-                        DEFAULT_DATABASE_SIZE, DB_PATH.c_str());
+                        DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str());
             }
         });
 
@@ -2069,7 +2211,7 @@ BEGIN_TEST_F(txn_submit_get_drop)
         0
             == dataservice_api_sendreq_root_context_init(
                     fixture.datapsock, &fixture.alloc_opts,
-                    DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
     TEST_ASSERT(
         0
             == dataservice_api_recvresp_root_context_init(
@@ -2251,7 +2393,7 @@ BEGIN_TEST_F(txn_submit_get_drop_old)
                 sendreq_status =
                     dataservice_api_sendreq_root_context_init_old(
                         &fixture.nonblockdatasock, &fixture.alloc_opts,
-                        DEFAULT_DATABASE_SIZE, DB_PATH.c_str());
+                        DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str());
             }
         });
 
@@ -2518,7 +2660,7 @@ BEGIN_TEST_F(txn_submit_get_promote)
         0
             == dataservice_api_sendreq_root_context_init(
                     fixture.datapsock, &fixture.alloc_opts,
-                    DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
     TEST_ASSERT(
         0
             == dataservice_api_recvresp_root_context_init(
@@ -2708,7 +2850,7 @@ BEGIN_TEST_F(txn_submit_get_promote_old)
                 sendreq_status =
                     dataservice_api_sendreq_root_context_init_old(
                         &fixture.nonblockdatasock, &fixture.alloc_opts,
-                        DEFAULT_DATABASE_SIZE, DB_PATH.c_str());
+                        DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str());
             }
         });
 
@@ -2980,7 +3122,7 @@ BEGIN_TEST_F(make_block_simple)
         0
             == dataservice_api_sendreq_root_context_init(
                     fixture.datapsock, &fixture.alloc_opts,
-                    DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
     TEST_ASSERT(
         0
             == dataservice_api_recvresp_root_context_init(
@@ -3283,7 +3425,7 @@ BEGIN_TEST_F(make_block_simple_old)
                 sendreq_status =
                     dataservice_api_sendreq_root_context_init_old(
                         &fixture.nonblockdatasock, &fixture.alloc_opts,
-                        DEFAULT_DATABASE_SIZE, DB_PATH.c_str());
+                        DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str());
             }
         });
 
@@ -3753,7 +3895,7 @@ BEGIN_TEST_F(block_get_not_found)
         0
             == dataservice_api_sendreq_root_context_init(
                     fixture.datapsock, &fixture.alloc_opts,
-                    DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
     TEST_ASSERT(
         0
             == dataservice_api_recvresp_root_context_init(
@@ -3853,7 +3995,7 @@ BEGIN_TEST_F(block_get_not_found_old)
                 sendreq_status =
                     dataservice_api_sendreq_root_context_init_old(
                         &fixture.nonblockdatasock, &fixture.alloc_opts,
-                        DEFAULT_DATABASE_SIZE, DB_PATH.c_str());
+                        DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str());
             }
         });
 
@@ -3977,7 +4119,7 @@ BEGIN_TEST_F(block_id_by_height_get_not_found)
         0
             == dataservice_api_sendreq_root_context_init(
                     fixture.datapsock, &fixture.alloc_opts,
-                    DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
     TEST_ASSERT(
         0
             == dataservice_api_recvresp_root_context_init(
@@ -4074,7 +4216,7 @@ BEGIN_TEST_F(block_id_by_height_get_not_found_old)
                 sendreq_status =
                     dataservice_api_sendreq_root_context_init_old(
                         &fixture.nonblockdatasock, &fixture.alloc_opts,
-                        DEFAULT_DATABASE_SIZE, DB_PATH.c_str());
+                        DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str());
             }
         });
 
@@ -4195,7 +4337,7 @@ BEGIN_TEST_F(latest_block_id_get_not_found)
         0
             == dataservice_api_sendreq_root_context_init(
                     fixture.datapsock, &fixture.alloc_opts,
-                    DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
     TEST_ASSERT(
         0
             == dataservice_api_recvresp_root_context_init(
@@ -4297,7 +4439,7 @@ BEGIN_TEST_F(latest_block_id_get_not_found_old)
                 sendreq_status =
                     dataservice_api_sendreq_root_context_init_old(
                         &fixture.nonblockdatasock, &fixture.alloc_opts,
-                        DEFAULT_DATABASE_SIZE, DB_PATH.c_str());
+                        DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str());
             }
         });
 
@@ -4423,7 +4565,7 @@ BEGIN_TEST_F(artifact_get_not_found)
         0
             == dataservice_api_sendreq_root_context_init(
                     fixture.datapsock, &fixture.alloc_opts,
-                    DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
     TEST_ASSERT(
         0
             == dataservice_api_recvresp_root_context_init(
@@ -4520,7 +4662,7 @@ BEGIN_TEST_F(artifact_get_not_found_old)
                 sendreq_status =
                     dataservice_api_sendreq_root_context_init_old(
                         &fixture.nonblockdatasock, &fixture.alloc_opts,
-                        DEFAULT_DATABASE_SIZE, DB_PATH.c_str());
+                        DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str());
             }
         });
 
@@ -4619,6 +4761,183 @@ BEGIN_TEST_F(artifact_get_not_found_old)
     TEST_ASSERT(AGENTD_ERROR_DATASERVICE_NOT_FOUND == (int)status);
 END_TEST_F()
 
+/**
+ * Test that pipelined block and transaction reads with certificates succeed
+ * when more of them are outstanding than the database reader table can hold.
+ */
+BEGIN_TEST_F(read_cert_pipelined_small_reader_table)
+    uint32_t offset;
+    uint32_t status;
+    uint32_t child_context;
+    const size_t READ_COUNT = 32U;
+    string DB_PATH;
+
+    /* we are using psock for this. */
+    TEST_ASSERT(0 == fixture.use_psock());
+
+    /* create the directory for this test. */
+    TEST_ASSERT(0 == fixture.createDirectoryName(__COUNTER__, DB_PATH));
+
+    /* create the root context with a small reader table. */
+    TEST_ASSERT(
+        0
+            == dataservice_api_sendreq_root_context_init(
+                    fixture.datapsock, &fixture.alloc_opts,
+                    DEFAULT_DATABASE_SIZE, 0U, 8U, DB_PATH.c_str()));
+    TEST_ASSERT(
+        0
+            == dataservice_api_recvresp_root_context_init(
+                    fixture.datapsock, fixture.alloc, &offset, &status));
+
+    /* verify that everything ran correctly. */
+    TEST_EXPECT(0U == offset);
+    TEST_EXPECT(0U == status);
+
+    /* create a reduced capabilities set for the child context. */
+    BITCAP(reducedcaps, DATASERVICE_API_CAP_BITS_MAX);
+    BITCAP_INIT_FALSE(reducedcaps);
+
+    /* explicitly grant submitting a transaction, making a block, reading a
+     * block, and reading a transaction. */
+    BITCAP_SET_TRUE(reducedcaps,
+        DATASERVICE_API_CAP_APP_PQ_TRANSACTION_SUBMIT);
+    BITCAP_SET_TRUE(reducedcaps,
+        DATASERVICE_API_CAP_APP_BLOCK_WRITE);
+    BITCAP_SET_TRUE(reducedcaps,
+        DATASERVICE_API_CAP_APP_BLOCK_READ);
+    BITCAP_SET_TRUE(reducedcaps,
+        DATASERVICE_API_CAP_APP_TRANSACTION_READ);
+
+    /* create child context. */
+    TEST_ASSERT(
+        0
+            == dataservice_api_sendreq_child_context_create(
+                    fixture.datapsock, &fixture.alloc_opts, reducedcaps,
+                    sizeof(reducedcaps)));
+    TEST_ASSERT(
+        0
+            == dataservice_api_recvresp_child_context_create(
+                    fixture.datapsock, fixture.alloc, &offset, &status,
+                    &child_context));
+
+    /* verify that everything ran correctly. */
+    TEST_ASSERT(0U == offset);
+    TEST_ASSERT(0U == status);
+
+    const uint8_t foo_key[16] = {
+        0x05, 0x09, 0x43, 0x34, 0x0f, 0xb0, 0x4a, 0xa2,
+        0xa1, 0xf2, 0x26, 0x15, 0x6a, 0x56, 0x45, 0x4d
+    };
+    const uint8_t foo_prev[16] = {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    };
+    const uint8_t foo_artifact[16] = {
+        0xc3, 0x84, 0x33, 0x0b, 0xf5, 0x0d, 0x42, 0xa2,
+        0x9a, 0x52, 0xb5, 0xa4, 0xb3, 0x5b, 0xcf, 0x72
+    };
+    const uint8_t foo_block_id[16] = {
+        0x5f, 0x5f, 0x5b, 0xea, 0xdb, 0xcd, 0x4c, 0xff,
+        0xb3, 0x40, 0x99, 0x2e, 0x07, 0xf9, 0xc1, 0xef
+    };
+    uint8_t* foo_cert = nullptr;
+    size_t foo_cert_length = 0;
+    uint8_t* foo_block_cert = nullptr;
+    size_t foo_block_cert_length = 0;
+
+    /* create the foo transaction. */
+    TEST_ASSERT(
+        0
+            == fixture.create_dummy_transaction(
+                    foo_key, foo_prev, foo_artifact, &foo_cert,
+                    &foo_cert_length));
+
+    /* submit the transaction. */
+    TEST_ASSERT(
+        0
+            == dataservice_api_sendreq_transaction_submit(
+                    fixture.datapsock, &fixture.alloc_opts, child_context,
+                    foo_key, foo_artifact, foo_cert, foo_cert_length));
+    TEST_ASSERT(
+        0
+            == dataservice_api_recvresp_transaction_submit(
+                    fixture.datapsock, fixture.alloc, &offset, &status));
+    TEST_ASSERT(0U == status);
+
+    /* create the block. */
+    TEST_ASSERT(
+        0
+            == create_dummy_block_for_isolation(
+                    &fixture.builder_opts,
+                    foo_block_id, vccert_certificate_type_uuid_root_block, 1,
+                    &foo_block_cert, &foo_block_cert_length,
+                    foo_cert, foo_cert_length,
+                    nullptr));
+
+    /* make the block. */
+    TEST_ASSERT(
+        0
+            == dataservice_api_sendreq_block_make(
+                    fixture.datapsock, &fixture.alloc_opts, child_context,
+                    foo_block_id, foo_block_cert, foo_block_cert_length));
+    TEST_ASSERT(
+        0
+            == dataservice_api_recvresp_block_make(
+                    fixture.datapsock, fixture.alloc, &offset, &status));
+    TEST_ASSERT(0U == status);
+
+    /* send every read before reading any response. */
+    for (size_t i = 0; i < READ_COUNT; ++i)
+    {
+        TEST_ASSERT(
+            0
+                == dataservice_api_sendreq_block_get(
+                        fixture.datapsock, &fixture.alloc_opts, child_context,
+                        foo_block_id, true));
+        TEST_ASSERT(
+            0
+                == dataservice_api_sendreq_canonized_transaction_get(
+                        fixture.datapsock, &fixture.alloc_opts, child_context,
+                        foo_key, true));
+    }
+
+    /* every read returns its certificate. */
+    for (size_t i = 0; i < READ_COUNT; ++i)
+    {
+        data_block_node_t block_node;
+        void* block_data = nullptr;
+        size_t block_data_size = 0U;
+        data_transaction_node_t txn_node;
+        void* txn_data = nullptr;
+        size_t txn_data_size = 0U;
+
+        TEST_ASSERT(
+            0
+                == dataservice_api_recvresp_block_get(
+                        fixture.datapsock, fixture.alloc, &offset, &status,
+                        &block_node, &block_data, &block_data_size));
+        TEST_EXPECT(0U == status);
+        TEST_EXPECT(foo_block_cert_length == block_data_size);
+        TEST_EXPECT(
+            0 == memcmp(foo_block_cert, block_data, foo_block_cert_length));
+        free(block_data);
+
+        TEST_ASSERT(
+            0
+                == dataservice_api_recvresp_canonized_transaction_get(
+                        fixture.datapsock, fixture.alloc, &offset, &status,
+                        &txn_node, &txn_data, &txn_data_size));
+        TEST_EXPECT(0U == status);
+        TEST_EXPECT(foo_cert_length == txn_data_size);
+        TEST_EXPECT(0 == memcmp(foo_cert, txn_data, foo_cert_length));
+        free(txn_data);
+    }
+
+    /* clean up. */
+    free(foo_cert);
+    free(foo_block_cert);
+END_TEST_F()
+
 /**
  * Test that we can read a block by id and not return the cert.
  */
@@ -4639,7 +4958,7 @@ BEGIN_TEST_F(read_block_no_cert)
         0
             == dataservice_api_sendreq_root_context_init(
                     fixture.datapsock, &fixture.alloc_opts,
-                    DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
     TEST_ASSERT(
         0
             == dataservice_api_recvresp_root_context_init(
@@ -4825,7 +5144,7 @@ BEGIN_TEST_F(read_block_no_cert_old)
                 sendreq_status =
                     dataservice_api_sendreq_root_context_init_old(
                         &fixture.nonblockdatasock, &fixture.alloc_opts,
-                        DEFAULT_DATABASE_SIZE, DB_PATH.c_str());
+                        DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str());
             }
         });
 
@@ -5075,7 +5394,7 @@ BEGIN_TEST_F(no_context_leak)
         0
             == dataservice_api_sendreq_root_context_init(
                     fixture.datapsock, &fixture.alloc_opts,
-                    DEFAULT_DATABASE_SIZE, DB_PATH.c_str()));
+                    DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str()));
     TEST_ASSERT(
         0
             == dataservice_api_recvresp_root_context_init(
@@ -5212,7 +5531,7 @@ BEGIN_TEST_F(no_context_leak_old)
                 sendreq_status =
                     dataservice_api_sendreq_root_context_init_old(
                         &fixture.nonblockdatasock, &fixture.alloc_opts,
-                        DEFAULT_DATABASE_SIZE, DB_PATH.c_str());
+                        DEFAULT_DATABASE_SIZE, 0U, 0U, DB_PATH.c_str());
             }
         });
 
@@ -1376,6 +1376,89 @@ BEGIN_TEST_F(ipc_read_int64_noblock_success)
     close(rhs);
 END_TEST_F()
 
+/**
+ * \brief It is possible to read data packets as views into the read buffer of
+ * a non-blocking socket.
+ */
+BEGIN_TEST_F(ipc_read_data_view_noblock_success)
+    int lhs, rhs;
+    const char* TEST_STRINGS[2] = { "first view", "second view" };
+    char* views[2] = { nullptr, nullptr };
+    uint32_t sizes[2] = { 0, 0 };
+    size_t count = 0;
+
+    /* create a socket pair for testing. */
+    TEST_ASSERT(0 == ipc_socketpair(AF_UNIX, SOCK_STREAM, 0, &lhs, &rhs));
+
+    /* write two data packets to the lhs socket. */
+    for (size_t i = 0; i < 2; ++i)
+    {
+        TEST_ASSERT(
+            0
+                == ipc_write_data_block(
+                        lhs, TEST_STRINGS[i], strlen(TEST_STRINGS[i])));
+    }
+
+    int read_resp = AGENTD_ERROR_IPC_WOULD_BLOCK;
+
+    fixture.nonblockmode(
+        rhs,
+        /* onRead */
+        [&]() {
+            while (count < 2)
+            {
+                void* view = nullptr;
+
+                read_resp =
+                    ipc_read_data_view_noblock(
+                        &fixture.nonblockdatasock, &view, &sizes[count]);
+
+                if (AGENTD_ERROR_IPC_WOULD_BLOCK == read_resp)
+                {
+                    return;
+                }
+                else if (AGENTD_STATUS_SUCCESS != read_resp)
+                {
+                    break;
+                }
+
+                /* copy the view before it is released. */
+                views[count] = strndup((const char*)view, sizes[count]);
+
+                read_resp =
+                    ipc_read_data_view_release(&fixture.nonblockdatasock);
+                if (AGENTD_STATUS_SUCCESS != read_resp)
+                {
+                    break;
+                }
+
+                ++count;
+            }
+
+            ipc_exit_loop(&fixture.loop);
+        },
+        /* onWrite */
+        [&]() {
+        });
+
+    /* both reads should have succeeded. */
+    TEST_ASSERT(AGENTD_STATUS_SUCCESS == read_resp);
+    TEST_ASSERT(2 == count);
+
+    /* each view matches what was written. */
+    for (size_t i = 0; i < 2; ++i)
+    {
+        TEST_ASSERT(nullptr != views[i]);
+        TEST_EXPECT(strlen(TEST_STRINGS[i]) == sizes[i]);
+        TEST_EXPECT(0 == strcmp(TEST_STRINGS[i], views[i]));
+        free(views[i]);
+    }
+
+    /* clean up. */
+    close(lhs);
+    close(rhs);
+END_TEST_F()
+
 /**
  * \brief It is possible to read an authed packet from a blocking socket.
  */
@@ -1636,6 +1719,98 @@ BEGIN_TEST_F(ipc_read_authed_noblock_success)
     dispose((disposable_t*)&key);
 END_TEST_F()
 
+/**
+ * \brief Several authed packets can be read from the same non-blocking socket,
+ * including after the shared secret changes.
+ */
+BEGIN_TEST_F(ipc_read_authed_noblock_session_rekey)
+    int lhs, rhs;
+    const char* TEST_STRINGS[3] = { "first packet", "second", "rekeyed" };
+    void* str[3] = { nullptr, nullptr, nullptr };
+    uint32_t str_size[3] = { 0, 0, 0 };
+    size_t count = 0;
+
+    /* create a socket pair for testing. */
+    TEST_ASSERT(0 == ipc_socketpair(AF_UNIX, SOCK_STREAM, 0, &lhs, &rhs));
+
+    /* create two keys for the stream cipher. */
+    vccrypt_buffer_t key1, key2;
+    TEST_ASSERT(
+        0
+            == vccrypt_buffer_init(
+                    &key1, &fixture.alloc_opts,
+                    fixture.suite.stream_cipher_opts.key_size));
+    TEST_ASSERT(
+        0
+            == vccrypt_buffer_init(
+                    &key2, &fixture.alloc_opts,
+                    fixture.suite.stream_cipher_opts.key_size));
+    memset(key1.data, 0, key1.size);
+    memset(key2.data, 0x5a, key2.size);
+    vccrypt_buffer_t* keys[3] = { &key1, &key1, &key2 };
+
+    /* write all three packets. */
+    for (uint64_t i = 0; i < 3; ++i)
+    {
+        TEST_ASSERT(
+            0
+                == ipc_write_authed_data_block(
+                        lhs, i, TEST_STRINGS[i], strlen(TEST_STRINGS[i]),
+                        &fixture.suite, keys[i]));
+    }
+
+    int read_resp = AGENTD_ERROR_IPC_WOULD_BLOCK;
+
+    /* read each packet from the rhs socket. */
+    fixture.nonblockmode(
+        rhs,
+        /* onRead */
+        [&]() {
+            while (count < 3)
+            {
+                read_resp =
+                    ipc_read_authed_data_noblock(
+                        &fixture.nonblockdatasock, count, &str[count],
+                        &str_size[count], &fixture.suite, keys[count]);
+
+                if (AGENTD_ERROR_IPC_WOULD_BLOCK == read_resp)
+                {
+                    return;
+                }
+                else if (0 != read_resp)
+                {
+                    break;
+                }
+
+                ++count;
+            }
+
+            ipc_exit_loop(&fixture.loop);
+        },
+        /* onWrite */
+        [&]() {
+        });
+
+    /* every read should have succeeded. */
+    TEST_ASSERT(0 == read_resp);
+    TEST_ASSERT(3 == count);
+
+    /* each packet matches what was written. */
+    for (size_t i = 0; i < 3; ++i)
+    {
+        TEST_ASSERT(nullptr != str[i]);
+        TEST_ASSERT(strlen(TEST_STRINGS[i]) == str_size[i]);
+        TEST_EXPECT(0 == memcmp(TEST_STRINGS[i], str[i], str_size[i]));
+        free(str[i]);
+    }
+
+    /* clean up. */
+    close(lhs);
+    close(rhs);
+    dispose((disposable_t*)&key1);
+    dispose((disposable_t*)&key2);
+END_TEST_F()
+
 /**
  * \brief It is possible to write a packet via ipc_write_authed_noblock and read
  * it using ipc_read_authed_block.
@@ -1723,6 +1898,89 @@ BEGIN_TEST_F(ipc_write_authed_noblock_success)
     dispose((disposable_t*)&key);
 END_TEST_F()
 
+static void test_reference_release_cb(
+    const void*, size_t size, void* user_context)
+{
+    size_t* released = (size_t*)user_context;
+
+    *released += size + 1;
+}
+
+/**
+ * \brief It is possible to write a data packet with a tail appended by
+ * reference, and the release callback is called once it is written.
+ */
+BEGIN_TEST_F(ipc_write_data_by_reference_noblock_success)
+    int lhs, rhs;
+    const char HDR_STRING[] = "This is ";
+    const char REF_STRING[] = "a test.";
+    const char TEST_STRING[] = "This is a test.";
+    void* str = nullptr;
+    uint32_t str_size = 0;
+    size_t released = 0;
+
+    /* create a socket pair for testing. */
+    TEST_ASSERT(0 == ipc_socketpair(AF_UNIX, SOCK_STREAM, 0, &lhs, &rhs));
+
+    int write_resp = AGENTD_ERROR_IPC_WOULD_BLOCK;
+
+    /* writing to the socket should succeed. */
+    fixture.nonblockmode(
+        lhs,
+        /* onRead */
+        [&]() {
+        },
+        /* onWrite */
+        [&]() {
+            if (AGENTD_ERROR_IPC_WOULD_BLOCK == write_resp)
+            {
+                write_resp =
+                    ipc_write_data_by_reference_noblock(
+                        &fixture.nonblockdatasock, HDR_STRING,
+                        strlen(HDR_STRING), REF_STRING, strlen(REF_STRING),
+                        &test_reference_release_cb, &released);
+            }
+            else
+            {
+                if (ipc_socket_writebuffer_size(&fixture.nonblockdatasock) > 0)
+                {
+                    int bytes_written =
+                        ipc_socket_write_from_buffer(&fixture.nonblockdatasock);
+
+                    if (bytes_written == 0
+                      || (bytes_written < 0
+                            && (errno != EAGAIN && errno != EWOULDBLOCK)))
+                    {
+                        ipc_exit_loop(&fixture.loop);
+                    }
+                }
+                else
+                {
+                    ipc_exit_loop(&fixture.loop);
+                }
+            }
+        });
+    /* the write should have succeeded. */
+    TEST_ASSERT(0 == write_resp);
+
+    /* the reference was released exactly once. */
+    TEST_EXPECT(strlen(REF_STRING) + 1 == released);
+
+    /* read a data packet from the rhs socket. */
+    TEST_ASSERT(0 == ipc_read_data_block(rhs, &str, &str_size));
+    /* the data is valid. */
+    TEST_ASSERT(nullptr != str);
+
+    /* the data is the concatenation of the header and the reference. */
+    TEST_ASSERT(strlen(TEST_STRING) == str_size);
+    TEST_EXPECT(0 == memcmp(TEST_STRING, str, str_size));
+
+    /* clean up. */
+    free(str);
+    close(lhs);
+    close(rhs);
+END_TEST_F()
+
 static void test_timer_cb(ipc_timer_context_t*, void* user_context)
 {
     function<void()>* func = (function<void()>*)user_context;
@@ -153,6 +153,48 @@ void mock_dataservice::mock_dataservice::register_callback_block_id_by_height_re
     block_id_by_height_read_callback = cb;
 }
 
+/**
+ * \brief Register a mock callback for block_id_next_read.
+ *
+ * \param cb                The callback to register.
+ */
+void mock_dataservice::mock_dataservice::register_callback_block_id_next_read(
+    function<
+        int(const dataservice_request_block_id_link_read_t&,
+            ostream&)>
+        cb)
+{
+    block_id_next_read_callback = cb;
+}
+
+/**
+ * \brief Register a mock callback for block_id_prev_read.
+ *
+ * \param cb                The callback to register.
+ */
+void mock_dataservice::mock_dataservice::register_callback_block_id_prev_read(
+    function<
+        int(const dataservice_request_block_id_link_read_t&,
+            ostream&)>
+        cb)
+{
+    block_id_prev_read_callback = cb;
+}
+
+/**
+ * \brief Register a mock callback for block_id_with_transaction_read.
+ *
+ * \param cb                The callback to register.
+ */
+void mock_dataservice::mock_dataservice::register_callback_block_id_with_transaction_read(
+    function<
+        int(const dataservice_request_block_id_link_read_t&,
+            ostream&)>
+        cb)
+{
+    block_id_with_transaction_read_callback = cb;
+}
+
 /**
  * \brief Register a mock callback for block_id_latest_read.
  *
@@ -307,6 +349,78 @@ void mock_dataservice::mock_dataservice::register_callback_transaction_get(
     transaction_get_callback = cb;
 }
 
+/**
+ * \brief Register a mock callback for transaction_list_get.
+ *
+ * \param cb                The callback to register.
+ */
+void mock_dataservice::mock_dataservice::register_callback_transaction_list_get(
+    function<
+        int(const dataservice_request_transaction_list_get_t&,
+            ostream&)>
+        cb)
+{
+    transaction_list_get_callback = cb;
+}
+
+/**
+ * \brief Register a mock callback for block_range_get.
+ *
+ * \param cb                The callback to register.
+ */
+void mock_dataservice::mock_dataservice::register_callback_block_range_get(
+    function<
+        int(const dataservice_request_block_range_get_t&,
+            ostream&)>
+        cb)
+{
+    block_range_get_callback = cb;
+}
+
+/**
+ * \brief Register a mock callback for artifact_transaction_list_get.
+ *
+ * \param cb                The callback to register.
+ */
+void mock_dataservice::mock_dataservice::
+    register_callback_artifact_transaction_list_get(
+        function<
+            int(const dataservice_request_artifact_transaction_list_get_t&,
+                ostream&)>
+            cb)
+{
+    artifact_transaction_list_get_callback = cb;
+}
+
+/**
+ * \brief Register a mock callback for transaction_batch_update.
+ *
+ * \param cb                The callback to register.
+ */
+void mock_dataservice::mock_dataservice::
+    register_callback_transaction_batch_update(
+        function<
+            int(const dataservice_request_transaction_batch_update_t&,
+                ostream&)>
+            cb)
+{
+    transaction_batch_update_callback = cb;
+}
+
+/**
+ * \brief Register a mock callback for id_exists.
+ *
+ * \param cb                The callback to register.
+ */
+void mock_dataservice::mock_dataservice::register_callback_id_exists(
+    function<
+        int(const dataservice_request_id_exists_t&,
+            ostream&)>
+        cb)
+{
+    id_exists_callback = cb;
+}
+
 /**
  * \brief Register a mock callback for transaction_get_first.
  *
@@ -468,6 +582,40 @@ bool mock_dataservice::mock_dataservice::mock_read_and_dispatch()
                     breq, payload_size);
             break;
 
+        /* handle transaction list get. */
+        case DATASERVICE_API_METHOD_APP_PQ_TRANSACTION_LIST_READ:
+            retval =
+                mock_decode_and_dispatch_transaction_list_get(
+                    breq, payload_size);
+            break;
+
+        /* handle block range get. */
+        case DATASERVICE_API_METHOD_APP_BLOCK_RANGE_READ:
+            retval =
+                mock_decode_and_dispatch_block_range_get(
+                    breq, payload_size);
+            break;
+
+        /* handle artifact transaction list get. */
+        case DATASERVICE_API_METHOD_APP_ARTIFACT_TRANSACTION_LIST_READ:
+            retval =
+                mock_decode_and_dispatch_artifact_transaction_list_get(
+                    breq, payload_size);
+            break;
+
+        /* handle transaction batch update. */
+        case DATASERVICE_API_METHOD_APP_PQ_TRANSACTION_BATCH_UPDATE:
+            retval =
+                mock_decode_and_dispatch_transaction_batch_update(
+                    breq, payload_size);
+            break;
+
+        /* handle id exists. */
+        case DATASERVICE_API_METHOD_APP_ID_EXISTS_READ:
+            retval =
+                mock_decode_and_dispatch_id_exists(breq, payload_size);
+            break;
+
         /* handle transaction drop. */
         case DATASERVICE_API_METHOD_APP_PQ_TRANSACTION_DROP:
             retval =
@@ -517,6 +665,15 @@ bool mock_dataservice::mock_dataservice::mock_read_and_dispatch()
                     breq, payload_size);
             break;
 
+        /* handle block id next, prev, and with transaction reads. */
+        case DATASERVICE_API_METHOD_APP_BLOCK_ID_NEXT_READ:
+        case DATASERVICE_API_METHOD_APP_BLOCK_ID_PREV_READ:
+        case DATASERVICE_API_METHOD_APP_BLOCK_ID_WITH_TRANSACTION_READ:
+            retval =
+                mock_decode_and_dispatch_block_id_link_read(
+                    method, breq, payload_size);
+            break;
+
         /* handle canonized transaction read. */
         case DATASERVICE_API_METHOD_APP_TRANSACTION_READ:
             retval =
@@ -542,6 +699,22 @@ done:
     return retval;
 }
 
+/**
+ * \brief Write a response that answers no request.
+ *
+ * This may only be called from a mock callback.  The response is written
+ * before the response to the request being handled.
+ *
+ * \param method    The method of this response.
+ * \param offset    The child offset of this response.
+ * \param status    The status code of this response.
+ */
+void mock_dataservice::mock_dataservice::write_unmatched_response(
+    uint32_t method, uint32_t offset, uint32_t status)
+{
+    mock_write_status(method, offset, status, nullptr, 0U);
+}
+
 /**
  * \brief Write the status back to the caller.
  *
@@ -943,7 +1116,7 @@ done:
 }
 
 /**
- * \brief Mock for the transaction drop call.
+ * \brief Mock for the transaction list get call.
  *
  * \param req       The request payload.
  * \param size      The request payload size.
@@ -951,18 +1124,18 @@ done:
  * \returns true if the request could be processed and false otherwise.
  */
 bool mock_dataservice::mock_dataservice::
-    mock_decode_and_dispatch_transaction_drop(
+    mock_decode_and_dispatch_transaction_list_get(
         const void* request, size_t payload_size)
 {
     bool retval = false;
-    dataservice_request_transaction_drop_t dreq;
+    dataservice_request_transaction_list_get_t dreq;
     stringstream payout;
     string payload;
     uint32_t status = AGENTD_ERROR_DATASERVICE_NOT_FOUND;
 
     /* parse the request payload. */
     if (AGENTD_STATUS_SUCCESS !=
-        dataservice_decode_request_transaction_drop(
+        dataservice_decode_request_transaction_list_get(
             request, payload_size, &dreq))
     {
         retval = false;
@@ -970,9 +1143,9 @@ bool mock_dataservice::mock_dataservice::
     }
 
     /* if the mock callback is set, call it. */
-    if (!!transaction_drop_callback)
+    if (!!transaction_list_get_callback)
     {
-        status = transaction_drop_callback(dreq, payout);
+        status = transaction_list_get_callback(dreq, payout);
     }
 
     /* get the payload if set. */
@@ -984,14 +1157,14 @@ bool mock_dataservice::mock_dataservice::
 
 done:
     mock_write_status(
-        DATASERVICE_API_METHOD_APP_PQ_TRANSACTION_DROP, dreq.hdr.child_index,
-        status, payload.data(), payload.size());
+        DATASERVICE_API_METHOD_APP_PQ_TRANSACTION_LIST_READ,
+        dreq.hdr.child_index, status, payload.data(), payload.size());
 
     return retval;
 }
 
 /**
- * \brief Mock for the transaction promote call.
+ * \brief Mock for the block range get call.
  *
  * \param req       The request payload.
  * \param size      The request payload size.
@@ -999,18 +1172,18 @@ done:
  * \returns true if the request could be processed and false otherwise.
  */
 bool mock_dataservice::mock_dataservice::
-    mock_decode_and_dispatch_transaction_promote(
+    mock_decode_and_dispatch_block_range_get(
         const void* request, size_t payload_size)
 {
     bool retval = false;
-    dataservice_request_transaction_promote_t dreq;
+    dataservice_request_block_range_get_t dreq;
     stringstream payout;
     string payload;
     uint32_t status = AGENTD_ERROR_DATASERVICE_NOT_FOUND;
 
     /* parse the request payload. */
     if (AGENTD_STATUS_SUCCESS !=
-        dataservice_decode_request_transaction_promote(
+        dataservice_decode_request_block_range_get(
             request, payload_size, &dreq))
     {
         retval = false;
@@ -1018,9 +1191,9 @@ bool mock_dataservice::mock_dataservice::
     }
 
     /* if the mock callback is set, call it. */
-    if (!!transaction_promote_callback)
+    if (!!block_range_get_callback)
     {
-        status = transaction_promote_callback(dreq, payout);
+        status = block_range_get_callback(dreq, payout);
     }
 
     /* get the payload if set. */
@@ -1032,14 +1205,14 @@ bool mock_dataservice::mock_dataservice::
 
 done:
     mock_write_status(
-        DATASERVICE_API_METHOD_APP_PQ_TRANSACTION_PROMOTE, dreq.hdr.child_index,
-        status, payload.data(), payload.size());
+        DATASERVICE_API_METHOD_APP_BLOCK_RANGE_READ,
+        dreq.hdr.child_index, status, payload.data(), payload.size());
 
     return retval;
 }
 
 /**
- * \brief Mock for the artifact read call.
+ * \brief Mock for the artifact transaction list get call.
  *
  * \param req       The request payload.
  * \param size      The request payload size.
@@ -1047,18 +1220,18 @@ done:
  * \returns true if the request could be processed and false otherwise.
  */
 bool mock_dataservice::mock_dataservice::
-    mock_decode_and_dispatch_artifact_read(
+    mock_decode_and_dispatch_artifact_transaction_list_get(
         const void* request, size_t payload_size)
 {
     bool retval = false;
-    dataservice_request_payload_artifact_read_t dreq;
+    dataservice_request_artifact_transaction_list_get_t dreq;
     stringstream payout;
     string payload;
     uint32_t status = AGENTD_ERROR_DATASERVICE_NOT_FOUND;
 
     /* parse the request payload. */
     if (AGENTD_STATUS_SUCCESS !=
-        dataservice_decode_request_payload_artifact_read(
+        dataservice_decode_request_artifact_transaction_list_get(
             request, payload_size, &dreq))
     {
         retval = false;
@@ -1066,9 +1239,9 @@ bool mock_dataservice::mock_dataservice::
     }
 
     /* if the mock callback is set, call it. */
-    if (!!payload_artifact_read_callback)
+    if (!!artifact_transaction_list_get_callback)
     {
-        status = payload_artifact_read_callback(dreq, payout);
+        status = artifact_transaction_list_get_callback(dreq, payout);
     }
 
     /* get the payload if set. */
@@ -1080,14 +1253,14 @@ bool mock_dataservice::mock_dataservice::
 
 done:
     mock_write_status(
-        DATASERVICE_API_METHOD_APP_ARTIFACT_READ, dreq.hdr.child_index,
-        status, payload.data(), payload.size());
+        DATASERVICE_API_METHOD_APP_ARTIFACT_TRANSACTION_LIST_READ,
+        dreq.hdr.child_index, status, payload.data(), payload.size());
 
     return retval;
 }
 
 /**
- * \brief Mock for the block make call.
+ * \brief Mock for the transaction batch update call.
  *
  * \param req       The request payload.
  * \param size      The request payload size.
@@ -1095,18 +1268,18 @@ done:
  * \returns true if the request could be processed and false otherwise.
  */
 bool mock_dataservice::mock_dataservice::
-    mock_decode_and_dispatch_block_make(
+    mock_decode_and_dispatch_transaction_batch_update(
         const void* request, size_t payload_size)
 {
     bool retval = false;
-    dataservice_request_block_make_t dreq;
+    dataservice_request_transaction_batch_update_t dreq;
     stringstream payout;
     string payload;
     uint32_t status = AGENTD_ERROR_DATASERVICE_NOT_FOUND;
 
     /* parse the request payload. */
     if (AGENTD_STATUS_SUCCESS !=
-        dataservice_decode_request_block_make(
+        dataservice_decode_request_transaction_batch_update(
             request, payload_size, &dreq))
     {
         retval = false;
@@ -1114,9 +1287,9 @@ bool mock_dataservice::mock_dataservice::
     }
 
     /* if the mock callback is set, call it. */
-    if (!!block_make_callback)
+    if (!!transaction_batch_update_callback)
     {
-        status = block_make_callback(dreq, payout);
+        status = transaction_batch_update_callback(dreq, payout);
     }
 
     /* get the payload if set. */
@@ -1128,14 +1301,14 @@ bool mock_dataservice::mock_dataservice::
 
 done:
     mock_write_status(
-        DATASERVICE_API_METHOD_APP_BLOCK_WRITE, dreq.hdr.child_index,
-        status, payload.data(), payload.size());
+        DATASERVICE_API_METHOD_APP_PQ_TRANSACTION_BATCH_UPDATE,
+        dreq.hdr.child_index, status, payload.data(), payload.size());
 
     return retval;
 }
 
 /**
- * \brief Mock for the block read call.
+ * \brief Mock for the id exists call.
  *
  * \param req       The request payload.
  * \param size      The request payload size.
@@ -1143,18 +1316,18 @@ done:
  * \returns true if the request could be processed and false otherwise.
  */
 bool mock_dataservice::mock_dataservice::
-    mock_decode_and_dispatch_block_read(
+    mock_decode_and_dispatch_id_exists(
         const void* request, size_t payload_size)
 {
     bool retval = false;
-    dataservice_request_block_read_t dreq;
+    dataservice_request_id_exists_t dreq;
     stringstream payout;
     string payload;
     uint32_t status = AGENTD_ERROR_DATASERVICE_NOT_FOUND;
 
     /* parse the request payload. */
     if (AGENTD_STATUS_SUCCESS !=
-        dataservice_decode_request_block_read(
+        dataservice_decode_request_id_exists(
             request, payload_size, &dreq))
     {
         retval = false;
@@ -1162,9 +1335,9 @@ bool mock_dataservice::mock_dataservice::
     }
 
     /* if the mock callback is set, call it. */
-    if (!!block_read_callback)
+    if (!!id_exists_callback)
     {
-        status = block_read_callback(dreq, payout);
+        status = id_exists_callback(dreq, payout);
     }
 
     /* get the payload if set. */
@@ -1176,14 +1349,14 @@ bool mock_dataservice::mock_dataservice::
 
 done:
     mock_write_status(
-        DATASERVICE_API_METHOD_APP_BLOCK_READ, dreq.hdr.child_index,
+        DATASERVICE_API_METHOD_APP_ID_EXISTS_READ, dreq.hdr.child_index,
         status, payload.data(), payload.size());
 
     return retval;
 }
 
 /**
- * \brief Mock for the block id by height read call.
+ * \brief Mock for the transaction drop call.
  *
  * \param req       The request payload.
  * \param size      The request payload size.
@@ -1191,18 +1364,18 @@ done:
  * \returns true if the request could be processed and false otherwise.
  */
 bool mock_dataservice::mock_dataservice::
-    mock_decode_and_dispatch_block_id_by_height_read(
+    mock_decode_and_dispatch_transaction_drop(
         const void* request, size_t payload_size)
 {
     bool retval = false;
-    dataservice_request_block_id_by_height_read_t dreq;
+    dataservice_request_transaction_drop_t dreq;
     stringstream payout;
     string payload;
     uint32_t status = AGENTD_ERROR_DATASERVICE_NOT_FOUND;
 
     /* parse the request payload. */
     if (AGENTD_STATUS_SUCCESS !=
-        dataservice_decode_request_block_id_by_height_read(
+        dataservice_decode_request_transaction_drop(
             request, payload_size, &dreq))
     {
         retval = false;
@@ -1210,9 +1383,9 @@ bool mock_dataservice::mock_dataservice::
     }
 
     /* if the mock callback is set, call it. */
-    if (!!block_id_by_height_read_callback)
+    if (!!transaction_drop_callback)
     {
-        status = block_id_by_height_read_callback(dreq, payout);
+        status = transaction_drop_callback(dreq, payout);
     }
 
     /* get the payload if set. */
@@ -1224,14 +1397,14 @@ bool mock_dataservice::mock_dataservice::
 
 done:
     mock_write_status(
-        DATASERVICE_API_METHOD_APP_BLOCK_ID_BY_HEIGHT_READ, dreq.hdr.child_index,
+        DATASERVICE_API_METHOD_APP_PQ_TRANSACTION_DROP, dreq.hdr.child_index,
         status, payload.data(), payload.size());
 
     return retval;
 }
 
 /**
- * \brief Mock for the block id latest read call.
+ * \brief Mock for the transaction promote call.
  *
  * \param req       The request payload.
  * \param size      The request payload size.
@@ -1239,18 +1412,18 @@ done:
  * \returns true if the request could be processed and false otherwise.
  */
 bool mock_dataservice::mock_dataservice::
-    mock_decode_and_dispatch_block_id_latest_read(
+    mock_decode_and_dispatch_transaction_promote(
         const void* request, size_t payload_size)
 {
     bool retval = false;
-    dataservice_request_block_id_latest_read_t dreq;
+    dataservice_request_transaction_promote_t dreq;
     stringstream payout;
     string payload;
     uint32_t status = AGENTD_ERROR_DATASERVICE_NOT_FOUND;
 
     /* parse the request payload. */
     if (AGENTD_STATUS_SUCCESS !=
-        dataservice_decode_request_block_id_latest_read(
+        dataservice_decode_request_transaction_promote(
             request, payload_size, &dreq))
     {
         retval = false;
@@ -1258,9 +1431,9 @@ bool mock_dataservice::mock_dataservice::
     }
 
     /* if the mock callback is set, call it. */
-    if (!!block_id_latest_read_callback)
+    if (!!transaction_promote_callback)
     {
-        status = block_id_latest_read_callback(dreq, payout);
+        status = transaction_promote_callback(dreq, payout);
     }
 
     /* get the payload if set. */
@@ -1272,14 +1445,14 @@ bool mock_dataservice::mock_dataservice::
 
 done:
     mock_write_status(
-        DATASERVICE_API_METHOD_APP_BLOCK_ID_LATEST_READ, dreq.hdr.child_index,
+        DATASERVICE_API_METHOD_APP_PQ_TRANSACTION_PROMOTE, dreq.hdr.child_index,
         status, payload.data(), payload.size());
 
     return retval;
 }
 
 /**
- * \brief Mock for the canonized transaction get call.
+ * \brief Mock for the artifact read call.
  *
  * \param req       The request payload.
  * \param size      The request payload size.
@@ -1287,18 +1460,18 @@ done:
  * \returns true if the request could be processed and false otherwise.
  */
 bool mock_dataservice::mock_dataservice::
-    mock_decode_and_dispatch_canonized_transaction_get(
+    mock_decode_and_dispatch_artifact_read(
         const void* request, size_t payload_size)
 {
     bool retval = false;
-    dataservice_request_canonized_transaction_get_t dreq;
+    dataservice_request_payload_artifact_read_t dreq;
     stringstream payout;
     string payload;
     uint32_t status = AGENTD_ERROR_DATASERVICE_NOT_FOUND;
 
     /* parse the request payload. */
     if (AGENTD_STATUS_SUCCESS !=
-        dataservice_decode_request_canonized_transaction_get(
+        dataservice_decode_request_payload_artifact_read(
             request, payload_size, &dreq))
     {
         retval = false;
@@ -1306,9 +1479,9 @@ bool mock_dataservice::mock_dataservice::
     }
 
     /* if the mock callback is set, call it. */
-    if (!!canonized_transaction_get_callback)
+    if (!!payload_artifact_read_callback)
     {
-        status = canonized_transaction_get_callback(dreq, payout);
+        status = payload_artifact_read_callback(dreq, payout);
     }
 
     /* get the payload if set. */
@@ -1320,75 +1493,826 @@ bool mock_dataservice::mock_dataservice::
 
 done:
     mock_write_status(
-        DATASERVICE_API_METHOD_APP_TRANSACTION_READ, dreq.hdr.child_index,
+        DATASERVICE_API_METHOD_APP_ARTIFACT_READ, dreq.hdr.child_index,
         status, payload.data(), payload.size());
 
     return retval;
 }
 
 /**
- * \brief Return true if the next popped request matches this request.
+ * \brief Mock for the block make call.
  *
- * \param child_index       The child index for this request.
- * \param artifact_id       The artifact_id for this request.
+ * \param req       The request payload.
+ * \param size      The request payload size.
+ *
+ * \returns true if the request could be processed and false otherwise.
  */
 bool mock_dataservice::mock_dataservice::
-    request_matches_payload_artifact_read(
-        uint32_t child_index, const uint8_t* artifact_id)
+    mock_decode_and_dispatch_block_make(
+        const void* request, size_t payload_size)
 {
     bool retval = false;
-    void* val = nullptr;
-    uint32_t size = 0U;
-    const uint8_t* breq = nullptr;
-    uint32_t nmethod = 0U, method = 0U;
-    dataservice_request_payload_artifact_read_t dreq;
+    dataservice_request_block_make_t dreq;
+    stringstream payout;
+    string payload;
+    uint32_t status = AGENTD_ERROR_DATASERVICE_NOT_FOUND;
 
-    /* read a request from the test socket. */
-    if (AGENTD_STATUS_SUCCESS != ipc_read_data_block(testsock, &val, &size))
+    /* parse the request payload. */
+    if (AGENTD_STATUS_SUCCESS !=
+        dataservice_decode_request_block_make(
+            request, payload_size, &dreq))
     {
         retval = false;
         goto done;
     }
 
-    /* make working with the request more convenient. */
-    breq = (const uint8_t*)val;
-
-    /* the payload should be at least large enough for the method. */
-    if (size < sizeof(uint32_t))
+    /* if the mock callback is set, call it. */
+    if (!!block_make_callback)
     {
-        retval = false;
-        goto cleanup_val;
+        status = block_make_callback(dreq, payout);
     }
 
-    /* get the method. */
-    memcpy(&nmethod, breq, sizeof(uint32_t));
-    method = htonl(nmethod);
+    /* get the payload if set. */
+    payload = payout.str();
 
-    /* increment breq past command. */
-    breq += sizeof(uint32_t);
+    /* success. */
+    retval = true;
+    goto done;
 
-    /* decrement size. */
-    size -= sizeof(uint32_t);
+done:
+    mock_write_status(
+        DATASERVICE_API_METHOD_APP_BLOCK_WRITE, dreq.hdr.child_index,
+        status, payload.data(), payload.size());
 
-    /* verify the method. */
-    if (DATASERVICE_API_METHOD_APP_ARTIFACT_READ != method)
-    {
-        retval = false;
-        goto cleanup_val;
-    }
+    return retval;
+}
 
-    /* parse the requset payload. */
-    if (AGENTD_STATUS_SUCCESS !=
-        dataservice_decode_request_payload_artifact_read(
-            breq, size, &dreq))
-    {
-        retval = false;
-        goto cleanup_val;
+/**
+ * \brief Mock for the block read call.
+ *
+ * \param req       The request payload.
+ * \param size      The request payload size.
+ *
+ * \returns true if the request could be processed and false otherwise.
+ */
+bool mock_dataservice::mock_dataservice::
+    mock_decode_and_dispatch_block_read(
+        const void* request, size_t payload_size)
+{
+    bool retval = false;
+    dataservice_request_block_read_t dreq;
+    stringstream payout;
+    string payload;
+    uint32_t status = AGENTD_ERROR_DATASERVICE_NOT_FOUND;
+
+    /* parse the request payload. */
+    if (AGENTD_STATUS_SUCCESS !=
+        dataservice_decode_request_block_read(
+            request, payload_size, &dreq))
+    {
+        retval = false;
+        goto done;
+    }
+
+    /* if the mock callback is set, call it. */
+    if (!!block_read_callback)
+    {
+        status = block_read_callback(dreq, payout);
+    }
+
+    /* get the payload if set. */
+    payload = payout.str();
+
+    /* success. */
+    retval = true;
+    goto done;
+
+done:
+    mock_write_status(
+        DATASERVICE_API_METHOD_APP_BLOCK_READ, dreq.hdr.child_index,
+        status, payload.data(), payload.size());
+
+    return retval;
+}
+
+/**
+ * \brief Mock for the block id by height read call.
+ *
+ * \param req       The request payload.
+ * \param size      The request payload size.
+ *
+ * \returns true if the request could be processed and false otherwise.
+ */
+bool mock_dataservice::mock_dataservice::
+    mock_decode_and_dispatch_block_id_by_height_read(
+        const void* request, size_t payload_size)
+{
+    bool retval = false;
+    dataservice_request_block_id_by_height_read_t dreq;
+    stringstream payout;
+    string payload;
+    uint32_t status = AGENTD_ERROR_DATASERVICE_NOT_FOUND;
+
+    /* parse the request payload. */
+    if (AGENTD_STATUS_SUCCESS !=
+        dataservice_decode_request_block_id_by_height_read(
+            request, payload_size, &dreq))
+    {
+        retval = false;
+        goto done;
+    }
+
+    /* if the mock callback is set, call it. */
+    if (!!block_id_by_height_read_callback)
+    {
+        status = block_id_by_height_read_callback(dreq, payout);
+    }
+
+    /* get the payload if set. */
+    payload = payout.str();
+
+    /* success. */
+    retval = true;
+    goto done;
+
+done:
+    mock_write_status(
+        DATASERVICE_API_METHOD_APP_BLOCK_ID_BY_HEIGHT_READ, dreq.hdr.child_index,
+        status, payload.data(), payload.size());
+
+    return retval;
+}
+
+/**
+ * \brief Mock for the block id next, prev, and with transaction read calls.
+ *
+ * \param method    The API method of this request.
+ * \param req       The request payload.
+ * \param size      The request payload size.
+ *
+ * \returns true if the request could be processed and false otherwise.
+ */
+bool mock_dataservice::mock_dataservice::
+    mock_decode_and_dispatch_block_id_link_read(
+        uint32_t method, const void* request, size_t payload_size)
+{
+    bool retval = false;
+    dataservice_request_block_id_link_read_t dreq;
+    stringstream payout;
+    string payload;
+    uint32_t status = AGENTD_ERROR_DATASERVICE_NOT_FOUND;
+    function<
+        int(const dataservice_request_block_id_link_read_t&,
+            ostream&)> cb;
+
+    /* parse the request payload. */
+    if (AGENTD_STATUS_SUCCESS !=
+        dataservice_decode_request_block_id_link_read(
+            request, payload_size, &dreq))
+    {
+        retval = false;
+        goto done;
+    }
+
+    /* select the mock callback for this method. */
+    switch (method)
+    {
+        case DATASERVICE_API_METHOD_APP_BLOCK_ID_NEXT_READ:
+            cb = block_id_next_read_callback;
+            break;
+
+        case DATASERVICE_API_METHOD_APP_BLOCK_ID_PREV_READ:
+            cb = block_id_prev_read_callback;
+            break;
+
+        default:
+            cb = block_id_with_transaction_read_callback;
+            break;
+    }
+
+    /* if the mock callback is set, call it. */
+    if (!!cb)
+    {
+        status = cb(dreq, payout);
+    }
+
+    /* get the payload if set. */
+    payload = payout.str();
+
+    /* success. */
+    retval = true;
+    goto done;
+
+done:
+    mock_write_status(
+        method, dreq.hdr.child_index, status, payload.data(), payload.size());
+
+    return retval;
+}
+
+/**
+ * \brief Mock for the block id latest read call.
+ *
+ * \param req       The request payload.
+ * \param size      The request payload size.
+ *
+ * \returns true if the request could be processed and false otherwise.
+ */
+bool mock_dataservice::mock_dataservice::
+    mock_decode_and_dispatch_block_id_latest_read(
+        const void* request, size_t payload_size)
+{
+    bool retval = false;
+    dataservice_request_block_id_latest_read_t dreq;
+    stringstream payout;
+    string payload;
+    uint32_t status = AGENTD_ERROR_DATASERVICE_NOT_FOUND;
+
+    /* parse the request payload. */
+    if (AGENTD_STATUS_SUCCESS !=
+        dataservice_decode_request_block_id_latest_read(
+            request, payload_size, &dreq))
+    {
+        retval = false;
+        goto done;
+    }
+
+    /* if the mock callback is set, call it. */
+    if (!!block_id_latest_read_callback)
+    {
+        status = block_id_latest_read_callback(dreq, payout);
+    }
+
+    /* get the payload if set. */
+    payload = payout.str();
+
+    /* success. */
+    retval = true;
+    goto done;
+
+done:
+    mock_write_status(
+        DATASERVICE_API_METHOD_APP_BLOCK_ID_LATEST_READ, dreq.hdr.child_index,
+        status, payload.data(), payload.size());
+
+    return retval;
+}
+
+/**
+ * \brief Mock for the canonized transaction get call.
+ *
+ * \param req       The request payload.
+ * \param size      The request payload size.
+ *
+ * \returns true if the request could be processed and false otherwise.
+ */
+bool mock_dataservice::mock_dataservice::
+    mock_decode_and_dispatch_canonized_transaction_get(
+        const void* request, size_t payload_size)
+{
+    bool retval = false;
+    dataservice_request_canonized_transaction_get_t dreq;
+    stringstream payout;
+    string payload;
+    uint32_t status = AGENTD_ERROR_DATASERVICE_NOT_FOUND;
+
+    /* parse the request payload. */
+    if (AGENTD_STATUS_SUCCESS !=
+        dataservice_decode_request_canonized_transaction_get(
+            request, payload_size, &dreq))
+    {
+        retval = false;
+        goto done;
+    }
+
+    /* if the mock callback is set, call it. */
+    if (!!canonized_transaction_get_callback)
+    {
+        status = canonized_transaction_get_callback(dreq, payout);
+    }
+
+    /* get the payload if set. */
+    payload = payout.str();
+
+    /* success. */
+    retval = true;
+    goto done;
+
+done:
+    mock_write_status(
+        DATASERVICE_API_METHOD_APP_TRANSACTION_READ, dreq.hdr.child_index,
+        status, payload.data(), payload.size());
+
+    return retval;
+}
+
+/**
+ * \brief Return true if the next popped request matches this request.
+ *
+ * \param child_index       The child index for this request.
+ * \param artifact_id       The artifact_id for this request.
+ */
+bool mock_dataservice::mock_dataservice::
+    request_matches_payload_artifact_read(
+        uint32_t child_index, const uint8_t* artifact_id)
+{
+    bool retval = false;
+    void* val = nullptr;
+    uint32_t size = 0U;
+    const uint8_t* breq = nullptr;
+    uint32_t nmethod = 0U, method = 0U;
+    dataservice_request_payload_artifact_read_t dreq;
+
+    /* read a request from the test socket. */
+    if (AGENTD_STATUS_SUCCESS != ipc_read_data_block(testsock, &val, &size))
+    {
+        retval = false;
+        goto done;
+    }
+
+    /* make working with the request more convenient. */
+    breq = (const uint8_t*)val;
+
+    /* the payload should be at least large enough for the method. */
+    if (size < sizeof(uint32_t))
+    {
+        retval = false;
+        goto cleanup_val;
+    }
+
+    /* get the method. */
+    memcpy(&nmethod, breq, sizeof(uint32_t));
+    method = htonl(nmethod);
+
+    /* increment breq past command. */
+    breq += sizeof(uint32_t);
+
+    /* decrement size. */
+    size -= sizeof(uint32_t);
+
+    /* verify the method. */
+    if (DATASERVICE_API_METHOD_APP_ARTIFACT_READ != method)
+    {
+        retval = false;
+        goto cleanup_val;
+    }
+
+    /* parse the requset payload. */
+    if (AGENTD_STATUS_SUCCESS !=
+        dataservice_decode_request_payload_artifact_read(
+            breq, size, &dreq))
+    {
+        retval = false;
+        goto cleanup_val;
+    }
+
+    /* verify the request. */
+    if (
+        child_index != dreq.hdr.child_index || 0 != memcmp(artifact_id, dreq.artifact_id, 16))
+    {
+        retval = false;
+        goto cleanup_val;
+    }
+
+    /* successful match. */
+    retval = true;
+    goto cleanup_val;
+
+cleanup_val:
+    free(val);
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Return true if the next popped request matches this request.
+ *
+ * \param child_index       The child index for this request.
+ * \param block_height      The block height of the request.
+ */
+bool mock_dataservice::mock_dataservice::
+    request_matches_block_id_by_height_read(
+        uint32_t child_index, uint64_t block_height)
+{
+    bool retval = false;
+    void* val = nullptr;
+    uint32_t size = 0U;
+    const uint8_t* breq = nullptr;
+    uint32_t nmethod = 0U, method = 0U;
+    dataservice_request_block_id_by_height_read_t dreq;
+
+    /* read a request from the test socket. */
+    if (AGENTD_STATUS_SUCCESS != ipc_read_data_block(testsock, &val, &size))
+    {
+        retval = false;
+        goto done;
+    }
+
+    /* make working with the request more convenient. */
+    breq = (const uint8_t*)val;
+
+    /* the payload should be at least large enough for the method. */
+    if (size < sizeof(uint32_t))
+    {
+        retval = false;
+        goto cleanup_val;
+    }
+
+    /* get the method. */
+    memcpy(&nmethod, breq, sizeof(uint32_t));
+    method = htonl(nmethod);
+
+    /* increment breq past command. */
+    breq += sizeof(uint32_t);
+
+    /* decrement size. */
+    size -= sizeof(uint32_t);
+
+    /* verify the method. */
+    if (DATASERVICE_API_METHOD_APP_BLOCK_ID_BY_HEIGHT_READ != method)
+    {
+        retval = false;
+        goto cleanup_val;
+    }
+
+    /* parse the requset payload. */
+    if (AGENTD_STATUS_SUCCESS !=
+        dataservice_decode_request_block_id_by_height_read(
+            breq, size, &dreq))
+    {
+        retval = false;
+        goto cleanup_val;
+    }
+
+    /* verify the request. */
+    if (
+        child_index != dreq.hdr.child_index || block_height != dreq.block_height)
+    {
+        retval = false;
+        goto cleanup_val;
+    }
+
+    /* successful match. */
+    retval = true;
+    goto cleanup_val;
+
+cleanup_val:
+    free(val);
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Return true if the next popped request is a block id link read request
+ * that matches this request.
+ *
+ * \param method            The API method of this request.
+ * \param child_index       The child index for this request.
+ * \param id                The id for this request.
+ */
+bool mock_dataservice::mock_dataservice::
+    request_matches_block_id_link_read(
+        uint32_t method, uint32_t child_index, const uint8_t* id)
+{
+    bool retval = false;
+    void* val = nullptr;
+    uint32_t size = 0U;
+    const uint8_t* breq = nullptr;
+    uint32_t nmethod = 0U, req_method = 0U;
+    dataservice_request_block_id_link_read_t dreq;
+
+    /* read a request from the test socket. */
+    if (AGENTD_STATUS_SUCCESS != ipc_read_data_block(testsock, &val, &size))
+    {
+        retval = false;
+        goto done;
+    }
+
+    /* make working with the request more convenient. */
+    breq = (const uint8_t*)val;
+
+    /* the payload should be at least large enough for the method. */
+    if (size < sizeof(uint32_t))
+    {
+        retval = false;
+        goto cleanup_val;
+    }
+
+    /* get the method. */
+    memcpy(&nmethod, breq, sizeof(uint32_t));
+    req_method = htonl(nmethod);
+
+    /* increment breq past command. */
+    breq += sizeof(uint32_t);
+
+    /* decrement size. */
+    size -= sizeof(uint32_t);
+
+    /* verify the method. */
+    if (method != req_method)
+    {
+        retval = false;
+        goto cleanup_val;
+    }
+
+    /* parse the requset payload. */
+    if (AGENTD_STATUS_SUCCESS !=
+        dataservice_decode_request_block_id_link_read(breq, size, &dreq))
+    {
+        retval = false;
+        goto cleanup_val;
+    }
+
+    /* verify the request. */
+    if (
+        child_index != dreq.hdr.child_index
+     || 0 != memcmp(id, dreq.id, sizeof(dreq.id)))
+    {
+        retval = false;
+        goto cleanup_val;
+    }
+
+    /* successful match. */
+    retval = true;
+    goto cleanup_val;
+
+cleanup_val:
+    free(val);
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Return true if the next popped request matches this request.
+ *
+ * \param child_index       The child index for this request.
+ * \param block_id          The block id for this request.
+ */
+bool mock_dataservice::mock_dataservice::
+    request_matches_block_id_next_read(
+        uint32_t child_index, const uint8_t* block_id)
+{
+    return
+        request_matches_block_id_link_read(
+            DATASERVICE_API_METHOD_APP_BLOCK_ID_NEXT_READ, child_index, block_id);
+}
+
+/**
+ * \brief Return true if the next popped request matches this request.
+ *
+ * \param child_index       The child index for this request.
+ * \param block_id          The block id for this request.
+ */
+bool mock_dataservice::mock_dataservice::
+    request_matches_block_id_prev_read(
+        uint32_t child_index, const uint8_t* block_id)
+{
+    return
+        request_matches_block_id_link_read(
+            DATASERVICE_API_METHOD_APP_BLOCK_ID_PREV_READ, child_index, block_id);
+}
+
+/**
+ * \brief Return true if the next popped request matches this request.
+ *
+ * \param child_index       The child index for this request.
+ * \param txn_id            The transaction id for this request.
+ */
+bool mock_dataservice::mock_dataservice::
+    request_matches_block_id_with_transaction_read(
+        uint32_t child_index, const uint8_t* txn_id)
+{
+    return
+        request_matches_block_id_link_read(
+            DATASERVICE_API_METHOD_APP_BLOCK_ID_WITH_TRANSACTION_READ, child_index, txn_id);
+}
+
+/**
+ * \brief Return true if the next popped request matches this request.
+ *
+ * \param child_index       The child index for this request.
+ */
+bool mock_dataservice::mock_dataservice::
+    request_matches_block_id_latest_read(
+        uint32_t child_index)
+{
+    bool retval = false;
+    void* val = nullptr;
+    uint32_t size = 0U;
+    const uint8_t* breq = nullptr;
+    uint32_t nmethod = 0U, method = 0U;
+    dataservice_request_block_id_latest_read_t dreq;
+
+    /* read a request from the test socket. */
+    if (AGENTD_STATUS_SUCCESS != ipc_read_data_block(testsock, &val, &size))
+    {
+        retval = false;
+        goto done;
+    }
+
+    /* make working with the request more convenient. */
+    breq = (const uint8_t*)val;
+
+    /* the payload should be at least large enough for the method. */
+    if (size < sizeof(uint32_t))
+    {
+        retval = false;
+        goto cleanup_val;
+    }
+
+    /* get the method. */
+    memcpy(&nmethod, breq, sizeof(uint32_t));
+    method = htonl(nmethod);
+
+    /* increment breq past command. */
+    breq += sizeof(uint32_t);
+
+    /* decrement size. */
+    size -= sizeof(uint32_t);
+
+    /* verify the method. */
+    if (DATASERVICE_API_METHOD_APP_BLOCK_ID_LATEST_READ != method)
+    {
+        retval = false;
+        goto cleanup_val;
+    }
+
+    /* parse the requset payload. */
+    if (AGENTD_STATUS_SUCCESS !=
+        dataservice_decode_request_block_id_latest_read(
+            breq, size, &dreq))
+    {
+        retval = false;
+        goto cleanup_val;
+    }
+
+    /* verify the request. */
+    if (
+        child_index != dreq.hdr.child_index)
+    {
+        retval = false;
+        goto cleanup_val;
+    }
+
+    /* successful match. */
+    retval = true;
+    goto cleanup_val;
+
+cleanup_val:
+    free(val);
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Return true if the next popped request matches this request.
+ *
+ * \param child_index       The child index for this request.
+ * \param block_id          The block id for this request.
+ * \param cert_size         The cert_size for this request.
+ * \param cert              The cert for this request.
+ */
+bool mock_dataservice::mock_dataservice::
+    request_matches_block_make(
+        uint32_t child_index, const uint8_t* block_id, size_t cert_size,
+        const uint8_t* cert)
+{
+    bool retval = false;
+    void* val = nullptr;
+    uint32_t size = 0U;
+    const uint8_t* breq = nullptr;
+    uint32_t nmethod = 0U, method = 0U;
+    dataservice_request_block_make_t dreq;
+
+    /* read a request from the test socket. */
+    if (AGENTD_STATUS_SUCCESS != ipc_read_data_block(testsock, &val, &size))
+    {
+        retval = false;
+        goto done;
+    }
+
+    /* make working with the request more convenient. */
+    breq = (const uint8_t*)val;
+
+    /* the payload should be at least large enough for the method. */
+    if (size < sizeof(uint32_t))
+    {
+        retval = false;
+        goto cleanup_val;
+    }
+
+    /* get the method. */
+    memcpy(&nmethod, breq, sizeof(uint32_t));
+    method = htonl(nmethod);
+
+    /* increment breq past command. */
+    breq += sizeof(uint32_t);
+
+    /* decrement size. */
+    size -= sizeof(uint32_t);
+
+    /* verify the method. */
+    if (DATASERVICE_API_METHOD_APP_BLOCK_WRITE != method)
+    {
+        retval = false;
+        goto cleanup_val;
+    }
+
+    /* parse the requset payload. */
+    if (AGENTD_STATUS_SUCCESS !=
+        dataservice_decode_request_block_make(
+            breq, size, &dreq))
+    {
+        retval = false;
+        goto cleanup_val;
+    }
+
+    /* verify the request. */
+    if (
+        child_index != dreq.hdr.child_index || ((NULL != block_id) && (0 != memcmp(block_id, dreq.block_id, 16))) || ((0 != cert_size) && (cert_size != dreq.cert_size)) || ((NULL != cert) && (0 != memcmp(cert, dreq.cert, cert_size))))
+    {
+        retval = false;
+        goto cleanup_val;
+    }
+
+    /* successful match. */
+    retval = true;
+    goto cleanup_val;
+
+cleanup_val:
+    free(val);
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Return true if the next popped request matches this request.
+ *
+ * \param child_index       The child index for this request.
+ * \param block_id          The block id for this request.
+ */
+bool mock_dataservice::mock_dataservice::
+    request_matches_block_read(
+        uint32_t child_index, const uint8_t* block_id)
+{
+    bool retval = false;
+    void* val = nullptr;
+    uint32_t size = 0U;
+    const uint8_t* breq = nullptr;
+    uint32_t nmethod = 0U, method = 0U;
+    dataservice_request_block_read_t dreq;
+
+    /* read a request from the test socket. */
+    if (AGENTD_STATUS_SUCCESS != ipc_read_data_block(testsock, &val, &size))
+    {
+        retval = false;
+        goto done;
+    }
+
+    /* make working with the request more convenient. */
+    breq = (const uint8_t*)val;
+
+    /* the payload should be at least large enough for the method. */
+    if (size < sizeof(uint32_t))
+    {
+        retval = false;
+        goto cleanup_val;
+    }
+
+    /* get the method. */
+    memcpy(&nmethod, breq, sizeof(uint32_t));
+    method = htonl(nmethod);
+
+    /* increment breq past command. */
+    breq += sizeof(uint32_t);
+
+    /* decrement size. */
+    size -= sizeof(uint32_t);
+
+    /* verify the method. */
+    if (DATASERVICE_API_METHOD_APP_BLOCK_READ != method)
+    {
+        retval = false;
+        goto cleanup_val;
+    }
+
+    /* parse the requset payload. */
+    if (AGENTD_STATUS_SUCCESS !=
+        dataservice_decode_request_block_read(
+            breq, size, &dreq))
+    {
+        retval = false;
+        goto cleanup_val;
     }
 
     /* verify the request. */
     if (
-        child_index != dreq.hdr.child_index || 0 != memcmp(artifact_id, dreq.artifact_id, 16))
+        child_index != dreq.hdr.child_index || 0 != memcmp(block_id, dreq.block_id, 16))
     {
         retval = false;
         goto cleanup_val;
@@ -1409,18 +2333,18 @@ done:
  * \brief Return true if the next popped request matches this request.
  *
  * \param child_index       The child index for this request.
- * \param block_height      The block height of the request.
+ * \param txn_id            The transaction id for this request.
  */
 bool mock_dataservice::mock_dataservice::
-    request_matches_block_id_by_height_read(
-        uint32_t child_index, uint64_t block_height)
+    request_matches_canonized_transaction_get(
+        uint32_t child_index, const uint8_t* txn_id)
 {
     bool retval = false;
     void* val = nullptr;
     uint32_t size = 0U;
     const uint8_t* breq = nullptr;
     uint32_t nmethod = 0U, method = 0U;
-    dataservice_request_block_id_by_height_read_t dreq;
+    dataservice_request_canonized_transaction_get_t dreq;
 
     /* read a request from the test socket. */
     if (AGENTD_STATUS_SUCCESS != ipc_read_data_block(testsock, &val, &size))
@@ -1450,7 +2374,7 @@ bool mock_dataservice::mock_dataservice::
     size -= sizeof(uint32_t);
 
     /* verify the method. */
-    if (DATASERVICE_API_METHOD_APP_BLOCK_ID_BY_HEIGHT_READ != method)
+    if (DATASERVICE_API_METHOD_APP_TRANSACTION_READ != method)
     {
         retval = false;
         goto cleanup_val;
@@ -1458,7 +2382,7 @@ bool mock_dataservice::mock_dataservice::
 
     /* parse the requset payload. */
     if (AGENTD_STATUS_SUCCESS !=
-        dataservice_decode_request_block_id_by_height_read(
+        dataservice_decode_request_canonized_transaction_get(
             breq, size, &dreq))
     {
         retval = false;
@@ -1467,7 +2391,7 @@ bool mock_dataservice::mock_dataservice::
 
     /* verify the request. */
     if (
-        child_index != dreq.hdr.child_index || block_height != dreq.block_height)
+        child_index != dreq.hdr.child_index || 0 != memcmp(txn_id, dreq.txn_id, 16))
     {
         retval = false;
         goto cleanup_val;
@@ -1490,7 +2414,7 @@ done:
  * \param child_index       The child index for this request.
  */
 bool mock_dataservice::mock_dataservice::
-    request_matches_block_id_latest_read(
+    request_matches_child_context_close(
         uint32_t child_index)
 {
     bool retval = false;
@@ -1498,7 +2422,7 @@ bool mock_dataservice::mock_dataservice::
     uint32_t size = 0U;
     const uint8_t* breq = nullptr;
     uint32_t nmethod = 0U, method = 0U;
-    dataservice_request_block_id_latest_read_t dreq;
+    dataservice_request_child_context_close_t dreq;
 
     /* read a request from the test socket. */
     if (AGENTD_STATUS_SUCCESS != ipc_read_data_block(testsock, &val, &size))
@@ -1528,7 +2452,7 @@ bool mock_dataservice::mock_dataservice::
     size -= sizeof(uint32_t);
 
     /* verify the method. */
-    if (DATASERVICE_API_METHOD_APP_BLOCK_ID_LATEST_READ != method)
+    if (DATASERVICE_API_METHOD_LL_CHILD_CONTEXT_CLOSE != method)
     {
         retval = false;
         goto cleanup_val;
@@ -1536,7 +2460,7 @@ bool mock_dataservice::mock_dataservice::
 
     /* parse the requset payload. */
     if (AGENTD_STATUS_SUCCESS !=
-        dataservice_decode_request_block_id_latest_read(
+        dataservice_decode_request_child_context_close(
             breq, size, &dreq))
     {
         retval = false;
@@ -1565,22 +2489,18 @@ done:
 /**
  * \brief Return true if the next popped request matches this request.
  *
- * \param child_index       The child index for this request.
- * \param block_id          The block id for this request.
- * \param cert_size         The cert_size for this request.
- * \param cert              The cert for this request.
+ * \param caps              The bitset for this child context.
  */
 bool mock_dataservice::mock_dataservice::
-    request_matches_block_make(
-        uint32_t child_index, const uint8_t* block_id, size_t cert_size,
-        const uint8_t* cert)
+    request_matches_child_context_create(
+        const void* caps)
 {
     bool retval = false;
     void* val = nullptr;
     uint32_t size = 0U;
     const uint8_t* breq = nullptr;
     uint32_t nmethod = 0U, method = 0U;
-    dataservice_request_block_make_t dreq;
+    dataservice_request_child_context_create_t dreq;
 
     /* read a request from the test socket. */
     if (AGENTD_STATUS_SUCCESS != ipc_read_data_block(testsock, &val, &size))
@@ -1610,7 +2530,7 @@ bool mock_dataservice::mock_dataservice::
     size -= sizeof(uint32_t);
 
     /* verify the method. */
-    if (DATASERVICE_API_METHOD_APP_BLOCK_WRITE != method)
+    if (DATASERVICE_API_METHOD_LL_CHILD_CONTEXT_CREATE != method)
     {
         retval = false;
         goto cleanup_val;
@@ -1618,7 +2538,7 @@ bool mock_dataservice::mock_dataservice::
 
     /* parse the requset payload. */
     if (AGENTD_STATUS_SUCCESS !=
-        dataservice_decode_request_block_make(
+        dataservice_decode_request_child_context_create(
             breq, size, &dreq))
     {
         retval = false;
@@ -1627,7 +2547,7 @@ bool mock_dataservice::mock_dataservice::
 
     /* verify the request. */
     if (
-        child_index != dreq.hdr.child_index || ((NULL != block_id) && (0 != memcmp(block_id, dreq.block_id, 16))) || ((0 != cert_size) && (cert_size != dreq.cert_size)) || ((NULL != cert) && (0 != memcmp(cert, dreq.cert, cert_size))))
+        0 != memcmp(caps, dreq.caps, sizeof(dreq.caps)))
     {
         retval = false;
         goto cleanup_val;
@@ -1648,18 +2568,18 @@ done:
  * \brief Return true if the next popped request matches this request.
  *
  * \param child_index       The child index for this request.
- * \param block_id          The block id for this request.
+ * \param key               The key for this global setting.
  */
 bool mock_dataservice::mock_dataservice::
-    request_matches_block_read(
-        uint32_t child_index, const uint8_t* block_id)
+    request_matches_global_setting_get(
+        uint32_t child_index, uint64_t key)
 {
     bool retval = false;
     void* val = nullptr;
     uint32_t size = 0U;
     const uint8_t* breq = nullptr;
     uint32_t nmethod = 0U, method = 0U;
-    dataservice_request_block_read_t dreq;
+    dataservice_request_global_setting_get_t dreq;
 
     /* read a request from the test socket. */
     if (AGENTD_STATUS_SUCCESS != ipc_read_data_block(testsock, &val, &size))
@@ -1689,7 +2609,7 @@ bool mock_dataservice::mock_dataservice::
     size -= sizeof(uint32_t);
 
     /* verify the method. */
-    if (DATASERVICE_API_METHOD_APP_BLOCK_READ != method)
+    if (DATASERVICE_API_METHOD_APP_GLOBAL_SETTING_READ != method)
     {
         retval = false;
         goto cleanup_val;
@@ -1697,7 +2617,7 @@ bool mock_dataservice::mock_dataservice::
 
     /* parse the requset payload. */
     if (AGENTD_STATUS_SUCCESS !=
-        dataservice_decode_request_block_read(
+        dataservice_decode_request_global_setting_get(
             breq, size, &dreq))
     {
         retval = false;
@@ -1706,7 +2626,7 @@ bool mock_dataservice::mock_dataservice::
 
     /* verify the request. */
     if (
-        child_index != dreq.hdr.child_index || 0 != memcmp(block_id, dreq.block_id, 16))
+        child_index != dreq.hdr.child_index || key != dreq.key)
     {
         retval = false;
         goto cleanup_val;
@@ -1727,18 +2647,21 @@ done:
  * \brief Return true if the next popped request matches this request.
  *
  * \param child_index       The child index for this request.
- * \param txn_id            The transaction id for this request.
+ * \param key               The key for this global setting.
+ * \param val_size          The value size for this global setting.
+ * \param val               The value.
  */
 bool mock_dataservice::mock_dataservice::
-    request_matches_canonized_transaction_get(
-        uint32_t child_index, const uint8_t* txn_id)
+    request_matches_global_setting_set(
+        uint32_t child_index, uint64_t key, size_t val_size,
+        const void* gval)
 {
     bool retval = false;
     void* val = nullptr;
     uint32_t size = 0U;
     const uint8_t* breq = nullptr;
     uint32_t nmethod = 0U, method = 0U;
-    dataservice_request_canonized_transaction_get_t dreq;
+    dataservice_request_global_setting_set_t dreq;
 
     /* read a request from the test socket. */
     if (AGENTD_STATUS_SUCCESS != ipc_read_data_block(testsock, &val, &size))
@@ -1768,7 +2691,7 @@ bool mock_dataservice::mock_dataservice::
     size -= sizeof(uint32_t);
 
     /* verify the method. */
-    if (DATASERVICE_API_METHOD_APP_TRANSACTION_READ != method)
+    if (DATASERVICE_API_METHOD_APP_GLOBAL_SETTING_WRITE != method)
     {
         retval = false;
         goto cleanup_val;
@@ -1776,7 +2699,7 @@ bool mock_dataservice::mock_dataservice::
 
     /* parse the requset payload. */
     if (AGENTD_STATUS_SUCCESS !=
-        dataservice_decode_request_canonized_transaction_get(
+        dataservice_decode_request_global_setting_set(
             breq, size, &dreq))
     {
         retval = false;
@@ -1785,7 +2708,7 @@ bool mock_dataservice::mock_dataservice::
 
     /* verify the request. */
     if (
-        child_index != dreq.hdr.child_index || 0 != memcmp(txn_id, dreq.txn_id, 16))
+        child_index != dreq.hdr.child_index || key != dreq.key || val_size != dreq.val_size || 0 != memcmp(gval, dreq.val, val_size))
     {
         retval = false;
         goto cleanup_val;
@@ -1806,17 +2729,18 @@ done:
  * \brief Return true if the next popped request matches this request.
  *
  * \param child_index       The child index for this request.
+ * \param txn_id            The transaction id for this request.
  */
 bool mock_dataservice::mock_dataservice::
-    request_matches_child_context_close(
-        uint32_t child_index)
+    request_matches_transaction_drop(
+        uint32_t child_index, const uint8_t* txn_id)
 {
     bool retval = false;
     void* val = nullptr;
     uint32_t size = 0U;
     const uint8_t* breq = nullptr;
     uint32_t nmethod = 0U, method = 0U;
-    dataservice_request_child_context_close_t dreq;
+    dataservice_request_transaction_drop_t dreq;
 
     /* read a request from the test socket. */
     if (AGENTD_STATUS_SUCCESS != ipc_read_data_block(testsock, &val, &size))
@@ -1846,7 +2770,7 @@ bool mock_dataservice::mock_dataservice::
     size -= sizeof(uint32_t);
 
     /* verify the method. */
-    if (DATASERVICE_API_METHOD_LL_CHILD_CONTEXT_CLOSE != method)
+    if (DATASERVICE_API_METHOD_APP_PQ_TRANSACTION_DROP != method)
     {
         retval = false;
         goto cleanup_val;
@@ -1854,7 +2778,7 @@ bool mock_dataservice::mock_dataservice::
 
     /* parse the requset payload. */
     if (AGENTD_STATUS_SUCCESS !=
-        dataservice_decode_request_child_context_close(
+        dataservice_decode_request_transaction_drop(
             breq, size, &dreq))
     {
         retval = false;
@@ -1863,7 +2787,7 @@ bool mock_dataservice::mock_dataservice::
 
     /* verify the request. */
     if (
-        child_index != dreq.hdr.child_index)
+        child_index != dreq.hdr.child_index || 0 != memcmp(txn_id, dreq.txn_id, 16))
     {
         retval = false;
         goto cleanup_val;
@@ -1883,18 +2807,19 @@ done:
 /**
  * \brief Return true if the next popped request matches this request.
  *
- * \param caps              The bitset for this child context.
+ * \param child_index       The child index for this request.
+ * \param txn_id            The transaction id for this request.
  */
 bool mock_dataservice::mock_dataservice::
-    request_matches_child_context_create(
-        const void* caps)
+    request_matches_transaction_promote(
+        uint32_t child_index, const uint8_t* txn_id)
 {
     bool retval = false;
     void* val = nullptr;
     uint32_t size = 0U;
     const uint8_t* breq = nullptr;
     uint32_t nmethod = 0U, method = 0U;
-    dataservice_request_child_context_create_t dreq;
+    dataservice_request_transaction_promote_t dreq;
 
     /* read a request from the test socket. */
     if (AGENTD_STATUS_SUCCESS != ipc_read_data_block(testsock, &val, &size))
@@ -1924,7 +2849,7 @@ bool mock_dataservice::mock_dataservice::
     size -= sizeof(uint32_t);
 
     /* verify the method. */
-    if (DATASERVICE_API_METHOD_LL_CHILD_CONTEXT_CREATE != method)
+    if (DATASERVICE_API_METHOD_APP_PQ_TRANSACTION_PROMOTE != method)
     {
         retval = false;
         goto cleanup_val;
@@ -1932,7 +2857,7 @@ bool mock_dataservice::mock_dataservice::
 
     /* parse the requset payload. */
     if (AGENTD_STATUS_SUCCESS !=
-        dataservice_decode_request_child_context_create(
+        dataservice_decode_request_transaction_promote(
             breq, size, &dreq))
     {
         retval = false;
@@ -1941,7 +2866,7 @@ bool mock_dataservice::mock_dataservice::
 
     /* verify the request. */
     if (
-        0 != memcmp(caps, dreq.caps, sizeof(dreq.caps)))
+        child_index != dreq.hdr.child_index || 0 != memcmp(txn_id, dreq.txn_id, 16))
     {
         retval = false;
         goto cleanup_val;
@@ -1962,18 +2887,18 @@ done:
  * \brief Return true if the next popped request matches this request.
  *
  * \param child_index       The child index for this request.
- * \param key               The key for this global setting.
+ * \param txn_id            The transaction id for this request.
  */
 bool mock_dataservice::mock_dataservice::
-    request_matches_global_setting_get(
-        uint32_t child_index, uint64_t key)
+    request_matches_transaction_get(
+        uint32_t child_index, const uint8_t* txn_id)
 {
     bool retval = false;
     void* val = nullptr;
     uint32_t size = 0U;
     const uint8_t* breq = nullptr;
     uint32_t nmethod = 0U, method = 0U;
-    dataservice_request_global_setting_get_t dreq;
+    dataservice_request_transaction_get_t dreq;
 
     /* read a request from the test socket. */
     if (AGENTD_STATUS_SUCCESS != ipc_read_data_block(testsock, &val, &size))
@@ -2003,7 +2928,7 @@ bool mock_dataservice::mock_dataservice::
     size -= sizeof(uint32_t);
 
     /* verify the method. */
-    if (DATASERVICE_API_METHOD_APP_GLOBAL_SETTING_READ != method)
+    if (DATASERVICE_API_METHOD_APP_PQ_TRANSACTION_READ != method)
     {
         retval = false;
         goto cleanup_val;
@@ -2011,7 +2936,7 @@ bool mock_dataservice::mock_dataservice::
 
     /* parse the requset payload. */
     if (AGENTD_STATUS_SUCCESS !=
-        dataservice_decode_request_global_setting_get(
+        dataservice_decode_request_transaction_get(
             breq, size, &dreq))
     {
         retval = false;
@@ -2020,7 +2945,7 @@ bool mock_dataservice::mock_dataservice::
 
     /* verify the request. */
     if (
-        child_index != dreq.hdr.child_index || key != dreq.key)
+        child_index != dreq.hdr.child_index || 0 != memcmp(txn_id, dreq.txn_id, 16))
     {
         retval = false;
         goto cleanup_val;
@@ -2041,21 +2966,19 @@ done:
  * \brief Return true if the next popped request matches this request.
  *
  * \param child_index       The child index for this request.
- * \param key               The key for this global setting.
- * \param val_size          The value size for this global setting.
- * \param val               The value.
+ * \param txn_id            The first transaction id for this request.
+ * \param max_count         The maximum count for this request.
  */
 bool mock_dataservice::mock_dataservice::
-    request_matches_global_setting_set(
-        uint32_t child_index, uint64_t key, size_t val_size,
-        const void* gval)
+    request_matches_transaction_list_get(
+        uint32_t child_index, const uint8_t* txn_id, uint32_t max_count)
 {
     bool retval = false;
     void* val = nullptr;
     uint32_t size = 0U;
     const uint8_t* breq = nullptr;
     uint32_t nmethod = 0U, method = 0U;
-    dataservice_request_global_setting_set_t dreq;
+    dataservice_request_transaction_list_get_t dreq;
 
     /* read a request from the test socket. */
     if (AGENTD_STATUS_SUCCESS != ipc_read_data_block(testsock, &val, &size))
@@ -2085,15 +3008,15 @@ bool mock_dataservice::mock_dataservice::
     size -= sizeof(uint32_t);
 
     /* verify the method. */
-    if (DATASERVICE_API_METHOD_APP_GLOBAL_SETTING_WRITE != method)
+    if (DATASERVICE_API_METHOD_APP_PQ_TRANSACTION_LIST_READ != method)
     {
         retval = false;
         goto cleanup_val;
     }
 
-    /* parse the requset payload. */
+    /* parse the request payload. */
     if (AGENTD_STATUS_SUCCESS !=
-        dataservice_decode_request_global_setting_set(
+        dataservice_decode_request_transaction_list_get(
             breq, size, &dreq))
     {
         retval = false;
@@ -2102,7 +3025,9 @@ bool mock_dataservice::mock_dataservice::
 
     /* verify the request. */
     if (
-        child_index != dreq.hdr.child_index || key != dreq.key || val_size != dreq.val_size || 0 != memcmp(gval, dreq.val, val_size))
+        child_index != dreq.hdr.child_index
+     || 0 != memcmp(txn_id, dreq.txn_id, 16)
+     || max_count != dreq.max_count)
     {
         retval = false;
         goto cleanup_val;
@@ -2123,18 +3048,21 @@ done:
  * \brief Return true if the next popped request matches this request.
  *
  * \param child_index       The child index for this request.
- * \param txn_id            The transaction id for this request.
+ * \param start_height      The start height for this request.
+ * \param max_count         The maximum count for this request.
+ * \param max_bytes         The maximum bytes for this request.
  */
 bool mock_dataservice::mock_dataservice::
-    request_matches_transaction_drop(
-        uint32_t child_index, const uint8_t* txn_id)
+    request_matches_block_range_get(
+        uint32_t child_index, uint64_t start_height, uint32_t max_count,
+        uint32_t max_bytes)
 {
     bool retval = false;
     void* val = nullptr;
     uint32_t size = 0U;
     const uint8_t* breq = nullptr;
     uint32_t nmethod = 0U, method = 0U;
-    dataservice_request_transaction_drop_t dreq;
+    dataservice_request_block_range_get_t dreq;
 
     /* read a request from the test socket. */
     if (AGENTD_STATUS_SUCCESS != ipc_read_data_block(testsock, &val, &size))
@@ -2164,15 +3092,15 @@ bool mock_dataservice::mock_dataservice::
     size -= sizeof(uint32_t);
 
     /* verify the method. */
-    if (DATASERVICE_API_METHOD_APP_PQ_TRANSACTION_DROP != method)
+    if (DATASERVICE_API_METHOD_APP_BLOCK_RANGE_READ != method)
     {
         retval = false;
         goto cleanup_val;
     }
 
-    /* parse the requset payload. */
+    /* parse the request payload. */
     if (AGENTD_STATUS_SUCCESS !=
-        dataservice_decode_request_transaction_drop(
+        dataservice_decode_request_block_range_get(
             breq, size, &dreq))
     {
         retval = false;
@@ -2181,7 +3109,10 @@ bool mock_dataservice::mock_dataservice::
 
     /* verify the request. */
     if (
-        child_index != dreq.hdr.child_index || 0 != memcmp(txn_id, dreq.txn_id, 16))
+        child_index != dreq.hdr.child_index
+     || start_height != dreq.start_height
+     || max_count != dreq.max_count
+     || max_bytes != dreq.max_bytes)
     {
         retval = false;
         goto cleanup_val;
@@ -2202,18 +3133,22 @@ done:
  * \brief Return true if the next popped request matches this request.
  *
  * \param child_index       The child index for this request.
- * \param txn_id            The transaction id for this request.
+ * \param artifact_id       The artifact id for this request.
+ * \param start_height      The start height for this request.
+ * \param start_index       The start index for this request.
+ * \param max_count         The maximum count for this request.
  */
 bool mock_dataservice::mock_dataservice::
-    request_matches_transaction_promote(
-        uint32_t child_index, const uint8_t* txn_id)
+    request_matches_artifact_transaction_list_get(
+        uint32_t child_index, const uint8_t* artifact_id,
+        uint64_t start_height, uint32_t start_index, uint32_t max_count)
 {
     bool retval = false;
     void* val = nullptr;
     uint32_t size = 0U;
     const uint8_t* breq = nullptr;
     uint32_t nmethod = 0U, method = 0U;
-    dataservice_request_transaction_promote_t dreq;
+    dataservice_request_artifact_transaction_list_get_t dreq;
 
     /* read a request from the test socket. */
     if (AGENTD_STATUS_SUCCESS != ipc_read_data_block(testsock, &val, &size))
@@ -2243,15 +3178,15 @@ bool mock_dataservice::mock_dataservice::
     size -= sizeof(uint32_t);
 
     /* verify the method. */
-    if (DATASERVICE_API_METHOD_APP_PQ_TRANSACTION_PROMOTE != method)
+    if (DATASERVICE_API_METHOD_APP_ARTIFACT_TRANSACTION_LIST_READ != method)
     {
         retval = false;
         goto cleanup_val;
     }
 
-    /* parse the requset payload. */
+    /* parse the request payload. */
     if (AGENTD_STATUS_SUCCESS !=
-        dataservice_decode_request_transaction_promote(
+        dataservice_decode_request_artifact_transaction_list_get(
             breq, size, &dreq))
     {
         retval = false;
@@ -2260,7 +3195,11 @@ bool mock_dataservice::mock_dataservice::
 
     /* verify the request. */
     if (
-        child_index != dreq.hdr.child_index || 0 != memcmp(txn_id, dreq.txn_id, 16))
+        child_index != dreq.hdr.child_index
+     || 0 != memcmp(artifact_id, dreq.artifact_id, sizeof(dreq.artifact_id))
+     || start_height != dreq.start_height
+     || start_index != dreq.start_index
+     || max_count != dreq.max_count)
     {
         retval = false;
         goto cleanup_val;
@@ -2281,18 +3220,21 @@ done:
  * \brief Return true if the next popped request matches this request.
  *
  * \param child_index       The child index for this request.
- * \param txn_id            The transaction id for this request.
+ * \param entries           The entries for this request.
+ * \param count             The number of entries for this request.
  */
 bool mock_dataservice::mock_dataservice::
-    request_matches_transaction_get(
-        uint32_t child_index, const uint8_t* txn_id)
+    request_matches_transaction_batch_update(
+        uint32_t child_index,
+        const data_transaction_batch_update_entry_t* entries, size_t count)
 {
     bool retval = false;
     void* val = nullptr;
     uint32_t size = 0U;
     const uint8_t* breq = nullptr;
+    const uint8_t* in = nullptr;
     uint32_t nmethod = 0U, method = 0U;
-    dataservice_request_transaction_get_t dreq;
+    dataservice_request_transaction_batch_update_t dreq;
 
     /* read a request from the test socket. */
     if (AGENTD_STATUS_SUCCESS != ipc_read_data_block(testsock, &val, &size))
@@ -2322,24 +3264,118 @@ bool mock_dataservice::mock_dataservice::
     size -= sizeof(uint32_t);
 
     /* verify the method. */
-    if (DATASERVICE_API_METHOD_APP_PQ_TRANSACTION_READ != method)
+    if (DATASERVICE_API_METHOD_APP_PQ_TRANSACTION_BATCH_UPDATE != method)
     {
         retval = false;
         goto cleanup_val;
     }
 
-    /* parse the requset payload. */
+    /* parse the request payload. */
     if (AGENTD_STATUS_SUCCESS !=
-        dataservice_decode_request_transaction_get(
+        dataservice_decode_request_transaction_batch_update(
             breq, size, &dreq))
     {
         retval = false;
         goto cleanup_val;
     }
 
+    /* verify the request header. */
+    if (child_index != dreq.hdr.child_index || count != dreq.count)
+    {
+        retval = false;
+        goto cleanup_val;
+    }
+
+    /* verify each entry. */
+    in = dreq.entries;
+    for (size_t i = 0; i < count; ++i)
+    {
+        uint32_t naction = 0U;
+        memcpy(&naction, in + sizeof(entries[i].txn_id), sizeof(naction));
+
+        if (
+            0 != memcmp(entries[i].txn_id, in, sizeof(entries[i].txn_id))
+         || entries[i].action != ntohl(naction))
+        {
+            retval = false;
+            goto cleanup_val;
+        }
+
+        in += DATASERVICE_TRANSACTION_BATCH_UPDATE_ENTRY_SIZE;
+    }
+
+    /* successful match. */
+    retval = true;
+    goto cleanup_val;
+
+cleanup_val:
+    free(val);
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Return true if the next popped request matches this request.
+ *
+ * \param child_index       The child index for this request.
+ * \param id                The id for this request.
+ */
+bool mock_dataservice::mock_dataservice::
+    request_matches_id_exists(
+        uint32_t child_index, const uint8_t* id)
+{
+    bool retval = false;
+    void* val = nullptr;
+    uint32_t size = 0U;
+    const uint8_t* breq = nullptr;
+    uint32_t nmethod = 0U, method = 0U;
+    dataservice_request_id_exists_t dreq;
+
+    /* read a request from the test socket. */
+    if (AGENTD_STATUS_SUCCESS != ipc_read_data_block(testsock, &val, &size))
+    {
+        retval = false;
+        goto done;
+    }
+
+    /* make working with the request more convenient. */
+    breq = (const uint8_t*)val;
+
+    /* the payload should be at least large enough for the method. */
+    if (size < sizeof(uint32_t))
+    {
+        retval = false;
+        goto cleanup_val;
+    }
+
+    /* get the method. */
+    memcpy(&nmethod, breq, sizeof(uint32_t));
+    method = htonl(nmethod);
+
+    /* increment breq past command. */
+    breq += sizeof(uint32_t);
+
+    /* decrement size. */
+    size -= sizeof(uint32_t);
+
+    /* verify the method. */
+    if (DATASERVICE_API_METHOD_APP_ID_EXISTS_READ != method)
+    {
+        retval = false;
+        goto cleanup_val;
+    }
+
+    /* parse the request payload. */
+    if (AGENTD_STATUS_SUCCESS !=
+        dataservice_decode_request_id_exists(breq, size, &dreq))
+    {
+        retval = false;
+        goto cleanup_val;
+    }
+
     /* verify the request. */
-    if (
-        child_index != dreq.hdr.child_index || 0 != memcmp(txn_id, dreq.txn_id, 16))
+    if (child_index != dreq.hdr.child_index || 0 != memcmp(id, dreq.id, 16))
     {
         retval = false;
         goto cleanup_val;
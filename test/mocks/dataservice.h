@@ -99,6 +99,39 @@ public:
                 std::ostream&)>
             cb);
 
+    /**
+         * \brief Register a mock callback for block_id_next_read.
+         *
+         * \param cb                The callback to register.
+         */
+    void register_callback_block_id_next_read(
+        std::function<
+            int(const dataservice_request_block_id_link_read_t&,
+                std::ostream&)>
+            cb);
+
+    /**
+         * \brief Register a mock callback for block_id_prev_read.
+         *
+         * \param cb                The callback to register.
+         */
+    void register_callback_block_id_prev_read(
+        std::function<
+            int(const dataservice_request_block_id_link_read_t&,
+                std::ostream&)>
+            cb);
+
+    /**
+         * \brief Register a mock callback for block_id_with_transaction_read.
+         *
+         * \param cb                The callback to register.
+         */
+    void register_callback_block_id_with_transaction_read(
+        std::function<
+            int(const dataservice_request_block_id_link_read_t&,
+                std::ostream&)>
+            cb);
+
     /**
          * \brief Register a mock callback for block_id_latest_read.
          *
@@ -220,6 +253,61 @@ public:
                 std::ostream&)>
             cb);
 
+    /**
+         * \brief Register a mock callback for transaction_list_get.
+         *
+         * \param cb                The callback to register.
+         */
+    void register_callback_transaction_list_get(
+        std::function<
+            int(const dataservice_request_transaction_list_get_t&,
+                std::ostream&)>
+            cb);
+
+    /**
+         * \brief Register a mock callback for block_range_get.
+         *
+         * \param cb                The callback to register.
+         */
+    void register_callback_block_range_get(
+        std::function<
+            int(const dataservice_request_block_range_get_t&,
+                std::ostream&)>
+            cb);
+
+    /**
+         * \brief Register a mock callback for artifact_transaction_list_get.
+         *
+         * \param cb                The callback to register.
+         */
+    void register_callback_artifact_transaction_list_get(
+        std::function<
+            int(const dataservice_request_artifact_transaction_list_get_t&,
+                std::ostream&)>
+            cb);
+
+    /**
+         * \brief Register a mock callback for transaction_batch_update.
+         *
+         * \param cb                The callback to register.
+         */
+    void register_callback_transaction_batch_update(
+        std::function<
+            int(const dataservice_request_transaction_batch_update_t&,
+                std::ostream&)>
+            cb);
+
+    /**
+         * \brief Register a mock callback for id_exists.
+         *
+         * \param cb                The callback to register.
+         */
+    void register_callback_id_exists(
+        std::function<
+            int(const dataservice_request_id_exists_t&,
+                std::ostream&)>
+            cb);
+
     /**
          * \brief Register a mock callback for transaction_get_first.
          *
@@ -260,6 +348,33 @@ public:
     bool request_matches_block_id_by_height_read(
         uint32_t child_index, uint64_t block_height);
 
+    /**
+         * \brief Return true if the next popped request matches this request.
+         *
+         * \param child_index       The child index for this request.
+         * \param block_id          The block id for this request.
+         */
+    bool request_matches_block_id_next_read(
+        uint32_t child_index, const uint8_t* block_id);
+
+    /**
+         * \brief Return true if the next popped request matches this request.
+         *
+         * \param child_index       The child index for this request.
+         * \param block_id          The block id for this request.
+         */
+    bool request_matches_block_id_prev_read(
+        uint32_t child_index, const uint8_t* block_id);
+
+    /**
+         * \brief Return true if the next popped request matches this request.
+         *
+         * \param child_index       The child index for this request.
+         * \param txn_id            The transaction id for this request.
+         */
+    bool request_matches_block_id_with_transaction_read(
+        uint32_t child_index, const uint8_t* txn_id);
+
     /**
          * \brief Return true if the next popped request matches this request.
          *
@@ -362,6 +477,60 @@ public:
     bool request_matches_transaction_get(
         uint32_t child_index, const uint8_t* txn_id);
 
+    /**
+         * \brief Return true if the next popped request matches this request.
+         *
+         * \param child_index       The child index for this request.
+         * \param txn_id            The first transaction id for this request.
+         * \param max_count         The maximum count for this request.
+         */
+    bool request_matches_transaction_list_get(
+        uint32_t child_index, const uint8_t* txn_id, uint32_t max_count);
+
+    /**
+         * \brief Return true if the next popped request matches this request.
+         *
+         * \param child_index       The child index for this request.
+         * \param start_height      The start height for this request.
+         * \param max_count         The maximum count for this request.
+         * \param max_bytes         The maximum bytes for this request.
+         */
+    bool request_matches_block_range_get(
+        uint32_t child_index, uint64_t start_height, uint32_t max_count,
+        uint32_t max_bytes);
+
+    /**
+         * \brief Return true if the next popped request matches this request.
+         *
+         * \param child_index       The child index for this request.
+         * \param artifact_id       The artifact id for this request.
+         * \param start_height      The start height for this request.
+         * \param start_index       The start index for this request.
+         * \param max_count         The maximum count for this request.
+         */
+    bool request_matches_artifact_transaction_list_get(
+        uint32_t child_index, const uint8_t* artifact_id,
+        uint64_t start_height, uint32_t start_index, uint32_t max_count);
+
+    /**
+         * \brief Return true if the next popped request matches this request.
+         *
+         * \param child_index       The child index for this request.
+         * \param entries           The entries for this request.
+         * \param count             The number of entries for this request.
+         */
+    bool request_matches_transaction_batch_update(
+        uint32_t child_index,
+        const data_transaction_batch_update_entry_t* entries, size_t count);
+
+    /**
+         * \brief Return true if the next popped request matches this request.
+         *
+         * \param child_index       The child index for this request.
+         * \param id                The id for this request.
+         */
+    bool request_matches_id_exists(uint32_t child_index, const uint8_t* id);
+
     /**
          * \brief Return true if the next popped request matches this request.
          *
@@ -383,6 +552,19 @@ public:
         uint32_t child_index, const uint8_t* txn_id,
         const uint8_t* artifact_id, size_t cert_size, const uint8_t* cert);
 
+    /**
+         * \brief Write a response that answers no request.
+         *
+         * This may only be called from a mock callback.  The response is
+         * written before the response to the request being handled.
+         *
+         * \param method    The method of this response.
+         * \param offset    The child offset of this response.
+         * \param status    The status code of this response.
+         */
+    void write_unmatched_response(
+        uint32_t method, uint32_t offset, uint32_t status);
+
 private:
     int datasock;
     bool running;
@@ -400,6 +582,18 @@ private:
         int(const dataservice_request_block_id_by_height_read_t&,
             std::ostream&)>
         block_id_by_height_read_callback;
+    std::function<
+        int(const dataservice_request_block_id_link_read_t&,
+            std::ostream&)>
+        block_id_next_read_callback;
+    std::function<
+        int(const dataservice_request_block_id_link_read_t&,
+            std::ostream&)>
+        block_id_prev_read_callback;
+    std::function<
+        int(const dataservice_request_block_id_link_read_t&,
+            std::ostream&)>
+        block_id_with_transaction_read_callback;
     std::function<
         int(const dataservice_request_block_id_latest_read_t&,
             std::ostream&)>
@@ -444,6 +638,26 @@ private:
         int(const dataservice_request_transaction_get_t&,
             std::ostream&)>
         transaction_get_callback;
+    std::function<
+        int(const dataservice_request_transaction_list_get_t&,
+            std::ostream&)>
+        transaction_list_get_callback;
+    std::function<
+        int(const dataservice_request_block_range_get_t&,
+            std::ostream&)>
+        block_range_get_callback;
+    std::function<
+        int(const dataservice_request_artifact_transaction_list_get_t&,
+            std::ostream&)>
+        artifact_transaction_list_get_callback;
+    std::function<
+        int(const dataservice_request_transaction_batch_update_t&,
+            std::ostream&)>
+        transaction_batch_update_callback;
+    std::function<
+        int(const dataservice_request_id_exists_t&,
+            std::ostream&)>
+        id_exists_callback;
     std::function<
         int(const dataservice_request_transaction_get_first_t&,
             std::ostream&)>
@@ -581,6 +795,61 @@ private:
     bool mock_decode_and_dispatch_transaction_get(
         const void* request, size_t payload_size);
 
+    /**
+         * \brief Mock for the transaction list get call.
+         *
+         * \param req       The request payload.
+         * \param size      The request payload size.
+         *
+         * \returns true if the request could be processed and false otherwise.
+         */
+    bool mock_decode_and_dispatch_transaction_list_get(
+        const void* request, size_t payload_size);
+
+    /**
+         * \brief Mock for the block range get call.
+         *
+         * \param req       The request payload.
+         * \param size      The request payload size.
+         *
+         * \returns true if the request could be processed and false otherwise.
+         */
+    bool mock_decode_and_dispatch_block_range_get(
+        const void* request, size_t payload_size);
+
+    /**
+         * \brief Mock for the artifact transaction list get call.
+         *
+         * \param req       The request payload.
+         * \param size      The request payload size.
+         *
+         * \returns true if the request could be processed and false otherwise.
+         */
+    bool mock_decode_and_dispatch_artifact_transaction_list_get(
+        const void* request, size_t payload_size);
+
+    /**
+         * \brief Mock for the transaction batch update call.
+         *
+         * \param req       The request payload.
+         * \param size      The request payload size.
+         *
+         * \returns true if the request could be processed and false otherwise.
+         */
+    bool mock_decode_and_dispatch_transaction_batch_update(
+        const void* request, size_t payload_size);
+
+    /**
+         * \brief Mock for the id exists call.
+         *
+         * \param req       The request payload.
+         * \param size      The request payload size.
+         *
+         * \returns true if the request could be processed and false otherwise.
+         */
+    bool mock_decode_and_dispatch_id_exists(
+        const void* request, size_t payload_size);
+
     /**
          * \brief Mock for the transaction drop call.
          *
@@ -647,6 +916,30 @@ private:
     bool mock_decode_and_dispatch_block_id_by_height_read(
         const void* request, size_t payload_size);
 
+    /**
+         * \brief Mock for the block id next, prev, and with transaction read
+         * calls.
+         *
+         * \param method    The API method of this request.
+         * \param req       The request payload.
+         * \param size      The request payload size.
+         *
+         * \returns true if the request could be processed and false otherwise.
+         */
+    bool mock_decode_and_dispatch_block_id_link_read(
+        uint32_t method, const void* request, size_t payload_size);
+
+    /**
+         * \brief Return true if the next popped request is a block id link
+         * read request that matches this request.
+         *
+         * \param method            The API method of this request.
+         * \param child_index       The child index for this request.
+         * \param id                The id for this request.
+         */
+    bool request_matches_block_id_link_read(
+        uint32_t method, uint32_t child_index, const uint8_t* id);
+
     /**
          * \brief Mock for the block id latest read call.
          *
@@ -93,8 +93,8 @@ void notificationservice_isolation_test::setUp()
     /* spawn the notificationservice process. */
     notify_proc_status =
         notificationservice_proc(
-            &bconf, &conf, logsock, rclient1sock, rclient2sock, &notifypid,
-            false);
+            &bconf, &conf, logsock, rclient1sock, &rclient2sock, 1,
+            &notifypid, false);
 }
 
 void notificationservice_isolation_test::tearDown()
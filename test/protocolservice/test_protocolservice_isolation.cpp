@@ -6,12 +6,15 @@
  * \copyright 2021-2023 Velo Payments, Inc.  All rights reserved.
  */
 
+#include <agentd/inet.h>
 #include <agentd/protocolservice/api.h>
 #include <agentd/protocolservice/control_api.h>
 #include <agentd/status_codes.h>
 #include <iostream>
 #include <minunit/minunit.h>
+#include <poll.h>
 #include <string>
+#include <sys/socket.h>
 #include <unistd.h>
 #include <vcblockchain/protocol.h>
 #include <vcblockchain/protocol/data.h>
@@ -38,6 +41,12 @@ TEST(name) \
     fixture.tearDown(); \
 }
 
+#define BEGIN_TEST_F_WITH_READER(name) \
+TEST(name) \
+{ \
+    protocolservice_isolation_test fixture; \
+    fixture.setUp(true);
+
 /**
  * Test that we can spawn the unauthorized protocol service.
  */
@@ -866,34 +875,46 @@ BEGIN_TEST_F(get_latest_block_id_happy_path)
 END_TEST_F()
 
 /**
- * Test that a request to get a block id by height returns that block id.
+ * Test that responses from the dataservice that match no request are dropped,
+ * and that the response for a pending request is still delivered.
  */
-BEGIN_TEST_F(get_block_id_by_height_happy_path)
+BEGIN_TEST_F(dataservice_unmatched_response_dropped)
     uint32_t offset, status;
     uint64_t client_iv = 0;
     uint64_t server_iv = 0;
     const uint8_t EXPECTED_BLOCK_ID[16] = {
-        0x3d, 0x30, 0x6b, 0x0b, 0x73, 0x1d, 0x4b, 0xe9,
-        0x84, 0xda, 0x2a, 0xb8, 0xd7, 0x8f, 0x52, 0x30
+        0xb2, 0xf3, 0xfa, 0x16, 0x75, 0x9f, 0x4d, 0x4a,
+        0xaf, 0x6b, 0xf7, 0x68, 0x14, 0x35, 0x7d, 0x21
     };
-    const uint64_t EXPECTED_HEIGHT = 117;
     vccrypt_buffer_t shared_secret;
 
     /* register dataservice helper mocks. */
     TEST_ASSERT(0 == fixture.dataservice_mock_register_helper());
 
     /* mock the latest block id api call. */
-    fixture.dataservice->register_callback_block_id_by_height_read(
-        [&](const dataservice_request_block_id_by_height_read_t& req,
+    fixture.dataservice->register_callback_block_id_latest_read(
+        [&](const dataservice_request_block_id_latest_read_t&,
             std::ostream& payout) {
             void* payload = nullptr;
             size_t payload_size = 0U;
 
-            if (req.block_height != EXPECTED_HEIGHT)
-                return AGENTD_ERROR_DATASERVICE_NOT_FOUND;
+            /* a response for a child context that is not open. */
+            fixture.dataservice->write_unmatched_response(
+                DATASERVICE_API_METHOD_APP_BLOCK_ID_LATEST_READ,
+                fixture.EXPECTED_CHILD_INDEX + 1U, AGENTD_STATUS_SUCCESS);
+
+            /* the status written for an unknown method. */
+            fixture.dataservice->write_unmatched_response(
+                0xFFFFFFFFU, 0U,
+                AGENTD_ERROR_DATASERVICE_REQUEST_PACKET_INVALID_SIZE);
+
+            /* a child context create response with no pending open. */
+            fixture.dataservice->write_unmatched_response(
+                DATASERVICE_API_METHOD_LL_CHILD_CONTEXT_CREATE, 0U,
+                AGENTD_STATUS_SUCCESS);
 
             int retval =
-                dataservice_encode_response_block_id_by_height_read(
+                dataservice_encode_response_block_id_latest_read(
                     &payload, &payload_size, EXPECTED_BLOCK_ID);
             if (AGENTD_STATUS_SUCCESS != retval)
                 return retval;
@@ -923,25 +944,22 @@ BEGIN_TEST_F(get_block_id_by_height_happy_path)
     /* send the request. */
     TEST_ASSERT(
         AGENTD_STATUS_SUCCESS
-            == protocolservice_api_sendreq_block_id_by_height_get_block(
+            == protocolservice_api_sendreq_latest_block_id_get_block(
                     fixture.protosock, &fixture.suite, &client_iv,
-                    &shared_secret, EXPECTED_HEIGHT));
+                    &shared_secret));
 
     /* get the response. */
     vccrypt_buffer_t block_id;
     TEST_ASSERT(
         AGENTD_STATUS_SUCCESS
-            == protocolservice_api_recvresp_block_id_by_height_get_block(
+            == protocolservice_api_recvresp_latest_block_id_get_block(
                     fixture.protosock, &fixture.suite, &server_iv,
                     &shared_secret, &offset, &status, &block_id));
 
-    /* the status should indicate success. */
+    /* the response matching the request was delivered. */
     TEST_ASSERT(AGENTD_STATUS_SUCCESS == (int)status);
-    /* the offset should be zero. */
     TEST_ASSERT(0U == offset);
-    /* the block_id size should be the correct size. */
     TEST_ASSERT(block_id.size == sizeof(EXPECTED_BLOCK_ID));
-    /* the block id should match. */
     TEST_ASSERT(0 == memcmp(block_id.data, EXPECTED_BLOCK_ID, block_id.size));
 
     /* send the close request. */
@@ -951,7 +969,7 @@ BEGIN_TEST_F(get_block_id_by_height_happy_path)
                     fixture.protosock, &fixture.suite, &client_iv,
                     &shared_secret));
 
-    /* get the close response. */
+    /* the dataservice endpoint still closes the child context. */
     TEST_ASSERT(
         AGENTD_STATUS_SUCCESS
             == protocolservice_api_recvresp_close(
@@ -970,25 +988,1380 @@ BEGIN_TEST_F(get_block_id_by_height_happy_path)
 
     /* a latest block_id call should have been made. */
     TEST_EXPECT(
-        fixture.dataservice->request_matches_block_id_by_height_read(
-            fixture.EXPECTED_CHILD_INDEX, EXPECTED_HEIGHT));
+        fixture.dataservice->request_matches_block_id_latest_read(
+            fixture.EXPECTED_CHILD_INDEX));
+
+    /* verify proper connection teardown. */
+    TEST_EXPECT(0 == fixture.dataservice_mock_valid_connection_teardown());
+
+    /* clean up. */
+    dispose((disposable_t*)&block_id);
+    dispose((disposable_t*)&shared_secret);
+END_TEST_F()
+
+/**
+ * Test that pipelined requests for different data are answered in the order in
+ * which they were sent, each with the response to its own request.
+ */
+BEGIN_TEST_F(dataservice_pipelined_responses_in_order)
+    uint32_t offset, status;
+    uint64_t client_iv = 0;
+    uint64_t server_iv = 0;
+    const uint64_t REQUEST_COUNT = 8;
+    vccrypt_buffer_t shared_secret;
+
+    /* register dataservice helper mocks. */
+    TEST_ASSERT(0 == fixture.dataservice_mock_register_helper());
+
+    /* mock the block id by height api call, encoding the height in the id. */
+    fixture.dataservice->register_callback_block_id_by_height_read(
+        [&](const dataservice_request_block_id_by_height_read_t& req,
+            std::ostream& payout) {
+            void* payload = nullptr;
+            size_t payload_size = 0U;
+            uint8_t block_id[16];
+
+            memset(block_id, 0, sizeof(block_id));
+            block_id[15] = (uint8_t)req.block_height;
+
+            int retval =
+                dataservice_encode_response_block_id_by_height_read(
+                    &payload, &payload_size, block_id);
+            if (AGENTD_STATUS_SUCCESS != retval)
+                return retval;
+
+            /* make sure to clean up memory when we fall out of scope. */
+            unique_ptr<void, decltype(free)*> cleanup(payload, &free);
+
+            /* write the payload. */
+            payout.write((const char*)payload, payload_size);
+
+            /* success. */
+            return AGENTD_STATUS_SUCCESS;
+        });
+
+    /* start the mocks. */
+    fixture.dataservice->start();
+    fixture.notifyservice->start();
+
+    /* add the hardcoded keys. */
+    TEST_ASSERT(AGENTD_STATUS_SUCCESS == fixture.add_hardcoded_keys());
+
+    /* do the handshake, populating the shared secret on success. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == fixture.do_handshake(&shared_secret, &server_iv, &client_iv));
+
+    /* send a request for each height before reading any responses. */
+    for (uint64_t height = 1; height <= REQUEST_COUNT; ++height)
+    {
+        TEST_ASSERT(
+            AGENTD_STATUS_SUCCESS
+                == protocolservice_api_sendreq_block_id_by_height_get_block(
+                        fixture.protosock, &fixture.suite, &client_iv,
+                        &shared_secret, height));
+    }
+
+    /* each response should answer the request sent in the same position. */
+    for (uint64_t height = 1; height <= REQUEST_COUNT; ++height)
+    {
+        vccrypt_buffer_t block_id;
+        TEST_ASSERT(
+            AGENTD_STATUS_SUCCESS
+                == protocolservice_api_recvresp_block_id_by_height_get_block(
+                        fixture.protosock, &fixture.suite, &server_iv,
+                        &shared_secret, &offset, &status, &block_id));
+
+        TEST_EXPECT(AGENTD_STATUS_SUCCESS == (int)status);
+        TEST_ASSERT(16U == block_id.size);
+        TEST_EXPECT(height == ((const uint8_t*)block_id.data)[15]);
+
+        dispose((disposable_t*)&block_id);
+    }
+
+    /* send the close request. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == protocolservice_api_sendreq_close(
+                    fixture.protosock, &fixture.suite, &client_iv,
+                    &shared_secret));
+
+    /* get the close response. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == protocolservice_api_recvresp_close(
+                    fixture.protosock, &fixture.suite, &server_iv,
+                    &shared_secret));
+
+    /* close the socket */
+    close(fixture.protosock);
+
+    /* stop the mocks. */
+    fixture.dataservice->stop();
+    fixture.notifyservice->stop();
+
+    /* verify proper connection setup. */
+    TEST_EXPECT(0 == fixture.dataservice_mock_valid_connection_setup());
+
+    /* verify proper connection teardown. */
+    TEST_EXPECT(0 == fixture.dataservice_mock_valid_connection_teardown());
+
+    /* clean up. */
+    dispose((disposable_t*)&shared_secret);
+END_TEST_F()
+
+/**
+ * Test that a failed child context open is reported to the protocol fiber,
+ * which closes the connection instead of waiting forever for a reply.
+ */
+BEGIN_TEST_F(dataservice_context_open_failure)
+    uint32_t offset, status;
+    uint64_t client_iv = 0;
+    uint64_t server_iv = 0;
+    vccrypt_buffer_t shared_secret;
+    vccrypt_buffer_t block_id;
+
+    /* register dataservice helper mocks. */
+    TEST_ASSERT(0 == fixture.dataservice_mock_register_helper());
+
+    /* the child context create call fails. */
+    fixture.dataservice->register_callback_child_context_create(
+        [&](const dataservice_request_child_context_create_t&,
+            std::ostream&) {
+            return AGENTD_ERROR_DATASERVICE_CHILD_CONTEXT_MAX_REACHED;
+        });
+
+    /* start the mocks. */
+    fixture.dataservice->start();
+    fixture.notifyservice->start();
+
+    /* add the hardcoded keys. */
+    TEST_ASSERT(AGENTD_STATUS_SUCCESS == fixture.add_hardcoded_keys());
+
+    /* the handshake completes before the context is opened. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == fixture.do_handshake(&shared_secret, &server_iv, &client_iv));
+
+    /* the connection is closed, so reading a response fails. */
+    TEST_EXPECT(
+        AGENTD_STATUS_SUCCESS
+            != protocolservice_api_recvresp_latest_block_id_get_block(
+                    fixture.protosock, &fixture.suite, &server_iv,
+                    &shared_secret, &offset, &status, &block_id));
+
+    /* close the socket */
+    close(fixture.protosock);
+
+    /* stop the mocks. */
+    fixture.dataservice->stop();
+    fixture.notifyservice->stop();
+
+    /* a child context open was attempted. */
+    TEST_EXPECT(0 == fixture.dataservice_mock_valid_connection_setup());
+
+    /* clean up. */
+    dispose((disposable_t*)&shared_secret);
+END_TEST_F()
+
+/**
+ * Test that a second request to get the latest block ID is answered from the
+ * cache while the block assertion for the cached block ID remains valid.
+ */
+BEGIN_TEST_F(get_latest_block_id_cached)
+    uint32_t offset, status;
+    uint64_t client_iv = 0;
+    uint64_t server_iv = 0;
+    const uint8_t EXPECTED_BLOCK_ID[16] = {
+        0x5e, 0x0c, 0x8b, 0x3a, 0x91, 0x27, 0x4f, 0x66,
+        0xb4, 0x1d, 0x2e, 0xc9, 0x70, 0x8a, 0x13, 0xf5
+    };
+    vccrypt_buffer_t shared_secret;
+
+    /* register dataservice helper mocks. */
+    TEST_ASSERT(0 == fixture.dataservice_mock_register_helper());
+
+    /* mock the latest block id api call. */
+    fixture.dataservice->register_callback_block_id_latest_read(
+        [&](const dataservice_request_block_id_latest_read_t&,
+            std::ostream& payout) {
+            void* payload = nullptr;
+            size_t payload_size = 0U;
+
+            int retval =
+                dataservice_encode_response_block_id_latest_read(
+                    &payload, &payload_size, EXPECTED_BLOCK_ID);
+            if (AGENTD_STATUS_SUCCESS != retval)
+                return retval;
+
+            /* make sure to clean up memory when we fall out of scope. */
+            unique_ptr<void, decltype(free)*> cleanup(payload, &free);
+
+            /* write the payload. */
+            payout.write((const char*)payload, payload_size);
+
+            /* success. */
+            return AGENTD_STATUS_SUCCESS;
+        });
+
+    /* don't invalidate the cache subscription. */
+    fixture.notifyservice->override_block_assertion_status(true);
+
+    /* start the mocks. */
+    fixture.dataservice->start();
+    fixture.notifyservice->start();
+
+    /* add the hardcoded keys. */
+    TEST_ASSERT(AGENTD_STATUS_SUCCESS == fixture.add_hardcoded_keys());
+
+    /* do the handshake, populating the shared secret on success. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == fixture.do_handshake(&shared_secret, &server_iv, &client_iv));
+
+    /* request the latest block id twice. */
+    for (int i = 0; i < 2; ++i)
+    {
+        /* send the request. */
+        TEST_ASSERT(
+            AGENTD_STATUS_SUCCESS
+                == protocolservice_api_sendreq_latest_block_id_get_block(
+                        fixture.protosock, &fixture.suite, &client_iv,
+                        &shared_secret));
+
+        /* get the response. */
+        vccrypt_buffer_t block_id;
+        TEST_ASSERT(
+            AGENTD_STATUS_SUCCESS
+                == protocolservice_api_recvresp_latest_block_id_get_block(
+                        fixture.protosock, &fixture.suite, &server_iv,
+                        &shared_secret, &offset, &status, &block_id));
+
+        /* both responses carry the latest block id. */
+        TEST_ASSERT(AGENTD_STATUS_SUCCESS == (int)status);
+        TEST_ASSERT(0U == offset);
+        TEST_ASSERT(block_id.size == sizeof(EXPECTED_BLOCK_ID));
+        TEST_ASSERT(
+            0 == memcmp(block_id.data, EXPECTED_BLOCK_ID, block_id.size));
+
+        dispose((disposable_t*)&block_id);
+    }
+
+    /* send the close request. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == protocolservice_api_sendreq_close(
+                    fixture.protosock, &fixture.suite, &client_iv,
+                    &shared_secret));
+
+    /* get the close response. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == protocolservice_api_recvresp_close(
+                    fixture.protosock, &fixture.suite, &server_iv,
+                    &shared_secret));
+
+    /* close the socket */
+    close(fixture.protosock);
+
+    /* stop the mocks. */
+    fixture.dataservice->stop();
+    fixture.notifyservice->stop();
+
+    /* verify proper connection setup. */
+    TEST_EXPECT(0 == fixture.dataservice_mock_valid_connection_setup());
+
+    /* only one latest block_id call should have been made. */
+    TEST_EXPECT(
+        fixture.dataservice->request_matches_block_id_latest_read(
+            fixture.EXPECTED_CHILD_INDEX));
+
+    /* verify proper connection teardown. */
+    TEST_EXPECT(0 == fixture.dataservice_mock_valid_connection_teardown());
+
+    /* the cache subscribed to block updates for the cached block id. */
+    TEST_EXPECT(
+        fixture.notifyservice->request_matches_block_assertion(
+            0, (const rcpr_uuid*)EXPECTED_BLOCK_ID));
+
+    /* clean up. */
+    dispose((disposable_t*)&shared_secret);
+END_TEST_F()
+
+/**
+ * Test that a request to get a block id by height returns that block id.
+ */
+BEGIN_TEST_F(get_block_id_by_height_happy_path)
+    uint32_t offset, status;
+    uint64_t client_iv = 0;
+    uint64_t server_iv = 0;
+    const uint8_t EXPECTED_BLOCK_ID[16] = {
+        0x3d, 0x30, 0x6b, 0x0b, 0x73, 0x1d, 0x4b, 0xe9,
+        0x84, 0xda, 0x2a, 0xb8, 0xd7, 0x8f, 0x52, 0x30
+    };
+    const uint64_t EXPECTED_HEIGHT = 117;
+    vccrypt_buffer_t shared_secret;
+
+    /* register dataservice helper mocks. */
+    TEST_ASSERT(0 == fixture.dataservice_mock_register_helper());
+
+    /* mock the latest block id api call. */
+    fixture.dataservice->register_callback_block_id_by_height_read(
+        [&](const dataservice_request_block_id_by_height_read_t& req,
+            std::ostream& payout) {
+            void* payload = nullptr;
+            size_t payload_size = 0U;
+
+            if (req.block_height != EXPECTED_HEIGHT)
+                return AGENTD_ERROR_DATASERVICE_NOT_FOUND;
+
+            int retval =
+                dataservice_encode_response_block_id_by_height_read(
+                    &payload, &payload_size, EXPECTED_BLOCK_ID);
+            if (AGENTD_STATUS_SUCCESS != retval)
+                return retval;
+
+            /* make sure to clean up memory when we fall out of scope. */
+            unique_ptr<void, decltype(free)*> cleanup(payload, &free);
+
+            /* write the payload. */
+            payout.write((const char*)payload, payload_size);
+
+            /* success. */
+            return AGENTD_STATUS_SUCCESS;
+        });
+
+    /* start the mocks. */
+    fixture.dataservice->start();
+    fixture.notifyservice->start();
+
+    /* add the hardcoded keys. */
+    TEST_ASSERT(AGENTD_STATUS_SUCCESS == fixture.add_hardcoded_keys());
+
+    /* do the handshake, populating the shared secret on success. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == fixture.do_handshake(&shared_secret, &server_iv, &client_iv));
+
+    /* send the request. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == protocolservice_api_sendreq_block_id_by_height_get_block(
+                    fixture.protosock, &fixture.suite, &client_iv,
+                    &shared_secret, EXPECTED_HEIGHT));
+
+    /* get the response. */
+    vccrypt_buffer_t block_id;
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == protocolservice_api_recvresp_block_id_by_height_get_block(
+                    fixture.protosock, &fixture.suite, &server_iv,
+                    &shared_secret, &offset, &status, &block_id));
+
+    /* the status should indicate success. */
+    TEST_ASSERT(AGENTD_STATUS_SUCCESS == (int)status);
+    /* the offset should be zero. */
+    TEST_ASSERT(0U == offset);
+    /* the block_id size should be the correct size. */
+    TEST_ASSERT(block_id.size == sizeof(EXPECTED_BLOCK_ID));
+    /* the block id should match. */
+    TEST_ASSERT(0 == memcmp(block_id.data, EXPECTED_BLOCK_ID, block_id.size));
+
+    /* send the close request. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == protocolservice_api_sendreq_close(
+                    fixture.protosock, &fixture.suite, &client_iv,
+                    &shared_secret));
+
+    /* get the close response. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == protocolservice_api_recvresp_close(
+                    fixture.protosock, &fixture.suite, &server_iv,
+                    &shared_secret));
+
+    /* close the socket */
+    close(fixture.protosock);
+
+    /* stop the mocks. */
+    fixture.dataservice->stop();
+    fixture.notifyservice->stop();
+
+    /* verify proper connection setup. */
+    TEST_EXPECT(0 == fixture.dataservice_mock_valid_connection_setup());
+
+    /* a latest block_id call should have been made. */
+    TEST_EXPECT(
+        fixture.dataservice->request_matches_block_id_by_height_read(
+            fixture.EXPECTED_CHILD_INDEX, EXPECTED_HEIGHT));
+
+    /* verify proper connection teardown. */
+    TEST_EXPECT(0 == fixture.dataservice_mock_valid_connection_teardown());
+
+    /* clean up. */
+    dispose((disposable_t*)&block_id);
+    dispose((disposable_t*)&shared_secret);
+END_TEST_F()
+
+/**
+ * Test that a client can pipeline more requests than fit in the per-connection
+ * request window before reading any responses, and that every request is
+ * answered.
+ */
+BEGIN_TEST_F(get_block_id_by_height_pipelined)
+    uint32_t offset, status;
+    uint64_t client_iv = 0;
+    uint64_t server_iv = 0;
+    const uint8_t EXPECTED_BLOCK_ID[16] = {
+        0x3d, 0x30, 0x6b, 0x0b, 0x73, 0x1d, 0x4b, 0xe9,
+        0x84, 0xda, 0x2a, 0xb8, 0xd7, 0x8f, 0x52, 0x30
+    };
+    const uint64_t EXPECTED_HEIGHT = 117;
+    const int REQUEST_COUNT = 40;
+    vccrypt_buffer_t shared_secret;
+
+    /* register dataservice helper mocks. */
+    TEST_ASSERT(0 == fixture.dataservice_mock_register_helper());
+
+    /* mock the block id by height api call. */
+    fixture.dataservice->register_callback_block_id_by_height_read(
+        [&](const dataservice_request_block_id_by_height_read_t& req,
+            std::ostream& payout) {
+            void* payload = nullptr;
+            size_t payload_size = 0U;
+
+            if (req.block_height != EXPECTED_HEIGHT)
+                return AGENTD_ERROR_DATASERVICE_NOT_FOUND;
+
+            int retval =
+                dataservice_encode_response_block_id_by_height_read(
+                    &payload, &payload_size, EXPECTED_BLOCK_ID);
+            if (AGENTD_STATUS_SUCCESS != retval)
+                return retval;
+
+            /* make sure to clean up memory when we fall out of scope. */
+            unique_ptr<void, decltype(free)*> cleanup(payload, &free);
+
+            /* write the payload. */
+            payout.write((const char*)payload, payload_size);
+
+            /* success. */
+            return AGENTD_STATUS_SUCCESS;
+        });
+
+    /* start the mocks. */
+    fixture.dataservice->start();
+    fixture.notifyservice->start();
+
+    /* add the hardcoded keys. */
+    TEST_ASSERT(AGENTD_STATUS_SUCCESS == fixture.add_hardcoded_keys());
+
+    /* do the handshake, populating the shared secret on success. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == fixture.do_handshake(&shared_secret, &server_iv, &client_iv));
+
+    /* send all of the requests up front. */
+    for (int i = 0; i < REQUEST_COUNT; ++i)
+    {
+        TEST_ASSERT(
+            AGENTD_STATUS_SUCCESS
+                == protocolservice_api_sendreq_block_id_by_height_get_block(
+                        fixture.protosock, &fixture.suite, &client_iv,
+                        &shared_secret, EXPECTED_HEIGHT));
+    }
+
+    /* every request should be answered. */
+    for (int i = 0; i < REQUEST_COUNT; ++i)
+    {
+        vccrypt_buffer_t block_id;
+        TEST_ASSERT(
+            AGENTD_STATUS_SUCCESS
+                == protocolservice_api_recvresp_block_id_by_height_get_block(
+                        fixture.protosock, &fixture.suite, &server_iv,
+                        &shared_secret, &offset, &status, &block_id));
+
+        TEST_EXPECT(AGENTD_STATUS_SUCCESS == (int)status);
+        TEST_EXPECT(block_id.size == sizeof(EXPECTED_BLOCK_ID));
+        TEST_EXPECT(
+            0 == memcmp(block_id.data, EXPECTED_BLOCK_ID, block_id.size));
+
+        dispose((disposable_t*)&block_id);
+    }
+
+    /* send the close request. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == protocolservice_api_sendreq_close(
+                    fixture.protosock, &fixture.suite, &client_iv,
+                    &shared_secret));
+
+    /* get the close response. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == protocolservice_api_recvresp_close(
+                    fixture.protosock, &fixture.suite, &server_iv,
+                    &shared_secret));
+
+    /* close the socket */
+    close(fixture.protosock);
+
+    /* stop the mocks. */
+    fixture.dataservice->stop();
+    fixture.notifyservice->stop();
+
+    /* verify proper connection setup. */
+    TEST_EXPECT(0 == fixture.dataservice_mock_valid_connection_setup());
+
+    /* verify proper connection teardown. */
+    TEST_EXPECT(0 == fixture.dataservice_mock_valid_connection_teardown());
+
+    /* clean up. */
+    dispose((disposable_t*)&shared_secret);
+END_TEST_F()
+
+/**
+ * Test that a block range request streams one packet per block, fetching the
+ * blocks from the dataservice one chunk at a time, and ending the stream at the
+ * latest block.
+ */
+BEGIN_TEST_F(get_block_range_happy_path)
+    uint32_t offset, status;
+    uint64_t client_iv = 0;
+    uint64_t server_iv = 0;
+    const uint64_t START_HEIGHT = 5;
+    const uint32_t MAX_COUNT = 10;
+    const size_t BLOCK_COUNT = 3;
+    const size_t CHUNK_SIZE = 2;
+    const uint8_t BLOCK_IDS[BLOCK_COUNT + 1][16] = {
+        {   0x7d, 0x0e, 0x1a, 0x8e, 0x2b, 0x3b, 0x44, 0x74,
+            0x9f, 0x0e, 0x6b, 0x7c, 0x43, 0x45, 0x7a, 0x21 },
+        {   0x1e, 0x4c, 0x32, 0x49, 0x1f, 0x1d, 0x4e, 0x5a,
+            0xa0, 0x0c, 0xc5, 0x97, 0x38, 0x42, 0x67, 0x9b },
+        {   0xce, 0x3c, 0x2e, 0x0d, 0xd9, 0x0a, 0x4f, 0x3c,
+            0x8b, 0x9d, 0x8f, 0x0f, 0x8d, 0x2a, 0xd0, 0x4c },
+        {   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff }
+    };
+    const uint8_t CERT[] = { 0x01, 0x02, 0x03, 0x04 };
+    vccrypt_buffer_t shared_secret;
+
+    /* register dataservice helper mocks. */
+    TEST_ASSERT(0 == fixture.dataservice_mock_register_helper());
+
+    /* mock the block range api call, returning at most two blocks. */
+    fixture.dataservice->register_callback_block_range_get(
+        [&](const dataservice_request_block_range_get_t& req,
+            std::ostream& payout) {
+            if (req.start_height < START_HEIGHT
+             || req.start_height >= START_HEIGHT + BLOCK_COUNT)
+                return AGENTD_ERROR_DATASERVICE_NOT_FOUND;
+
+            size_t first = req.start_height - START_HEIGHT;
+            for (size_t i = first;
+                 i < BLOCK_COUNT && i < first + CHUNK_SIZE
+                    && i < first + req.max_count;
+                 ++i)
+            {
+                uint32_t entry_size = htonl(72 + sizeof(CERT));
+                uint64_t net_height = htonll(START_HEIGHT + i);
+                uint8_t node[72] = { 0 };
+
+                memcpy(node, BLOCK_IDS[i], 16);
+                memcpy(node + 32, BLOCK_IDS[i + 1], 16);
+                memcpy(node + 64, &net_height, sizeof(net_height));
+
+                payout.write((const char*)&entry_size, sizeof(entry_size));
+                payout.write((const char*)node, sizeof(node));
+                payout.write((const char*)CERT, sizeof(CERT));
+            }
+
+            /* success. */
+            return AGENTD_STATUS_SUCCESS;
+        });
+
+    /* start the mocks. */
+    fixture.dataservice->start();
+    fixture.notifyservice->start();
+
+    /* add the hardcoded keys. */
+    TEST_ASSERT(AGENTD_STATUS_SUCCESS == fixture.add_hardcoded_keys());
+
+    /* do the handshake, populating the shared secret on success. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == fixture.do_handshake(&shared_secret, &server_iv, &client_iv));
+
+    /* send the request. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == protocolservice_api_sendreq_block_range_get(
+                    fixture.protosock, &fixture.suite, &client_iv,
+                    &shared_secret, START_HEIGHT, MAX_COUNT, 0U));
+
+    /* each block arrives as its own packet. */
+    for (size_t i = 0; i < BLOCK_COUNT; ++i)
+    {
+        bool more;
+        data_block_node_t node;
+        uint8_t* cert = nullptr;
+        size_t cert_size = 0U;
+
+        TEST_ASSERT(
+            AGENTD_STATUS_SUCCESS
+                == protocolservice_api_recvresp_block_range_get(
+                        fixture.protosock, &fixture.suite, &server_iv,
+                        &shared_secret, &offset, &status, &more, &node, &cert,
+                        &cert_size));
+
+        /* the status should indicate success. */
+        TEST_ASSERT(AGENTD_STATUS_SUCCESS == (int)status);
+        /* the offset should be zero. */
+        TEST_EXPECT(0U == offset);
+        /* only the last block ends the stream. */
+        TEST_EXPECT((i + 1 < BLOCK_COUNT) == more);
+        /* the block should match. */
+        TEST_EXPECT(0 == memcmp(node.key, BLOCK_IDS[i], 16));
+        TEST_EXPECT(START_HEIGHT + i == ntohll(node.net_block_height));
+        TEST_ASSERT(sizeof(CERT) == cert_size);
+        TEST_EXPECT(0 == memcmp(cert, CERT, cert_size));
+
+        free(cert);
+    }
+
+    /* send the close request. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == protocolservice_api_sendreq_close(
+                    fixture.protosock, &fixture.suite, &client_iv,
+                    &shared_secret));
+
+    /* get the close response. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == protocolservice_api_recvresp_close(
+                    fixture.protosock, &fixture.suite, &server_iv,
+                    &shared_secret));
+
+    /* close the socket */
+    close(fixture.protosock);
+
+    /* stop the mocks. */
+    fixture.dataservice->stop();
+    fixture.notifyservice->stop();
+
+    /* verify proper connection setup. */
+    TEST_EXPECT(0 == fixture.dataservice_mock_valid_connection_setup());
+
+    /* the first chunk was requested. */
+    TEST_EXPECT(
+        fixture.dataservice->request_matches_block_range_get(
+            fixture.EXPECTED_CHILD_INDEX, START_HEIGHT, MAX_COUNT,
+            UINT32_MAX));
+
+    /* the second chunk picked up where the first one left off. */
+    TEST_EXPECT(
+        fixture.dataservice->request_matches_block_range_get(
+            fixture.EXPECTED_CHILD_INDEX, START_HEIGHT + CHUNK_SIZE,
+            MAX_COUNT - CHUNK_SIZE, UINT32_MAX));
+
+    /* verify proper connection teardown. */
+    TEST_EXPECT(0 == fixture.dataservice_mock_valid_connection_teardown());
+
+    /* clean up. */
+    dispose((disposable_t*)&shared_secret);
+END_TEST_F()
+
+/**
+ * Test that a block range stream that reaches a gap in the chain after more
+ * blocks were promised ends with an empty packet instead of an error.
+ */
+BEGIN_TEST_F(get_block_range_gap_ends_stream)
+    uint32_t offset, status;
+    uint64_t client_iv = 0;
+    uint64_t server_iv = 0;
+    const uint64_t START_HEIGHT = 5;
+    const uint32_t MAX_COUNT = 10;
+    const size_t BLOCK_COUNT = 2;
+    const uint8_t BLOCK_IDS[BLOCK_COUNT + 1][16] = {
+        {   0x7d, 0x0e, 0x1a, 0x8e, 0x2b, 0x3b, 0x44, 0x74,
+            0x9f, 0x0e, 0x6b, 0x7c, 0x43, 0x45, 0x7a, 0x21 },
+        {   0x1e, 0x4c, 0x32, 0x49, 0x1f, 0x1d, 0x4e, 0x5a,
+            0xa0, 0x0c, 0xc5, 0x97, 0x38, 0x42, 0x67, 0x9b },
+        {   0xce, 0x3c, 0x2e, 0x0d, 0xd9, 0x0a, 0x4f, 0x3c,
+            0x8b, 0x9d, 0x8f, 0x0f, 0x8d, 0x2a, 0xd0, 0x4c }
+    };
+    const uint8_t CERT[] = { 0x01, 0x02, 0x03, 0x04 };
+    vccrypt_buffer_t shared_secret;
+
+    /* register dataservice helper mocks. */
+    TEST_ASSERT(0 == fixture.dataservice_mock_register_helper());
+
+    /* mock the block range api call; the block after the chunk is missing. */
+    fixture.dataservice->register_callback_block_range_get(
+        [&](const dataservice_request_block_range_get_t& req,
+            std::ostream& payout) {
+            if (START_HEIGHT != req.start_height)
+                return AGENTD_ERROR_DATASERVICE_NOT_FOUND;
+
+            for (size_t i = 0; i < BLOCK_COUNT; ++i)
+            {
+                uint32_t entry_size = htonl(72 + sizeof(CERT));
+                uint64_t net_height = htonll(START_HEIGHT + i);
+                uint8_t node[72] = { 0 };
+
+                memcpy(node, BLOCK_IDS[i], 16);
+                memcpy(node + 32, BLOCK_IDS[i + 1], 16);
+                memcpy(node + 64, &net_height, sizeof(net_height));
+
+                payout.write((const char*)&entry_size, sizeof(entry_size));
+                payout.write((const char*)node, sizeof(node));
+                payout.write((const char*)CERT, sizeof(CERT));
+            }
+
+            /* success. */
+            return AGENTD_STATUS_SUCCESS;
+        });
+
+    /* start the mocks. */
+    fixture.dataservice->start();
+    fixture.notifyservice->start();
+
+    /* add the hardcoded keys. */
+    TEST_ASSERT(AGENTD_STATUS_SUCCESS == fixture.add_hardcoded_keys());
+
+    /* do the handshake, populating the shared secret on success. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == fixture.do_handshake(&shared_secret, &server_iv, &client_iv));
+
+    /* send the request. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == protocolservice_api_sendreq_block_range_get(
+                    fixture.protosock, &fixture.suite, &client_iv,
+                    &shared_secret, START_HEIGHT, MAX_COUNT, 0U));
+
+    /* both blocks in the chunk promise more. */
+    for (size_t i = 0; i < BLOCK_COUNT; ++i)
+    {
+        bool more;
+        data_block_node_t node;
+        uint8_t* cert = nullptr;
+        size_t cert_size = 0U;
+
+        TEST_ASSERT(
+            AGENTD_STATUS_SUCCESS
+                == protocolservice_api_recvresp_block_range_get(
+                        fixture.protosock, &fixture.suite, &server_iv,
+                        &shared_secret, &offset, &status, &more, &node, &cert,
+                        &cert_size));
+
+        TEST_ASSERT(AGENTD_STATUS_SUCCESS == (int)status);
+        TEST_EXPECT(more);
+        TEST_EXPECT(START_HEIGHT + i == ntohll(node.net_block_height));
+        TEST_ASSERT(sizeof(CERT) == cert_size);
+
+        free(cert);
+    }
+
+    /* the gap ends the stream with an empty, successful packet. */
+    {
+        bool more = true;
+        data_block_node_t node;
+        uint8_t* cert = (uint8_t*)CERT;
+        size_t cert_size = 1U;
+
+        TEST_ASSERT(
+            AGENTD_STATUS_SUCCESS
+                == protocolservice_api_recvresp_block_range_get(
+                        fixture.protosock, &fixture.suite, &server_iv,
+                        &shared_secret, &offset, &status, &more, &node, &cert,
+                        &cert_size));
+
+        TEST_EXPECT(AGENTD_STATUS_SUCCESS == (int)status);
+        TEST_EXPECT(0U == offset);
+        TEST_EXPECT(!more);
+        TEST_EXPECT(nullptr == cert);
+        TEST_EXPECT(0U == cert_size);
+    }
+
+    /* send the close request. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == protocolservice_api_sendreq_close(
+                    fixture.protosock, &fixture.suite, &client_iv,
+                    &shared_secret));
+
+    /* get the close response. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == protocolservice_api_recvresp_close(
+                    fixture.protosock, &fixture.suite, &server_iv,
+                    &shared_secret));
+
+    /* close the socket */
+    close(fixture.protosock);
+
+    /* stop the mocks. */
+    fixture.dataservice->stop();
+    fixture.notifyservice->stop();
+
+    /* verify proper connection setup. */
+    TEST_EXPECT(0 == fixture.dataservice_mock_valid_connection_setup());
+
+    /* the first chunk was requested. */
+    TEST_EXPECT(
+        fixture.dataservice->request_matches_block_range_get(
+            fixture.EXPECTED_CHILD_INDEX, START_HEIGHT, MAX_COUNT,
+            UINT32_MAX));
+
+    /* the second chunk started at the gap. */
+    TEST_EXPECT(
+        fixture.dataservice->request_matches_block_range_get(
+            fixture.EXPECTED_CHILD_INDEX, START_HEIGHT + BLOCK_COUNT,
+            MAX_COUNT - BLOCK_COUNT, UINT32_MAX));
+
+    /* verify proper connection teardown. */
+    TEST_EXPECT(0 == fixture.dataservice_mock_valid_connection_teardown());
+
+    /* clean up. */
+    dispose((disposable_t*)&shared_secret);
+END_TEST_F()
+
+/**
+ * Test that a block range chunk buffered into a single write still reaches the
+ * client as one authed packet per block, in order, and that the unbuffered
+ * response that follows picks up the next server IV.
+ */
+BEGIN_TEST_F(get_block_range_buffered_chunk_framing)
+    uint32_t offset, status;
+    uint64_t client_iv = 0;
+    uint64_t server_iv = 0;
+    const uint64_t START_HEIGHT = 9;
+    const uint32_t MAX_COUNT = 10;
+    const size_t BLOCK_COUNT = 4;
+    const uint8_t BLOCK_IDS[BLOCK_COUNT + 1][16] = {
+        {   0x3f, 0x61, 0x0a, 0x5c, 0x8e, 0x27, 0x4b, 0x19,
+            0x92, 0xd4, 0x1b, 0x6e, 0x05, 0xa3, 0x77, 0xc8 },
+        {   0x6a, 0x0b, 0xe2, 0x14, 0x5d, 0x93, 0x48, 0x0f,
+            0xb7, 0x2c, 0x81, 0x3e, 0xf0, 0x59, 0x16, 0xad },
+        {   0xa1, 0x7e, 0x33, 0xc0, 0x0d, 0x52, 0x4a, 0x8b,
+            0x86, 0x19, 0x6f, 0xe4, 0x2b, 0xd7, 0x90, 0x05 },
+        {   0xd5, 0x28, 0x9c, 0x47, 0xe1, 0x0a, 0x4c, 0x73,
+            0xab, 0x64, 0x3d, 0x12, 0x8f, 0xc6, 0x5e, 0xb9 },
+        {   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff }
+    };
+    const uint8_t EXPECTED_BLOCK_ID[16] = {
+        0xd5, 0x28, 0x9c, 0x47, 0xe1, 0x0a, 0x4c, 0x73,
+        0xab, 0x64, 0x3d, 0x12, 0x8f, 0xc6, 0x5e, 0xb9
+    };
+    vccrypt_buffer_t shared_secret;
+
+    /* register dataservice helper mocks. */
+    TEST_ASSERT(0 == fixture.dataservice_mock_register_helper());
+
+    /* mock the block range api call, returning every block in one chunk. */
+    fixture.dataservice->register_callback_block_range_get(
+        [&](const dataservice_request_block_range_get_t& req,
+            std::ostream& payout) {
+            if (START_HEIGHT != req.start_height)
+                return AGENTD_ERROR_DATASERVICE_NOT_FOUND;
+
+            for (size_t i = 0; i < BLOCK_COUNT; ++i)
+            {
+                /* each certificate has its own size and fill byte. */
+                size_t cert_size = 100 * (i + 1);
+                uint32_t entry_size = htonl(72 + cert_size);
+                uint64_t net_height = htonll(START_HEIGHT + i);
+                uint8_t node[72] = { 0 };
+                string cert(cert_size, (char)i);
+
+                memcpy(node, BLOCK_IDS[i], 16);
+                memcpy(node + 32, BLOCK_IDS[i + 1], 16);
+                memcpy(node + 64, &net_height, sizeof(net_height));
+
+                payout.write((const char*)&entry_size, sizeof(entry_size));
+                payout.write((const char*)node, sizeof(node));
+                payout.write(cert.data(), cert.size());
+            }
+
+            /* success. */
+            return AGENTD_STATUS_SUCCESS;
+        });
+
+    /* mock the latest block id api call. */
+    fixture.dataservice->register_callback_block_id_latest_read(
+        [&](const dataservice_request_block_id_latest_read_t&,
+            std::ostream& payout) {
+            void* payload = nullptr;
+            size_t payload_size = 0U;
+
+            int retval =
+                dataservice_encode_response_block_id_latest_read(
+                    &payload, &payload_size, EXPECTED_BLOCK_ID);
+            if (AGENTD_STATUS_SUCCESS != retval)
+                return retval;
+
+            /* make sure to clean up memory when we fall out of scope. */
+            unique_ptr<void, decltype(free)*> cleanup(payload, &free);
+
+            /* write the payload. */
+            payout.write((const char*)payload, payload_size);
+
+            /* success. */
+            return AGENTD_STATUS_SUCCESS;
+        });
+
+    /* start the mocks. */
+    fixture.dataservice->start();
+    fixture.notifyservice->start();
+
+    /* add the hardcoded keys. */
+    TEST_ASSERT(AGENTD_STATUS_SUCCESS == fixture.add_hardcoded_keys());
+
+    /* do the handshake, populating the shared secret on success. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == fixture.do_handshake(&shared_secret, &server_iv, &client_iv));
+
+    /* send the request. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == protocolservice_api_sendreq_block_range_get(
+                    fixture.protosock, &fixture.suite, &client_iv,
+                    &shared_secret, START_HEIGHT, MAX_COUNT, 0U));
+
+    /* each block decodes as its own packet, in height order. */
+    for (size_t i = 0; i < BLOCK_COUNT; ++i)
+    {
+        bool more;
+        data_block_node_t node;
+        uint8_t* cert = nullptr;
+        size_t cert_size = 0U;
+        string expected_cert(100 * (i + 1), (char)i);
+
+        TEST_ASSERT(
+            AGENTD_STATUS_SUCCESS
+                == protocolservice_api_recvresp_block_range_get(
+                        fixture.protosock, &fixture.suite, &server_iv,
+                        &shared_secret, &offset, &status, &more, &node, &cert,
+                        &cert_size));
+
+        TEST_ASSERT(AGENTD_STATUS_SUCCESS == (int)status);
+        TEST_EXPECT(0U == offset);
+        TEST_EXPECT((i + 1 < BLOCK_COUNT) == more);
+        TEST_EXPECT(0 == memcmp(node.key, BLOCK_IDS[i], 16));
+        TEST_EXPECT(START_HEIGHT + i == ntohll(node.net_block_height));
+        TEST_ASSERT(expected_cert.size() == cert_size);
+        TEST_EXPECT(0 == memcmp(cert, expected_cert.data(), cert_size));
+
+        free(cert);
+    }
+
+    /* a single packet response follows the buffered chunk. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == protocolservice_api_sendreq_latest_block_id_get_block(
+                    fixture.protosock, &fixture.suite, &client_iv,
+                    &shared_secret));
+
+    /* it decodes with the next server IV. */
+    vccrypt_buffer_t block_id;
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == protocolservice_api_recvresp_latest_block_id_get_block(
+                    fixture.protosock, &fixture.suite, &server_iv,
+                    &shared_secret, &offset, &status, &block_id));
+    TEST_ASSERT(AGENTD_STATUS_SUCCESS == (int)status);
+    TEST_ASSERT(block_id.size == sizeof(EXPECTED_BLOCK_ID));
+    TEST_EXPECT(0 == memcmp(block_id.data, EXPECTED_BLOCK_ID, block_id.size));
+
+    /* send the close request. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == protocolservice_api_sendreq_close(
+                    fixture.protosock, &fixture.suite, &client_iv,
+                    &shared_secret));
+
+    /* get the close response. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == protocolservice_api_recvresp_close(
+                    fixture.protosock, &fixture.suite, &server_iv,
+                    &shared_secret));
+
+    /* close the socket */
+    close(fixture.protosock);
+
+    /* stop the mocks. */
+    fixture.dataservice->stop();
+    fixture.notifyservice->stop();
+
+    /* verify proper connection setup. */
+    TEST_EXPECT(0 == fixture.dataservice_mock_valid_connection_setup());
+
+    /* the whole range was requested in one chunk. */
+    TEST_EXPECT(
+        fixture.dataservice->request_matches_block_range_get(
+            fixture.EXPECTED_CHILD_INDEX, START_HEIGHT, MAX_COUNT,
+            UINT32_MAX));
+
+    /* verify proper connection teardown. */
+    TEST_EXPECT(0 == fixture.dataservice_mock_valid_connection_teardown());
+
+    /* clean up. */
+    dispose((disposable_t*)&block_id);
+    dispose((disposable_t*)&shared_secret);
+END_TEST_F()
+
+/**
+ * Test that an artifact transaction list request returns a page of the
+ * artifact's transaction ids in a single response.
+ */
+BEGIN_TEST_F(get_artifact_transaction_list_happy_path)
+    uint32_t offset, status;
+    uint64_t client_iv = 0;
+    uint64_t server_iv = 0;
+    const uint64_t START_HEIGHT = 5;
+    const uint32_t START_INDEX = 1;
+    const uint32_t MAX_COUNT = 2;
+    const uint8_t ARTIFACT_ID[16] = {
+        0xef, 0x44, 0xe7, 0xb4, 0xbf, 0x39, 0x45, 0xe4,
+        0xb3, 0x4b, 0x6e, 0x82, 0xee, 0x41, 0x76, 0x21
+    };
+    const uint8_t TXN_IDS[2][16] = {
+        {   0x7d, 0x0e, 0x1a, 0x8e, 0x2b, 0x3b, 0x44, 0x74,
+            0x9f, 0x0e, 0x6b, 0x7c, 0x43, 0x45, 0x7a, 0x21 },
+        {   0x1e, 0x4c, 0x32, 0x49, 0x1f, 0x1d, 0x4e, 0x5a,
+            0xa0, 0x0c, 0xc5, 0x97, 0x38, 0x42, 0x67, 0x9b }
+    };
+    vccrypt_buffer_t shared_secret;
+    bool more = false;
+    data_artifact_transaction_entry_t* entries = nullptr;
+    size_t count = 0U;
+
+    /* register dataservice helper mocks. */
+    TEST_ASSERT(0 == fixture.dataservice_mock_register_helper());
+
+    /* mock the artifact transaction list api call. */
+    fixture.dataservice->register_callback_artifact_transaction_list_get(
+        [&](const dataservice_request_artifact_transaction_list_get_t& req,
+            std::ostream& payout) {
+            if (memcmp(req.artifact_id, ARTIFACT_ID, 16))
+                return AGENTD_ERROR_DATASERVICE_NOT_FOUND;
+
+            /* the history continues past this page. */
+            uint32_t net_more = htonl(1);
+            payout.write((const char*)&net_more, sizeof(net_more));
+
+            for (uint32_t i = 0; i < 2 && i < req.max_count; ++i)
+            {
+                uint64_t net_height = htonll(req.start_height);
+                uint32_t net_index = htonl(req.start_index + i);
+
+                payout.write((const char*)TXN_IDS[i], 16);
+                payout.write((const char*)&net_height, sizeof(net_height));
+                payout.write((const char*)&net_index, sizeof(net_index));
+            }
+
+            /* success. */
+            return AGENTD_STATUS_SUCCESS;
+        });
+
+    /* start the mocks. */
+    fixture.dataservice->start();
+    fixture.notifyservice->start();
+
+    /* add the hardcoded keys. */
+    TEST_ASSERT(AGENTD_STATUS_SUCCESS == fixture.add_hardcoded_keys());
+
+    /* do the handshake, populating the shared secret on success. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == fixture.do_handshake(&shared_secret, &server_iv, &client_iv));
+
+    /* send the request. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == protocolservice_api_sendreq_artifact_transaction_list_get(
+                    fixture.protosock, &fixture.suite, &client_iv,
+                    &shared_secret, ARTIFACT_ID, START_HEIGHT, START_INDEX,
+                    MAX_COUNT));
+
+    /* get the response. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == protocolservice_api_recvresp_artifact_transaction_list_get(
+                    fixture.protosock, &fixture.suite, &server_iv,
+                    &shared_secret, &offset, &status, &more, &entries,
+                    &count));
+
+    /* the status should indicate success. */
+    TEST_ASSERT(AGENTD_STATUS_SUCCESS == (int)status);
+    /* the offset should be zero. */
+    TEST_EXPECT(0U == offset);
+    /* the history continues. */
+    TEST_EXPECT(more);
+    /* the page should match. */
+    TEST_ASSERT(2U == count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        TEST_EXPECT(0 == memcmp(entries[i].txn_id, TXN_IDS[i], 16));
+        TEST_EXPECT(START_HEIGHT == ntohll(entries[i].net_height));
+        TEST_EXPECT(START_INDEX + i == ntohl(entries[i].net_index));
+    }
+
+    free(entries);
+
+    /* send the close request. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == protocolservice_api_sendreq_close(
+                    fixture.protosock, &fixture.suite, &client_iv,
+                    &shared_secret));
+
+    /* get the close response. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == protocolservice_api_recvresp_close(
+                    fixture.protosock, &fixture.suite, &server_iv,
+                    &shared_secret));
+
+    /* close the socket */
+    close(fixture.protosock);
+
+    /* stop the mocks. */
+    fixture.dataservice->stop();
+    fixture.notifyservice->stop();
+
+    /* verify proper connection setup. */
+    TEST_EXPECT(0 == fixture.dataservice_mock_valid_connection_setup());
+
+    /* the page was requested from the dataservice. */
+    TEST_EXPECT(
+        fixture.dataservice->request_matches_artifact_transaction_list_get(
+            fixture.EXPECTED_CHILD_INDEX, ARTIFACT_ID, START_HEIGHT,
+            START_INDEX, MAX_COUNT));
+
+    /* verify proper connection teardown. */
+    TEST_EXPECT(0 == fixture.dataservice_mock_valid_connection_teardown());
+
+    /* clean up. */
+    dispose((disposable_t*)&shared_secret);
+END_TEST_F()
+
+/**
+ * Test that a request to submit a transaction that is too large fails with an
+ * AGENTD_ERROR_PROTOCOLSERVICE_TRANSACTION_VERIFICATION.
+ */
+BEGIN_TEST_F(transaction_submit_big_certificate)
+    uint32_t offset, status;
+    uint64_t client_iv = 0;
+    uint64_t server_iv = 0;
+    const uint8_t EXPECTED_TRANSACTION_ID[16] = {
+        0x64, 0x91, 0xf1, 0xcf, 0x34, 0xbb, 0x42, 0x15,
+        0x9b, 0xc5, 0x49, 0x1e, 0x7a, 0x46, 0xcd, 0x69
+    };
+    const uint8_t EXPECTED_ARTIFACT_ID[16] = {
+        0xc0, 0x9d, 0x7a, 0xed, 0x7a, 0xef, 0x4b, 0x15,
+        0x9a, 0xdd, 0xd2, 0x03, 0x59, 0xbc, 0xc8, 0x3a
+    };
+    vccrypt_buffer_t shared_secret;
+    vccrypt_buffer_t cert;
+
+    /* create the certificate buffer. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_buffer_init(&cert, &fixture.alloc_opts, 32768));
+    memset(cert.data, 0xFE, cert.size);
+
+    /* register dataservice helper mocks. */
+    TEST_ASSERT(0 == fixture.dataservice_mock_register_helper());
+
+    /* start the mocks. */
+    fixture.dataservice->start();
+    fixture.notifyservice->start();
+
+    /* add the hardcoded keys. */
+    TEST_ASSERT(AGENTD_STATUS_SUCCESS == fixture.add_hardcoded_keys());
+
+    /* do the handshake, populating the shared secret on success. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == fixture.do_handshake(&shared_secret, &server_iv, &client_iv));
+
+    /* send the submission request. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == protocolservice_api_sendreq_transaction_submit(
+                    fixture.protosock, &fixture.suite, &client_iv,
+                    &shared_secret, EXPECTED_TRANSACTION_ID,
+                    EXPECTED_ARTIFACT_ID, &cert));
+
+    /* get the response. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == protocolservice_api_recvresp_transaction_submit(
+                    fixture.protosock, &fixture.suite, &server_iv,
+                    &shared_secret, &offset, &status));
+
+    /* the status should indicate failure. */
+    TEST_ASSERT(
+        AGENTD_ERROR_PROTOCOLSERVICE_TRANSACTION_VERIFICATION == (int)status);
+
+    /* send the close request. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == protocolservice_api_sendreq_close(
+                    fixture.protosock, &fixture.suite, &client_iv,
+                    &shared_secret));
+
+    /* get the close response. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == protocolservice_api_recvresp_close(
+                    fixture.protosock, &fixture.suite, &server_iv,
+                    &shared_secret));
+
+    /* close the socket */
+    close(fixture.protosock);
+
+    /* stop the mocks. */
+    fixture.dataservice->stop();
+    fixture.notifyservice->stop();
+
+    /* verify proper connection setup. */
+    TEST_EXPECT(0 == fixture.dataservice_mock_valid_connection_setup());
+
+    /* verify proper connection teardown. */
+    TEST_EXPECT(0 == fixture.dataservice_mock_valid_connection_teardown());
+
+    /* clean up. */
+    dispose((disposable_t*)&shared_secret);
+    dispose((disposable_t*)&cert);
+END_TEST_F()
+
+/**
+ * Test that a request to submit a transaction goes through our mock.
+ */
+BEGIN_TEST_F(transaction_submit_happy_path)
+    uint32_t offset, status;
+    uint64_t client_iv = 0;
+    uint64_t server_iv = 0;
+    const uint8_t EXPECTED_TRANSACTION_ID[16] = {
+        0x64, 0x91, 0xf1, 0xcf, 0x34, 0xbb, 0x42, 0x15,
+        0x9b, 0xc5, 0x49, 0x1e, 0x7a, 0x46, 0xcd, 0x69
+    };
+    const uint8_t EXPECTED_ARTIFACT_ID[16] = {
+        0xc0, 0x9d, 0x7a, 0xed, 0x7a, 0xef, 0x4b, 0x15,
+        0x9a, 0xdd, 0xd2, 0x03, 0x59, 0xbc, 0xc8, 0x3a
+    };
+    vccrypt_buffer_t shared_secret;
+    vccrypt_buffer_t cert;
+
+    /* create the certificate buffer. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_buffer_init(&cert, &fixture.alloc_opts, 5000));
+    memset(cert.data, 0xFE, cert.size);
+
+    /* register dataservice helper mocks. */
+    TEST_ASSERT(0 == fixture.dataservice_mock_register_helper());
+
+    /* mock the transaction submit api call. */
+    fixture.dataservice->register_callback_transaction_submit(
+        [&](const dataservice_request_transaction_submit_t&,
+            std::ostream&) {
+            /* success. */
+            return AGENTD_STATUS_SUCCESS;
+        });
+
+    /* start the mocks. */
+    fixture.dataservice->start();
+    fixture.notifyservice->start();
+
+    /* add the hardcoded keys. */
+    TEST_ASSERT(AGENTD_STATUS_SUCCESS == fixture.add_hardcoded_keys());
+
+    /* do the handshake, populating the shared secret on success. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == fixture.do_handshake(&shared_secret, &server_iv, &client_iv));
+
+    /* send the submission request. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == protocolservice_api_sendreq_transaction_submit(
+                    fixture.protosock, &fixture.suite, &client_iv,
+                    &shared_secret, EXPECTED_TRANSACTION_ID,
+                    EXPECTED_ARTIFACT_ID, &cert));
+
+    /* get the response. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == protocolservice_api_recvresp_transaction_submit(
+                    fixture.protosock, &fixture.suite, &server_iv,
+                    &shared_secret, &offset, &status));
+
+    /* the status should indicate success. */
+    TEST_ASSERT(AGENTD_STATUS_SUCCESS == (int)status);
+    /* the offset should be zero. */
+    TEST_ASSERT(0U == offset);
+
+    /* send the close request. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == protocolservice_api_sendreq_close(
+                    fixture.protosock, &fixture.suite, &client_iv,
+                    &shared_secret));
+
+    /* get the close response. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == protocolservice_api_recvresp_close(
+                    fixture.protosock, &fixture.suite, &server_iv,
+                    &shared_secret));
+
+    /* close the socket */
+    close(fixture.protosock);
+
+    /* stop the mocks. */
+    fixture.dataservice->stop();
+    fixture.notifyservice->stop();
+
+    /* verify proper connection setup. */
+    TEST_EXPECT(0 == fixture.dataservice_mock_valid_connection_setup());
+
+    /* a transaction submit call should have been made. */
+    TEST_EXPECT(
+        fixture.dataservice->request_matches_transaction_submit(
+            fixture.EXPECTED_CHILD_INDEX,
+            EXPECTED_TRANSACTION_ID, EXPECTED_ARTIFACT_ID, cert.size,
+            (const uint8_t*)cert.data));
 
     /* verify proper connection teardown. */
     TEST_EXPECT(0 == fixture.dataservice_mock_valid_connection_teardown());
 
     /* clean up. */
-    dispose((disposable_t*)&block_id);
     dispose((disposable_t*)&shared_secret);
+    dispose((disposable_t*)&cert);
 END_TEST_F()
 
 /**
- * Test that a request to submit a transaction that is too large fails with an
- * AGENTD_ERROR_PROTOCOLSERVICE_TRANSACTION_VERIFICATION.
+ * Test that with a read-only dataservice pool, read requests are routed to the
+ * reader and transaction submissions stay on the writer.
  */
-BEGIN_TEST_F(transaction_submit_big_certificate)
+BEGIN_TEST_F_WITH_READER(reader_pool_routing)
     uint32_t offset, status;
     uint64_t client_iv = 0;
     uint64_t server_iv = 0;
+    const uint8_t EXPECTED_BLOCK_ID[16] = {
+        0x41, 0x9e, 0x0c, 0x7a, 0xd2, 0x63, 0x4b, 0x05,
+        0x8f, 0x3a, 0xe1, 0x27, 0x5c, 0x90, 0xb6, 0x1d
+    };
     const uint8_t EXPECTED_TRANSACTION_ID[16] = {
         0x64, 0x91, 0xf1, 0xcf, 0x34, 0xbb, 0x42, 0x15,
         0x9b, 0xc5, 0x49, 0x1e, 0x7a, 0x46, 0xcd, 0x69
@@ -1000,17 +2373,54 @@ BEGIN_TEST_F(transaction_submit_big_certificate)
     vccrypt_buffer_t shared_secret;
     vccrypt_buffer_t cert;
 
+    /* the reader mock must be running. */
+    TEST_ASSERT(!!fixture.datareader);
+
     /* create the certificate buffer. */
     TEST_ASSERT(
         VCCRYPT_STATUS_SUCCESS
-            == vccrypt_buffer_init(&cert, &fixture.alloc_opts, 32768));
+            == vccrypt_buffer_init(&cert, &fixture.alloc_opts, 5000));
     memset(cert.data, 0xFE, cert.size);
 
-    /* register dataservice helper mocks. */
+    /* register dataservice helper mocks on the writer and the reader. */
     TEST_ASSERT(0 == fixture.dataservice_mock_register_helper());
+    TEST_ASSERT(
+        0 == fixture.dataservice_mock_register_helper(*fixture.datareader));
+
+    /* only the reader answers the latest block id read. */
+    fixture.datareader->register_callback_block_id_latest_read(
+        [&](const dataservice_request_block_id_latest_read_t&,
+            std::ostream& payout) {
+            void* payload = nullptr;
+            size_t payload_size = 0U;
+
+            int retval =
+                dataservice_encode_response_block_id_latest_read(
+                    &payload, &payload_size, EXPECTED_BLOCK_ID);
+            if (AGENTD_STATUS_SUCCESS != retval)
+                return retval;
+
+            /* make sure to clean up memory when we fall out of scope. */
+            unique_ptr<void, decltype(free)*> cleanup(payload, &free);
+
+            /* write the payload. */
+            payout.write((const char*)payload, payload_size);
+
+            /* success. */
+            return AGENTD_STATUS_SUCCESS;
+        });
+
+    /* only the writer accepts the transaction submission. */
+    fixture.dataservice->register_callback_transaction_submit(
+        [&](const dataservice_request_transaction_submit_t&,
+            std::ostream&) {
+            /* success. */
+            return AGENTD_STATUS_SUCCESS;
+        });
 
     /* start the mocks. */
     fixture.dataservice->start();
+    fixture.datareader->start();
     fixture.notifyservice->start();
 
     /* add the hardcoded keys. */
@@ -1021,6 +2431,24 @@ BEGIN_TEST_F(transaction_submit_big_certificate)
         AGENTD_STATUS_SUCCESS
             == fixture.do_handshake(&shared_secret, &server_iv, &client_iv));
 
+    /* send the latest block id request. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == protocolservice_api_sendreq_latest_block_id_get_block(
+                    fixture.protosock, &fixture.suite, &client_iv,
+                    &shared_secret));
+
+    /* the reader's block id comes back. */
+    vccrypt_buffer_t block_id;
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == protocolservice_api_recvresp_latest_block_id_get_block(
+                    fixture.protosock, &fixture.suite, &server_iv,
+                    &shared_secret, &offset, &status, &block_id));
+    TEST_ASSERT(AGENTD_STATUS_SUCCESS == (int)status);
+    TEST_ASSERT(block_id.size == sizeof(EXPECTED_BLOCK_ID));
+    TEST_EXPECT(0 == memcmp(block_id.data, EXPECTED_BLOCK_ID, block_id.size));
+
     /* send the submission request. */
     TEST_ASSERT(
         AGENTD_STATUS_SUCCESS
@@ -1029,16 +2457,13 @@ BEGIN_TEST_F(transaction_submit_big_certificate)
                     &shared_secret, EXPECTED_TRANSACTION_ID,
                     EXPECTED_ARTIFACT_ID, &cert));
 
-    /* get the response. */
+    /* the writer accepts it. */
     TEST_ASSERT(
         AGENTD_STATUS_SUCCESS
             == protocolservice_api_recvresp_transaction_submit(
                     fixture.protosock, &fixture.suite, &server_iv,
                     &shared_secret, &offset, &status));
-
-    /* the status should indicate failure. */
-    TEST_ASSERT(
-        AGENTD_ERROR_PROTOCOLSERVICE_TRANSACTION_VERIFICATION == (int)status);
+    TEST_ASSERT(AGENTD_STATUS_SUCCESS == (int)status);
 
     /* send the close request. */
     TEST_ASSERT(
@@ -1059,24 +2484,42 @@ BEGIN_TEST_F(transaction_submit_big_certificate)
 
     /* stop the mocks. */
     fixture.dataservice->stop();
+    fixture.datareader->stop();
     fixture.notifyservice->stop();
 
-    /* verify proper connection setup. */
+    /* the writer saw the connection setup, the submission, and teardown. */
     TEST_EXPECT(0 == fixture.dataservice_mock_valid_connection_setup());
-
-    /* verify proper connection teardown. */
+    TEST_EXPECT(
+        fixture.dataservice->request_matches_transaction_submit(
+            fixture.EXPECTED_CHILD_INDEX,
+            EXPECTED_TRANSACTION_ID, EXPECTED_ARTIFACT_ID, cert.size,
+            (const uint8_t*)cert.data));
     TEST_EXPECT(0 == fixture.dataservice_mock_valid_connection_teardown());
 
+    /* the reader saw the connection setup, the read, and teardown. */
+    TEST_EXPECT(
+        0 == fixture.dataservice_mock_valid_connection_setup(
+                *fixture.datareader));
+    TEST_EXPECT(
+        fixture.datareader->request_matches_block_id_latest_read(
+            fixture.EXPECTED_CHILD_INDEX));
+    TEST_EXPECT(
+        0 == fixture.dataservice_mock_valid_connection_teardown(
+                *fixture.datareader));
+
     /* clean up. */
+    dispose((disposable_t*)&block_id);
     dispose((disposable_t*)&shared_secret);
     dispose((disposable_t*)&cert);
 END_TEST_F()
 
 /**
- * Test that a request to submit a transaction goes through our mock.
+ * Test that a successful transaction submission wakes the attestation service.
  */
-BEGIN_TEST_F(transaction_submit_happy_path)
+BEGIN_TEST_F(transaction_submit_wakes_attestation)
     uint32_t offset, status;
+    uint8_t wakeup = 0;
+    struct pollfd wakeup_poll;
     uint64_t client_iv = 0;
     uint64_t server_iv = 0;
     const uint8_t EXPECTED_TRANSACTION_ID[16] = {
@@ -1139,6 +2582,15 @@ BEGIN_TEST_F(transaction_submit_happy_path)
     /* the offset should be zero. */
     TEST_ASSERT(0U == offset);
 
+    /* a wakeup datagram should be sent to the attestation service. */
+    wakeup_poll.fd = fixture.wakeupsock;
+    wakeup_poll.events = POLLIN;
+    wakeup_poll.revents = 0;
+    TEST_ASSERT(1 == poll(&wakeup_poll, 1, 5000));
+    TEST_ASSERT(
+        (ssize_t)sizeof(wakeup)
+            == recv(fixture.wakeupsock, &wakeup, sizeof(wakeup), MSG_DONTWAIT));
+
     /* send the close request. */
     TEST_ASSERT(
         AGENTD_STATUS_SUCCESS
@@ -1393,6 +2845,134 @@ BEGIN_TEST_F(block_get_by_id_happy_path)
     dispose((disposable_t*)&shared_secret);
 END_TEST_F()
 
+/**
+ * Test that a second block_get_by_id for a block with a successor is answered
+ * from the certificate cache.
+ */
+BEGIN_TEST_F(block_get_by_id_cached)
+    uint32_t offset, status;
+    uint64_t client_iv = 0;
+    uint64_t server_iv = 0;
+    const uint8_t EXPECTED_BLOCK_ID[16] = {
+        0x1f, 0x6d, 0x02, 0x9e, 0xc4, 0x3b, 0x4a, 0x58,
+        0x8e, 0x27, 0x61, 0xd0, 0x95, 0xab, 0x3c, 0x74
+    };
+    const uint8_t EXPECTED_NEXT_ID[16] = {
+        0x70, 0x2b, 0xe4, 0x19, 0x5d, 0x86, 0x41, 0xcf,
+        0xa3, 0x0e, 0x7b, 0x52, 0xd8, 0x64, 0x9f, 0x21
+    };
+    vccrypt_buffer_t shared_secret;
+
+    /* register dataservice helper mocks. */
+    TEST_ASSERT(0 == fixture.dataservice_mock_register_helper());
+
+    /* mock the block get call. */
+    fixture.dataservice->register_callback_block_read(
+        [&](const dataservice_request_block_read_t&,
+            std::ostream& payout) {
+            void* payload = nullptr;
+            size_t payload_size = 0U;
+
+            int retval =
+                dataservice_encode_response_block_read(
+                    &payload, &payload_size, EXPECTED_BLOCK_ID,
+                    EXPECTED_BLOCK_ID, EXPECTED_NEXT_ID, EXPECTED_BLOCK_ID, 10,
+                    true, EXPECTED_BLOCK_ID, sizeof(EXPECTED_BLOCK_ID));
+            if (AGENTD_STATUS_SUCCESS != retval)
+                return retval;
+
+            /* make sure to clean up memory when we fall out of scope. */
+            unique_ptr<void, decltype(free)*> cleanup(payload, &free);
+
+            /* write the payload. */
+            payout.write((const char*)payload, payload_size);
+
+            /* success. */
+            return AGENTD_STATUS_SUCCESS;
+        });
+
+    /* start the mocks. */
+    fixture.dataservice->start();
+    fixture.notifyservice->start();
+
+    /* add the hardcoded keys. */
+    TEST_ASSERT(AGENTD_STATUS_SUCCESS == fixture.add_hardcoded_keys());
+
+    /* do the handshake, populating the shared secret on success. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == fixture.do_handshake(&shared_secret, &server_iv, &client_iv));
+
+    /* request the block twice. */
+    for (int i = 0; i < 2; ++i)
+    {
+        data_block_node_t data_block_node;
+        uint8_t* block_cert = nullptr;
+        size_t block_cert_size = 0UL;
+
+        /* send the block get request. */
+        TEST_ASSERT(
+            AGENTD_STATUS_SUCCESS
+                == protocolservice_api_sendreq_block_get(
+                        fixture.protosock, &fixture.suite, &client_iv,
+                        &shared_secret, EXPECTED_BLOCK_ID));
+
+        /* get the response. */
+        TEST_ASSERT(
+            AGENTD_STATUS_SUCCESS
+                == protocolservice_api_recvresp_block_get(
+                        fixture.protosock, &fixture.suite, &server_iv,
+                        &shared_secret, &offset, &status, &data_block_node,
+                        &block_cert, &block_cert_size));
+
+        /* both responses carry the block. */
+        TEST_ASSERT(AGENTD_STATUS_SUCCESS == (int)status);
+        TEST_ASSERT(0U == offset);
+        TEST_ASSERT(
+            0 == memcmp(data_block_node.next, EXPECTED_NEXT_ID, 16));
+        TEST_ASSERT(0 == memcmp(block_cert, EXPECTED_BLOCK_ID, 16));
+        TEST_ASSERT(16U == block_cert_size);
+
+        /* clean up memory. */
+        free(block_cert);
+    }
+
+    /* send the close request. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == protocolservice_api_sendreq_close(
+                    fixture.protosock, &fixture.suite, &client_iv,
+                    &shared_secret));
+
+    /* get the close response. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == protocolservice_api_recvresp_close(
+                    fixture.protosock, &fixture.suite, &server_iv,
+                    &shared_secret));
+
+    /* close the socket */
+    close(fixture.protosock);
+
+    /* stop the mocks. */
+    fixture.dataservice->stop();
+    fixture.notifyservice->stop();
+
+    /* verify proper connection setup. */
+    TEST_EXPECT(0 == fixture.dataservice_mock_valid_connection_setup());
+
+    /* only one block get call should have been made. */
+    TEST_EXPECT(
+        fixture.dataservice->request_matches_block_read(
+            fixture.EXPECTED_CHILD_INDEX, EXPECTED_BLOCK_ID));
+
+    /* verify proper connection teardown. */
+    TEST_EXPECT(0 == fixture.dataservice_mock_valid_connection_teardown());
+
+    /* clean up. */
+    dispose((disposable_t*)&shared_secret);
+END_TEST_F()
+
 /**
  * Test the happy path of block_get_next_id.
  */
@@ -1414,19 +2994,16 @@ BEGIN_TEST_F(block_get_next_id)
     /* register dataservice helper mocks. */
     TEST_ASSERT(0 == fixture.dataservice_mock_register_helper());
 
-    /* mock the block get call. */
-    fixture.dataservice->register_callback_block_read(
-        [&](const dataservice_request_block_read_t&,
+    /* mock the block id next read call. */
+    fixture.dataservice->register_callback_block_id_next_read(
+        [&](const dataservice_request_block_id_link_read_t&,
             std::ostream& payout) {
             void* payload = nullptr;
             size_t payload_size = 0U;
 
             int retval =
-                dataservice_encode_response_block_read(
-                    &payload, &payload_size, EXPECTED_BLOCK_ID,
-                    EXPECTED_BLOCK_ID, EXPECTED_NEXT_BLOCK_ID,
-                    EXPECTED_BLOCK_ID, 10, false, EXPECTED_BLOCK_ID,
-                    sizeof(EXPECTED_BLOCK_ID));
+                dataservice_encode_response_block_id_link_read(
+                    &payload, &payload_size, EXPECTED_NEXT_BLOCK_ID);
             if (AGENTD_STATUS_SUCCESS != retval)
                 return retval;
 
@@ -1498,9 +3075,9 @@ BEGIN_TEST_F(block_get_next_id)
     /* verify proper connection setup. */
     TEST_EXPECT(0 == fixture.dataservice_mock_valid_connection_setup());
 
-    /* a block get call should have been made. */
+    /* a block id next read call should have been made. */
     TEST_EXPECT(
-        fixture.dataservice->request_matches_block_read(
+        fixture.dataservice->request_matches_block_id_next_read(
             fixture.EXPECTED_CHILD_INDEX, EXPECTED_BLOCK_ID));
 
     /* verify proper connection teardown. */
@@ -1522,40 +3099,17 @@ BEGIN_TEST_F(block_get_next_id_end)
         0xca, 0x47, 0xa5, 0xbb, 0x39, 0xaa, 0x44, 0xb2,
         0xb1, 0x7b, 0xc0, 0x55, 0x1a, 0x24, 0x90, 0x9c
     };
-    const uint8_t EXPECTED_NEXT_BLOCK_ID[16] = {
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-    };
     vccrypt_buffer_t shared_secret;
     uint8_t next_id[16];
 
     /* register dataservice helper mocks. */
     TEST_ASSERT(0 == fixture.dataservice_mock_register_helper());
 
-    /* mock the block get call. */
-    fixture.dataservice->register_callback_block_read(
-        [&](const dataservice_request_block_read_t&,
-            std::ostream& payout) {
-            void* payload = nullptr;
-            size_t payload_size = 0U;
-
-            int retval =
-                dataservice_encode_response_block_read(
-                    &payload, &payload_size, EXPECTED_BLOCK_ID,
-                    EXPECTED_BLOCK_ID, EXPECTED_NEXT_BLOCK_ID,
-                    EXPECTED_BLOCK_ID, 10, false, EXPECTED_BLOCK_ID,
-                    sizeof(EXPECTED_BLOCK_ID));
-            if (AGENTD_STATUS_SUCCESS != retval)
-                return retval;
-
-            /* make sure to clean up memory when we fall out of scope. */
-            unique_ptr<void, decltype(free)*> cleanup(payload, &free);
-
-            /* write the payload. */
-            payout.write((const char*)payload, payload_size);
-
-            /* success. */
-            return AGENTD_STATUS_SUCCESS;
+    /* the dataservice reports that the end sentry has no next block. */
+    fixture.dataservice->register_callback_block_id_next_read(
+        [&](const dataservice_request_block_id_link_read_t&,
+            std::ostream&) {
+            return AGENTD_ERROR_DATASERVICE_NOT_FOUND;
         });
 
     /* start the mocks. */
@@ -1613,9 +3167,9 @@ BEGIN_TEST_F(block_get_next_id_end)
     /* verify proper connection setup. */
     TEST_EXPECT(0 == fixture.dataservice_mock_valid_connection_setup());
 
-    /* a block get call should have been made. */
+    /* a block id next read call should have been made. */
     TEST_EXPECT(
-        fixture.dataservice->request_matches_block_read(
+        fixture.dataservice->request_matches_block_id_next_read(
             fixture.EXPECTED_CHILD_INDEX, EXPECTED_BLOCK_ID));
 
     /* verify proper connection teardown. */
@@ -1646,19 +3200,16 @@ BEGIN_TEST_F(block_get_prev_id)
     /* register dataservice helper mocks. */
     TEST_ASSERT(0 == fixture.dataservice_mock_register_helper());
 
-    /* mock the block get call. */
-    fixture.dataservice->register_callback_block_read(
-        [&](const dataservice_request_block_read_t&,
+    /* mock the block id prev read call. */
+    fixture.dataservice->register_callback_block_id_prev_read(
+        [&](const dataservice_request_block_id_link_read_t&,
             std::ostream& payout) {
             void* payload = nullptr;
             size_t payload_size = 0U;
 
             int retval =
-                dataservice_encode_response_block_read(
-                    &payload, &payload_size, EXPECTED_BLOCK_ID,
-                    EXPECTED_PREV_BLOCK_ID, EXPECTED_BLOCK_ID,
-                    EXPECTED_BLOCK_ID, 10, false, EXPECTED_BLOCK_ID,
-                    sizeof(EXPECTED_BLOCK_ID));
+                dataservice_encode_response_block_id_link_read(
+                    &payload, &payload_size, EXPECTED_PREV_BLOCK_ID);
             if (AGENTD_STATUS_SUCCESS != retval)
                 return retval;
 
@@ -1730,9 +3281,9 @@ BEGIN_TEST_F(block_get_prev_id)
     /* verify proper connection setup. */
     TEST_EXPECT(0 == fixture.dataservice_mock_valid_connection_setup());
 
-    /* a block get call should have been made. */
+    /* a block id prev read call should have been made. */
     TEST_EXPECT(
-        fixture.dataservice->request_matches_block_read(
+        fixture.dataservice->request_matches_block_id_prev_read(
             fixture.EXPECTED_CHILD_INDEX, EXPECTED_BLOCK_ID));
 
     /* verify proper connection teardown. */
@@ -1754,40 +3305,17 @@ BEGIN_TEST_F(block_get_prev_id_end)
         0xca, 0x47, 0xa5, 0xbb, 0x39, 0xaa, 0x44, 0xb2,
         0xb1, 0x7b, 0xc0, 0x55, 0x1a, 0x24, 0x90, 0x9c
     };
-    const uint8_t EXPECTED_PREV_BLOCK_ID[16] = {
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-    };
     vccrypt_buffer_t shared_secret;
     uint8_t prev_id[16];
 
     /* register dataservice helper mocks. */
     TEST_ASSERT(0 == fixture.dataservice_mock_register_helper());
 
-    /* mock the block get call. */
-    fixture.dataservice->register_callback_block_read(
-        [&](const dataservice_request_block_read_t&,
-            std::ostream& payout) {
-            void* payload = nullptr;
-            size_t payload_size = 0U;
-
-            int retval =
-                dataservice_encode_response_block_read(
-                    &payload, &payload_size, EXPECTED_BLOCK_ID,
-                    EXPECTED_PREV_BLOCK_ID, EXPECTED_BLOCK_ID,
-                    EXPECTED_BLOCK_ID, 10, false, EXPECTED_BLOCK_ID,
-                    sizeof(EXPECTED_BLOCK_ID));
-            if (AGENTD_STATUS_SUCCESS != retval)
-                return retval;
-
-            /* make sure to clean up memory when we fall out of scope. */
-            unique_ptr<void, decltype(free)*> cleanup(payload, &free);
-
-            /* write the payload. */
-            payout.write((const char*)payload, payload_size);
-
-            /* success. */
-            return AGENTD_STATUS_SUCCESS;
+    /* the dataservice reports that the begin sentry has no prev block. */
+    fixture.dataservice->register_callback_block_id_prev_read(
+        [&](const dataservice_request_block_id_link_read_t&,
+            std::ostream&) {
+            return AGENTD_ERROR_DATASERVICE_NOT_FOUND;
         });
 
     /* start the mocks. */
@@ -1845,9 +3373,9 @@ BEGIN_TEST_F(block_get_prev_id_end)
     /* verify proper connection setup. */
     TEST_EXPECT(0 == fixture.dataservice_mock_valid_connection_setup());
 
-    /* a block get call should have been made. */
+    /* a block id prev read call should have been made. */
     TEST_EXPECT(
-        fixture.dataservice->request_matches_block_read(
+        fixture.dataservice->request_matches_block_id_prev_read(
             fixture.EXPECTED_CHILD_INDEX, EXPECTED_BLOCK_ID));
 
     /* verify proper connection teardown. */
@@ -2459,18 +3987,16 @@ BEGIN_TEST_F(txn_get_block_id_happy_path)
     /* register dataservice helper mocks. */
     TEST_ASSERT(0 == fixture.dataservice_mock_register_helper());
 
-    /* mock the block get call. */
-    fixture.dataservice->register_callback_canonized_transaction_get(
-        [&](const dataservice_request_canonized_transaction_get_t&,
+    /* mock the block id with transaction read call. */
+    fixture.dataservice->register_callback_block_id_with_transaction_read(
+        [&](const dataservice_request_block_id_link_read_t&,
             std::ostream& payout) {
             void* payload = nullptr;
             size_t payload_size = 0U;
 
             int retval =
-                dataservice_encode_response_canonized_transaction_get(
-                    &payload, &payload_size, EXPECTED_TXN_ID, EXPECTED_TXN_ID,
-                    EXPECTED_TXN_ID, EXPECTED_TXN_ID, EXPECTED_BLOCK_TXN_ID, 10,
-                    true, EXPECTED_TXN_ID, sizeof(EXPECTED_TXN_ID));
+                dataservice_encode_response_block_id_link_read(
+                    &payload, &payload_size, EXPECTED_BLOCK_TXN_ID);
             if (AGENTD_STATUS_SUCCESS != retval)
                 return retval;
 
@@ -2542,9 +4068,9 @@ BEGIN_TEST_F(txn_get_block_id_happy_path)
     /* verify proper connection setup. */
     TEST_EXPECT(0 == fixture.dataservice_mock_valid_connection_setup());
 
-    /* a block get call should have been made. */
+    /* a block id with transaction read call should have been made. */
     TEST_EXPECT(
-        fixture.dataservice->request_matches_canonized_transaction_get(
+        fixture.dataservice->request_matches_block_id_with_transaction_read(
             fixture.EXPECTED_CHILD_INDEX, EXPECTED_TXN_ID));
 
     /* verify proper connection teardown. */
@@ -60,7 +60,7 @@ std::map<std::string, capabilities_entry> capabilities_map;
 class protocolservice_isolation_test : public directory_test_helper
 {
 public:
-    void setUp();
+    void setUp(bool with_reader = false);
     void tearDown();
 
     bootstrap_config_t bconf;
@@ -68,7 +68,9 @@ public:
     int acceptsock;
     int controlsock;
     int notifysock;
+    int wakeupsock;
     int datasock;
+    int datareadersock;
     int logsock;
     int protosock;
     int rlogsock;
@@ -88,6 +90,7 @@ public:
     vccrypt_buffer_t client_private_key;
     bool client_private_key_initialized;
     std::unique_ptr<mock_dataservice::mock_dataservice> dataservice;
+    std::unique_ptr<mock_dataservice::mock_dataservice> datareader;
     std::unique_ptr<mock_notificationservice::mock_notificationservice>
     notifyservice;
     capabilities_map entity_caps;
@@ -129,12 +132,18 @@ public:
 
     /** \brief Helper to register dataservice boilerplate methods. */
     int dataservice_mock_register_helper();
+    int dataservice_mock_register_helper(
+        mock_dataservice::mock_dataservice& mock);
 
     /** \brief Helper to verify dataservice calls on connection setup. */
     int dataservice_mock_valid_connection_setup();
+    int dataservice_mock_valid_connection_setup(
+        mock_dataservice::mock_dataservice& mock);
 
     /** \brief Helper to verify dataservice calls on connection teardown. */
     int dataservice_mock_valid_connection_teardown();
+    int dataservice_mock_valid_connection_teardown(
+        mock_dataservice::mock_dataservice& mock);
 
     /** \brief Add hardcoded keys to the protocol service. */
     int add_hardcoded_keys();
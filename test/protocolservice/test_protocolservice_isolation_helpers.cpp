@@ -190,7 +190,7 @@ const capabilities_map protocolservice_isolation_test::global_caps{
             protocolservice_isolation_test::verb_extended_api_resp,
             protocolservice_isolation_test::blank_uuid } } };
 
-void protocolservice_isolation_test::setUp()
+void protocolservice_isolation_test::setUp(bool with_reader)
 {
     status retval;
 
@@ -263,6 +263,15 @@ void protocolservice_isolation_test::setUp()
     int datasock_srv;
     ipc_socketpair(AF_UNIX, SOCK_STREAM, 0, &datasock, &datasock_srv);
 
+    /* create the socket pair for the read-only datasock, if requested. */
+    int datareadersock_srv = -1;
+    datareadersock = -1;
+    if (with_reader)
+    {
+        ipc_socketpair(
+            AF_UNIX, SOCK_STREAM, 0, &datareadersock, &datareadersock_srv);
+    }
+
     /* create the socket pair for the acceptsock. */
     int acceptsock_srv;
     ipc_socketpair(AF_UNIX, SOCK_DGRAM, 0, &acceptsock, &acceptsock_srv);
@@ -275,6 +284,10 @@ void protocolservice_isolation_test::setUp()
     int notifysock_srv;
     ipc_socketpair(AF_UNIX, SOCK_STREAM, 0, &notifysock, &notifysock_srv);
 
+    /* create the socket pair for the attestation wakeup socket. */
+    int wakeupsock_srv;
+    ipc_socketpair(AF_UNIX, SOCK_DGRAM, 0, &wakeupsock, &wakeupsock_srv);
+
     /* create the bootstrap config. */
     bootstrap_config_init(&bconf);
 
@@ -291,11 +304,20 @@ void protocolservice_isolation_test::setUp()
     proto_proc_status =
         protocolservice_proc(
             &bconf, &conf, rprotosock, logsock, acceptsock_srv, controlsock_srv,
-            datasock_srv, notifysock_srv, &protopid, false);
+            datasock_srv, notifysock_srv, wakeupsock_srv,
+            with_reader ? &datareadersock_srv : NULL, with_reader ? 1 : 0,
+            &protopid, false);
 
     /* create the mock dataservice. */
     dataservice = make_unique<mock_dataservice::mock_dataservice>(datasock);
 
+    /* create the mock read-only dataservice, if requested. */
+    if (with_reader)
+    {
+        datareader =
+            make_unique<mock_dataservice::mock_dataservice>(datareadersock);
+    }
+
     /* create the mock notificationservice. */
     notifyservice =
         make_unique<mock_notificationservice::mock_notificationservice>(
@@ -354,15 +376,22 @@ void protocolservice_isolation_test::tearDown()
 
     /* clean up. */
     dataservice->stop();
+    if (datareader)
+    {
+        datareader->stop();
+    }
     dispose((disposable_t*)&conf);
     dispose((disposable_t*)&bconf);
     close(logsock);
     if (rlogsock >= 0)
         close(rlogsock);
     close(datasock);
+    if (datareadersock >= 0)
+        close(datareadersock);
     close(acceptsock);
     close(controlsock);
     close(notifysock);
+    close(wakeupsock);
     free(path);
     if (suite_instance_initialized)
     {
@@ -466,9 +495,15 @@ done:
 }
 
 int protocolservice_isolation_test::dataservice_mock_register_helper()
+{
+    return dataservice_mock_register_helper(*dataservice);
+}
+
+int protocolservice_isolation_test::dataservice_mock_register_helper(
+    mock_dataservice::mock_dataservice& mock)
 {
     /* mock the child context create call. */
-    dataservice->register_callback_child_context_create(
+    mock.register_callback_child_context_create(
         [&](const dataservice_request_child_context_create_t&,
             std::ostream& payout) {
             void* payload = nullptr;
@@ -491,7 +526,7 @@ int protocolservice_isolation_test::dataservice_mock_register_helper()
         });
 
     /* mock the child context close call. */
-    dataservice->register_callback_child_context_close(
+    mock.register_callback_child_context_close(
         [&](const dataservice_request_child_context_close_t&,
             std::ostream&) {
             /* success. */
@@ -503,6 +538,13 @@ int protocolservice_isolation_test::dataservice_mock_register_helper()
 
 int protocolservice_isolation_test::
     dataservice_mock_valid_connection_setup()
+{
+    return dataservice_mock_valid_connection_setup(*dataservice);
+}
+
+int protocolservice_isolation_test::
+    dataservice_mock_valid_connection_setup(
+        mock_dataservice::mock_dataservice& mock)
 {
     /* a child context should have been created. */
     BITCAP(testbits, DATASERVICE_API_CAP_BITS_MAX);
@@ -510,11 +552,15 @@ int protocolservice_isolation_test::
     BITCAP_SET_TRUE(testbits, DATASERVICE_API_CAP_LL_CHILD_CONTEXT_CLOSE);
     BITCAP_SET_TRUE(testbits, DATASERVICE_API_CAP_APP_BLOCK_ID_LATEST_READ);
     BITCAP_SET_TRUE(testbits, DATASERVICE_API_CAP_APP_BLOCK_READ);
+    BITCAP_SET_TRUE(testbits, DATASERVICE_API_CAP_APP_BLOCK_ID_NEXT_READ);
+    BITCAP_SET_TRUE(testbits, DATASERVICE_API_CAP_APP_BLOCK_ID_PREV_READ);
     BITCAP_SET_TRUE(testbits, DATASERVICE_API_CAP_APP_TRANSACTION_READ);
+    BITCAP_SET_TRUE(
+        testbits, DATASERVICE_API_CAP_APP_BLOCK_ID_WITH_TRANSACTION_READ);
     BITCAP_SET_TRUE(testbits, DATASERVICE_API_CAP_APP_PQ_TRANSACTION_SUBMIT);
     BITCAP_SET_TRUE(testbits, DATASERVICE_API_CAP_APP_ARTIFACT_READ);
     BITCAP_SET_TRUE(testbits, DATASERVICE_API_CAP_APP_BLOCK_ID_BY_HEIGHT_READ);
-    if (!dataservice->request_matches_child_context_create(testbits))
+    if (!mock.request_matches_child_context_create(testbits))
     {
         return 1;
     }
@@ -524,9 +570,16 @@ int protocolservice_isolation_test::
 
 int protocolservice_isolation_test::
     dataservice_mock_valid_connection_teardown()
+{
+    return dataservice_mock_valid_connection_teardown(*dataservice);
+}
+
+int protocolservice_isolation_test::
+    dataservice_mock_valid_connection_teardown(
+        mock_dataservice::mock_dataservice& mock)
 {
     /* the child index should have been closed. */
-    if (!dataservice->request_matches_child_context_close(EXPECTED_CHILD_INDEX))
+    if (!mock.request_matches_child_context_close(EXPECTED_CHILD_INDEX))
         return 1;
 
     return 0;
@@ -0,0 +1,170 @@
+/**
+ * \file test_protocolservice_random_endpoint.cpp
+ *
+ * \brief Test the protocol service random endpoint entropy pool.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/randomservice.h>
+#include <agentd/status_codes.h>
+#include <cstring>
+#include <minunit/minunit.h>
+#include <vector>
+
+#include "../randomservice/test_random_service_isolation.h"
+#include "../../src/protocolservice/protocolservice_internal.h"
+
+using namespace std;
+
+TEST_SUITE(protocolservice_random_endpoint);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    random_service_isolation_test fixture; \
+    fixture.setUp(); \
+    vector<uint8_t> pool(RANDOM_ENDPOINT_POOL_SIZE, 0); \
+    protocolservice_random_endpoint_context ctx; \
+    memset(&ctx, 0, sizeof(ctx)); \
+    ctx.alloc = fixture.ralloc; \
+    ctx.randomsock = fixture.proto; \
+    ctx.pool = pool.data(); \
+    TEST_ASSERT(0 == fixture.random_proc_status); \
+    TEST_ASSERT(0 == fixture.ralloc_status); \
+    TEST_ASSERT(0 == fixture.proto_status);
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+/**
+ * \brief Return true if the given bytes are all zero.
+ */
+static bool all_zero(const uint8_t* data, size_t size)
+{
+    for (size_t i = 0; i < size; ++i)
+    {
+        if (0 != data[i])
+            return false;
+    }
+
+    return true;
+}
+
+/**
+ * Test that the pool is refilled ahead of need, and that requests keep being
+ * served from the pool while the refill is in flight.
+ */
+BEGIN_TEST_F(refill_does_not_block_replies)
+    const size_t REQUEST_SIZE = 1024;
+    uint8_t data[REQUEST_SIZE];
+
+    /* fill the pool. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == protocolservice_random_endpoint_refill_begin(&ctx));
+    TEST_ASSERT(
+        STATUS_SUCCESS == protocolservice_random_endpoint_refill_end(&ctx));
+    TEST_ASSERT(RANDOM_ENDPOINT_POOL_SIZE == ctx.pool_avail);
+    TEST_EXPECT(!ctx.refill_pending);
+
+    /* drain the pool down to the low water mark. */
+    while (ctx.pool_avail >= RANDOM_ENDPOINT_POOL_LOW_WATER)
+    {
+        TEST_ASSERT(!ctx.refill_pending);
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == protocolservice_random_endpoint_read_bytes(
+                        &ctx, data, sizeof(data)));
+    }
+
+    /* crossing the low water mark requests a refill without collecting it. */
+    TEST_EXPECT(ctx.refill_pending);
+    TEST_EXPECT(RANDOM_ENDPOINT_POOL_LOW_WATER > ctx.pool_avail);
+
+    /* served bytes are cleared from the pool. */
+    TEST_EXPECT(
+        all_zero(
+            pool.data() + ctx.pool_avail,
+            RANDOM_ENDPOINT_POOL_SIZE - ctx.pool_avail));
+
+    /* the rest of the pool is served while the refill is in flight. */
+    while (ctx.pool_avail >= sizeof(data))
+    {
+        size_t before = ctx.pool_avail;
+
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == protocolservice_random_endpoint_read_bytes(
+                        &ctx, data, sizeof(data)));
+        TEST_EXPECT(ctx.refill_pending);
+        TEST_EXPECT(before - sizeof(data) == ctx.pool_avail);
+    }
+
+    /* once the pool runs dry, the refill is collected. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == protocolservice_random_endpoint_read_bytes(
+                    &ctx, data, sizeof(data)));
+    TEST_EXPECT(ctx.pool_avail >= RANDOM_ENDPOINT_POOL_LOW_WATER);
+    TEST_EXPECT(!ctx.refill_pending);
+    TEST_EXPECT(!all_zero(data, sizeof(data)));
+
+    memset(pool.data(), 0, pool.size());
+END_TEST_F()
+
+/**
+ * Test that a request larger than the pool is read directly from the random
+ * service, after any pending refill has been collected.
+ */
+BEGIN_TEST_F(oversized_request_served_directly)
+    const size_t REQUEST_SIZE = RANDOM_ENDPOINT_POOL_SIZE + 1;
+    vector<uint8_t> data(REQUEST_SIZE, 0);
+
+    /* start a refill, but don't collect it. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == protocolservice_random_endpoint_refill_begin(&ctx));
+    TEST_ASSERT(ctx.refill_pending);
+
+    /* the oversized request succeeds. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == protocolservice_random_endpoint_read_bytes(
+                    &ctx, data.data(), data.size()));
+
+    /* the pending refill went into the pool, and the pool was not drawn. */
+    TEST_EXPECT(!ctx.refill_pending);
+    TEST_EXPECT(RANDOM_ENDPOINT_POOL_SIZE == ctx.pool_avail);
+
+    /* the bytes past the pool size were filled as well. */
+    TEST_EXPECT(
+        !all_zero(
+            data.data() + RANDOM_ENDPOINT_POOL_SIZE,
+            REQUEST_SIZE - RANDOM_ENDPOINT_POOL_SIZE));
+
+    /* the endpoint can still serve from the pool. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == protocolservice_random_endpoint_read_bytes(
+                    &ctx, data.data(), 64));
+    TEST_EXPECT(RANDOM_ENDPOINT_POOL_SIZE - 64 == ctx.pool_avail);
+
+    memset(pool.data(), 0, pool.size());
+END_TEST_F()
+
+/**
+ * Test that a request the random service can't satisfy fails without touching
+ * the pool.
+ */
+BEGIN_TEST_F(request_over_bulk_maximum_fails)
+    const size_t REQUEST_SIZE =
+        RANDOMSERVICE_GET_RANDOM_BYTES_BULK_MAXIMUM_SIZE + 1;
+    vector<uint8_t> data(REQUEST_SIZE, 0);
+
+    TEST_EXPECT(
+        AGENTD_ERROR_PROTOCOLSERVICE_PRNG_REQUEST_FAILURE
+            == protocolservice_random_endpoint_read_bytes(
+                    &ctx, data.data(), data.size()));
+    TEST_EXPECT(0U == ctx.pool_avail);
+    TEST_EXPECT(!ctx.refill_pending);
+END_TEST_F()
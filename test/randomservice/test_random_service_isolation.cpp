@@ -95,6 +95,69 @@ BEGIN_TEST_F(many_bytes)
     TEST_EXPECT(100U == random_byte_buffer_size);
 END_TEST_F()
 
+/**
+ * Test that we can get a large block of random data in a single bulk response.
+ */
+BEGIN_TEST_F(bulk_bytes)
+    const uint32_t EXPECTED_OFFSET = 17U;
+    const uint32_t EXPECTED_SIZE =
+        RANDOMSERVICE_GET_RANDOM_BYTES_BULK_MAXIMUM_SIZE;
+    uint32_t offset, status;
+    void* random_byte_buffer = nullptr;
+    size_t random_byte_buffer_size = 0UL;
+
+    /* send a blocking request to get a bulk block of random bytes. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == random_service_api_sendreq_random_bytes_get_bulk(
+                    fixture.proto, EXPECTED_OFFSET, EXPECTED_SIZE));
+
+    /* receive a blocking response to get random bytes. */
+    TEST_ASSERT(
+        AGENTD_STATUS_SUCCESS
+            == random_service_api_recvresp_random_bytes_get_bulk(
+                    fixture.proto, fixture.ralloc, &offset, &status,
+                    &random_byte_buffer, &random_byte_buffer_size));
+
+    /* verify offset, status, and size. */
+    TEST_EXPECT(EXPECTED_OFFSET == offset);
+    TEST_EXPECT(AGENTD_STATUS_SUCCESS == (int)status);
+    TEST_EXPECT(EXPECTED_SIZE == random_byte_buffer_size);
+END_TEST_F()
+
+/**
+ * Test that several queued requests are each answered, in order.
+ */
+BEGIN_TEST_F(pipelined_requests)
+    const uint32_t REQUEST_COUNT = 8U;
+    uint32_t offset, status;
+    void* random_byte_buffer = nullptr;
+    size_t random_byte_buffer_size = 0UL;
+
+    /* queue several requests before reading any responses. */
+    for (uint32_t i = 0; i < REQUEST_COUNT; ++i)
+    {
+        TEST_ASSERT(
+            AGENTD_STATUS_SUCCESS
+                == random_service_api_sendreq_random_bytes_get(
+                        fixture.proto, i, 32));
+    }
+
+    /* each response arrives in order. */
+    for (uint32_t i = 0; i < REQUEST_COUNT; ++i)
+    {
+        TEST_ASSERT(
+            AGENTD_STATUS_SUCCESS
+                == random_service_api_recvresp_random_bytes_get(
+                        fixture.proto, fixture.ralloc, &offset, &status,
+                        &random_byte_buffer, &random_byte_buffer_size));
+
+        TEST_EXPECT(i == offset);
+        TEST_EXPECT(AGENTD_STATUS_SUCCESS == (int)status);
+        TEST_EXPECT(32U == random_byte_buffer_size);
+    }
+END_TEST_F()
+
 /**
  * Test that we can get one byte of random data from the random service.
  */
@@ -0,0 +1,141 @@
+/**
+ * \file test_workpool.cpp
+ *
+ * \brief Test the worker pool.
+ *
+ * \copyright 2022 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <agentd/workpool.h>
+#include <cstring>
+#include <minunit/minunit.h>
+#include <pthread.h>
+
+RCPR_IMPORT_allocator_as(rcpr);
+RCPR_IMPORT_resource;
+
+using namespace std;
+
+TEST_SUITE(workpool);
+
+namespace
+{
+    struct slice_test
+    {
+        size_t visits[512];
+        size_t calls;
+        bool other_thread;
+        pthread_t caller;
+    };
+}
+
+/**
+ * \brief Count each visit, and note if a slice ran off the calling thread.
+ */
+static void count_slice(void* context, size_t begin, size_t end)
+{
+    slice_test* test = (slice_test*)context;
+
+    for (size_t i = begin; i < end; ++i)
+    {
+        ++test->visits[i];
+    }
+
+    /* slices visit disjoint items, but share the call bookkeeping. */
+    __atomic_add_fetch(&test->calls, 1, __ATOMIC_SEQ_CST);
+    if (!pthread_equal(test->caller, pthread_self()))
+    {
+        __atomic_store_n(&test->other_thread, true, __ATOMIC_SEQ_CST);
+    }
+}
+
+/**
+ * \brief Each item is visited exactly once, across several runs.
+ */
+TEST(every_item_once)
+{
+    rcpr_allocator* alloc;
+    workpool* pool;
+    slice_test test;
+
+    TEST_ASSERT(0 == rcpr_malloc_allocator_create(&alloc));
+    TEST_ASSERT(0 == workpool_create(&pool, alloc, 4));
+
+    /* include counts that don't split evenly, and fewer items than slices. */
+    const size_t counts[] = { 0, 1, 3, 4, 5, 63, 64, 511, 512 };
+    for (size_t count : counts)
+    {
+        memset(&test, 0, sizeof(test));
+        test.caller = pthread_self();
+
+        workpool_run(pool, &count_slice, &test, count, 1);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            TEST_EXPECT(1U == test.visits[i]);
+        }
+
+        for (size_t i = count; i < 512; ++i)
+        {
+            TEST_EXPECT(0U == test.visits[i]);
+        }
+    }
+
+    TEST_ASSERT(0 == resource_release(workpool_resource_handle(pool)));
+    TEST_ASSERT(0 == resource_release(rcpr_allocator_resource_handle(alloc)));
+}
+
+/**
+ * \brief Large loops are split across the workers.
+ */
+TEST(large_loop_uses_workers)
+{
+    rcpr_allocator* alloc;
+    workpool* pool;
+    slice_test test;
+
+    TEST_ASSERT(0 == rcpr_malloc_allocator_create(&alloc));
+    TEST_ASSERT(0 == workpool_create(&pool, alloc, 4));
+
+    memset(&test, 0, sizeof(test));
+    test.caller = pthread_self();
+
+    workpool_run(pool, &count_slice, &test, 512, 64);
+
+    /* one slice ran on the caller, and the rest on the workers. */
+    TEST_EXPECT(test.calls > 1U);
+    TEST_EXPECT(test.other_thread);
+
+    TEST_ASSERT(0 == resource_release(workpool_resource_handle(pool)));
+    TEST_ASSERT(0 == resource_release(rcpr_allocator_resource_handle(alloc)));
+}
+
+/**
+ * \brief Loops under the minimum, or without a pool, run as one inline slice.
+ */
+TEST(small_loop_runs_inline)
+{
+    rcpr_allocator* alloc;
+    workpool* pool;
+    slice_test test;
+
+    TEST_ASSERT(0 == rcpr_malloc_allocator_create(&alloc));
+    TEST_ASSERT(0 == workpool_create(&pool, alloc, 4));
+
+    memset(&test, 0, sizeof(test));
+    test.caller = pthread_self();
+    workpool_run(pool, &count_slice, &test, 63, 64);
+    TEST_EXPECT(1U == test.calls);
+    TEST_EXPECT(!test.other_thread);
+    TEST_EXPECT(1U == test.visits[62]);
+
+    memset(&test, 0, sizeof(test));
+    test.caller = pthread_self();
+    workpool_run(nullptr, &count_slice, &test, 512, 64);
+    TEST_EXPECT(1U == test.calls);
+    TEST_EXPECT(!test.other_thread);
+    TEST_EXPECT(1U == test.visits[511]);
+
+    TEST_ASSERT(0 == resource_release(workpool_resource_handle(pool)));
+    TEST_ASSERT(0 == resource_release(rcpr_allocator_resource_handle(alloc)));
+}